@@ -0,0 +1,272 @@
+// Copyright 2023 the Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/// \file
+/// \brief This file implements a spatial hash with flat storage for fixed-radius and polygon
+///        queries in 2D
+
+#ifndef GEOMETRY__FLAT_SPATIAL_HASH_HPP_
+#define GEOMETRY__FLAT_SPATIAL_HASH_HPP_
+
+#include <common/types.hpp>
+#include <geometry/common_2d.hpp>
+#include <geometry/spatial_hash_config.hpp>
+#include <geometry/visibility_control.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <vector>
+
+namespace autoware
+{
+namespace common
+{
+namespace geometry
+{
+namespace spatial_hash
+{
+using autoware::common::types::float64_t;
+
+/// \brief A 2D spatial hash whose points are sorted by bin into flat arrays
+///
+/// Unlike SpatialHash, all the points are given at once to build(). They are placed by a counting
+/// sort, so that the points of a bin are stored contiguously and no memory is allocated per point.
+/// The buffers are kept between the builds, so that the same object can be rebuilt for every
+/// message without allocation once it has grown. The bounds are taken from the points, and the
+/// points with a non-finite coordinate are not stored.
+///
+/// The queries report the index of each point in the input of build(). A point on the query circle
+/// or on the polygon boundary is outside, the same as boost::geometry::within.
+class GEOMETRY_PUBLIC FlatSpatialHash2d
+{
+public:
+  /// \brief Constructor
+  /// \param[in] side_length The side length of the bins, typically the radius of the queries
+  /// \throw std::domain_error If side_length is not positive
+  explicit FlatSpatialHash2d(const float64_t side_length);
+
+  /// \brief Builds the hash from a range of points, replacing the points of the previous build
+  /// \param[in] begin The start of the range of points
+  /// \param[in] end The end of the range of points
+  /// \tparam IteratorT The iterator type, whose points must be supported by the point adapters
+  template <typename IteratorT>
+  void build(IteratorT begin, IteratorT end)
+  {
+    m_input_x.clear();
+    m_input_y.clear();
+    for (IteratorT it = begin; it != end; ++it) {
+      m_input_x.push_back(static_cast<float64_t>(point_adapter::x_(*it)));
+      m_input_y.push_back(static_cast<float64_t>(point_adapter::y_(*it)));
+    }
+    build_impl();
+  }
+
+  /// \brief Builds the hash from the x and y fields of a point cloud
+  /// \param[in] cloud The point cloud, the index of a point is its position in the data
+  /// \throw std::runtime_error If the cloud has no x or y field
+  void build(const sensor_msgs::msg::PointCloud2 & cloud);
+
+  /// \brief Removes all the points, the memory is kept for the next build
+  void clear();
+
+  /// \brief Gets the number of points given to the last build, including the non-finite ones
+  /// \return The number of points
+  Index size() const { return m_input_x.size(); }
+
+  /// \brief Whether no point was given to the last build
+  /// \return True if there is no point
+  bool8_t empty() const { return m_input_x.empty(); }
+
+  /// \brief Gets the x value of a point
+  /// \param[in] idx The index of the point in the input of build()
+  /// \return The x value of the point
+  float64_t x(const Index idx) const { return m_input_x[idx]; }
+
+  /// \brief Gets the y value of a point
+  /// \param[in] idx The index of the point in the input of build()
+  /// \return The y value of the point
+  float64_t y(const Index idx) const { return m_input_y[idx]; }
+
+  /// \brief Calls func(index) for the points strictly within the radius, until it returns true
+  /// \param[in] x The x value of the query point
+  /// \param[in] y The y value of the query point
+  /// \param[in] radius The radius of the query
+  /// \param[in] func The function called with the index of each point found
+  /// \tparam FuncT The function type, returning true to stop the query
+  /// \return True if the query was stopped by func
+  template <typename FuncT>
+  bool8_t visit_within_radius(
+    const float64_t x, const float64_t y, const float64_t radius, FuncT && func) const
+  {
+    BinRange range;
+    if (!(radius > 0.0) || !get_bin_range(x - radius, y - radius, x + radius, y + radius, range)) {
+      return false;
+    }
+    const float64_t radius2 = radius * radius;
+    for (Index iy = range.y_min; iy <= range.y_max; ++iy) {
+      const Index row = iy * m_num_x;
+      for (Index bin = row + range.x_min; bin <= row + range.x_max; ++bin) {
+        for (Index k = m_bin_offsets[bin]; k < m_bin_offsets[bin + 1U]; ++k) {
+          const float64_t dx = m_x[k] - x;
+          const float64_t dy = m_y[k] - y;
+          if (((dx * dx) + (dy * dy)) < radius2 && func(m_indices[k])) {
+            return true;
+          }
+        }
+      }
+    }
+    return false;
+  }
+
+  /// \brief Finds the points strictly within the radius
+  /// \param[in] x The x value of the query point
+  /// \param[in] y The y value of the query point
+  /// \param[in] radius The radius of the query
+  /// \param[out] indices The indices of the points found, cleared first
+  void radius_search(
+    const float64_t x, const float64_t y, const float64_t radius,
+    std::vector<Index> & indices) const;
+
+  /// \brief Calls func(index) for the points strictly inside the polygon, until it returns true
+  /// \param[in] polygon The vertices of the polygon, which may be closed or not
+  /// \param[in] func The function called with the index of each point found
+  /// \tparam PolygonT A bidirectional container of points supported by the point adapters
+  /// \tparam FuncT The function type, returning true to stop the query
+  /// \return True if the query was stopped by func
+  template <typename PolygonT, typename FuncT>
+  bool8_t visit_within_polygon(const PolygonT & polygon, FuncT && func) const
+  {
+    const auto begin = std::begin(polygon);
+    const auto end = std::end(polygon);
+    if (begin == end) {
+      return false;
+    }
+    float64_t min_x = static_cast<float64_t>(point_adapter::x_(*begin));
+    float64_t min_y = static_cast<float64_t>(point_adapter::y_(*begin));
+    float64_t max_x = min_x;
+    float64_t max_y = min_y;
+    for (auto it = begin; it != end; ++it) {
+      min_x = std::min(min_x, static_cast<float64_t>(point_adapter::x_(*it)));
+      min_y = std::min(min_y, static_cast<float64_t>(point_adapter::y_(*it)));
+      max_x = std::max(max_x, static_cast<float64_t>(point_adapter::x_(*it)));
+      max_y = std::max(max_y, static_cast<float64_t>(point_adapter::y_(*it)));
+    }
+    BinRange range;
+    if (!get_bin_range(min_x, min_y, max_x, max_y, range)) {
+      return false;
+    }
+    for (Index iy = range.y_min; iy <= range.y_max; ++iy) {
+      const Index row = iy * m_num_x;
+      for (Index bin = row + range.x_min; bin <= row + range.x_max; ++bin) {
+        for (Index k = m_bin_offsets[bin]; k < m_bin_offsets[bin + 1U]; ++k) {
+          if (
+            m_x[k] > min_x && m_x[k] < max_x && m_y[k] > min_y && m_y[k] < max_y &&
+            is_strictly_inside(m_x[k], m_y[k], begin, end) && func(m_indices[k])) {
+            return true;
+          }
+        }
+      }
+    }
+    return false;
+  }
+
+  /// \brief Finds the points strictly inside the polygon
+  /// \param[in] polygon The vertices of the polygon, which may be closed or not
+  /// \param[out] indices The indices of the points found, cleared first
+  /// \tparam PolygonT A bidirectional container of points supported by the point adapters
+  template <typename PolygonT>
+  void polygon_search(const PolygonT & polygon, std::vector<Index> & indices) const
+  {
+    indices.clear();
+    (void)visit_within_polygon(polygon, [&indices](const Index idx) {
+      indices.push_back(idx);
+      return false;
+    });
+  }
+
+private:
+  /// \brief Inclusive range of the bins overlapping with a box
+  struct BinRange
+  {
+    Index x_min;
+    Index x_max;
+    Index y_min;
+    Index y_max;
+  };
+
+  /// \brief Sorts the stored input points by bin
+  void build_impl();
+
+  /// \brief Gets the bins overlapping with a box
+  /// \return False if the box does not overlap with the bounds of the points
+  bool8_t get_bin_range(
+    const float64_t min_x, const float64_t min_y, const float64_t max_x, const float64_t max_y,
+    BinRange & range) const;
+
+  /// \brief Crossing number test, a point on an edge is outside
+  template <typename IteratorT>
+  static bool8_t is_strictly_inside(
+    const float64_t x, const float64_t y, const IteratorT begin, const IteratorT end)
+  {
+    bool8_t inside = false;
+    auto prev = std::prev(end);
+    for (auto it = begin; it != end; prev = it, ++it) {
+      const float64_t x1 = static_cast<float64_t>(point_adapter::x_(*prev));
+      const float64_t y1 = static_cast<float64_t>(point_adapter::y_(*prev));
+      const float64_t x2 = static_cast<float64_t>(point_adapter::x_(*it));
+      const float64_t y2 = static_cast<float64_t>(point_adapter::y_(*it));
+      const float64_t cross = ((x2 - x1) * (y - y1)) - ((y2 - y1) * (x - x1));
+      if (
+        cross == 0.0 && x >= std::min(x1, x2) && x <= std::max(x1, x2) && y >= std::min(y1, y2) &&
+        y <= std::max(y1, y2)) {
+        return false;
+      }
+      if ((y1 > y) != (y2 > y)) {
+        const float64_t x_cross = x1 + (((y - y1) * (x2 - x1)) / (y2 - y1));
+        if (x < x_cross) {
+          inside = !inside;
+        }
+      }
+    }
+    return inside;
+  }
+
+  float64_t m_side_length;
+  float64_t m_inv_bin_size{0.0};
+  float64_t m_min_x{0.0};
+  float64_t m_min_y{0.0};
+  Index m_num_x{0U};
+  Index m_num_y{0U};
+  // points given to build(), in the input order
+  std::vector<float64_t> m_input_x;
+  std::vector<float64_t> m_input_y;
+  // bin of each input point, used during the build only
+  std::vector<Index> m_input_bins;
+  // range [m_bin_offsets[i], m_bin_offsets[i + 1]) of the sorted points in the bin i
+  std::vector<Index> m_bin_offsets;
+  std::vector<Index> m_bin_cursors;
+  // finite points sorted by bin
+  std::vector<float64_t> m_x;
+  std::vector<float64_t> m_y;
+  std::vector<Index> m_indices;
+};  // class FlatSpatialHash2d
+
+}  // namespace spatial_hash
+}  // namespace geometry
+}  // namespace common
+}  // namespace autoware
+
+#endif  // GEOMETRY__FLAT_SPATIAL_HASH_HPP_
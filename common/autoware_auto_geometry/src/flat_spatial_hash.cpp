@@ -0,0 +1,196 @@
+// Copyright 2023 the Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <geometry/flat_spatial_hash.hpp>
+
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+// lint -e537 NOLINT repeated include file due to cpplint rule
+#include <algorithm>
+#include <stdexcept>
+
+namespace autoware
+{
+namespace common
+{
+namespace geometry
+{
+namespace spatial_hash
+{
+namespace
+{
+// The bins are enlarged when the bounds are large compared with the side length, so that the
+// number of bins stays in the order of the number of points.
+constexpr Index min_max_bins = 1024U;
+constexpr Index max_bins_per_point = 4U;
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+FlatSpatialHash2d::FlatSpatialHash2d(const float64_t side_length) : m_side_length(side_length)
+{
+  if (!(side_length > 0.0)) {
+    throw std::domain_error{"FlatSpatialHash2d: side length must be positive"};
+  }
+}
+////////////////////////////////////////////////////////////////////////////////
+void FlatSpatialHash2d::build(const sensor_msgs::msg::PointCloud2 & cloud)
+{
+  const Index num_points = static_cast<Index>(cloud.width) * static_cast<Index>(cloud.height);
+  m_input_x.resize(num_points);
+  m_input_y.resize(num_points);
+  if (num_points > 0U) {
+    sensor_msgs::PointCloud2ConstIterator<float32_t> iter_x(cloud, "x");
+    sensor_msgs::PointCloud2ConstIterator<float32_t> iter_y(cloud, "y");
+    for (Index i = 0U; i < num_points; ++i, ++iter_x, ++iter_y) {
+      m_input_x[i] = static_cast<float64_t>(*iter_x);
+      m_input_y[i] = static_cast<float64_t>(*iter_y);
+    }
+  }
+  build_impl();
+}
+////////////////////////////////////////////////////////////////////////////////
+void FlatSpatialHash2d::clear()
+{
+  m_input_x.clear();
+  m_input_y.clear();
+  build_impl();
+}
+////////////////////////////////////////////////////////////////////////////////
+void FlatSpatialHash2d::radius_search(
+  const float64_t x, const float64_t y, const float64_t radius, std::vector<Index> & indices) const
+{
+  indices.clear();
+  (void)visit_within_radius(x, y, radius, [&indices](const Index idx) {
+    indices.push_back(idx);
+    return false;
+  });
+}
+////////////////////////////////////////////////////////////////////////////////
+void FlatSpatialHash2d::build_impl()
+{
+  const Index num_points = m_input_x.size();
+  m_x.clear();
+  m_y.clear();
+  m_indices.clear();
+  m_num_x = 0U;
+  m_num_y = 0U;
+
+  // bounds of the finite points
+  Index num_finite = 0U;
+  float64_t max_x = 0.0;
+  float64_t max_y = 0.0;
+  for (Index i = 0U; i < num_points; ++i) {
+    const float64_t x = m_input_x[i];
+    const float64_t y = m_input_y[i];
+    if (!std::isfinite(x) || !std::isfinite(y)) {
+      continue;
+    }
+    if (num_finite == 0U) {
+      m_min_x = max_x = x;
+      m_min_y = max_y = y;
+    } else {
+      m_min_x = std::min(m_min_x, x);
+      m_min_y = std::min(m_min_y, y);
+      max_x = std::max(max_x, x);
+      max_y = std::max(max_y, y);
+    }
+    ++num_finite;
+  }
+  if (num_finite == 0U) {
+    m_bin_offsets.assign(1U, 0U);
+    return;
+  }
+
+  // number of bins, computed in floating point so that it cannot overflow
+  const float64_t max_bins =
+    static_cast<float64_t>(std::max(min_max_bins, max_bins_per_point * num_finite));
+  float64_t bin_size = m_side_length;
+  float64_t num_x = std::floor((max_x - m_min_x) / bin_size) + 1.0;
+  float64_t num_y = std::floor((max_y - m_min_y) / bin_size) + 1.0;
+  while (num_x * num_y > max_bins) {
+    bin_size *= 2.0;
+    num_x = std::floor((max_x - m_min_x) / bin_size) + 1.0;
+    num_y = std::floor((max_y - m_min_y) / bin_size) + 1.0;
+  }
+  m_inv_bin_size = 1.0 / bin_size;
+  m_num_x = static_cast<Index>(num_x);
+  m_num_y = static_cast<Index>(num_y);
+
+  // counting sort of the finite points by bin
+  const Index num_bins = m_num_x * m_num_y;
+  m_bin_offsets.assign(num_bins + 1U, 0U);
+  m_input_bins.resize(num_points);
+  for (Index i = 0U; i < num_points; ++i) {
+    const float64_t x = m_input_x[i];
+    const float64_t y = m_input_y[i];
+    if (!std::isfinite(x) || !std::isfinite(y)) {
+      m_input_bins[i] = num_bins;
+      continue;
+    }
+    const Index ix =
+      std::min(static_cast<Index>((x - m_min_x) * m_inv_bin_size), m_num_x - 1U);
+    const Index iy =
+      std::min(static_cast<Index>((y - m_min_y) * m_inv_bin_size), m_num_y - 1U);
+    const Index bin = (iy * m_num_x) + ix;
+    m_input_bins[i] = bin;
+    ++m_bin_offsets[bin + 1U];
+  }
+  for (Index bin = 0U; bin < num_bins; ++bin) {
+    m_bin_offsets[bin + 1U] += m_bin_offsets[bin];
+  }
+
+  m_x.resize(num_finite);
+  m_y.resize(num_finite);
+  m_indices.resize(num_finite);
+  m_bin_cursors.assign(m_bin_offsets.begin(), m_bin_offsets.end() - 1);
+  for (Index i = 0U; i < num_points; ++i) {
+    const Index bin = m_input_bins[i];
+    if (bin == num_bins) {
+      continue;
+    }
+    const Index k = m_bin_cursors[bin]++;
+    m_x[k] = m_input_x[i];
+    m_y[k] = m_input_y[i];
+    m_indices[k] = i;
+  }
+}
+////////////////////////////////////////////////////////////////////////////////
+bool8_t FlatSpatialHash2d::get_bin_range(
+  const float64_t min_x, const float64_t min_y, const float64_t max_x, const float64_t max_y,
+  BinRange & range) const
+{
+  if (m_num_x == 0U || !std::isfinite(min_x) || !std::isfinite(min_y) ||
+      !std::isfinite(max_x) || !std::isfinite(max_y)) {
+    return false;
+  }
+  const float64_t x_min = std::floor((min_x - m_min_x) * m_inv_bin_size);
+  const float64_t x_max = std::floor((max_x - m_min_x) * m_inv_bin_size);
+  const float64_t y_min = std::floor((min_y - m_min_y) * m_inv_bin_size);
+  const float64_t y_max = std::floor((max_y - m_min_y) * m_inv_bin_size);
+  const float64_t last_x = static_cast<float64_t>(m_num_x - 1U);
+  const float64_t last_y = static_cast<float64_t>(m_num_y - 1U);
+  if (x_max < 0.0 || y_max < 0.0 || x_min > last_x || y_min > last_y) {
+    return false;
+  }
+  range.x_min = static_cast<Index>(std::max(x_min, 0.0));
+  range.x_max = static_cast<Index>(std::min(x_max, last_x));
+  range.y_min = static_cast<Index>(std::max(y_min, 0.0));
+  range.y_max = static_cast<Index>(std::min(y_max, last_y));
+  return true;
+}
+////////////////////////////////////////////////////////////////////////////////
+}  // namespace spatial_hash
+}  // namespace geometry
+}  // namespace common
+}  // namespace autoware
@@ -0,0 +1,228 @@
+// Copyright 2023 the Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <geometry/flat_spatial_hash.hpp>
+
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using autoware::common::geometry::spatial_hash::FlatSpatialHash2d;
+using autoware::common::geometry::spatial_hash::Index;
+using autoware::common::types::float32_t;
+using autoware::common::types::float64_t;
+
+namespace
+{
+struct TestPoint
+{
+  float32_t x;
+  float32_t y;
+};
+
+std::vector<TestPoint> make_points(const Index num_points, const float32_t range)
+{
+  std::mt19937 engine(0U);
+  std::uniform_real_distribution<float32_t> dist(-range, range);
+  std::vector<TestPoint> points(num_points);
+  for (auto & point : points) {
+    point.x = dist(engine);
+    point.y = dist(engine);
+  }
+  return points;
+}
+
+std::vector<Index> sorted(std::vector<Index> indices)
+{
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+}  // namespace
+
+TEST(FlatSpatialHash2d, BadSideLength)
+{
+  EXPECT_THROW(FlatSpatialHash2d{0.0}, std::domain_error);
+  EXPECT_THROW(FlatSpatialHash2d{-1.0}, std::domain_error);
+}
+
+TEST(FlatSpatialHash2d, Empty)
+{
+  FlatSpatialHash2d hash{1.0};
+  std::vector<Index> indices{0U};
+  hash.radius_search(0.0, 0.0, 10.0, indices);
+  EXPECT_TRUE(indices.empty());
+
+  const std::vector<TestPoint> points{};
+  hash.build(points.begin(), points.end());
+  EXPECT_TRUE(hash.empty());
+  hash.radius_search(0.0, 0.0, 10.0, indices);
+  EXPECT_TRUE(indices.empty());
+}
+
+TEST(FlatSpatialHash2d, RadiusSearchMatchesBruteForce)
+{
+  const auto points = make_points(2000U, 50.0F);
+  FlatSpatialHash2d hash{2.0};
+  hash.build(points.begin(), points.end());
+  ASSERT_EQ(hash.size(), points.size());
+
+  const auto queries = make_points(50U, 60.0F);
+  std::vector<Index> indices;
+  for (const auto radius : {0.5, 2.0, 7.5}) {
+    for (const auto & query : queries) {
+      std::vector<Index> expected;
+      for (Index i = 0U; i < points.size(); ++i) {
+        const float64_t dx = static_cast<float64_t>(points[i].x) - query.x;
+        const float64_t dy = static_cast<float64_t>(points[i].y) - query.y;
+        if (dx * dx + dy * dy < radius * radius) {
+          expected.push_back(i);
+        }
+      }
+      hash.radius_search(query.x, query.y, radius, indices);
+      EXPECT_EQ(sorted(indices), expected);
+    }
+  }
+}
+
+TEST(FlatSpatialHash2d, RadiusBoundaryIsOutside)
+{
+  const std::vector<TestPoint> points{{0.0F, 0.0F}, {1.0F, 0.0F}, {0.0F, 0.5F}};
+  FlatSpatialHash2d hash{1.0};
+  hash.build(points.begin(), points.end());
+  std::vector<Index> indices;
+  hash.radius_search(0.0, 0.0, 1.0, indices);
+  EXPECT_EQ(sorted(indices), (std::vector<Index>{0U, 2U}));
+  hash.radius_search(0.0, 0.0, 0.0, indices);
+  EXPECT_TRUE(indices.empty());
+}
+
+TEST(FlatSpatialHash2d, VisitStops)
+{
+  const auto points = make_points(100U, 1.0F);
+  FlatSpatialHash2d hash{1.0};
+  hash.build(points.begin(), points.end());
+  Index count = 0U;
+  EXPECT_TRUE(hash.visit_within_radius(0.0, 0.0, 10.0, [&count](const Index) {
+    ++count;
+    return true;
+  }));
+  EXPECT_EQ(count, 1U);
+  EXPECT_FALSE(hash.visit_within_radius(100.0, 100.0, 1.0, [](const Index) { return true; }));
+}
+
+TEST(FlatSpatialHash2d, NonFinitePointsAreSkipped)
+{
+  const float32_t nan = std::numeric_limits<float32_t>::quiet_NaN();
+  const float32_t inf = std::numeric_limits<float32_t>::infinity();
+  const std::vector<TestPoint> points{{nan, 0.0F}, {1.0F, 1.0F}, {0.0F, inf}, {2.0F, 2.0F}};
+  FlatSpatialHash2d hash{1.0};
+  hash.build(points.begin(), points.end());
+  EXPECT_EQ(hash.size(), 4U);
+  std::vector<Index> indices;
+  hash.radius_search(0.0, 0.0, 1.0e3, indices);
+  EXPECT_EQ(sorted(indices), (std::vector<Index>{1U, 3U}));
+}
+
+TEST(FlatSpatialHash2d, LargeBoundsWithSmallBins)
+{
+  const std::vector<TestPoint> points{{-1.0e6F, -1.0e6F}, {1.0e6F, 1.0e6F}, {1.0e6F, 1.0e6F}};
+  FlatSpatialHash2d hash{1.0e-3};
+  hash.build(points.begin(), points.end());
+  std::vector<Index> indices;
+  hash.radius_search(1.0e6, 1.0e6, 1.0, indices);
+  EXPECT_EQ(sorted(indices), (std::vector<Index>{1U, 2U}));
+}
+
+TEST(FlatSpatialHash2d, PolygonSearchMatchesBruteForce)
+{
+  const auto points = make_points(2000U, 20.0F);
+  FlatSpatialHash2d hash{1.0};
+  hash.build(points.begin(), points.end());
+
+  // concave polygon, the first vertex is repeated at the end as in a closed ring
+  const std::vector<TestPoint> polygon{{-10.0F, -10.0F}, {10.0F, -10.0F}, {10.0F, 10.0F},
+                                       {0.0F, 0.0F},     {-10.0F, 10.0F}, {-10.0F, -10.0F}};
+  const auto is_inside = [](const TestPoint & pt) {
+    if (pt.x <= -10.0F || pt.x >= 10.0F || pt.y <= -10.0F || pt.y >= 10.0F) {
+      return false;
+    }
+    // below both edges to the concave vertex
+    return pt.y < std::abs(pt.x);
+  };
+  std::vector<Index> expected;
+  for (Index i = 0U; i < points.size(); ++i) {
+    if (is_inside(points[i])) {
+      expected.push_back(i);
+    }
+  }
+  std::vector<Index> indices;
+  hash.polygon_search(polygon, indices);
+  EXPECT_EQ(sorted(indices), expected);
+
+  // the same polygon as an open ring
+  hash.polygon_search(std::vector<TestPoint>(polygon.begin(), polygon.end() - 1), indices);
+  EXPECT_EQ(sorted(indices), expected);
+}
+
+TEST(FlatSpatialHash2d, PolygonBoundaryIsOutside)
+{
+  const std::vector<TestPoint> points{
+    {0.0F, 0.0F}, {1.0F, 0.5F}, {0.5F, 0.5F}, {1.0F, 1.0F}, {0.5F, 0.0F}};
+  FlatSpatialHash2d hash{0.5};
+  hash.build(points.begin(), points.end());
+  const std::vector<TestPoint> square{{0.0F, 0.0F}, {1.0F, 0.0F}, {1.0F, 1.0F}, {0.0F, 1.0F}};
+  std::vector<Index> indices;
+  hash.polygon_search(square, indices);
+  EXPECT_EQ(indices, (std::vector<Index>{2U}));
+}
+
+TEST(FlatSpatialHash2d, PointCloud)
+{
+  const auto points = make_points(500U, 10.0F);
+  sensor_msgs::msg::PointCloud2 cloud;
+  sensor_msgs::PointCloud2Modifier modifier(cloud);
+  modifier.setPointCloud2FieldsByString(1, "xyz");
+  modifier.resize(points.size());
+  sensor_msgs::PointCloud2Iterator<float32_t> iter_x(cloud, "x");
+  sensor_msgs::PointCloud2Iterator<float32_t> iter_y(cloud, "y");
+  sensor_msgs::PointCloud2Iterator<float32_t> iter_z(cloud, "z");
+  for (const auto & point : points) {
+    *iter_x = point.x;
+    *iter_y = point.y;
+    *iter_z = 0.0F;
+    ++iter_x;
+    ++iter_y;
+    ++iter_z;
+  }
+
+  FlatSpatialHash2d cloud_hash{1.0};
+  cloud_hash.build(cloud);
+  FlatSpatialHash2d hash{1.0};
+  hash.build(points.begin(), points.end());
+  ASSERT_EQ(cloud_hash.size(), points.size());
+  std::vector<Index> cloud_indices;
+  std::vector<Index> indices;
+  cloud_hash.radius_search(1.0, -2.0, 4.0, cloud_indices);
+  hash.radius_search(1.0, -2.0, 4.0, indices);
+  EXPECT_FALSE(indices.empty());
+  EXPECT_EQ(sorted(cloud_indices), sorted(indices));
+  EXPECT_EQ(cloud_hash.x(3U), static_cast<float64_t>(points[3U].x));
+}
@@ -165,6 +165,14 @@ AUTOWARE_AUTO_PERCEPTION_RVIZ_PLUGIN_PUBLIC void calc_path_line_list(
   const autoware_auto_perception_msgs::msg::PredictedPath & paths,
   std::vector<geometry_msgs::msg::Point> & points, const bool is_simple = false);
 
+/// \brief Append the lines of a LINE_LIST marker to a batched LINE_LIST marker, so that the lines
+///        of all the objects are drawn by a single marker whose vertex buffer is updated in place
+/// \param marker LINE_LIST marker to be appended. Its points are transformed by its pose, and
+///        colored with its color
+/// \param batched_marker LINE_LIST marker with the identity pose and the color of each point
+AUTOWARE_AUTO_PERCEPTION_RVIZ_PLUGIN_PUBLIC void append_line_list_marker(
+  const visualization_msgs::msg::Marker & marker, visualization_msgs::msg::Marker & batched_marker);
+
 /// \brief Convert Point32 to Point
 /// \param val Point32 to be converted
 /// \return Point type
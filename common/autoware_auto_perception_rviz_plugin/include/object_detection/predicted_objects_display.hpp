@@ -15,6 +15,7 @@
 #define OBJECT_DETECTION__PREDICTED_OBJECTS_DISPLAY_HPP_
 
 #include <object_detection/object_polygon_display_base.hpp>
+#include <rviz_common/properties/bool_property.hpp>
 
 #include <autoware_auto_perception_msgs/msg/predicted_objects.hpp>
 
@@ -108,6 +109,13 @@ private:
   int32_t marker_id = 0;
   const int32_t PATH_ID_CONSTANT = 1e3;
 
+  // Property to draw the shapes and the predicted paths of all the objects by one marker each
+  rviz_common::properties::BoolProperty m_batch_line_markers_property{
+    "Batch Shapes and Paths", false,
+    "Draw the shapes and the predicted paths of all objects as one line list each, which is "
+    "faster with many objects",
+    this};
+
   PredictedObjects::ConstSharedPtr msg;
   bool consumed{false};
   std::mutex mutex;
@@ -636,6 +636,37 @@ void calc_2d_polygon_bottom_line_list(
   }
 }
 
+void append_line_list_marker(const Marker & marker, Marker & batched_marker)
+{
+  const auto & q = marker.pose.orientation;
+  const auto & t = marker.pose.position;
+  // rotation matrix of the normalized quaternion
+  const double xx = q.x * q.x;
+  const double yy = q.y * q.y;
+  const double zz = q.z * q.z;
+  const double xy = q.x * q.y;
+  const double xz = q.x * q.z;
+  const double yz = q.y * q.z;
+  const double wx = q.w * q.x;
+  const double wy = q.w * q.y;
+  const double wz = q.w * q.z;
+  const double norm = xx + yy + zz + q.w * q.w;
+  const double s = norm > 0.0 ? 2.0 / norm : 0.0;
+
+  batched_marker.points.reserve(batched_marker.points.size() + marker.points.size());
+  for (const auto & point : marker.points) {
+    geometry_msgs::msg::Point transformed_point;
+    transformed_point.x = t.x + (1.0 - s * (yy + zz)) * point.x + s * (xy - wz) * point.y +
+                          s * (xz + wy) * point.z;
+    transformed_point.y = t.y + s * (xy + wz) * point.x + (1.0 - s * (xx + zz)) * point.y +
+                          s * (yz - wx) * point.z;
+    transformed_point.z = t.z + s * (xz - wy) * point.x + s * (yz + wx) * point.y +
+                          (1.0 - s * (xx + yy)) * point.z;
+    batched_marker.points.push_back(transformed_point);
+  }
+  batched_marker.colors.resize(batched_marker.points.size(), marker.color);
+}
+
 void calc_path_line_list(
   const autoware_auto_perception_msgs::msg::PredictedPath & paths,
   std::vector<geometry_msgs::msg::Point> & points, const bool is_simple)
@@ -55,13 +55,36 @@ std::vector<visualization_msgs::msg::Marker::SharedPtr> PredictedObjectsDisplay:
 
   std::vector<visualization_msgs::msg::Marker::SharedPtr> markers;
 
+  // With batching, the shape and predicted path markers are appended to one line list each, which
+  // rviz updates in place instead of managing a marker for every object and path.
+  const bool batch_line_markers = m_batch_line_markers_property.getBool();
+  Marker::SharedPtr batched_shape_marker_ptr;
+  Marker::SharedPtr batched_path_marker_ptr;
+  const auto append_to_batch = [&](Marker::SharedPtr & batched_ptr, const Marker & marker) {
+    if (!batched_ptr) {
+      batched_ptr = std::make_shared<Marker>();
+      batched_ptr->header = msg->header;
+      batched_ptr->ns = "batched_" + marker.ns;
+      batched_ptr->id = 0;
+      batched_ptr->type = Marker::LINE_LIST;
+      batched_ptr->action = Marker::MODIFY;
+      batched_ptr->pose = detail::initPose();
+      batched_ptr->scale = marker.scale;
+      batched_ptr->color = marker.color;
+      batched_ptr->lifetime = marker.lifetime;
+    }
+    detail::append_line_list_marker(marker, *batched_ptr);
+  };
+
   for (const auto & object : msg->objects) {
     // Get marker for shape
     auto shape_marker = get_shape_marker_ptr(
       object.shape, object.kinematics.initial_pose_with_covariance.pose.position,
       object.kinematics.initial_pose_with_covariance.pose.orientation, object.classification,
       get_line_width());
-    if (shape_marker) {
+    if (shape_marker && batch_line_markers) {
+      append_to_batch(batched_shape_marker_ptr, *shape_marker.value());
+    } else if (shape_marker) {
       auto shape_marker_ptr = shape_marker.value();
       shape_marker_ptr->header = msg->header;
       shape_marker_ptr->id = uuid_to_marker_id(object.object_id);
@@ -151,7 +174,9 @@ std::vector<visualization_msgs::msg::Marker::SharedPtr> PredictedObjectsDisplay:
       // Get marker for predicted path
       auto predicted_path_marker =
         get_predicted_path_marker_ptr(object.object_id, object.shape, predicted_path);
-      if (predicted_path_marker) {
+      if (predicted_path_marker && batch_line_markers) {
+        append_to_batch(batched_path_marker_ptr, *predicted_path_marker.value());
+      } else if (predicted_path_marker) {
         auto predicted_path_marker_ptr = predicted_path_marker.value();
         predicted_path_marker_ptr->header = msg->header;
         predicted_path_marker_ptr->id =
@@ -180,6 +205,13 @@ std::vector<visualization_msgs::msg::Marker::SharedPtr> PredictedObjectsDisplay:
     }
   }
 
+  if (batched_shape_marker_ptr) {
+    markers.push_back(batched_shape_marker_ptr);
+  }
+  if (batched_path_marker_ptr) {
+    markers.push_back(batched_path_marker_ptr);
+  }
+
   return markers;
 }
 
@@ -0,0 +1,146 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_POINT_TYPES__POINT_CLOUD2_VIEW_HPP_
+#define AUTOWARE_POINT_TYPES__POINT_CLOUD2_VIEW_HPP_
+
+#include "autoware_point_types/types.hpp"
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/msg/point_field.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <type_traits>
+
+namespace autoware_point_types
+{
+struct PointFieldLayout
+{
+  const char * name;
+  uint32_t offset;
+  uint8_t datatype;
+};
+
+/// @brief compile-time description of the PointCloud2 fields of a point type
+template <class PointT>
+struct PointLayoutTraits;
+
+template <>
+struct PointLayoutTraits<PointXYZI>
+{
+  using PointField = sensor_msgs::msg::PointField;
+  static constexpr std::array<PointFieldLayout, 4> fields{{
+    {"x", offsetof(PointXYZI, x), PointField::FLOAT32},
+    {"y", offsetof(PointXYZI, y), PointField::FLOAT32},
+    {"z", offsetof(PointXYZI, z), PointField::FLOAT32},
+    {"intensity", offsetof(PointXYZI, intensity), PointField::FLOAT32},
+  }};
+};
+
+template <>
+struct PointLayoutTraits<PointXYZIRADRT>
+{
+  using PointField = sensor_msgs::msg::PointField;
+  static constexpr std::array<PointFieldLayout, 9> fields{{
+    {"x", offsetof(PointXYZIRADRT, x), PointField::FLOAT32},
+    {"y", offsetof(PointXYZIRADRT, y), PointField::FLOAT32},
+    {"z", offsetof(PointXYZIRADRT, z), PointField::FLOAT32},
+    {"intensity", offsetof(PointXYZIRADRT, intensity), PointField::FLOAT32},
+    {"ring", offsetof(PointXYZIRADRT, ring), PointField::UINT16},
+    {"azimuth", offsetof(PointXYZIRADRT, azimuth), PointField::FLOAT32},
+    {"distance", offsetof(PointXYZIRADRT, distance), PointField::FLOAT32},
+    {"return_type", offsetof(PointXYZIRADRT, return_type), PointField::UINT8},
+    {"time_stamp", offsetof(PointXYZIRADRT, time_stamp), PointField::FLOAT64},
+  }};
+};
+
+/// @brief true if the data of the message is an array of PointT, i.e., it can be viewed in place
+template <class PointT>
+bool hasPointLayout(const sensor_msgs::msg::PointCloud2 & msg)
+{
+  if (
+    msg.is_bigendian || msg.point_step != sizeof(PointT) ||
+    msg.data.size() != static_cast<size_t>(msg.width) * msg.height * msg.point_step ||
+    reinterpret_cast<std::uintptr_t>(msg.data.data()) % alignof(PointT) != 0) {
+    return false;
+  }
+  for (const auto & expected_field : PointLayoutTraits<PointT>::fields) {
+    bool found = false;
+    for (const auto & field : msg.fields) {
+      if (std::strcmp(field.name.c_str(), expected_field.name) == 0) {
+        found = field.offset == expected_field.offset &&
+                field.datatype == expected_field.datatype && field.count == 1;
+        break;
+      }
+    }
+    if (!found) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// @brief zero-copy view of the points of a PointCloud2 whose layout matches PointT
+/// @details PointT can be const-qualified for a read-only view. Use makePointCloud2View() to check
+/// the layout once per message instead of looking up the fields for each point.
+template <class PointT>
+class PointCloud2View
+{
+public:
+  using value_type = PointT;
+  using iterator = PointT *;
+
+  PointCloud2View(PointT * points, const size_t size) : points_(points), size_(size) {}
+
+  iterator begin() const { return points_; }
+  iterator end() const { return points_ + size_; }
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  PointT & operator[](const size_t i) const { return points_[i]; }
+
+private:
+  PointT * points_;
+  size_t size_;
+};
+
+/// @brief read-only view of the points, std::nullopt if the layout does not match PointT
+template <class PointT>
+std::optional<PointCloud2View<const PointT>> makePointCloud2View(
+  const sensor_msgs::msg::PointCloud2 & msg)
+{
+  if (!hasPointLayout<PointT>(msg)) {
+    return std::nullopt;
+  }
+  return PointCloud2View<const PointT>(
+    reinterpret_cast<const PointT *>(msg.data.data()), msg.data.size() / sizeof(PointT));
+}
+
+/// @brief writable view of the points, std::nullopt if the layout does not match PointT
+template <class PointT>
+std::optional<PointCloud2View<PointT>> makePointCloud2View(sensor_msgs::msg::PointCloud2 & msg)
+{
+  static_assert(!std::is_const_v<PointT>, "use the const overload for read-only views");
+  if (!hasPointLayout<PointT>(msg)) {
+    return std::nullopt;
+  }
+  return PointCloud2View<PointT>(
+    reinterpret_cast<PointT *>(msg.data.data()), msg.data.size() / sizeof(PointT));
+}
+}  // namespace autoware_point_types
+
+#endif  // AUTOWARE_POINT_TYPES__POINT_CLOUD2_VIEW_HPP_
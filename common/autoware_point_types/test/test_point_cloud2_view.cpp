@@ -0,0 +1,75 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_point_types/point_cloud2_view.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(PointCloud2View, PointXYZIRADRT)
+{
+  using autoware_point_types::makePointCloud2View;
+  using autoware_point_types::PointXYZI;
+  using autoware_point_types::PointXYZIRADRT;
+  using autoware_point_types::PointXYZIRADRTGenerator;
+
+  sensor_msgs::msg::PointCloud2 msg;
+  {
+    point_cloud_msg_wrapper::PointCloud2Modifier<PointXYZIRADRT, PointXYZIRADRTGenerator> modifier{
+      msg, "frame"};
+    modifier.push_back(PointXYZIRADRT{0, 1, 2, 3, 4, 5, 6, 7, 8});
+    modifier.push_back(PointXYZIRADRT{9, 10, 11, 12, 13, 14, 15, 16, 17});
+  }
+
+  const auto & const_msg = msg;
+  const auto view = makePointCloud2View<PointXYZIRADRT>(const_msg);
+  ASSERT_TRUE(view.has_value());
+  ASSERT_EQ(view->size(), 2lu);
+  EXPECT_EQ((*view)[0], (PointXYZIRADRT{0, 1, 2, 3, 4, 5, 6, 7, 8}));
+  EXPECT_EQ((*view)[1], (PointXYZIRADRT{9, 10, 11, 12, 13, 14, 15, 16, 17}));
+
+  // writable views modify the message in place
+  auto mutable_view = makePointCloud2View<PointXYZIRADRT>(msg);
+  ASSERT_TRUE(mutable_view.has_value());
+  for (auto & point : *mutable_view) point.ring = 42;
+  EXPECT_EQ((*view)[0].ring, 42);
+  EXPECT_EQ((*view)[1].ring, 42);
+
+  // other layouts do not match
+  EXPECT_FALSE(makePointCloud2View<PointXYZI>(const_msg).has_value());
+}
+
+TEST(PointCloud2View, LayoutMismatch)
+{
+  using autoware_point_types::hasPointLayout;
+  using autoware_point_types::PointXYZI;
+
+  sensor_msgs::msg::PointCloud2 msg;
+  {
+    point_cloud_msg_wrapper::PointCloud2Modifier<PointXYZI> modifier{msg, "frame"};
+    modifier.push_back(PointXYZI{0, 1, 2, 3});
+  }
+  EXPECT_TRUE(hasPointLayout<PointXYZI>(msg));
+
+  auto wrong_type = msg;
+  wrong_type.fields.back().datatype = sensor_msgs::msg::PointField::FLOAT64;
+  EXPECT_FALSE(hasPointLayout<PointXYZI>(wrong_type));
+
+  auto missing_field = msg;
+  missing_field.fields.pop_back();
+  EXPECT_FALSE(hasPointLayout<PointXYZI>(missing_field));
+
+  auto wrong_size = msg;
+  wrong_size.data.pop_back();
+  EXPECT_FALSE(hasPointLayout<PointXYZI>(wrong_size));
+}
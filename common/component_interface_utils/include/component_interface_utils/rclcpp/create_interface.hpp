@@ -49,14 +49,27 @@ typename Service<SpecT>::SharedPtr create_service_impl(
   return Service<SpecT>::make_shared(interface, std::forward<CallbackT>(callback), group);
 }
 
+/// Get the options to use inter-process communication for the durable topics. This is a private
+/// implementation. The intra-process communication of rclcpp supports only volatile topics, so the
+/// durable topics of the nodes in a container with intra-process communication enabled fall back.
+template <class SpecT, class OptionsT>
+OptionsT get_intra_process_options()
+{
+  OptionsT options;
+  if (SpecT::durability != RMW_QOS_POLICY_DURABILITY_VOLATILE) {
+    options.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  }
+  return options;
+}
+
 /// Create a publisher using traits like services. This is a private implementation.
 template <class SpecT, class NodeT>
 typename Publisher<SpecT>::SharedPtr create_publisher_impl(NodeT * node)
 {
   // This function is a wrapper for the following.
   // https://github.com/ros2/rclcpp/blob/48068130edbb43cdd61076dc1851672ff1a80408/rclcpp/include/rclcpp/node.hpp#L167-L205
-  auto publisher =
-    node->template create_publisher<typename SpecT::Message>(SpecT::name, get_qos<SpecT>());
+  auto publisher = node->template create_publisher<typename SpecT::Message>(
+    SpecT::name, get_qos<SpecT>(), get_intra_process_options<SpecT, rclcpp::PublisherOptions>());
   return Publisher<SpecT>::make_shared(publisher);
 }
 
@@ -68,7 +81,8 @@ typename Subscription<SpecT>::SharedPtr create_subscription_impl(
   // This function is a wrapper for the following.
   // https://github.com/ros2/rclcpp/blob/48068130edbb43cdd61076dc1851672ff1a80408/rclcpp/include/rclcpp/node.hpp#L207-L238
   auto subscription = node->template create_subscription<typename SpecT::Message>(
-    SpecT::name, get_qos<SpecT>(), std::forward<CallbackT>(callback));
+    SpecT::name, get_qos<SpecT>(), std::forward<CallbackT>(callback),
+    get_intra_process_options<SpecT, rclcpp::SubscriptionOptions>());
   return Subscription<SpecT>::make_shared(subscription);
 }
 
@@ -42,6 +42,14 @@ struct Edge
   }
 };
 
+/// @brief Consecutive cells of a row of the grid map, as indexes of the underlying matrix
+struct IndexSpan
+{
+  int row;        ///< row index of the cells
+  int col_begin;  ///< column index of the first cell
+  int col_end;    ///< column index past the last cell
+};
+
 /** @brief A polygon iterator for grid_map::GridMap based on the scan line algorithm.
     @details This iterator allows to iterate over all cells whose center is inside a polygon. \
              This reproduces the behavior of the original grid_map::PolygonIterator which uses\
@@ -72,6 +80,17 @@ public:
   /// @return true if iterator is out of scope, false if end has not been reached.
   [[nodiscard]] bool isPastEnd() const;
 
+  /// @brief Calculate the cells inside the polygon as spans of consecutive columns.
+  /// @details The spans contain the same cells in the same order as the ones visited by the
+  /// iterator. A span is split where its columns wrap around the circular buffer of the grid map
+  /// so that it can be accessed as a block of the matrix, e.g.,
+  /// `matrix.row(span.row).segment(span.col_begin, span.col_end - span.col_begin)`.
+  /// @param grid_map the grid map to iterate on.
+  /// @param polygon the polygonal area to iterate on.
+  /// @return the spans ordered by row then by column.
+  static std::vector<IndexSpan> calculateSpans(
+    const grid_map::GridMap & grid_map, const grid_map::Polygon & polygon);
+
 private:
   /** @brief Calculate sorted edges of the given polygon.
       @details Vertices in an edge are ordered from higher to lower x.
@@ -101,6 +120,14 @@ private:
     const std::vector<Edge> & edges, const grid_map::Position & origin,
     const grid_map::GridMap & grid_map);
 
+  /// @brief Calculates intersections between the rows of the grid map and the polygon.
+  /// @param grid_map grid map.
+  /// @param polygon the polygonal area.
+  /// @param row_of_first_line row of the first line, without any shift of the grid map.
+  /// @return for each row from row_of_first_line the vector of y values with an intersection.
+  static std::vector<std::vector<double>> calculateScanLines(
+    const grid_map::GridMap & grid_map, const grid_map::Polygon & polygon, int & row_of_first_line);
+
   // Helper functions
   /// @brief Increment the current_line_ to the line with intersections
   void goToNextLine();
@@ -108,32 +108,79 @@ std::pair<int, int> PolygonIterator::calculateRowRange(
   return {min_row, max_row};
 }
 
-PolygonIterator::PolygonIterator(
-  const grid_map::GridMap & grid_map, const grid_map::Polygon & polygon)
+std::vector<std::vector<double>> PolygonIterator::calculateScanLines(
+  const grid_map::GridMap & grid_map, const grid_map::Polygon & polygon, int & row_of_first_line)
 {
+  row_of_first_line = 0;
   auto poly = polygon;
-  if (poly.nVertices() < 3) return;
+  if (poly.nVertices() < 3) return {};
   // repeat the first vertex to get the last edge [last vertex, first vertex]
   if (poly.getVertex(0) != poly.getVertex(poly.nVertices() - 1)) poly.addVertex(poly.getVertex(0));
 
-  map_start_idx_ = grid_map.getStartIndex();
-  map_resolution_ = grid_map.getResolution();
-  map_size_ = grid_map.getSize();
-  const auto origin = [&]() {
-    grid_map::Position origin;
-    grid_map.getPosition(map_start_idx_, origin);
-    return origin;
-  }();
-  map_origin_y_ = origin.y();
+  grid_map::Position origin;
+  grid_map.getPosition(grid_map.getStartIndex(), origin);
 
   // We make line scan left -> right / up -> down *in the index frame* (idx[0,0] is pos[up, left]).
   // In the position frame, this corresponds to high -> low Y values and high -> low X values.
   const std::vector<Edge> edges = calculateSortedEdges(poly);
-  if (edges.empty()) return;
+  if (edges.empty()) return {};
   const auto from_to_row = calculateRowRange(edges, origin, grid_map);
-  intersections_per_line_ = calculateIntersectionsPerLine(edges, from_to_row, origin, grid_map);
+  row_of_first_line = from_to_row.first;
+  return calculateIntersectionsPerLine(edges, from_to_row, origin, grid_map);
+}
+
+std::vector<IndexSpan> PolygonIterator::calculateSpans(
+  const grid_map::GridMap & grid_map, const grid_map::Polygon & polygon)
+{
+  int row_of_first_line{};
+  const auto intersections_per_line = calculateScanLines(grid_map, polygon, row_of_first_line);
+
+  const auto & start_idx = grid_map.getStartIndex();
+  const auto & size = grid_map.getSize();
+  const auto resolution = grid_map.getResolution();
+  grid_map::Position origin;
+  grid_map.getPosition(start_idx, origin);
+
+  std::vector<IndexSpan> spans;
+  spans.reserve(intersections_per_line.size());
+  for (size_t line = 0; line < intersections_per_line.size(); ++line) {
+    const auto & y_intersections = intersections_per_line[line];
+    int row = start_idx(0) + row_of_first_line + static_cast<int>(line);
+    grid_map::wrapIndexToRange(row, size(0));
+    for (size_t i = 0; i + 1 < y_intersections.size(); i += 2) {
+      // same columns as calculateColumnIndexes()
+      const auto from_col = std::clamp(
+        static_cast<int>((origin.y() - y_intersections[i] + resolution) / resolution), 0,
+        size(1) - 1);
+      const auto to_col = std::clamp(
+        static_cast<int>((origin.y() - y_intersections[i + 1]) / resolution), 0, size(1) - 1);
+      if (to_col < from_col) continue;
+
+      int col_begin = start_idx(1) + from_col;
+      grid_map::wrapIndexToRange(col_begin, size(1));
+      const auto length = to_col - from_col + 1;
+      const auto length_before_wrap = std::min(length, size(1) - col_begin);
+      spans.push_back({row, col_begin, col_begin + length_before_wrap});
+      if (length_before_wrap < length) {
+        spans.push_back({row, 0, length - length_before_wrap});
+      }
+    }
+  }
+  return spans;
+}
+
+PolygonIterator::PolygonIterator(
+  const grid_map::GridMap & grid_map, const grid_map::Polygon & polygon)
+{
+  map_start_idx_ = grid_map.getStartIndex();
+  map_resolution_ = grid_map.getResolution();
+  map_size_ = grid_map.getSize();
+  grid_map::Position origin;
+  grid_map.getPosition(map_start_idx_, origin);
+  map_origin_y_ = origin.y();
+
+  intersections_per_line_ = calculateScanLines(grid_map, polygon, row_of_first_line_);
 
-  row_of_first_line_ = from_to_row.first;
   current_col_ = 0;
   current_to_col_ = -1;
   current_line_ = -1;  // goToNextLine() increments the line so assign -1 to start from 0
@@ -45,7 +45,8 @@ int main(int argc, char * argv[])
   result_file.open("benchmark_results.csv");
   result_file
     << "#Size PolygonVertices PolygonIndexes grid_map_utils_constructor grid_map_utils_iteration "
-       "grid_map_constructor grid_map_iteration\n";
+       "grid_map_constructor grid_map_iteration grid_map_utils_fill_iterator "
+       "grid_map_utils_fill_spans\n";
   tier4_autoware_utils::StopWatch<std::chrono::milliseconds> stopwatch;
 
   constexpr auto nb_iterations = 10;
@@ -98,6 +99,8 @@ int main(int argc, char * argv[])
       double grid_map_constructor_duration{};
       double grid_map_utils_iteration_duration{};
       double grid_map_iteration_duration{};
+      double grid_map_utils_fill_iterator_duration{};
+      double grid_map_utils_fill_spans_duration{};
 
       for (auto iteration = 0; iteration < nb_iterations; ++iteration) {
         map.setGeometry(grid_map::Length(10.0, 10.0), resolution, grid_map::Position(0.0, 0.0));
@@ -169,13 +172,34 @@ int main(int argc, char * argv[])
           cv::waitKey(0);
           cv::destroyAllWindows();
         }
+
+        // Fill the polygon cell by cell and row span by row span
+        auto & layer = map["layer"];
+        stopwatch.tic("gmu_fill_iterator");
+        for (grid_map_utils::PolygonIterator iterator(map, polygon); !iterator.isPastEnd();
+             ++iterator)
+          layer((*iterator)(0), (*iterator)(1)) = 1.0;
+        grid_map_utils_fill_iterator_duration += stopwatch.toc("gmu_fill_iterator");
+        stopwatch.tic("gmu_fill_spans");
+        for (const auto & span : grid_map_utils::PolygonIterator::calculateSpans(map, polygon))
+          layer.row(span.row)
+            .segment(span.col_begin, span.col_end - span.col_begin)
+            .setConstant(2.0);
+        grid_map_utils_fill_spans_duration += stopwatch.toc("gmu_fill_spans");
+        if (std::any_of(layer.data(), layer.data() + layer.size(), [](const auto v) {
+              return v == 1.0;
+            })) {
+          std::cerr << "\t\tspans do not cover the cells of the iterator" << std::endl;
+        }
       }
       // print results to file
       result_file << grid_map_size << " " << vertices << " " << polygon_indexes / nb_iterations
                   << " " << grid_map_utils_constructor_duration / nb_iterations << " "
                   << grid_map_utils_iteration_duration / nb_iterations << " "
                   << grid_map_constructor_duration / nb_iterations << " "
-                  << grid_map_iteration_duration / nb_iterations << "\n";
+                  << grid_map_iteration_duration / nb_iterations << " "
+                  << grid_map_utils_fill_iterator_duration / nb_iterations << " "
+                  << grid_map_utils_fill_spans_duration / nb_iterations << "\n";
     }
   }
   result_file.close();
@@ -278,3 +278,47 @@ TEST(PolygonIterator, SelfCrossingPolygon)
   }
   EXPECT_FALSE(diff);
 }
+
+TEST(PolygonIterator, Spans)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(8.0, 5.0), 1.0, Position(0.0, 0.0));  // bufferSize(8, 5)
+  // move in both directions so that the spans wrap around the circular buffer
+  map.move(Position(2.0, 2.0));
+
+  std::vector<Polygon> polygons(3);
+  polygons[0].addVertex(Position(6.1, 4.6));
+  polygons[0].addVertex(Position(0.9, 4.6));
+  polygons[0].addVertex(Position(0.9, -1.6));
+  polygons[0].addVertex(Position(6.1, -1.6));
+  // Hour-glass shape
+  polygons[1].addVertex(Position(4.5, 4.9));
+  polygons[1].addVertex(Position(4.5, -0.9));
+  polygons[1].addVertex(Position(-0.5, 4.5));
+  polygons[1].addVertex(Position(-0.5, -0.5));
+  // Outside
+  polygons[2].addVertex(Position(99.0, 101.0));
+  polygons[2].addVertex(Position(101.0, 101.0));
+  polygons[2].addVertex(Position(101.0, 99.0));
+
+  for (const auto & polygon : polygons) {
+    std::vector<Index> span_indexes;
+    for (const auto & span : grid_map_utils::PolygonIterator::calculateSpans(map, polygon)) {
+      EXPECT_LT(span.col_begin, span.col_end);
+      EXPECT_LE(span.col_end, map.getSize()(1));
+      for (auto col = span.col_begin; col < span.col_end; ++col) {
+        span_indexes.emplace_back(span.row, col);
+      }
+    }
+
+    size_t i = 0;
+    for (grid_map_utils::PolygonIterator iterator(map, polygon); !iterator.isPastEnd();
+         ++iterator) {
+      ASSERT_LT(i, span_indexes.size());
+      EXPECT_EQ((*iterator)(0), span_indexes[i](0));
+      EXPECT_EQ((*iterator)(1), span_indexes[i](1));
+      ++i;
+    }
+    EXPECT_EQ(i, span_indexes.size());
+  }
+}
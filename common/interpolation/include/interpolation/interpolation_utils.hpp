@@ -52,7 +52,9 @@ inline bool isNotDecreasing(const std::vector<double> & x)
   return true;
 }
 
-inline std::vector<double> validateKeys(
+// NOTE: This function does not crop query keys unlike validateKeys(), so that the query keys are
+//       not copied. The front and back of query keys have to be cropped by the caller.
+inline void validateKeysWithoutCrop(
   const std::vector<double> & base_keys, const std::vector<double> & query_keys)
 {
   // when vectors are empty
@@ -78,6 +80,12 @@ inline std::vector<double> validateKeys(
     base_keys.back() + epsilon < query_keys.back()) {
     throw std::invalid_argument("query_keys is out of base_keys");
   }
+}
+
+inline std::vector<double> validateKeys(
+  const std::vector<double> & base_keys, const std::vector<double> & query_keys)
+{
+  validateKeysWithoutCrop(base_keys, query_keys);
 
   // NOTE: Due to calculation error of double, a query key may be slightly out of base keys.
   //       Therefore, query keys are cropped here.
@@ -88,6 +96,23 @@ inline std::vector<double> validateKeys(
   return validated_query_keys;
 }
 
+// validate a single query key, and crop it into base keys
+// NOTE: base_keys is assumed to be sorted since this function is called for each query key.
+inline double validateKey(const std::vector<double> & base_keys, const double query_key)
+{
+  if (base_keys.size() < 2) {
+    throw std::invalid_argument(
+      "The size of points is less than 2. base_keys.size() = " + std::to_string(base_keys.size()));
+  }
+
+  constexpr double epsilon = 1e-3;
+  if (query_key < base_keys.front() - epsilon || base_keys.back() + epsilon < query_key) {
+    throw std::invalid_argument("query_key is out of base_keys");
+  }
+
+  return std::clamp(query_key, base_keys.front(), base_keys.back());
+}
+
 template <class T>
 void validateKeysAndValues(
   const std::vector<double> & base_keys, const std::vector<T> & base_values)
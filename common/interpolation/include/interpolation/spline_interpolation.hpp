@@ -66,6 +66,17 @@ std::vector<double> splineByAkima(
 // const auto interpolation_result2 = spline.getSplineInterpolatedValues(
 //   base_keys, query_keys2);
 // ```
+//
+// The same instance can be reused for repeated interpolation without heap allocation, as long as
+// the number of base keys and query keys does not exceed the previous ones.
+// ```
+// SplineInterpolation spline;
+// std::vector<double> interpolation_result;
+// for (...) {
+//   spline.calcSplineCoefficients(base_keys, base_values);
+//   spline.getSplineInterpolatedValues(query_keys, interpolation_result);
+// }
+// ```
 class SplineInterpolation
 {
 public:
@@ -76,17 +87,33 @@ public:
     calcSplineCoefficients(base_keys, base_values);
   }
 
+  //!< @brief calculate spline coefficients, reusing the memory of the previous coefficients
+  void calcSplineCoefficients(
+    const std::vector<double> & base_keys, const std::vector<double> & base_values);
+
+  //!< @brief append base keys and values after the current ones, and update spline coefficients
+  //!< @details The forward elimination of the tridiagonal matrix algorithm is done only for the
+  //            appended rows since the rows of the current base points are not changed.
+  //            The back substitution and the coefficients are updated for all the base points
+  //            because the natural spline is not local, which is O(N) without heap allocation.
+  void appendBasePoints(
+    const std::vector<double> & base_keys, const std::vector<double> & base_values);
+
   //!< @brief get values of spline interpolation on designated sampling points.
   //!< @details Assuming that query_keys are t vector for sampling, and interpolation is for x,
   //            meaning that spline interpolation was applied to x(t),
   //            return value will be x(t) vector
   std::vector<double> getSplineInterpolatedValues(const std::vector<double> & query_keys) const;
+  void getSplineInterpolatedValues(
+    const std::vector<double> & query_keys, std::vector<double> & res) const;
 
   //!< @brief get 1st differential values of spline interpolation on designated sampling points.
   //!< @details Assuming that query_keys are t vector for sampling, and interpolation is for x,
   //            meaning that spline interpolation was applied to x(t),
   //            return value will be dx/dt(t) vector
   std::vector<double> getSplineInterpolatedDiffValues(const std::vector<double> & query_keys) const;
+  void getSplineInterpolatedDiffValues(
+    const std::vector<double> & query_keys, std::vector<double> & res) const;
 
   //!< @brief get 2nd differential values of spline interpolation on designated sampling points.
   //!< @details Assuming that query_keys are t vector for sampling, and interpolation is for x,
@@ -94,15 +121,36 @@ public:
   //            return value will be d^2/dt^2(t) vector
   std::vector<double> getSplineInterpolatedQuadDiffValues(
     const std::vector<double> & query_keys) const;
+  void getSplineInterpolatedQuadDiffValues(
+    const std::vector<double> & query_keys, std::vector<double> & res) const;
+
+  //!< @brief get values, 1st and 2nd differential values at a single sampling point
+  //!< @details The spline segment is found by binary search.
+  double getSplineInterpolatedValue(const double query_key) const;
+  double getSplineInterpolatedDiffValue(const double query_key) const;
+  double getSplineInterpolatedQuadDiffValue(const double query_key) const;
 
   size_t getSize() const { return base_keys_.size(); }
 
 private:
   std::vector<double> base_keys_;
+  std::vector<double> base_values_;
   interpolation::MultiSplineCoef multi_spline_coef_;
 
-  void calcSplineCoefficients(
-    const std::vector<double> & base_keys, const std::vector<double> & base_values);
+  // workspace of tridiagonal matrix algorithm, which is kept for appendBasePoints()
+  std::vector<double> tdma_p_;
+  std::vector<double> tdma_q_;
+  std::vector<double> second_diff_values_;
+
+  // solve tridiagonal matrix algorithm with forward elimination from start_row
+  void updateSplineCoefficients(const size_t start_row);
+
+  size_t getSegmentIndex(const double validated_query_key) const;
+
+  template <class EvalFunc>
+  void evaluate(
+    const std::vector<double> & query_keys, std::vector<double> & res,
+    const EvalFunc & eval_func) const;
 };
 
 #endif  // INTERPOLATION__SPLINE_INTERPOLATION_HPP_
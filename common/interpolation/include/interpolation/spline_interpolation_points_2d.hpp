@@ -50,8 +50,16 @@ public:
   SplineInterpolationPoints2d() = default;
   template <typename T>
   explicit SplineInterpolationPoints2d(const std::vector<T> & points)
+  {
+    calcSplineCoefficients(points);
+  }
+
+  // calculate spline coefficients again, reusing the memory of the previous coefficients
+  template <typename T>
+  void calcSplineCoefficients(const std::vector<T> & points)
   {
     std::vector<geometry_msgs::msg::Point> points_inner;
+    points_inner.reserve(points.size());
     for (const auto & p : points) {
       points_inner.push_back(tier4_autoware_utils::getPoint(p));
     }
@@ -14,71 +14,10 @@
 
 #include "interpolation/spline_interpolation.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <vector>
 
-namespace
-{
-// solve Ax = d
-// where A is tridiagonal matrix
-//     [b_0 c_0 ...                       ]
-//     [a_0 b_1 c_1 ...               O   ]
-// A = [            ...                   ]
-//     [   O         ... a_N-3 b_N-2 c_N-2]
-//     [                   ... a_N-2 b_N-1]
-struct TDMACoef
-{
-  explicit TDMACoef(const size_t num_row)
-  {
-    a.resize(num_row - 1);
-    b.resize(num_row);
-    c.resize(num_row - 1);
-    d.resize(num_row);
-  }
-
-  std::vector<double> a;
-  std::vector<double> b;
-  std::vector<double> c;
-  std::vector<double> d;
-};
-
-inline std::vector<double> solveTridiagonalMatrixAlgorithm(const TDMACoef & tdma_coef)
-{
-  const auto & a = tdma_coef.a;
-  const auto & b = tdma_coef.b;
-  const auto & c = tdma_coef.c;
-  const auto & d = tdma_coef.d;
-
-  const size_t num_row = b.size();
-
-  std::vector<double> x(num_row);
-  if (num_row != 1) {
-    // calculate p and q
-    std::vector<double> p;
-    std::vector<double> q;
-    p.push_back(-c[0] / b[0]);
-    q.push_back(d[0] / b[0]);
-
-    for (size_t i = 1; i < num_row; ++i) {
-      const double den = b[i] + a[i - 1] * p[i - 1];
-      p.push_back(-c[i - 1] / den);
-      q.push_back((d[i] - a[i - 1] * q[i - 1]) / den);
-    }
-
-    // calculate solution
-    x[num_row - 1] = q[num_row - 1];
-
-    for (size_t i = 1; i < num_row; ++i) {
-      const size_t j = num_row - 1 - i;
-      x[j] = p[j] * x[j + 1] + q[j];
-    }
-  } else {
-    x[0] = (d[0] / b[0]);
-  }
-
-  return x;
-}
-}  // namespace
-
 namespace interpolation
 {
 std::vector<double> spline(
@@ -172,118 +111,229 @@ void SplineInterpolation::calcSplineCoefficients(
   // throw exceptions for invalid arguments
   interpolation_utils::validateKeysAndValues(base_keys, base_values);
 
-  const size_t num_base = base_keys.size();  // N+1
+  base_keys_ = base_keys;
+  base_values_ = base_values;
+
+  updateSplineCoefficients(0);
+}
 
-  std::vector<double> diff_keys;    // N
-  std::vector<double> diff_values;  // N
-  for (size_t i = 0; i < num_base - 1; ++i) {
-    diff_keys.push_back(base_keys.at(i + 1) - base_keys.at(i));
-    diff_values.push_back(base_values.at(i + 1) - base_values.at(i));
+void SplineInterpolation::appendBasePoints(
+  const std::vector<double> & base_keys, const std::vector<double> & base_values)
+{
+  if (base_keys_.empty()) {
+    calcSplineCoefficients(base_keys, base_values);
+    return;
   }
 
-  std::vector<double> v = {0.0};
-  if (num_base > 2) {
-    // solve tridiagonal matrix algorithm
-    TDMACoef tdma_coef(num_base - 2);  // N-1
+  // throw exceptions for invalid arguments
+  if (base_keys.empty() || base_values.empty()) {
+    throw std::invalid_argument("Points is empty.");
+  }
+  if (base_keys.size() != base_values.size()) {
+    throw std::invalid_argument("The size of base_keys and base_values are not the same.");
+  }
+  if (base_keys.front() <= base_keys_.back() || !interpolation_utils::isIncreasing(base_keys)) {
+    throw std::invalid_argument("base_keys is not sorted after the current base_keys.");
+  }
+
+  // NOTE: The rows of the tridiagonal matrix are for the base points except for the front and
+  //       back. The forward elimination starts from the last current row, whose c is changed.
+  const size_t start_row = base_keys_.size() < 3 ? 0 : base_keys_.size() - 3;
 
-    for (size_t i = 0; i < num_base - 2; ++i) {
-      tdma_coef.b[i] = 2 * (diff_keys[i] + diff_keys[i + 1]);
-      if (i != num_base - 3) {
-        tdma_coef.a[i] = diff_keys[i + 1];
-        tdma_coef.c[i] = diff_keys[i + 1];
+  base_keys_.insert(base_keys_.end(), base_keys.begin(), base_keys.end());
+  base_values_.insert(base_values_.end(), base_values.begin(), base_values.end());
+
+  updateSplineCoefficients(start_row);
+}
+
+// solve Av = w (v_0 = v_N = 0) with tridiagonal matrix algorithm
+// where A is tridiagonal matrix
+//     [b_0 c_0 ...                       ]
+//     [a_0 b_1 c_1 ...               O   ]
+// A = [            ...                   ]
+//     [   O         ... a_N-4 b_N-3 c_N-3]
+//     [                   ... a_N-3 b_N-2]
+// with a_i = c_i = h_i+1, b_i = 2 (h_i + h_i+1), and the elements are calculated in place.
+void SplineInterpolation::updateSplineCoefficients(const size_t start_row)
+{
+  const auto & x = base_keys_;
+  const auto & y = base_values_;
+  const size_t num_base = x.size();  // N+1
+  const size_t num_row = num_base - 2;  // N-1
+
+  const auto h = [&](const size_t i) { return x[i + 1] - x[i]; };
+  const auto w = [&](const size_t i) {
+    return 6.0 * ((y[i + 2] - y[i + 1]) / h(i + 1) - (y[i + 1] - y[i]) / h(i));
+  };
+
+  auto & v = second_diff_values_;
+  v.resize(num_base);
+  v.front() = 0.0;
+  v.back() = 0.0;
+  if (num_row != 0) {
+    // forward elimination
+    auto & p = tdma_p_;
+    auto & q = tdma_q_;
+    p.resize(num_row);
+    q.resize(num_row);
+    for (size_t i = start_row; i < num_row; ++i) {
+      const double b = 2.0 * (h(i) + h(i + 1));
+      if (i == 0) {
+        p[0] = -h(1) / b;
+        q[0] = w(0) / b;
+        continue;
       }
-      tdma_coef.d[i] =
-        6.0 * (diff_values[i + 1] / diff_keys[i + 1] - diff_values[i] / diff_keys[i]);
+      const double den = b + h(i) * p[i - 1];
+      p[i] = -h(i) / den;
+      q[i] = (w(i) - h(i) * q[i - 1]) / den;
     }
 
-    const std::vector<double> tdma_res = solveTridiagonalMatrixAlgorithm(tdma_coef);
-
-    // calculate v
-    v.insert(v.end(), tdma_res.begin(), tdma_res.end());
+    // back substitution
+    v[num_row] = q[num_row - 1];
+    for (size_t i = 1; i < num_row; ++i) {
+      const size_t j = num_row - 1 - i;
+      v[j + 1] = p[j] * v[j + 2] + q[j];
+    }
   }
-  v.push_back(0.0);
 
   // calculate a, b, c, d of spline coefficients
-  multi_spline_coef_ = interpolation::MultiSplineCoef{num_base - 1};  // N
+  auto & coef = multi_spline_coef_;
+  coef.a.resize(num_base - 1);  // N
+  coef.b.resize(num_base - 1);
+  coef.c.resize(num_base - 1);
+  coef.d.resize(num_base - 1);
   for (size_t i = 0; i < num_base - 1; ++i) {
-    multi_spline_coef_.a[i] = (v[i + 1] - v[i]) / 6.0 / diff_keys[i];
-    multi_spline_coef_.b[i] = v[i] / 2.0;
-    multi_spline_coef_.c[i] =
-      diff_values[i] / diff_keys[i] - diff_keys[i] * (2 * v[i] + v[i + 1]) / 6.0;
-    multi_spline_coef_.d[i] = base_values[i];
+    coef.a[i] = (v[i + 1] - v[i]) / 6.0 / h(i);
+    coef.b[i] = v[i] / 2.0;
+    coef.c[i] = (y[i + 1] - y[i]) / h(i) - h(i) * (2 * v[i] + v[i + 1]) / 6.0;
+    coef.d[i] = y[i];
   }
+}
 
-  base_keys_ = base_keys;
+size_t SplineInterpolation::getSegmentIndex(const double validated_query_key) const
+{
+  // the first segment whose back key is not less than the query key, as in evaluate()
+  const auto itr =
+    std::lower_bound(std::next(base_keys_.begin()), base_keys_.end(), validated_query_key);
+  return std::min(
+    static_cast<size_t>(std::distance(base_keys_.begin(), itr)) - 1, base_keys_.size() - 2);
 }
 
-std::vector<double> SplineInterpolation::getSplineInterpolatedValues(
-  const std::vector<double> & query_keys) const
+template <class EvalFunc>
+void SplineInterpolation::evaluate(
+  const std::vector<double> & query_keys, std::vector<double> & res,
+  const EvalFunc & eval_func) const
 {
   // throw exceptions for invalid arguments
-  const auto validated_query_keys = interpolation_utils::validateKeys(base_keys_, query_keys);
-
-  const auto & a = multi_spline_coef_.a;
-  const auto & b = multi_spline_coef_.b;
-  const auto & c = multi_spline_coef_.c;
-  const auto & d = multi_spline_coef_.d;
+  interpolation_utils::validateKeysWithoutCrop(base_keys_, query_keys);
 
-  std::vector<double> res;
+  res.resize(query_keys.size());
   size_t j = 0;
-  for (const auto & query_key : validated_query_keys) {
+  for (size_t i = 0; i < query_keys.size(); ++i) {
+    // NOTE: Due to calculation error of double, a query key may be slightly out of base keys.
+    //       Therefore, the front and back of query keys are cropped here.
+    double query_key = query_keys[i];
+    if (i == 0) {
+      query_key = std::max(query_key, base_keys_.front());
+    }
+    if (i == query_keys.size() - 1) {
+      query_key = std::min(query_key, base_keys_.back());
+    }
+
     while (base_keys_.at(j + 1) < query_key) {
       ++j;
     }
 
-    const double ds = query_key - base_keys_.at(j);
-    res.push_back(d.at(j) + (c.at(j) + (b.at(j) + a.at(j) * ds) * ds) * ds);
+    res[i] = eval_func(j, query_key - base_keys_.at(j));
   }
-
-  return res;
 }
 
-std::vector<double> SplineInterpolation::getSplineInterpolatedDiffValues(
+std::vector<double> SplineInterpolation::getSplineInterpolatedValues(
   const std::vector<double> & query_keys) const
 {
-  // throw exceptions for invalid arguments
-  const auto validated_query_keys = interpolation_utils::validateKeys(base_keys_, query_keys);
+  std::vector<double> res;
+  getSplineInterpolatedValues(query_keys, res);
+  return res;
+}
 
+void SplineInterpolation::getSplineInterpolatedValues(
+  const std::vector<double> & query_keys, std::vector<double> & res) const
+{
   const auto & a = multi_spline_coef_.a;
   const auto & b = multi_spline_coef_.b;
   const auto & c = multi_spline_coef_.c;
+  const auto & d = multi_spline_coef_.d;
 
+  evaluate(query_keys, res, [&](const size_t j, const double ds) {
+    return d[j] + (c[j] + (b[j] + a[j] * ds) * ds) * ds;
+  });
+}
+
+std::vector<double> SplineInterpolation::getSplineInterpolatedDiffValues(
+  const std::vector<double> & query_keys) const
+{
   std::vector<double> res;
-  size_t j = 0;
-  for (const auto & query_key : validated_query_keys) {
-    while (base_keys_.at(j + 1) < query_key) {
-      ++j;
-    }
+  getSplineInterpolatedDiffValues(query_keys, res);
+  return res;
+}
 
-    const double ds = query_key - base_keys_.at(j);
-    res.push_back(c.at(j) + (2.0 * b.at(j) + 3.0 * a.at(j) * ds) * ds);
-  }
+void SplineInterpolation::getSplineInterpolatedDiffValues(
+  const std::vector<double> & query_keys, std::vector<double> & res) const
+{
+  const auto & a = multi_spline_coef_.a;
+  const auto & b = multi_spline_coef_.b;
+  const auto & c = multi_spline_coef_.c;
 
-  return res;
+  evaluate(query_keys, res, [&](const size_t j, const double ds) {
+    return c[j] + (2.0 * b[j] + 3.0 * a[j] * ds) * ds;
+  });
 }
 
 std::vector<double> SplineInterpolation::getSplineInterpolatedQuadDiffValues(
   const std::vector<double> & query_keys) const
 {
-  // throw exceptions for invalid arguments
-  const auto validated_query_keys = interpolation_utils::validateKeys(base_keys_, query_keys);
+  std::vector<double> res;
+  getSplineInterpolatedQuadDiffValues(query_keys, res);
+  return res;
+}
 
+void SplineInterpolation::getSplineInterpolatedQuadDiffValues(
+  const std::vector<double> & query_keys, std::vector<double> & res) const
+{
   const auto & a = multi_spline_coef_.a;
   const auto & b = multi_spline_coef_.b;
 
-  std::vector<double> res;
-  size_t j = 0;
-  for (const auto & query_key : validated_query_keys) {
-    while (base_keys_.at(j + 1) < query_key) {
-      ++j;
-    }
+  evaluate(query_keys, res, [&](const size_t j, const double ds) {
+    return 2.0 * b[j] + 6.0 * a[j] * ds;
+  });
+}
 
-    const double ds = query_key - base_keys_.at(j);
-    res.push_back(2.0 * b.at(j) + 6.0 * a.at(j) * ds);
-  }
+double SplineInterpolation::getSplineInterpolatedValue(const double query_key) const
+{
+  const double validated_query_key = interpolation_utils::validateKey(base_keys_, query_key);
+  const size_t j = getSegmentIndex(validated_query_key);
+  const double ds = validated_query_key - base_keys_[j];
 
-  return res;
+  const auto & coef = multi_spline_coef_;
+  return coef.d[j] + (coef.c[j] + (coef.b[j] + coef.a[j] * ds) * ds) * ds;
+}
+
+double SplineInterpolation::getSplineInterpolatedDiffValue(const double query_key) const
+{
+  const double validated_query_key = interpolation_utils::validateKey(base_keys_, query_key);
+  const size_t j = getSegmentIndex(validated_query_key);
+  const double ds = validated_query_key - base_keys_[j];
+
+  const auto & coef = multi_spline_coef_;
+  return coef.c[j] + (2.0 * coef.b[j] + 3.0 * coef.a[j] * ds) * ds;
+}
+
+double SplineInterpolation::getSplineInterpolatedQuadDiffValue(const double query_key) const
+{
+  const double validated_query_key = interpolation_utils::validateKey(base_keys_, query_key);
+  const size_t j = getSegmentIndex(validated_query_key);
+  const double ds = validated_query_key - base_keys_[j];
+
+  const auto & coef = multi_spline_coef_;
+  return 2.0 * coef.b[j] + 6.0 * coef.a[j] * ds;
 }
@@ -235,3 +235,97 @@ TEST(spline_interpolation, SplineInterpolation)
     EXPECT_NEAR(query_values.at(i), ans.at(i), epsilon);
   }
 }
+
+TEST(spline_interpolation, SplineInterpolationWithoutAllocation)
+{
+  const std::vector<double> base_keys{-1.5, 1.0, 5.0, 10.0, 15.0, 20.0};
+  const std::vector<double> base_values{-1.2, 0.5, 1.0, 1.2, 2.0, 1.0};
+  const std::vector<double> query_keys{-1.5, 0.0, 8.0, 18.0, 20.0};
+
+  const SplineInterpolation s_ans(base_keys, base_values);
+  const auto ans = s_ans.getSplineInterpolatedValues(query_keys);
+  const auto diff_ans = s_ans.getSplineInterpolatedDiffValues(query_keys);
+  const auto quad_diff_ans = s_ans.getSplineInterpolatedQuadDiffValues(query_keys);
+
+  // reuse the instance and the result vector
+  SplineInterpolation s(std::vector<double>{0.0, 1.0, 2.0}, std::vector<double>{0.0, 1.0, 0.0});
+  std::vector<double> query_values(10, 0.0);
+  s.calcSplineCoefficients(base_keys, base_values);
+
+  s.getSplineInterpolatedValues(query_keys, query_values);
+  ASSERT_EQ(query_values.size(), query_keys.size());
+  for (size_t i = 0; i < query_keys.size(); ++i) {
+    EXPECT_NEAR(query_values.at(i), ans.at(i), epsilon);
+    EXPECT_NEAR(s.getSplineInterpolatedValue(query_keys.at(i)), ans.at(i), epsilon);
+  }
+
+  s.getSplineInterpolatedDiffValues(query_keys, query_values);
+  for (size_t i = 0; i < query_keys.size(); ++i) {
+    EXPECT_NEAR(query_values.at(i), diff_ans.at(i), epsilon);
+    EXPECT_NEAR(s.getSplineInterpolatedDiffValue(query_keys.at(i)), diff_ans.at(i), epsilon);
+  }
+
+  s.getSplineInterpolatedQuadDiffValues(query_keys, query_values);
+  for (size_t i = 0; i < query_keys.size(); ++i) {
+    EXPECT_NEAR(query_values.at(i), quad_diff_ans.at(i), epsilon);
+    EXPECT_NEAR(
+      s.getSplineInterpolatedQuadDiffValue(query_keys.at(i)), quad_diff_ans.at(i), epsilon);
+  }
+
+  // query keys slightly out of base keys are cropped
+  EXPECT_NEAR(s.getSplineInterpolatedValue(-1.5 - 1e-4), ans.front(), epsilon);
+  EXPECT_NEAR(s.getSplineInterpolatedValue(20.0 + 1e-4), ans.back(), epsilon);
+  EXPECT_THROW(s.getSplineInterpolatedValue(21.0), std::invalid_argument);
+  EXPECT_THROW(s.getSplineInterpolatedValues({0.0, 21.0}, query_values), std::invalid_argument);
+}
+
+TEST(spline_interpolation, appendBasePoints)
+{
+  const std::vector<double> base_keys{-1.5, 1.0, 5.0, 10.0, 15.0, 20.0, 21.0, 24.5};
+  const std::vector<double> base_values{-1.2, 0.5, 1.0, 1.2, 2.0, 1.0, 0.8, 1.5};
+  std::vector<double> query_keys;
+  for (double key = -1.5; key < 24.5; key += 0.3) {
+    query_keys.push_back(key);
+  }
+
+  const auto ans =
+    SplineInterpolation(base_keys, base_values).getSplineInterpolatedValues(query_keys);
+
+  for (size_t num_front = 2; num_front < base_keys.size(); ++num_front) {
+    // append the base points one by one or at once
+    SplineInterpolation s_one_by_one(
+      std::vector<double>(base_keys.begin(), base_keys.begin() + num_front),
+      std::vector<double>(base_values.begin(), base_values.begin() + num_front));
+    for (size_t i = num_front; i < base_keys.size(); ++i) {
+      s_one_by_one.appendBasePoints({base_keys.at(i)}, {base_values.at(i)});
+    }
+
+    SplineInterpolation s_at_once(
+      std::vector<double>(base_keys.begin(), base_keys.begin() + num_front),
+      std::vector<double>(base_values.begin(), base_values.begin() + num_front));
+    s_at_once.appendBasePoints(
+      std::vector<double>(base_keys.begin() + num_front, base_keys.end()),
+      std::vector<double>(base_values.begin() + num_front, base_values.end()));
+
+    ASSERT_EQ(s_one_by_one.getSize(), base_keys.size());
+    ASSERT_EQ(s_at_once.getSize(), base_keys.size());
+    const auto query_values_one_by_one = s_one_by_one.getSplineInterpolatedValues(query_keys);
+    const auto query_values_at_once = s_at_once.getSplineInterpolatedValues(query_keys);
+    for (size_t i = 0; i < query_keys.size(); ++i) {
+      EXPECT_NEAR(query_values_one_by_one.at(i), ans.at(i), epsilon);
+      EXPECT_NEAR(query_values_at_once.at(i), ans.at(i), epsilon);
+    }
+  }
+
+  // append to an empty instance
+  SplineInterpolation s_empty;
+  s_empty.appendBasePoints(base_keys, base_values);
+  EXPECT_NEAR(s_empty.getSplineInterpolatedValue(query_keys.at(32)), ans.at(32), epsilon);
+
+  // invalid base points
+  SplineInterpolation s(base_keys, base_values);
+  EXPECT_THROW(s.appendBasePoints({}, {}), std::invalid_argument);
+  EXPECT_THROW(s.appendBasePoints({25.0, 26.0}, {0.0}), std::invalid_argument);
+  EXPECT_THROW(s.appendBasePoints({24.5}, {0.0}), std::invalid_argument);
+  EXPECT_THROW(s.appendBasePoints({26.0, 25.0}, {0.0, 0.0}), std::invalid_argument);
+}
@@ -0,0 +1,186 @@
+// Copyright 2023 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef KALMAN_FILTER__KALMAN_FILTER_N_HPP_
+#define KALMAN_FILTER__KALMAN_FILTER_N_HPP_
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+/**
+ * @brief kalman filter with the fixed state dimension, the same as KalmanFilter
+ * @details All the matrices have fixed-size storage, so that predict() and update() do not
+ * allocate memory. The dimension of the measurement can change for each update, e.g. with or
+ * without the yaw, up to Nz.
+ * @tparam Nx dimension of the state
+ * @tparam Nz maximum dimension of the measurement
+ * @tparam Nu dimension of the input
+ */
+template <int Nx, int Nz, int Nu = Nx>
+class KalmanFilterN
+{
+public:
+  using StateVector = Eigen::Matrix<double, Nx, 1>;
+  using StateMatrix = Eigen::Matrix<double, Nx, Nx>;
+  using InputVector = Eigen::Matrix<double, Nu, 1>;
+  using InputMatrix = Eigen::Matrix<double, Nx, Nu>;
+  using MeasurementVector = Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor, Nz, 1>;
+  using MeasurementMatrix = Eigen::Matrix<double, Eigen::Dynamic, Nx, Eigen::ColMajor, Nz, Nx>;
+  using MeasurementCovariance =
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor, Nz, Nz>;
+
+  /**
+   * @brief No initialization constructor.
+   */
+  KalmanFilterN() = default;
+
+  /**
+   * @brief initialization of kalman filter
+   * @param x initial state
+   * @param A coefficient matrix of x for process model
+   * @param B coefficient matrix of u for process model
+   * @param C coefficient matrix of x for measurement model
+   * @param Q covariance matrix for process model
+   * @param R covariance matrix for measurement model
+   * @param P initial covariance of estimated state
+   */
+  bool init(
+    const StateVector & x, const StateMatrix & A, const InputMatrix & B,
+    const MeasurementMatrix & C, const StateMatrix & Q, const MeasurementCovariance & R,
+    const StateMatrix & P)
+  {
+    if (C.rows() == 0 || R.rows() != C.rows() || R.cols() != C.rows()) {
+      return false;
+    }
+    x_ = x;
+    A_ = A;
+    B_ = B;
+    C_ = C;
+    Q_ = Q;
+    R_ = R;
+    P_ = P;
+    return true;
+  }
+
+  /**
+   * @brief initialization of kalman filter
+   * @param x initial state
+   * @param P initial covariance of estimated state
+   */
+  bool init(const StateVector & x, const StateMatrix & P0)
+  {
+    x_ = x;
+    P_ = P0;
+    return true;
+  }
+
+  void setA(const StateMatrix & A) { A_ = A; }
+  void setB(const InputMatrix & B) { B_ = B; }
+  void setC(const MeasurementMatrix & C) { C_ = C; }
+  void setQ(const StateMatrix & Q) { Q_ = Q; }
+  void setR(const MeasurementCovariance & R) { R_ = R; }
+
+  void getX(StateVector & x) const { x = x_; }
+  void getP(StateMatrix & P) const { P = P_; }
+  const StateVector & getX() const { return x_; }
+  const StateMatrix & getP() const { return P_; }
+  double getXelement(unsigned int i) const { return x_(i); }
+
+  /**
+   * @brief calculate kalman filter state and covariance by prediction model with A, B, Q matrix.
+   * @param u input for model
+   * @param A coefficient matrix of x for process model
+   * @param B coefficient matrix of u for process model
+   * @param Q covariance matrix for process model
+   */
+  bool predict(
+    const InputVector & u, const StateMatrix & A, const InputMatrix & B, const StateMatrix & Q)
+  {
+    const StateVector x_next = A * x_ + B * u;
+    return predict(x_next, A, Q);
+  }
+
+  /**
+   * @brief calculate kalman filter covariance with prediction model with x, A, Q matrix. This is
+   * mainly for EKF with variable matrix.
+   * @param x_next predicted state
+   * @param A coefficient matrix of x for process model
+   * @param Q covariance matrix for process model
+   */
+  bool predict(const StateVector & x_next, const StateMatrix & A, const StateMatrix & Q)
+  {
+    x_ = x_next;
+    P_ = A * P_ * A.transpose() + Q;
+    return true;
+  }
+
+  bool predict(const StateVector & x_next, const StateMatrix & A)
+  {
+    return predict(x_next, A, Q_);
+  }
+
+  bool predict(const InputVector & u) { return predict(u, A_, B_, Q_); }
+
+  /**
+   * @brief calculate kalman filter state by measurement model with y_pred, C and R matrix. This is
+   * mainly for EKF with variable matrix.
+   * @param y measured values
+   * @param y_pred output values expected from measurement model
+   * @param C coefficient matrix of x for measurement model
+   * @param R covariance matrix for measurement model
+   * @return false if the dimensions of the measurement do not match or the gain is not finite
+   */
+  bool update(
+    const MeasurementVector & y, const MeasurementVector & y_pred, const MeasurementMatrix & C,
+    const MeasurementCovariance & R)
+  {
+    if (
+      R.rows() != R.cols() || R.rows() != C.rows() || y.rows() != y_pred.rows() ||
+      y.rows() != C.rows()) {
+      return false;
+    }
+    using GainMatrix = Eigen::Matrix<double, Nx, Eigen::Dynamic, Eigen::ColMajor, Nx, Nz>;
+    const GainMatrix PCT = P_ * C.transpose();
+    const MeasurementCovariance S = R + C * PCT;
+    const GainMatrix K = PCT * S.inverse();
+
+    if (!K.allFinite()) {
+      return false;
+    }
+
+    x_ = x_ + K * (y - y_pred);
+    P_ = P_ - K * (C * P_);
+    return true;
+  }
+
+  bool update(
+    const MeasurementVector & y, const MeasurementMatrix & C, const MeasurementCovariance & R)
+  {
+    const MeasurementVector y_pred = C * x_;
+    return update(y, y_pred, C, R);
+  }
+
+  bool update(const MeasurementVector & y) { return update(y, C_, R_); }
+
+protected:
+  StateVector x_{StateVector::Zero()};  //!< @brief current estimated state
+  StateMatrix A_{StateMatrix::Zero()};  //!< @brief coefficient matrix of x for process model
+  InputMatrix B_{InputMatrix::Zero()};  //!< @brief coefficient matrix of u for process model
+  MeasurementMatrix C_;                 //!< @brief coefficient matrix of x for measurement model
+  StateMatrix Q_{StateMatrix::Zero()};  //!< @brief covariance matrix for process model
+  MeasurementCovariance R_;             //!< @brief covariance matrix for measurement model
+  StateMatrix P_{StateMatrix::Zero()};  //!< @brief covariance of estimated state
+};
+
+#endif  // KALMAN_FILTER__KALMAN_FILTER_N_HPP_
@@ -90,15 +90,28 @@ bool TimeDelayKalmanFilter::updateWithDelay(
   }
 
   const int dim_y = y.rows();
+  if (C.rows() != dim_y || C.cols() != dim_x_ || R.rows() != dim_y || R.cols() != dim_y) {
+    return false;
+  }
 
-  /* set measurement matrix */
-  Eigen::MatrixXd C_ex = Eigen::MatrixXd::Zero(dim_y, dim_x_ex_);
-  C_ex.block(0, dim_x_ * delay_step, dim_y, dim_x_) = C;
+  /*
+   * the extended measurement matrix C_ex = [0 ... C ... 0] only observes the delayed state, so the
+   * update only needs the columns of P of that state:
+   *
+   * K = P * C_ex' * (R + C_ex * P * C_ex')^-1 = P(:, d) * C' * (R + C * P(d, d) * C')^-1
+   * P = P - K * C_ex * P = P - K * C * P(d, :)
+   */
+  const int delay_offset = dim_x_ * delay_step;
+  const Eigen::MatrixXd PCT = P_.middleCols(delay_offset, dim_x_) * C.transpose();
+  const Eigen::MatrixXd K = PCT * ((R + C * PCT.middleRows(delay_offset, dim_x_)).inverse());
 
-  /* update */
-  if (!update(y, C_ex, R)) {
+  if (isnan(K.array()).any() || isinf(K.array()).any()) {
     return false;
   }
 
+  const Eigen::MatrixXd y_pred = C * x_.middleRows(delay_offset, dim_x_);
+  x_ = x_ + K * (y - y_pred);
+  P_ = P_ - K * (C * P_.middleRows(delay_offset, dim_x_));
+
   return true;
 }
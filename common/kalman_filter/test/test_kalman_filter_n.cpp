@@ -0,0 +1,117 @@
+// Copyright 2023 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "kalman_filter/kalman_filter.hpp"
+#include "kalman_filter/kalman_filter_n.hpp"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+template <class MatrixA, class MatrixB>
+void expectMatrixNear(const MatrixA & a, const MatrixB & b)
+{
+  ASSERT_EQ(a.rows(), b.rows());
+  ASSERT_EQ(a.cols(), b.cols());
+  for (int i = 0; i < a.rows(); ++i) {
+    for (int j = 0; j < a.cols(); ++j) {
+      EXPECT_NEAR(a(i, j), b(i, j), 1e-10);
+    }
+  }
+}
+}  // namespace
+
+TEST(kalman_filter_n, same_as_kf)
+{
+  using KF = KalmanFilterN<3, 3>;
+  KalmanFilter kf;
+  KF kf_n;
+
+  KF::StateVector x;
+  x << 1.0, 2.0, 0.5;
+  KF::StateMatrix P;
+  P << 1.0, 0.1, 0.0, 0.1, 2.0, 0.2, 0.0, 0.2, 0.5;
+  EXPECT_TRUE(kf.init(Eigen::MatrixXd(x), Eigen::MatrixXd(P)));
+  EXPECT_TRUE(kf_n.init(x, P));
+
+  KF::StateMatrix A = KF::StateMatrix::Identity();
+  A(0, 2) = 0.1;
+  A(1, 2) = -0.2;
+  const KF::StateMatrix Q = KF::StateMatrix::Identity() * 0.01;
+
+  for (int i = 0; i < 5; ++i) {
+    // predict
+    const KF::StateVector x_next = A * kf_n.getX();
+    EXPECT_TRUE(kf.predict(Eigen::MatrixXd(x_next), Eigen::MatrixXd(A), Eigen::MatrixXd(Q)));
+    EXPECT_TRUE(kf_n.predict(x_next, A, Q));
+
+    // update with the measurement of the different dimensions
+    const int dim_y = i % 2 == 0 ? 2 : 3;
+    KF::MeasurementVector y(dim_y);
+    KF::MeasurementMatrix C = KF::MeasurementMatrix::Zero(dim_y, 3);
+    KF::MeasurementCovariance R = KF::MeasurementCovariance::Zero(dim_y, dim_y);
+    for (int j = 0; j < dim_y; ++j) {
+      y(j) = 0.1 * i + j;
+      C(j, j) = 1.0;
+      R(j, j) = 0.09;
+    }
+    EXPECT_TRUE(kf.update(Eigen::MatrixXd(y), Eigen::MatrixXd(C), Eigen::MatrixXd(R)));
+    EXPECT_TRUE(kf_n.update(y, C, R));
+
+    Eigen::MatrixXd x_expected;
+    Eigen::MatrixXd P_expected;
+    kf.getX(x_expected);
+    kf.getP(P_expected);
+    expectMatrixNear(kf_n.getX(), x_expected);
+    expectMatrixNear(kf_n.getP(), P_expected);
+  }
+}
+
+TEST(kalman_filter_n, kf_with_members)
+{
+  using KF = KalmanFilterN<2, 2>;
+  KF kf_n;
+
+  KF::StateVector x;
+  x << 1.0, 2.0;
+  const KF::StateMatrix P = KF::StateMatrix::Identity();
+  const KF::StateMatrix Q = KF::StateMatrix::Identity() * 0.01;
+  const KF::StateMatrix A = KF::StateMatrix::Identity();
+  const KF::InputMatrix B = KF::InputMatrix::Identity();
+  const KF::MeasurementMatrix C = KF::MeasurementMatrix::Identity(2, 2);
+  const KF::MeasurementCovariance R = KF::MeasurementCovariance::Identity(2, 2) * 0.09;
+  EXPECT_TRUE(kf_n.init(x, A, B, C, Q, R, P));
+
+  KF::InputVector u;
+  u << 0.1, 0.1;
+  EXPECT_TRUE(kf_n.predict(u));
+  const KF::StateVector x_predict_expected = A * x + B * u;
+  const KF::StateMatrix P_predict_expected = A * P * A.transpose() + Q;
+  expectMatrixNear(kf_n.getX(), x_predict_expected);
+  expectMatrixNear(kf_n.getP(), P_predict_expected);
+
+  KF::MeasurementVector y(2);
+  y << 1.05, 2.05;
+  EXPECT_TRUE(kf_n.update(y));
+  const Eigen::MatrixXd PCT = P_predict_expected * C.transpose();
+  const Eigen::MatrixXd K = PCT * ((R + C * PCT).inverse());
+  const Eigen::MatrixXd x_update_expected = x_predict_expected + K * (y - C * x_predict_expected);
+  const Eigen::MatrixXd P_update_expected = P_predict_expected - K * (C * P_predict_expected);
+  expectMatrixNear(kf_n.getX(), x_update_expected);
+  expectMatrixNear(kf_n.getP(), P_update_expected);
+
+  // dimension mismatch of the measurement
+  const KF::MeasurementVector y_invalid = KF::MeasurementVector::Zero(1);
+  EXPECT_FALSE(kf_n.update(y_invalid, C, R));
+}
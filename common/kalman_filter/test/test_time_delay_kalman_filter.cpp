@@ -119,3 +119,68 @@ TEST(time_delay_kalman_filter, td_kf)
   EXPECT_NEAR(P_update(1, 1), P_update_expected(1, 1), 1e-5);
   EXPECT_NEAR(P_update(2, 2), P_update_expected(2, 2), 1e-5);
 }
+
+TEST(time_delay_kalman_filter, update_with_delay_matches_extended_update)
+{
+  TimeDelayKalmanFilter td_kf;
+
+  Eigen::MatrixXd x(3, 1);
+  x << 1.0, 2.0, 3.0;
+  Eigen::MatrixXd P(3, 3);
+  P << 0.1, 0.01, 0.0, 0.01, 0.2, 0.02, 0.0, 0.02, 0.3;
+  const int max_delay_step = 4;
+  const int dim_x = x.rows();
+  td_kf.init(x, P, max_delay_step);
+
+  // correlate the delayed states with each other
+  Eigen::MatrixXd A(3, 3);
+  A << 1.0, 0.1, 0.0, 0.0, 1.0, 0.1, 0.0, 0.0, 1.0;
+  Eigen::MatrixXd Q(3, 3);
+  Q << 0.01, 0.0, 0.0, 0.0, 0.02, 0.0, 0.0, 0.0, 0.03;
+  for (int i = 0; i < max_delay_step; ++i) {
+    EXPECT_TRUE(td_kf.predictWithDelay(A * td_kf.getLatestX(), A, Q));
+  }
+
+  Eigen::MatrixXd x_ex;
+  Eigen::MatrixXd P_ex;
+  td_kf.getX(x_ex);
+  td_kf.getP(P_ex);
+
+  Eigen::MatrixXd C(2, 3);
+  C << 1.0, 0.0, 0.0, 0.0, 0.5, 0.5;
+  Eigen::MatrixXd R(2, 2);
+  R << 0.001, 0.0, 0.0, 0.002;
+  Eigen::MatrixXd y(2, 1);
+  y << 1.5, 2.5;
+  const int delay_step = 2;
+
+  // the same update with the full extended measurement matrix
+  KalmanFilter kf;
+  kf.init(x_ex, P_ex);
+  Eigen::MatrixXd C_ex = Eigen::MatrixXd::Zero(C.rows(), x_ex.rows());
+  C_ex.block(0, dim_x * delay_step, C.rows(), dim_x) = C;
+  EXPECT_TRUE(kf.update(y, C_ex, R));
+
+  EXPECT_TRUE(td_kf.updateWithDelay(y, C, R, delay_step));
+
+  Eigen::MatrixXd x_expected;
+  Eigen::MatrixXd P_expected;
+  Eigen::MatrixXd x_update;
+  Eigen::MatrixXd P_update;
+  kf.getX(x_expected);
+  kf.getP(P_expected);
+  td_kf.getX(x_update);
+  td_kf.getP(P_update);
+  ASSERT_EQ(x_update.rows(), x_expected.rows());
+  ASSERT_EQ(P_update.rows(), P_expected.rows());
+  ASSERT_EQ(P_update.cols(), P_expected.cols());
+  for (int i = 0; i < x_expected.rows(); ++i) {
+    EXPECT_NEAR(x_update(i, 0), x_expected(i, 0), 1e-9);
+    for (int j = 0; j < P_expected.cols(); ++j) {
+      EXPECT_NEAR(P_update(i, j), P_expected(i, j), 1e-9);
+    }
+  }
+
+  // the measurement dimensions should match the state
+  EXPECT_FALSE(td_kf.updateWithDelay(y, C.transpose(), R, delay_step));
+}
@@ -18,6 +18,7 @@
 #include "autoware_auto_planning_msgs/msg/path.hpp"
 #include "autoware_auto_planning_msgs/msg/path_with_lane_id.hpp"
 #include "autoware_auto_planning_msgs/msg/trajectory.hpp"
+#include "motion_utils/resample/resample_plan.hpp"
 
 #include <algorithm>
 #include <limits>
@@ -212,6 +213,28 @@ autoware_auto_planning_msgs::msg::Trajectory resampleTrajectory(
   const std::vector<double> & resampled_arclength, const bool use_akima_spline_for_xy = false,
   const bool use_lerp_for_z = true, const bool use_zero_order_hold_for_twist = true);
 
+/**
+ * @brief A resampling function for a trajectory into structure of arrays. The trajectory is
+ *        resampled in the same way as resampleTrajectory() returning a trajectory, and the
+ *        orientation is output as yaw.
+ * @param input_trajectory input trajectory to resample
+ * @param resampled_arclength arclength that contains length of each resampling points from initial
+ *        point
+ * @param resampled_trajectory resampled trajectory, whose memory is reused
+ * @param use_akima_spline_for_xy If true, it uses linear interpolation to resample position x and
+ *        y. Otherwise, it uses spline interpolation
+ * @param use_lerp_for_z If true, it uses linear interpolation to resample position z.
+ *        Otherwise, it uses spline interpolation
+ * @param use_zero_order_hold_for_twist If true, it uses zero_order_hold to resample
+ *        longitudinal, lateral velocity and acceleration. Otherwise, it uses linear interpolation
+ * @return false if the arguments are invalid, and resampled_trajectory is not changed
+ */
+bool resampleTrajectory(
+  const autoware_auto_planning_msgs::msg::Trajectory & input_trajectory,
+  const std::vector<double> & resampled_arclength, TrajectoryArrays & resampled_trajectory,
+  const bool use_akima_spline_for_xy = false, const bool use_lerp_for_z = true,
+  const bool use_zero_order_hold_for_twist = true);
+
 /**
  * @brief A resampling function for a trajectory. This function resamples closest stop point,
  *        terminal point and points by resample interval. Note that in a default setting, position
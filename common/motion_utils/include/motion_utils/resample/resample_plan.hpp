@@ -0,0 +1,122 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MOTION_UTILS__RESAMPLE__RESAMPLE_PLAN_HPP_
+#define MOTION_UTILS__RESAMPLE__RESAMPLE_PLAN_HPP_
+
+#include "interpolation/linear_interpolation.hpp"
+
+#include <vector>
+
+namespace motion_utils
+{
+/**
+ * @brief mapping from the resampled arc lengths to the segments of the input points, which is
+ * shared by all the fields resampled by linear interpolation or zero order hold
+ * @details The segment index and the ratio in the segment are calculated once for each resampled
+ * arc length, with the same key search as interpolation::lerp() and
+ * interpolation::calc_closest_segment_indices(). The fields are then interpolated by reading only
+ * the two points of the segment, so that they are resampled in one pass without intermediate
+ * vectors. The plan can be reused for the points of the same arc lengths.
+ */
+class ResamplePlan
+{
+public:
+  ResamplePlan() = default;
+
+  /**
+   * @throw std::invalid_argument if the arc lengths are not valid for interpolation
+   */
+  ResamplePlan(
+    const std::vector<double> & input_arclength, const std::vector<double> & resampled_arclength)
+  {
+    update(input_arclength, resampled_arclength);
+  }
+
+  /**
+   * @brief calculate the mapping again, reusing the memory of the previous one
+   * @throw std::invalid_argument if the arc lengths are not valid for interpolation
+   */
+  void update(
+    const std::vector<double> & input_arclength, const std::vector<double> & resampled_arclength);
+
+  size_t size() const { return segment_indices_.size(); }
+
+  // index of the segment of the input points for linear interpolation
+  const std::vector<size_t> & segmentIndices() const { return segment_indices_; }
+  // ratio in the segment of the input points for linear interpolation
+  const std::vector<double> & ratios() const { return ratios_; }
+  // index of the input point for zero order hold
+  const std::vector<size_t> & closestSegmentIndices() const { return closest_segment_indices_; }
+
+  /**
+   * @brief linear interpolation at the i-th resampled arc length
+   * @param get_value function returning the value of the given index of the input points
+   */
+  template <class GetValue>
+  double lerp(const size_t i, const GetValue & get_value) const
+  {
+    const size_t seg_idx = segment_indices_[i];
+    return interpolation::lerp(get_value(seg_idx), get_value(seg_idx + 1), ratios_[i]);
+  }
+
+  /**
+   * @brief zero order hold at the i-th resampled arc length
+   * @param get_value function returning the value of the given index of the input points
+   */
+  template <class GetValue>
+  auto zeroOrderHold(const size_t i, const GetValue & get_value) const
+  {
+    return get_value(closest_segment_indices_[i]);
+  }
+
+  /**
+   * @brief linear interpolation of the values of the input points into res
+   */
+  void lerp(const std::vector<double> & values, std::vector<double> & res) const;
+
+  /**
+   * @brief zero order hold of the values of the input points into res
+   */
+  void zeroOrderHold(const std::vector<double> & values, std::vector<double> & res) const;
+
+private:
+  std::vector<size_t> segment_indices_;
+  std::vector<double> ratios_;
+  std::vector<size_t> closest_segment_indices_;
+};
+
+/**
+ * @brief structure of arrays of a resampled trajectory
+ */
+struct TrajectoryArrays
+{
+  size_t size() const { return x.size(); }
+  void resize(const size_t size);
+
+  std::vector<double> x;
+  std::vector<double> y;
+  std::vector<double> z;
+  std::vector<double> yaw;
+  std::vector<double> longitudinal_velocity_mps;
+  std::vector<double> lateral_velocity_mps;
+  std::vector<double> heading_rate_rps;
+  std::vector<double> acceleration_mps2;
+  std::vector<double> front_wheel_angle_rad;
+  std::vector<double> rear_wheel_angle_rad;
+  std::vector<double> time_from_start;
+};
+}  // namespace motion_utils
+
+#endif  // MOTION_UTILS__RESAMPLE__RESAMPLE_PLAN_HPP_
@@ -94,6 +94,76 @@ geometry_msgs::msg::Pose calcInterpolatedPose(const T & points, const double tar
   return tier4_autoware_utils::getPose(points.back());
 }
 
+/**
+ * @brief cursor of calcInterpolatedPose() for the increasing lengths on the same points
+ * @details The segment of the last query and the length to its front point are kept, so that the
+ * search of the next query starts from them and a batch of K increasing queries on N points costs
+ * O(N + K) instead of O(N K). A query shorter than the last segment restarts from the front point.
+ * The results are the same as calcInterpolatedPose(). The points are referred, they must outlive
+ * the cursor and must not be modified while it is used.
+ * @param points input path
+ */
+template <class T>
+class InterpolatedPoseCursor
+{
+public:
+  explicit InterpolatedPoseCursor(const T & points) : points_(points) {}
+
+  /**
+   * @brief calculate the interpolated pose at the length from the front point of the path
+   * @param target_length length from the front point of the path
+   * @return resampled pose
+   */
+  geometry_msgs::msg::Pose calcInterpolatedPose(const double target_length)
+  {
+    if (points_.empty()) {
+      geometry_msgs::msg::Pose interpolated_pose;
+      return interpolated_pose;
+    }
+
+    if (points_.size() < 2 || target_length < 0.0) {
+      return tier4_autoware_utils::getPose(points_.front());
+    }
+
+    if (target_length < accumulated_length_) {
+      reset();
+    }
+
+    for (; segment_idx_ < points_.size() - 1; ++segment_idx_) {
+      const auto & curr_pose = tier4_autoware_utils::getPose(points_.at(segment_idx_));
+      const auto & next_pose = tier4_autoware_utils::getPose(points_.at(segment_idx_ + 1));
+      const double length = tier4_autoware_utils::calcDistance3d(curr_pose, next_pose);
+      if (accumulated_length_ + length > target_length) {
+        const double ratio = (target_length - accumulated_length_) / std::max(length, 1e-6);
+        return tier4_autoware_utils::calcInterpolatedPose(curr_pose, next_pose, ratio);
+      }
+      accumulated_length_ += length;
+    }
+
+    return tier4_autoware_utils::getPose(points_.back());
+  }
+
+  /**
+   * @brief restart the search from the front point
+   */
+  void reset()
+  {
+    segment_idx_ = 0;
+    accumulated_length_ = 0.0;
+  }
+
+  /**
+   * @brief index of the segment of the last query, the size of the points minus one after the
+   * last point
+   */
+  size_t getSegmentIndex() const { return segment_idx_; }
+
+private:
+  const T & points_;
+  size_t segment_idx_{0};
+  // length from the front point of the path to the front point of the segment
+  double accumulated_length_{0.0};
+};
 }  // namespace motion_utils
 
 #endif  // MOTION_UTILS__TRAJECTORY__INTERPOLATION_HPP_
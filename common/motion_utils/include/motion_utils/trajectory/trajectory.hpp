@@ -2032,10 +2032,11 @@ size_t findFirstNearestIndexWithSoftConstraints(
     for (size_t i = 0; i < points.size(); ++i) {
       const auto squared_dist =
         tier4_autoware_utils::calcSquaredDistance2d(points.at(i), pose.position);
-      const auto yaw =
-        tier4_autoware_utils::calcYawDeviation(tier4_autoware_utils::getPose(points.at(i)), pose);
-
-      if (squared_dist_threshold < squared_dist || yaw_threshold < std::abs(yaw)) {
+      // the yaw deviation is calculated only for the points within the distance threshold
+      if (
+        squared_dist_threshold < squared_dist ||
+        yaw_threshold < std::abs(tier4_autoware_utils::calcYawDeviation(
+                          tier4_autoware_utils::getPose(points.at(i)), pose))) {
         if (is_within_constraints) {
           break;
         } else {
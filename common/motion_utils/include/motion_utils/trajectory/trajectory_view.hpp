@@ -0,0 +1,180 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MOTION_UTILS__TRAJECTORY__TRAJECTORY_VIEW_HPP_
+#define MOTION_UTILS__TRAJECTORY__TRAJECTORY_VIEW_HPP_
+
+#include "tier4_autoware_utils/geometry/geometry.hpp"
+
+#include <geometry_msgs/msg/point.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <boost/optional.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace motion_utils
+{
+/**
+ * @brief structure of arrays copy of points of trajectory, path, ... for repeated queries
+ * @details The position, yaw and velocity of the points and the cumulative arc length are stored in
+ * contiguous arrays when the view is built, so that the nearest searches only read the coordinates
+ * and the arc length between two indices is O(1). The yaw deviations are gated with the cosine
+ * and sine of the yaw so that they are vectorized as well. The queries return the same results as
+ * the functions of the same name in trajectory.hpp except for rounding errors at the yaw threshold.
+ * The view does not follow later modifications of the points, it has to be built again.
+ */
+class TrajectoryView
+{
+public:
+  TrajectoryView() = default;
+
+  template <class T>
+  explicit TrajectoryView(const T & points)
+  {
+    build(points);
+  }
+
+  template <class T>
+  void build(const T & points)
+  {
+    clear();
+    reserve(points.size());
+    for (const auto & point : points) {
+      addPoint(
+        tier4_autoware_utils::getPose(point), tier4_autoware_utils::getLongitudinalVelocity(point));
+    }
+  }
+
+  void clear();
+  void reserve(const size_t size);
+
+  /**
+   * @brief append a point at the end of the view
+   */
+  void addPoint(const geometry_msgs::msg::Pose & pose, const double velocity);
+
+  size_t size() const { return x_.size(); }
+  bool empty() const { return x_.empty(); }
+
+  const std::vector<double> & x() const { return x_; }
+  const std::vector<double> & y() const { return y_; }
+  const std::vector<double> & z() const { return z_; }
+  const std::vector<double> & yaw() const { return yaw_; }
+  const std::vector<double> & velocity() const { return velocity_; }
+  // arc length from the first point to each point
+  const std::vector<double> & arcLength() const { return arc_length_; }
+
+  /**
+   * @brief find the index of the nearest point to the given point, the first one when several
+   * points are at the same distance
+   * @throw std::invalid_argument if the view is empty
+   */
+  size_t findNearestIndex(const geometry_msgs::msg::Point & point) const;
+
+  /**
+   * @brief find the index of the nearest point to the given pose within the distance and yaw
+   * thresholds
+   */
+  boost::optional<size_t> findNearestIndex(
+    const geometry_msgs::msg::Pose & pose,
+    const double max_dist = std::numeric_limits<double>::max(),
+    const double max_yaw = std::numeric_limits<double>::max()) const;
+
+  /**
+   * @brief find the index of the nearest point to the given pose starting from a hint index, e.g.
+   * the result of the previous cycle
+   * @details The squared distance is descended from the hint in both directions, so only the
+   * points between the hint and the result are read. The local minimum is returned if it satisfies
+   * the thresholds, otherwise the whole view is searched as findNearestIndex(). When the trajectory
+   * comes back close to itself, the local minimum may differ from the global one.
+   */
+  boost::optional<size_t> findNearestIndexFromHint(
+    const geometry_msgs::msg::Pose & pose, const size_t hint_idx,
+    const double max_dist = std::numeric_limits<double>::max(),
+    const double max_yaw = std::numeric_limits<double>::max()) const;
+
+  /**
+   * @brief find the first nearest index within the distance and yaw thresholds, or within the
+   * distance threshold only, or without any threshold, as the function of the same name in
+   * trajectory.hpp
+   * @throw std::invalid_argument if the view is empty
+   */
+  size_t findFirstNearestIndexWithSoftConstraints(
+    const geometry_msgs::msg::Pose & pose,
+    const double dist_threshold = std::numeric_limits<double>::max(),
+    const double yaw_threshold = std::numeric_limits<double>::max()) const;
+
+  size_t findFirstNearestSegmentIndexWithSoftConstraints(
+    const geometry_msgs::msg::Pose & pose,
+    const double dist_threshold = std::numeric_limits<double>::max(),
+    const double yaw_threshold = std::numeric_limits<double>::max()) const;
+
+  /**
+   * @brief calculate the length along the segment seg_idx from its front point to the projection
+   * of p_target, overlapping points after seg_idx are skipped as in removeOverlapPoints()
+   */
+  double calcLongitudinalOffsetToSegment(
+    const size_t seg_idx, const geometry_msgs::msg::Point & p_target,
+    const bool throw_exception = false) const;
+
+  /**
+   * @brief calculate the index of the nearest segment from the index of the nearest point, as in
+   * findNearestSegmentIndex()
+   */
+  size_t calcSegmentIndex(const size_t nearest_idx, const geometry_msgs::msg::Point & point) const;
+
+  size_t findNearestSegmentIndex(const geometry_msgs::msg::Point & point) const;
+
+  boost::optional<size_t> findNearestSegmentIndex(
+    const geometry_msgs::msg::Pose & pose,
+    const double max_dist = std::numeric_limits<double>::max(),
+    const double max_yaw = std::numeric_limits<double>::max()) const;
+
+  double calcSignedArcLength(const size_t src_idx, const size_t dst_idx) const;
+  double calcSignedArcLength(
+    const geometry_msgs::msg::Point & src_point, const size_t dst_idx) const;
+  double calcSignedArcLength(
+    const size_t src_idx, const geometry_msgs::msg::Point & dst_point) const;
+  double calcSignedArcLength(
+    const geometry_msgs::msg::Point & src_point, const geometry_msgs::msg::Point & dst_point) const;
+
+  double calcArcLength() const;
+
+  /**
+   * @brief find the index of the segment containing the given arc length from the first point in
+   * O(log N), the first or the last segment when the arc length is out of the trajectory
+   */
+  boost::optional<size_t> findSegmentIndexFromArcLength(const double arc_length) const;
+
+  /**
+   * @brief calculate the point at the given arc length from the first point by linear
+   * interpolation, the arc length is clamped to the trajectory
+   */
+  boost::optional<geometry_msgs::msg::Point> calcPointFromArcLength(const double arc_length) const;
+
+private:
+  std::vector<double> x_;
+  std::vector<double> y_;
+  std::vector<double> z_;
+  std::vector<double> yaw_;
+  std::vector<double> cos_yaw_;
+  std::vector<double> sin_yaw_;
+  std::vector<double> velocity_;
+  std::vector<double> arc_length_;
+};
+}  // namespace motion_utils
+
+#endif  // MOTION_UTILS__TRAJECTORY__TRAJECTORY_VIEW_HPP_
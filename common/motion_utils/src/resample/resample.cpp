@@ -24,6 +24,70 @@
 #include "tier4_autoware_utils/geometry/pose_deviation.hpp"
 #include "tier4_autoware_utils/math/constants.hpp"
 
+#ifdef ROS_DISTRO_GALACTIC
+#include <tf2_geometry_msgs/tf2_geometry_msgs.h>
+#else
+#include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
+#endif
+
+#include <tf2/utils.h>
+
+#include <vector>
+
+namespace
+{
+using autoware_auto_planning_msgs::msg::TrajectoryPoint;
+
+void calcInputArclengthAndPose(
+  const std::vector<TrajectoryPoint> & points, std::vector<double> & input_arclength,
+  std::vector<geometry_msgs::msg::Pose> & input_pose)
+{
+  input_arclength.reserve(points.size());
+  input_pose.reserve(points.size());
+
+  input_arclength.push_back(0.0);
+  input_pose.push_back(points.front().pose);
+  for (size_t i = 1; i < points.size(); ++i) {
+    const auto & prev_pt = points.at(i - 1);
+    const auto & curr_pt = points.at(i);
+    const double ds =
+      tier4_autoware_utils::calcDistance2d(prev_pt.pose.position, curr_pt.pose.position);
+    input_arclength.push_back(ds + input_arclength.back());
+    input_pose.push_back(curr_pt.pose);
+  }
+}
+
+// resample the fields except for the pose at the i-th resampled arc length. Twist
+// information(velocity and acceleration) is resampled by zero order hold or linear interpolation,
+// and the rest of the category is resampled by linear interpolation.
+TrajectoryPoint resampleTrajectoryPoint(
+  const std::vector<TrajectoryPoint> & points, const motion_utils::ResamplePlan & plan,
+  const size_t i, const bool use_zero_order_hold_for_twist)
+{
+  const auto lerp = [&](const auto & get_value) { return plan.lerp(i, get_value); };
+  const auto twist = [&](const auto & get_value) {
+    return use_zero_order_hold_for_twist ? static_cast<double>(plan.zeroOrderHold(i, get_value))
+                                         : plan.lerp(i, get_value);
+  };
+
+  TrajectoryPoint traj_point;
+  traj_point.longitudinal_velocity_mps =
+    twist([&](const size_t j) { return points[j].longitudinal_velocity_mps; });
+  traj_point.lateral_velocity_mps =
+    twist([&](const size_t j) { return points[j].lateral_velocity_mps; });
+  traj_point.heading_rate_rps = lerp([&](const size_t j) { return points[j].heading_rate_rps; });
+  traj_point.acceleration_mps2 = twist([&](const size_t j) { return points[j].acceleration_mps2; });
+  traj_point.front_wheel_angle_rad =
+    lerp([&](const size_t j) { return points[j].front_wheel_angle_rad; });
+  traj_point.rear_wheel_angle_rad =
+    lerp([&](const size_t j) { return points[j].rear_wheel_angle_rad; });
+  traj_point.time_from_start = rclcpp::Duration::from_seconds(lerp([&](const size_t j) {
+    return rclcpp::Duration(points[j].time_from_start).seconds();
+  }));
+  return traj_point;
+}
+}  // namespace
+
 namespace motion_utils
 {
 std::vector<geometry_msgs::msg::Point> resamplePointVector(
@@ -575,73 +639,10 @@ autoware_auto_planning_msgs::msg::Trajectory resampleTrajectory(
   // Input Trajectory Information
   std::vector<double> input_arclength;
   std::vector<geometry_msgs::msg::Pose> input_pose;
-  std::vector<double> v_lon;
-  std::vector<double> v_lat;
-  std::vector<double> heading_rate;
-  std::vector<double> acceleration;
-  std::vector<double> front_wheel_angle;
-  std::vector<double> rear_wheel_angle;
-  std::vector<double> time_from_start;
-  input_arclength.reserve(input_trajectory.points.size());
-  input_pose.reserve(input_trajectory.points.size());
-  v_lon.reserve(input_trajectory.points.size());
-  v_lat.reserve(input_trajectory.points.size());
-  heading_rate.reserve(input_trajectory.points.size());
-  acceleration.reserve(input_trajectory.points.size());
-  front_wheel_angle.reserve(input_trajectory.points.size());
-  rear_wheel_angle.reserve(input_trajectory.points.size());
-  time_from_start.reserve(input_trajectory.points.size());
-
-  input_arclength.push_back(0.0);
-  input_pose.push_back(input_trajectory.points.front().pose);
-  v_lon.push_back(input_trajectory.points.front().longitudinal_velocity_mps);
-  v_lat.push_back(input_trajectory.points.front().lateral_velocity_mps);
-  heading_rate.push_back(input_trajectory.points.front().heading_rate_rps);
-  acceleration.push_back(input_trajectory.points.front().acceleration_mps2);
-  front_wheel_angle.push_back(input_trajectory.points.front().front_wheel_angle_rad);
-  rear_wheel_angle.push_back(input_trajectory.points.front().rear_wheel_angle_rad);
-  time_from_start.push_back(
-    rclcpp::Duration(input_trajectory.points.front().time_from_start).seconds());
-  for (size_t i = 1; i < input_trajectory.points.size(); ++i) {
-    const auto & prev_pt = input_trajectory.points.at(i - 1);
-    const auto & curr_pt = input_trajectory.points.at(i);
-    const double ds =
-      tier4_autoware_utils::calcDistance2d(prev_pt.pose.position, curr_pt.pose.position);
-    input_arclength.push_back(ds + input_arclength.back());
-    input_pose.push_back(curr_pt.pose);
-    v_lon.push_back(curr_pt.longitudinal_velocity_mps);
-    v_lat.push_back(curr_pt.lateral_velocity_mps);
-    heading_rate.push_back(curr_pt.heading_rate_rps);
-    acceleration.push_back(curr_pt.acceleration_mps2);
-    front_wheel_angle.push_back(curr_pt.front_wheel_angle_rad);
-    rear_wheel_angle.push_back(curr_pt.rear_wheel_angle_rad);
-    time_from_start.push_back(rclcpp::Duration(curr_pt.time_from_start).seconds());
-  }
-
-  // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return interpolation::lerp(input_arclength, input, resampled_arclength);
-  };
-
-  std::vector<size_t> closest_segment_indices;
-  if (use_zero_order_hold_for_twist) {
-    closest_segment_indices =
-      interpolation::calc_closest_segment_indices(input_arclength, resampled_arclength);
-  }
-  const auto zoh = [&](const auto & input) {
-    return interpolation::zero_order_hold(input_arclength, input, closest_segment_indices);
-  };
+  calcInputArclengthAndPose(input_trajectory.points, input_arclength, input_pose);
 
   const auto interpolated_pose =
     resamplePoseVector(input_pose, resampled_arclength, use_akima_spline_for_xy, use_lerp_for_z);
-  const auto interpolated_v_lon = use_zero_order_hold_for_twist ? zoh(v_lon) : lerp(v_lon);
-  const auto interpolated_v_lat = use_zero_order_hold_for_twist ? zoh(v_lat) : lerp(v_lat);
-  const auto interpolated_heading_rate = lerp(heading_rate);
-  const auto interpolated_acceleration =
-    use_zero_order_hold_for_twist ? zoh(acceleration) : lerp(acceleration);
-  const auto interpolated_front_wheel_angle = lerp(front_wheel_angle);
-  const auto interpolated_rear_wheel_angle = lerp(rear_wheel_angle);
-  const auto interpolated_time_from_start = lerp(time_from_start);
 
   if (interpolated_pose.size() != resampled_arclength.size()) {
     std::cerr << "[motion_utils]: Resampled pose size is different from resampled arclength"
@@ -649,25 +650,72 @@ autoware_auto_planning_msgs::msg::Trajectory resampleTrajectory(
     return input_trajectory;
   }
 
+  // Interpolate the other fields in one pass
+  const ResamplePlan plan(input_arclength, resampled_arclength);
+
   autoware_auto_planning_msgs::msg::Trajectory resampled_trajectory;
   resampled_trajectory.header = input_trajectory.header;
   resampled_trajectory.points.resize(interpolated_pose.size());
   for (size_t i = 0; i < resampled_trajectory.points.size(); ++i) {
-    autoware_auto_planning_msgs::msg::TrajectoryPoint traj_point;
+    auto & traj_point = resampled_trajectory.points.at(i);
+    traj_point =
+      resampleTrajectoryPoint(input_trajectory.points, plan, i, use_zero_order_hold_for_twist);
     traj_point.pose = interpolated_pose.at(i);
-    traj_point.longitudinal_velocity_mps = interpolated_v_lon.at(i);
-    traj_point.lateral_velocity_mps = interpolated_v_lat.at(i);
-    traj_point.heading_rate_rps = interpolated_heading_rate.at(i);
-    traj_point.acceleration_mps2 = interpolated_acceleration.at(i);
-    traj_point.front_wheel_angle_rad = interpolated_front_wheel_angle.at(i);
-    traj_point.rear_wheel_angle_rad = interpolated_rear_wheel_angle.at(i);
-    traj_point.time_from_start = rclcpp::Duration::from_seconds(interpolated_time_from_start.at(i));
-    resampled_trajectory.points.at(i) = traj_point;
   }
 
   return resampled_trajectory;
 }
 
+bool resampleTrajectory(
+  const autoware_auto_planning_msgs::msg::Trajectory & input_trajectory,
+  const std::vector<double> & resampled_arclength, TrajectoryArrays & resampled_trajectory,
+  const bool use_akima_spline_for_xy, const bool use_lerp_for_z,
+  const bool use_zero_order_hold_for_twist)
+{
+  // validate arguments
+  if (!resample_utils::validate_arguments(input_trajectory.points, resampled_arclength)) {
+    return false;
+  }
+
+  // Input Trajectory Information
+  std::vector<double> input_arclength;
+  std::vector<geometry_msgs::msg::Pose> input_pose;
+  calcInputArclengthAndPose(input_trajectory.points, input_arclength, input_pose);
+
+  const auto interpolated_pose =
+    resamplePoseVector(input_pose, resampled_arclength, use_akima_spline_for_xy, use_lerp_for_z);
+
+  if (interpolated_pose.size() != resampled_arclength.size()) {
+    std::cerr << "[motion_utils]: Resampled pose size is different from resampled arclength"
+              << std::endl;
+    return false;
+  }
+
+  // Interpolate the other fields in one pass
+  const ResamplePlan plan(input_arclength, resampled_arclength);
+
+  resampled_trajectory.resize(interpolated_pose.size());
+  for (size_t i = 0; i < resampled_trajectory.size(); ++i) {
+    const auto & pose = interpolated_pose.at(i);
+    const auto traj_point =
+      resampleTrajectoryPoint(input_trajectory.points, plan, i, use_zero_order_hold_for_twist);
+    resampled_trajectory.x.at(i) = pose.position.x;
+    resampled_trajectory.y.at(i) = pose.position.y;
+    resampled_trajectory.z.at(i) = pose.position.z;
+    resampled_trajectory.yaw.at(i) = tf2::getYaw(pose.orientation);
+    resampled_trajectory.longitudinal_velocity_mps.at(i) = traj_point.longitudinal_velocity_mps;
+    resampled_trajectory.lateral_velocity_mps.at(i) = traj_point.lateral_velocity_mps;
+    resampled_trajectory.heading_rate_rps.at(i) = traj_point.heading_rate_rps;
+    resampled_trajectory.acceleration_mps2.at(i) = traj_point.acceleration_mps2;
+    resampled_trajectory.front_wheel_angle_rad.at(i) = traj_point.front_wheel_angle_rad;
+    resampled_trajectory.rear_wheel_angle_rad.at(i) = traj_point.rear_wheel_angle_rad;
+    resampled_trajectory.time_from_start.at(i) =
+      rclcpp::Duration(traj_point.time_from_start).seconds();
+  }
+
+  return true;
+}
+
 autoware_auto_planning_msgs::msg::Trajectory resampleTrajectory(
   const autoware_auto_planning_msgs::msg::Trajectory & input_trajectory,
   const double resample_interval, const bool use_akima_spline_for_xy, const bool use_lerp_for_z,
@@ -0,0 +1,110 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "motion_utils/resample/resample_plan.hpp"
+
+#include "interpolation/interpolation_utils.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace motion_utils
+{
+void ResamplePlan::update(
+  const std::vector<double> & input_arclength, const std::vector<double> & resampled_arclength)
+{
+  // throw exceptions for invalid arguments
+  interpolation_utils::validateKeysWithoutCrop(input_arclength, resampled_arclength);
+
+  // same as the default of interpolation::calc_closest_segment_indices()
+  constexpr double overlap_threshold = 1e-3;
+
+  const size_t num_input = input_arclength.size();
+  const size_t num_resampled = resampled_arclength.size();
+  segment_indices_.resize(num_resampled);
+  ratios_.resize(num_resampled);
+  closest_segment_indices_.resize(num_resampled);
+
+  size_t seg_idx = 0;
+  size_t closest_segment_idx = 0;
+  // the last index j where input_arclength[j - 1] - overlap_threshold < s
+  size_t zoh_idx = 1;
+  for (size_t i = 0; i < num_resampled; ++i) {
+    // NOTE: Due to calculation error of double, the resampled arc length may be slightly out of
+    //       the input arc length. Therefore, the front and back are cropped here.
+    double s = resampled_arclength[i];
+    if (i == 0) {
+      s = std::max(s, input_arclength.front());
+    }
+    if (i == num_resampled - 1) {
+      s = std::min(s, input_arclength.back());
+    }
+
+    // linear interpolation
+    while (input_arclength.at(seg_idx + 1) < s) {
+      ++seg_idx;
+    }
+    segment_indices_[i] = seg_idx;
+    ratios_[i] = (s - input_arclength[seg_idx]) /
+                 (input_arclength[seg_idx + 1] - input_arclength[seg_idx]);
+
+    // zero order hold, the forward search gives the same index as the backward search from the
+    // terminal point in interpolation::calc_closest_segment_indices()
+    if (input_arclength.back() - overlap_threshold < s) {
+      closest_segment_idx = num_input - 1;
+    } else {
+      while (zoh_idx + 1 < num_input && input_arclength[zoh_idx] - overlap_threshold < s) {
+        ++zoh_idx;
+      }
+      if (closest_segment_idx < zoh_idx && s < input_arclength[zoh_idx]) {
+        closest_segment_idx = zoh_idx - 1;
+      }
+    }
+    closest_segment_indices_[i] = closest_segment_idx;
+  }
+}
+
+void ResamplePlan::lerp(const std::vector<double> & values, std::vector<double> & res) const
+{
+  res.resize(size());
+  for (size_t i = 0; i < size(); ++i) {
+    res[i] = lerp(i, [&](const size_t j) { return values.at(j); });
+  }
+}
+
+void ResamplePlan::zeroOrderHold(
+  const std::vector<double> & values, std::vector<double> & res) const
+{
+  res.resize(size());
+  for (size_t i = 0; i < size(); ++i) {
+    res[i] = zeroOrderHold(i, [&](const size_t j) { return values.at(j); });
+  }
+}
+
+void TrajectoryArrays::resize(const size_t size)
+{
+  x.resize(size);
+  y.resize(size);
+  z.resize(size);
+  yaw.resize(size);
+  longitudinal_velocity_mps.resize(size);
+  lateral_velocity_mps.resize(size);
+  heading_rate_rps.resize(size);
+  acceleration_mps2.resize(size);
+  front_wheel_angle_rad.resize(size);
+  rear_wheel_angle_rad.resize(size);
+  time_from_start.resize(size);
+}
+}  // namespace motion_utils
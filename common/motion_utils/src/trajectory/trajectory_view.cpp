@@ -0,0 +1,408 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "motion_utils/trajectory/trajectory_view.hpp"
+
+#include "tier4_autoware_utils/math/constants.hpp"
+#include "tier4_autoware_utils/math/normalization.hpp"
+#include "tier4_autoware_utils/system/backtrace.hpp"
+
+#include <Eigen/Core>
+
+#include <tf2/utils.h>
+
+#ifdef ROS_DISTRO_GALACTIC
+#include <tf2_geometry_msgs/tf2_geometry_msgs.h>
+#else
+#include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+
+namespace motion_utils
+{
+namespace
+{
+// distance below which two consecutive points overlap, as in removeOverlapPoints()
+constexpr double overlap_eps = 1.0E-08;
+
+// the coordinates are contiguous so that the distances are computed with packed instructions
+Eigen::ArrayXd calcSquaredDistances(
+  const std::vector<double> & xs, const std::vector<double> & ys, const double x, const double y)
+{
+  const Eigen::Map<const Eigen::ArrayXd> x_array(xs.data(), xs.size());
+  const Eigen::Map<const Eigen::ArrayXd> y_array(ys.data(), ys.size());
+  return (x_array - x).square() + (y_array - y).square();
+}
+
+// true for the points within the squared distance and yaw thresholds, the yaw deviation is compared
+// through its cosine which is computed from the cosine and sine of the yaws
+Eigen::Array<bool, Eigen::Dynamic, 1> calcWithinThresholds(
+  const Eigen::ArrayXd & squared_dists, const std::vector<double> & cos_yaws,
+  const std::vector<double> & sin_yaws, const geometry_msgs::msg::Pose & pose,
+  const double max_squared_dist, const double max_yaw)
+{
+  if (max_yaw < 0.0) {
+    return Eigen::Array<bool, Eigen::Dynamic, 1>::Constant(squared_dists.size(), false);
+  }
+  if (tier4_autoware_utils::pi <= max_yaw) {
+    return squared_dists <= max_squared_dist;
+  }
+
+  const double yaw = tf2::getYaw(pose.orientation);
+  const Eigen::Map<const Eigen::ArrayXd> cos_array(cos_yaws.data(), cos_yaws.size());
+  const Eigen::Map<const Eigen::ArrayXd> sin_array(sin_yaws.data(), sin_yaws.size());
+  const Eigen::ArrayXd cos_yaw_deviations = cos_array * std::cos(yaw) + sin_array * std::sin(yaw);
+  return (squared_dists <= max_squared_dist) && (cos_yaw_deviations >= std::cos(max_yaw));
+}
+}  // namespace
+
+void TrajectoryView::clear()
+{
+  x_.clear();
+  y_.clear();
+  z_.clear();
+  yaw_.clear();
+  cos_yaw_.clear();
+  sin_yaw_.clear();
+  velocity_.clear();
+  arc_length_.clear();
+}
+
+void TrajectoryView::reserve(const size_t size)
+{
+  x_.reserve(size);
+  y_.reserve(size);
+  z_.reserve(size);
+  yaw_.reserve(size);
+  cos_yaw_.reserve(size);
+  sin_yaw_.reserve(size);
+  velocity_.reserve(size);
+  arc_length_.reserve(size);
+}
+
+void TrajectoryView::addPoint(const geometry_msgs::msg::Pose & pose, const double velocity)
+{
+  double arc_length = 0.0;
+  if (!empty()) {
+    arc_length =
+      arc_length_.back() + std::hypot(pose.position.x - x_.back(), pose.position.y - y_.back());
+  }
+  x_.push_back(pose.position.x);
+  y_.push_back(pose.position.y);
+  z_.push_back(pose.position.z);
+  yaw_.push_back(tf2::getYaw(pose.orientation));
+  cos_yaw_.push_back(std::cos(yaw_.back()));
+  sin_yaw_.push_back(std::sin(yaw_.back()));
+  velocity_.push_back(velocity);
+  arc_length_.push_back(arc_length);
+}
+
+size_t TrajectoryView::findNearestIndex(const geometry_msgs::msg::Point & point) const
+{
+  if (empty()) {
+    tier4_autoware_utils::print_backtrace();
+    throw std::invalid_argument("Points is empty.");
+  }
+
+  // minCoeff returns the first minimum as the loop in trajectory.hpp
+  Eigen::Index min_idx = 0;
+  calcSquaredDistances(x_, y_, point.x, point.y).minCoeff(&min_idx);
+  return static_cast<size_t>(min_idx);
+}
+
+boost::optional<size_t> TrajectoryView::findNearestIndex(
+  const geometry_msgs::msg::Pose & pose, const double max_dist, const double max_yaw) const
+{
+  if (empty()) {
+    std::cerr << "Points is empty." << std::endl;
+    return {};
+  }
+
+  const auto squared_dists = calcSquaredDistances(x_, y_, pose.position.x, pose.position.y);
+  const auto is_within_thresholds =
+    calcWithinThresholds(squared_dists, cos_yaw_, sin_yaw_, pose, max_dist * max_dist, max_yaw);
+
+  // the points out of the thresholds are never the minimum
+  Eigen::Index min_idx = 0;
+  const double min_squared_dist =
+    is_within_thresholds.select(squared_dists, std::numeric_limits<double>::infinity())
+      .minCoeff(&min_idx);
+  if (min_squared_dist == std::numeric_limits<double>::infinity()) {
+    return boost::none;
+  }
+  return static_cast<size_t>(min_idx);
+}
+
+boost::optional<size_t> TrajectoryView::findNearestIndexFromHint(
+  const geometry_msgs::msg::Pose & pose, const size_t hint_idx, const double max_dist,
+  const double max_yaw) const
+{
+  if (empty()) {
+    std::cerr << "Points is empty." << std::endl;
+    return {};
+  }
+
+  const auto calc_squared_dist = [&](const size_t idx) {
+    const double dx = x_.at(idx) - pose.position.x;
+    const double dy = y_.at(idx) - pose.position.y;
+    return dx * dx + dy * dy;
+  };
+
+  size_t min_idx = std::min(hint_idx, size() - 1);
+  double min_squared_dist = calc_squared_dist(min_idx);
+  // overlapping points are crossed forward, and the first one is returned after going back
+  while (min_idx + 1 < size() && calc_squared_dist(min_idx + 1) <= min_squared_dist) {
+    ++min_idx;
+    min_squared_dist = calc_squared_dist(min_idx);
+  }
+  while (0 < min_idx && calc_squared_dist(min_idx - 1) <= min_squared_dist) {
+    --min_idx;
+    min_squared_dist = calc_squared_dist(min_idx);
+  }
+
+  const double yaw_deviation =
+    tier4_autoware_utils::normalizeRadian(tf2::getYaw(pose.orientation) - yaw_.at(min_idx));
+  if (min_squared_dist <= max_dist * max_dist && std::fabs(yaw_deviation) <= max_yaw) {
+    return min_idx;
+  }
+  return findNearestIndex(pose, max_dist, max_yaw);
+}
+
+size_t TrajectoryView::findFirstNearestIndexWithSoftConstraints(
+  const geometry_msgs::msg::Pose & pose, const double dist_threshold,
+  const double yaw_threshold) const
+{
+  if (empty()) {
+    tier4_autoware_utils::print_backtrace();
+    throw std::invalid_argument("Points is empty.");
+  }
+
+  const auto squared_dists = calcSquaredDistances(x_, y_, pose.position.x, pose.position.y);
+  const double squared_dist_threshold = dist_threshold * dist_threshold;
+
+  // the nearest point in the first sequence of points within the thresholds
+  const auto find_first_nearest_index =
+    [&](const Eigen::Array<bool, Eigen::Dynamic, 1> & is_within_thresholds) {
+      boost::optional<size_t> min_idx;
+      for (size_t i = 0; i < size(); ++i) {
+        if (!is_within_thresholds(i)) {
+          if (min_idx) {
+            break;
+          }
+          continue;
+        }
+        if (!min_idx || squared_dists(i) < squared_dists(*min_idx)) {
+          min_idx = i;
+        }
+      }
+      return min_idx;
+    };
+
+  if (const auto min_idx = find_first_nearest_index(calcWithinThresholds(
+        squared_dists, cos_yaw_, sin_yaw_, pose, squared_dist_threshold, yaw_threshold))) {
+    return *min_idx;
+  }
+  if (const auto min_idx = find_first_nearest_index(squared_dists <= squared_dist_threshold)) {
+    return *min_idx;
+  }
+  return findNearestIndex(pose.position);
+}
+
+size_t TrajectoryView::findFirstNearestSegmentIndexWithSoftConstraints(
+  const geometry_msgs::msg::Pose & pose, const double dist_threshold,
+  const double yaw_threshold) const
+{
+  const size_t nearest_idx =
+    findFirstNearestIndexWithSoftConstraints(pose, dist_threshold, yaw_threshold);
+  return calcSegmentIndex(nearest_idx, pose.position);
+}
+
+size_t TrajectoryView::calcSegmentIndex(
+  const size_t nearest_idx, const geometry_msgs::msg::Point & point) const
+{
+  if (nearest_idx == 0) {
+    return 0;
+  }
+  if (nearest_idx == size() - 1) {
+    return size() - 2;
+  }
+
+  const double signed_length = calcLongitudinalOffsetToSegment(nearest_idx, point);
+
+  if (signed_length <= 0) {
+    return nearest_idx - 1;
+  }
+
+  return nearest_idx;
+}
+
+double TrajectoryView::calcLongitudinalOffsetToSegment(
+  const size_t seg_idx, const geometry_msgs::msg::Point & p_target,
+  const bool throw_exception) const
+{
+  const auto on_error = [&](const auto & e) {
+    tier4_autoware_utils::print_backtrace();
+    if (throw_exception) {
+      throw e;
+    }
+    std::cerr << e.what() << std::endl;
+    return std::nan("");
+  };
+
+  if (empty()) {
+    return on_error(std::invalid_argument("Points is empty."));
+  }
+  if (seg_idx >= size() - 1) {
+    return on_error(std::out_of_range("Segment index is invalid."));
+  }
+
+  // back point of the segment after removing the points overlapping with the front point
+  size_t back_idx = seg_idx + 1;
+  while (back_idx < size() &&
+         std::hypot(x_.at(back_idx) - x_.at(seg_idx), y_.at(back_idx) - y_.at(seg_idx)) <
+           overlap_eps) {
+    ++back_idx;
+  }
+  if (back_idx == size()) {
+    return on_error(std::runtime_error("Same points are given."));
+  }
+
+  const double segment_x = x_.at(back_idx) - x_.at(seg_idx);
+  const double segment_y = y_.at(back_idx) - y_.at(seg_idx);
+  const double target_x = p_target.x - x_.at(seg_idx);
+  const double target_y = p_target.y - y_.at(seg_idx);
+  return (segment_x * target_x + segment_y * target_y) / std::hypot(segment_x, segment_y);
+}
+
+size_t TrajectoryView::findNearestSegmentIndex(const geometry_msgs::msg::Point & point) const
+{
+  return calcSegmentIndex(findNearestIndex(point), point);
+}
+
+boost::optional<size_t> TrajectoryView::findNearestSegmentIndex(
+  const geometry_msgs::msg::Pose & pose, const double max_dist, const double max_yaw) const
+{
+  const auto nearest_idx = findNearestIndex(pose, max_dist, max_yaw);
+
+  if (!nearest_idx) {
+    return boost::none;
+  }
+  return calcSegmentIndex(*nearest_idx, pose.position);
+}
+
+double TrajectoryView::calcSignedArcLength(const size_t src_idx, const size_t dst_idx) const
+{
+  if (empty()) {
+    std::cerr << "Points is empty." << std::endl;
+    return 0.0;
+  }
+
+  return arc_length_.at(dst_idx) - arc_length_.at(src_idx);
+}
+
+double TrajectoryView::calcSignedArcLength(
+  const geometry_msgs::msg::Point & src_point, const size_t dst_idx) const
+{
+  if (empty()) {
+    std::cerr << "Points is empty." << std::endl;
+    return 0.0;
+  }
+
+  const size_t src_seg_idx = findNearestSegmentIndex(src_point);
+
+  const double signed_length_on_traj = calcSignedArcLength(src_seg_idx, dst_idx);
+  const double signed_length_src_offset = calcLongitudinalOffsetToSegment(src_seg_idx, src_point);
+
+  return signed_length_on_traj - signed_length_src_offset;
+}
+
+double TrajectoryView::calcSignedArcLength(
+  const size_t src_idx, const geometry_msgs::msg::Point & dst_point) const
+{
+  if (empty()) {
+    std::cerr << "Points is empty." << std::endl;
+    return 0.0;
+  }
+
+  return -calcSignedArcLength(dst_point, src_idx);
+}
+
+double TrajectoryView::calcSignedArcLength(
+  const geometry_msgs::msg::Point & src_point, const geometry_msgs::msg::Point & dst_point) const
+{
+  if (empty()) {
+    std::cerr << "Points is empty." << std::endl;
+    return 0.0;
+  }
+
+  const size_t src_seg_idx = findNearestSegmentIndex(src_point);
+  const size_t dst_seg_idx = findNearestSegmentIndex(dst_point);
+
+  const double signed_length_on_traj = calcSignedArcLength(src_seg_idx, dst_seg_idx);
+  const double signed_length_src_offset = calcLongitudinalOffsetToSegment(src_seg_idx, src_point);
+  const double signed_length_dst_offset = calcLongitudinalOffsetToSegment(dst_seg_idx, dst_point);
+
+  return signed_length_on_traj - signed_length_src_offset + signed_length_dst_offset;
+}
+
+double TrajectoryView::calcArcLength() const
+{
+  if (empty()) {
+    std::cerr << "Points is empty." << std::endl;
+    return 0.0;
+  }
+
+  return arc_length_.back();
+}
+
+boost::optional<size_t> TrajectoryView::findSegmentIndexFromArcLength(const double arc_length) const
+{
+  if (size() < 2) {
+    return {};
+  }
+
+  const auto itr = std::upper_bound(arc_length_.begin(), arc_length_.end(), arc_length);
+  const auto seg_idx =
+    static_cast<size_t>(std::max<std::ptrdiff_t>(std::distance(arc_length_.begin(), itr) - 1, 0));
+  return std::min(seg_idx, size() - 2);
+}
+
+boost::optional<geometry_msgs::msg::Point> TrajectoryView::calcPointFromArcLength(
+  const double arc_length) const
+{
+  const auto seg_idx = findSegmentIndexFromArcLength(arc_length);
+  if (!seg_idx) {
+    return {};
+  }
+
+  const double clamped_arc_length = std::clamp(arc_length, 0.0, arc_length_.back());
+  const double segment_length = arc_length_.at(*seg_idx + 1) - arc_length_.at(*seg_idx);
+  const double ratio = segment_length < overlap_eps
+                         ? 0.0
+                         : (clamped_arc_length - arc_length_.at(*seg_idx)) / segment_length;
+
+  const auto lerp = [&](const std::vector<double> & values) {
+    return values.at(*seg_idx) + ratio * (values.at(*seg_idx + 1) - values.at(*seg_idx));
+  };
+  geometry_msgs::msg::Point point;
+  point.x = lerp(x_);
+  point.y = lerp(y_);
+  point.z = lerp(z_);
+  return point;
+}
+}  // namespace motion_utils
@@ -0,0 +1,165 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "interpolation/linear_interpolation.hpp"
+#include "interpolation/zero_order_hold.hpp"
+#include "motion_utils/resample/resample.hpp"
+#include "motion_utils/resample/resample_plan.hpp"
+#include "motion_utils/trajectory/trajectory.hpp"
+#include "tier4_autoware_utils/geometry/geometry.hpp"
+
+#include <gtest/gtest.h>
+#include <tf2/utils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+using autoware_auto_planning_msgs::msg::Trajectory;
+using autoware_auto_planning_msgs::msg::TrajectoryPoint;
+
+constexpr double epsilon = 1e-6;
+
+// non-uniform arc length with a point slightly before the next one
+const std::vector<double> input_arclength{0.0, 0.5, 1.7, 1.7005, 3.0, 4.2, 6.0, 6.0008};
+
+std::vector<double> generateResampledArclength()
+{
+  std::vector<double> resampled_arclength;
+  for (double s = 0.0; s < input_arclength.back(); s += 0.1) {
+    resampled_arclength.push_back(s);
+  }
+  for (size_t i = 1; i < input_arclength.size(); ++i) {
+    resampled_arclength.push_back(input_arclength.at(i));
+    resampled_arclength.push_back(input_arclength.at(i) - 5e-4);
+  }
+  std::sort(resampled_arclength.begin(), resampled_arclength.end());
+  return resampled_arclength;
+}
+
+Trajectory generateTestTrajectory(const size_t num_points, const double interval)
+{
+  Trajectory traj;
+  for (size_t i = 0; i < num_points; ++i) {
+    const double theta = 0.05 * i;
+    TrajectoryPoint p;
+    p.pose.position = tier4_autoware_utils::createPoint(
+      10.0 * std::sin(theta), 10.0 * (1.0 - std::cos(theta)), 0.1 * i);
+    p.pose.orientation = tier4_autoware_utils::createQuaternionFromYaw(theta);
+    p.longitudinal_velocity_mps = 3.0 + 0.5 * i;
+    p.lateral_velocity_mps = 0.1 * i;
+    p.heading_rate_rps = 0.01 * i;
+    p.acceleration_mps2 = -0.2 * i;
+    p.front_wheel_angle_rad = 0.02 * i;
+    p.rear_wheel_angle_rad = -0.01 * i;
+    p.time_from_start = rclcpp::Duration::from_seconds(interval * i);
+    traj.points.push_back(p);
+  }
+  return traj;
+}
+}  // namespace
+
+TEST(resample_plan, sameResultsAsInterpolation)
+{
+  const auto resampled_arclength = generateResampledArclength();
+
+  std::vector<double> values;
+  for (size_t i = 0; i < input_arclength.size(); ++i) {
+    values.push_back(std::cos(static_cast<double>(i)) * 3.0);
+  }
+
+  const motion_utils::ResamplePlan plan(input_arclength, resampled_arclength);
+  ASSERT_EQ(plan.size(), resampled_arclength.size());
+
+  std::vector<double> lerp_values;
+  plan.lerp(values, lerp_values);
+  const auto lerp_ans = interpolation::lerp(input_arclength, values, resampled_arclength);
+  ASSERT_EQ(lerp_values.size(), lerp_ans.size());
+  for (size_t i = 0; i < lerp_ans.size(); ++i) {
+    EXPECT_NEAR(lerp_values.at(i), lerp_ans.at(i), epsilon);
+  }
+
+  std::vector<double> zoh_values;
+  plan.zeroOrderHold(values, zoh_values);
+  const auto closest_segment_indices =
+    interpolation::calc_closest_segment_indices(input_arclength, resampled_arclength);
+  EXPECT_EQ(plan.closestSegmentIndices(), closest_segment_indices);
+  const auto zoh_ans = interpolation::zero_order_hold(input_arclength, values, resampled_arclength);
+  ASSERT_EQ(zoh_values.size(), zoh_ans.size());
+  for (size_t i = 0; i < zoh_ans.size(); ++i) {
+    EXPECT_DOUBLE_EQ(zoh_values.at(i), zoh_ans.at(i));
+  }
+
+  // resampled arc length slightly out of the input arc length
+  auto out_of_range_arclength = resampled_arclength;
+  out_of_range_arclength.front() -= 1e-4;
+  out_of_range_arclength.back() += 1e-4;
+  motion_utils::ResamplePlan reused_plan;
+  reused_plan.update(input_arclength, out_of_range_arclength);
+  EXPECT_EQ(reused_plan.segmentIndices(), plan.segmentIndices());
+  EXPECT_EQ(reused_plan.ratios(), plan.ratios());
+  EXPECT_EQ(reused_plan.closestSegmentIndices(), plan.closestSegmentIndices());
+
+  EXPECT_THROW(
+    motion_utils::ResamplePlan(input_arclength, {0.0, input_arclength.back() + 1.0}),
+    std::invalid_argument);
+  EXPECT_THROW(motion_utils::ResamplePlan(input_arclength, {1.0, 0.0}), std::invalid_argument);
+}
+
+TEST(resample_plan, resampleTrajectoryArrays)
+{
+  using motion_utils::resampleTrajectory;
+
+  const auto traj = generateTestTrajectory(20, 0.5);
+  const double length = motion_utils::calcArcLength(traj.points);
+  std::vector<double> resampled_arclength;
+  for (double s = 0.0; s < length; s += 0.7) {
+    resampled_arclength.push_back(s);
+  }
+  resampled_arclength.push_back(length);
+
+  for (const bool use_zero_order_hold_for_twist : {true, false}) {
+    const auto ans =
+      resampleTrajectory(traj, resampled_arclength, false, true, use_zero_order_hold_for_twist);
+
+    motion_utils::TrajectoryArrays resampled_traj;
+    ASSERT_TRUE(resampleTrajectory(
+      traj, resampled_arclength, resampled_traj, false, true, use_zero_order_hold_for_twist));
+    ASSERT_EQ(resampled_traj.size(), ans.points.size());
+    for (size_t i = 0; i < ans.points.size(); ++i) {
+      const auto & p = ans.points.at(i);
+      EXPECT_NEAR(resampled_traj.x.at(i), p.pose.position.x, epsilon);
+      EXPECT_NEAR(resampled_traj.y.at(i), p.pose.position.y, epsilon);
+      EXPECT_NEAR(resampled_traj.z.at(i), p.pose.position.z, epsilon);
+      EXPECT_NEAR(resampled_traj.yaw.at(i), tf2::getYaw(p.pose.orientation), epsilon);
+      EXPECT_NEAR(
+        resampled_traj.longitudinal_velocity_mps.at(i), p.longitudinal_velocity_mps, epsilon);
+      EXPECT_NEAR(resampled_traj.lateral_velocity_mps.at(i), p.lateral_velocity_mps, epsilon);
+      EXPECT_NEAR(resampled_traj.heading_rate_rps.at(i), p.heading_rate_rps, epsilon);
+      EXPECT_NEAR(resampled_traj.acceleration_mps2.at(i), p.acceleration_mps2, epsilon);
+      EXPECT_NEAR(resampled_traj.front_wheel_angle_rad.at(i), p.front_wheel_angle_rad, epsilon);
+      EXPECT_NEAR(resampled_traj.rear_wheel_angle_rad.at(i), p.rear_wheel_angle_rad, epsilon);
+      EXPECT_NEAR(
+        resampled_traj.time_from_start.at(i), rclcpp::Duration(p.time_from_start).seconds(),
+        epsilon);
+    }
+  }
+
+  // invalid arguments
+  motion_utils::TrajectoryArrays resampled_traj;
+  EXPECT_FALSE(resampleTrajectory(traj, {0.0, length + 1.0}, resampled_traj));
+  EXPECT_EQ(resampled_traj.size(), 0U);
+}
@@ -22,6 +22,7 @@
 #include <gtest/internal/gtest-port.h>
 #include <tf2/LinearMath/Quaternion.h>
 
+#include <cmath>
 #include <limits>
 #include <vector>
 
@@ -662,3 +663,71 @@ TEST(Interpolation, interpolate_points_with_length)
     EXPECT_NEAR(result.orientation.w, 1.0, epsilon);
   }
 }
+
+TEST(Interpolation, interpolate_points_with_length_cursor)
+{
+  using motion_utils::calcInterpolatedPose;
+  using motion_utils::InterpolatedPoseCursor;
+
+  const auto expect_pose_near = [](const auto & result, const auto & expected) {
+    EXPECT_NEAR(result.position.x, expected.position.x, epsilon);
+    EXPECT_NEAR(result.position.y, expected.position.y, epsilon);
+    EXPECT_NEAR(result.position.z, expected.position.z, epsilon);
+    EXPECT_NEAR(result.orientation.x, expected.orientation.x, epsilon);
+    EXPECT_NEAR(result.orientation.y, expected.orientation.y, epsilon);
+    EXPECT_NEAR(result.orientation.z, expected.orientation.z, epsilon);
+    EXPECT_NEAR(result.orientation.w, expected.orientation.w, epsilon);
+  };
+
+  Trajectory traj;
+  for (size_t i = 0; i < 10; ++i) {
+    const double yaw = i * 0.1;
+    traj.points.push_back(
+      generateTestTrajectoryPoint(10.0 * std::sin(yaw), 10.0 * (1.0 - std::cos(yaw)), 0.0, yaw));
+  }
+  const double arc_length = motion_utils::calcArcLength(traj.points);
+
+  // increasing lengths
+  {
+    InterpolatedPoseCursor cursor(traj.points);
+    for (double length = -1.0; length < arc_length + 1.0; length += 0.3) {
+      expect_pose_near(
+        cursor.calcInterpolatedPose(length), calcInterpolatedPose(traj.points, length));
+    }
+    EXPECT_EQ(cursor.getSegmentIndex(), traj.points.size() - 1);
+  }
+
+  // decreasing lengths restart from the front point
+  {
+    InterpolatedPoseCursor cursor(traj.points);
+    for (double length = arc_length + 1.0; length > -1.0; length -= 0.7) {
+      expect_pose_near(
+        cursor.calcInterpolatedPose(length), calcInterpolatedPose(traj.points, length));
+    }
+  }
+
+  // the same length as the points
+  {
+    InterpolatedPoseCursor cursor(traj.points);
+    expect_pose_near(cursor.calcInterpolatedPose(3.0), calcInterpolatedPose(traj.points, 3.0));
+    expect_pose_near(cursor.calcInterpolatedPose(3.0), calcInterpolatedPose(traj.points, 3.0));
+    cursor.reset();
+    EXPECT_EQ(cursor.getSegmentIndex(), 0U);
+    expect_pose_near(cursor.calcInterpolatedPose(0.0), traj.points.front().pose);
+  }
+
+  // one point
+  {
+    Trajectory one_point_traj;
+    one_point_traj.points.push_back(generateTestTrajectoryPoint(1.0, 0.0, 0.0));
+    InterpolatedPoseCursor cursor(one_point_traj.points);
+    expect_pose_near(cursor.calcInterpolatedPose(2.0), one_point_traj.points.front().pose);
+  }
+
+  // Empty Point
+  {
+    const Trajectory empty_traj;
+    InterpolatedPoseCursor cursor(empty_traj.points);
+    expect_pose_near(cursor.calcInterpolatedPose(2.0), geometry_msgs::msg::Pose{});
+  }
+}
@@ -0,0 +1,220 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "motion_utils/trajectory/trajectory.hpp"
+#include "motion_utils/trajectory/trajectory_view.hpp"
+#include "tier4_autoware_utils/math/unit_conversion.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+using autoware_auto_planning_msgs::msg::TrajectoryPoint;
+using tier4_autoware_utils::createPoint;
+using tier4_autoware_utils::createQuaternionFromYaw;
+using TrajectoryPointArray = std::vector<TrajectoryPoint>;
+
+constexpr double epsilon = 1e-6;
+
+// points along an arc, with some overlapping points
+TrajectoryPointArray generateTestTrajectoryPointArray()
+{
+  TrajectoryPointArray traj;
+  double x = 0.0;
+  double y = 0.0;
+  double yaw = 0.0;
+  for (size_t i = 0; i < 50; ++i) {
+    TrajectoryPoint p;
+    p.pose.position = createPoint(x, y, 0.1 * i);
+    p.pose.orientation = createQuaternionFromYaw(yaw);
+    p.longitudinal_velocity_mps = static_cast<double>(i);
+    traj.push_back(p);
+    if (i % 10 == 5) {
+      traj.push_back(p);
+    }
+
+    x += std::cos(yaw);
+    y += std::sin(yaw);
+    yaw += 0.05;
+  }
+  return traj;
+}
+
+geometry_msgs::msg::Pose createPose(const double x, const double y, const double yaw)
+{
+  geometry_msgs::msg::Pose pose;
+  pose.position = createPoint(x, y, 0.0);
+  pose.orientation = createQuaternionFromYaw(yaw);
+  return pose;
+}
+}  // namespace
+
+TEST(trajectory_view, build)
+{
+  const auto traj = generateTestTrajectoryPointArray();
+  const motion_utils::TrajectoryView view(traj);
+
+  ASSERT_EQ(view.size(), traj.size());
+  for (size_t i = 0; i < traj.size(); ++i) {
+    EXPECT_DOUBLE_EQ(view.x().at(i), traj.at(i).pose.position.x);
+    EXPECT_DOUBLE_EQ(view.y().at(i), traj.at(i).pose.position.y);
+    EXPECT_DOUBLE_EQ(view.z().at(i), traj.at(i).pose.position.z);
+    EXPECT_NEAR(view.yaw().at(i), tier4_autoware_utils::getRPY(traj.at(i).pose).z, epsilon);
+    EXPECT_DOUBLE_EQ(view.velocity().at(i), traj.at(i).longitudinal_velocity_mps);
+    EXPECT_NEAR(view.arcLength().at(i), motion_utils::calcSignedArcLength(traj, 0, i), epsilon);
+  }
+  EXPECT_NEAR(view.calcArcLength(), motion_utils::calcArcLength(traj), epsilon);
+
+  EXPECT_TRUE(motion_utils::TrajectoryView{}.empty());
+  EXPECT_THROW(
+    motion_utils::TrajectoryView{}.findNearestIndex(createPoint(0.0, 0.0, 0.0)),
+    std::invalid_argument);
+}
+
+TEST(trajectory_view, sameResultsAsTrajectoryFunctions)
+{
+  using motion_utils::calcLongitudinalOffsetToSegment;
+  using motion_utils::calcSignedArcLength;
+  using motion_utils::findNearestIndex;
+  using motion_utils::findNearestSegmentIndex;
+
+  const auto traj = generateTestTrajectoryPointArray();
+  const motion_utils::TrajectoryView view(traj);
+
+  const double max_dist = 3.0;
+  const double max_yaw = tier4_autoware_utils::deg2rad(45.0);
+  for (double x = -5.0; x < 45.0; x += 1.3) {
+    for (double y = -5.0; y < 25.0; y += 1.7) {
+      const auto point = createPoint(x, y, 0.0);
+      const auto pose = createPose(x, y, 0.02 * x);
+
+      EXPECT_EQ(view.findNearestIndex(point), findNearestIndex(traj, point));
+      EXPECT_EQ(
+        view.findNearestIndex(pose, max_dist, max_yaw),
+        findNearestIndex(traj, pose, max_dist, max_yaw));
+      EXPECT_EQ(view.findNearestSegmentIndex(point), findNearestSegmentIndex(traj, point));
+      EXPECT_EQ(
+        view.findNearestSegmentIndex(pose, max_dist, max_yaw),
+        findNearestSegmentIndex(traj, pose, max_dist, max_yaw));
+
+      const auto seg_idx = findNearestSegmentIndex(traj, point);
+      EXPECT_NEAR(
+        view.calcLongitudinalOffsetToSegment(seg_idx, point),
+        calcLongitudinalOffsetToSegment(traj, seg_idx, point), epsilon);
+
+      const auto dst_point = createPoint(y, x, 0.0);
+      EXPECT_NEAR(
+        view.calcSignedArcLength(point, 10), calcSignedArcLength(traj, point, 10), epsilon);
+      EXPECT_NEAR(
+        view.calcSignedArcLength(10, point), calcSignedArcLength(traj, 10, point), epsilon);
+      EXPECT_NEAR(
+        view.calcSignedArcLength(point, dst_point), calcSignedArcLength(traj, point, dst_point),
+        epsilon);
+    }
+  }
+
+  EXPECT_NEAR(view.calcSignedArcLength(30, 3), calcSignedArcLength(traj, 30, 3), epsilon);
+
+  // overlapping points
+  EXPECT_NEAR(
+    view.calcLongitudinalOffsetToSegment(5, createPoint(7.0, 1.0, 0.0)),
+    calcLongitudinalOffsetToSegment(traj, 5, createPoint(7.0, 1.0, 0.0)), epsilon);
+  EXPECT_TRUE(
+    std::isnan(view.calcLongitudinalOffsetToSegment(traj.size(), createPoint(0.0, 0.0, 0.0))));
+}
+
+TEST(trajectory_view, arcLengthQueries)
+{
+  const auto traj = generateTestTrajectoryPointArray();
+  const motion_utils::TrajectoryView view(traj);
+
+  EXPECT_EQ(*view.findSegmentIndexFromArcLength(-1.0), 0U);
+  EXPECT_EQ(*view.findSegmentIndexFromArcLength(0.0), 0U);
+  EXPECT_EQ(*view.findSegmentIndexFromArcLength(1e6), traj.size() - 2);
+  for (size_t i = 0; i + 1 < view.size(); ++i) {
+    const double arc_length = 0.5 * (view.arcLength().at(i) + view.arcLength().at(i + 1));
+    if (view.arcLength().at(i + 1) - view.arcLength().at(i) < epsilon) {
+      continue;
+    }
+    EXPECT_EQ(*view.findSegmentIndexFromArcLength(arc_length), i);
+
+    const auto point = view.calcPointFromArcLength(arc_length);
+    ASSERT_TRUE(point);
+    EXPECT_NEAR(point->x, 0.5 * (view.x().at(i) + view.x().at(i + 1)), epsilon);
+    EXPECT_NEAR(point->y, 0.5 * (view.y().at(i) + view.y().at(i + 1)), epsilon);
+    EXPECT_NEAR(point->z, 0.5 * (view.z().at(i) + view.z().at(i + 1)), epsilon);
+  }
+
+  const auto back_point = view.calcPointFromArcLength(1e6);
+  ASSERT_TRUE(back_point);
+  EXPECT_NEAR(back_point->x, view.x().back(), epsilon);
+  EXPECT_NEAR(back_point->y, view.y().back(), epsilon);
+
+  motion_utils::TrajectoryView single_point_view(TrajectoryPointArray(1));
+  EXPECT_FALSE(single_point_view.findSegmentIndexFromArcLength(0.0));
+  EXPECT_FALSE(single_point_view.calcPointFromArcLength(0.0));
+}
+
+TEST(trajectory_view, softConstraintsAndHint)
+{
+  using motion_utils::findFirstNearestIndexWithSoftConstraints;
+  using motion_utils::findFirstNearestSegmentIndexWithSoftConstraints;
+  using motion_utils::findNearestIndex;
+
+  const auto traj = generateTestTrajectoryPointArray();
+  const motion_utils::TrajectoryView view(traj);
+
+  for (const double dist_threshold : {0.5, 3.0, std::numeric_limits<double>::max()}) {
+    // away from the yaw deviations of the test poses, which are multiples of 0.002 [rad]
+    for (const double yaw_threshold : {0.123, 0.987, std::numeric_limits<double>::max()}) {
+      for (double x = -5.0; x < 45.0; x += 1.3) {
+        for (double y = -5.0; y < 25.0; y += 1.7) {
+          const auto pose = createPose(x, y, 0.02 * x);
+          EXPECT_EQ(
+            view.findFirstNearestIndexWithSoftConstraints(pose, dist_threshold, yaw_threshold),
+            findFirstNearestIndexWithSoftConstraints(traj, pose, dist_threshold, yaw_threshold));
+          EXPECT_EQ(
+            view.findFirstNearestSegmentIndexWithSoftConstraints(
+              pose, dist_threshold, yaw_threshold),
+            findFirstNearestSegmentIndexWithSoftConstraints(
+              traj, pose, dist_threshold, yaw_threshold));
+          EXPECT_EQ(
+            view.findNearestIndex(pose, dist_threshold, yaw_threshold),
+            findNearestIndex(traj, pose, dist_threshold, yaw_threshold));
+        }
+      }
+    }
+  }
+  EXPECT_THROW(
+    motion_utils::TrajectoryView{}.findFirstNearestIndexWithSoftConstraints(createPose(0, 0, 0)),
+    std::invalid_argument);
+
+  // the hint gives the same result on a trajectory which does not come back close to itself
+  for (size_t i = 0; i < view.size(); ++i) {
+    const auto pose = createPose(view.x().at(i) + 0.1, view.y().at(i) - 0.1, view.yaw().at(i));
+    const auto nearest_idx = view.findNearestIndex(pose, 3.0, 1.0);
+    for (const size_t hint_idx : {size_t{0}, i / 2, i, i + 3, view.size() + 10}) {
+      EXPECT_EQ(view.findNearestIndexFromHint(pose, hint_idx, 3.0, 1.0), nearest_idx);
+    }
+  }
+
+  // fall back to the whole search when the local minimum is out of the thresholds
+  const auto opposite_pose = createPose(view.x().at(40), view.y().at(40), view.yaw().at(40) + M_PI);
+  EXPECT_FALSE(view.findNearestIndexFromHint(opposite_pose, 0, 1.0, 1.0));
+  EXPECT_FALSE(view.findNearestIndexFromHint(createPose(1e3, 1e3, 0.0), 0, 1.0, 1.0));
+}
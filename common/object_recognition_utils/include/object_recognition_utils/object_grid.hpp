@@ -0,0 +1,107 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OBJECT_RECOGNITION_UTILS__OBJECT_GRID_HPP_
+#define OBJECT_RECOGNITION_UTILS__OBJECT_GRID_HPP_
+
+#include "object_recognition_utils/geometry.hpp"
+
+#include <geometry_msgs/msg/point.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace object_recognition_utils
+{
+/**
+ * @brief objects bucketed by their 2D position in square cells
+ * @details The candidates of a position are the objects in its own and neighboring cells, so they
+ * include every object closer than the cell size. This is used to gate the association by
+ * distance without evaluating all the pairs. Objects with a non-finite position are candidates
+ * of every position, and every object is a candidate of a non-finite position.
+ */
+class ObjectGrid
+{
+public:
+  template <class T>
+  ObjectGrid(const std::vector<T> & objects, const double cell_size)
+  : inverse_cell_size_(1.0 / cell_size), nb_objects_(objects.size())
+  {
+    for (size_t object_idx = 0; object_idx < nb_objects_; ++object_idx) {
+      const auto cell = getCell(getPose(objects.at(object_idx)).position);
+      if (cell) {
+        cells_[getKey(cell->first, cell->second)].push_back(object_idx);
+      } else {
+        non_finite_object_indices_.push_back(object_idx);
+      }
+    }
+  }
+
+  /**
+   * @brief get the indices of the objects which can be closer than the cell size to the position
+   * @param [in] position position to search around
+   * @param [out] candidates indices of the objects
+   */
+  void getCandidates(
+    const geometry_msgs::msg::Point & position, std::vector<size_t> & candidates) const
+  {
+    candidates = non_finite_object_indices_;
+    const auto cell = getCell(position);
+    if (!cell) {
+      candidates.resize(nb_objects_);
+      std::iota(candidates.begin(), candidates.end(), 0);
+      return;
+    }
+    for (int64_t x = cell->first - 1; x <= cell->first + 1; ++x) {
+      for (int64_t y = cell->second - 1; y <= cell->second + 1; ++y) {
+        const auto cell_itr = cells_.find(getKey(x, y));
+        if (cell_itr != cells_.end()) {
+          candidates.insert(candidates.end(), cell_itr->second.begin(), cell_itr->second.end());
+        }
+      }
+    }
+  }
+
+private:
+  std::optional<std::pair<int64_t, int64_t>> getCell(const geometry_msgs::msg::Point & p) const
+  {
+    const double x = std::floor(p.x * inverse_cell_size_);
+    const double y = std::floor(p.y * inverse_cell_size_);
+    // far enough from the int64_t limits to also look up the neighboring cells
+    constexpr double max_cell = 1e15;
+    if (!(std::fabs(x) < max_cell && std::fabs(y) < max_cell)) {
+      return std::nullopt;
+    }
+    return std::make_pair(static_cast<int64_t>(x), static_cast<int64_t>(y));
+  }
+
+  // cells sharing a key are merged, which only adds candidates
+  static uint64_t getKey(const int64_t x, const int64_t y)
+  {
+    return (static_cast<uint64_t>(x) << 32) ^ static_cast<uint64_t>(static_cast<uint32_t>(y));
+  }
+
+  double inverse_cell_size_;
+  size_t nb_objects_;
+  std::unordered_map<uint64_t, std::vector<size_t>> cells_;
+  std::vector<size_t> non_finite_object_indices_;
+};
+}  // namespace object_recognition_utils
+
+#endif  // OBJECT_RECOGNITION_UTILS__OBJECT_GRID_HPP_
@@ -19,6 +19,7 @@
 #include "object_recognition_utils/geometry.hpp"
 #include "object_recognition_utils/matching.hpp"
 #include "object_recognition_utils/object_classification.hpp"
+#include "object_recognition_utils/object_grid.hpp"
 #include "object_recognition_utils/predicted_path_utils.hpp"
 #include "object_recognition_utils/transform.hpp"
 
@@ -35,6 +35,7 @@
 #endif
 
 #include <string>
+#include <utility>
 
 namespace detail
 {
@@ -136,7 +137,7 @@ bool transformObjectsWithFeature(
       sensor_msgs::msg::PointCloud2 transformed_cluster;
       pcl_ros::transformPointCloud(*tf_matrix, feature_object.feature.cluster, transformed_cluster);
       transformed_cluster.header.frame_id = target_frame_id;
-      feature_object.feature.cluster = transformed_cluster;
+      feature_object.feature.cluster = std::move(transformed_cluster);
     }
     output_msg.header.frame_id = target_frame_id;
     return true;
@@ -0,0 +1,89 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "object_recognition_utils/object_grid.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+geometry_msgs::msg::Pose createPose(const double x, const double y)
+{
+  geometry_msgs::msg::Pose p;
+  p.position.x = x;
+  p.position.y = y;
+  return p;
+}
+}  // namespace
+
+TEST(object_grid, getCandidates)
+{
+  using object_recognition_utils::ObjectGrid;
+
+  const double cell_size = 2.0;
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> dist(-20.0, 20.0);
+  std::vector<geometry_msgs::msg::Pose> objects;
+  for (size_t i = 0; i < 200; ++i) {
+    objects.push_back(createPose(dist(engine), dist(engine)));
+  }
+  const ObjectGrid grid(objects, cell_size);
+
+  // every object closer than the cell size is a candidate
+  std::vector<size_t> candidates;
+  for (size_t i = 0; i < 100; ++i) {
+    const auto query = createPose(dist(engine), dist(engine));
+    grid.getCandidates(query.position, candidates);
+    for (size_t object_idx = 0; object_idx < objects.size(); ++object_idx) {
+      const auto & p = objects.at(object_idx).position;
+      if (std::hypot(p.x - query.position.x, p.y - query.position.y) <= cell_size) {
+        EXPECT_NE(
+          std::find(candidates.begin(), candidates.end(), object_idx), candidates.end());
+      }
+    }
+    EXPECT_LT(candidates.size(), objects.size());
+  }
+}
+
+TEST(object_grid, getCandidatesNonFinite)
+{
+  using object_recognition_utils::ObjectGrid;
+
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const std::vector<geometry_msgs::msg::Pose> objects = {
+    createPose(0.0, 0.0), createPose(100.0, 100.0), createPose(nan, 0.0)};
+  const ObjectGrid grid(objects, 1.0);
+
+  // the object with a non-finite position is a candidate of every position
+  std::vector<size_t> candidates;
+  grid.getCandidates(createPose(0.5, 0.5).position, candidates);
+  std::sort(candidates.begin(), candidates.end());
+  EXPECT_EQ(candidates, (std::vector<size_t>{0, 2}));
+
+  // every object is a candidate of a non-finite position
+  grid.getCandidates(createPose(0.0, std::numeric_limits<double>::infinity()).position, candidates);
+  std::sort(candidates.begin(), candidates.end());
+  EXPECT_EQ(candidates, (std::vector<size_t>{0, 1, 2}));
+
+  // an empty grid has no candidates
+  const ObjectGrid empty_grid(std::vector<geometry_msgs::msg::Pose>{}, 1.0);
+  empty_grid.getCandidates(createPose(0.0, 0.0).position, candidates);
+  EXPECT_TRUE(candidates.empty());
+}
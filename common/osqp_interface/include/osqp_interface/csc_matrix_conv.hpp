@@ -19,6 +19,7 @@
 #include "osqp_interface/visibility_control.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <vector>
 
@@ -43,6 +44,19 @@ struct OSQP_INTERFACE_PUBLIC CSC_Matrix
 OSQP_INTERFACE_PUBLIC CSC_Matrix calCSCMatrix(const Eigen::MatrixXd & mat);
 /// \brief Calculate upper trapezoidal CSC matrix from square Eigen matrix
 OSQP_INTERFACE_PUBLIC CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::MatrixXd & mat);
+/// \brief Calculate CSC matrix from Eigen sparse matrix
+/// \details Unlike the dense version, the stored elements are kept even if their value is zero, so
+/// that the sparsity pattern only depends on the structure of the problem.
+OSQP_INTERFACE_PUBLIC CSC_Matrix calCSCMatrix(const Eigen::SparseMatrix<double> & mat);
+/// \brief Calculate upper trapezoidal CSC matrix from square Eigen sparse matrix
+OSQP_INTERFACE_PUBLIC CSC_Matrix
+calCSCMatrixTrapezoidal(const Eigen::SparseMatrix<double> & mat);
+/// \brief Calculate CSC matrix from triplets, the values of duplicated triplets are summed up
+OSQP_INTERFACE_PUBLIC CSC_Matrix calCSCMatrix(
+  const Eigen::Index rows, const Eigen::Index cols,
+  const std::vector<Eigen::Triplet<double>> & triplets);
+/// \brief Check if the given CSC matrices have the same sparsity pattern
+OSQP_INTERFACE_PUBLIC bool hasSameSparsity(const CSC_Matrix & mat1, const CSC_Matrix & mat2);
 /// \brief Print the given CSC matrix to the standard output
 OSQP_INTERFACE_PUBLIC void printCSCMatrix(const CSC_Matrix & csc_mat);
 
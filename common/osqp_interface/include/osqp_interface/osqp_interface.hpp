@@ -20,6 +20,7 @@
 #include "osqp_interface/visibility_control.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 #include <rclcpp/rclcpp.hpp>
 
 #include <limits>
@@ -54,6 +55,9 @@ private:
   bool m_work_initialized = false;
   // Exitflag
   int64_t m_exitflag;
+  // Matrices of the current work, only their sparsity patterns are kept up to date
+  CSC_Matrix m_P_csc;
+  CSC_Matrix m_A_csc;
 
   // Runs the solver on the stored problem.
   std::tuple<std::vector<double>, std::vector<double>, int64_t, int64_t, int64_t> solve();
@@ -77,6 +81,10 @@ public:
   OSQPInterface(
     const CSC_Matrix & P, const CSC_Matrix & A, const std::vector<double> & q,
     const std::vector<double> & l, const std::vector<double> & u, const c_float eps_abs);
+  OSQPInterface(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u,
+    const c_float eps_abs);
   ~OSQPInterface();
 
   /****************
@@ -134,6 +142,11 @@ public:
   int64_t initializeProblem(
     CSC_Matrix P, CSC_Matrix A, const std::vector<double> & q, const std::vector<double> & l,
     const std::vector<double> & u);
+  /// \details Only the upper triangular part of P is used, and the stored zeros of P and A are
+  /// kept so that the matrices can be updated as long as their structure is unchanged.
+  int64_t initializeProblem(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u);
 
   // Setter functions for warm start
   bool setWarmStart(
@@ -149,10 +162,15 @@ public:
   //   q_new: (n) vector defining the linear cost of the problem.
   //   l_new: (m) vector defining the lower bound problem constraint.
   //   u_new: (m) vector defining the upper bound problem constraint.
-  void updateP(const Eigen::MatrixXd & P_new);
-  void updateCscP(const CSC_Matrix & P_csc);
-  void updateA(const Eigen::MatrixXd & A_new);
-  void updateCscA(const CSC_Matrix & A_csc);
+  //
+  // The matrices are updated only if their sparsity pattern is the same as in the current work,
+  // otherwise false is returned and the problem has to be initialized again.
+  bool updateP(const Eigen::MatrixXd & P_new);
+  bool updateP(const Eigen::SparseMatrix<double> & P_new);
+  bool updateCscP(const CSC_Matrix & P_csc);
+  bool updateA(const Eigen::MatrixXd & A_new);
+  bool updateA(const Eigen::SparseMatrix<double> & A_new);
+  bool updateCscA(const CSC_Matrix & A_csc);
   void updateQ(const std::vector<double> & q_new);
   void updateL(const std::vector<double> & l_new);
   void updateU(const std::vector<double> & u_new);
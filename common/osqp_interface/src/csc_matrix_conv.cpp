@@ -115,6 +115,67 @@ CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::MatrixXd & mat)
   return csc_matrix;
 }
 
+CSC_Matrix calCSCMatrix(const Eigen::SparseMatrix<double> & mat)
+{
+  const size_t elem = static_cast<size_t>(mat.nonZeros());
+
+  CSC_Matrix csc_matrix;
+  csc_matrix.m_vals.reserve(elem);
+  csc_matrix.m_row_idxs.reserve(elem);
+  csc_matrix.m_col_idxs.reserve(mat.cols() + 1);
+
+  csc_matrix.m_col_idxs.push_back(0);
+  for (Eigen::Index j = 0; j < mat.cols(); j++) {  // col iteration
+    for (Eigen::SparseMatrix<double>::InnerIterator it(mat, j); it; ++it) {
+      csc_matrix.m_vals.push_back(it.value());
+      csc_matrix.m_row_idxs.push_back(it.row());
+    }
+    csc_matrix.m_col_idxs.push_back(static_cast<c_int>(csc_matrix.m_vals.size()));
+  }
+
+  return csc_matrix;
+}
+
+CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::SparseMatrix<double> & mat)
+{
+  if (mat.rows() != mat.cols()) {
+    throw std::invalid_argument("Matrix must be square (n, n)");
+  }
+
+  const size_t elem = static_cast<size_t>(mat.nonZeros());
+
+  CSC_Matrix csc_matrix;
+  csc_matrix.m_vals.reserve(elem);
+  csc_matrix.m_row_idxs.reserve(elem);
+  csc_matrix.m_col_idxs.reserve(mat.cols() + 1);
+
+  csc_matrix.m_col_idxs.push_back(0);
+  for (Eigen::Index j = 0; j < mat.cols(); j++) {  // col iteration
+    // the row indices are sorted in each column
+    for (Eigen::SparseMatrix<double>::InnerIterator it(mat, j); it && it.row() <= j; ++it) {
+      csc_matrix.m_vals.push_back(it.value());
+      csc_matrix.m_row_idxs.push_back(it.row());
+    }
+    csc_matrix.m_col_idxs.push_back(static_cast<c_int>(csc_matrix.m_vals.size()));
+  }
+
+  return csc_matrix;
+}
+
+CSC_Matrix calCSCMatrix(
+  const Eigen::Index rows, const Eigen::Index cols,
+  const std::vector<Eigen::Triplet<double>> & triplets)
+{
+  Eigen::SparseMatrix<double> mat(rows, cols);
+  mat.setFromTriplets(triplets.begin(), triplets.end());
+  return calCSCMatrix(mat);
+}
+
+bool hasSameSparsity(const CSC_Matrix & mat1, const CSC_Matrix & mat2)
+{
+  return mat1.m_row_idxs == mat2.m_row_idxs && mat1.m_col_idxs == mat2.m_col_idxs;
+}
+
 void printCSCMatrix(const CSC_Matrix & csc_mat)
 {
   std::cout << "[";
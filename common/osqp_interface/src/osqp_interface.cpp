@@ -23,6 +23,7 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace autoware
@@ -31,6 +32,42 @@ namespace common
 {
 namespace osqp
 {
+namespace
+{
+template <class MatrixT>
+void checkProblemSize(
+  const MatrixT & P, const MatrixT & A, const std::vector<double> & q,
+  const std::vector<double> & l, const std::vector<double> & u)
+{
+  std::stringstream ss;
+  if (P.rows() != P.cols()) {
+    ss << "P.rows() and P.cols() are not the same. P.rows() = " << P.rows()
+       << ", P.cols() = " << P.cols();
+    throw std::invalid_argument(ss.str());
+  }
+  if (P.rows() != static_cast<int>(q.size())) {
+    ss << "P.rows() and q.size() are not the same. P.rows() = " << P.rows()
+       << ", q.size() = " << q.size();
+    throw std::invalid_argument(ss.str());
+  }
+  if (P.rows() != A.cols()) {
+    ss << "P.rows() and A.cols() are not the same. P.rows() = " << P.rows()
+       << ", A.cols() = " << A.cols();
+    throw std::invalid_argument(ss.str());
+  }
+  if (A.rows() != static_cast<int>(l.size())) {
+    ss << "A.rows() and l.size() are not the same. A.rows() = " << A.rows()
+       << ", l.size() = " << l.size();
+    throw std::invalid_argument(ss.str());
+  }
+  if (A.rows() != static_cast<int>(u.size())) {
+    ss << "A.rows() and u.size() are not the same. A.rows() = " << A.rows()
+       << ", u.size() = " << u.size();
+    throw std::invalid_argument(ss.str());
+  }
+}
+}  // namespace
+
 OSQPInterface::OSQPInterface(const c_float eps_abs, const bool polish)
 : m_work{nullptr, OSQPWorkspaceDeleter}
 {
@@ -68,6 +105,15 @@ OSQPInterface::OSQPInterface(
   initializeProblem(P, A, q, l, u);
 }
 
+OSQPInterface::OSQPInterface(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u,
+  const c_float eps_abs)
+: OSQPInterface(eps_abs)
+{
+  initializeProblem(P, A, q, l, u);
+}
+
 OSQPInterface::~OSQPInterface()
 {
   if (m_data->P) free(m_data->P);
@@ -81,7 +127,7 @@ void OSQPInterface::OSQPWorkspaceDeleter(OSQPWorkspace * ptr) noexcept
   }
 }
 
-void OSQPInterface::updateP(const Eigen::MatrixXd & P_new)
+bool OSQPInterface::updateP(const Eigen::MatrixXd & P_new)
 {
   /*
   // Transform 'P' into an 'upper trapezoidal matrix'
@@ -92,18 +138,25 @@ void OSQPInterface::updateP(const Eigen::MatrixXd & P_new)
   // Convert dynamic 'int' arrays to 'c_int' arrays (OSQP input type)
   c_int P_elem_N = P_sparse.nonZeros();
   */
-  CSC_Matrix P_csc = calCSCMatrixTrapezoidal(P_new);
-  osqp_update_P(
-    m_work.get(), P_csc.m_vals.data(), OSQP_NULL, static_cast<c_int>(P_csc.m_vals.size()));
+  return updateCscP(calCSCMatrixTrapezoidal(P_new));
+}
+
+bool OSQPInterface::updateP(const Eigen::SparseMatrix<double> & P_new)
+{
+  return updateCscP(calCSCMatrixTrapezoidal(P_new));
 }
 
-void OSQPInterface::updateCscP(const CSC_Matrix & P_csc)
+bool OSQPInterface::updateCscP(const CSC_Matrix & P_csc)
 {
-  osqp_update_P(
+  if (!m_work_initialized || !hasSameSparsity(P_csc, m_P_csc)) {
+    return false;
+  }
+  const auto result = osqp_update_P(
     m_work.get(), P_csc.m_vals.data(), OSQP_NULL, static_cast<c_int>(P_csc.m_vals.size()));
+  return result == 0;
 }
 
-void OSQPInterface::updateA(const Eigen::MatrixXd & A_new)
+bool OSQPInterface::updateA(const Eigen::MatrixXd & A_new)
 {
   /*
   // Transform 'A' into a sparse matrix and extract data as dynamic arrays
@@ -112,16 +165,22 @@ void OSQPInterface::updateA(const Eigen::MatrixXd & A_new)
   // Convert dynamic 'int' arrays to 'c_int' arrays (OSQP input type)
   c_int A_elem_N = A_sparse.nonZeros();
   */
-  CSC_Matrix A_csc = calCSCMatrix(A_new);
-  osqp_update_A(
-    m_work.get(), A_csc.m_vals.data(), OSQP_NULL, static_cast<c_int>(A_csc.m_vals.size()));
-  return;
+  return updateCscA(calCSCMatrix(A_new));
+}
+
+bool OSQPInterface::updateA(const Eigen::SparseMatrix<double> & A_new)
+{
+  return updateCscA(calCSCMatrix(A_new));
 }
 
-void OSQPInterface::updateCscA(const CSC_Matrix & A_csc)
+bool OSQPInterface::updateCscA(const CSC_Matrix & A_csc)
 {
-  osqp_update_A(
+  if (!m_work_initialized || !hasSameSparsity(A_csc, m_A_csc)) {
+    return false;
+  }
+  const auto result = osqp_update_A(
     m_work.get(), A_csc.m_vals.data(), OSQP_NULL, static_cast<c_int>(A_csc.m_vals.size()));
+  return result == 0;
 }
 
 void OSQPInterface::updateQ(const std::vector<double> & q_new)
@@ -288,38 +347,23 @@ int64_t OSQPInterface::initializeProblem(
   const std::vector<double> & l, const std::vector<double> & u)
 {
   // check if arguments are valid
-  std::stringstream ss;
-  if (P.rows() != P.cols()) {
-    ss << "P.rows() and P.cols() are not the same. P.rows() = " << P.rows()
-       << ", P.cols() = " << P.cols();
-    throw std::invalid_argument(ss.str());
-  }
-  if (P.rows() != static_cast<int>(q.size())) {
-    ss << "P.rows() and q.size() are not the same. P.rows() = " << P.rows()
-       << ", q.size() = " << q.size();
-    throw std::invalid_argument(ss.str());
-  }
-  if (P.rows() != A.cols()) {
-    ss << "P.rows() and A.cols() are not the same. P.rows() = " << P.rows()
-       << ", A.cols() = " << A.cols();
-    throw std::invalid_argument(ss.str());
-  }
-  if (A.rows() != static_cast<int>(l.size())) {
-    ss << "A.rows() and l.size() are not the same. A.rows() = " << A.rows()
-       << ", l.size() = " << l.size();
-    throw std::invalid_argument(ss.str());
-  }
-  if (A.rows() != static_cast<int>(u.size())) {
-    ss << "A.rows() and u.size() are not the same. A.rows() = " << A.rows()
-       << ", u.size() = " << u.size();
-    throw std::invalid_argument(ss.str());
-  }
+  checkProblemSize(P, A, q, l, u);
 
   CSC_Matrix P_csc = calCSCMatrixTrapezoidal(P);
   CSC_Matrix A_csc = calCSCMatrix(A);
   return initializeProblem(P_csc, A_csc, q, l, u);
 }
 
+int64_t OSQPInterface::initializeProblem(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
+{
+  // check if arguments are valid
+  checkProblemSize(P, A, q, l, u);
+
+  return initializeProblem(calCSCMatrixTrapezoidal(P), calCSCMatrix(A), q, l, u);
+}
+
 int64_t OSQPInterface::initializeProblem(
   CSC_Matrix P_csc, CSC_Matrix A_csc, const std::vector<double> & q, const std::vector<double> & l,
   const std::vector<double> & u)
@@ -342,15 +386,17 @@ int64_t OSQPInterface::initializeProblem(
    * POPULATE DATA
    *****************/
   m_data->n = m_param_n;
+  m_P_csc = std::move(P_csc);
   if (m_data->P) free(m_data->P);
   m_data->P = csc_matrix(
-    m_data->n, m_data->n, static_cast<c_int>(P_csc.m_vals.size()), P_csc.m_vals.data(),
-    P_csc.m_row_idxs.data(), P_csc.m_col_idxs.data());
+    m_data->n, m_data->n, static_cast<c_int>(m_P_csc.m_vals.size()), m_P_csc.m_vals.data(),
+    m_P_csc.m_row_idxs.data(), m_P_csc.m_col_idxs.data());
   m_data->q = q_dyn;
+  m_A_csc = std::move(A_csc);
   if (m_data->A) free(m_data->A);
   m_data->A = csc_matrix(
-    m_data->m, m_data->n, static_cast<c_int>(A_csc.m_vals.size()), A_csc.m_vals.data(),
-    A_csc.m_row_idxs.data(), A_csc.m_col_idxs.data());
+    m_data->m, m_data->n, static_cast<c_int>(m_A_csc.m_vals.size()), m_A_csc.m_vals.data(),
+    m_A_csc.m_row_idxs.data(), m_A_csc.m_col_idxs.data());
   m_data->l = l_dyn;
   m_data->u = u_dyn;
 
@@ -16,6 +16,7 @@
 #include "osqp_interface/csc_matrix_conv.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <string>
 #include <tuple>
@@ -164,6 +165,59 @@ TEST(TestCscMatrixConv, Trapezoidal)
     EXPECT_EQ(e.what(), std::string("Matrix must be square (n, n)"));
   }
 }
+TEST(TestCscMatrixConv, Sparse)
+{
+  using autoware::common::osqp::calCSCMatrix;
+  using autoware::common::osqp::calCSCMatrixTrapezoidal;
+  using autoware::common::osqp::CSC_Matrix;
+  using autoware::common::osqp::hasSameSparsity;
+
+  // Example from http://netlib.org/linalg/html_templates/node92.html
+  Eigen::MatrixXd square(6, 6);
+  square << 10.0, 0.0, 0.0, 0.0, -2.0, 0.0, 3.0, 9.0, 0.0, 0.0, 0.0, 3.0, 0.0, 7.0, 8.0, 7.0, 0.0,
+    0.0, 3.0, 0.0, 8.0, 7.0, 5.0, 0.0, 0.0, 8.0, 0.0, 9.0, 9.0, 13.0, 0.0, 4.0, 0.0, 0.0, 2.0, -1.0;
+  const Eigen::SparseMatrix<double> square_sparse = square.sparseView();
+
+  // same as the dense version without stored zeros
+  const CSC_Matrix square_m = calCSCMatrix(square);
+  const CSC_Matrix square_sparse_m = calCSCMatrix(square_sparse);
+  EXPECT_EQ(square_sparse_m.m_vals, square_m.m_vals);
+  EXPECT_EQ(square_sparse_m.m_row_idxs, square_m.m_row_idxs);
+  EXPECT_EQ(square_sparse_m.m_col_idxs, square_m.m_col_idxs);
+  EXPECT_TRUE(hasSameSparsity(square_sparse_m, square_m));
+
+  const CSC_Matrix square_trap_m = calCSCMatrixTrapezoidal(square);
+  const CSC_Matrix square_sparse_trap_m = calCSCMatrixTrapezoidal(square_sparse);
+  EXPECT_EQ(square_sparse_trap_m.m_vals, square_trap_m.m_vals);
+  EXPECT_EQ(square_sparse_trap_m.m_row_idxs, square_trap_m.m_row_idxs);
+  EXPECT_EQ(square_sparse_trap_m.m_col_idxs, square_trap_m.m_col_idxs);
+  EXPECT_FALSE(hasSameSparsity(square_sparse_trap_m, square_m));
+
+  // stored zeros are kept, and duplicated triplets are summed up
+  const std::vector<Eigen::Triplet<double>> triplets = {
+    {0, 0, 1.0}, {1, 0, 0.0}, {0, 2, 2.0}, {0, 2, 3.0}};
+  const CSC_Matrix triplets_m = calCSCMatrix(2, 3, triplets);
+  ASSERT_EQ(triplets_m.m_vals.size(), size_t(3));
+  EXPECT_EQ(triplets_m.m_vals[0], 1.0);
+  EXPECT_EQ(triplets_m.m_vals[1], 0.0);
+  EXPECT_EQ(triplets_m.m_vals[2], 5.0);
+  ASSERT_EQ(triplets_m.m_row_idxs.size(), size_t(3));
+  EXPECT_EQ(triplets_m.m_row_idxs[0], c_int(0));
+  EXPECT_EQ(triplets_m.m_row_idxs[1], c_int(1));
+  EXPECT_EQ(triplets_m.m_row_idxs[2], c_int(0));
+  ASSERT_EQ(triplets_m.m_col_idxs.size(), size_t(4));
+  EXPECT_EQ(triplets_m.m_col_idxs[0], c_int(0));
+  EXPECT_EQ(triplets_m.m_col_idxs[1], c_int(2));
+  EXPECT_EQ(triplets_m.m_col_idxs[2], c_int(2));
+  EXPECT_EQ(triplets_m.m_col_idxs[3], c_int(3));
+
+  try {
+    const CSC_Matrix rect_m = calCSCMatrixTrapezoidal(Eigen::SparseMatrix<double>(1, 2));
+    FAIL() << "calCSCMatrixTrapezoidal should fail with non-square inputs";
+  } catch (const std::invalid_argument & e) {
+    EXPECT_EQ(e.what(), std::string("Matrix must be square (n, n)"));
+  }
+}
 TEST(TestCscMatrixConv, Print)
 {
   using autoware::common::osqp::calCSCMatrix;
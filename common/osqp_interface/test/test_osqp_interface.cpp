@@ -16,6 +16,7 @@
 #include "osqp_interface/osqp_interface.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <tuple>
 #include <vector>
@@ -160,5 +161,41 @@ TEST(TestOsqpInterface, BasicQp)
     check_result(result);
     EXPECT_EQ(osqp.getTakenIter(), 1);
   }
+
+  {
+    // Define problem during initialization with sparse matrix
+    const Eigen::SparseMatrix<double> P_sparse = P.sparseView();
+    const Eigen::SparseMatrix<double> A_sparse = A.sparseView();
+    autoware::common::osqp::OSQPInterface osqp(P_sparse, A_sparse, q, l, u, 1e-6);
+    std::tuple<std::vector<double>, std::vector<double>, int, int, int> result = osqp.optimize();
+    check_result(result);
+  }
+
+  {
+    std::tuple<std::vector<double>, std::vector<double>, int, int, int> result;
+    // Dummy initial problem with the same sparsity pattern
+    Eigen::SparseMatrix<double> P_ini = P.sparseView();
+    Eigen::SparseMatrix<double> A_ini = A.sparseView();
+    P_ini *= 0.0;
+    A_ini *= 0.0;
+    std::vector<double> q_ini(2, 0.0);
+    std::vector<double> l_ini(4, 0.0);
+    std::vector<double> u_ini(4, 0.0);
+    autoware::common::osqp::OSQPInterface osqp(P_ini, A_ini, q_ini, l_ini, u_ini, 1e-6);
+    osqp.optimize();
+
+    // Update the values before optimization
+    EXPECT_TRUE(osqp.updateP(Eigen::SparseMatrix<double>(P.sparseView())));
+    EXPECT_TRUE(osqp.updateA(Eigen::SparseMatrix<double>(A.sparseView())));
+    osqp.updateQ(q);
+    osqp.updateBounds(l, u);
+    result = osqp.optimize();
+    check_result(result);
+
+    // The sparsity pattern cannot be changed by an update
+    const Eigen::MatrixXd P_diag = (Eigen::MatrixXd(2, 2) << 4, 0, 0, 2).finished();
+    EXPECT_FALSE(osqp.updateCscP(calCSCMatrixTrapezoidal(P_diag)));
+    EXPECT_FALSE(osqp.updateCscA(calCSCMatrix(Eigen::MatrixXd::Identity(4, 2))));
+  }
 }
 }  // namespace
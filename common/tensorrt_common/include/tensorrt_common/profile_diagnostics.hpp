@@ -0,0 +1,37 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORRT_COMMON__PROFILE_DIAGNOSTICS_HPP_
+#define TENSORRT_COMMON__PROFILE_DIAGNOSTICS_HPP_
+
+#include <tensorrt_common/tensorrt_common.hpp>
+
+#include <diagnostic_msgs/msg/diagnostic_status.hpp>
+
+#include <string>
+
+namespace tensorrt_common
+{
+/**
+ * @brief summarize the profile of an engine as a diagnostic status
+ * @details The status holds the device memory of the engine, the p50/p99 latency of the whole
+ * inference and of each layer. Layers are only reported while the profiler is enabled.
+ * @param[in] trt_common engine to summarize
+ * @param[in] name name of the status, usually the name of the node and of the model
+ */
+diagnostic_msgs::msg::DiagnosticStatus toProfileDiagnosticStatus(
+  const TrtCommon & trt_common, const std::string & name);
+}  // namespace tensorrt_common
+
+#endif  // TENSORRT_COMMON__PROFILE_DIAGNOSTICS_HPP_
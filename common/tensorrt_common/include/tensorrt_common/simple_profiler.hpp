@@ -49,7 +49,23 @@ public:
     int count{0};
     float min_time{-1.0};
     int index;
+    // latest times, used as a ring buffer of max_samples
+    std::vector<float> samples;
   };
+
+  struct Statistics
+  {
+    std::string name;
+    int count;
+    float mean_time;
+    float min_time;
+    float p50_time;
+    float p99_time;
+  };
+
+  // number of latest times kept per layer for the percentiles
+  static constexpr size_t max_samples = 1000;
+
   SimpleProfiler(
     std::string name,
     const std::vector<SimpleProfiler> & src_profilers = std::vector<SimpleProfiler>());
@@ -58,6 +74,16 @@ public:
 
   void setProfDict(nvinfer1::ILayer * layer) noexcept;
 
+  /**
+   * @brief get the statistics of each layer in execution order
+   */
+  std::vector<Statistics> getStatistics() const;
+
+  /**
+   * @brief clear the recorded times
+   */
+  void reset();
+
   friend std::ostream & operator<<(std::ostream & out, SimpleProfiler & value);
 
 private:
@@ -192,6 +192,29 @@ public:
    */
   void printProfiling(void);
 
+  /**
+   * @brief enable or disable the per-layer profiler at runtime
+   * @warning each enqueue is synchronized while the profiler is enabled
+   */
+  void setProfiling(const bool enable);
+
+  bool isProfiling() const { return is_profiling_; }
+
+  /**
+   * @brief get the statistics of each layer of the model
+   */
+  std::vector<SimpleProfiler::Statistics> getModelStatistics() const;
+
+  /**
+   * @brief get the statistics of the whole inference measured on the host
+   */
+  std::vector<SimpleProfiler::Statistics> getHostStatistics() const;
+
+  /**
+   * @brief get the device memory required by the execution context of the engine
+   */
+  size_t getDeviceMemorySize() const;
+
 #if (NV_TENSORRT_MAJOR * 1000) + (NV_TENSORRT_MINOR * 100) + NV_TENSOR_PATCH >= 8200
   /**
    * @brief get per-layer information for trt-engine-profiler
@@ -213,6 +236,7 @@ private:
   BatchConfig batch_config_;
   size_t max_workspace_size_;
   bool is_initialized_{false};
+  bool is_profiling_{false};
 
   // profiler for per-layer
   SimpleProfiler model_profiler_;
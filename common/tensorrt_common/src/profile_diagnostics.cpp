@@ -0,0 +1,58 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <tensorrt_common/profile_diagnostics.hpp>
+
+#include <diagnostic_msgs/msg/key_value.hpp>
+
+#include <vector>
+
+namespace tensorrt_common
+{
+namespace
+{
+void addStatistics(
+  const std::vector<SimpleProfiler::Statistics> & statistics, const std::string & prefix,
+  diagnostic_msgs::msg::DiagnosticStatus & status)
+{
+  diagnostic_msgs::msg::KeyValue key_value;
+  for (const auto & stat : statistics) {
+    key_value.key = prefix + stat.name + " p50 [ms]";
+    key_value.value = std::to_string(stat.p50_time);
+    status.values.push_back(key_value);
+    key_value.key = prefix + stat.name + " p99 [ms]";
+    key_value.value = std::to_string(stat.p99_time);
+    status.values.push_back(key_value);
+  }
+}
+}  // namespace
+
+diagnostic_msgs::msg::DiagnosticStatus toProfileDiagnosticStatus(
+  const TrtCommon & trt_common, const std::string & name)
+{
+  diagnostic_msgs::msg::DiagnosticStatus status;
+  status.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+  status.name = name;
+  status.message = trt_common.isProfiling() ? "profiling" : "not profiling";
+
+  diagnostic_msgs::msg::KeyValue key_value;
+  key_value.key = "device memory [bytes]";
+  key_value.value = std::to_string(trt_common.getDeviceMemorySize());
+  status.values.push_back(key_value);
+
+  addStatistics(trt_common.getHostStatistics(), "", status);
+  addStatistics(trt_common.getModelStatistics(), "layer ", status);
+  return status;
+}
+}  // namespace tensorrt_common
@@ -14,6 +14,7 @@
 
 #include <tensorrt_common/simple_profiler.hpp>
 
+#include <algorithm>
 #include <iomanip>
 
 namespace tensorrt_common
@@ -40,6 +41,12 @@ SimpleProfiler::SimpleProfiler(std::string name, const std::vector<SimpleProfile
 
 void SimpleProfiler::reportLayerTime(const char * layerName, float ms) noexcept
 {
+  auto & samples = m_profile[layerName].samples;
+  if (samples.size() < max_samples) {
+    samples.push_back(ms);
+  } else {
+    samples.at(m_profile[layerName].count % max_samples) = ms;
+  }
   m_profile[layerName].count++;
   m_profile[layerName].time += ms;
   if (m_profile[layerName].min_time == -1.0) {
@@ -51,6 +58,40 @@ void SimpleProfiler::reportLayerTime(const char * layerName, float ms) noexcept
   }
 }
 
+std::vector<SimpleProfiler::Statistics> SimpleProfiler::getStatistics() const
+{
+  std::vector<Statistics> statistics;
+  std::vector<float> samples;
+  for (int i = 0; i < m_index; i++) {
+    for (const auto & elem : m_profile) {
+      if (elem.second.index != i || elem.second.samples.empty()) {
+        continue;
+      }
+      samples = elem.second.samples;
+      const auto percentile = [&samples](const double ratio) {
+        const auto nth = samples.begin() + static_cast<size_t>(ratio * (samples.size() - 1));
+        std::nth_element(samples.begin(), nth, samples.end());
+        return *nth;
+      };
+      Statistics stat;
+      stat.name = elem.first;
+      stat.count = elem.second.count;
+      stat.mean_time = elem.second.time / elem.second.count;
+      stat.min_time = elem.second.min_time;
+      stat.p50_time = percentile(0.5);
+      stat.p99_time = percentile(0.99);
+      statistics.push_back(stat);
+    }
+  }
+  return statistics;
+}
+
+void SimpleProfiler::reset()
+{
+  m_profile.clear();
+  m_index = 0;
+}
+
 void SimpleProfiler::setProfDict(nvinfer1::ILayer * layer) noexcept
 {
   std::string name = layer->getName();
@@ -202,9 +202,7 @@ void TrtCommon::setup()
     return;
   }
 
-  if (build_config_->profile_per_layer) {
-    context_->setProfiler(&model_profiler_);
-  }
+  setProfiling(build_config_->profile_per_layer);
 #if (NV_TENSORRT_MAJOR * 1000) + (NV_TENSORRT_MINOR * 100) + NV_TENSOR_PATCH >= 8200
   // Write profiles for trt-engine-explorer
   // See: https://github.com/NVIDIA/TensorRT/tree/main/tools/experimental/trt-engine-explorer
@@ -564,7 +562,7 @@ bool TrtCommon::setBindingDimensions(const int32_t index, const nvinfer1::Dims &
 
 bool TrtCommon::enqueueV2(void ** bindings, cudaStream_t stream, cudaEvent_t * input_consumed)
 {
-  if (build_config_->profile_per_layer) {
+  if (is_profiling_) {
     auto inference_start = std::chrono::high_resolution_clock::now();
 
     bool ret = context_->enqueueV2(bindings, stream, input_consumed);
@@ -586,6 +584,30 @@ void TrtCommon::printProfiling()
   std::cout << model_profiler_;
 }
 
+void TrtCommon::setProfiling(const bool enable)
+{
+  if (!context_) {
+    return;
+  }
+  context_->setProfiler(enable ? &model_profiler_ : nullptr);
+  is_profiling_ = enable;
+}
+
+std::vector<SimpleProfiler::Statistics> TrtCommon::getModelStatistics() const
+{
+  return model_profiler_.getStatistics();
+}
+
+std::vector<SimpleProfiler::Statistics> TrtCommon::getHostStatistics() const
+{
+  return host_profiler_.getStatistics();
+}
+
+size_t TrtCommon::getDeviceMemorySize() const
+{
+  return engine_ ? engine_->getDeviceMemorySize() : 0;
+}
+
 #if (NV_TENSORRT_MAJOR * 1000) + (NV_TENSORRT_MINOR * 100) + NV_TENSOR_PATCH >= 8200
 std::string TrtCommon::getLayerInformation(nvinfer1::LayerInformationFormat format)
 {
@@ -15,6 +15,7 @@
 #ifndef TIER4_AUTOWARE_UTILS__GEOMETRY__BOOST_GEOMETRY_HPP_
 #define TIER4_AUTOWARE_UTILS__GEOMETRY__BOOST_GEOMETRY_HPP_
 
+#include <boost/container/small_vector.hpp>
 #include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/geometries/geometries.hpp>
 #include <boost/geometry/geometries/register/point.hpp>
@@ -38,6 +39,14 @@ using MultiPoint2d = boost::geometry::model::multi_point<Point2d>;
 using MultiLineString2d = boost::geometry::model::multi_linestring<LineString2d>;
 using MultiPolygon2d = boost::geometry::model::multi_polygon<Polygon2d>;
 
+// NOTE: The points of SmallPolygon2d are stored in the object up to this capacity, which covers the
+//       polygons of the bounding boxes, the cylinders and the footprints with the closing point.
+constexpr size_t small_polygon_capacity = 8;
+template <typename T, typename Allocator>
+using SmallPointVector = boost::container::small_vector<T, small_polygon_capacity, Allocator>;
+// polygon without heap allocation for the small number of points
+using SmallPolygon2d = boost::geometry::model::polygon<Point2d, true, true, SmallPointVector>;
+
 // 3D
 struct Point3d;
 using Segment3d = boost::geometry::model::segment<Point3d>;
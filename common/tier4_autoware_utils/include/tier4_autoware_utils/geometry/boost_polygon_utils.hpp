@@ -27,6 +27,7 @@
 namespace tier4_autoware_utils
 {
 bool isClockwise(const Polygon2d & polygon);
+bool isClockwise(const SmallPolygon2d & polygon);
 Polygon2d inverseClockwise(const Polygon2d & polygon);
 geometry_msgs::msg::Polygon rotatePolygon(
   const geometry_msgs::msg::Polygon & polygon, const double & angle);
@@ -43,6 +44,31 @@ Polygon2d toPolygon2d(const autoware_auto_perception_msgs::msg::PredictedObject
 Polygon2d toFootprint(
   const geometry_msgs::msg::Pose & base_link_pose, const double base_to_front,
   const double base_to_rear, const double width);
+
+/// @brief write the clockwise polygon of the shape into the given polygon
+/// @details The memory of the polygon is reused, and SmallPolygon2d is written without heap
+/// allocation for the bounding boxes and the cylinders.
+/// @param[out] polygon output polygon, whose previous points are cleared
+void toPolygon2d(
+  const geometry_msgs::msg::Pose & pose, const autoware_auto_perception_msgs::msg::Shape & shape,
+  Polygon2d & polygon);
+void toPolygon2d(
+  const geometry_msgs::msg::Pose & pose, const autoware_auto_perception_msgs::msg::Shape & shape,
+  SmallPolygon2d & polygon);
+void toPolygon2d(
+  const autoware_auto_perception_msgs::msg::DetectedObject & object, SmallPolygon2d & polygon);
+void toPolygon2d(
+  const autoware_auto_perception_msgs::msg::TrackedObject & object, SmallPolygon2d & polygon);
+void toPolygon2d(
+  const autoware_auto_perception_msgs::msg::PredictedObject & object, SmallPolygon2d & polygon);
+/// @brief write the clockwise footprint into the given polygon, reusing its memory
+/// @param[out] polygon output polygon, whose previous points are cleared
+void toFootprint(
+  const geometry_msgs::msg::Pose & base_link_pose, const double base_to_front,
+  const double base_to_rear, const double width, Polygon2d & polygon);
+void toFootprint(
+  const geometry_msgs::msg::Pose & base_link_pose, const double base_to_front,
+  const double base_to_rear, const double width, SmallPolygon2d & polygon);
 double getArea(const autoware_auto_perception_msgs::msg::Shape & shape);
 Polygon2d expandPolygon(const Polygon2d & input_polygon, const double offset);
 }  // namespace tier4_autoware_utils
@@ -0,0 +1,78 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TIER4_AUTOWARE_UTILS__GEOMETRY__CONVEX_POLYGON_UTILS_HPP_
+#define TIER4_AUTOWARE_UTILS__GEOMETRY__CONVEX_POLYGON_UTILS_HPP_
+
+#include "tier4_autoware_utils/geometry/boost_geometry.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace tier4_autoware_utils
+{
+/// @brief convex polygon represented by the half-planes of its edges to classify many points
+/// @details The batch classification uses AVX2 or NEON when the compiler targets them (e.g.
+/// -march=native), and falls back to a scalar loop otherwise.
+class ConvexPolygonHalfPlanes
+{
+public:
+  static constexpr size_t batch_size = 16;
+
+  /// @param[in] convex_polygon convex polygon in either orientation
+  explicit ConvexPolygonHalfPlanes(const Polygon2d & convex_polygon);
+
+  /// @brief check if the point is strictly inside, the same as boost::geometry::within
+  bool within(const Point2d & point) const;
+
+  /// @brief check if the points are strictly inside
+  /// @param[in] xs x of the points
+  /// @param[in] ys y of the points
+  /// @param[in] num_points number of the points, which is at most batch_size
+  /// @return bitmask whose i-th bit is set if the i-th point is inside
+  uint32_t withinBatch(const float * xs, const float * ys, const size_t num_points) const;
+
+  /// @brief check if the points are strictly inside
+  /// @param[in] xs x of the points
+  /// @param[in] ys y of the points
+  /// @param[out] is_within 1 if the point is inside, 0 otherwise. Resized to the number of points
+  void within(
+    const std::vector<float> & xs, const std::vector<float> & ys,
+    std::vector<uint8_t> & is_within) const;
+
+  /// @brief check if the points are strictly inside
+  /// @param[in] xs x of the points
+  /// @param[in] ys y of the points
+  /// @param[in] num_points number of the points
+  /// @param[out] is_within 1 if the point is inside, 0 otherwise. Must hold num_points elements
+  void within(
+    const float * xs, const float * ys, const size_t num_points, uint8_t * is_within) const;
+
+private:
+  // a point p is inside if ex * (p.y - ay) - ey * (p.x - ax) < 0 for all the edges
+  std::vector<double> ax_;
+  std::vector<double> ay_;
+  std::vector<double> ex_;
+  std::vector<double> ey_;
+
+  // the same in float for the batch classification
+  std::vector<float> ax_f_;
+  std::vector<float> ay_f_;
+  std::vector<float> ex_f_;
+  std::vector<float> ey_f_;
+};
+}  // namespace tier4_autoware_utils
+
+#endif  // TIER4_AUTOWARE_UTILS__GEOMETRY__CONVEX_POLYGON_UTILS_HPP_
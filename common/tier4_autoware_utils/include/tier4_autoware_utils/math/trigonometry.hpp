@@ -15,6 +15,9 @@
 #ifndef TIER4_AUTOWARE_UTILS__MATH__TRIGONOMETRY_HPP_
 #define TIER4_AUTOWARE_UTILS__MATH__TRIGONOMETRY_HPP_
 
+#include <utility>
+#include <vector>
+
 namespace tier4_autoware_utils
 {
 
@@ -22,6 +25,24 @@ float sin(float radian);
 
 float cos(float radian);
 
+// sin and cos with a single lookup of the sin table
+std::pair<float, float> sin_and_cos(float radian);
+
+// sin and cos of the radians with the sin table, in a loop without branches so that it is
+// vectorized. The error is the same as sin() and cos().
+void sin_and_cos(
+  const std::vector<float> & radians, std::vector<float> & sin_values,
+  std::vector<float> & cos_values);
+
+// atan2 approximated by a polynomial of degree 9, whose error is less than 2e-5 [rad] including
+// the rounding error of float. The result is in [-pi, pi], and 0 when both of dy and dx are 0.
+float fast_atan2(float dy, float dx);
+
+// fast_atan2() of the arrays, in a loop without branches so that it is vectorized
+// throw std::invalid_argument if the sizes of dy and dx are not the same
+void fast_atan2(
+  const std::vector<float> & dy, const std::vector<float> & dx, std::vector<float> & radians);
+
 }  // namespace tier4_autoware_utils
 
 #endif  // TIER4_AUTOWARE_UTILS__MATH__TRIGONOMETRY_HPP_
@@ -42,6 +42,16 @@ T_msg toDebugMsg(const T & data, const rclcpp::Time & stamp)
 }
 }  // namespace debug_publisher
 
+/**
+ * @brief return true if the publisher has any subscription, in this process or not
+ * @details Debug messages such as MarkerArrays are only for visualization, so their construction
+ * can be skipped when this returns false.
+ */
+inline bool hasSubscription(const rclcpp::PublisherBase & publisher)
+{
+  return publisher.get_subscription_count() + publisher.get_intra_process_subscription_count() > 0;
+}
+
 class DebugPublisher
 {
 public:
@@ -52,11 +62,20 @@ public:
     std::enable_if_t<rosidl_generator_traits::is_message<T>::value, std::nullptr_t> = nullptr>
   void publish(const std::string & name, const T & data, const rclcpp::QoS & qos = rclcpp::QoS(1))
   {
-    if (pub_map_.count(name) == 0) {
-      pub_map_[name] = node_->create_publisher<T>(std::string(ns_) + "/" + name, qos);
-    }
+    getPublisher<T>(name, qos)->publish(data);
+  }
 
-    std::dynamic_pointer_cast<rclcpp::Publisher<T>>(pub_map_.at(name))->publish(data);
+  /**
+   * @brief build the message with create_msg() and publish it only if the topic is subscribed
+   */
+  template <class T, class CreateMsg>
+  void publishIfSubscribed(
+    const std::string & name, CreateMsg && create_msg, const rclcpp::QoS & qos = rclcpp::QoS(1))
+  {
+    const auto publisher = getPublisher<T>(name, qos);
+    if (hasSubscription(*publisher)) {
+      publisher->publish(create_msg());
+    }
   }
 
   template <
@@ -68,6 +87,16 @@ public:
   }
 
 private:
+  template <class T>
+  std::shared_ptr<rclcpp::Publisher<T>> getPublisher(
+    const std::string & name, const rclcpp::QoS & qos)
+  {
+    if (pub_map_.count(name) == 0) {
+      pub_map_[name] = node_->create_publisher<T>(std::string(ns_) + "/" + name, qos);
+    }
+    return std::dynamic_pointer_cast<rclcpp::Publisher<T>>(pub_map_.at(name));
+  }
+
   rclcpp::Node * node_;
   const char * ns_;
   std::unordered_map<std::string, std::shared_ptr<rclcpp::PublisherBase>> pub_map_;
@@ -0,0 +1,111 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// =============== How to use ===============
+// ___In your_node.hpp___
+// #include "tier4_autoware_utils/ros/static_transform_cache.hpp"
+// class YourNode : public rclcpp::Node {
+//   ...
+//
+//   tf2_ros::Buffer tf_buffer_{get_clock()};
+//   tf2_ros::TransformListener tf_listener_{tf_buffer_};
+//   tier4_autoware_utils::StaticTransformCache transform_cache_{this, tf_buffer_};
+// }
+//
+// ___In your_node.cpp___
+// // the same as tf_buffer_.lookupTransform(), which is called if the transform is not static
+// const auto transform = transform_cache_.lookupTransform(
+//   target_frame, source_frame, stamp, rclcpp::Duration::from_seconds(0.5));
+
+#ifndef TIER4_AUTOWARE_UTILS__ROS__STATIC_TRANSFORM_CACHE_HPP_
+#define TIER4_AUTOWARE_UTILS__ROS__STATIC_TRANSFORM_CACHE_HPP_
+
+#include "tier4_autoware_utils/system/latest_mailbox.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <geometry_msgs/msg/transform_stamped.hpp>
+#include <tf2_msgs/msg/tf_message.hpp>
+
+#include <tf2_ros/buffer.h>
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace tier4_autoware_utils
+{
+/// @brief caches the transforms between the frames connected only by static transforms
+/// @details tf2_ros::Buffer::lookupTransform() takes the mutex of the buffer and walks the tree on
+/// every call, although the sensor extrinsics looked up for every message never change. The first
+/// lookup of a frame pair checks whether all the transforms between the frames were received on
+/// /tf_static. If so, the transform is looked up once and stored, and the later lookups only load
+/// an immutable snapshot of the stored transforms. Otherwise the lookups are forwarded to the tf2
+/// buffer, which interpolates the dynamic transforms as usual. The snapshot is cleared whenever a
+/// static transform is received, since it may replace a cached one.
+class StaticTransformCache
+{
+public:
+  /// @brief subscribe /tf_static on the node, the tf2 buffer must outlive this object
+  StaticTransformCache(rclcpp::Node * node, tf2_ros::Buffer & tf_buffer);
+
+  /// @brief without subscription, the static transforms are given by addStaticTransforms()
+  explicit StaticTransformCache(tf2_ros::Buffer & tf_buffer);
+
+  StaticTransformCache(const StaticTransformCache &) = delete;
+  StaticTransformCache & operator=(const StaticTransformCache &) = delete;
+
+  void addStaticTransforms(const tf2_msgs::msg::TFMessage & msg);
+
+  /// @brief the same as tf2_ros::Buffer::lookupTransform(), thread safe
+  /// @throw tf2::TransformException if the transform is not static and the tf2 buffer throws
+  geometry_msgs::msg::TransformStamped lookupTransform(
+    const std::string & target_frame, const std::string & source_frame, const rclcpp::Time & time,
+    const rclcpp::Duration & timeout);
+
+  geometry_msgs::msg::TransformStamped lookupTransform(
+    const std::string & target_frame, const std::string & source_frame, const tf2::TimePoint & time,
+    const tf2::Duration & timeout = tf2::Duration(0));
+
+private:
+  struct Entry
+  {
+    std::string target_frame;
+    std::string source_frame;
+    bool is_static;
+    geometry_msgs::msg::TransformStamped transform;
+  };
+  using Entries = std::vector<Entry>;
+
+  // return false if the frames are not connected only by static transforms
+  bool getStaticTransform(
+    const std::string & target_frame, const std::string & source_frame,
+    geometry_msgs::msg::TransformStamped & transform);
+  bool isStaticChain(const std::string & target_frame, const std::string & source_frame) const;
+
+  tf2_ros::Buffer & tf_buffer_;
+  rclcpp::Subscription<tf2_msgs::msg::TFMessage>::SharedPtr sub_tf_static_;
+
+  // the frame pairs looked up since the last static transform was received
+  LatestMailbox<Entries> entries_;
+
+  // guards static_parents_ and the replacement of entries_
+  std::mutex mutex_;
+  // parent frame of each child frame received on /tf_static
+  std::unordered_map<std::string, std::string> static_parents_;
+};
+}  // namespace tier4_autoware_utils
+
+#endif  // TIER4_AUTOWARE_UTILS__ROS__STATIC_TRANSFORM_CACHE_HPP_
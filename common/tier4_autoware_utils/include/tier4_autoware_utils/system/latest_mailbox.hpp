@@ -0,0 +1,58 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TIER4_AUTOWARE_UTILS__SYSTEM__LATEST_MAILBOX_HPP_
+#define TIER4_AUTOWARE_UTILS__SYSTEM__LATEST_MAILBOX_HPP_
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace tier4_autoware_utils
+{
+/// @brief holds the latest value received from a topic
+/// @details store() and load() atomically swap and copy a shared_ptr to an immutable value, so a
+/// subscription callback never waits for a reader (e.g., the planning callback) to finish its work
+/// and readers always get a complete value. Values that must be consistent with each other should
+/// be stored together in a single struct.
+template <class T>
+class LatestMailbox
+{
+public:
+  using ConstSharedPtr = std::shared_ptr<const T>;
+
+  LatestMailbox() = default;
+  LatestMailbox(const LatestMailbox &) = delete;
+  LatestMailbox & operator=(const LatestMailbox &) = delete;
+
+  /// @brief replace the held value
+  void store(ConstSharedPtr value)
+  {
+    std::atomic_store_explicit(&value_, std::move(value), std::memory_order_release);
+  }
+
+  /// @brief get the latest value, nullptr if no value was stored yet
+  [[nodiscard]] ConstSharedPtr load() const
+  {
+    return std::atomic_load_explicit(&value_, std::memory_order_acquire);
+  }
+
+  void reset() { store(nullptr); }
+
+private:
+  ConstSharedPtr value_{nullptr};
+};
+}  // namespace tier4_autoware_utils
+
+#endif  // TIER4_AUTOWARE_UTILS__SYSTEM__LATEST_MAILBOX_HPP_
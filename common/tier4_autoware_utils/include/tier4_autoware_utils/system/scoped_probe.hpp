@@ -0,0 +1,142 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TIER4_AUTOWARE_UTILS__SYSTEM__SCOPED_PROBE_HPP_
+#define TIER4_AUTOWARE_UTILS__SYSTEM__SCOPED_PROBE_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace tier4_autoware_utils
+{
+/// @brief processing time of a scope recorded by ScopedProbe
+struct ProbeRecord
+{
+  // name with static storage duration, e.g. a string literal or __func__
+  const char * name{nullptr};
+  std::chrono::steady_clock::time_point start;
+  std::chrono::nanoseconds duration{0};
+  // index of the thread in the order of the first probe of each thread
+  uint32_t thread_index{0};
+};
+
+/// @brief ring buffer of the probe records of a thread
+/// @details The thread of the probes is the only producer and drainProbeRecords() is the only
+/// consumer, so that push() and drain() are lock-free and wait-free. The records are dropped when
+/// the buffer is full, i.e. when the records are not drained often enough.
+class ProbeBuffer
+{
+public:
+  static constexpr size_t capacity = 4096;
+
+  explicit ProbeBuffer(const uint32_t thread_index) : thread_index_(thread_index) {}
+
+  /// @brief called only by the thread of the buffer
+  void push(
+    const char * name, const std::chrono::steady_clock::time_point start,
+    const std::chrono::nanoseconds duration) noexcept
+  {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (head - tail_.load(std::memory_order_acquire) == capacity) {
+      dropped_count_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    records_[head % capacity] = ProbeRecord{name, start, duration, thread_index_};
+    head_.store(head + 1, std::memory_order_release);
+  }
+
+  /// @brief move the records to the back of records, called only by one consumer at a time
+  void drain(std::vector<ProbeRecord> & records)
+  {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    const size_t head = head_.load(std::memory_order_acquire);
+    for (size_t i = tail; i != head; ++i) {
+      records.push_back(records_[i % capacity]);
+    }
+    tail_.store(head, std::memory_order_release);
+  }
+
+  uint64_t droppedCount() const { return dropped_count_.load(std::memory_order_relaxed); }
+
+private:
+  const uint32_t thread_index_;
+  std::array<ProbeRecord, capacity> records_;
+  std::atomic<size_t> head_{0};
+  std::atomic<size_t> tail_{0};
+  std::atomic<uint64_t> dropped_count_{0};
+};
+
+/// @brief get the probe buffer of the current thread, which is registered at the first call
+ProbeBuffer & getThreadProbeBuffer();
+
+/// @brief record the processing time of the scope into the probe buffer of the current thread
+/// @details Unlike StopWatch, the name is not copied nor hashed, so that the probe can always be
+/// enabled in hot functions. Use it with TIER4_AUTOWARE_UTILS_SCOPED_PROBE() for a string literal
+/// or TIER4_AUTOWARE_UTILS_SCOPED_FUNCTION_PROBE() for the name of the function.
+class ScopedProbe
+{
+public:
+  explicit ScopedProbe(const char * name) noexcept
+  : name_(name), start_(std::chrono::steady_clock::now())
+  {
+  }
+
+  ~ScopedProbe()
+  {
+    getThreadProbeBuffer().push(name_, start_, std::chrono::steady_clock::now() - start_);
+  }
+
+  ScopedProbe(const ScopedProbe &) = delete;
+  ScopedProbe & operator=(const ScopedProbe &) = delete;
+
+private:
+  const char * name_;
+  const std::chrono::steady_clock::time_point start_;
+};
+
+/// @brief move the records of all the threads into a vector, which is sorted by the start time
+std::vector<ProbeRecord> drainProbeRecords();
+
+/// @brief the number of the records dropped in all the threads since the start of the process
+uint64_t getDroppedProbeCount();
+
+/// @brief sum of the processing time [ms] of the records for each name
+/// @details The result can be published with ProcessingTimePublisher::publish().
+std::map<std::string, double> calcProcessingTimeMap(const std::vector<ProbeRecord> & records);
+
+/// @brief write the records in the trace event format in JSON, which can be opened in Perfetto
+/// (https://ui.perfetto.dev) or chrome://tracing
+void writeChromeTrace(const std::vector<ProbeRecord> & records, std::ostream & os);
+}  // namespace tier4_autoware_utils
+
+#define TIER4_AUTOWARE_UTILS_PROBE_CONCAT_INNER(x, y) x##y
+#define TIER4_AUTOWARE_UTILS_PROBE_CONCAT(x, y) TIER4_AUTOWARE_UTILS_PROBE_CONCAT_INNER(x, y)
+
+// NOTE: name has to be a string literal, which is checked by the concatenation with "".
+#define TIER4_AUTOWARE_UTILS_SCOPED_PROBE(name)                                                    \
+  const tier4_autoware_utils::ScopedProbe TIER4_AUTOWARE_UTILS_PROBE_CONCAT(                       \
+    tier4_autoware_utils_scoped_probe_, __LINE__)("" name "")
+
+#define TIER4_AUTOWARE_UTILS_SCOPED_FUNCTION_PROBE()                                               \
+  const tier4_autoware_utils::ScopedProbe TIER4_AUTOWARE_UTILS_PROBE_CONCAT(                       \
+    tier4_autoware_utils_scoped_probe_, __LINE__)(__func__)
+
+#endif  // TIER4_AUTOWARE_UTILS__SYSTEM__SCOPED_PROBE_HPP_
@@ -24,9 +24,9 @@ namespace
 {
 namespace bg = boost::geometry;
 using tier4_autoware_utils::Point2d;
-using tier4_autoware_utils::Polygon2d;
 
-void appendPointToPolygon(Polygon2d & polygon, const geometry_msgs::msg::Point & geom_point)
+template <class PolygonT>
+void appendPointToPolygon(PolygonT & polygon, const geometry_msgs::msg::Point & geom_point)
 {
   Point2d point;
   point.x() = geom_point.x;
@@ -35,11 +35,132 @@ void appendPointToPolygon(Polygon2d & polygon, const geometry_msgs::msg::Point &
   bg::append(polygon.outer(), point);
 }
 
-void appendPointToPolygon(Polygon2d & polygon, const Point2d & point)
+template <class PolygonT>
+void appendPointToPolygon(PolygonT & polygon, const Point2d & point)
 {
   bg::append(polygon.outer(), point);
 }
 
+template <class PolygonT>
+bool isClockwiseImpl(const PolygonT & polygon)
+{
+  const int n = polygon.outer().size();
+  const double x_offset = polygon.outer().at(0).x();
+  const double y_offset = polygon.outer().at(0).y();
+  double sum = 0.0;
+  for (std::size_t i = 0; i < polygon.outer().size(); ++i) {
+    sum +=
+      (polygon.outer().at(i).x() - x_offset) * (polygon.outer().at((i + 1) % n).y() - y_offset) -
+      (polygon.outer().at(i).y() - y_offset) * (polygon.outer().at((i + 1) % n).x() - x_offset);
+  }
+
+  return sum < 0.0;
+}
+
+// NOTE: The points are written into the given polygon without the temporary polygons, so that the
+//       capacity of the polygon is reused.
+template <class PolygonT>
+void toPolygon2dImpl(
+  const geometry_msgs::msg::Pose & pose, const autoware_auto_perception_msgs::msg::Shape & shape,
+  PolygonT & polygon)
+{
+  polygon.outer().clear();
+  polygon.inners().clear();
+
+  if (shape.type == autoware_auto_perception_msgs::msg::Shape::BOUNDING_BOX) {
+    const auto point0 = tier4_autoware_utils::calcOffsetPose(
+                          pose, shape.dimensions.x / 2.0, shape.dimensions.y / 2.0, 0.0)
+                          .position;
+    const auto point1 = tier4_autoware_utils::calcOffsetPose(
+                          pose, -shape.dimensions.x / 2.0, shape.dimensions.y / 2.0, 0.0)
+                          .position;
+    const auto point2 = tier4_autoware_utils::calcOffsetPose(
+                          pose, -shape.dimensions.x / 2.0, -shape.dimensions.y / 2.0, 0.0)
+                          .position;
+    const auto point3 = tier4_autoware_utils::calcOffsetPose(
+                          pose, shape.dimensions.x / 2.0, -shape.dimensions.y / 2.0, 0.0)
+                          .position;
+
+    appendPointToPolygon(polygon, point0);
+    appendPointToPolygon(polygon, point1);
+    appendPointToPolygon(polygon, point2);
+    appendPointToPolygon(polygon, point3);
+  } else if (shape.type == autoware_auto_perception_msgs::msg::Shape::CYLINDER) {
+    const double radius = shape.dimensions.x / 2.0;
+    constexpr int circle_discrete_num = 6;
+    for (int i = 0; i < circle_discrete_num; ++i) {
+      geometry_msgs::msg::Point point;
+      point.x = std::cos(
+                  (static_cast<double>(i) / static_cast<double>(circle_discrete_num)) * 2.0 * M_PI +
+                  M_PI / static_cast<double>(circle_discrete_num)) *
+                  radius +
+                pose.position.x;
+      point.y = std::sin(
+                  (static_cast<double>(i) / static_cast<double>(circle_discrete_num)) * 2.0 * M_PI +
+                  M_PI / static_cast<double>(circle_discrete_num)) *
+                  radius +
+                pose.position.y;
+      appendPointToPolygon(polygon, point);
+    }
+  } else if (shape.type == autoware_auto_perception_msgs::msg::Shape::POLYGON) {
+    // NOTE: same as rotatePolygon() without the rotated footprint message
+    const double poly_yaw = tf2::getYaw(pose.orientation);
+    const double cos = std::cos(poly_yaw);
+    const double sin = std::sin(poly_yaw);
+    for (const auto & point : shape.footprint.points) {
+      auto rel_point = point;
+      rel_point.x = cos * point.x - sin * point.y;
+      rel_point.y = sin * point.x + cos * point.y;
+
+      Point2d abs_point;
+      abs_point.x() = pose.position.x + rel_point.x;
+      abs_point.y() = pose.position.y + rel_point.y;
+
+      appendPointToPolygon(polygon, abs_point);
+    }
+  } else {
+    throw std::logic_error("The shape type is not supported in tier4_autoware_utils.");
+  }
+
+  // NOTE: push back the first point in order to close polygon
+  if (!polygon.outer().empty()) {
+    const auto front_point = polygon.outer().front();
+    appendPointToPolygon(polygon, front_point);
+  }
+
+  if (!isClockwiseImpl(polygon)) {
+    bg::reverse(polygon);
+  }
+}
+
+template <class PolygonT>
+void toFootprintImpl(
+  const geometry_msgs::msg::Pose & base_link_pose, const double base_to_front,
+  const double base_to_rear, const double width, PolygonT & polygon)
+{
+  polygon.outer().clear();
+  polygon.inners().clear();
+
+  const auto point0 =
+    tier4_autoware_utils::calcOffsetPose(base_link_pose, base_to_front, width / 2.0, 0.0).position;
+  const auto point1 =
+    tier4_autoware_utils::calcOffsetPose(base_link_pose, base_to_front, -width / 2.0, 0.0).position;
+  const auto point2 =
+    tier4_autoware_utils::calcOffsetPose(base_link_pose, -base_to_rear, -width / 2.0, 0.0).position;
+  const auto point3 =
+    tier4_autoware_utils::calcOffsetPose(base_link_pose, -base_to_rear, width / 2.0, 0.0).position;
+
+  appendPointToPolygon(polygon, point0);
+  appendPointToPolygon(polygon, point1);
+  appendPointToPolygon(polygon, point2);
+  appendPointToPolygon(polygon, point3);
+  appendPointToPolygon(polygon, point0);
+
+  if (!isClockwiseImpl(polygon)) {
+    bg::reverse(polygon);
+  }
+}
+
 /*
  * NOTE: Area is negative when footprint.points is clock wise.
  *       Area is positive when footprint.points is anti clock wise.
@@ -72,17 +193,12 @@ namespace tier4_autoware_utils
 {
 bool isClockwise(const Polygon2d & polygon)
 {
-  const int n = polygon.outer().size();
-  const double x_offset = polygon.outer().at(0).x();
-  const double y_offset = polygon.outer().at(0).y();
-  double sum = 0.0;
-  for (std::size_t i = 0; i < polygon.outer().size(); ++i) {
-    sum +=
-      (polygon.outer().at(i).x() - x_offset) * (polygon.outer().at((i + 1) % n).y() - y_offset) -
-      (polygon.outer().at(i).y() - y_offset) * (polygon.outer().at((i + 1) % n).x() - x_offset);
-  }
+  return isClockwiseImpl(polygon);
+}
 
-  return sum < 0.0;
+bool isClockwise(const SmallPolygon2d & polygon)
+{
+  return isClockwiseImpl(polygon);
 }
 
 Polygon2d inverseClockwise(const Polygon2d & polygon)
@@ -121,62 +237,22 @@ Polygon2d toPolygon2d(
   const geometry_msgs::msg::Pose & pose, const autoware_auto_perception_msgs::msg::Shape & shape)
 {
   Polygon2d polygon;
+  toPolygon2dImpl(pose, shape, polygon);
+  return polygon;
+}
 
-  if (shape.type == autoware_auto_perception_msgs::msg::Shape::BOUNDING_BOX) {
-    const auto point0 = tier4_autoware_utils::calcOffsetPose(
-                          pose, shape.dimensions.x / 2.0, shape.dimensions.y / 2.0, 0.0)
-                          .position;
-    const auto point1 = tier4_autoware_utils::calcOffsetPose(
-                          pose, -shape.dimensions.x / 2.0, shape.dimensions.y / 2.0, 0.0)
-                          .position;
-    const auto point2 = tier4_autoware_utils::calcOffsetPose(
-                          pose, -shape.dimensions.x / 2.0, -shape.dimensions.y / 2.0, 0.0)
-                          .position;
-    const auto point3 = tier4_autoware_utils::calcOffsetPose(
-                          pose, shape.dimensions.x / 2.0, -shape.dimensions.y / 2.0, 0.0)
-                          .position;
-
-    appendPointToPolygon(polygon, point0);
-    appendPointToPolygon(polygon, point1);
-    appendPointToPolygon(polygon, point2);
-    appendPointToPolygon(polygon, point3);
-  } else if (shape.type == autoware_auto_perception_msgs::msg::Shape::CYLINDER) {
-    const double radius = shape.dimensions.x / 2.0;
-    constexpr int circle_discrete_num = 6;
-    for (int i = 0; i < circle_discrete_num; ++i) {
-      geometry_msgs::msg::Point point;
-      point.x = std::cos(
-                  (static_cast<double>(i) / static_cast<double>(circle_discrete_num)) * 2.0 * M_PI +
-                  M_PI / static_cast<double>(circle_discrete_num)) *
-                  radius +
-                pose.position.x;
-      point.y = std::sin(
-                  (static_cast<double>(i) / static_cast<double>(circle_discrete_num)) * 2.0 * M_PI +
-                  M_PI / static_cast<double>(circle_discrete_num)) *
-                  radius +
-                pose.position.y;
-      appendPointToPolygon(polygon, point);
-    }
-  } else if (shape.type == autoware_auto_perception_msgs::msg::Shape::POLYGON) {
-    const double poly_yaw = tf2::getYaw(pose.orientation);
-    const auto rotated_footprint = rotatePolygon(shape.footprint, poly_yaw);
-    for (const auto rel_point : rotated_footprint.points) {
-      geometry_msgs::msg::Point abs_point;
-      abs_point.x = pose.position.x + rel_point.x;
-      abs_point.y = pose.position.y + rel_point.y;
-
-      appendPointToPolygon(polygon, abs_point);
-    }
-  } else {
-    throw std::logic_error("The shape type is not supported in tier4_autoware_utils.");
-  }
-
-  // NOTE: push back the first point in order to close polygon
-  if (!polygon.outer().empty()) {
-    appendPointToPolygon(polygon, polygon.outer().front());
-  }
+void toPolygon2d(
+  const geometry_msgs::msg::Pose & pose, const autoware_auto_perception_msgs::msg::Shape & shape,
+  Polygon2d & polygon)
+{
+  toPolygon2dImpl(pose, shape, polygon);
+}
 
-  return isClockwise(polygon) ? polygon : inverseClockwise(polygon);
+void toPolygon2d(
+  const geometry_msgs::msg::Pose & pose, const autoware_auto_perception_msgs::msg::Shape & shape,
+  SmallPolygon2d & polygon)
+{
+  toPolygon2dImpl(pose, shape, polygon);
 }
 
 tier4_autoware_utils::Polygon2d toPolygon2d(
@@ -200,27 +276,45 @@ tier4_autoware_utils::Polygon2d toPolygon2d(
     object.kinematics.initial_pose_with_covariance.pose, object.shape);
 }
 
+void toPolygon2d(
+  const autoware_auto_perception_msgs::msg::DetectedObject & object, SmallPolygon2d & polygon)
+{
+  toPolygon2dImpl(object.kinematics.pose_with_covariance.pose, object.shape, polygon);
+}
+
+void toPolygon2d(
+  const autoware_auto_perception_msgs::msg::TrackedObject & object, SmallPolygon2d & polygon)
+{
+  toPolygon2dImpl(object.kinematics.pose_with_covariance.pose, object.shape, polygon);
+}
+
+void toPolygon2d(
+  const autoware_auto_perception_msgs::msg::PredictedObject & object, SmallPolygon2d & polygon)
+{
+  toPolygon2dImpl(object.kinematics.initial_pose_with_covariance.pose, object.shape, polygon);
+}
+
 Polygon2d toFootprint(
   const geometry_msgs::msg::Pose & base_link_pose, const double base_to_front,
   const double base_to_rear, const double width)
 {
   Polygon2d polygon;
-  const auto point0 =
-    tier4_autoware_utils::calcOffsetPose(base_link_pose, base_to_front, width / 2.0, 0.0).position;
-  const auto point1 =
-    tier4_autoware_utils::calcOffsetPose(base_link_pose, base_to_front, -width / 2.0, 0.0).position;
-  const auto point2 =
-    tier4_autoware_utils::calcOffsetPose(base_link_pose, -base_to_rear, -width / 2.0, 0.0).position;
-  const auto point3 =
-    tier4_autoware_utils::calcOffsetPose(base_link_pose, -base_to_rear, width / 2.0, 0.0).position;
+  toFootprintImpl(base_link_pose, base_to_front, base_to_rear, width, polygon);
+  return polygon;
+}
 
-  appendPointToPolygon(polygon, point0);
-  appendPointToPolygon(polygon, point1);
-  appendPointToPolygon(polygon, point2);
-  appendPointToPolygon(polygon, point3);
-  appendPointToPolygon(polygon, point0);
+void toFootprint(
+  const geometry_msgs::msg::Pose & base_link_pose, const double base_to_front,
+  const double base_to_rear, const double width, Polygon2d & polygon)
+{
+  toFootprintImpl(base_link_pose, base_to_front, base_to_rear, width, polygon);
+}
 
-  return isClockwise(polygon) ? polygon : inverseClockwise(polygon);
+void toFootprint(
+  const geometry_msgs::msg::Pose & base_link_pose, const double base_to_front,
+  const double base_to_rear, const double width, SmallPolygon2d & polygon)
+{
+  toFootprintImpl(base_link_pose, base_to_front, base_to_rear, width, polygon);
 }
 
 double getArea(const autoware_auto_perception_msgs::msg::Shape & shape)
@@ -0,0 +1,165 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/geometry/convex_polygon_utils.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace tier4_autoware_utils
+{
+ConvexPolygonHalfPlanes::ConvexPolygonHalfPlanes(const Polygon2d & convex_polygon)
+{
+  const auto & ring = convex_polygon.outer();
+  const size_t num_vertices = ring.size();
+
+  // positive if counter-clockwise
+  double twice_signed_area = 0.0;
+  for (size_t i = 0; i < num_vertices; ++i) {
+    const auto & p = ring.at(i);
+    const auto & q = ring.at((i + 1) % num_vertices);
+    twice_signed_area += p.x() * q.y() - q.x() * p.y();
+  }
+
+  // NOTE: no point is inside of a degenerate polygon
+  if (twice_signed_area == 0.0) {
+    ax_.push_back(0.0);
+    ay_.push_back(0.0);
+    ex_.push_back(0.0);
+    ey_.push_back(0.0);
+  } else {
+    const double sign = 0.0 < twice_signed_area ? -1.0 : 1.0;
+    for (size_t i = 0; i < num_vertices; ++i) {
+      const auto & p = ring.at(i);
+      const auto & q = ring.at((i + 1) % num_vertices);
+      if (p.x() == q.x() && p.y() == q.y()) {
+        // e.g. the closing point
+        continue;
+      }
+      ax_.push_back(p.x());
+      ay_.push_back(p.y());
+      ex_.push_back(sign * (q.x() - p.x()));
+      ey_.push_back(sign * (q.y() - p.y()));
+    }
+  }
+
+  ax_f_.assign(ax_.begin(), ax_.end());
+  ay_f_.assign(ay_.begin(), ay_.end());
+  ex_f_.assign(ex_.begin(), ex_.end());
+  ey_f_.assign(ey_.begin(), ey_.end());
+}
+
+bool ConvexPolygonHalfPlanes::within(const Point2d & point) const
+{
+  for (size_t i = 0; i < ax_.size(); ++i) {
+    if (0.0 <= ex_.at(i) * (point.y() - ay_.at(i)) - ey_.at(i) * (point.x() - ax_.at(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+uint32_t ConvexPolygonHalfPlanes::withinBatch(
+  const float * xs, const float * ys, const size_t num_points) const
+{
+  if (batch_size < num_points) {
+    throw std::invalid_argument("The number of points exceeds the batch size.");
+  }
+
+  // pad the points so that the vector paths can always load the full batch
+  alignas(32) float batch_xs[batch_size] = {};
+  alignas(32) float batch_ys[batch_size] = {};
+  std::copy(xs, xs + num_points, batch_xs);
+  std::copy(ys, ys + num_points, batch_ys);
+
+  uint32_t mask = 0;
+  const size_t num_edges = ax_f_.size();
+#if defined(__AVX2__)
+  constexpr size_t lanes = 8;
+  for (size_t base = 0; base < batch_size; base += lanes) {
+    const __m256 x = _mm256_load_ps(batch_xs + base);
+    const __m256 y = _mm256_load_ps(batch_ys + base);
+    __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+    for (size_t i = 0; i < num_edges; ++i) {
+      const __m256 dy = _mm256_sub_ps(y, _mm256_set1_ps(ay_f_[i]));
+      const __m256 dx = _mm256_sub_ps(x, _mm256_set1_ps(ax_f_[i]));
+      const __m256 cross = _mm256_sub_ps(
+        _mm256_mul_ps(_mm256_set1_ps(ex_f_[i]), dy), _mm256_mul_ps(_mm256_set1_ps(ey_f_[i]), dx));
+      inside = _mm256_and_ps(inside, _mm256_cmp_ps(cross, _mm256_setzero_ps(), _CMP_LT_OQ));
+    }
+    mask |= static_cast<uint32_t>(_mm256_movemask_ps(inside)) << base;
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  constexpr size_t lanes = 4;
+  const uint32_t lane_bits_array[lanes] = {1, 2, 4, 8};
+  const uint32x4_t lane_bits = vld1q_u32(lane_bits_array);
+  for (size_t base = 0; base < batch_size; base += lanes) {
+    const float32x4_t x = vld1q_f32(batch_xs + base);
+    const float32x4_t y = vld1q_f32(batch_ys + base);
+    uint32x4_t inside = vdupq_n_u32(0xFFFFFFFF);
+    for (size_t i = 0; i < num_edges; ++i) {
+      const float32x4_t dy = vsubq_f32(y, vdupq_n_f32(ay_f_[i]));
+      const float32x4_t dx = vsubq_f32(x, vdupq_n_f32(ax_f_[i]));
+      const float32x4_t cross =
+        vsubq_f32(vmulq_n_f32(dy, ex_f_[i]), vmulq_n_f32(dx, ey_f_[i]));
+      inside = vandq_u32(inside, vcltq_f32(cross, vdupq_n_f32(0.0f)));
+    }
+    mask |= vaddvq_u32(vandq_u32(inside, lane_bits)) << base;
+  }
+#else
+  for (size_t j = 0; j < batch_size; ++j) {
+    bool inside = true;
+    for (size_t i = 0; i < num_edges; ++i) {
+      const float cross =
+        ex_f_[i] * (batch_ys[j] - ay_f_[i]) - ey_f_[i] * (batch_xs[j] - ax_f_[i]);
+      inside &= cross < 0.0f;
+    }
+    mask |= static_cast<uint32_t>(inside) << j;
+  }
+#endif
+
+  // ignore the padding
+  return mask & ((static_cast<uint32_t>(1) << num_points) - 1);
+}
+
+void ConvexPolygonHalfPlanes::within(
+  const std::vector<float> & xs, const std::vector<float> & ys,
+  std::vector<uint8_t> & is_within) const
+{
+  if (xs.size() != ys.size()) {
+    throw std::invalid_argument("The sizes of xs and ys are different.");
+  }
+
+  is_within.resize(xs.size());
+  within(xs.data(), ys.data(), xs.size(), is_within.data());
+}
+
+void ConvexPolygonHalfPlanes::within(
+  const float * xs, const float * ys, const size_t num_points, uint8_t * is_within) const
+{
+  for (size_t base = 0; base < num_points; base += batch_size) {
+    const size_t batch_num_points = std::min(batch_size, num_points - base);
+    const uint32_t mask = withinBatch(xs + base, ys + base, batch_num_points);
+    for (size_t i = 0; i < batch_num_points; ++i) {
+      is_within[base + i] = static_cast<uint8_t>((mask >> i) & 1);
+    }
+  }
+}
+}  // namespace tier4_autoware_utils
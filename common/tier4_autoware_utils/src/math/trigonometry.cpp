@@ -17,7 +17,13 @@
 #include "tier4_autoware_utils/math/constants.hpp"
 #include "tier4_autoware_utils/math/sin_table.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace tier4_autoware_utils
 {
@@ -49,4 +55,94 @@ float cos(float radian)
   return sin(radian + static_cast<float>(tier4_autoware_utils::pi) / 2.f);
 }
 
+namespace
+{
+// the table index of the radian in [0, discrete_arcs_num_360)
+// NOTE: 32 bit integers are used so that the table lookups are vectorized as gather
+inline uint32_t calc_table_index(const float radian)
+{
+  const float degree = radian * (180.f / static_cast<float>(tier4_autoware_utils::pi)) *
+                       (discrete_arcs_num_360 / 360.f);
+  // NOTE: discrete_arcs_num_360 is a power of 2, so the bit mask is the positive modulo
+  return static_cast<uint32_t>(static_cast<int32_t>(std::nearbyint(degree))) &
+         static_cast<uint32_t>(discrete_arcs_num_360 - 1);
+}
+
+// sin of the table index in [0, discrete_arcs_num_360) without branches
+inline float sin_from_table_index(const uint32_t idx)
+{
+  constexpr auto num_90 = static_cast<uint32_t>(discrete_arcs_num_90);
+  const uint32_t quadrant = idx / num_90;
+  const uint32_t idx_in_quadrant = idx % num_90;
+  const uint32_t table_idx = (quadrant & 1) ? num_90 - idx_in_quadrant : idx_in_quadrant;
+  const float value = g_sin_table[table_idx];
+  return (quadrant & 2) ? -value : value;
+}
+
+inline float atan_in_unit_range(const float x)
+{
+  // Abramowitz and Stegun 4.4.49
+  const float x2 = x * x;
+  return x * (0.9998660f +
+              x2 * (-0.3302995f + x2 * (0.1801410f + x2 * (-0.0851330f + x2 * 0.0208351f))));
+}
+}  // namespace
+
+std::pair<float, float> sin_and_cos(float radian)
+{
+  const uint32_t idx = calc_table_index(radian);
+  const uint32_t cos_idx = (idx + discrete_arcs_num_90) & (discrete_arcs_num_360 - 1);
+  return {sin_from_table_index(idx), sin_from_table_index(cos_idx)};
+}
+
+void sin_and_cos(
+  const std::vector<float> & radians, std::vector<float> & sin_values,
+  std::vector<float> & cos_values)
+{
+  sin_values.resize(radians.size());
+  cos_values.resize(radians.size());
+  for (size_t i = 0; i < radians.size(); ++i) {
+    const uint32_t idx = calc_table_index(radians[i]);
+    const uint32_t cos_idx = (idx + discrete_arcs_num_90) & (discrete_arcs_num_360 - 1);
+    sin_values[i] = sin_from_table_index(idx);
+    cos_values[i] = sin_from_table_index(cos_idx);
+  }
+}
+
+float fast_atan2(float dy, float dx)
+{
+  const float abs_dx = std::abs(dx);
+  const float abs_dy = std::abs(dy);
+  const float max_abs = std::max(abs_dx, abs_dy);
+  const float min_abs = std::min(abs_dx, abs_dy);
+
+  // the angle in [0, pi / 4] is folded into [-pi, pi] by the octant
+  // NOTE: max_abs is not replaced unless it is 0, which gives 0 [rad] without branches
+  const float ratio = min_abs / std::max(max_abs, std::numeric_limits<float>::denorm_min());
+  const float radian_in_octant = atan_in_unit_range(ratio);
+
+  // NOTE: Only constants are selected by the conditions, so that the selection is done without
+  //       branches. A floating point operation in a conditional expression is not vectorized.
+  constexpr float pi = static_cast<float>(tier4_autoware_utils::pi);
+  const bool is_steep = abs_dx < abs_dy;
+  const bool is_backward = dx < 0.f;
+  const float radian_in_quadrant =
+    (is_steep ? pi / 2.f : 0.f) + (is_steep ? -1.f : 1.f) * radian_in_octant;
+  const float radian = (is_backward ? pi : 0.f) + (is_backward ? -1.f : 1.f) * radian_in_quadrant;
+  return std::copysign(radian, dy);
+}
+
+void fast_atan2(
+  const std::vector<float> & dy, const std::vector<float> & dx, std::vector<float> & radians)
+{
+  if (dy.size() != dx.size()) {
+    throw std::invalid_argument("The size of dy and dx are not the same.");
+  }
+
+  radians.resize(dy.size());
+  for (size_t i = 0; i < dy.size(); ++i) {
+    radians[i] = fast_atan2(dy[i], dx[i]);
+  }
+}
+
 }  // namespace tier4_autoware_utils
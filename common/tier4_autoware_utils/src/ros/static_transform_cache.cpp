@@ -0,0 +1,152 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/ros/static_transform_cache.hpp"
+
+#include <tf2_ros/qos.hpp>
+
+#include <memory>
+#include <unordered_set>
+#include <utility>
+
+namespace tier4_autoware_utils
+{
+StaticTransformCache::StaticTransformCache(rclcpp::Node * node, tf2_ros::Buffer & tf_buffer)
+: tf_buffer_(tf_buffer)
+{
+  sub_tf_static_ = node->create_subscription<tf2_msgs::msg::TFMessage>(
+    "/tf_static", tf2_ros::StaticListenerQoS(),
+    [this](const tf2_msgs::msg::TFMessage::ConstSharedPtr msg) { addStaticTransforms(*msg); });
+}
+
+StaticTransformCache::StaticTransformCache(tf2_ros::Buffer & tf_buffer) : tf_buffer_(tf_buffer)
+{
+}
+
+void StaticTransformCache::addStaticTransforms(const tf2_msgs::msg::TFMessage & msg)
+{
+  if (msg.transforms.empty()) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto & transform : msg.transforms) {
+    static_parents_[transform.child_frame_id] = transform.header.frame_id;
+  }
+  entries_.reset();
+}
+
+geometry_msgs::msg::TransformStamped StaticTransformCache::lookupTransform(
+  const std::string & target_frame, const std::string & source_frame, const rclcpp::Time & time,
+  const rclcpp::Duration & timeout)
+{
+  return lookupTransform(
+    target_frame, source_frame, tf2_ros::fromRclcpp(time), tf2_ros::fromRclcpp(timeout));
+}
+
+geometry_msgs::msg::TransformStamped StaticTransformCache::lookupTransform(
+  const std::string & target_frame, const std::string & source_frame, const tf2::TimePoint & time,
+  const tf2::Duration & timeout)
+{
+  geometry_msgs::msg::TransformStamped transform;
+  if (getStaticTransform(target_frame, source_frame, transform)) {
+    // a static transform is stamped with the requested time, the same as tf2
+    transform.header.stamp = tf2_ros::toMsg(time);
+    return transform;
+  }
+  return tf_buffer_.lookupTransform(target_frame, source_frame, time, timeout);
+}
+
+bool StaticTransformCache::getStaticTransform(
+  const std::string & target_frame, const std::string & source_frame,
+  geometry_msgs::msg::TransformStamped & transform)
+{
+  const auto find_entry = [&](const std::shared_ptr<const Entries> & entries) -> const Entry * {
+    if (!entries) {
+      return nullptr;
+    }
+    for (const auto & entry : *entries) {
+      if (entry.target_frame == target_frame && entry.source_frame == source_frame) {
+        return &entry;
+      }
+    }
+    return nullptr;
+  };
+
+  {
+    const auto entries = entries_.load();
+    if (const auto * entry = find_entry(entries)) {
+      if (entry->is_static) {
+        transform = entry->transform;
+      }
+      return entry->is_static;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto entries = entries_.load();
+  if (const auto * entry = find_entry(entries)) {
+    if (entry->is_static) {
+      transform = entry->transform;
+    }
+    return entry->is_static;
+  }
+
+  const bool is_static = isStaticChain(target_frame, source_frame);
+  Entry new_entry{target_frame, source_frame, is_static, {}};
+  if (is_static) {
+    try {
+      new_entry.transform =
+        tf_buffer_.lookupTransform(target_frame, source_frame, tf2::TimePointZero);
+    } catch (const tf2::TransformException &) {
+      // the tf2 buffer has not received the static transforms yet, try again on the next lookup
+      return false;
+    }
+    transform = new_entry.transform;
+  }
+
+  auto new_entries = entries ? std::make_shared<Entries>(*entries) : std::make_shared<Entries>();
+  new_entries->push_back(std::move(new_entry));
+  entries_.store(std::move(new_entries));
+  return is_static;
+}
+
+bool StaticTransformCache::isStaticChain(
+  const std::string & target_frame, const std::string & source_frame) const
+{
+  // the frames from the source frame up to the root of its static subtree
+  std::unordered_set<std::string> source_frames;
+  for (std::string frame = source_frame; source_frames.insert(frame).second;) {
+    const auto parent = static_parents_.find(frame);
+    if (parent == static_parents_.end()) {
+      break;
+    }
+    frame = parent->second;
+  }
+
+  // the target frame is connected to the source frame if one of its static ancestors is visited
+  std::string frame = target_frame;
+  for (size_t i = 0; i <= static_parents_.size(); ++i) {
+    if (source_frames.count(frame) > 0) {
+      return true;
+    }
+    const auto parent = static_parents_.find(frame);
+    if (parent == static_parents_.end()) {
+      return false;
+    }
+    frame = parent->second;
+  }
+  return false;
+}
+}  // namespace tier4_autoware_utils
@@ -0,0 +1,149 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/system/scoped_probe.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace tier4_autoware_utils
+{
+namespace
+{
+struct ProbeRegistry
+{
+  std::mutex mutex;
+  std::vector<std::shared_ptr<ProbeBuffer>> buffers;
+  uint32_t num_threads{0};
+  // dropped count of the buffers of the exited threads
+  uint64_t dropped_count{0};
+};
+
+ProbeRegistry & getProbeRegistry()
+{
+  // NOTE: not destructed so that the probes in the destructors of static objects are safe
+  static auto * registry = new ProbeRegistry;
+  return *registry;
+}
+
+std::shared_ptr<ProbeBuffer> registerProbeBuffer()
+{
+  auto & registry = getProbeRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto buffer = std::make_shared<ProbeBuffer>(registry.num_threads++);
+  registry.buffers.push_back(buffer);
+  return buffer;
+}
+
+void writeJsonString(const char * str, std::ostream & os)
+{
+  os << '"';
+  for (const char * c = str; *c != '\0'; ++c) {
+    if (*c == '"' || *c == '\\') {
+      os << '\\';
+    }
+    os << *c;
+  }
+  os << '"';
+}
+}  // namespace
+
+ProbeBuffer & getThreadProbeBuffer()
+{
+  // NOTE: shared with the registry so that the records are not lost at the exit of the thread
+  thread_local const std::shared_ptr<ProbeBuffer> buffer = registerProbeBuffer();
+  return *buffer;
+}
+
+std::vector<ProbeRecord> drainProbeRecords()
+{
+  std::vector<ProbeRecord> records;
+  {
+    auto & registry = getProbeRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (const auto & buffer : registry.buffers) {
+      buffer->drain(records);
+    }
+
+    // remove the buffers of the exited threads, which have no producer any more
+    const auto is_exited = [&](const std::shared_ptr<ProbeBuffer> & buffer) {
+      if (buffer.use_count() != 1) {
+        return false;
+      }
+      buffer->drain(records);
+      registry.dropped_count += buffer->droppedCount();
+      return true;
+    };
+    registry.buffers.erase(
+      std::remove_if(registry.buffers.begin(), registry.buffers.end(), is_exited),
+      registry.buffers.end());
+  }
+
+  std::stable_sort(records.begin(), records.end(), [](const auto & a, const auto & b) {
+    return a.start < b.start;
+  });
+  return records;
+}
+
+uint64_t getDroppedProbeCount()
+{
+  auto & registry = getProbeRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  uint64_t dropped_count = registry.dropped_count;
+  for (const auto & buffer : registry.buffers) {
+    dropped_count += buffer->droppedCount();
+  }
+  return dropped_count;
+}
+
+std::map<std::string, double> calcProcessingTimeMap(const std::vector<ProbeRecord> & records)
+{
+  // NOTE: the names are compared by the pointer first since they are mostly the same literals
+  std::map<const char *, double> time_by_pointer;
+  for (const auto & record : records) {
+    time_by_pointer[record.name] +=
+      std::chrono::duration<double, std::milli>(record.duration).count();
+  }
+
+  std::map<std::string, double> processing_time_map;
+  for (const auto & [name, time_ms] : time_by_pointer) {
+    processing_time_map[name] += time_ms;
+  }
+  return processing_time_map;
+}
+
+void writeChromeTrace(const std::vector<ProbeRecord> & records, std::ostream & os)
+{
+  const auto flags = os.flags();
+  os << "{\"traceEvents\":[";
+  for (size_t i = 0; i < records.size(); ++i) {
+    const auto & record = records.at(i);
+    const double ts_us =
+      std::chrono::duration<double, std::micro>(record.start.time_since_epoch()).count();
+    const double dur_us = std::chrono::duration<double, std::micro>(record.duration).count();
+
+    os << (i == 0 ? "" : ",") << "{\"name\":";
+    writeJsonString(record.name, os);
+    os << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << record.thread_index << ",\"ts\":" << std::fixed
+       << ts_us << ",\"dur\":" << dur_us << "}";
+  }
+  os << "]}";
+  os.flags(flags);
+}
+}  // namespace tier4_autoware_utils
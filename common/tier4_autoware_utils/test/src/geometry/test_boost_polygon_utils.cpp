@@ -19,6 +19,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 using tier4_autoware_utils::Polygon2d;
 
 namespace
@@ -232,6 +234,59 @@ TEST(boost_geometry, boost_toFootprint)
   }
 }
 
+TEST(boost_geometry, boost_toPolygon2d_output)
+{
+  using tier4_autoware_utils::SmallPolygon2d;
+  using tier4_autoware_utils::toPolygon2d;
+
+  const auto pose = createPose(1.0, 1.0, M_PI_4);
+  std::vector<autoware_auto_perception_msgs::msg::Shape> shapes(3);
+  shapes.at(0).type = autoware_auto_perception_msgs::msg::Shape::BOUNDING_BOX;
+  shapes.at(0).dimensions.x = 1.0;
+  shapes.at(0).dimensions.y = 2.0;
+  shapes.at(1).type = autoware_auto_perception_msgs::msg::Shape::CYLINDER;
+  shapes.at(1).dimensions.x = 1.0;
+  shapes.at(2).type = autoware_auto_perception_msgs::msg::Shape::POLYGON;
+  shapes.at(2).footprint.points.push_back(createPoint32(-0.5, -0.5));
+  shapes.at(2).footprint.points.push_back(createPoint32(-0.5, 0.5));
+  shapes.at(2).footprint.points.push_back(createPoint32(0.5, 0.5));
+  shapes.at(2).footprint.points.push_back(createPoint32(0.5, -0.5));
+
+  // the previous points are cleared
+  Polygon2d poly{{{0.0, 0.0}, {1.0, 0.0}, {0.0, 1.0}, {0.0, 0.0}}};
+  SmallPolygon2d small_poly{{{0.0, 0.0}, {1.0, 0.0}, {0.0, 1.0}, {0.0, 0.0}}};
+  for (const auto & shape : shapes) {
+    const auto expected_poly = toPolygon2d(pose, shape);
+    toPolygon2d(pose, shape, poly);
+    toPolygon2d(pose, shape, small_poly);
+
+    ASSERT_EQ(poly.outer().size(), expected_poly.outer().size());
+    ASSERT_EQ(small_poly.outer().size(), expected_poly.outer().size());
+    for (size_t i = 0; i < expected_poly.outer().size(); ++i) {
+      EXPECT_DOUBLE_EQ(poly.outer().at(i).x(), expected_poly.outer().at(i).x());
+      EXPECT_DOUBLE_EQ(poly.outer().at(i).y(), expected_poly.outer().at(i).y());
+      EXPECT_DOUBLE_EQ(small_poly.outer().at(i).x(), expected_poly.outer().at(i).x());
+      EXPECT_DOUBLE_EQ(small_poly.outer().at(i).y(), expected_poly.outer().at(i).y());
+    }
+    EXPECT_TRUE(tier4_autoware_utils::isClockwise(small_poly));
+    EXPECT_NEAR(boost::geometry::area(small_poly), boost::geometry::area(expected_poly), 1e-10);
+  }
+
+  {  // footprint
+    const auto expected_poly = tier4_autoware_utils::toFootprint(pose, 4.0, 1.0, 2.0);
+    tier4_autoware_utils::toFootprint(pose, 4.0, 1.0, 2.0, small_poly);
+
+    ASSERT_EQ(small_poly.outer().size(), expected_poly.outer().size());
+    for (size_t i = 0; i < expected_poly.outer().size(); ++i) {
+      EXPECT_DOUBLE_EQ(small_poly.outer().at(i).x(), expected_poly.outer().at(i).x());
+      EXPECT_DOUBLE_EQ(small_poly.outer().at(i).y(), expected_poly.outer().at(i).y());
+    }
+    EXPECT_TRUE(boost::geometry::intersects(small_poly, expected_poly));
+    EXPECT_FALSE(boost::geometry::disjoint(
+      small_poly, tier4_autoware_utils::Point2d{pose.position.x, pose.position.y}));
+  }
+}
+
 TEST(boost_geometry, boost_getArea)
 {
   using tier4_autoware_utils::getArea;
@@ -0,0 +1,107 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/geometry/convex_polygon_utils.hpp"
+
+#include <boost/geometry/algorithms/reverse.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+using tier4_autoware_utils::ConvexPolygonHalfPlanes;
+using tier4_autoware_utils::Point2d;
+using tier4_autoware_utils::Polygon2d;
+
+namespace
+{
+Polygon2d createHexagon()
+{
+  Polygon2d polygon;
+  polygon.outer().emplace_back(0.0, 0.0);
+  polygon.outer().emplace_back(-1.0, 2.0);
+  polygon.outer().emplace_back(0.0, 4.0);
+  polygon.outer().emplace_back(3.0, 4.0);
+  polygon.outer().emplace_back(4.0, 2.0);
+  polygon.outer().emplace_back(3.0, 0.0);
+  polygon.outer().emplace_back(0.0, 0.0);
+  return polygon;
+}
+}  // namespace
+
+TEST(convex_polygon_utils, within)
+{
+  for (const bool reverse : {false, true}) {
+    auto polygon = createHexagon();
+    if (reverse) {
+      boost::geometry::reverse(polygon);
+    }
+    const ConvexPolygonHalfPlanes half_planes(polygon);
+
+    EXPECT_TRUE(half_planes.within(Point2d{1.0, 1.0}));
+    EXPECT_TRUE(half_planes.within(Point2d{3.5, 2.0}));
+    EXPECT_FALSE(half_planes.within(Point2d{-1.0, 1.0}));
+    EXPECT_FALSE(half_planes.within(Point2d{5.0, 2.0}));
+    // on the edge and vertex
+    EXPECT_FALSE(half_planes.within(Point2d{1.0, 0.0}));
+    EXPECT_FALSE(half_planes.within(Point2d{4.0, 2.0}));
+  }
+}
+
+TEST(convex_polygon_utils, withinBatch)
+{
+  const auto polygon = createHexagon();
+  const ConvexPolygonHalfPlanes half_planes(polygon);
+
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> dist(-2.0f, 6.0f);
+  for (const size_t num_points : {1, 7, 16, 37, 1000}) {
+    std::vector<float> xs;
+    std::vector<float> ys;
+    for (size_t i = 0; i < num_points; ++i) {
+      xs.push_back(dist(engine));
+      ys.push_back(dist(engine));
+    }
+
+    std::vector<uint8_t> is_within;
+    half_planes.within(xs, ys, is_within);
+    ASSERT_EQ(is_within.size(), num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+      const Point2d point{xs.at(i), ys.at(i)};
+      EXPECT_EQ(static_cast<bool>(is_within.at(i)), boost::geometry::within(point, polygon));
+    }
+  }
+
+  const std::vector<float> xs{1.0f, -1.0f, 2.0f};
+  const std::vector<float> ys{1.0f, 1.0f, 3.0f};
+  EXPECT_EQ(half_planes.withinBatch(xs.data(), ys.data(), xs.size()), 0b101u);
+  EXPECT_THROW(
+    half_planes.withinBatch(xs.data(), ys.data(), ConvexPolygonHalfPlanes::batch_size + 1),
+    std::invalid_argument);
+}
+
+TEST(convex_polygon_utils, degenerate_polygon)
+{
+  Polygon2d polygon;
+  polygon.outer().emplace_back(0.0, 0.0);
+  polygon.outer().emplace_back(1.0, 1.0);
+  polygon.outer().emplace_back(0.0, 0.0);
+  const ConvexPolygonHalfPlanes half_planes(polygon);
+  EXPECT_FALSE(half_planes.within(Point2d{0.5, 0.5}));
+
+  const ConvexPolygonHalfPlanes empty_half_planes(Polygon2d{});
+  EXPECT_FALSE(empty_half_planes.within(Point2d{0.0, 0.0}));
+}
@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <vector>
 
 TEST(trigonometry, sin)
 {
@@ -40,3 +41,49 @@ TEST(trigonometry, cos)
         tier4_autoware_utils::cos(x * static_cast<float>(i))) < 10e-5);
   }
 }
+
+TEST(trigonometry, sin_and_cos)
+{
+  std::vector<float> radians;
+  for (int i = -256; i < 256; i++) {
+    radians.push_back(4.f * tier4_autoware_utils::pi / 128.f * static_cast<float>(i) + 0.01f);
+  }
+
+  std::vector<float> sin_values;
+  std::vector<float> cos_values;
+  tier4_autoware_utils::sin_and_cos(radians, sin_values, cos_values);
+  ASSERT_EQ(sin_values.size(), radians.size());
+  ASSERT_EQ(cos_values.size(), radians.size());
+  for (size_t i = 0; i < radians.size(); i++) {
+    const auto sin_and_cos = tier4_autoware_utils::sin_and_cos(radians.at(i));
+    EXPECT_FLOAT_EQ(sin_and_cos.first, sin_values.at(i));
+    EXPECT_FLOAT_EQ(sin_and_cos.second, cos_values.at(i));
+    EXPECT_NEAR(sin_values.at(i), std::sin(radians.at(i)), 10e-5);
+    EXPECT_NEAR(cos_values.at(i), std::cos(radians.at(i)), 10e-5);
+  }
+}
+
+TEST(trigonometry, fast_atan2)
+{
+  std::vector<float> dy;
+  std::vector<float> dx;
+  for (int i = 0; i < 720; i++) {
+    const float radian = tier4_autoware_utils::pi / 360.f * static_cast<float>(i);
+    const float length = 0.1f + static_cast<float>(i % 7);
+    dy.push_back(length * std::sin(radian));
+    dx.push_back(length * std::cos(radian));
+  }
+
+  std::vector<float> radians;
+  tier4_autoware_utils::fast_atan2(dy, dx, radians);
+  ASSERT_EQ(radians.size(), dy.size());
+  for (size_t i = 0; i < dy.size(); i++) {
+    EXPECT_FLOAT_EQ(radians.at(i), tier4_autoware_utils::fast_atan2(dy.at(i), dx.at(i)));
+    EXPECT_NEAR(radians.at(i), std::atan2(dy.at(i), dx.at(i)), 2e-5);
+  }
+
+  EXPECT_FLOAT_EQ(tier4_autoware_utils::fast_atan2(0.f, 0.f), 0.f);
+  EXPECT_NEAR(tier4_autoware_utils::fast_atan2(0.f, -1.f), tier4_autoware_utils::pi, 2e-5);
+  EXPECT_NEAR(tier4_autoware_utils::fast_atan2(-1.f, 0.f), -tier4_autoware_utils::pi / 2, 2e-5);
+  EXPECT_THROW(tier4_autoware_utils::fast_atan2(dy, {}, radians), std::invalid_argument);
+}
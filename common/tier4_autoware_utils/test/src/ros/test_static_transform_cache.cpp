@@ -0,0 +1,122 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/ros/static_transform_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+namespace
+{
+geometry_msgs::msg::TransformStamped makeTransform(
+  const std::string & parent, const std::string & child, const double x, const int32_t sec = 0)
+{
+  geometry_msgs::msg::TransformStamped transform;
+  transform.header.stamp.sec = sec;
+  transform.header.frame_id = parent;
+  transform.child_frame_id = child;
+  transform.transform.translation.x = x;
+  transform.transform.rotation.w = 1.0;
+  return transform;
+}
+
+void setStaticTransform(
+  tf2_ros::Buffer & buffer, tier4_autoware_utils::StaticTransformCache & cache,
+  const geometry_msgs::msg::TransformStamped & transform)
+{
+  buffer.setTransform(transform, "test", true);
+  tf2_msgs::msg::TFMessage msg;
+  msg.transforms.push_back(transform);
+  cache.addStaticTransforms(msg);
+}
+}  // namespace
+
+TEST(ros, StaticTransformCache_static)
+{
+  tf2_ros::Buffer buffer(std::make_shared<rclcpp::Clock>());
+  tier4_autoware_utils::StaticTransformCache cache(buffer);
+
+  setStaticTransform(buffer, cache, makeTransform("base_link", "sensor_kit", 1.0));
+  setStaticTransform(buffer, cache, makeTransform("sensor_kit", "lidar", 2.0));
+  setStaticTransform(buffer, cache, makeTransform("sensor_kit", "camera", 4.0));
+
+  const auto transform = cache.lookupTransform("base_link", "lidar", tf2::TimePointZero);
+  EXPECT_DOUBLE_EQ(transform.transform.translation.x, 3.0);
+  EXPECT_EQ(transform.header.frame_id, "base_link");
+  EXPECT_EQ(transform.child_frame_id, "lidar");
+
+  // the frames are connected through their common parent
+  const auto transform_camera = cache.lookupTransform("camera", "lidar", tf2::TimePointZero);
+  EXPECT_DOUBLE_EQ(transform_camera.transform.translation.x, -2.0);
+
+  // the cached transform is stamped with the requested time
+  const auto transform_stamped =
+    cache.lookupTransform("base_link", "lidar", rclcpp::Time(10, 0), rclcpp::Duration(0, 0));
+  EXPECT_DOUBLE_EQ(transform_stamped.transform.translation.x, 3.0);
+  EXPECT_EQ(transform_stamped.header.stamp.sec, 10);
+
+  // the cached transform is used until a static transform is received by the cache
+  buffer.setTransform(makeTransform("sensor_kit", "lidar", 5.0), "test", true);
+  EXPECT_DOUBLE_EQ(
+    cache.lookupTransform("base_link", "lidar", tf2::TimePointZero).transform.translation.x, 3.0);
+
+  setStaticTransform(buffer, cache, makeTransform("sensor_kit", "lidar", 5.0));
+  EXPECT_DOUBLE_EQ(
+    cache.lookupTransform("base_link", "lidar", tf2::TimePointZero).transform.translation.x, 6.0);
+}
+
+TEST(ros, StaticTransformCache_dynamic)
+{
+  tf2_ros::Buffer buffer(std::make_shared<rclcpp::Clock>());
+  tier4_autoware_utils::StaticTransformCache cache(buffer);
+
+  setStaticTransform(buffer, cache, makeTransform("base_link", "lidar", 1.0));
+  buffer.setTransform(makeTransform("map", "base_link", 10.0, 1), "test", false);
+  buffer.setTransform(makeTransform("map", "base_link", 20.0, 2), "test", false);
+
+  // the dynamic transforms are interpolated by the tf2 buffer
+  const auto transform =
+    cache.lookupTransform("map", "lidar", rclcpp::Time(1, 500000000), rclcpp::Duration(0, 0));
+  EXPECT_DOUBLE_EQ(transform.transform.translation.x, 16.0);
+
+  buffer.setTransform(makeTransform("map", "base_link", 30.0, 3), "test", false);
+  EXPECT_DOUBLE_EQ(
+    cache.lookupTransform("map", "lidar", tf2::TimePointZero).transform.translation.x, 31.0);
+
+  // the errors of the tf2 buffer are forwarded
+  EXPECT_THROW(
+    cache.lookupTransform("map", "lidar", rclcpp::Time(10, 0), rclcpp::Duration(0, 0)),
+    tf2::TransformException);
+  EXPECT_THROW(
+    cache.lookupTransform("map", "unknown", tf2::TimePointZero), tf2::TransformException);
+}
+
+TEST(ros, StaticTransformCache_beforeBuffer)
+{
+  tf2_ros::Buffer buffer(std::make_shared<rclcpp::Clock>());
+  tier4_autoware_utils::StaticTransformCache cache(buffer);
+
+  // the cache received the static transform before the tf2 buffer
+  tf2_msgs::msg::TFMessage msg;
+  msg.transforms.push_back(makeTransform("base_link", "lidar", 1.0));
+  cache.addStaticTransforms(msg);
+  EXPECT_THROW(
+    cache.lookupTransform("base_link", "lidar", tf2::TimePointZero), tf2::TransformException);
+
+  buffer.setTransform(msg.transforms.front(), "test", true);
+  EXPECT_DOUBLE_EQ(
+    cache.lookupTransform("base_link", "lidar", tf2::TimePointZero).transform.translation.x, 1.0);
+}
@@ -0,0 +1,78 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/system/latest_mailbox.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST(system, LatestMailbox_storeLoad)
+{
+  using tier4_autoware_utils::LatestMailbox;
+
+  LatestMailbox<int> mailbox;
+  EXPECT_EQ(mailbox.load(), nullptr);
+
+  mailbox.store(std::make_shared<const int>(1));
+  ASSERT_NE(mailbox.load(), nullptr);
+  EXPECT_EQ(*mailbox.load(), 1);
+
+  const auto previous = mailbox.load();
+  mailbox.store(std::make_shared<const int>(2));
+  EXPECT_EQ(*mailbox.load(), 2);
+  // loaded values are not modified by later stores
+  EXPECT_EQ(*previous, 1);
+
+  mailbox.reset();
+  EXPECT_EQ(mailbox.load(), nullptr);
+}
+
+TEST(system, LatestMailbox_concurrent)
+{
+  using tier4_autoware_utils::LatestMailbox;
+
+  struct Data
+  {
+    int a;
+    int b;
+  };
+  LatestMailbox<Data> mailbox;
+  std::atomic<bool> done{false};
+
+  std::thread writer([&]() {
+    for (int i = 0; i < 100000; ++i) mailbox.store(std::make_shared<const Data>(Data{i, -i}));
+    done = true;
+  });
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 2; ++r) {
+    readers.emplace_back([&]() {
+      int last_a = -1;
+      while (!done) {
+        const auto data = mailbox.load();
+        if (!data) continue;
+        // values are complete and never go back in time
+        EXPECT_EQ(data->a, -data->b);
+        EXPECT_GE(data->a, last_a);
+        last_a = data->a;
+      }
+    });
+  }
+  writer.join();
+  for (auto & reader : readers) reader.join();
+  EXPECT_EQ(mailbox.load()->a, 99999);
+}
@@ -0,0 +1,141 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/system/scoped_probe.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(system, ScopedProbe_record)
+{
+  using tier4_autoware_utils::drainProbeRecords;
+
+  drainProbeRecords();
+  {
+    TIER4_AUTOWARE_UTILS_SCOPED_PROBE("outer");
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    {
+      TIER4_AUTOWARE_UTILS_SCOPED_FUNCTION_PROBE();
+    }
+  }
+
+  // sorted by the start time
+  const auto records = drainProbeRecords();
+  ASSERT_EQ(records.size(), 2U);
+  EXPECT_STREQ(records.at(0).name, "outer");
+  EXPECT_STREQ(records.at(1).name, "TestBody");
+  EXPECT_GE(records.at(0).duration, std::chrono::milliseconds(10));
+  EXPECT_LE(records.at(0).start, records.at(1).start);
+  EXPECT_EQ(records.at(0).thread_index, records.at(1).thread_index);
+
+  // drained
+  EXPECT_TRUE(drainProbeRecords().empty());
+}
+
+TEST(system, ScopedProbe_multiThread)
+{
+  using tier4_autoware_utils::drainProbeRecords;
+
+  drainProbeRecords();
+  constexpr size_t num_threads = 4;
+  constexpr size_t num_probes = 1000;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&]() {
+      for (size_t j = 0; j < num_probes; ++j) {
+        TIER4_AUTOWARE_UTILS_SCOPED_PROBE("worker");
+      }
+    });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+
+  // the records of the exited threads are kept
+  const auto records = drainProbeRecords();
+  EXPECT_EQ(records.size(), num_threads * num_probes);
+  for (size_t i = 1; i < records.size(); ++i) {
+    EXPECT_LE(records.at(i - 1).start, records.at(i).start);
+  }
+}
+
+TEST(system, ScopedProbe_dropWhenFull)
+{
+  using tier4_autoware_utils::drainProbeRecords;
+  using tier4_autoware_utils::getDroppedProbeCount;
+  using tier4_autoware_utils::ProbeBuffer;
+
+  drainProbeRecords();
+  const auto dropped_count = getDroppedProbeCount();
+  for (size_t i = 0; i < ProbeBuffer::capacity + 10; ++i) {
+    TIER4_AUTOWARE_UTILS_SCOPED_PROBE("full");
+  }
+  EXPECT_EQ(getDroppedProbeCount() - dropped_count, 10U);
+  EXPECT_EQ(drainProbeRecords().size(), ProbeBuffer::capacity);
+
+  // pushed again after drain
+  {
+    TIER4_AUTOWARE_UTILS_SCOPED_PROBE("full");
+  }
+  EXPECT_EQ(drainProbeRecords().size(), 1U);
+}
+
+TEST(system, ScopedProbe_calcProcessingTimeMap)
+{
+  using tier4_autoware_utils::ProbeRecord;
+
+  const auto start = std::chrono::steady_clock::time_point{};
+  const std::string name = "b";
+  const std::vector<ProbeRecord> records{
+    {"a", start, std::chrono::microseconds(1500), 0},
+    {"a", start, std::chrono::microseconds(500), 1},
+    {name.c_str(), start, std::chrono::milliseconds(3), 0},
+    {"b", start, std::chrono::milliseconds(1), 0},
+  };
+
+  // the same names of different pointers are merged
+  const auto processing_time_map = tier4_autoware_utils::calcProcessingTimeMap(records);
+  ASSERT_EQ(processing_time_map.size(), 2U);
+  EXPECT_DOUBLE_EQ(processing_time_map.at("a"), 2.0);
+  EXPECT_DOUBLE_EQ(processing_time_map.at("b"), 4.0);
+}
+
+TEST(system, ScopedProbe_writeChromeTrace)
+{
+  using tier4_autoware_utils::ProbeRecord;
+
+  const auto start = std::chrono::steady_clock::time_point{std::chrono::microseconds(10)};
+  const std::vector<ProbeRecord> records{
+    {"a", start, std::chrono::microseconds(2), 0},
+    {"b\"c", start, std::chrono::microseconds(3), 1},
+  };
+
+  std::ostringstream os;
+  tier4_autoware_utils::writeChromeTrace(records, os);
+  EXPECT_EQ(
+    os.str(),
+    "{\"traceEvents\":["
+    "{\"name\":\"a\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":10.000000,\"dur\":2.000000},"
+    "{\"name\":\"b\\\"c\",\"ph\":\"X\",\"pid\":0,\"tid\":1,\"ts\":10.000000,\"dur\":3.000000}"
+    "]}");
+
+  std::ostringstream empty_os;
+  tier4_autoware_utils::writeChromeTrace({}, empty_os);
+  EXPECT_EQ(empty_os.str(), "{\"traceEvents\":[]}");
+}
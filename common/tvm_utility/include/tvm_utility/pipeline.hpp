@@ -23,10 +23,19 @@
 #include <tvm_vendor/tvm/runtime/packed_func.h>
 #include <tvm_vendor/tvm/runtime/registry.h>
 
+#include <algorithm>
+#include <array>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <exception>
 #include <fstream>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -183,6 +192,289 @@ private:
   PostProcessorType post_processor_{};
 };
 
+/**
+ * @brief Copy the data of the arrays into the arrays of dst. The arrays of dst are allocated only
+ * when their shape, type or device does not match, so that dst can be reused for the next copy.
+ *
+ * @param src The arrays to copy
+ * @param dst The arrays to copy into
+ */
+inline void copyTVMArrays(const TVMArrayContainerVector & src, TVMArrayContainerVector & dst)
+{
+  const auto is_same_layout = [](const DLTensor & a, const DLTensor & b) {
+    return a.ndim == b.ndim && std::equal(a.shape, a.shape + a.ndim, b.shape) &&
+           a.dtype.code == b.dtype.code && a.dtype.bits == b.dtype.bits &&
+           a.dtype.lanes == b.dtype.lanes && a.device.device_type == b.device.device_type &&
+           a.device.device_id == b.device.device_id;
+  };
+
+  if (dst.size() != src.size()) {
+    dst.clear();
+  }
+  for (size_t index = 0; index < src.size(); ++index) {
+    const TVMArrayHandle src_array = src[index].getArray();
+    if (src_array == nullptr) {
+      throw std::runtime_error("input variable is null");
+    }
+    if (dst.size() <= index || !is_same_layout(*src_array, *dst[index].getArray())) {
+      TVMArrayContainer array{
+        std::vector<int64_t>(src_array->shape, src_array->shape + src_array->ndim),
+        static_cast<DLDataTypeCode>(src_array->dtype.code),
+        src_array->dtype.bits,
+        src_array->dtype.lanes,
+        src_array->device.device_type,
+        src_array->device.device_id};
+      if (dst.size() <= index) {
+        dst.push_back(array);
+      } else {
+        dst[index] = array;
+      }
+    }
+    if (TVMArrayCopyFromTo(src_array, dst[index].getArray(), nullptr) != 0) {
+      throw std::runtime_error(std::string("failed to copy the array: ") + TVMGetLastError());
+    }
+  }
+}
+
+/**
+ * @class BoundedQueue
+ * @brief Blocking FIFO queue with a fixed capacity, used to pass data between the threads of an
+ * AsyncPipeline.
+ */
+template <class T>
+class BoundedQueue
+{
+public:
+  explicit BoundedQueue(const size_t capacity) : capacity_(std::max<size_t>(capacity, 1)) {}
+
+  /**
+   * @brief Push an item, waiting while the queue is full.
+   *
+   * @return false if the queue was closed, in which case the item is dropped
+   */
+  bool push(T && item)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [this] { return closed_ || items_.size() < capacity_; });
+    if (closed_) {
+      return false;
+    }
+    items_.push_back(std::move(item));
+    not_empty_.notify_one();
+    return true;
+  }
+
+  /**
+   * @brief Pop an item, waiting while the queue is empty.
+   *
+   * @return false if the queue was closed
+   */
+  bool pop(T & item)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return closed_ || !items_.empty(); });
+    if (closed_) {
+      return false;
+    }
+    item = std::move(items_.front());
+    items_.pop_front();
+    not_full_.notify_one();
+    return true;
+  }
+
+  /**
+   * @brief Wake up all the waiting threads and make all the following calls fail.
+   */
+  void close()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+    not_empty_.notify_all();
+    not_full_.notify_all();
+  }
+
+private:
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  std::deque<T> items_;
+  size_t capacity_;
+  bool closed_{false};
+};
+
+/**
+ * @class AsyncPipeline
+ * @brief Inference Pipeline whose 3 stages run on their own threads, so that the pre-processing of
+ * an input overlaps with the inference of the previous one and the post-processing of the one
+ * before. The inputs are processed in the order they are scheduled.
+ *
+ * The stages often return tensors which they overwrite on the next call, so the tensors are copied
+ * into buffers owned by the pipeline when passed to the next stage. There are queue_size + 1
+ * buffers between two stages, and a stage waits for a free buffer, so that at most queue_size
+ * inputs wait before each stage.
+ */
+template <class PreProcessorType, class InferenceEngineType, class PostProcessorType>
+class AsyncPipeline
+{
+  using InputType = decltype(std::declval<PreProcessorType>().input_type_indicator_);
+  using OutputType = decltype(std::declval<PostProcessorType>().output_type_indicator_);
+
+public:
+  /**
+   * @brief Construct a new AsyncPipeline object and start its threads
+   *
+   * @param pre_processor a PreProcessor object
+   * @param inference_engine a InferenceEngine object
+   * @param post_processor a PostProcessor object
+   * @param queue_size maximum number of inputs waiting before each stage
+   */
+  AsyncPipeline(
+    PreProcessorType pre_processor, InferenceEngineType inference_engine,
+    PostProcessorType post_processor, const size_t queue_size = 1)
+  : pre_processor_(pre_processor),
+    inference_engine_(inference_engine),
+    post_processor_(post_processor),
+    input_queue_(queue_size),
+    pre_processed_queue_(queue_size),
+    inferred_queue_(queue_size),
+    pre_processed_buffers_(std::max<size_t>(queue_size, 1) + 1),
+    inferred_buffers_(std::max<size_t>(queue_size, 1) + 1)
+  {
+    for (size_t i = 0; i < std::max<size_t>(queue_size, 1) + 1; ++i) {
+      pre_processed_buffers_.push(TVMArrayContainerVector{});
+      inferred_buffers_.push(TVMArrayContainerVector{});
+    }
+    pre_processor_thread_ = std::thread([this] { runPreProcessor(); });
+    inference_engine_thread_ = std::thread([this] { runInferenceEngine(); });
+    post_processor_thread_ = std::thread([this] { runPostProcessor(); });
+  }
+
+  AsyncPipeline(const AsyncPipeline &) = delete;
+  AsyncPipeline & operator=(const AsyncPipeline &) = delete;
+
+  /**
+   * @brief Stop the threads. The outputs which are not ready are abandoned, and their futures
+   * throw std::future_error.
+   */
+  ~AsyncPipeline()
+  {
+    input_queue_.close();
+    pre_processed_queue_.close();
+    inferred_queue_.close();
+    pre_processed_buffers_.close();
+    inferred_buffers_.close();
+    pre_processor_thread_.join();
+    inference_engine_thread_.join();
+    post_processor_thread_.join();
+  }
+
+  /**
+   * @brief push the data into the pipeline, waiting while queue_size inputs already wait for the
+   * pre-processor. An exception thrown by a stage is rethrown by the future.
+   *
+   * @param input The data to push into the pipeline
+   * @return The future of the pipeline output
+   */
+  std::future<OutputType> schedule(const InputType & input)
+  {
+    InputItem item{input, {}};
+    auto output = item.output.get_future();
+    input_queue_.push(std::move(item));
+    return output;
+  }
+
+private:
+  struct InputItem
+  {
+    InputType input;
+    std::promise<OutputType> output;
+  };
+
+  struct TensorItem
+  {
+    TVMArrayContainerVector tensors;
+    std::promise<OutputType> output;
+  };
+
+  // Run a stage and copy its output into a free buffer. The item is given up on an exception.
+  template <class StageType, class StageInputType>
+  static bool runStage(
+    StageType & stage, const StageInputType & input, std::promise<OutputType> & output,
+    BoundedQueue<TVMArrayContainerVector> & free_buffers, TVMArrayContainerVector & buffer)
+  {
+    TVMArrayContainerVector tensors;
+    try {
+      tensors = stage.schedule(input);
+    } catch (...) {
+      output.set_exception(std::current_exception());
+      return false;
+    }
+    if (!free_buffers.pop(buffer)) {
+      return false;
+    }
+    try {
+      copyTVMArrays(tensors, buffer);
+    } catch (...) {
+      output.set_exception(std::current_exception());
+      free_buffers.push(std::move(buffer));
+      return false;
+    }
+    return true;
+  }
+
+  void runPreProcessor()
+  {
+    InputItem item;
+    while (input_queue_.pop(item)) {
+      TensorItem next{};
+      if (runStage(pre_processor_, item.input, item.output, pre_processed_buffers_, next.tensors)) {
+        next.output = std::move(item.output);
+        pre_processed_queue_.push(std::move(next));
+      }
+    }
+  }
+
+  void runInferenceEngine()
+  {
+    TensorItem item;
+    while (pre_processed_queue_.pop(item)) {
+      TensorItem next{};
+      const bool is_done = runStage(
+        inference_engine_, item.tensors, item.output, inferred_buffers_, next.tensors);
+      pre_processed_buffers_.push(std::move(item.tensors));
+      if (is_done) {
+        next.output = std::move(item.output);
+        inferred_queue_.push(std::move(next));
+      }
+    }
+  }
+
+  void runPostProcessor()
+  {
+    TensorItem item;
+    while (inferred_queue_.pop(item)) {
+      try {
+        item.output.set_value(post_processor_.schedule(item.tensors));
+      } catch (...) {
+        item.output.set_exception(std::current_exception());
+      }
+      inferred_buffers_.push(std::move(item.tensors));
+    }
+  }
+
+  PreProcessorType pre_processor_;
+  InferenceEngineType inference_engine_;
+  PostProcessorType post_processor_;
+  BoundedQueue<InputItem> input_queue_;
+  BoundedQueue<TensorItem> pre_processed_queue_;
+  BoundedQueue<TensorItem> inferred_queue_;
+  BoundedQueue<TVMArrayContainerVector> pre_processed_buffers_;
+  BoundedQueue<TVMArrayContainerVector> inferred_buffers_;
+  std::thread pre_processor_thread_;
+  std::thread inference_engine_thread_;
+  std::thread post_processor_thread_;
+};
+
 // NetworkNode
 typedef struct
 {
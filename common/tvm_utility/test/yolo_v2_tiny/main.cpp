@@ -19,6 +19,7 @@
 #include <opencv2/opencv.hpp>
 
 #include <algorithm>
+#include <future>
 #include <string>
 #include <utility>
 #include <vector>
@@ -277,5 +278,30 @@ TEST(PipelineExamples, SimplePipeline)
   }
 }
 
+TEST(PipelineExamples, AsyncPipeline)
+{
+  using PrePT = PreProcessorYoloV2Tiny;
+  using IET = tvm_utility::pipeline::InferenceEngineTVM;
+  using PostPT = PostProcessorYoloV2Tiny;
+
+  PrePT PreP{config};
+  IET IE{config, "tvm_utility"};
+  PostPT PostP{config};
+
+  tvm_utility::pipeline::Pipeline<PrePT, IET, PostPT> pipeline(PreP, IE, PostP);
+  const auto expected_output = pipeline.schedule(IMAGE_FILENAME);
+
+  // Test: the outputs are the same as the synchronous ones while the stages overlap
+  tvm_utility::pipeline::AsyncPipeline<PrePT, IET, PostPT> async_pipeline(
+    PrePT{config}, IET{config, "tvm_utility"}, PostPT{config});
+  std::vector<std::future<std::vector<float>>> outputs;
+  for (size_t i = 0; i < 4; ++i) {
+    outputs.push_back(async_pipeline.schedule(IMAGE_FILENAME));
+  }
+  for (auto & output : outputs) {
+    EXPECT_EQ(output.get(), expected_output);
+  }
+}
+
 }  // namespace yolo_v2_tiny
 }  // namespace tvm_utility
@@ -16,6 +16,7 @@
 #define AUTONOMOUS_EMERGENCY_BRAKING__NODE_HPP_
 
 #include <diagnostic_updater/diagnostic_updater.hpp>
+#include <geometry/flat_spatial_hash.hpp>
 #include <pcl_ros/transforms.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <vehicle_info_util/vehicle_info_util.hpp>
@@ -42,11 +43,13 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace autoware::motion::control::autonomous_emergency_braking
 {
 
+using autoware::common::geometry::spatial_hash::FlatSpatialHash2d;
 using autoware_auto_planning_msgs::msg::Trajectory;
 using autoware_auto_system_msgs::msg::AutowareState;
 using autoware_auto_vehicle_msgs::msg::VelocityReport;
@@ -147,6 +150,9 @@ public:
   void createObjectData(
     const Path & ego_path, const std::vector<Polygon2d> & ego_polys, const rclcpp::Time & stamp,
     std::vector<ObjectData> & objects);
+  void createObjectDataUsingPointGrid(
+    const Path & ego_path, const std::vector<Polygon2d> & ego_polys, const rclcpp::Time & stamp,
+    std::vector<ObjectData> & objects);
 
   void addMarker(
     const rclcpp::Time & current_time, const Path & path, const std::vector<Polygon2d> & polygons,
@@ -157,6 +163,8 @@ public:
   void addCollisionMarker(const ObjectData & data, MarkerArray & debug_markers);
 
   PointCloud2::SharedPtr obstacle_ros_pointcloud_ptr_{nullptr};
+  PointCloud::Ptr obstacle_points_ptr_{nullptr};
+  std::unique_ptr<FlatSpatialHash2d> obstacle_point_hash_{nullptr};
   VelocityReport::ConstSharedPtr current_velocity_ptr_{nullptr};
   Vector3::SharedPtr angular_velocity_ptr_{nullptr};
   Trajectory::ConstSharedPtr predicted_traj_ptr_{nullptr};
@@ -177,6 +185,8 @@ public:
   double voxel_grid_x_;
   double voxel_grid_y_;
   double voxel_grid_z_;
+  bool use_point_grid_;
+  double point_grid_resolution_;
   double min_generated_path_length_;
   double expand_width_;
   double longitudinal_offset_;
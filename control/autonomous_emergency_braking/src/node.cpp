@@ -35,6 +35,8 @@
 
 #include <boost/geometry/algorithms/convex_hull.hpp>
 #include <boost/geometry/algorithms/within.hpp>
+
+#include <algorithm>
 namespace autoware::motion::control::autonomous_emergency_braking
 {
 using diagnostic_msgs::msg::DiagnosticStatus;
@@ -130,6 +132,8 @@ AEB::AEB(const rclcpp::NodeOptions & node_options)
   voxel_grid_x_ = declare_parameter<double>("voxel_grid_x");
   voxel_grid_y_ = declare_parameter<double>("voxel_grid_y");
   voxel_grid_z_ = declare_parameter<double>("voxel_grid_z");
+  use_point_grid_ = declare_parameter<bool>("use_point_grid");
+  point_grid_resolution_ = declare_parameter<double>("point_grid_resolution");
   min_generated_path_length_ = declare_parameter<double>("min_generated_path_length");
   expand_width_ = declare_parameter<double>("expand_width");
   longitudinal_offset_ = declare_parameter<double>("longitudinal_offset");
@@ -228,6 +232,16 @@ void AEB::onPointCloud(const PointCloud2::ConstSharedPtr input_msg)
   pcl::toROSMsg(*no_height_filtered_pointcloud_ptr, *obstacle_ros_pointcloud_ptr_);
   obstacle_ros_pointcloud_ptr_->header = input_msg->header;
   pub_obstacle_pointcloud_->publish(*obstacle_ros_pointcloud_ptr_);
+
+  if (use_point_grid_) {
+    // the hash is kept to reuse its buffers for the next message
+    if (!obstacle_point_hash_) {
+      obstacle_point_hash_ = std::make_unique<FlatSpatialHash2d>(point_grid_resolution_);
+    }
+    const auto & points = no_height_filtered_pointcloud_ptr->points;
+    obstacle_point_hash_->build(points.begin(), points.end());
+    obstacle_points_ptr_ = no_height_filtered_pointcloud_ptr;
+  }
 }
 
 bool AEB::isDataReady()
@@ -315,7 +329,11 @@ bool AEB::checkCollision(MarkerArray & debug_markers)
     generateEgoPath(current_v, current_w, ego_path, ego_polys);
 
     std::vector<ObjectData> objects;
-    createObjectData(ego_path, ego_polys, current_time, objects);
+    if (use_point_grid_) {
+      createObjectDataUsingPointGrid(ego_path, ego_polys, current_time, objects);
+    } else {
+      createObjectData(ego_path, ego_polys, current_time, objects);
+    }
     has_collision_ego = hasCollision(current_v, ego_path, objects);
 
     std::string ns = "ego";
@@ -337,7 +355,11 @@ bool AEB::checkCollision(MarkerArray & debug_markers)
     const auto current_time = predicted_traj_ptr->header.stamp;
     generateEgoPath(*predicted_traj_ptr, predicted_path, predicted_polys);
     std::vector<ObjectData> objects;
-    createObjectData(predicted_path, predicted_polys, current_time, objects);
+    if (use_point_grid_) {
+      createObjectDataUsingPointGrid(predicted_path, predicted_polys, current_time, objects);
+    } else {
+      createObjectData(predicted_path, predicted_polys, current_time, objects);
+    }
     has_collision_predicted = hasCollision(current_v, predicted_path, objects);
 
     std::string ns = "predicted";
@@ -491,6 +513,46 @@ void AEB::createObjectData(
   }
 }
 
+void AEB::createObjectDataUsingPointGrid(
+  const Path & ego_path, const std::vector<Polygon2d> & ego_polys, const rclcpp::Time & stamp,
+  std::vector<ObjectData> & objects)
+{
+  // check if the predicted path has valid number of points
+  if (ego_path.size() < 2 || ego_polys.empty() || !obstacle_point_hash_ || !obstacle_points_ptr_) {
+    return;
+  }
+
+  // NOTE: The polygons are checked from the ego side, so that the objects are sorted roughly by the
+  // distance and hasCollision() returns at the closest one. Each point is checked only with the
+  // polygons whose bins contain it, and is not checked again once it is found in a polygon.
+  const auto & points = obstacle_points_ptr_->points;
+  std::vector<bool> is_found(points.size(), false);
+  std::vector<geometry_msgs::msg::Point> vertices;
+  for (const auto & ego_poly : ego_polys) {
+    vertices.clear();
+    for (const auto & vertex : ego_poly.outer()) {
+      vertices.push_back(tier4_autoware_utils::createPoint(vertex.x(), vertex.y(), 0.0));
+    }
+    obstacle_point_hash_->visit_within_polygon(vertices, [&](const size_t idx) {
+      if (is_found.at(idx)) {
+        return false;
+      }
+      is_found.at(idx) = true;
+      const auto & point = points.at(idx);
+      ObjectData obj;
+      obj.stamp = stamp;
+      obj.position = tier4_autoware_utils::createPoint(point.x, point.y, point.z);
+      obj.velocity = 0.0;
+      const double lat_dist = motion_utils::calcLateralOffset(ego_path, obj.position);
+      if (lat_dist > 5.0) {
+        return false;
+      }
+      objects.push_back(obj);
+      return false;
+    });
+  }
+}
+
 void AEB::addMarker(
   const rclcpp::Time & current_time, const Path & path, const std::vector<Polygon2d> & polygons,
   const std::vector<ObjectData> & objects, const double color_r, const double color_g,
@@ -16,8 +16,10 @@
 #define CONTROL_PERFORMANCE_ANALYSIS__CONTROL_PERFORMANCE_ANALYSIS_NODE_HPP_
 
 #include "control_performance_analysis/control_performance_analysis_core.hpp"
+#include "control_performance_analysis/control_performance_analysis_statistics.hpp"
 #include "control_performance_analysis/msg/driving_monitor_stamped.hpp"
 #include "control_performance_analysis/msg/error_stamped.hpp"
+#include "control_performance_analysis/msg/statistics_stamped.hpp"
 
 #include <rclcpp/rclcpp.hpp>
 #include <signal_processing/lowpass_filter_1d.hpp>
@@ -33,6 +35,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace control_performance_analysis
 {
@@ -41,6 +44,7 @@ using autoware_auto_planning_msgs::msg::Trajectory;
 using autoware_auto_vehicle_msgs::msg::SteeringReport;
 using control_performance_analysis::msg::DrivingMonitorStamped;
 using control_performance_analysis::msg::ErrorStamped;
+using control_performance_analysis::msg::StatisticsStamped;
 using geometry_msgs::msg::PoseStamped;
 using nav_msgs::msg::Odometry;
 
@@ -61,6 +65,8 @@ private:
   rclcpp::Publisher<ErrorStamped>::SharedPtr pub_error_msg_;  // publish error message
   rclcpp::Publisher<DrivingMonitorStamped>::SharedPtr
     pub_driving_msg_;  // publish driving status message
+  rclcpp::Publisher<StatisticsStamped>::SharedPtr
+    pub_statistics_msg_;  // publish statistics of the time window
 
   // Node Methods
   bool isDataReady() const;  // check if data arrive
@@ -72,6 +78,16 @@ private:
   void onVecSteeringMeasured(const SteeringReport::ConstSharedPtr meas_steer_msg);
   void onVelocity(const Odometry::ConstSharedPtr msg);
 
+  // Streaming statistics
+  void updateStatistics(const rclcpp::Time & stamp);
+  bool enable_streaming_statistics_{false};
+  double statistics_window_duration_{0.0};
+  std::vector<double> statistics_quantile_probabilities_;
+  std::unique_ptr<rclcpp::Time> statistics_window_start_;
+  std::unique_ptr<StreamingStatistics> lateral_error_statistics_;
+  std::unique_ptr<StreamingStatistics> heading_error_statistics_;
+  std::unique_ptr<StreamingStatistics> controller_processing_time_statistics_;
+
   // Parameters
   Params param_{};  // wheelbase, control period and feedback coefficients.
   // State holder
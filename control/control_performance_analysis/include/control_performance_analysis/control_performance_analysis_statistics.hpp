@@ -0,0 +1,79 @@
+// Copyright 2023 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CONTROL_PERFORMANCE_ANALYSIS__CONTROL_PERFORMANCE_ANALYSIS_STATISTICS_HPP_
+#define CONTROL_PERFORMANCE_ANALYSIS__CONTROL_PERFORMANCE_ANALYSIS_STATISTICS_HPP_
+
+#include "control_performance_analysis/msg/statistics.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace control_performance_analysis
+{
+using control_performance_analysis::msg::Statistics;
+
+/**
+ * @brief P-squared estimator of a quantile, which keeps only five markers of the samples
+ * @details R. Jain and I. Chlamtac, "The P2 algorithm for dynamic calculation of quantiles and
+ * histograms without storing observations", Communications of the ACM, 1985.
+ */
+class P2QuantileEstimator
+{
+public:
+  explicit P2QuantileEstimator(const double probability);
+
+  void add(const double x);
+  double getQuantile() const;
+  void reset();
+
+private:
+  double parabolic(const int i, const double d) const;
+  double linear(const int i, const int d) const;
+
+  double p_;
+  uint64_t count_{0};
+  std::array<double, 5> heights_{};
+  std::array<double, 5> positions_{};
+  std::array<double, 5> desired_positions_{};
+  std::array<double, 5> increments_{};
+};
+
+/**
+ * @brief online mean, variance, min, max and quantiles of the samples in O(1) memory
+ */
+class StreamingStatistics
+{
+public:
+  explicit StreamingStatistics(const std::vector<double> & quantile_probabilities);
+
+  void add(const double x);
+  void reset();
+  uint64_t count() const { return count_; }
+
+  //! variance is the unbiased one, and 0 for less than two samples
+  Statistics toMsg() const;
+
+private:
+  uint64_t count_{0};
+  double mean_{0.0};
+  double m2_{0.0};
+  double min_{0.0};
+  double max_{0.0};
+  std::vector<P2QuantileEstimator> quantile_estimators_;
+};
+}  // namespace control_performance_analysis
+
+#endif  // CONTROL_PERFORMANCE_ANALYSIS__CONTROL_PERFORMANCE_ANALYSIS_STATISTICS_HPP_
@@ -16,18 +16,27 @@
 
 #include "control_performance_analysis/msg/driving_monitor_stamped.hpp"
 #include "control_performance_analysis/msg/error_stamped.hpp"
+#include "control_performance_analysis/msg/statistics_stamped.hpp"
 
 #include <vehicle_info_util/vehicle_info_util.hpp>
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace
 {
 using autoware_auto_control_msgs::msg::AckermannControlCommand;
 using control_performance_analysis::msg::DrivingMonitorStamped;
 using control_performance_analysis::msg::ErrorStamped;
+using control_performance_analysis::msg::StatisticsStamped;
 
+template <class T>
+bool hasSubscriber(const T & publisher)
+{
+  return publisher->get_subscription_count() > 0 ||
+         publisher->get_intra_process_subscription_count() > 0;
+}
 }  // namespace
 
 namespace control_performance_analysis
@@ -53,6 +62,10 @@ ControlPerformanceAnalysisNode::ControlPerformanceAnalysisNode(
   param_.acceptable_max_yaw_difference_rad_ =
     declare_parameter<double>("acceptable_max_yaw_difference_rad");
   param_.lpf_gain_ = declare_parameter<double>("low_pass_filter_gain");
+  enable_streaming_statistics_ = declare_parameter<bool>("enable_streaming_statistics");
+  statistics_window_duration_ = declare_parameter<double>("statistics_window_duration");
+  statistics_quantile_probabilities_ =
+    declare_parameter<std::vector<double>>("statistics_quantile_probabilities");
 
   // Prepare error computation class with the wheelbase parameter.
   control_performance_core_ptr_ = std::make_unique<ControlPerformanceAnalysisCore>(param_);
@@ -76,6 +89,16 @@ ControlPerformanceAnalysisNode::ControlPerformanceAnalysisNode(
   pub_error_msg_ = create_publisher<ErrorStamped>("~/output/error_stamped", 1);
 
   pub_driving_msg_ = create_publisher<DrivingMonitorStamped>("~/output/driving_status_stamped", 1);
+
+  if (enable_streaming_statistics_) {
+    pub_statistics_msg_ = create_publisher<StatisticsStamped>("~/output/statistics_stamped", 1);
+    lateral_error_statistics_ =
+      std::make_unique<StreamingStatistics>(statistics_quantile_probabilities_);
+    heading_error_statistics_ =
+      std::make_unique<StreamingStatistics>(statistics_quantile_probabilities_);
+    controller_processing_time_statistics_ =
+      std::make_unique<StreamingStatistics>(statistics_quantile_probabilities_);
+  }
 }
 
 void ControlPerformanceAnalysisNode::onTrajectory(const Trajectory::ConstSharedPtr msg)
@@ -100,6 +123,9 @@ void ControlPerformanceAnalysisNode::onControlRaw(
     const rclcpp::Duration & duration =
       (rclcpp::Time(control_msg->stamp) - rclcpp::Time(last_control_cmd_->stamp));
     d_control_cmd_ = duration.seconds() * 1000;  // ms
+    if (enable_streaming_statistics_) {
+      controller_processing_time_statistics_->add(d_control_cmd_);
+    }
   }
 
   last_control_cmd_ = current_control_msg_ptr_;
@@ -132,9 +158,21 @@ void ControlPerformanceAnalysisNode::onVelocity(const Odometry::ConstSharedPtr m
     return;
   }
 
+  // In the streaming statistics mode, the full-rate topics are published only when subscribed.
+  const bool publish_error_msg = !enable_streaming_statistics_ || hasSubscriber(pub_error_msg_);
+  const bool publish_driving_msg =
+    !enable_streaming_statistics_ || hasSubscriber(pub_driving_msg_);
+
   // Compute control performance values.
   if (control_performance_core_ptr_->calculateErrorVars()) {
-    pub_error_msg_->publish(control_performance_core_ptr_->error_vars);
+    if (publish_error_msg) {
+      pub_error_msg_->publish(control_performance_core_ptr_->error_vars);
+    }
+    if (enable_streaming_statistics_) {
+      const auto & error = control_performance_core_ptr_->error_vars.error;
+      lateral_error_statistics_->add(error.lateral_error);
+      heading_error_statistics_->add(error.heading_error);
+    }
   } else {
     RCLCPP_ERROR(get_logger(), "Cannot compute error vars ...");
   }
@@ -142,10 +180,43 @@ void ControlPerformanceAnalysisNode::onVelocity(const Odometry::ConstSharedPtr m
     auto & status_vars = control_performance_core_ptr_->driving_status_vars;
     status_vars.controller_processing_time.header.stamp = current_control_msg_ptr_->stamp;
     status_vars.controller_processing_time.data = d_control_cmd_;
-    pub_driving_msg_->publish(status_vars);
+    if (publish_driving_msg) {
+      pub_driving_msg_->publish(status_vars);
+    }
   } else {
     RCLCPP_ERROR(get_logger(), "Cannot compute driving vars ...");
   }
+
+  if (enable_streaming_statistics_) {
+    updateStatistics(current_odom_ptr_->header.stamp);
+  }
+}
+
+void ControlPerformanceAnalysisNode::updateStatistics(const rclcpp::Time & stamp)
+{
+  if (!statistics_window_start_) {
+    statistics_window_start_ = std::make_unique<rclcpp::Time>(stamp);
+    return;
+  }
+
+  const double window_duration = (stamp - *statistics_window_start_).seconds();
+  if (window_duration < statistics_window_duration_) {
+    return;
+  }
+
+  StatisticsStamped msg;
+  msg.header.stamp = stamp;
+  msg.window_duration = window_duration;
+  msg.quantile_probabilities = statistics_quantile_probabilities_;
+  msg.lateral_error = lateral_error_statistics_->toMsg();
+  msg.heading_error = heading_error_statistics_->toMsg();
+  msg.controller_processing_time = controller_processing_time_statistics_->toMsg();
+  pub_statistics_msg_->publish(msg);
+
+  lateral_error_statistics_->reset();
+  heading_error_statistics_->reset();
+  controller_processing_time_statistics_->reset();
+  *statistics_window_start_ = stamp;
 }
 
 bool ControlPerformanceAnalysisNode::isDataReady() const
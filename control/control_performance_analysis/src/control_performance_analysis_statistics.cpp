@@ -0,0 +1,173 @@
+// Copyright 2023 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "control_performance_analysis/control_performance_analysis_statistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace control_performance_analysis
+{
+P2QuantileEstimator::P2QuantileEstimator(const double probability)
+: p_(std::clamp(probability, 0.0, 1.0))
+{
+  increments_ = {0.0, p_ / 2.0, p_, (1.0 + p_) / 2.0, 1.0};
+  reset();
+}
+
+void P2QuantileEstimator::reset()
+{
+  count_ = 0;
+  positions_ = {0.0, 1.0, 2.0, 3.0, 4.0};
+  desired_positions_ = {0.0, 2.0 * p_, 4.0 * p_, 2.0 + 2.0 * p_, 4.0};
+}
+
+void P2QuantileEstimator::add(const double x)
+{
+  // store the first five samples as the initial markers
+  if (count_ < 5) {
+    heights_.at(count_) = x;
+    ++count_;
+    if (count_ == 5) {
+      std::sort(heights_.begin(), heights_.end());
+    }
+    return;
+  }
+  ++count_;
+
+  // find the cell k containing x, and extend the extreme markers if necessary
+  int k = 0;
+  if (x < heights_.at(0)) {
+    heights_.at(0) = x;
+    k = 0;
+  } else if (x >= heights_.at(4)) {
+    heights_.at(4) = x;
+    k = 3;
+  } else {
+    while (k < 3 && x >= heights_.at(k + 1)) {
+      ++k;
+    }
+  }
+
+  for (int i = k + 1; i < 5; ++i) {
+    positions_.at(i) += 1.0;
+  }
+  for (int i = 0; i < 5; ++i) {
+    desired_positions_.at(i) += increments_.at(i);
+  }
+
+  // adjust the heights of the middle markers
+  for (int i = 1; i < 4; ++i) {
+    const double d = desired_positions_.at(i) - positions_.at(i);
+    if (
+      (d >= 1.0 && positions_.at(i + 1) - positions_.at(i) > 1.0) ||
+      (d <= -1.0 && positions_.at(i - 1) - positions_.at(i) < -1.0)) {
+      const int d_sign = d > 0.0 ? 1 : -1;
+      const double height = parabolic(i, d_sign);
+      if (heights_.at(i - 1) < height && height < heights_.at(i + 1)) {
+        heights_.at(i) = height;
+      } else {
+        heights_.at(i) = linear(i, d_sign);
+      }
+      positions_.at(i) += d_sign;
+    }
+  }
+}
+
+double P2QuantileEstimator::parabolic(const int i, const double d) const
+{
+  const auto & q = heights_;
+  const auto & n = positions_;
+  return q.at(i) + d / (n.at(i + 1) - n.at(i - 1)) *
+                     ((n.at(i) - n.at(i - 1) + d) * (q.at(i + 1) - q.at(i)) /
+                        (n.at(i + 1) - n.at(i)) +
+                      (n.at(i + 1) - n.at(i) - d) * (q.at(i) - q.at(i - 1)) /
+                        (n.at(i) - n.at(i - 1)));
+}
+
+double P2QuantileEstimator::linear(const int i, const int d) const
+{
+  const auto & q = heights_;
+  const auto & n = positions_;
+  return q.at(i) + d * (q.at(i + d) - q.at(i)) / (n.at(i + d) - n.at(i));
+}
+
+double P2QuantileEstimator::getQuantile() const
+{
+  if (count_ == 0) {
+    return 0.0;
+  }
+  if (count_ < 5) {
+    // nearest rank of the stored samples
+    std::array<double, 5> sorted = heights_;
+    std::sort(sorted.begin(), sorted.begin() + count_);
+    const auto rank = static_cast<size_t>(std::round(p_ * static_cast<double>(count_ - 1)));
+    return sorted.at(rank);
+  }
+  return heights_.at(2);
+}
+
+StreamingStatistics::StreamingStatistics(const std::vector<double> & quantile_probabilities)
+{
+  for (const auto p : quantile_probabilities) {
+    quantile_estimators_.emplace_back(p);
+  }
+}
+
+void StreamingStatistics::add(const double x)
+{
+  if (!std::isfinite(x)) {
+    return;
+  }
+
+  // Welford's algorithm
+  ++count_;
+  const double delta = x - mean_;
+  mean_ += delta / static_cast<double>(count_);
+  m2_ += delta * (x - mean_);
+  min_ = count_ == 1 ? x : std::min(min_, x);
+  max_ = count_ == 1 ? x : std::max(max_, x);
+
+  for (auto & estimator : quantile_estimators_) {
+    estimator.add(x);
+  }
+}
+
+void StreamingStatistics::reset()
+{
+  count_ = 0;
+  mean_ = 0.0;
+  m2_ = 0.0;
+  min_ = 0.0;
+  max_ = 0.0;
+  for (auto & estimator : quantile_estimators_) {
+    estimator.reset();
+  }
+}
+
+Statistics StreamingStatistics::toMsg() const
+{
+  Statistics msg;
+  msg.count = count_;
+  msg.mean = mean_;
+  msg.variance = count_ > 1 ? m2_ / static_cast<double>(count_ - 1) : 0.0;
+  msg.min = min_;
+  msg.max = max_;
+  msg.quantiles.reserve(quantile_estimators_.size());
+  for (const auto & estimator : quantile_estimators_) {
+    msg.quantiles.push_back(estimator.getQuantile());
+  }
+  return msg;
+}
+}  // namespace control_performance_analysis
@@ -15,6 +15,8 @@
 #ifndef LANE_DEPARTURE_CHECKER__LANE_DEPARTURE_CHECKER_HPP_
 #define LANE_DEPARTURE_CHECKER__LANE_DEPARTURE_CHECKER_HPP_
 
+#include "lane_departure_checker/route_lanelet_index.hpp"
+
 #include <rosidl_runtime_cpp/message_initialization.hpp>
 #include <tier4_autoware_utils/geometry/boost_geometry.hpp>
 #include <tier4_autoware_utils/geometry/pose_deviation.hpp>
@@ -70,6 +72,8 @@ struct Input
   LaneletRoute::ConstSharedPtr route{};
   lanelet::ConstLanelets route_lanelets{};
   lanelet::ConstLanelets shoulder_lanelets{};
+  //! index of route_lanelets and shoulder_lanelets. The lanelets are checked one by one if null.
+  std::shared_ptr<const RouteLaneletIndex> route_lanelet_index{};
   Trajectory::ConstSharedPtr reference_trajectory{};
   Trajectory::ConstSharedPtr predicted_trajectory{};
   std::vector<std::string> boundary_types_to_detect{};
@@ -109,6 +113,10 @@ public:
   bool checkPathWillLeaveLane(
     const lanelet::ConstLanelets & lanelets, const PathWithLaneId & path) const;
 
+  //! same as the above, using the index built once for the lanelets
+  bool checkPathWillLeaveLane(
+    const RouteLaneletIndex & lanelet_index, const PathWithLaneId & path) const;
+
   static bool isOutOfLane(
     const lanelet::ConstLanelets & candidate_lanelets, const LinearRing2d & vehicle_footprint);
 
@@ -82,6 +82,7 @@ private:
   geometry_msgs::msg::PoseWithCovarianceStamped::ConstSharedPtr cov_;
   LaneletRoute::ConstSharedPtr last_route_;
   lanelet::ConstLanelets route_lanelets_;
+  std::shared_ptr<const RouteLaneletIndex> route_lanelet_index_;
   Trajectory::ConstSharedPtr reference_trajectory_;
   Trajectory::ConstSharedPtr predicted_trajectory_;
 
@@ -0,0 +1,78 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANE_DEPARTURE_CHECKER__ROUTE_LANELET_INDEX_HPP_
+#define LANE_DEPARTURE_CHECKER__ROUTE_LANELET_INDEX_HPP_
+
+#include <tier4_autoware_utils/geometry/boost_geometry.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace lane_departure_checker
+{
+using tier4_autoware_utils::Box2d;
+using tier4_autoware_utils::LinearRing2d;
+using tier4_autoware_utils::Point2d;
+using tier4_autoware_utils::Segment2d;
+
+/**
+ * @brief spatial index of the lanelets, built once per route
+ * @details The polygons of the lanelets and the segments of their bounds are stored in rtrees, so
+ * that each footprint point or edge is checked only against the lanelets and the bounds around it.
+ * The results are the same as checking all the lanelets intersecting with the footprints.
+ */
+class RouteLaneletIndex
+{
+public:
+  RouteLaneletIndex() = default;
+  explicit RouteLaneletIndex(const lanelet::ConstLanelets & lanelets);
+
+  bool empty() const { return lanelets_.empty(); }
+
+  //! lanelets intersecting with the convex hull of the footprints, in the order of the input
+  lanelet::ConstLanelets getCandidateLanelets(
+    const std::vector<LinearRing2d> & vehicle_footprints) const;
+
+  bool isInAnyLane(const Point2d & point) const;
+
+  bool isOutOfLane(const LinearRing2d & vehicle_footprint) const;
+
+  bool willLeaveLane(const std::vector<LinearRing2d> & vehicle_footprints) const;
+
+  //! true if any edge of the footprints crosses a bound whose type is in boundary_types_to_detect
+  bool willCrossBoundary(
+    const std::vector<LinearRing2d> & vehicle_footprints,
+    const std::vector<std::string> & boundary_types_to_detect) const;
+
+private:
+  using BoxValue = std::pair<Box2d, size_t>;
+  using SegmentValue = std::pair<Segment2d, size_t>;
+
+  lanelet::ConstLanelets lanelets_;
+  std::vector<lanelet::BasicPolygon2d> polygons_;
+  boost::geometry::index::rtree<BoxValue, boost::geometry::index::rstar<16>> polygon_rtree_;
+
+  //! type of each bound, which is shared by the adjacent lanelets and stored only once
+  std::vector<std::string> boundary_types_;
+  boost::geometry::index::rtree<SegmentValue, boost::geometry::index::rstar<16>> segment_rtree_;
+};
+}  // namespace lane_departure_checker
+
+#endif  // LANE_DEPARTURE_CHECKER__ROUTE_LANELET_INDEX_HPP_
@@ -155,6 +155,24 @@ Output LaneDepartureChecker::update(const Input & input)
   output.vehicle_passing_areas = createVehiclePassingAreas(output.vehicle_footprints);
   output.processing_time_map["createVehiclePassingAreas"] = stop_watch.toc(true);
 
+  if (input.route_lanelet_index) {
+    const auto & lanelet_index = *input.route_lanelet_index;
+    output.candidate_lanelets = lanelet_index.getCandidateLanelets(output.vehicle_footprints);
+    output.processing_time_map["getCandidateLanelets"] = stop_watch.toc(true);
+
+    output.will_leave_lane = lanelet_index.willLeaveLane(output.vehicle_footprints);
+    output.processing_time_map["willLeaveLane"] = stop_watch.toc(true);
+
+    output.is_out_of_lane = lanelet_index.isOutOfLane(output.vehicle_footprints.front());
+    output.processing_time_map["isOutOfLane"] = stop_watch.toc(true);
+
+    output.will_cross_boundary =
+      lanelet_index.willCrossBoundary(output.vehicle_footprints, input.boundary_types_to_detect);
+    output.processing_time_map["willCrossBoundary"] = stop_watch.toc(true);
+
+    return output;
+  }
+
   const auto candidate_road_lanelets =
     getCandidateLanelets(input.route_lanelets, output.vehicle_footprints);
   const auto candidate_shoulder_lanelets =
@@ -187,6 +205,12 @@ bool LaneDepartureChecker::checkPathWillLeaveLane(
   return willLeaveLane(candidate_lanelets, vehicle_footprints);
 }
 
+bool LaneDepartureChecker::checkPathWillLeaveLane(
+  const RouteLaneletIndex & lanelet_index, const PathWithLaneId & path) const
+{
+  return lanelet_index.willLeaveLane(createVehicleFootprints(path));
+}
+
 PoseDeviation LaneDepartureChecker::calcTrajectoryDeviation(
   const Trajectory & trajectory, const geometry_msgs::msg::Pose & pose, const double dist_threshold,
   const double yaw_threshold)
@@ -213,6 +213,7 @@ void LaneDepartureCheckerNode::onLaneletMapBin(const HADMapBin::ConstSharedPtr m
   // get all shoulder lanes
   lanelet::ConstLanelets all_lanelets = lanelet::utils::query::laneletLayer(lanelet_map_);
   shoulder_lanelets_ = lanelet::utils::query::shoulderLanelets(all_lanelets);
+  route_lanelet_index_.reset();
 }
 
 void LaneDepartureCheckerNode::onRoute(const LaneletRoute::ConstSharedPtr msg)
@@ -337,14 +338,23 @@ void LaneDepartureCheckerNode::onTimer()
       route_lanelets_.push_back(itr->second);
     }
     last_route_ = route_;
+    route_lanelet_index_.reset();
   }
   processing_time_map["Node: getRouteLanelets"] = stop_watch.toc(true);
 
+  if (!route_lanelet_index_) {
+    lanelet::ConstLanelets lanelets = route_lanelets_;
+    lanelets.insert(lanelets.end(), shoulder_lanelets_.begin(), shoulder_lanelets_.end());
+    route_lanelet_index_ = std::make_shared<const RouteLaneletIndex>(lanelets);
+  }
+  processing_time_map["Node: createRouteLaneletIndex"] = stop_watch.toc(true);
+
   input_.current_odom = current_odom_;
   input_.lanelet_map = lanelet_map_;
   input_.route = route_;
   input_.route_lanelets = route_lanelets_;
   input_.shoulder_lanelets = shoulder_lanelets_;
+  input_.route_lanelet_index = route_lanelet_index_;
   input_.reference_trajectory = reference_trajectory_;
   input_.predicted_trajectory = predicted_trajectory_;
   input_.boundary_types_to_detect = node_param_.boundary_types_to_detect;
@@ -0,0 +1,178 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lane_departure_checker/route_lanelet_index.hpp"
+
+#include <tier4_autoware_utils/geometry/geometry.hpp>
+
+#include <boost/geometry.hpp>
+
+#include <lanelet2_core/geometry/Polygon.h>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+using lane_departure_checker::Box2d;
+using lane_departure_checker::LinearRing2d;
+using lane_departure_checker::Point2d;
+
+template <class Points>
+Box2d createBox(const Points & points)
+{
+  constexpr double inf = std::numeric_limits<double>::infinity();
+  Box2d box{{inf, inf}, {-inf, -inf}};
+  for (const auto & p : points) {
+    box.min_corner().x() = std::min(box.min_corner().x(), static_cast<double>(p.x()));
+    box.min_corner().y() = std::min(box.min_corner().y(), static_cast<double>(p.y()));
+    box.max_corner().x() = std::max(box.max_corner().x(), static_cast<double>(p.x()));
+    box.max_corner().y() = std::max(box.max_corner().y(), static_cast<double>(p.y()));
+  }
+  return box;
+}
+
+geometry_msgs::msg::Point toMsg(const Point2d & point)
+{
+  return tier4_autoware_utils::toMsg(point.to_3d());
+}
+}  // namespace
+
+namespace lane_departure_checker
+{
+RouteLaneletIndex::RouteLaneletIndex(const lanelet::ConstLanelets & lanelets) : lanelets_(lanelets)
+{
+  std::vector<BoxValue> boxes;
+  std::vector<SegmentValue> segments;
+  std::unordered_set<lanelet::Id> stored_bound_ids;
+
+  const auto add_bound = [&](const lanelet::ConstLineString2d & bound) {
+    if (!stored_bound_ids.insert(bound.id()).second) {
+      return;
+    }
+    const auto & bound_2d = bound.basicLineString();
+    for (size_t i = 0; i + 1 < bound_2d.size(); ++i) {
+      const Point2d p1{bound_2d.at(i).x(), bound_2d.at(i).y()};
+      const Point2d p2{bound_2d.at(i + 1).x(), bound_2d.at(i + 1).y()};
+      segments.emplace_back(Segment2d{p1, p2}, boundary_types_.size());
+    }
+    boundary_types_.push_back(bound.attributeOr(lanelet::AttributeName::Type, "none"));
+  };
+
+  polygons_.reserve(lanelets_.size());
+  boxes.reserve(lanelets_.size());
+  for (size_t i = 0; i < lanelets_.size(); ++i) {
+    const auto & lanelet = lanelets_.at(i);
+    polygons_.push_back(lanelet.polygon2d().basicPolygon());
+    boxes.emplace_back(createBox(polygons_.back()), i);
+    add_bound(lanelet.leftBound2d());
+    add_bound(lanelet.rightBound2d());
+  }
+
+  // NOTE: the packing constructor builds the better trees than the insertion one by one does
+  polygon_rtree_ = decltype(polygon_rtree_)(boxes.begin(), boxes.end());
+  segment_rtree_ = decltype(segment_rtree_)(segments.begin(), segments.end());
+}
+
+lanelet::ConstLanelets RouteLaneletIndex::getCandidateLanelets(
+  const std::vector<LinearRing2d> & vehicle_footprints) const
+{
+  tier4_autoware_utils::MultiPoint2d combined;
+  for (const auto & footprint : vehicle_footprints) {
+    combined.insert(combined.end(), footprint.begin(), footprint.end());
+  }
+  LinearRing2d footprint_hull;
+  boost::geometry::convex_hull(combined, footprint_hull);
+
+  std::vector<BoxValue> hits;
+  polygon_rtree_.query(
+    boost::geometry::index::intersects(createBox(footprint_hull)), std::back_inserter(hits));
+
+  std::vector<size_t> candidate_indices;
+  for (const auto & hit : hits) {
+    if (!boost::geometry::disjoint(polygons_.at(hit.second), footprint_hull)) {
+      candidate_indices.push_back(hit.second);
+    }
+  }
+  std::sort(candidate_indices.begin(), candidate_indices.end());
+
+  lanelet::ConstLanelets candidate_lanelets;
+  candidate_lanelets.reserve(candidate_indices.size());
+  for (const auto idx : candidate_indices) {
+    candidate_lanelets.push_back(lanelets_.at(idx));
+  }
+  return candidate_lanelets;
+}
+
+bool RouteLaneletIndex::isInAnyLane(const Point2d & point) const
+{
+  // NOTE: a lanelet containing the point always intersects with the hull of the footprints, so
+  // that checking the lanelets around the point is the same as checking the candidate lanelets.
+  const auto contains_point = [&](const BoxValue & value) {
+    return boost::geometry::within(point, polygons_.at(value.second));
+  };
+  return polygon_rtree_.qbegin(
+           boost::geometry::index::intersects(point) &&
+           boost::geometry::index::satisfies(contains_point)) != polygon_rtree_.qend();
+}
+
+bool RouteLaneletIndex::isOutOfLane(const LinearRing2d & vehicle_footprint) const
+{
+  return std::any_of(vehicle_footprint.begin(), vehicle_footprint.end(), [&](const auto & point) {
+    return !isInAnyLane(point);
+  });
+}
+
+bool RouteLaneletIndex::willLeaveLane(const std::vector<LinearRing2d> & vehicle_footprints) const
+{
+  return std::any_of(
+    vehicle_footprints.begin(), vehicle_footprints.end(),
+    [&](const auto & footprint) { return isOutOfLane(footprint); });
+}
+
+bool RouteLaneletIndex::willCrossBoundary(
+  const std::vector<LinearRing2d> & vehicle_footprints,
+  const std::vector<std::string> & boundary_types_to_detect) const
+{
+  const auto is_target_type = [&](const size_t boundary_idx) {
+    const auto & type = boundary_types_.at(boundary_idx);
+    return std::find(boundary_types_to_detect.begin(), boundary_types_to_detect.end(), type) !=
+           boundary_types_to_detect.end();
+  };
+
+  for (const auto & footprint : vehicle_footprints) {
+    for (size_t i = 0; i + 1 < footprint.size(); ++i) {
+      const auto & p1 = footprint.at(i);
+      const auto & p2 = footprint.at(i + 1);
+      const auto crosses_edge = [&](const SegmentValue & value) {
+        return is_target_type(value.second) &&
+               tier4_autoware_utils::intersect(
+                 toMsg(p1), toMsg(p2), toMsg(value.first.first), toMsg(value.first.second));
+      };
+      const auto edge_box = createBox(std::vector<Point2d>{p1, p2});
+      if (
+        segment_rtree_.qbegin(
+          boost::geometry::index::intersects(edge_box) &&
+          boost::geometry::index::satisfies(crosses_edge)) != segment_rtree_.qend()) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+}  // namespace lane_departure_checker
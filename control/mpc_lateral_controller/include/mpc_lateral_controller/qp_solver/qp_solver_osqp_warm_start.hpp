@@ -0,0 +1,84 @@
+// Copyright 2023 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MPC_LATERAL_CONTROLLER__QP_SOLVER__QP_SOLVER_OSQP_WARM_START_HPP_
+#define MPC_LATERAL_CONTROLLER__QP_SOLVER__QP_SOLVER_OSQP_WARM_START_HPP_
+
+#include "mpc_lateral_controller/qp_solver/qp_solver_interface.hpp"
+#include "osqp_interface/osqp_interface.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+#include <Eigen/SparseCore>
+
+#include <vector>
+
+namespace autoware::motion::control::mpc_lateral_controller
+{
+
+/**
+ * @brief OSQP solver keeping the workspace over the cycles
+ * @details The problem is set up only when its dimensions or the sparsity of the constraint
+ * change. Otherwise only the values of the matrices and the vectors are updated, and the solver is
+ * warm-started from the previous solution shifted by one step.
+ */
+class QPSolverOSQPWarmStart : public QPSolverInterface
+{
+public:
+  /**
+   * @brief constructor
+   */
+  explicit QPSolverOSQPWarmStart(const rclcpp::Logger & logger);
+
+  /**
+   * @brief destructor
+   */
+  virtual ~QPSolverOSQPWarmStart() = default;
+
+  /**
+   * @brief solve QP problem : minimize j = u' * h_mat * u + f_vec' * u
+   * @param [in] h_mat parameter matrix in object function
+   * @param [in] f_vec parameter matrix in object function
+   * @param [in] a parameter matrix for constraint lb_a < a*u < ub_a
+   * @param [in] lb parameter matrix for constraint lb < U < ub
+   * @param [in] ub parameter matrix for constraint lb < U < ub
+   * @param [in] lb_a parameter matrix for constraint lb_a < a*u < ub_a
+   * @param [in] ub_a parameter matrix for constraint lb_a < a*u < ub_a
+   * @param [out] u optimal variable vector
+   * @return true if the problem was solved
+   */
+  bool solve(
+    const Eigen::MatrixXd & h_mat, const Eigen::MatrixXd & f_vec, const Eigen::MatrixXd & a,
+    const Eigen::VectorXd & lb, const Eigen::VectorXd & ub, const Eigen::VectorXd & lb_a,
+    const Eigen::VectorXd & ub_a, Eigen::VectorXd & u) override;
+
+private:
+  /**
+   * @brief update the stored problem, or set it up if the structure is changed
+   * @return true if the workspace is kept from the previous cycle
+   */
+  bool updateProblem(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u);
+
+  autoware::common::osqp::OSQPInterface osqpsolver_;
+  rclcpp::Logger logger_;
+
+  bool is_initialized_{false};
+  Eigen::Index dim_u_{0};
+  Eigen::Index dim_constraint_{0};
+  std::vector<double> prev_primal_;
+  std::vector<double> prev_dual_;
+};
+}  // namespace autoware::motion::control::mpc_lateral_controller
+#endif  // MPC_LATERAL_CONTROLLER__QP_SOLVER__QP_SOLVER_OSQP_WARM_START_HPP_
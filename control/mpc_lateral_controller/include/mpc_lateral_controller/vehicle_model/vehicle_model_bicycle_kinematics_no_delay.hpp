@@ -38,7 +38,7 @@
 #ifndef MPC_LATERAL_CONTROLLER__VEHICLE_MODEL__VEHICLE_MODEL_BICYCLE_KINEMATICS_NO_DELAY_HPP_
 #define MPC_LATERAL_CONTROLLER__VEHICLE_MODEL__VEHICLE_MODEL_BICYCLE_KINEMATICS_NO_DELAY_HPP_
 
-#include "mpc_lateral_controller/vehicle_model/vehicle_model_interface.hpp"
+#include "mpc_lateral_controller/vehicle_model/vehicle_model_fixed_size.hpp"
 
 #include <Eigen/Core>
 #include <Eigen/LU>
@@ -52,9 +52,12 @@ namespace autoware::motion::control::mpc_lateral_controller
  * Vehicle model class of bicycle kinematics without steering delay
  * @brief calculate model-related values
  */
-class KinematicsBicycleModelNoDelay : public VehicleModelInterface
+class KinematicsBicycleModelNoDelay : public VehicleModelFixedSize<2, 1, 2>
 {
 public:
+  using VehicleModelFixedSize::calculateDiscreteMatrix;
+  using VehicleModelFixedSize::calculateReferenceInput;
+
   /**
    * @brief constructor with parameter initialization
    * @param [in] wheelbase wheelbase length [m]
@@ -76,14 +79,14 @@ public:
    * @param [in] dt Discretization time [s]
    */
   void calculateDiscreteMatrix(
-    Eigen::MatrixXd & a_d, Eigen::MatrixXd & b_d, Eigen::MatrixXd & c_d, Eigen::MatrixXd & w_d,
+    StateMatrix & a_d, InputMatrix & b_d, OutputMatrix & c_d, StateVector & w_d,
     const double dt) override;
 
   /**
    * @brief calculate reference input
    * @param [out] u_ref input
    */
-  void calculateReferenceInput(Eigen::MatrixXd & u_ref) override;
+  void calculateReferenceInput(InputVector & u_ref) override;
 
   std::string modelName() override { return "kinematics_no_delay"; };
 
@@ -0,0 +1,112 @@
+// Copyright 2023 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MPC_LATERAL_CONTROLLER__VEHICLE_MODEL__VEHICLE_MODEL_FIXED_SIZE_HPP_
+#define MPC_LATERAL_CONTROLLER__VEHICLE_MODEL__VEHICLE_MODEL_FIXED_SIZE_HPP_
+
+#include "mpc_lateral_controller/vehicle_model/vehicle_model_interface.hpp"
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+namespace autoware::motion::control::mpc_lateral_controller
+{
+
+/**
+ * Vehicle model class with the dimensions fixed at compile time
+ * @brief calculate model-related values with the fixed-size matrices
+ * @details The model matrices are calculated on the stack, and copied to the dynamic matrices of
+ * VehicleModelInterface, which do not allocate memory as long as they already have the size.
+ * @tparam Nx dimension of state x
+ * @tparam Nu dimension of input u
+ * @tparam Ny dimension of output y
+ */
+template <int Nx, int Nu, int Ny>
+class VehicleModelFixedSize : public VehicleModelInterface
+{
+public:
+  using StateMatrix = Eigen::Matrix<double, Nx, Nx>;
+  using InputMatrix = Eigen::Matrix<double, Nx, Nu>;
+  using OutputMatrix = Eigen::Matrix<double, Ny, Nx>;
+  using StateVector = Eigen::Matrix<double, Nx, 1>;
+  using InputVector = Eigen::Matrix<double, Nu, 1>;
+
+  /**
+   * @brief constructor
+   * @param [in] wheelbase wheelbase of the vehicle [m]
+   */
+  explicit VehicleModelFixedSize(double wheelbase) : VehicleModelInterface(Nx, Nu, Ny, wheelbase)
+  {
+  }
+
+  /**
+   * @brief calculate discrete model matrix of x_k+1 = a_d * xk + b_d * uk + w_d, yk = c_d * xk
+   * @param [out] a_d coefficient matrix
+   * @param [out] b_d coefficient matrix
+   * @param [out] c_d coefficient matrix
+   * @param [out] w_d coefficient matrix
+   * @param [in] dt Discretization time [s]
+   */
+  virtual void calculateDiscreteMatrix(
+    StateMatrix & a_d, InputMatrix & b_d, OutputMatrix & c_d, StateVector & w_d,
+    const double dt) = 0;
+
+  /**
+   * @brief calculate reference input
+   * @param [out] u_ref input
+   */
+  virtual void calculateReferenceInput(InputVector & u_ref) = 0;
+
+  void calculateDiscreteMatrix(
+    Eigen::MatrixXd & a_d, Eigen::MatrixXd & b_d, Eigen::MatrixXd & c_d, Eigen::MatrixXd & w_d,
+    const double dt) override
+  {
+    StateMatrix a_d_fixed;
+    InputMatrix b_d_fixed;
+    OutputMatrix c_d_fixed;
+    StateVector w_d_fixed;
+    calculateDiscreteMatrix(a_d_fixed, b_d_fixed, c_d_fixed, w_d_fixed, dt);
+    a_d = a_d_fixed;
+    b_d = b_d_fixed;
+    c_d = c_d_fixed;
+    w_d = w_d_fixed;
+  }
+
+  void calculateReferenceInput(Eigen::MatrixXd & u_ref) override
+  {
+    InputVector u_ref_fixed;
+    calculateReferenceInput(u_ref_fixed);
+    u_ref = u_ref_fixed;
+  }
+
+protected:
+  /**
+   * @brief bilinear discretization of x_dot = a * x + b * u + w for ZOH system
+   * @param [in,out] a_d continuous matrix as input, and discrete one as output
+   * @param [in,out] b_d continuous matrix as input, and discrete one as output
+   * @param [in,out] w_d continuous matrix as input, and discrete one as output
+   * @param [in] dt Discretization time [s]
+   */
+  static void discretizeBilinear(
+    StateMatrix & a_d, InputMatrix & b_d, StateVector & w_d, const double dt)
+  {
+    const StateMatrix I = StateMatrix::Identity();
+    const StateMatrix i_dt2a_inv = (I - dt * 0.5 * a_d).inverse();
+    a_d = i_dt2a_inv * (I + dt * 0.5 * a_d);
+    b_d = i_dt2a_inv * b_d * dt;
+    w_d = i_dt2a_inv * w_d * dt;
+  }
+};
+}  // namespace autoware::motion::control::mpc_lateral_controller
+#endif  // MPC_LATERAL_CONTROLLER__VEHICLE_MODEL__VEHICLE_MODEL_FIXED_SIZE_HPP_
@@ -367,6 +367,8 @@ std::pair<bool, VectorXd> MPC::updateStateForDelayCompensation(
   MatrixXd Cd(DIM_Y, DIM_X);
 
   MatrixXd x_curr = x0_orig;
+  MatrixXd x_next(DIM_X, 1);
+  MatrixXd ud = MatrixXd::Zero(DIM_U, 1);
   double mpc_curr_time = start_time;
   for (size_t i = 0; i < m_input_buffer.size(); ++i) {
     double k, v = 0.0;
@@ -382,9 +384,11 @@ std::pair<bool, VectorXd> MPC::updateStateForDelayCompensation(
     m_vehicle_model_ptr->setVelocity(v);
     m_vehicle_model_ptr->setCurvature(k);
     m_vehicle_model_ptr->calculateDiscreteMatrix(Ad, Bd, Cd, Wd, m_ctrl_period);
-    MatrixXd ud = MatrixXd::Zero(DIM_U, 1);
     ud(0, 0) = m_input_buffer.at(i);  // for steering input delay
-    x_curr = Ad * x_curr + Bd * ud + Wd;
+    x_next.noalias() = Ad * x_curr;
+    x_next.noalias() += Bd * ud;
+    x_next += Wd;
+    x_curr.swap(x_next);
     mpc_curr_time += m_ctrl_period;
   }
   return {true, x_curr};
@@ -491,13 +495,13 @@ MPCMatrix MPC::generateMPCMatrix(
       m.Bex.block(0, 0, DIM_X, DIM_U) = Bd;
       m.Wex.block(0, 0, DIM_X, 1) = Wd;
     } else {
-      m.Aex.block(idx_x_i, 0, DIM_X, DIM_X) = Ad * m.Aex.block(idx_x_i_prev, 0, DIM_X, DIM_X);
-      for (int j = 0; j < i; ++j) {
-        int idx_u_j = j * DIM_U;
-        m.Bex.block(idx_x_i, idx_u_j, DIM_X, DIM_U) =
-          Ad * m.Bex.block(idx_x_i_prev, idx_u_j, DIM_X, DIM_U);
-      }
-      m.Wex.block(idx_x_i, 0, DIM_X, 1) = Ad * m.Wex.block(idx_x_i_prev, 0, DIM_X, 1) + Wd;
+      m.Aex.block(idx_x_i, 0, DIM_X, DIM_X).noalias() =
+        Ad * m.Aex.block(idx_x_i_prev, 0, DIM_X, DIM_X);
+      // all the blocks of the previous inputs at once
+      m.Bex.block(idx_x_i, 0, DIM_X, idx_u_i).noalias() =
+        Ad * m.Bex.block(idx_x_i_prev, 0, DIM_X, idx_u_i);
+      m.Wex.block(idx_x_i, 0, DIM_X, 1) = Wd;
+      m.Wex.block(idx_x_i, 0, DIM_X, 1).noalias() += Ad * m.Wex.block(idx_x_i_prev, 0, DIM_X, 1);
     }
     m.Bex.block(idx_x_i, idx_u_i, DIM_X, DIM_U) = Bd;
     m.Cex.block(idx_y_i, idx_x_i, DIM_Y, DIM_X) = Cd;
@@ -560,18 +564,41 @@ std::pair<bool, VectorXd> MPC::executeOptimization(
     return {false, {}};
   }
 
-  const int DIM_U_N = m_param.prediction_horizon * m_vehicle_model_ptr->getDimU();
+  const int N = m_param.prediction_horizon;
+  const int DIM_X = m_vehicle_model_ptr->getDimX();
+  const int DIM_U = m_vehicle_model_ptr->getDimU();
+  const int DIM_Y = m_vehicle_model_ptr->getDimY();
+  const int DIM_U_N = N * DIM_U;
 
   // cost function: 1/2 * Uex' * H * Uex + f' * Uex,  H = B' * C' * Q * C * B + R
-  const MatrixXd CB = m.Cex * m.Bex;
-  const MatrixXd QCB = m.Qex * CB;
-  // MatrixXd H = CB.transpose() * QCB + m.R1ex + m.R2ex; // This calculation is heavy. looking for
-  // a good way.  //NOLINT
+  // NOTE: Cex and Qex are block diagonal and Bex is block lower triangular, so that only the
+  //       non-zero blocks of each step are multiplied instead of the dense matrices.
+  //       The i-th block row of CB has the non-zero blocks of the inputs from 0 to i, and
+  //       H = sum_i CB_i' * Q_i * CB_i.
+  const VectorXd AxW = m.Aex * x0 + m.Wex;
+  VectorXd CAxW(DIM_Y * N);
+  MatrixXd QCB = MatrixXd::Zero(DIM_Y * N, DIM_U_N);
   MatrixXd H = MatrixXd::Zero(DIM_U_N, DIM_U_N);
-  H.triangularView<Eigen::Upper>() = CB.transpose() * QCB;
+  MatrixXd CB_i(DIM_Y, DIM_U_N);
+  for (int i = 0; i < N; ++i) {
+    const int idx_x_i = i * DIM_X;
+    const int idx_y_i = i * DIM_Y;
+    const int num_u = (i + 1) * DIM_U;
+    const auto Cd = m.Cex.block(idx_y_i, idx_x_i, DIM_Y, DIM_X);
+    const auto Q = m.Qex.block(idx_y_i, idx_y_i, DIM_Y, DIM_Y);
+
+    auto CB_i_block = CB_i.leftCols(num_u);
+    CB_i_block.noalias() = Cd * m.Bex.block(idx_x_i, 0, DIM_X, num_u);
+    auto QCB_i = QCB.block(idx_y_i, 0, DIM_Y, num_u);
+    QCB_i.noalias() = Q * CB_i_block;
+    H.topLeftCorner(num_u, num_u).triangularView<Eigen::Upper>() +=
+      CB_i_block.transpose() * QCB_i;
+
+    CAxW.segment(idx_y_i, DIM_Y).noalias() = Cd * AxW.segment(idx_x_i, DIM_X);
+  }
   H.triangularView<Eigen::Upper>() += m.R1ex + m.R2ex;
   H.triangularView<Eigen::Lower>() = H.transpose();
-  MatrixXd f = (m.Cex * (m.Aex * x0 + m.Wex)).transpose() * QCB - m.Uref_ex.transpose() * m.R1ex;
+  MatrixXd f = CAxW.transpose() * QCB - m.Uref_ex.transpose() * m.R1ex;
   addSteerWeightF(prediction_dt, f);
 
   MatrixXd A = MatrixXd::Identity(DIM_U_N, DIM_U_N);
@@ -0,0 +1,146 @@
+// Copyright 2023 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "mpc_lateral_controller/qp_solver/qp_solver_osqp_warm_start.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace autoware::motion::control::mpc_lateral_controller
+{
+namespace
+{
+// shift the segment of the vector by one step, repeating the last element
+void shiftSegment(const size_t begin, const size_t end, std::vector<double> & v)
+{
+  if (end - begin < 2) {
+    return;
+  }
+  std::rotate(v.begin() + begin, v.begin() + begin + 1, v.begin() + end);
+  v.at(end - 1) = v.at(end - 2);
+}
+}  // namespace
+
+QPSolverOSQPWarmStart::QPSolverOSQPWarmStart(const rclcpp::Logger & logger) : logger_{logger}
+{
+}
+
+bool QPSolverOSQPWarmStart::solve(
+  const Eigen::MatrixXd & h_mat, const Eigen::MatrixXd & f_vec, const Eigen::MatrixXd & a,
+  const Eigen::VectorXd & lb, const Eigen::VectorXd & ub, const Eigen::VectorXd & lb_a,
+  const Eigen::VectorXd & ub_a, Eigen::VectorXd & u)
+{
+  const Eigen::Index dim_u = ub.size();
+  const Eigen::Index dim_a = a.rows();
+
+  // NOTE: all the elements of the upper triangle are stored even if they are zero, so that the
+  // structure of P does not change over the cycles.
+  Eigen::SparseMatrix<double> P(dim_u, dim_u);
+  P.reserve(Eigen::VectorXi::LinSpaced(dim_u, 1, static_cast<int>(dim_u)));
+  for (Eigen::Index j = 0; j < dim_u; ++j) {
+    for (Eigen::Index i = 0; i <= j; ++i) {
+      P.insert(i, j) = h_mat(i, j);
+    }
+  }
+
+  // constraint [I; a] for the bounds of u and a*u
+  Eigen::SparseMatrix<double> A(dim_u + dim_a, dim_u);
+  {
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(static_cast<size_t>(dim_u + a.nonZeros()));
+    for (Eigen::Index i = 0; i < dim_u; ++i) {
+      triplets.emplace_back(i, i, 1.0);
+    }
+    for (Eigen::Index j = 0; j < a.cols(); ++j) {
+      for (Eigen::Index i = 0; i < dim_a; ++i) {
+        if (a(i, j) != 0.0) {
+          triplets.emplace_back(dim_u + i, j, a(i, j));
+        }
+      }
+    }
+    A.setFromTriplets(triplets.begin(), triplets.end());
+  }
+
+  // convert matrix to vector for osqpsolver
+  std::vector<double> f(f_vec.data(), f_vec.data() + f_vec.size());
+
+  std::vector<double> lower_bound(lb.data(), lb.data() + dim_u);
+  std::vector<double> upper_bound(ub.data(), ub.data() + dim_u);
+  lower_bound.insert(lower_bound.end(), lb_a.data(), lb_a.data() + dim_a);
+  upper_bound.insert(upper_bound.end(), ub_a.data(), ub_a.data() + dim_a);
+
+  if (updateProblem(P, A, f, lower_bound, upper_bound)) {
+    // the bounds of u and the rows of a are shifted by one step respectively
+    shiftSegment(0, static_cast<size_t>(dim_u), prev_primal_);
+    shiftSegment(0, static_cast<size_t>(dim_u), prev_dual_);
+    shiftSegment(static_cast<size_t>(dim_u), prev_dual_.size(), prev_dual_);
+    osqpsolver_.setWarmStart(prev_primal_, prev_dual_);
+  }
+
+  /* execute optimization */
+  auto result = osqpsolver_.optimize();
+
+  std::vector<double> U_osqp = std::get<0>(result);
+  u = Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, 1>>(
+    &U_osqp[0], static_cast<Eigen::Index>(U_osqp.size()), 1);
+
+  const int status_val = std::get<3>(result);
+  const auto has_nan =
+    std::any_of(U_osqp.begin(), U_osqp.end(), [](const auto v) { return std::isnan(v); });
+  if (status_val != 1 || has_nan) {
+    // set up the problem again not to start from the failed solution
+    is_initialized_ = false;
+    if (status_val != 1) {
+      RCLCPP_WARN(logger_, "optimization failed : %s", osqpsolver_.getStatusMessage().c_str());
+    } else {
+      RCLCPP_WARN(logger_, "optimization failed: result contains NaN values");
+    }
+    return false;
+  }
+
+  prev_primal_ = std::move(U_osqp);
+  prev_dual_ = std::get<1>(result);
+
+  // polish status: successful (1), unperformed (0), (-1) unsuccessful
+  int status_polish = std::get<2>(result);
+  if (status_polish == -1 || status_polish == 0) {
+    const auto s = (status_polish == 0) ? "Polish process is not performed in osqp."
+                                        : "Polish process failed in osqp.";
+    RCLCPP_INFO(logger_, "%s The required accuracy is met, but the solution can be inaccurate.", s);
+    return true;
+  }
+  return true;
+}
+
+bool QPSolverOSQPWarmStart::updateProblem(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
+{
+  // NOTE: updateP() and updateA() fail if the sparsity is different from the stored one
+  const bool can_update = is_initialized_ && dim_u_ == P.cols() && dim_constraint_ == A.rows() &&
+                          osqpsolver_.updateP(P) && osqpsolver_.updateA(A);
+  if (can_update) {
+    osqpsolver_.updateQ(q);
+    osqpsolver_.updateBounds(l, u);
+    return true;
+  }
+
+  osqpsolver_.initializeProblem(P, A, q, l, u);
+  is_initialized_ = true;
+  dim_u_ = P.cols();
+  dim_constraint_ = A.rows();
+  return false;
+}
+}  // namespace autoware::motion::control::mpc_lateral_controller
@@ -21,7 +21,7 @@ namespace autoware::motion::control::mpc_lateral_controller
 DynamicsBicycleModel::DynamicsBicycleModel(
   const double wheelbase, const double mass_fl, const double mass_fr, const double mass_rl,
   const double mass_rr, const double cf, const double cr)
-: VehicleModelInterface(/* dim_x */ 4, /* dim_u */ 1, /* dim_y */ 2, wheelbase)
+: VehicleModelFixedSize(wheelbase)
 {
   const double mass_front = mass_fl + mass_fr;
   const double mass_rear = mass_rl + mass_rr;
@@ -35,8 +35,7 @@ DynamicsBicycleModel::DynamicsBicycleModel(
 }
 
 void DynamicsBicycleModel::calculateDiscreteMatrix(
-  Eigen::MatrixXd & a_d, Eigen::MatrixXd & b_d, Eigen::MatrixXd & c_d, Eigen::MatrixXd & w_d,
-  const double dt)
+  StateMatrix & a_d, InputMatrix & b_d, OutputMatrix & c_d, StateVector & w_d, const double dt)
 {
   /*
    * x[k+1] = a_d*x[k] + b_d*u + w_d
@@ -44,7 +43,7 @@ void DynamicsBicycleModel::calculateDiscreteMatrix(
 
   const double vel = std::max(m_velocity, 0.01);
 
-  a_d = Eigen::MatrixXd::Zero(m_dim_x, m_dim_x);
+  a_d = StateMatrix::Zero();
   a_d(0, 1) = 1.0;
   a_d(1, 1) = -(m_cf + m_cr) / (m_mass * vel);
   a_d(1, 2) = (m_cf + m_cr) / m_mass;
@@ -54,32 +53,27 @@ void DynamicsBicycleModel::calculateDiscreteMatrix(
   a_d(3, 2) = (m_lf * m_cf - m_lr * m_cr) / m_iz;
   a_d(3, 3) = -(m_lf * m_lf * m_cf + m_lr * m_lr * m_cr) / (m_iz * vel);
 
-  Eigen::MatrixXd I = Eigen::MatrixXd::Identity(m_dim_x, m_dim_x);
-  Eigen::MatrixXd a_d_inverse = (I - dt * 0.5 * a_d).inverse();
-
-  a_d = a_d_inverse * (I + dt * 0.5 * a_d);  // bilinear discretization
-
-  b_d = Eigen::MatrixXd::Zero(m_dim_x, m_dim_u);
+  b_d = InputMatrix::Zero();
   b_d(0, 0) = 0.0;
   b_d(1, 0) = m_cf / m_mass;
   b_d(2, 0) = 0.0;
   b_d(3, 0) = m_lf * m_cf / m_iz;
 
-  w_d = Eigen::MatrixXd::Zero(m_dim_x, 1);
+  w_d = StateVector::Zero();
   w_d(0, 0) = 0.0;
   w_d(1, 0) = (m_lr * m_cr - m_lf * m_cf) / (m_mass * vel) - vel;
   w_d(2, 0) = 0.0;
   w_d(3, 0) = -(m_lf * m_lf * m_cf + m_lr * m_lr * m_cr) / (m_iz * vel);
+  w_d *= m_curvature * vel;
 
-  b_d = (a_d_inverse * dt) * b_d;
-  w_d = (a_d_inverse * dt * m_curvature * vel) * w_d;
+  discretizeBilinear(a_d, b_d, w_d, dt);
 
-  c_d = Eigen::MatrixXd::Zero(m_dim_y, m_dim_x);
+  c_d = OutputMatrix::Zero();
   c_d(0, 0) = 1.0;
   c_d(1, 2) = 1.0;
 }
 
-void DynamicsBicycleModel::calculateReferenceInput(Eigen::MatrixXd & u_ref)
+void DynamicsBicycleModel::calculateReferenceInput(InputVector & u_ref)
 {
   const double vel = std::max(m_velocity, 0.01);
   const double Kv =
@@ -20,15 +20,14 @@ namespace autoware::motion::control::mpc_lateral_controller
 {
 KinematicsBicycleModel::KinematicsBicycleModel(
   const double wheelbase, const double steer_lim, const double steer_tau)
-: VehicleModelInterface(/* dim_x */ 3, /* dim_u */ 1, /* dim_y */ 2, wheelbase)
+: VehicleModelFixedSize(wheelbase)
 {
   m_steer_lim = steer_lim;
   m_steer_tau = steer_tau;
 }
 
 void KinematicsBicycleModel::calculateDiscreteMatrix(
-  Eigen::MatrixXd & a_d, Eigen::MatrixXd & b_d, Eigen::MatrixXd & c_d, Eigen::MatrixXd & w_d,
-  const double dt)
+  StateMatrix & a_d, InputMatrix & b_d, OutputMatrix & c_d, StateVector & w_d, const double dt)
 {
   auto sign = [](double x) { return (x > 0.0) - (x < 0.0); };
 
@@ -57,14 +56,10 @@ void KinematicsBicycleModel::calculateDiscreteMatrix(
 
   // bilinear discretization for ZOH system
   // no discretization is needed for Cd
-  Eigen::MatrixXd I = Eigen::MatrixXd::Identity(m_dim_x, m_dim_x);
-  const Eigen::MatrixXd i_dt2a_inv = (I - dt * 0.5 * a_d).inverse();
-  a_d = i_dt2a_inv * (I + dt * 0.5 * a_d);
-  b_d = i_dt2a_inv * b_d * dt;
-  w_d = i_dt2a_inv * w_d * dt;
+  discretizeBilinear(a_d, b_d, w_d, dt);
 }
 
-void KinematicsBicycleModel::calculateReferenceInput(Eigen::MatrixXd & u_ref)
+void KinematicsBicycleModel::calculateReferenceInput(InputVector & u_ref)
 {
   u_ref(0, 0) = std::atan(m_wheelbase * m_curvature);
 }
@@ -20,14 +20,13 @@ namespace autoware::motion::control::mpc_lateral_controller
 {
 KinematicsBicycleModelNoDelay::KinematicsBicycleModelNoDelay(
   const double wheelbase, const double steer_lim)
-: VehicleModelInterface(/* dim_x */ 2, /* dim_u */ 1, /* dim_y */ 2, wheelbase)
+: VehicleModelFixedSize(wheelbase)
 {
   m_steer_lim = steer_lim;
 }
 
 void KinematicsBicycleModelNoDelay::calculateDiscreteMatrix(
-  Eigen::MatrixXd & a_d, Eigen::MatrixXd & b_d, Eigen::MatrixXd & c_d, Eigen::MatrixXd & w_d,
-  const double dt)
+  StateMatrix & a_d, InputMatrix & b_d, OutputMatrix & c_d, StateVector & w_d, const double dt)
 {
   auto sign = [](double x) { return (x > 0.0) - (x < 0.0); };
 
@@ -48,14 +47,10 @@ void KinematicsBicycleModelNoDelay::calculateDiscreteMatrix(
 
   // bilinear discretization for ZOH system
   // no discretization is needed for Cd
-  Eigen::MatrixXd I = Eigen::MatrixXd::Identity(m_dim_x, m_dim_x);
-  const Eigen::MatrixXd i_dt2a_inv = (I - dt * 0.5 * a_d).inverse();
-  a_d = i_dt2a_inv * (I + dt * 0.5 * a_d);
-  b_d = i_dt2a_inv * b_d * dt;
-  w_d = i_dt2a_inv * w_d * dt;
+  discretizeBilinear(a_d, b_d, w_d, dt);
 }
 
-void KinematicsBicycleModelNoDelay::calculateReferenceInput(Eigen::MatrixXd & u_ref)
+void KinematicsBicycleModelNoDelay::calculateReferenceInput(InputVector & u_ref)
 {
   u_ref(0, 0) = std::atan(m_wheelbase * m_curvature);
 }
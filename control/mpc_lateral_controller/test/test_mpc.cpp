@@ -15,6 +15,7 @@
 #include "gtest/gtest.h"
 #include "mpc_lateral_controller/mpc.hpp"
 #include "mpc_lateral_controller/qp_solver/qp_solver_osqp.hpp"
+#include "mpc_lateral_controller/qp_solver/qp_solver_osqp_warm_start.hpp"
 #include "mpc_lateral_controller/qp_solver/qp_solver_unconstraint_fast.hpp"
 #include "mpc_lateral_controller/vehicle_model/vehicle_model_bicycle_dynamics.hpp"
 #include "mpc_lateral_controller/vehicle_model/vehicle_model_bicycle_kinematics.hpp"
@@ -290,6 +291,41 @@ TEST_F(MPCTest, OsqpCalculateRightTurn)
   EXPECT_LT(ctrl_cmd.steering_tire_rotation_rate, 0.0f);
 }
 
+TEST_F(MPCTest, OsqpWarmStartCalculateRightTurn)
+{
+  const auto current_kinematics =
+    makeOdometry(dummy_right_turn_trajectory.points.front().pose, 0.0);
+  const auto odom = makeOdometry(pose_zero, default_velocity);
+
+  const auto setup = [&](MPC & mpc, const std::shared_ptr<QPSolverInterface> & qpsolver_ptr) {
+    initializeMPC(mpc);
+    mpc.setReferenceTrajectory(dummy_right_turn_trajectory, trajectory_param, current_kinematics);
+    mpc.setVehicleModel(
+      std::make_shared<KinematicsBicycleModel>(wheelbase, steer_limit, steer_tau));
+    mpc.setQPSolver(qpsolver_ptr);
+  };
+
+  MPC mpc_osqp;
+  setup(mpc_osqp, std::make_shared<QPSolverOSQP>(logger));
+  MPC mpc_warm_start;
+  setup(mpc_warm_start, std::make_shared<QPSolverOSQPWarmStart>(logger));
+
+  // the workspace is kept from the first cycle
+  for (int i = 0; i < 3; ++i) {
+    AckermannLateralCommand ctrl_cmd;
+    AckermannLateralCommand ctrl_cmd_warm_start;
+    Trajectory pred_traj;
+    Float32MultiArrayStamped diag;
+    ASSERT_TRUE(mpc_osqp.calculateMPC(neutral_steer, odom, ctrl_cmd, pred_traj, diag));
+    ASSERT_TRUE(
+      mpc_warm_start.calculateMPC(neutral_steer, odom, ctrl_cmd_warm_start, pred_traj, diag));
+    EXPECT_LT(ctrl_cmd_warm_start.steering_tire_angle, 0.0f);
+    EXPECT_NEAR(ctrl_cmd_warm_start.steering_tire_angle, ctrl_cmd.steering_tire_angle, 1e-4);
+    EXPECT_NEAR(
+      ctrl_cmd_warm_start.steering_tire_rotation_rate, ctrl_cmd.steering_tire_rotation_rate, 1e-3);
+  }
+}
+
 TEST_F(MPCTest, KinematicsNoDelayCalculate)
 {
   MPC mpc;
@@ -15,6 +15,7 @@
 #ifndef OBSTACLE_COLLISION_CHECKER__OBSTACLE_COLLISION_CHECKER_HPP_
 #define OBSTACLE_COLLISION_CHECKER__OBSTACLE_COLLISION_CHECKER_HPP_
 
+#include <geometry/flat_spatial_hash.hpp>
 #include <tier4_autoware_utils/geometry/boost_geometry.hpp>
 #include <vehicle_info_util/vehicle_info_util.hpp>
 
@@ -30,11 +31,13 @@
 #include <pcl/point_types.h>
 
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace obstacle_collision_checker
 {
+using autoware::common::geometry::spatial_hash::FlatSpatialHash2d;
 using tier4_autoware_utils::LinearRing2d;
 
 struct Param
@@ -44,6 +47,8 @@ struct Param
   double max_deceleration;
   double resample_interval;
   double search_radius;
+  bool use_point_grid;
+  double point_grid_resolution;
 };
 
 struct Input
@@ -71,12 +76,30 @@ public:
   explicit ObstacleCollisionChecker(rclcpp::Node & node);
   Output update(const Input & input);
 
-  void setParam(const Param & param) { param_ = param; }
+  void setParam(const Param & param);
 
 private:
   Param param_;
   vehicle_info_util::VehicleInfo vehicle_info_;
 
+  // the obstacle pointcloud in the map frame, kept until the pointcloud or its transform changes
+  sensor_msgs::msg::PointCloud2::ConstSharedPtr obstacle_pointcloud_msg_;
+  geometry_msgs::msg::Transform obstacle_transform_;
+  pcl::PointCloud<pcl::PointXYZ> obstacle_pointcloud_;
+  std::unique_ptr<FlatSpatialHash2d> obstacle_point_grid_;
+
+  // the footprints on the resampled trajectory, kept until the predicted trajectory changes. They
+  // are created on demand, since only the part within the braking distance is checked.
+  autoware_auto_planning_msgs::msg::Trajectory::ConstSharedPtr predicted_trajectory_;
+  autoware_auto_planning_msgs::msg::Trajectory resampled_trajectory_;
+  std::vector<LinearRing2d> resampled_vehicle_footprints_;
+  std::vector<LinearRing2d> resampled_vehicle_passing_areas_;
+
+  void updateObstaclePointCloud(const Input & input);
+  void updateResampledTrajectory(const Input & input);
+  void createVehicleFootprintsFromCache(
+    const autoware_auto_planning_msgs::msg::Trajectory & cut_trajectory, Output & output);
+
   //! This function assumes the input trajectory is sampled dense enough
   static autoware_auto_planning_msgs::msg::Trajectory resampleTrajectory(
     const autoware_auto_planning_msgs::msg::Trajectory & trajectory, const double interval);
@@ -84,13 +107,10 @@ private:
   static autoware_auto_planning_msgs::msg::Trajectory cutTrajectory(
     const autoware_auto_planning_msgs::msg::Trajectory & trajectory, const double length);
 
-  static std::vector<LinearRing2d> createVehicleFootprints(
-    const autoware_auto_planning_msgs::msg::Trajectory & trajectory, const Param & param,
+  static LinearRing2d createVehicleFootprint(
+    const geometry_msgs::msg::Pose & pose, const Param & param,
     const vehicle_info_util::VehicleInfo & vehicle_info);
 
-  static std::vector<LinearRing2d> createVehiclePassingAreas(
-    const std::vector<LinearRing2d> & vehicle_footprints);
-
   static LinearRing2d createHullFromFootprints(
     const LinearRing2d & area1, const LinearRing2d & area2);
 
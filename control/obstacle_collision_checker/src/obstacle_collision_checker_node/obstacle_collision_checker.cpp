@@ -32,11 +32,16 @@
 #include <tf2_eigen/tf2_eigen.hpp>
 #endif
 
+#include <algorithm>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 namespace
 {
+using obstacle_collision_checker::FlatSpatialHash2d;
+using obstacle_collision_checker::LinearRing2d;
+
 pcl::PointCloud<pcl::PointXYZ> getTransformedPointCloud(
   const sensor_msgs::msg::PointCloud2 & pointcloud_msg,
   const geometry_msgs::msg::Transform & transform)
@@ -70,6 +75,52 @@ pcl::PointCloud<pcl::PointXYZ> filterPointCloudByTrajectory(
   return filtered_pointcloud;
 }
 
+bool willCollideWithPointGrid(
+  const FlatSpatialHash2d & point_grid, const pcl::PointCloud<pcl::PointXYZ> & pointcloud,
+  const autoware_auto_planning_msgs::msg::Trajectory & trajectory, const double radius,
+  const std::vector<LinearRing2d> & vehicle_passing_areas)
+{
+  // the same points as filterPointCloudByTrajectory()
+  const auto is_near_trajectory = [&](const pcl::PointXYZ & point) {
+    return std::any_of(
+      trajectory.points.begin(), trajectory.points.end(), [&](const auto & trajectory_point) {
+        const double dx = trajectory_point.pose.position.x - point.x;
+        const double dy = trajectory_point.pose.position.y - point.y;
+        return std::hypot(dx, dy) < radius;
+      });
+  };
+
+  std::vector<geometry_msgs::msg::Point> vertices;
+  for (size_t i = 1; i < vehicle_passing_areas.size(); i++) {
+    // skip first footprint because surround obstacle checker handle it
+    vertices.clear();
+    for (const auto & vertex : vehicle_passing_areas.at(i)) {
+      vertices.push_back(tier4_autoware_utils::createPoint(vertex.x(), vertex.y(), 0.0));
+    }
+
+    // only the points in the bins overlapping with the footprint are checked
+    const pcl::PointXYZ * collision_point = nullptr;
+    point_grid.visit_within_polygon(vertices, [&](const size_t idx) {
+      const auto & point = pointcloud.points.at(idx);
+      if (!is_near_trajectory(point)) {
+        return false;
+      }
+      collision_point = &point;
+      return true;
+    });
+
+    if (collision_point) {
+      RCLCPP_WARN(
+        rclcpp::get_logger("obstacle_collision_checker"),
+        "[ObstacleCollisionChecker] Collide to Point x: %f y: %f", collision_point->x,
+        collision_point->y);
+      return true;
+    }
+  }
+
+  return false;
+}
+
 double calcBrakingDistance(
   const double abs_velocity, const double max_deceleration, const double delay_time)
 {
@@ -87,6 +138,16 @@ ObstacleCollisionChecker::ObstacleCollisionChecker(rclcpp::Node & node)
 {
 }
 
+void ObstacleCollisionChecker::setParam(const Param & param)
+{
+  param_ = param;
+
+  // the cached results depend on the parameters
+  obstacle_pointcloud_msg_.reset();
+  obstacle_point_grid_.reset();
+  predicted_trajectory_.reset();
+}
+
 Output ObstacleCollisionChecker::update(const Input & input)
 {
   Output output;
@@ -98,29 +159,102 @@ Output ObstacleCollisionChecker::update(const Input & input)
   const auto abs_velocity = raw_abs_velocity < min_velocity ? 0.0 : raw_abs_velocity;
   const auto braking_distance =
     calcBrakingDistance(abs_velocity, param_.max_deceleration, param_.delay_time);
-  output.resampled_trajectory = cutTrajectory(
-    resampleTrajectory(*input.predicted_trajectory, param_.resample_interval), braking_distance);
+  updateResampledTrajectory(input);
+  output.resampled_trajectory = cutTrajectory(resampled_trajectory_, braking_distance);
   output.processing_time_map["resampleTrajectory"] = stop_watch.toc(true);
 
-  // resample pointcloud
-  const auto obstacle_pointcloud =
-    getTransformedPointCloud(*input.obstacle_pointcloud, input.obstacle_transform->transform);
-  const auto filtered_obstacle_pointcloud = filterPointCloudByTrajectory(
-    obstacle_pointcloud, output.resampled_trajectory, param_.search_radius);
+  // transform pointcloud
+  updateObstaclePointCloud(input);
 
-  output.vehicle_footprints =
-    createVehicleFootprints(output.resampled_trajectory, param_, vehicle_info_);
+  createVehicleFootprintsFromCache(output.resampled_trajectory, output);
   output.processing_time_map["createVehicleFootprints"] = stop_watch.toc(true);
 
-  output.vehicle_passing_areas = createVehiclePassingAreas(output.vehicle_footprints);
-  output.processing_time_map["createVehiclePassingAreas"] = stop_watch.toc(true);
-
-  output.will_collide = willCollide(filtered_obstacle_pointcloud, output.vehicle_passing_areas);
+  if (param_.use_point_grid) {
+    output.will_collide = willCollideWithPointGrid(
+      *obstacle_point_grid_, obstacle_pointcloud_, output.resampled_trajectory,
+      param_.search_radius, output.vehicle_passing_areas);
+  } else {
+    const auto filtered_obstacle_pointcloud = filterPointCloudByTrajectory(
+      obstacle_pointcloud_, output.resampled_trajectory, param_.search_radius);
+    output.will_collide = willCollide(filtered_obstacle_pointcloud, output.vehicle_passing_areas);
+  }
   output.processing_time_map["willCollide"] = stop_watch.toc(true);
 
   return output;
 }
 
+void ObstacleCollisionChecker::updateObstaclePointCloud(const Input & input)
+{
+  if (
+    input.obstacle_pointcloud == obstacle_pointcloud_msg_ &&
+    input.obstacle_transform->transform == obstacle_transform_) {
+    return;
+  }
+
+  obstacle_pointcloud_ =
+    getTransformedPointCloud(*input.obstacle_pointcloud, input.obstacle_transform->transform);
+  obstacle_pointcloud_msg_ = input.obstacle_pointcloud;
+  obstacle_transform_ = input.obstacle_transform->transform;
+
+  if (param_.use_point_grid) {
+    // the grid is kept to reuse its buffers for the next pointcloud
+    if (!obstacle_point_grid_) {
+      obstacle_point_grid_ = std::make_unique<FlatSpatialHash2d>(param_.point_grid_resolution);
+    }
+    const auto & points = obstacle_pointcloud_.points;
+    obstacle_point_grid_->build(points.begin(), points.end());
+  }
+}
+
+void ObstacleCollisionChecker::updateResampledTrajectory(const Input & input)
+{
+  if (input.predicted_trajectory == predicted_trajectory_) {
+    return;
+  }
+
+  resampled_trajectory_ = resampleTrajectory(*input.predicted_trajectory, param_.resample_interval);
+  resampled_vehicle_footprints_.clear();
+  resampled_vehicle_passing_areas_.clear();
+  predicted_trajectory_ = input.predicted_trajectory;
+}
+
+void ObstacleCollisionChecker::createVehicleFootprintsFromCache(
+  const autoware_auto_planning_msgs::msg::Trajectory & cut_trajectory, Output & output)
+{
+  // The cut trajectory is a part of the resampled trajectory, whose last point may be interpolated.
+  // The footprints and the passing areas of the part are taken from the cache.
+  const auto & cut_points = cut_trajectory.points;
+  const auto & resampled_points = resampled_trajectory_.points;
+  size_t num_cached_points = cut_points.size();
+  if (cut_points.back().pose != resampled_points.at(num_cached_points - 1).pose) {
+    --num_cached_points;
+  }
+
+  for (size_t i = resampled_vehicle_footprints_.size(); i < num_cached_points; ++i) {
+    resampled_vehicle_footprints_.push_back(
+      createVehicleFootprint(resampled_points.at(i).pose, param_, vehicle_info_));
+  }
+  for (size_t i = resampled_vehicle_passing_areas_.size(); i + 1 < num_cached_points; ++i) {
+    resampled_vehicle_passing_areas_.push_back(createHullFromFootprints(
+      resampled_vehicle_footprints_.at(i), resampled_vehicle_footprints_.at(i + 1)));
+  }
+
+  output.vehicle_footprints.assign(
+    resampled_vehicle_footprints_.begin(),
+    resampled_vehicle_footprints_.begin() + num_cached_points);
+  output.vehicle_passing_areas.assign(
+    resampled_vehicle_passing_areas_.begin(),
+    resampled_vehicle_passing_areas_.begin() + (num_cached_points - 1));
+
+  // the interpolated last point
+  if (num_cached_points < cut_points.size()) {
+    output.vehicle_footprints.push_back(
+      createVehicleFootprint(cut_points.back().pose, param_, vehicle_info_));
+    output.vehicle_passing_areas.push_back(createHullFromFootprints(
+      output.vehicle_footprints.at(num_cached_points - 1), output.vehicle_footprints.back()));
+  }
+}
+
 autoware_auto_planning_msgs::msg::Trajectory ObstacleCollisionChecker::resampleTrajectory(
   const autoware_auto_planning_msgs::msg::Trajectory & trajectory, const double interval)
 {
@@ -186,36 +320,15 @@ autoware_auto_planning_msgs::msg::Trajectory ObstacleCollisionChecker::cutTrajec
   return cut;
 }
 
-std::vector<LinearRing2d> ObstacleCollisionChecker::createVehicleFootprints(
-  const autoware_auto_planning_msgs::msg::Trajectory & trajectory, const Param & param,
+LinearRing2d ObstacleCollisionChecker::createVehicleFootprint(
+  const geometry_msgs::msg::Pose & pose, const Param & param,
   const vehicle_info_util::VehicleInfo & vehicle_info)
 {
   // Create vehicle footprint in base_link coordinate
   const auto local_vehicle_footprint = vehicle_info.createFootprint(param.footprint_margin);
 
-  // Create vehicle footprint on each TrajectoryPoint
-  std::vector<LinearRing2d> vehicle_footprints;
-  for (const auto & p : trajectory.points) {
-    vehicle_footprints.push_back(
-      tier4_autoware_utils::transformVector<tier4_autoware_utils::LinearRing2d>(
-        local_vehicle_footprint, tier4_autoware_utils::pose2transform(p.pose)));
-  }
-
-  return vehicle_footprints;
-}
-
-std::vector<LinearRing2d> ObstacleCollisionChecker::createVehiclePassingAreas(
-  const std::vector<LinearRing2d> & vehicle_footprints)
-{
-  // Create hull from two adjacent vehicle footprints
-  std::vector<LinearRing2d> areas;
-  for (size_t i = 0; i < vehicle_footprints.size() - 1; ++i) {
-    const auto & footprint1 = vehicle_footprints.at(i);
-    const auto & footprint2 = vehicle_footprints.at(i + 1);
-    areas.push_back(createHullFromFootprints(footprint1, footprint2));
-  }
-
-  return areas;
+  return tier4_autoware_utils::transformVector<tier4_autoware_utils::LinearRing2d>(
+    local_vehicle_footprint, tier4_autoware_utils::pose2transform(pose));
 }
 
 LinearRing2d ObstacleCollisionChecker::createHullFromFootprints(
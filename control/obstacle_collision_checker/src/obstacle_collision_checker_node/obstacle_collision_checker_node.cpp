@@ -60,6 +60,8 @@ ObstacleCollisionCheckerNode::ObstacleCollisionCheckerNode(const rclcpp::NodeOpt
   param_.max_deceleration = declare_parameter<double>("max_deceleration");
   param_.resample_interval = declare_parameter<double>("resample_interval");
   param_.search_radius = declare_parameter<double>("search_radius");
+  param_.use_point_grid = declare_parameter<bool>("use_point_grid", false);
+  param_.point_grid_resolution = declare_parameter<double>("point_grid_resolution", 1.0);
 
   // Dynamic Reconfigure
   set_param_res_ = this->add_on_set_parameters_callback(
@@ -216,6 +218,13 @@ void ObstacleCollisionCheckerNode::onTimer()
     return;
   }
 
+  // the diagnostics are updated only when the predicted trajectory or the pointcloud is updated
+  if (
+    predicted_trajectory_ == input_.predicted_trajectory &&
+    obstacle_pointcloud_ == input_.obstacle_pointcloud) {
+    return;
+  }
+
   input_.current_pose = current_pose_;
   input_.obstacle_pointcloud = obstacle_pointcloud_;
   input_.obstacle_transform = obstacle_transform_;
@@ -255,6 +264,8 @@ rcl_interfaces::msg::SetParametersResult ObstacleCollisionCheckerNode::paramCall
     update_param(parameters, "max_deceleration", p.max_deceleration);
     update_param(parameters, "resample_interval", p.resample_interval);
     update_param(parameters, "search_radius", p.search_radius);
+    update_param(parameters, "use_point_grid", p.use_point_grid);
+    update_param(parameters, "point_grid_resolution", p.point_grid_resolution);
 
     if (obstacle_collision_checker_) {
       obstacle_collision_checker_->setParam(param_);
@@ -15,6 +15,9 @@
 #include "../src/obstacle_collision_checker_node/obstacle_collision_checker.cpp"  // NOLINT
 #include "gtest/gtest.h"
 
+#include <random>
+#include <vector>
+
 TEST(test_obstacle_collision_checker, filterPointCloudByTrajectory)
 {
   pcl::PointCloud<pcl::PointXYZ> pcl;
@@ -44,3 +47,61 @@ TEST(test_obstacle_collision_checker, filterPointCloudByTrajectory)
     }
   }
 }
+
+TEST(test_obstacle_collision_checker, willCollideWithPointGrid)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> dist(-20.0f, 20.0f);
+  pcl::PointCloud<pcl::PointXYZ> pcl;
+  for (size_t i = 0; i < 1000; ++i) {
+    pcl.push_back(pcl::PointXYZ(dist(engine), dist(engine), 0.0f));
+  }
+
+  autoware_auto_planning_msgs::msg::Trajectory trajectory;
+  autoware_auto_planning_msgs::msg::TrajectoryPoint traj_point;
+  for (double x = 0.0; x < 15.0; x += 1.0) {
+    traj_point.pose.position.x = x;
+    trajectory.points.push_back(traj_point);
+  }
+
+  const auto create_box = [](const double x, const double y, const double size) {
+    tier4_autoware_utils::MultiPoint2d corners;
+    corners.emplace_back(x, y);
+    corners.emplace_back(x + size, y);
+    corners.emplace_back(x + size, y + size);
+    corners.emplace_back(x, y + size);
+    LinearRing2d box;
+    boost::geometry::convex_hull(corners, box);
+    return box;
+  };
+
+  FlatSpatialHash2d point_grid(1.0);
+  point_grid.build(pcl.points.begin(), pcl.points.end());
+
+  // the same result as the points filtered by the trajectory and checked in each passing area
+  size_t num_collisions = 0;
+  for (const auto radius : {1.0, 5.0}) {
+    for (double y = -15.0; y < 15.0; y += 0.5) {
+      std::vector<LinearRing2d> passing_areas;
+      for (double x = -2.0; x < 16.0; x += 3.0) {
+        passing_areas.push_back(create_box(x, y, 0.5));
+      }
+
+      const auto filtered_pcl = filterPointCloudByTrajectory(pcl, trajectory, radius);
+      bool expected = false;
+      for (size_t i = 1; i < passing_areas.size(); ++i) {
+        for (const auto & point : filtered_pcl.points) {
+          if (boost::geometry::within(
+                tier4_autoware_utils::Point2d{point.x, point.y}, passing_areas.at(i))) {
+            expected = true;
+          }
+        }
+      }
+      num_collisions += expected ? 1 : 0;
+
+      EXPECT_EQ(
+        willCollideWithPointGrid(point_grid, pcl, trajectory, radius, passing_areas), expected);
+    }
+  }
+  EXPECT_GT(num_collisions, 0ul);
+}
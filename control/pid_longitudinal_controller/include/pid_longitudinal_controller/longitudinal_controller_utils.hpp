@@ -17,6 +17,7 @@
 
 #include "interpolation/linear_interpolation.hpp"
 #include "motion_utils/trajectory/trajectory.hpp"
+#include "motion_utils/trajectory/trajectory_view.hpp"
 #include "tf2/utils.h"
 
 #include <Eigen/Core>
@@ -51,6 +52,16 @@ bool isValidTrajectory(const Trajectory & traj);
 double calcStopDistance(
   const Pose & current_pose, const Trajectory & traj, const double max_dist, const double max_yaw);
 
+/**
+ * @brief calculate distance to stopline from current vehicle position where velocity is 0
+ * @param [in] traj_view view of the trajectory
+ * @param [in] seg_idx index of the segment nearest to the current vehicle position
+ * @param [in] stop_idx index of the point where velocity is 0, or the last index if there is none
+ */
+double calcStopDistance(
+  const Pose & current_pose, const motion_utils::TrajectoryView & traj_view, const size_t seg_idx,
+  const size_t stop_idx);
+
 /**
  * @brief calculate pitch angle from estimated current pose
  */
@@ -83,20 +94,17 @@ Pose calcPoseAfterTimeDelay(
 Quaternion lerpOrientation(const Quaternion & o_from, const Quaternion & o_to, const double ratio);
 
 /**
- * @brief apply linear interpolation to trajectory point that is nearest to a certain point
+ * @brief apply linear interpolation to trajectory point on a segment
  * @param [in] points trajectory points
- * @param [in] point Interpolated point is nearest to this point.
+ * @param [in] seg_idx index of the segment
+ * @param [in] len_to_interpolated length from the front point of the segment to the interpolated
+ * point, which is clamped to the segment
  */
 template <class T>
 TrajectoryPoint lerpTrajectoryPoint(
-  const T & points, const Pose & pose, const double max_dist, const double max_yaw)
+  const T & points, const size_t seg_idx, const double len_to_interpolated)
 {
   TrajectoryPoint interpolated_point;
-  const size_t seg_idx =
-    motion_utils::findFirstNearestSegmentIndexWithSoftConstraints(points, pose, max_dist, max_yaw);
-
-  const double len_to_interpolated =
-    motion_utils::calcLongitudinalOffsetToSegment(points, seg_idx, pose.position);
   const double len_segment = motion_utils::calcSignedArcLength(points, seg_idx, seg_idx + 1);
   const double interpolate_ratio = std::clamp(len_to_interpolated / len_segment, 0.0, 1.0);
 
@@ -123,6 +131,23 @@ TrajectoryPoint lerpTrajectoryPoint(
   return interpolated_point;
 }
 
+/**
+ * @brief apply linear interpolation to trajectory point that is nearest to a certain point
+ * @param [in] points trajectory points
+ * @param [in] point Interpolated point is nearest to this point.
+ */
+template <class T>
+TrajectoryPoint lerpTrajectoryPoint(
+  const T & points, const Pose & pose, const double max_dist, const double max_yaw)
+{
+  const size_t seg_idx =
+    motion_utils::findFirstNearestSegmentIndexWithSoftConstraints(points, pose, max_dist, max_yaw);
+
+  const double len_to_interpolated =
+    motion_utils::calcLongitudinalOffsetToSegment(points, seg_idx, pose.position);
+  return lerpTrajectoryPoint(points, seg_idx, len_to_interpolated);
+}
+
 /**
  * @brief limit variable whose differential is within a certain value
  * @param [in] input_val current value
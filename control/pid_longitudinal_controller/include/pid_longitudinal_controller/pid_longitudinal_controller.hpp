@@ -16,6 +16,7 @@
 #define PID_LONGITUDINAL_CONTROLLER__PID_LONGITUDINAL_CONTROLLER_HPP_
 
 #include "diagnostic_updater/diagnostic_updater.hpp"
+#include "motion_utils/trajectory/trajectory_view.hpp"
 #include "pid_longitudinal_controller/debug_values.hpp"
 #include "pid_longitudinal_controller/longitudinal_controller_utils.hpp"
 #include "pid_longitudinal_controller/lowpass_filter.hpp"
@@ -93,6 +94,11 @@ private:
   nav_msgs::msg::Odometry m_current_kinematic_state;
   geometry_msgs::msg::AccelWithCovarianceStamped m_current_accel;
   autoware_auto_planning_msgs::msg::Trajectory m_trajectory;
+  // preprocessed once for each new trajectory
+  motion_utils::TrajectoryView m_trajectory_view;
+  boost::optional<size_t> m_stop_idx;
+  // nearest index in the previous cycle as the hint of the nearest search on the same trajectory
+  boost::optional<size_t> m_prev_nearest_idx;
   OperationModeState m_current_operation_mode;
 
   // vehicle info
@@ -332,22 +338,26 @@ private:
 
   /**
    * @brief keep target motion acceleration negative before stop
-   * @param [in] traj reference trajectory
    * @param [in] motion delay compensated target motion
+   * @param [in] nearest_idx index of the trajectory point nearest to the vehicle position
+   */
+  Motion keepBrakeBeforeStop(const Motion & target_motion, const size_t nearest_idx) const;
+
+  /**
+   * @brief find the index of the trajectory point nearest to the pose, searched from the hint
+   * @param [in] pose pose to search the nearest point
+   * @param [in] hint_idx index near the result, e.g. the nearest index in the previous cycle
    */
-  Motion keepBrakeBeforeStop(
-    const autoware_auto_planning_msgs::msg::Trajectory & traj, const Motion & target_motion,
-    const size_t nearest_idx) const;
+  size_t findNearestIndex(
+    const geometry_msgs::msg::Pose & pose, const boost::optional<size_t> & hint_idx) const;
 
   /**
-   * @brief interpolate trajectory point that is nearest to vehicle
-   * @param [in] traj reference trajectory
-   * @param [in] point vehicle position
+   * @brief interpolate trajectory point that is nearest to the pose
+   * @param [in] pose pose to interpolate the trajectory point
    * @param [in] nearest_idx index of the trajectory point nearest to the vehicle position
    */
   autoware_auto_planning_msgs::msg::TrajectoryPoint calcInterpolatedTargetValue(
-    const autoware_auto_planning_msgs::msg::Trajectory & traj,
-    const geometry_msgs::msg::Pose & pose) const;
+    const geometry_msgs::msg::Pose & pose, const size_t nearest_idx) const;
 
   /**
    * @brief calculate predicted velocity after time delay based on past control commands
@@ -73,6 +73,21 @@ double calcStopDistance(
   return signed_length_on_traj;
 }
 
+double calcStopDistance(
+  const Pose & current_pose, const motion_utils::TrajectoryView & traj_view, const size_t seg_idx,
+  const size_t stop_idx)
+{
+  // same as calcSignedArcLength() from the current position to the stop point
+  const double signed_length_on_traj =
+    traj_view.calcSignedArcLength(seg_idx, stop_idx) -
+    traj_view.calcLongitudinalOffsetToSegment(seg_idx, current_pose.position);
+
+  if (std::isnan(signed_length_on_traj)) {
+    return 0.0;
+  }
+  return signed_length_on_traj;
+}
+
 double getPitchByPose(const Quaternion & quaternion_msg)
 {
   double roll, pitch, yaw;
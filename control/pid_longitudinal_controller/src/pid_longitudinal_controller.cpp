@@ -212,6 +212,11 @@ void PidLongitudinalController::setCurrentOperationMode(const OperationModeState
 void PidLongitudinalController::setTrajectory(
   const autoware_auto_planning_msgs::msg::Trajectory & msg)
 {
+  // NOTE: the same trajectory is given every cycle until the next one is received
+  if (!m_trajectory_view.empty() && msg == m_trajectory) {
+    return;
+  }
+
   if (!longitudinal_utils::isValidTrajectory(msg)) {
     RCLCPP_ERROR_THROTTLE(logger_, *clock_, 3000, "received invalid trajectory. ignore.");
     return;
@@ -223,6 +228,9 @@ void PidLongitudinalController::setTrajectory(
   }
 
   m_trajectory = msg;
+  m_trajectory_view.build(m_trajectory.points);
+  m_stop_idx = motion_utils::searchZeroVelocityIndex(m_trajectory.points);
+  m_prev_nearest_idx = boost::none;
 }
 
 rcl_interfaces::msg::SetParametersResult PidLongitudinalController::paramCallback(
@@ -424,8 +432,8 @@ PidLongitudinalController::ControlData PidLongitudinalController::getControlData
   control_data.current_motion.acc = m_current_accel.accel.accel.linear.x;
 
   // nearest idx
-  const size_t nearest_idx = motion_utils::findFirstNearestIndexWithSoftConstraints(
-    m_trajectory.points, current_pose, m_ego_nearest_dist_threshold, m_ego_nearest_yaw_threshold);
+  const size_t nearest_idx = findNearestIndex(current_pose, m_prev_nearest_idx);
+  m_prev_nearest_idx = nearest_idx;
   const auto & nearest_point = m_trajectory.points.at(nearest_idx).pose;
 
   // check if the deviation is worth emergency
@@ -454,7 +462,9 @@ PidLongitudinalController::ControlData PidLongitudinalController::getControlData
 
   // distance to stopline
   control_data.stop_dist = longitudinal_utils::calcStopDistance(
-    current_pose, m_trajectory, m_ego_nearest_dist_threshold, m_ego_nearest_yaw_threshold);
+    current_pose, m_trajectory_view,
+    m_trajectory_view.calcSegmentIndex(control_data.nearest_idx, current_pose.position),
+    m_stop_idx ? *m_stop_idx : m_trajectory.points.size() - 1);
 
   // pitch
   // NOTE: getPitchByTraj() calculates the pitch angle as defined in
@@ -661,12 +671,12 @@ PidLongitudinalController::Motion PidLongitudinalController::calcCtrlCmd(
   if (m_control_state == ControlState::DRIVE) {
     const auto target_pose = longitudinal_utils::calcPoseAfterTimeDelay(
       current_pose, m_delay_compensation_time, current_vel, current_acc);
-    const auto target_interpolated_point = calcInterpolatedTargetValue(m_trajectory, target_pose);
+    const auto target_interpolated_point = calcInterpolatedTargetValue(target_pose, nearest_idx);
     target_motion = Motion{
       target_interpolated_point.longitudinal_velocity_mps,
       target_interpolated_point.acceleration_mps2};
 
-    target_motion = keepBrakeBeforeStop(m_trajectory, target_motion, nearest_idx);
+    target_motion = keepBrakeBeforeStop(target_motion, nearest_idx);
 
     const double pred_vel_in_target =
       predictedVelocityInTargetPoint(control_data.current_motion, m_delay_compensation_time);
@@ -853,28 +863,25 @@ double PidLongitudinalController::applySlopeCompensation(
 }
 
 PidLongitudinalController::Motion PidLongitudinalController::keepBrakeBeforeStop(
-  const autoware_auto_planning_msgs::msg::Trajectory & traj, const Motion & target_motion,
-  const size_t nearest_idx) const
+  const Motion & target_motion, const size_t nearest_idx) const
 {
   Motion output_motion = target_motion;
 
   if (m_enable_brake_keeping_before_stop == false) {
     return output_motion;
   }
-  // const auto stop_idx = motion_utils::searchZeroVelocityIndex(traj.points);
-  const auto stop_idx = motion_utils::searchZeroVelocityIndex(traj.points);
-  if (!stop_idx) {
+  if (!m_stop_idx) {
     return output_motion;
   }
 
   double min_acc_before_stop = std::numeric_limits<double>::max();
   size_t min_acc_idx = std::numeric_limits<size_t>::max();
-  for (int i = static_cast<int>(*stop_idx); i >= 0; --i) {
+  for (int i = static_cast<int>(*m_stop_idx); i >= 0; --i) {
     const auto ui = static_cast<size_t>(i);
-    if (traj.points.at(ui).acceleration_mps2 > static_cast<float>(min_acc_before_stop)) {
+    if (m_trajectory.points.at(ui).acceleration_mps2 > static_cast<float>(min_acc_before_stop)) {
       break;
     }
-    min_acc_before_stop = traj.points.at(ui).acceleration_mps2;
+    min_acc_before_stop = m_trajectory.points.at(ui).acceleration_mps2;
     min_acc_idx = ui;
   }
 
@@ -886,18 +893,34 @@ PidLongitudinalController::Motion PidLongitudinalController::keepBrakeBeforeStop
   return output_motion;
 }
 
+size_t PidLongitudinalController::findNearestIndex(
+  const geometry_msgs::msg::Pose & pose, const boost::optional<size_t> & hint_idx) const
+{
+  if (hint_idx) {
+    const auto nearest_idx = m_trajectory_view.findNearestIndexFromHint(
+      pose, *hint_idx, m_ego_nearest_dist_threshold, m_ego_nearest_yaw_threshold);
+    if (nearest_idx) {
+      return *nearest_idx;
+    }
+  }
+  return m_trajectory_view.findFirstNearestIndexWithSoftConstraints(
+    pose, m_ego_nearest_dist_threshold, m_ego_nearest_yaw_threshold);
+}
+
 autoware_auto_planning_msgs::msg::TrajectoryPoint
 PidLongitudinalController::calcInterpolatedTargetValue(
-  const autoware_auto_planning_msgs::msg::Trajectory & traj,
-  const geometry_msgs::msg::Pose & pose) const
+  const geometry_msgs::msg::Pose & pose, const size_t nearest_idx) const
 {
-  if (traj.points.size() == 1) {
-    return traj.points.at(0);
+  if (m_trajectory.points.size() == 1) {
+    return m_trajectory.points.at(0);
   }
 
   // apply linear interpolation
-  return longitudinal_utils::lerpTrajectoryPoint(
-    traj.points, pose, m_ego_nearest_dist_threshold, m_ego_nearest_yaw_threshold);
+  const size_t seg_idx =
+    m_trajectory_view.calcSegmentIndex(findNearestIndex(pose, nearest_idx), pose.position);
+  const double len_to_interpolated =
+    m_trajectory_view.calcLongitudinalOffsetToSegment(seg_idx, pose.position);
+  return longitudinal_utils::lerpTrajectoryPoint(m_trajectory.points, seg_idx, len_to_interpolated);
 }
 
 double PidLongitudinalController::predictedVelocityInTargetPoint(
@@ -1006,7 +1029,8 @@ void PidLongitudinalController::updateDebugVelAcc(
 {
   const double current_vel = control_data.current_motion.vel;
 
-  const auto interpolated_point = calcInterpolatedTargetValue(m_trajectory, current_pose);
+  const auto interpolated_point =
+    calcInterpolatedTargetValue(current_pose, control_data.nearest_idx);
 
   m_debug_values.setValues(DebugValues::TYPE::CURRENT_VEL, current_vel);
   m_debug_values.setValues(DebugValues::TYPE::TARGET_VEL, target_motion.vel);
@@ -102,6 +102,46 @@ TEST(TestLongitudinalControllerUtils, calcStopDistance)
   EXPECT_EQ(longitudinal_utils::calcStopDistance(current_pose, traj, max_dist, max_yaw), 3.0);
 }
 
+TEST(TestLongitudinalControllerUtils, calcStopDistanceWithView)
+{
+  using autoware_auto_planning_msgs::msg::Trajectory;
+  using autoware_auto_planning_msgs::msg::TrajectoryPoint;
+  using geometry_msgs::msg::Pose;
+  const double max_dist = 3.0;
+  const double max_yaw = 0.7;
+  Trajectory traj;
+  TrajectoryPoint point;
+  for (const double vel : {1.0, 1.0, 1.0, 0.0, 1.0, 0.0}) {
+    point.longitudinal_velocity_mps = vel;
+    traj.points.push_back(point);
+    point.pose.position.x += 1.0;
+  }
+
+  // the same as calcStopDistance() with the nearest search
+  const auto calc_stop_dist = [&](const Pose & current_pose) {
+    const motion_utils::TrajectoryView traj_view(traj.points);
+    const size_t seg_idx =
+      traj_view.findFirstNearestSegmentIndexWithSoftConstraints(current_pose, max_dist, max_yaw);
+    const auto stop_idx = motion_utils::searchZeroVelocityIndex(traj.points);
+    return longitudinal_utils::calcStopDistance(
+      current_pose, traj_view, seg_idx, stop_idx ? *stop_idx : traj.points.size() - 1);
+  };
+  Pose current_pose;
+  for (const double x : {-0.5, 0.0, 1.5, 2.9, 3.0, 4.5}) {
+    current_pose.position.x = x;
+    EXPECT_DOUBLE_EQ(
+      calc_stop_dist(current_pose),
+      longitudinal_utils::calcStopDistance(current_pose, traj, max_dist, max_yaw));
+  }
+
+  // non stopping trajectory: stop distance = trajectory length
+  for (auto & p : traj.points) {
+    p.longitudinal_velocity_mps = 1.0;
+  }
+  current_pose.position.x = 0.5;
+  EXPECT_DOUBLE_EQ(calc_stop_dist(current_pose), 4.5);
+}
+
 TEST(TestLongitudinalControllerUtils, getPitchByPose)
 {
   tf2::Quaternion quaternion_tf;
@@ -49,6 +49,7 @@ using autoware_auto_perception_msgs::msg::PredictedObject;
 using autoware_auto_perception_msgs::msg::PredictedObjects;
 using geometry_msgs::msg::Pose;
 using geometry_msgs::msg::TransformStamped;
+using tier4_autoware_utils::Box2d;
 using tier4_autoware_utils::Point2d;
 using tier4_autoware_utils::Polygon2d;
 using PointArray = std::vector<geometry_msgs::msg::Point>;
@@ -76,6 +77,13 @@ struct PredictedObjectWithDetectionTime
   PredictedObject object;
 };
 
+struct PredictedObjectPolygon
+{
+  size_t object_index;
+  Polygon2d polygon;
+  Box2d box;
+};
+
 class CollisionChecker
 {
 public:
@@ -98,8 +106,12 @@ private:
 
   boost::optional<std::pair<geometry_msgs::msg::Point, PredictedObject>> checkDynamicObjects(
     const Pose & base_pose, PredictedObjects::ConstSharedPtr dynamic_objects,
+    const std::vector<PredictedObjectPolygon> & object_polygons,
     const Polygon2d & one_step_move_vehicle_polygon2d, const double z_min, const double z_max);
 
+  static std::vector<PredictedObjectPolygon> createObjectPolygons(
+    const PredictedObjects & dynamic_objects);
+
   void updatePredictedObjectHistory(const rclcpp::Time & now)
   {
     for (auto itr = predicted_object_history_.begin(); itr != predicted_object_history_.end();) {
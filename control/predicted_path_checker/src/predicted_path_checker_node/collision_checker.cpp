@@ -50,6 +50,10 @@ CollisionChecker::checkTrajectoryForCollision(
     return boost::none;
   }
 
+  // NOTE: The polygons and the bounding boxes of the objects do not depend on the trajectory step,
+  // so that they are created once here. Each step checks only the objects overlapping in the boxes.
+  const auto object_polygons = createObjectPolygons(*dynamic_objects);
+
   for (size_t i = 0; i < predicted_trajectory_array.size() - 1; i++) {
     // create one step circle center for vehicle
     const auto & p_front = predicted_trajectory_array.at(i).pose;
@@ -74,7 +78,8 @@ CollisionChecker::checkTrajectoryForCollision(
       checkObstacleHistory(p_front, one_step_move_vehicle_polygon2d, z_min, z_max);
 
     auto found_collision_at_dynamic_objects =
-      checkDynamicObjects(p_front, dynamic_objects, one_step_move_vehicle_polygon2d, z_min, z_max);
+      checkDynamicObjects(
+        p_front, dynamic_objects, object_polygons, one_step_move_vehicle_polygon2d, z_min, z_max);
 
     if (found_collision_at_dynamic_objects || found_collision_at_history) {
       double distance_to_current = std::numeric_limits<double>::max();
@@ -152,9 +157,28 @@ CollisionChecker::checkObstacleHistory(
   return boost::none;
 }
 
+std::vector<PredictedObjectPolygon> CollisionChecker::createObjectPolygons(
+  const PredictedObjects & dynamic_objects)
+{
+  std::vector<PredictedObjectPolygon> object_polygons;
+  object_polygons.reserve(dynamic_objects.objects.size());
+  for (size_t i = 0; i < dynamic_objects.objects.size(); ++i) {
+    auto polygon = utils::convertObjToPolygon(dynamic_objects.objects.at(i));
+    if (polygon.outer().empty()) {
+      // unsupported type
+      continue;
+    }
+    Box2d box;
+    bg::envelope(polygon, box);
+    object_polygons.push_back({i, std::move(polygon), box});
+  }
+  return object_polygons;
+}
+
 boost::optional<std::pair<geometry_msgs::msg::Point, PredictedObject>>
 CollisionChecker::checkDynamicObjects(
   const Pose & base_pose, PredictedObjects::ConstSharedPtr dynamic_objects,
+  const std::vector<PredictedObjectPolygon> & object_polygons,
   const Polygon2d & one_step_move_vehicle_polygon2d, const double z_min, const double z_max)
 {
   if (dynamic_objects->objects.empty()) {
@@ -165,18 +189,23 @@ CollisionChecker::checkDynamicObjects(
   size_t nearest_collision_object_index = 0;
   geometry_msgs::msg::Point nearest_collision_point;
 
-  for (size_t i = 0; i < dynamic_objects->objects.size(); ++i) {
+  Box2d vehicle_box;
+  bg::envelope(one_step_move_vehicle_polygon2d, vehicle_box);
+
+  for (const auto & object_polygon_with_box : object_polygons) {
+    // broad phase with the bounding boxes
+    if (bg::disjoint(vehicle_box, object_polygon_with_box.box)) {
+      continue;
+    }
+
+    const auto i = object_polygon_with_box.object_index;
     const auto & obj = dynamic_objects->objects.at(i);
     if (param_.enable_z_axis_obstacle_filtering) {
       if (!utils::intersectsInZAxis(obj, z_min, z_max)) {
         continue;
       }
     }
-    const auto object_polygon = utils::convertObjToPolygon(obj);
-    if (object_polygon.outer().empty()) {
-      // unsupported type
-      continue;
-    }
+    const auto & object_polygon = object_polygon_with_box.polygon;
 
     const auto found_collision_points =
       bg::intersects(one_step_move_vehicle_polygon2d, object_polygon);
@@ -0,0 +1,110 @@
+// Copyright 2023 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAJECTORY_FOLLOWER_NODE__WORKER_THREAD_HPP_
+#define TRAJECTORY_FOLLOWER_NODE__WORKER_THREAD_HPP_
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace autoware::motion::control::trajectory_follower_node
+{
+/**
+ * @brief persistent thread running one task at a time for the caller
+ * @details The thread is created once, so that running a task does not create a thread.
+ */
+class WorkerThread
+{
+public:
+  WorkerThread() : thread_([this]() { loop(); }) {}
+  WorkerThread(const WorkerThread &) = delete;
+  WorkerThread & operator=(const WorkerThread &) = delete;
+
+  ~WorkerThread()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    task_cv_.notify_one();
+    thread_.join();
+  }
+
+  /**
+   * @brief start the task in the thread. wait() must be called before the next start().
+   */
+  void start(std::function<void()> task)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      task_ = std::move(task);
+      is_running_ = true;
+    }
+    task_cv_.notify_one();
+  }
+
+  /**
+   * @brief wait until the task started by start() is done
+   * @details The exception thrown by the task is rethrown.
+   */
+  void wait()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this]() { return !is_running_; });
+    if (exception_ptr_) {
+      std::rethrow_exception(std::exchange(exception_ptr_, nullptr));
+    }
+  }
+
+private:
+  void loop()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      task_cv_.wait(lock, [this]() { return stop_ || task_; });
+      if (stop_) {
+        return;
+      }
+      const auto task = std::exchange(task_, nullptr);
+      lock.unlock();
+      std::exception_ptr exception_ptr;
+      try {
+        task();
+      } catch (...) {
+        exception_ptr = std::current_exception();
+      }
+      lock.lock();
+      exception_ptr_ = exception_ptr;
+      is_running_ = false;
+      done_cv_.notify_one();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable task_cv_;
+  std::condition_variable done_cv_;
+  std::function<void()> task_;
+  std::exception_ptr exception_ptr_;
+  bool is_running_{false};
+  bool stop_{false};
+  // NOTE: the thread is declared last to start after the other members are initialized
+  std::thread thread_;
+};
+}  // namespace autoware::motion::control::trajectory_follower_node
+
+#endif  // TRAJECTORY_FOLLOWER_NODE__WORKER_THREAD_HPP_
@@ -34,6 +34,9 @@ Controller::Controller(const rclcpp::NodeOptions & node_options) : Node("control
 
   const double ctrl_period = declare_parameter<double>("ctrl_period");
   timeout_thr_sec_ = declare_parameter<double>("timeout_thr_sec");
+  if (declare_parameter<bool>("enable_parallel_controllers")) {
+    lateral_worker_ = std::make_unique<WorkerThread>();
+  }
 
   const auto lateral_controller_mode =
     getLateralControllerMode(declare_parameter<std::string>("lateral_controller_mode"));
@@ -73,10 +76,18 @@ Controller::Controller(const rclcpp::NodeOptions & node_options) : Node("control
   sub_operation_mode_ = create_subscription<OperationModeState>(
     "~/input/current_operation_mode", rclcpp::QoS{1},
     [this](const OperationModeState::SharedPtr msg) { current_operation_mode_ptr_ = msg; });
+  // NOTE: The intra-process communication supports only volatile topics, so the command is not
+  //       latched when the node is composed with the intra-process communication enabled.
+  rclcpp::QoS control_cmd_qos{1};
+  if (!get_node_options().use_intra_process_comms()) {
+    control_cmd_qos.transient_local();
+  }
   control_cmd_pub_ = create_publisher<autoware_auto_control_msgs::msg::AckermannControlCommand>(
-    "~/output/control_cmd", rclcpp::QoS{1}.transient_local());
+    "~/output/control_cmd", control_cmd_qos);
   debug_marker_pub_ =
     create_publisher<visualization_msgs::msg::MarkerArray>("~/output/debug_marker", rclcpp::QoS{1});
+  latency_hop_publisher_ = std::make_unique<latency_aggregator::LatencyHopPublisher>(
+    this, control_cmd_pub_->get_topic_name());
 
   // Timer
   {
@@ -193,6 +204,11 @@ void Controller::callbackTimerControl()
       get_logger(), *get_clock(), 5000, "Control is skipped since input data is not ready.");
     return;
   }
+  const std::vector<latency_aggregator::LatencyHopInput> hop_inputs{
+    latency_hop_publisher_->createInput(
+      sub_ref_path_->get_topic_name(), current_trajectory_ptr_->header.stamp),
+    latency_hop_publisher_->createInput(
+      sub_odometry_->get_topic_name(), current_odometry_ptr_->header.stamp)};
 
   // 2. check if controllers are ready
   const bool is_lat_ready = lateral_controller_->isReady(*input_data);
@@ -205,8 +221,7 @@ void Controller::callbackTimerControl()
   }
 
   // 3. run controllers
-  const auto lat_out = lateral_controller_->run(*input_data);
-  const auto lon_out = longitudinal_controller_->run(*input_data);
+  const auto [lat_out, lon_out] = runControllers(*input_data);
 
   // 4. sync with each other controllers
   longitudinal_controller_->sync(lat_out.sync_data);
@@ -216,16 +231,43 @@ void Controller::callbackTimerControl()
   if (isTimeOut(lon_out, lat_out)) return;
 
   // 5. publish control command
-  autoware_auto_control_msgs::msg::AckermannControlCommand out;
-  out.stamp = this->now();
-  out.lateral = lat_out.control_cmd;
-  out.longitudinal = lon_out.control_cmd;
-  control_cmd_pub_->publish(out);
+  auto out = std::make_unique<autoware_auto_control_msgs::msg::AckermannControlCommand>();
+  out->stamp = this->now();
+  out->lateral = lat_out.control_cmd;
+  out->longitudinal = lon_out.control_cmd;
+  const auto out_stamp = out->stamp;
+  control_cmd_pub_->publish(std::move(out));
+  latency_hop_publisher_->publish(hop_inputs, out_stamp);
 
   // 6. publish debug marker
   publishDebugMarker(*input_data, lat_out);
 }
 
+std::pair<LateralOutput, LongitudinalOutput> Controller::runControllers(
+  const trajectory_follower::InputData & input_data)
+{
+  if (!lateral_worker_) {
+    const auto lat_out = lateral_controller_->run(input_data);
+    const auto lon_out = longitudinal_controller_->run(input_data);
+    return {lat_out, lon_out};
+  }
+
+  // NOTE: The controllers are independent while running, since each of them uses the sync data of
+  // the other one given in the previous cycle. The result is the same as the sequential run.
+  LateralOutput lat_out;
+  LongitudinalOutput lon_out;
+  lateral_worker_->start([&]() { lat_out = lateral_controller_->run(input_data); });
+  try {
+    lon_out = longitudinal_controller_->run(input_data);
+  } catch (...) {
+    // the lateral controller must not run after returning
+    lateral_worker_->wait();
+    throw;
+  }
+  lateral_worker_->wait();
+  return {lat_out, lon_out};
+}
+
 void Controller::publishDebugMarker(
   const trajectory_follower::InputData & input_data,
   const trajectory_follower::LateralOutput & lat_out) const
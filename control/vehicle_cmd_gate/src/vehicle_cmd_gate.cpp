@@ -54,29 +54,39 @@ VehicleCmdGate::VehicleCmdGate(const rclcpp::NodeOptions & node_options)
 
   rclcpp::QoS durable_qos{1};
   durable_qos.transient_local();
+  // NOTE: The intra-process communication supports only volatile topics.
+  rclcpp::PublisherOptions durable_pub_options;
+  durable_pub_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
 
   // Stop Checker
   vehicle_stop_checker_ = std::make_unique<VehicleStopChecker>(this);
 
   // Publisher
-  vehicle_cmd_emergency_pub_ =
-    create_publisher<VehicleEmergencyStamped>("output/vehicle_cmd_emergency", durable_qos);
-  control_cmd_pub_ = create_publisher<AckermannControlCommand>("output/control_cmd", durable_qos);
-  gear_cmd_pub_ = create_publisher<GearCommand>("output/gear_cmd", durable_qos);
-  turn_indicator_cmd_pub_ =
-    create_publisher<TurnIndicatorsCommand>("output/turn_indicators_cmd", durable_qos);
-  hazard_light_cmd_pub_ =
-    create_publisher<HazardLightsCommand>("output/hazard_lights_cmd", durable_qos);
-
-  gate_mode_pub_ = create_publisher<GateMode>("output/gate_mode", durable_qos);
-  engage_pub_ = create_publisher<EngageMsg>("output/engage", durable_qos);
-  pub_external_emergency_ = create_publisher<Emergency>("output/external_emergency", durable_qos);
-  operation_mode_pub_ = create_publisher<OperationModeState>("output/operation_mode", durable_qos);
+  vehicle_cmd_emergency_pub_ = create_publisher<VehicleEmergencyStamped>(
+    "output/vehicle_cmd_emergency", durable_qos, durable_pub_options);
+  control_cmd_pub_ = create_publisher<AckermannControlCommand>(
+    "output/control_cmd", durable_qos, durable_pub_options);
+  latency_hop_publisher_ = std::make_unique<latency_aggregator::LatencyHopPublisher>(
+    this, control_cmd_pub_->get_topic_name());
+  gear_cmd_pub_ =
+    create_publisher<GearCommand>("output/gear_cmd", durable_qos, durable_pub_options);
+  turn_indicator_cmd_pub_ = create_publisher<TurnIndicatorsCommand>(
+    "output/turn_indicators_cmd", durable_qos, durable_pub_options);
+  hazard_light_cmd_pub_ = create_publisher<HazardLightsCommand>(
+    "output/hazard_lights_cmd", durable_qos, durable_pub_options);
+
+  gate_mode_pub_ =
+    create_publisher<GateMode>("output/gate_mode", durable_qos, durable_pub_options);
+  engage_pub_ = create_publisher<EngageMsg>("output/engage", durable_qos, durable_pub_options);
+  pub_external_emergency_ = create_publisher<Emergency>(
+    "output/external_emergency", durable_qos, durable_pub_options);
+  operation_mode_pub_ = create_publisher<OperationModeState>(
+    "output/operation_mode", durable_qos, durable_pub_options);
 
   is_filter_activated_pub_ =
-    create_publisher<IsFilterActivated>("~/is_filter_activated", durable_qos);
+    create_publisher<IsFilterActivated>("~/is_filter_activated", durable_qos, durable_pub_options);
   filter_activated_marker_pub_ =
-    create_publisher<MarkerArray>("~/is_filter_activated/marker", durable_qos);
+    create_publisher<MarkerArray>("~/is_filter_activated/marker", durable_qos, durable_pub_options);
 
   // Subscriber
   external_emergency_stop_heartbeat_sub_ = create_subscription<Heartbeat>(
@@ -96,9 +106,12 @@ VehicleCmdGate::VehicleCmdGate(const rclcpp::NodeOptions & node_options)
   steer_sub_ = create_subscription<SteeringReport>(
     "input/steering", 1,
     [this](SteeringReport::SharedPtr msg) { current_steer_ = msg->steering_tire_angle; });
+  rclcpp::SubscriptionOptions durable_sub_options;
+  durable_sub_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
   operation_mode_sub_ = create_subscription<OperationModeState>(
     "input/operation_mode", rclcpp::QoS(1).transient_local(),
-    [this](const OperationModeState::SharedPtr msg) { current_operation_mode_ = *msg; });
+    [this](const OperationModeState::SharedPtr msg) { current_operation_mode_ = *msg; },
+    durable_sub_options);
   mrm_state_sub_ = create_subscription<MrmState>(
     "input/mrm_state", 1, std::bind(&VehicleCmdGate::onMrmState, this, _1));
 
@@ -160,6 +173,7 @@ VehicleCmdGate::VehicleCmdGate(const rclcpp::NodeOptions & node_options)
     declare_parameter<double>("moderate_stop_service_acceleration");
   stop_check_duration_ = declare_parameter<double>("stop_check_duration");
   enable_cmd_limit_filter_ = declare_parameter<bool>("enable_cmd_limit_filter");
+  enable_realtime_mode_ = declare_parameter<bool>("enable_realtime_mode");
 
   // Vehicle Parameter
   const auto vehicle_info = vehicle_info_util::VehicleInfoUtil(*this).getVehicleInfo();
@@ -233,6 +247,14 @@ VehicleCmdGate::VehicleCmdGate(const rclcpp::NodeOptions & node_options)
     rclcpp::create_timer(this, get_clock(), period_ns, std::bind(&VehicleCmdGate::onTimer, this));
   timer_pub_status_ = rclcpp::create_timer(
     this, get_clock(), period_ns, std::bind(&VehicleCmdGate::publishStatus, this));
+  if (enable_realtime_mode_) {
+    // The debug topics are published out of the control command path. The callbacks owning the
+    // state stay in the default callback group, so that they are not run concurrently.
+    debug_callback_group_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+    timer_pub_debug_ = rclcpp::create_timer(
+      this, get_clock(), period_ns, std::bind(&VehicleCmdGate::onDebugTimer, this),
+      debug_callback_group_);
+  }
 
   logger_configure_ = std::make_unique<tier4_autoware_utils::LoggerLevelConfigure>(this);
 }
@@ -279,7 +301,9 @@ void VehicleCmdGate::onAutoCtrlCmd(AckermannControlCommand::ConstSharedPtr msg)
   auto_commands_.control = *msg;
 
   if (current_gate_mode_.data == GateMode::AUTO) {
-    publishControlCommands(auto_commands_);
+    publishControlCommands(
+      auto_commands_,
+      latency_hop_publisher_->createInput(auto_control_cmd_sub_->get_topic_name(), msg->stamp));
   }
 }
 
@@ -289,7 +313,9 @@ void VehicleCmdGate::onRemoteCtrlCmd(AckermannControlCommand::ConstSharedPtr msg
   remote_commands_.control = *msg;
 
   if (current_gate_mode_.data == GateMode::EXTERNAL) {
-    publishControlCommands(remote_commands_);
+    publishControlCommands(
+      remote_commands_,
+      latency_hop_publisher_->createInput(remote_control_cmd_sub_->get_topic_name(), msg->stamp));
   }
 }
 
@@ -299,13 +325,18 @@ void VehicleCmdGate::onEmergencyCtrlCmd(AckermannControlCommand::ConstSharedPtr
   emergency_commands_.control = *msg;
 
   if (use_emergency_handling_ && is_system_emergency_) {
-    publishControlCommands(emergency_commands_);
+    publishControlCommands(
+      emergency_commands_, latency_hop_publisher_->createInput(
+                             emergency_control_cmd_sub_->get_topic_name(), msg->stamp));
   }
 }
 
 void VehicleCmdGate::onTimer()
 {
-  updater_.force_update();
+  // In the realtime mode, the diagnostics are published only at the period of the updater.
+  if (!enable_realtime_mode_) {
+    updater_.force_update();
+  }
 
   if (!isDataReady()) {
     RCLCPP_INFO_THROTTLE(get_logger(), *get_clock(), 5000, "waiting topics...");
@@ -383,7 +414,8 @@ void VehicleCmdGate::onTimer()
   gear_cmd_pub_->publish(gear);
 }
 
-void VehicleCmdGate::publishControlCommands(const Commands & commands)
+void VehicleCmdGate::publishControlCommands(
+  const Commands & commands, const latency_aggregator::LatencyHopInput & hop_input)
 {
   // Check system emergency
   if (use_emergency_handling_ && is_emergency_state_heartbeat_timeout_) {
@@ -445,6 +477,7 @@ void VehicleCmdGate::publishControlCommands(const Commands & commands)
   // Publish commands
   vehicle_cmd_emergency_pub_->publish(vehicle_cmd_emergency);
   control_cmd_pub_->publish(filtered_commands.control);
+  latency_hop_publisher_->publish(hop_input, filtered_commands.control.stamp);
   adapi_pause_->publish();
   moderate_stop_interface_->publish();
 
@@ -571,12 +604,37 @@ AckermannControlCommand VehicleCmdGate::filterControlCommand(const AckermannCont
   filter_on_transition_.setPrevCmd(prev_values);
 
   is_filter_activated.stamp = now();
-  is_filter_activated_pub_->publish(is_filter_activated);
-  filter_activated_marker_pub_->publish(createMarkerArray(is_filter_activated));
+  if (enable_realtime_mode_) {
+    std::lock_guard<std::mutex> lock(filter_activated_mutex_);
+    filter_activated_buffer_ = is_filter_activated;
+    has_new_filter_activated_ = true;
+  } else {
+    publishFilterActivated(is_filter_activated);
+  }
 
   return out;
 }
 
+void VehicleCmdGate::onDebugTimer()
+{
+  IsFilterActivated is_filter_activated;
+  {
+    std::lock_guard<std::mutex> lock(filter_activated_mutex_);
+    if (!has_new_filter_activated_) {
+      return;
+    }
+    is_filter_activated = filter_activated_buffer_;
+    has_new_filter_activated_ = false;
+  }
+  publishFilterActivated(is_filter_activated);
+}
+
+void VehicleCmdGate::publishFilterActivated(const IsFilterActivated & filter_activated)
+{
+  is_filter_activated_pub_->publish(filter_activated);
+  filter_activated_marker_pub_->publish(createMarkerArray(filter_activated));
+}
+
 AckermannControlCommand VehicleCmdGate::createStopControlCmd() const
 {
   AckermannControlCommand cmd;
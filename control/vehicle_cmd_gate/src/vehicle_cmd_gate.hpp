@@ -21,6 +21,7 @@
 #include "vehicle_cmd_filter.hpp"
 
 #include <diagnostic_updater/diagnostic_updater.hpp>
+#include <latency_aggregator/latency_hop_publisher.hpp>
 #include <motion_utils/vehicle/vehicle_state_checker.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <vehicle_cmd_gate/msg/is_filter_activated.hpp>
@@ -48,6 +49,7 @@
 #include <visualization_msgs/msg/marker_array.hpp>
 
 #include <memory>
+#include <mutex>
 
 namespace vehicle_cmd_gate
 {
@@ -98,6 +100,7 @@ private:
   // Publisher
   rclcpp::Publisher<VehicleEmergencyStamped>::SharedPtr vehicle_cmd_emergency_pub_;
   rclcpp::Publisher<AckermannControlCommand>::SharedPtr control_cmd_pub_;
+  std::unique_ptr<latency_aggregator::LatencyHopPublisher> latency_hop_publisher_;
   rclcpp::Publisher<GearCommand>::SharedPtr gear_cmd_pub_;
   rclcpp::Publisher<TurnIndicatorsCommand>::SharedPtr turn_indicator_cmd_pub_;
   rclcpp::Publisher<HazardLightsCommand>::SharedPtr hazard_light_cmd_pub_;
@@ -172,6 +175,7 @@ private:
   double emergency_acceleration_;
   double moderate_stop_service_acceleration_;
   bool enable_cmd_limit_filter_;
+  bool enable_realtime_mode_;
 
   // Service
   rclcpp::Service<EngageSrv>::SharedPtr srv_engage_;
@@ -199,9 +203,11 @@ private:
   // Timer / Event
   rclcpp::TimerBase::SharedPtr timer_;
   rclcpp::TimerBase::SharedPtr timer_pub_status_;
+  rclcpp::TimerBase::SharedPtr timer_pub_debug_;
 
   void onTimer();
-  void publishControlCommands(const Commands & input_msg);
+  void publishControlCommands(
+    const Commands & input_msg, const latency_aggregator::LatencyHopInput & hop_input);
   void publishEmergencyStopControlCommands();
   void publishStatus();
 
@@ -236,6 +242,15 @@ private:
 
   // debug
   MarkerArray createMarkerArray(const IsFilterActivated & filter_activated);
+  void publishFilterActivated(const IsFilterActivated & filter_activated);
+  void onDebugTimer();
+
+  // NOTE: In the realtime mode, the debug topics are published from the low-priority callback
+  // group, and the filter result is passed through the buffer guarded by the mutex.
+  rclcpp::CallbackGroup::SharedPtr debug_callback_group_;
+  std::mutex filter_activated_mutex_;
+  IsFilterActivated filter_activated_buffer_;
+  bool has_new_filter_activated_{false};
 
   std::unique_ptr<tier4_autoware_utils::LoggerLevelConfigure> logger_configure_;
 };
@@ -12,8 +12,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <iostream>
 #include <limits>
+#include <vector>
 
 #ifndef KINEMATIC_EVALUATOR__STAT_HPP_
 #define KINEMATIC_EVALUATOR__STAT_HPP_
@@ -42,6 +46,7 @@ public:
     }
     ++count_;
     mean_ = mean_ + (value - mean_) / count_;
+    last_ = value;
   }
 
   /**
@@ -64,6 +69,11 @@ public:
    */
   unsigned int count() const { return count_; }
 
+  /**
+   * @brief get the last added value
+   */
+  T last() const { return last_; }
+
   template <typename U>
   friend std::ostream & operator<<(std::ostream & os, const Stat<U> & stat);
 
@@ -72,6 +82,93 @@ private:
   T max_ = std::numeric_limits<T>::min();
   long double mean_ = 0.0;
   unsigned int count_ = 0;
+  T last_{};
+};
+
+/**
+ * @brief class to build statistics of the latest values in a fixed size window
+ * @details the values are kept in a ring buffer allocated on construction, so that the memory does
+ * not grow with the number of added values. The statistics are computed from the buffer when they
+ * are requested, which is expected to be less frequent than adding values.
+ * @typedef T type of the values (default to double)
+ */
+template <typename T = double>
+class WindowedStat
+{
+public:
+  /**
+   * @brief constructor
+   * @param window_size maximum number of values, the statistics are disabled if it is 0
+   */
+  explicit WindowedStat(const size_t window_size = 0) : values_(window_size) {}
+
+  /**
+   * @brief add a value, which overwrites the oldest one if the window is full
+   * @param value value to add
+   */
+  void add(const T & value)
+  {
+    if (values_.empty()) {
+      return;
+    }
+    values_[next_] = value;
+    next_ = (next_ + 1) % values_.size();
+    size_ = std::min(size_ + 1, values_.size());
+  }
+
+  /**
+   * @brief get the number of values in the window
+   */
+  size_t count() const { return size_; }
+
+  /**
+   * @brief get the mean value in the window
+   */
+  long double mean() const
+  {
+    long double sum = 0.0;
+    for (size_t i = 0; i < size_; ++i) {
+      sum += values_[i];
+    }
+    return size_ == 0 ? 0.0 : sum / size_;
+  }
+
+  /**
+   * @brief get the standard deviation in the window
+   */
+  long double stddev() const
+  {
+    if (size_ == 0) {
+      return 0.0;
+    }
+    const long double m = mean();
+    long double sum = 0.0;
+    for (size_t i = 0; i < size_; ++i) {
+      sum += (values_[i] - m) * (values_[i] - m);
+    }
+    return std::sqrt(sum / size_);
+  }
+
+  /**
+   * @brief get the quantile in the window with the nearest rank method
+   * @param q quantile in [0, 1]
+   */
+  T quantile(const double q) const
+  {
+    if (size_ == 0) {
+      return T{};
+    }
+    std::vector<T> values(values_.begin(), values_.begin() + size_);
+    const auto rank = static_cast<size_t>(std::ceil(std::min(std::max(q, 0.0), 1.0) * size_));
+    const auto nth = values.begin() + (rank == 0 ? 0 : rank - 1);
+    std::nth_element(values.begin(), nth, values.end());
+    return *nth;
+  }
+
+private:
+  std::vector<T> values_;
+  size_t next_ = 0;
+  size_t size_ = 0;
 };
 
 /**
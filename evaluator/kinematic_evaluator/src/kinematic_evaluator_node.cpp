@@ -16,6 +16,7 @@
 
 #include "boost/lexical_cast.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -43,12 +44,22 @@ KinematicEvaluatorNode::KinematicEvaluatorNode(const rclcpp::NodeOptions & node_
   }
   // List of metrics to calculate
   metrics_pub_ = create_publisher<DiagnosticArray>("~/metrics", 1);
+  const auto window_size = std::max(declare_parameter<int>("window_size", 0), 0);
   for (const std::string & selected_metric :
        declare_parameter<std::vector<std::string>>("selected_metrics")) {
     Metric metric = str_to_metric.at(selected_metric);
     metrics_dict_[metric] = Stat<double>();
+    windowed_stats_[metric] = WindowedStat<double>(static_cast<size_t>(window_size));
     metrics_.push_back(metric);
   }
+
+  // the metrics are published periodically instead of on every message if the period is given
+  const auto publish_period = declare_parameter<double>("publish_period", 0.0);
+  if (publish_period > 0.0) {
+    timer_ = rclcpp::create_timer(
+      this, get_clock(), rclcpp::Rate(1.0 / publish_period).period(),
+      [this]() { publishMetrics(now()); });
+  }
 }
 
 KinematicEvaluatorNode::~KinematicEvaluatorNode()
@@ -57,7 +68,7 @@ KinematicEvaluatorNode::~KinematicEvaluatorNode()
     std::ofstream f(output_file_str_);
     f << std::left << std::fixed;
     // header
-    f << "#Data collected over: " << stamps_.back().seconds() - stamps_[0].seconds() << " seconds."
+    f << "#Data collected over: " << last_stamp_.seconds() - first_stamp_.seconds() << " seconds."
       << std::endl;
     f << std::setw(24) << "#Stamp [ns]";
 
@@ -72,9 +83,9 @@ KinematicEvaluatorNode::~KinematicEvaluatorNode()
     }
     f << std::endl;
     // data
-    f << std::setw(24) << stamps_.back().nanoseconds();
+    f << std::setw(24) << last_stamp_.nanoseconds();
     for (Metric metric : metrics_) {
-      const auto & stat = metric_stats_[static_cast<size_t>(metric)].back();
+      const auto & stat = metrics_dict_.at(metric);
       f << stat;
       f << std::setw(4) << "";
     }
@@ -98,20 +109,33 @@ DiagnosticStatus KinematicEvaluatorNode::generateDiagnosticStatus(
   key_value.key = "mean";
   key_value.value = boost::lexical_cast<decltype(key_value.value)>(metric_stat.mean());
   status.values.push_back(key_value);
+
+  const auto & windowed_stat = windowed_stats_.at(metric);
+  if (windowed_stat.count() > 0) {
+    key_value.key = "window_mean";
+    key_value.value = boost::lexical_cast<decltype(key_value.value)>(windowed_stat.mean());
+    status.values.push_back(key_value);
+    key_value.key = "window_stddev";
+    key_value.value = boost::lexical_cast<decltype(key_value.value)>(windowed_stat.stddev());
+    status.values.push_back(key_value);
+    key_value.key = "window_p50";
+    key_value.value = boost::lexical_cast<decltype(key_value.value)>(windowed_stat.quantile(0.5));
+    status.values.push_back(key_value);
+    key_value.key = "window_p95";
+    key_value.value = boost::lexical_cast<decltype(key_value.value)>(windowed_stat.quantile(0.95));
+    status.values.push_back(key_value);
+  }
   return status;
 }
 
-void KinematicEvaluatorNode::onOdom(const nav_msgs::msg::Odometry::SharedPtr msg)
+void KinematicEvaluatorNode::publishMetrics(const rclcpp::Time & stamp)
 {
   DiagnosticArray metrics_msg;
-  metrics_msg.header.stamp = now();
-
+  metrics_msg.header.stamp = stamp;
   for (Metric metric : metrics_) {
-    metrics_dict_[metric] = metrics_calculator_.updateStat(metric, *msg, metrics_dict_[metric]);
-    metric_stats_[static_cast<size_t>(metric)].push_back(metrics_dict_[metric]);
-    stamps_.push_back(metrics_msg.header.stamp);
-    if (metrics_dict_[metric].count() > 0) {
-      metrics_msg.status.push_back(generateDiagnosticStatus(metric, metrics_dict_[metric]));
+    const auto & stat = metrics_dict_.at(metric);
+    if (stat.count() > 0) {
+      metrics_msg.status.push_back(generateDiagnosticStatus(metric, stat));
     }
   }
   if (!metrics_msg.status.empty()) {
@@ -119,6 +143,29 @@ void KinematicEvaluatorNode::onOdom(const nav_msgs::msg::Odometry::SharedPtr msg
   }
 }
 
+void KinematicEvaluatorNode::onOdom(const nav_msgs::msg::Odometry::SharedPtr msg)
+{
+  const auto stamp = now();
+  if (!has_stamp_) {
+    first_stamp_ = stamp;
+    has_stamp_ = true;
+  }
+  last_stamp_ = stamp;
+
+  for (Metric metric : metrics_) {
+    auto & stat = metrics_dict_[metric];
+    const auto prev_count = stat.count();
+    stat = metrics_calculator_.updateStat(metric, *msg, stat);
+    if (stat.count() > prev_count) {
+      windowed_stats_[metric].add(stat.last());
+    }
+  }
+
+  if (!timer_) {
+    publishMetrics(stamp);
+  }
+}
+
 geometry_msgs::msg::Pose KinematicEvaluatorNode::getCurrentEgoPose() const
 {
   geometry_msgs::msg::TransformStamped tf_current_pose;
@@ -26,6 +26,7 @@
 
 #include "boost/lexical_cast.hpp"
 
+#include <cmath>
 #include <memory>
 #include <string>
 #include <utility>
@@ -139,3 +140,22 @@ TEST_F(EvalTest, TestVelocityStats)
   Odometry odom3 = makeOdometry(2.0);
   EXPECT_DOUBLE_EQ(publishOdometryAndGetMetric(odom3), 1.0);
 }
+
+TEST(WindowedStat, KeepsLatestValues)
+{
+  kinematic_diagnostics::WindowedStat<double> disabled_stat;
+  disabled_stat.add(1.0);
+  EXPECT_EQ(disabled_stat.count(), 0u);
+
+  kinematic_diagnostics::WindowedStat<double> stat(4);
+  for (const double value : {10.0, 1.0, 2.0, 3.0, 4.0}) {
+    stat.add(value);
+  }
+  // the first value is overwritten
+  EXPECT_EQ(stat.count(), 4u);
+  EXPECT_DOUBLE_EQ(static_cast<double>(stat.mean()), 2.5);
+  EXPECT_DOUBLE_EQ(static_cast<double>(stat.stddev()), std::sqrt(1.25));
+  EXPECT_DOUBLE_EQ(stat.quantile(0.0), 1.0);
+  EXPECT_DOUBLE_EQ(stat.quantile(0.5), 2.0);
+  EXPECT_DOUBLE_EQ(stat.quantile(0.95), 4.0);
+}
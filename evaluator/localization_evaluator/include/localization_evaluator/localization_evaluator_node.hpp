@@ -30,7 +30,6 @@
 #include <message_filters/sync_policies/approximate_time.h>
 #include <message_filters/synchronizer.h>
 
-#include <deque>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -72,6 +71,12 @@ public:
   DiagnosticStatus generateDiagnosticStatus(
     const Metric & metric, const Stat<double> & metric_stat) const;
 
+  /**
+   * @brief publish the statistics of all metrics
+   * @param [in] stamp time stamp of the message
+   */
+  void publishMetrics(const rclcpp::Time & stamp);
+
 private:
   // ROS
   message_filters::Subscriber<Odometry> odom_sub_;
@@ -82,6 +87,7 @@ private:
   typedef message_filters::Synchronizer<SyncPolicy> SyncExact;
   SyncExact sync_;
   rclcpp::Publisher<DiagnosticArray>::SharedPtr metrics_pub_;
+  rclcpp::TimerBase::SharedPtr timer_;
   std::unique_ptr<tf2_ros::Buffer> tf_buffer_ptr_;
   std::unique_ptr<tf2_ros::TransformListener> tf_listener_ptr_;
 
@@ -92,9 +98,12 @@ private:
   MetricsCalculator metrics_calculator_;
   // Metrics
   std::vector<Metric> metrics_;
-  std::deque<rclcpp::Time> stamps_;
-  std::array<std::deque<Stat<double>>, static_cast<size_t>(Metric::SIZE)> metric_stats_;
+  rclcpp::Time first_stamp_;
+  rclcpp::Time last_stamp_;
+  bool has_stamp_ = false;
   std::unordered_map<Metric, Stat<double>> metrics_dict_;
+  // statistics of the latest values, which are published with the ones of all values
+  std::unordered_map<Metric, WindowedStat<double>> windowed_stats_;
 };
 }  // namespace localization_diagnostics
 
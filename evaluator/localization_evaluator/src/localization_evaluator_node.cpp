@@ -16,6 +16,7 @@
 
 #include "boost/lexical_cast.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -46,12 +47,22 @@ LocalizationEvaluatorNode::LocalizationEvaluatorNode(const rclcpp::NodeOptions &
   }
   // List of metrics to calculate
   metrics_pub_ = create_publisher<DiagnosticArray>("~/metrics", 1);
+  const auto window_size = std::max(declare_parameter<int>("window_size", 0), 0);
   for (const std::string & selected_metric :
        declare_parameter<std::vector<std::string>>("selected_metrics")) {
     Metric metric = str_to_metric.at(selected_metric);
     metrics_dict_[metric] = Stat<double>();
+    windowed_stats_[metric] = WindowedStat<double>(static_cast<size_t>(window_size));
     metrics_.push_back(metric);
   }
+
+  // the metrics are published periodically instead of on every message if the period is given
+  const auto publish_period = declare_parameter<double>("publish_period", 0.0);
+  if (publish_period > 0.0) {
+    timer_ = rclcpp::create_timer(
+      this, get_clock(), rclcpp::Rate(1.0 / publish_period).period(),
+      [this]() { publishMetrics(now()); });
+  }
 }
 
 LocalizationEvaluatorNode::~LocalizationEvaluatorNode()
@@ -60,7 +71,7 @@ LocalizationEvaluatorNode::~LocalizationEvaluatorNode()
     std::ofstream f(output_file_str_);
     f << std::left << std::fixed;
     // header
-    f << "#Data collected over: " << stamps_.back().seconds() - stamps_[0].seconds() << " seconds."
+    f << "#Data collected over: " << last_stamp_.seconds() - first_stamp_.seconds() << " seconds."
       << std::endl;
     f << std::setw(24) << "#Stamp [ns]";
     for (Metric metric : metrics_) {
@@ -75,9 +86,9 @@ LocalizationEvaluatorNode::~LocalizationEvaluatorNode()
     f << std::endl;
 
     // data
-    f << std::setw(24) << stamps_.back().nanoseconds();
+    f << std::setw(24) << last_stamp_.nanoseconds();
     for (Metric metric : metrics_) {
-      const auto & stat = metric_stats_[static_cast<size_t>(metric)].back();
+      const auto & stat = metrics_dict_.at(metric);
       f << stat;
       f << std::setw(4) << "";
     }
@@ -101,9 +112,40 @@ DiagnosticStatus LocalizationEvaluatorNode::generateDiagnosticStatus(
   key_value.key = "mean";
   key_value.value = boost::lexical_cast<decltype(key_value.value)>(metric_stat.mean());
   status.values.push_back(key_value);
+
+  const auto & windowed_stat = windowed_stats_.at(metric);
+  if (windowed_stat.count() > 0) {
+    key_value.key = "window_mean";
+    key_value.value = boost::lexical_cast<decltype(key_value.value)>(windowed_stat.mean());
+    status.values.push_back(key_value);
+    key_value.key = "window_stddev";
+    key_value.value = boost::lexical_cast<decltype(key_value.value)>(windowed_stat.stddev());
+    status.values.push_back(key_value);
+    key_value.key = "window_p50";
+    key_value.value = boost::lexical_cast<decltype(key_value.value)>(windowed_stat.quantile(0.5));
+    status.values.push_back(key_value);
+    key_value.key = "window_p95";
+    key_value.value = boost::lexical_cast<decltype(key_value.value)>(windowed_stat.quantile(0.95));
+    status.values.push_back(key_value);
+  }
   return status;
 }
 
+void LocalizationEvaluatorNode::publishMetrics(const rclcpp::Time & stamp)
+{
+  DiagnosticArray metrics_msg;
+  metrics_msg.header.stamp = stamp;
+  for (Metric metric : metrics_) {
+    const auto & stat = metrics_dict_.at(metric);
+    if (stat.count() > 0) {
+      metrics_msg.status.push_back(generateDiagnosticStatus(metric, stat));
+    }
+  }
+  if (!metrics_msg.status.empty()) {
+    metrics_pub_->publish(metrics_msg);
+  }
+}
+
 void LocalizationEvaluatorNode::syncCallback(
   const Odometry::ConstSharedPtr & msg, const PoseWithCovarianceStamped::ConstSharedPtr & msg_ref)
 {
@@ -111,9 +153,6 @@ void LocalizationEvaluatorNode::syncCallback(
     get_logger(), "Received two messages at time stamps: %d.%d and %d.%d", msg->header.stamp.sec,
     msg->header.stamp.nanosec, msg_ref->header.stamp.sec, msg_ref->header.stamp.nanosec);
 
-  DiagnosticArray metrics_msg;
-  metrics_msg.header.stamp = now();
-
   geometry_msgs::msg::Point p_lc, p_gt;
   p_lc = msg->pose.pose.position;
   p_gt = msg_ref->pose.pose.position;
@@ -121,17 +160,26 @@ void LocalizationEvaluatorNode::syncCallback(
     RCLCPP_INFO(get_logger(), "Received position equals zero, waiting for valid data.");
     return;
   }
+
+  const auto stamp = now();
+  if (!has_stamp_) {
+    first_stamp_ = stamp;
+    has_stamp_ = true;
+  }
+  last_stamp_ = stamp;
+
   for (Metric metric : metrics_) {
-    metrics_dict_[metric] = metrics_calculator_.updateStat(
-      metrics_dict_[metric], metric, msg->pose.pose.position, msg_ref->pose.pose.position);
-    metric_stats_[static_cast<size_t>(metric)].push_back(metrics_dict_[metric]);
-    stamps_.push_back(metrics_msg.header.stamp);
-    if (metrics_dict_[metric].count() > 0) {
-      metrics_msg.status.push_back(generateDiagnosticStatus(metric, metrics_dict_[metric]));
+    auto & stat = metrics_dict_[metric];
+    const auto prev_count = stat.count();
+    stat = metrics_calculator_.updateStat(
+      stat, metric, msg->pose.pose.position, msg_ref->pose.pose.position);
+    if (stat.count() > prev_count) {
+      windowed_stats_[metric].add(stat.last());
     }
   }
-  if (!metrics_msg.status.empty()) {
-    metrics_pub_->publish(metrics_msg);
+
+  if (!timer_) {
+    publishMetrics(stamp);
   }
 }
 }  // namespace localization_diagnostics
@@ -19,6 +19,7 @@
 
 #include "autoware_auto_planning_msgs/msg/trajectory.hpp"
 #include "autoware_auto_planning_msgs/msg/trajectory_point.hpp"
+#include "geometry_msgs/msg/point.hpp"
 
 namespace planning_diagnostics
 {
@@ -27,6 +28,7 @@ namespace metrics
 namespace utils
 {
 using autoware_auto_planning_msgs::msg::Trajectory;
+using geometry_msgs::msg::Point;
 
 /**
  * @brief find the index in the trajectory at the given distance of the given index
@@ -37,6 +39,30 @@ using autoware_auto_planning_msgs::msg::Trajectory;
  */
 size_t getIndexAfterDistance(const Trajectory & traj, const size_t curr_id, const double distance);
 
+/**
+ * @brief find the index of the trajectory point nearest to the given point by descending the
+ * distance from the given index
+ * @details When the given points progress along the trajectory, e.g. the points of another
+ * trajectory, passing the previous result as start_id aligns them in linear time in total.
+ * @param [in] traj input trajectory (must not be empty)
+ * @param [in] point point to search
+ * @param [in] start_id index to start the search
+ * @return index of the nearest point, which may be a local minimum if the trajectory comes back
+ * close to the point
+ */
+size_t findNearestIndexFrom(const Trajectory & traj, const Point & point, const size_t start_id);
+
+/**
+ * @brief find the index of the trajectory segment nearest to the given point by descending the
+ * distance from the given index, in the same way as motion_utils::findNearestSegmentIndex
+ * @param [in] traj input trajectory (must have at least 2 points)
+ * @param [in] point point to search
+ * @param [in] start_id index of the point to start the search
+ * @return index of the nearest segment
+ */
+size_t findNearestSegmentIndexFrom(
+  const Trajectory & traj, const Point & point, const size_t start_id);
+
 }  // namespace utils
 }  // namespace metrics
 }  // namespace planning_diagnostics
@@ -93,10 +93,17 @@ private:
   Trajectory getLookaheadTrajectory(
     const Trajectory & traj, const double max_dist_m, const double max_time_s) const;
 
+  /**
+   * @brief get the lookahead trajectory of the previous trajectory from the current ego pose
+   * @return lookahead trajectory, which is cached until the previous trajectory or the ego pose is
+   * set
+   */
+  const Trajectory & getPreviousLookaheadTrajectory() const;
+
   Trajectory reference_trajectory_;
   Trajectory reference_trajectory_lookahead_;
   Trajectory previous_trajectory_;
-  Trajectory previous_trajectory_lookahead_;
+  mutable std::optional<Trajectory> previous_trajectory_lookahead_;
   PredictedObjects dynamic_objects_;
   geometry_msgs::msg::Pose ego_pose_;
   PoseWithUuidStamped modified_goal_;
@@ -85,6 +85,8 @@ public:
 
   /**
    * @brief publish the given metric statistic
+   * @details The statistics of the metric over the last window of messages are appended after the
+   * minimum, maximum, and mean values of the metric_stat.
    */
   DiagnosticStatus generateDiagnosticStatus(
     const Metric & metric, const Stat<double> & metric_stat) const;
@@ -107,6 +109,7 @@ private:
   // Parameters
   std::string output_file_str_;
   std::string ego_frame_str_;
+  std::vector<double> window_quantiles_;
 
   // Calculator
   MetricsCalculator metrics_calculator_;
@@ -114,6 +117,8 @@ private:
   std::vector<Metric> metrics_;
   std::deque<rclcpp::Time> stamps_;
   std::array<std::deque<Stat<double>>, static_cast<size_t>(Metric::SIZE)> metric_stats_;
+  // mean of each metric over the last messages, indexed by the metric
+  std::vector<WindowStat<double>> metric_windows_;
 
   Odometry::ConstSharedPtr ego_state_ptr_;
   PoseWithUuidStamped::ConstSharedPtr modified_goal_ptr_;
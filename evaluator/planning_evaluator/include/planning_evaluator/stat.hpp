@@ -12,8 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <iostream>
 #include <limits>
+#include <vector>
 
 #ifndef PLANNING_EVALUATOR__STAT_HPP_
 #define PLANNING_EVALUATOR__STAT_HPP_
@@ -74,6 +76,80 @@ private:
   unsigned int count_ = 0;
 };
 
+/**
+ * @brief class to build statistics of the last values in a window of fixed size
+ * @details The memory is bounded by the window size whatever the number of added values.
+ * @typedef T type of the values (default to double)
+ */
+template <typename T = double>
+class WindowStat
+{
+public:
+  /**
+   * @brief constructor
+   * @param window_size maximum number of values used to build the statistics
+   */
+  explicit WindowStat(const size_t window_size) { values_.reserve(window_size); }
+
+  /**
+   * @brief add a value, which replaces the oldest value if the window is full
+   * @param value value to add
+   */
+  void add(const T & value)
+  {
+    if (values_.size() < values_.capacity()) {
+      values_.push_back(value);
+      return;
+    }
+    if (values_.empty()) {
+      return;
+    }
+    values_[next_] = value;
+    next_ = next_ + 1 == values_.size() ? 0 : next_ + 1;
+  }
+
+  /**
+   * @brief get the mean value in the window
+   */
+  long double mean() const
+  {
+    long double sum = 0.0;
+    for (const auto & value : values_) {
+      sum += value;
+    }
+    return values_.empty() ? 0.0 : sum / values_.size();
+  }
+
+  /**
+   * @brief get the quantiles in the window with the nearest rank method
+   * @param probabilities probabilities of the quantiles in [0, 1]
+   * @return quantiles, which are empty if no value is in the window
+   */
+  std::vector<T> quantiles(const std::vector<double> & probabilities) const
+  {
+    std::vector<T> quantiles;
+    if (values_.empty()) {
+      return quantiles;
+    }
+    std::vector<T> sorted = values_;
+    std::sort(sorted.begin(), sorted.end());
+    for (const auto p : probabilities) {
+      const auto rank = static_cast<size_t>(std::clamp(p, 0.0, 1.0) * (sorted.size() - 1) + 0.5);
+      quantiles.push_back(sorted[rank]);
+    }
+    return quantiles;
+  }
+
+  /**
+   * @brief get the number of values in the window
+   */
+  size_t count() const { return values_.size(); }
+
+private:
+  std::vector<T> values_;  // ring buffer of the values in the window
+  size_t next_ = 0;        // index of the oldest value when the window is full
+};
+
 /**
  * @brief overload << operator for easy print to output stream
  */
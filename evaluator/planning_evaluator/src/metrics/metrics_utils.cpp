@@ -12,8 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include "planning_evaluator/metrics/trajectory_metrics.hpp"
+#include "planning_evaluator/metrics/metrics_utils.hpp"
+
+#include "motion_utils/trajectory/trajectory.hpp"
 #include "tier4_autoware_utils/geometry/geometry.hpp"
+
+#include <algorithm>
+
 namespace planning_diagnostics
 {
 namespace metrics
@@ -42,6 +47,47 @@ size_t getIndexAfterDistance(const Trajectory & traj, const size_t curr_id, cons
   return target_id;
 }
 
+size_t findNearestIndexFrom(const Trajectory & traj, const Point & point, const size_t start_id)
+{
+  using tier4_autoware_utils::calcSquaredDistance2d;
+  size_t nearest_id = std::min(start_id, traj.points.size() - 1);
+  double min_dist = calcSquaredDistance2d(traj.points[nearest_id], point);
+  // descend forward first since the searched points usually progress along the trajectory
+  while (nearest_id + 1 < traj.points.size()) {
+    const double dist = calcSquaredDistance2d(traj.points[nearest_id + 1], point);
+    if (dist >= min_dist) {
+      break;
+    }
+    min_dist = dist;
+    ++nearest_id;
+  }
+  while (nearest_id > 0) {
+    const double dist = calcSquaredDistance2d(traj.points[nearest_id - 1], point);
+    if (dist >= min_dist) {
+      break;
+    }
+    min_dist = dist;
+    --nearest_id;
+  }
+  return nearest_id;
+}
+
+size_t findNearestSegmentIndexFrom(
+  const Trajectory & traj, const Point & point, const size_t start_id)
+{
+  const size_t nearest_id = findNearestIndexFrom(traj, point, start_id);
+  if (nearest_id == 0) {
+    return 0;
+  }
+  if (nearest_id == traj.points.size() - 1) {
+    return traj.points.size() - 2;
+  }
+  if (motion_utils::calcLongitudinalOffsetToSegment(traj.points, nearest_id, point) <= 0) {
+    return nearest_id - 1;
+  }
+  return nearest_id;
+}
+
 }  // namespace utils
 }  // namespace metrics
 }  // namespace planning_diagnostics
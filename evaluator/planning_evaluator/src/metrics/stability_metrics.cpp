@@ -15,6 +15,7 @@
 #include "planning_evaluator/metrics/stability_metrics.hpp"
 
 #include "motion_utils/trajectory/trajectory.hpp"
+#include "planning_evaluator/metrics/metrics_utils.hpp"
 #include "tier4_autoware_utils/geometry/geometry.hpp"
 
 #include <Eigen/Core>
@@ -60,13 +61,19 @@ Stat<double> calcFrechetDistance(const Trajectory & traj1, const Trajectory & tr
 Stat<double> calcLateralDistance(const Trajectory & traj1, const Trajectory & traj2)
 {
   Stat<double> stat;
-  if (traj1.points.empty()) {
+  if (traj1.points.empty() || traj2.points.empty()) {
     return stat;
   }
+  // The points of traj2 are aligned with traj1 by searching from the previous nearest index,
+  // starting from the global nearest index for the first point.
+  size_t nearest_idx =
+    motion_utils::findNearestIndex(traj1.points, tier4_autoware_utils::getPoint(traj2.points[0]));
   for (const auto & point : traj2.points) {
     const auto p0 = tier4_autoware_utils::getPoint(point);
     // find nearest segment
-    const size_t nearest_segment_idx = motion_utils::findNearestSegmentIndex(traj1.points, p0);
+    const size_t nearest_segment_idx =
+      utils::findNearestSegmentIndexFrom(traj1, p0, nearest_idx);
+    nearest_idx = nearest_segment_idx;
     double dist;
     // distance to segment
     if (
@@ -51,17 +51,13 @@ std::optional<Stat<double>> MetricsCalculator::calculate(
       return metrics::calcVelocityDeviation(reference_trajectory_, traj);
     case Metric::stability_frechet:
       return metrics::calcFrechetDistance(
-        getLookaheadTrajectory(
-          previous_trajectory_, parameters.trajectory.lookahead.max_dist_m,
-          parameters.trajectory.lookahead.max_time_s),
+        getPreviousLookaheadTrajectory(),
         getLookaheadTrajectory(
           traj, parameters.trajectory.lookahead.max_dist_m,
           parameters.trajectory.lookahead.max_time_s));
     case Metric::stability:
       return metrics::calcLateralDistance(
-        getLookaheadTrajectory(
-          previous_trajectory_, parameters.trajectory.lookahead.max_dist_m,
-          parameters.trajectory.lookahead.max_time_s),
+        getPreviousLookaheadTrajectory(),
         getLookaheadTrajectory(
           traj, parameters.trajectory.lookahead.max_dist_m,
           parameters.trajectory.lookahead.max_time_s));
@@ -98,6 +94,7 @@ void MetricsCalculator::setReferenceTrajectory(const Trajectory & traj)
 void MetricsCalculator::setPreviousTrajectory(const Trajectory & traj)
 {
   previous_trajectory_ = traj;
+  previous_trajectory_lookahead_.reset();
 }
 
 void MetricsCalculator::setPredictedObjects(const PredictedObjects & objects)
@@ -108,6 +105,7 @@ void MetricsCalculator::setPredictedObjects(const PredictedObjects & objects)
 void MetricsCalculator::setEgoPose(const geometry_msgs::msg::Pose & pose)
 {
   ego_pose_ = pose;
+  previous_trajectory_lookahead_.reset();
 }
 
 Pose MetricsCalculator::getEgoPose()
@@ -143,4 +141,14 @@ Trajectory MetricsCalculator::getLookaheadTrajectory(
   return lookahead_traj;
 }
 
+const Trajectory & MetricsCalculator::getPreviousLookaheadTrajectory() const
+{
+  if (!previous_trajectory_lookahead_) {
+    previous_trajectory_lookahead_ = getLookaheadTrajectory(
+      previous_trajectory_, parameters.trajectory.lookahead.max_dist_m,
+      parameters.trajectory.lookahead.max_time_s);
+  }
+  return *previous_trajectory_lookahead_;
+}
+
 }  // namespace planning_diagnostics
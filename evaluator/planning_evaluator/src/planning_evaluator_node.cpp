@@ -16,10 +16,12 @@
 
 #include "boost/lexical_cast.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -62,6 +64,11 @@ PlanningEvaluatorNode::PlanningEvaluatorNode(const rclcpp::NodeOptions & node_op
 
   output_file_str_ = declare_parameter<std::string>("output_file");
   ego_frame_str_ = declare_parameter<std::string>("ego_frame");
+  const auto window_size = declare_parameter<int64_t>("window.size");
+  window_quantiles_ = declare_parameter<std::vector<double>>("window.quantiles");
+  metric_windows_.assign(
+    static_cast<size_t>(Metric::SIZE),
+    WindowStat<double>(static_cast<size_t>(std::max<int64_t>(window_size, 0))));
 
   // List of metrics to calculate and publish
   metrics_pub_ = create_publisher<DiagnosticArray>("~/metrics", 1);
@@ -121,6 +128,22 @@ DiagnosticStatus PlanningEvaluatorNode::generateDiagnosticStatus(
   key_value.key = "mean";
   key_value.value = boost::lexical_cast<decltype(key_value.value)>(metric_stat.mean());
   status.values.push_back(key_value);
+
+  const auto & window = metric_windows_[static_cast<size_t>(metric)];
+  if (window.count() == 0) {
+    return status;
+  }
+  key_value.key = "window_mean";
+  key_value.value = boost::lexical_cast<decltype(key_value.value)>(window.mean());
+  status.values.push_back(key_value);
+  const auto quantiles = window.quantiles(window_quantiles_);
+  for (size_t i = 0; i < quantiles.size(); ++i) {
+    std::ostringstream key;
+    key << "window_p" << window_quantiles_[i] * 100.0;
+    key_value.key = key.str();
+    key_value.value = boost::lexical_cast<decltype(key_value.value)>(quantiles[i]);
+    status.values.push_back(key_value);
+  }
   return status;
 }
 
@@ -148,6 +171,7 @@ void PlanningEvaluatorNode::onTrajectory(const Trajectory::ConstSharedPtr traj_m
     }
 
     if (metric_stat->count() > 0) {
+      metric_windows_[static_cast<size_t>(metric)].add(metric_stat->mean());
       metrics_msg.status.push_back(generateDiagnosticStatus(metric, *metric_stat));
     }
   }
@@ -190,8 +214,8 @@ void PlanningEvaluatorNode::publishModifiedGoalDeviationMetrics()
     if (!metric_stat) {
       continue;
     }
-    metric_stats_[static_cast<size_t>(metric)].push_back(*metric_stat);
     if (metric_stat->count() > 0) {
+      metric_windows_[static_cast<size_t>(metric)].add(metric_stat->mean());
       metrics_msg.status.push_back(generateDiagnosticStatus(metric, *metric_stat));
     }
   }
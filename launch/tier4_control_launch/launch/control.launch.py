@@ -66,6 +66,22 @@ def launch_setup(context, *args, **kwargs):
     with open(LaunchConfiguration("predicted_path_checker_param_path").perform(context), "r") as f:
         predicted_path_checker_param = yaml.safe_load(f)["/**"]["ros__parameters"]
 
+    # NOTE: With the cruise pipeline container, the planning modules from obstacle_cruise_planner
+    #       are loaded into this container, and the trajectory and the control command are passed
+    #       by intra-process comms. Each node runs in its own callback group on the multi-threaded
+    #       executor.
+    use_cruise_pipeline_container = IfCondition(
+        LaunchConfiguration("use_cruise_pipeline_container")
+    ).evaluate(context)
+    if use_cruise_pipeline_container:
+        cruise_pipeline_extra_arguments = [{"use_intra_process_comms": True}]
+        container_executable = "component_container_mt"
+    else:
+        cruise_pipeline_extra_arguments = [
+            {"use_intra_process_comms": LaunchConfiguration("use_intra_process")}
+        ]
+        container_executable = LaunchConfiguration("container_executable")
+
     controller_component = ComposableNode(
         package="trajectory_follower_node",
         plugin="autoware::motion::control::trajectory_follower_node::Controller",
@@ -94,7 +110,7 @@ def launch_setup(context, *args, **kwargs):
             lat_controller_param,
             vehicle_info_param,
         ],
-        extra_arguments=[{"use_intra_process_comms": LaunchConfiguration("use_intra_process")}],
+        extra_arguments=cruise_pipeline_extra_arguments,
     )
 
     # lane departure checker
@@ -255,7 +271,7 @@ def launch_setup(context, *args, **kwargs):
                 ),
             },
         ],
-        extra_arguments=[{"use_intra_process_comms": LaunchConfiguration("use_intra_process")}],
+        extra_arguments=cruise_pipeline_extra_arguments,
     )
 
     # operation mode transition manager
@@ -348,7 +364,7 @@ def launch_setup(context, *args, **kwargs):
         name="control_container",
         namespace="",
         package="rclcpp_components",
-        executable=LaunchConfiguration("container_executable"),
+        executable=container_executable,
         composable_node_descriptions=[
             controller_component,
             control_validator_component,
@@ -411,6 +427,11 @@ def generate_launch_description():
     # component
     add_launch_arg("use_intra_process", "false", "use ROS 2 component container communication")
     add_launch_arg("use_multithread", "false", "use multithread")
+    add_launch_arg(
+        "use_cruise_pipeline_container",
+        "false",
+        "compose the cruise pipeline of the planning into the control container",
+    )
     set_container_executable = SetLaunchConfiguration(
         "container_executable",
         "component_container",
@@ -88,6 +88,7 @@ def launch_setup(context, *args, **kwargs):
         remappings=[
             ("~/input/path", planner_input_path_topic),
             ("~/input/odometry", "/localization/kinematic_state"),
+            ("~/input/vector_map", "/map/vector_map"),
             ("~/output/path", "obstacle_avoidance_planner/trajectory"),
         ],
         parameters=[
@@ -119,6 +120,38 @@ def launch_setup(context, *args, **kwargs):
         extra_arguments=[{"use_intra_process_comms": LaunchConfiguration("use_intra_process")}],
     )
 
+    # obstacle pointcloud downsampled and transformed to the map frame once, which is shared by the
+    # modules planning in the map frame. It is passed without copy within the container when
+    # use_intra_process is true.
+    use_shared_obstacle_pointcloud = IfCondition(
+        LaunchConfiguration("use_shared_obstacle_pointcloud")
+    ).evaluate(context)
+    raw_obstacle_pointcloud_topic = "/perception/obstacle_segmentation/pointcloud"
+    shared_obstacle_pointcloud_topic = (
+        "obstacle_pointcloud_preprocessor/pointcloud"
+        if use_shared_obstacle_pointcloud
+        else raw_obstacle_pointcloud_topic
+    )
+    obstacle_pointcloud_preprocessor_component = ComposableNode(
+        package="pointcloud_preprocessor",
+        plugin="pointcloud_preprocessor::VoxelGridDownsampleFilterComponent",
+        name="obstacle_pointcloud_preprocessor",
+        namespace="",
+        remappings=[
+            ("input", raw_obstacle_pointcloud_topic),
+            ("output", shared_obstacle_pointcloud_topic),
+        ],
+        parameters=[
+            {
+                "voxel_size_x": 0.05,
+                "voxel_size_y": 0.05,
+                "voxel_size_z": 100000.0,
+                "output_frame": "map",
+            }
+        ],
+        extra_arguments=[{"use_intra_process_comms": LaunchConfiguration("use_intra_process")}],
+    )
+
     # obstacle velocity limiter
     with open(
         LaunchConfiguration("obstacle_velocity_limiter_param_path").perform(context), "r"
@@ -134,7 +167,7 @@ def launch_setup(context, *args, **kwargs):
             ("~/input/odometry", "/localization/kinematic_state"),
             ("~/input/dynamic_obstacles", "/perception/object_recognition/objects"),
             ("~/input/occupancy_grid", "/perception/occupancy_grid_map/map"),
-            ("~/input/obstacle_pointcloud", "/perception/obstacle_segmentation/pointcloud"),
+            ("~/input/obstacle_pointcloud", shared_obstacle_pointcloud_topic),
             ("~/input/map", "/map/vector_map"),
             ("~/output/debug_markers", "debug_markers"),
             ("~/output/trajectory", "obstacle_velocity_limiter/trajectory"),
@@ -200,10 +233,7 @@ def launch_setup(context, *args, **kwargs):
             ),
             ("~/output/trajectory", "/planning/scenario_planning/lane_driving/trajectory"),
             ("~/input/acceleration", "/localization/acceleration"),
-            (
-                "~/input/pointcloud",
-                "/perception/obstacle_segmentation/pointcloud",
-            ),
+            ("~/input/pointcloud", shared_obstacle_pointcloud_topic),
             ("~/input/objects", "/perception/object_recognition/objects"),
             ("~/input/odometry", "/localization/kinematic_state"),
             ("~/input/trajectory", "obstacle_velocity_limiter/trajectory"),
@@ -219,6 +249,17 @@ def launch_setup(context, *args, **kwargs):
     )
 
     # obstacle cruise planner
+    # NOTE: With the cruise pipeline container, the planner is composed with the velocity smoother,
+    #       the controller and the vehicle command gate to pass the data by intra-process comms.
+    use_cruise_pipeline_container = IfCondition(
+        LaunchConfiguration("use_cruise_pipeline_container")
+    ).evaluate(context)
+    if use_cruise_pipeline_container:
+        obstacle_cruise_planner_extra_arguments = [{"use_intra_process_comms": True}]
+    else:
+        obstacle_cruise_planner_extra_arguments = [
+            {"use_intra_process_comms": LaunchConfiguration("use_intra_process")}
+        ]
     with open(LaunchConfiguration("obstacle_cruise_planner_param_path").perform(context), "r") as f:
         obstacle_cruise_planner_param = yaml.safe_load(f)["/**"]["ros__parameters"]
     obstacle_cruise_planner_component = ComposableNode(
@@ -231,6 +272,7 @@ def launch_setup(context, *args, **kwargs):
             ("~/input/odometry", "/localization/kinematic_state"),
             ("~/input/acceleration", "/localization/acceleration"),
             ("~/input/objects", "/perception/object_recognition/objects"),
+            ("~/input/leader_state", "/planning/scenario_planning/platooning/leader_state"),
             ("~/output/trajectory", "/planning/scenario_planning/lane_driving/trajectory"),
             ("~/output/velocity_limit", "/planning/scenario_planning/max_velocity_candidates"),
             ("~/output/clear_velocity_limit", "/planning/scenario_planning/clear_velocity_limit"),
@@ -241,7 +283,7 @@ def launch_setup(context, *args, **kwargs):
             common_param,
             obstacle_cruise_planner_param,
         ],
-        extra_arguments=[{"use_intra_process_comms": LaunchConfiguration("use_intra_process")}],
+        extra_arguments=obstacle_cruise_planner_extra_arguments,
     )
 
     obstacle_cruise_planner_relay_component = ComposableNode(
@@ -267,15 +309,24 @@ def launch_setup(context, *args, **kwargs):
         ],
     )
 
+    obstacle_pointcloud_preprocessor_loader = LoadComposableNodes(
+        composable_node_descriptions=[obstacle_pointcloud_preprocessor_component],
+        target_container=container,
+        condition=IfCondition(LaunchConfiguration("use_shared_obstacle_pointcloud")),
+    )
+
     obstacle_stop_planner_loader = LoadComposableNodes(
         composable_node_descriptions=[obstacle_stop_planner_component],
         target_container=container,
         condition=LaunchConfigurationEquals("cruise_planner_type", "obstacle_stop_planner"),
     )
 
+    obstacle_cruise_planner_container = container
+    if use_cruise_pipeline_container:
+        obstacle_cruise_planner_container = LaunchConfiguration("cruise_pipeline_container_name")
     obstacle_cruise_planner_loader = LoadComposableNodes(
         composable_node_descriptions=[obstacle_cruise_planner_component],
-        target_container=container,
+        target_container=obstacle_cruise_planner_container,
         condition=LaunchConfigurationEquals("cruise_planner_type", "obstacle_cruise_planner"),
     )
 
@@ -322,6 +373,7 @@ def launch_setup(context, *args, **kwargs):
     group = GroupAction(
         [
             container,
+            obstacle_pointcloud_preprocessor_loader,
             smoother_loader,
             obstacle_avoidance_planner_loader,
             path_sampler_loader,
@@ -362,9 +414,24 @@ def generate_launch_description():
         "path_planner_type", "obstacle_avoidance_planner"
     )  # select from "obstacle_avoidance_planner", "path_sampler"
     add_launch_arg("path_smoother_type", "elastic_band")  # select from "elastic_band", "none"
+    add_launch_arg(
+        "use_shared_obstacle_pointcloud",
+        "true",
+        "downsample and transform obstacle pointcloud once for the motion planning modules",
+    )
 
     add_launch_arg("use_intra_process", "false", "use ROS 2 component container communication")
     add_launch_arg("use_multithread", "false", "use multithread")
+    add_launch_arg(
+        "use_cruise_pipeline_container",
+        "false",
+        "load obstacle_cruise_planner into the cruise pipeline container",
+    )
+    add_launch_arg(
+        "cruise_pipeline_container_name",
+        "/control/control_container",
+        "container of the cruise pipeline",
+    )
 
     set_container_executable = SetLaunchConfiguration(
         "container_executable",
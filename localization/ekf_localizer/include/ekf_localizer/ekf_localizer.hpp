@@ -17,6 +17,7 @@
 
 #include "ekf_localizer/aged_object_queue.hpp"
 #include "ekf_localizer/hyper_parameters.hpp"
+#include "ekf_localizer/spsc_ring_buffer.hpp"
 #include "ekf_localizer/warning.hpp"
 
 #include <kalman_filter/kalman_filter.hpp>
@@ -42,6 +43,7 @@
 #include <tf2_ros/transform_broadcaster.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <atomic>
 #include <chrono>
 #include <iostream>
 #include <memory>
@@ -169,7 +171,7 @@ private:
   double proc_cov_vx_d_;        //!< @brief  discrete process noise in d_vx=0
   double proc_cov_wz_d_;        //!< @brief  discrete process noise in d_wz=0
 
-  bool is_activated_;
+  std::atomic<bool> is_activated_;
 
   size_t pose_no_update_count_;
   size_t pose_queue_size_;
@@ -190,6 +192,10 @@ private:
   AgedObjectQueue<geometry_msgs::msg::PoseWithCovarianceStamped::SharedPtr> pose_queue_;
   AgedObjectQueue<geometry_msgs::msg::TwistWithCovarianceStamped::SharedPtr> twist_queue_;
 
+  //!< @brief measurements received by the subscriptions and not moved to the queues yet
+  SpscRingBuffer<geometry_msgs::msg::PoseWithCovarianceStamped::SharedPtr> received_pose_buffer_;
+  SpscRingBuffer<geometry_msgs::msg::TwistWithCovarianceStamped::SharedPtr> received_twist_buffer_;
+
   geometry_msgs::msg::PoseStamped current_ekf_pose_;  //!< @brief current estimated pose
   geometry_msgs::msg::PoseStamped
     current_biased_ekf_pose_;  //!< @brief current estimated pose without yaw bias correction
@@ -207,6 +213,11 @@ private:
    */
   void timerTFCallback();
 
+  /**
+   * @brief move the measurements received by the subscriptions to the queues
+   */
+  void moveReceivedMeasurementsToQueues();
+
   /**
    * @brief set poseWithCovariance measurement
    */
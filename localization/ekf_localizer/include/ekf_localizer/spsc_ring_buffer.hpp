@@ -0,0 +1,64 @@
+// Copyright 2023 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef EKF_LOCALIZER__SPSC_RING_BUFFER_HPP_
+#define EKF_LOCALIZER__SPSC_RING_BUFFER_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// Lock-free ring buffer for a single producer thread and a single consumer thread.
+template <typename Object>
+class SpscRingBuffer
+{
+public:
+  // one slot is kept empty to distinguish a full buffer from an empty one
+  explicit SpscRingBuffer(const size_t capacity) : objects_(capacity + 1) {}
+
+  // returns false without storing the object if the buffer is full (producer only)
+  bool push(const Object & object)
+  {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    const size_t next_tail = next(tail);
+    if (next_tail == head_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    objects_[tail] = object;
+    tail_.store(next_tail, std::memory_order_release);
+    return true;
+  }
+
+  // returns false if the buffer is empty (consumer only)
+  bool pop(Object & object)
+  {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    object = objects_[head];
+    objects_[head] = Object();
+    head_.store(next(head), std::memory_order_release);
+    return true;
+  }
+
+private:
+  size_t next(const size_t index) const { return index + 1 == objects_.size() ? 0 : index + 1; }
+
+  std::vector<Object> objects_;
+  std::atomic<size_t> head_{0};
+  std::atomic<size_t> tail_{0};
+};
+
+#endif  // EKF_LOCALIZER__SPSC_RING_BUFFER_HPP_
@@ -51,6 +51,9 @@
 
 using std::placeholders::_1;
 
+// measurements can be received at several times the EKF rate
+constexpr size_t received_measurement_buffer_size = 100;
+
 EKFLocalizer::EKFLocalizer(const std::string & node_name, const rclcpp::NodeOptions & node_options)
 : rclcpp::Node(node_name, node_options),
   warning_(this),
@@ -59,7 +62,9 @@ EKFLocalizer::EKFLocalizer(const std::string & node_name, const rclcpp::NodeOpti
   ekf_dt_(params_.ekf_dt),
   dim_x_(6 /* x, y, yaw, yaw_bias, vx, wz */),
   pose_queue_(params_.pose_smoothing_steps),
-  twist_queue_(params_.twist_smoothing_steps)
+  twist_queue_(params_.twist_smoothing_steps),
+  received_pose_buffer_(received_measurement_buffer_size),
+  received_twist_buffer_(received_measurement_buffer_size)
 {
   /* convert to continuous to discrete */
   proc_cov_vx_d_ = std::pow(params_.proc_stddev_vx_c * ekf_dt_, 2.0);
@@ -91,10 +96,17 @@ EKFLocalizer::EKFLocalizer(const std::string & node_name, const rclcpp::NodeOpti
   pub_diag_ = this->create_publisher<diagnostic_msgs::msg::DiagnosticArray>("/diagnostics", 10);
   sub_initialpose_ = create_subscription<geometry_msgs::msg::PoseWithCovarianceStamped>(
     "initialpose", 1, std::bind(&EKFLocalizer::callbackInitialPose, this, _1));
+
+  // the measurements are received apart from the timers and handed to them through ring buffers
+  rclcpp::SubscriptionOptions measurement_sub_opt;
+  measurement_sub_opt.callback_group =
+    create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
   sub_pose_with_cov_ = create_subscription<geometry_msgs::msg::PoseWithCovarianceStamped>(
-    "in_pose_with_covariance", 1, std::bind(&EKFLocalizer::callbackPoseWithCovariance, this, _1));
+    "in_pose_with_covariance", 1, std::bind(&EKFLocalizer::callbackPoseWithCovariance, this, _1),
+    measurement_sub_opt);
   sub_twist_with_cov_ = create_subscription<geometry_msgs::msg::TwistWithCovarianceStamped>(
-    "in_twist_with_covariance", 1, std::bind(&EKFLocalizer::callbackTwistWithCovariance, this, _1));
+    "in_twist_with_covariance", 1, std::bind(&EKFLocalizer::callbackTwistWithCovariance, this, _1),
+    measurement_sub_opt);
   service_trigger_node_ = create_service<std_srvs::srv::SetBool>(
     "trigger_node_srv",
     std::bind(
@@ -142,6 +154,8 @@ void EKFLocalizer::updatePredictFrequency()
  */
 void EKFLocalizer::timerCallback()
 {
+  moveReceivedMeasurementsToQueues();
+
   if (!is_activated_) {
     warning_.warnThrottle(
       "The node is not activated. Provide initial pose to pose_initializer", 2000);
@@ -366,6 +380,21 @@ void EKFLocalizer::callbackInitialPose(
   initSimple1DFilters(*initialpose);
 }
 
+/*
+ * moveReceivedMeasurementsToQueues
+ */
+void EKFLocalizer::moveReceivedMeasurementsToQueues()
+{
+  geometry_msgs::msg::PoseWithCovarianceStamped::SharedPtr pose;
+  while (received_pose_buffer_.pop(pose)) {
+    pose_queue_.push(pose);
+  }
+  geometry_msgs::msg::TwistWithCovarianceStamped::SharedPtr twist;
+  while (received_twist_buffer_.pop(twist)) {
+    twist_queue_.push(twist);
+  }
+}
+
 /*
  * callbackPoseWithCovariance
  */
@@ -376,7 +405,10 @@ void EKFLocalizer::callbackPoseWithCovariance(
     return;
   }
 
-  pose_queue_.push(msg);
+  if (!received_pose_buffer_.push(msg)) {
+    RCLCPP_WARN_THROTTLE(
+      get_logger(), *get_clock(), 1000, "The received pose buffer is full, the pose is ignored");
+  }
 }
 
 /*
@@ -390,7 +422,10 @@ void EKFLocalizer::callbackTwistWithCovariance(
   if (std::abs(msg->twist.twist.linear.x) < params_.threshold_observable_velocity_mps) {
     msg->twist.covariance[0 * 6 + 0] = 10000.0;
   }
-  twist_queue_.push(msg);
+  if (!received_twist_buffer_.push(msg)) {
+    RCLCPP_WARN_THROTTLE(
+      get_logger(), *get_clock(), 1000, "The received twist buffer is full, the twist is ignored");
+  }
 }
 
 /*
@@ -741,6 +776,7 @@ void EKFLocalizer::serviceTriggerNode(
   std_srvs::srv::SetBool::Response::SharedPtr res)
 {
   if (req->data) {
+    moveReceivedMeasurementsToQueues();
     pose_queue_.clear();
     twist_queue_.clear();
     is_activated_ = true;
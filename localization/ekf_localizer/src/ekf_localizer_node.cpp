@@ -22,7 +22,10 @@ int main(int argc, char ** argv)
   rclcpp::NodeOptions node_options;
   auto node = std::make_shared<EKFLocalizer>("ekf_localizer", node_options);
 
-  rclcpp::spin(node);
+  // the measurements are received while the EKF is predicted and updated
+  rclcpp::executors::MultiThreadedExecutor executor;
+  executor.add_node(node);
+  executor.spin();
 
   return 0;
 }
@@ -0,0 +1,74 @@
+// Copyright 2023 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ekf_localizer/spsc_ring_buffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+
+TEST(SpscRingBuffer, PopsInPushOrder)
+{
+  SpscRingBuffer<std::string> buffer(2);
+
+  std::string object;
+  EXPECT_FALSE(buffer.pop(object));
+
+  EXPECT_TRUE(buffer.push("a"));
+  EXPECT_TRUE(buffer.push("b"));
+  EXPECT_FALSE(buffer.push("c"));  // full
+
+  EXPECT_TRUE(buffer.pop(object));
+  EXPECT_EQ(object, std::string{"a"});
+
+  EXPECT_TRUE(buffer.push("d"));  // wraps around
+
+  EXPECT_TRUE(buffer.pop(object));
+  EXPECT_EQ(object, std::string{"b"});
+  EXPECT_TRUE(buffer.pop(object));
+  EXPECT_EQ(object, std::string{"d"});
+  EXPECT_FALSE(buffer.pop(object));
+}
+
+TEST(SpscRingBuffer, ProducerAndConsumerThreads)
+{
+  constexpr int n = 10000;
+  SpscRingBuffer<int> buffer(16);
+
+  std::thread producer([&buffer]() {
+    for (int i = 0; i < n;) {
+      if (buffer.push(i)) {
+        ++i;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  int expected = 0;
+  while (expected < n) {
+    int object;
+    if (buffer.pop(object)) {
+      EXPECT_EQ(object, expected);
+      ++expected;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+
+  int object;
+  EXPECT_FALSE(buffer.pop(object));
+}
@@ -15,6 +15,7 @@
 #ifndef GYRO_ODOMETER__GYRO_ODOMETER_CORE_HPP_
 #define GYRO_ODOMETER__GYRO_ODOMETER_CORE_HPP_
 
+#include "gyro_odometer/twist_preintegrator.hpp"
 #include "tier4_autoware_utils/ros/msg_covariance.hpp"
 #include "tier4_autoware_utils/ros/transform_listener.hpp"
 
@@ -31,7 +32,7 @@
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 #endif
 
-#include <deque>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -48,6 +49,7 @@ private:
   void callbackVehicleTwist(
     const geometry_msgs::msg::TwistWithCovarianceStamped::ConstSharedPtr vehicle_twist_msg_ptr);
   void callbackImu(const sensor_msgs::msg::Imu::ConstSharedPtr imu_msg_ptr);
+  void correctImu(sensor_msgs::msg::Imu & imu) const;
   void publishData(const geometry_msgs::msg::TwistWithCovarianceStamped & twist_with_cov_raw);
 
   rclcpp::Subscription<geometry_msgs::msg::TwistWithCovarianceStamped>::SharedPtr
@@ -67,10 +69,24 @@ private:
   std::string output_frame_;
   double message_timeout_sec_;
 
+  // publish the twist for every imu_batch_size imu messages instead of every vehicle twist
+  bool publish_at_imu_rate_;
+  int64_t imu_batch_size_;
+  bool preintegrate_acceleration_;
+
+  // the same corrections as imu_corrector, to subscribe the raw imu directly
+  struct ImuCorrectionParam
+  {
+    bool enable;
+    geometry_msgs::msg::Vector3 angular_velocity_offset;
+    geometry_msgs::msg::Vector3 angular_velocity_stddev;
+    double acceleration_stddev;
+  };
+  ImuCorrectionParam imu_correction_param_;
+
   bool vehicle_twist_arrived_;
   bool imu_arrived_;
-  std::deque<geometry_msgs::msg::TwistWithCovarianceStamped> vehicle_twist_queue_;
-  std::deque<sensor_msgs::msg::Imu> gyro_queue_;
+  TwistPreintegrator preintegrator_;
 };
 
 #endif  // GYRO_ODOMETER__GYRO_ODOMETER_CORE_HPP_
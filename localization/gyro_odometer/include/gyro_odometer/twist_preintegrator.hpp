@@ -0,0 +1,74 @@
+// Copyright 2023 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GYRO_ODOMETER__TWIST_PREINTEGRATOR_HPP_
+#define GYRO_ODOMETER__TWIST_PREINTEGRATOR_HPP_
+
+#include <rclcpp/time.hpp>
+
+#include <geometry_msgs/msg/twist_with_covariance_stamped.hpp>
+#include <geometry_msgs/msg/vector3.hpp>
+#include <sensor_msgs/msg/imu.hpp>
+
+#include <cstddef>
+#include <string>
+
+// Accumulates the vehicle twist and the imu samples received between two outputs of the gyro
+// odometer. Only the running sums are kept, so the memory does not grow with the imu rate.
+class TwistPreintegrator
+{
+public:
+  void addVehicleTwist(const geometry_msgs::msg::TwistWithCovarianceStamped & vehicle_twist);
+  // the imu must already be transformed to the output frame
+  void addImu(const sensor_msgs::msg::Imu & imu);
+
+  size_t getVehicleTwistCount() const { return vehicle_twist_count_; }
+  size_t getImuCount() const { return imu_count_; }
+  bool hasLatestVehicleTwist() const { return has_latest_vehicle_twist_; }
+  rclcpp::Time getLatestVehicleTwistStamp() const { return latest_vehicle_twist_stamp_; }
+  rclcpp::Time getLatestImuStamp() const { return latest_imu_stamp_; }
+
+  // mean of the accumulated vehicle twists and angular velocities
+  geometry_msgs::msg::TwistWithCovarianceStamped getAveragedTwist() const;
+  // latest vehicle twist whose longitudinal velocity is propagated to the latest imu stamp with
+  // the acceleration integrated since the vehicle twist, and mean of the angular velocities
+  geometry_msgs::msg::TwistWithCovarianceStamped getPropagatedTwist(
+    const bool preintegrate_acceleration) const;
+
+  // clear the accumulated samples, but keep the latest vehicle twist to be propagated
+  void clearSamples();
+  void clear();
+
+private:
+  // sums since the last output
+  size_t vehicle_twist_count_{0};
+  double vx_sum_{0.0};
+  double vx_covariance_sum_{0.0};
+  size_t imu_count_{0};
+  geometry_msgs::msg::Vector3 gyro_sum_{};
+  geometry_msgs::msg::Vector3 gyro_covariance_sum_{};
+  std::string imu_frame_id_;
+
+  // latest vehicle twist and the longitudinal acceleration integrated since it
+  bool has_latest_vehicle_twist_{false};
+  double latest_vx_{0.0};
+  double latest_vx_covariance_{0.0};
+  rclcpp::Time latest_vehicle_twist_stamp_{0, 0, RCL_ROS_TIME};
+  rclcpp::Time latest_imu_stamp_{0, 0, RCL_ROS_TIME};
+  rclcpp::Time integrated_stamp_{0, 0, RCL_ROS_TIME};
+  double integrated_vx_{0.0};
+  double integrated_vx_covariance_{0.0};
+};
+
+#endif  // GYRO_ODOMETER__TWIST_PREINTEGRATOR_HPP_
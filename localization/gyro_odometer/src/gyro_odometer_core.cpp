@@ -39,74 +39,37 @@ std::array<double, 9> transformCovariance(const std::array<double, 9> & cov)
   return cov_transformed;
 }
 
-geometry_msgs::msg::TwistWithCovarianceStamped concatGyroAndOdometer(
-  const std::deque<geometry_msgs::msg::TwistWithCovarianceStamped> & vehicle_twist_queue,
-  const std::deque<sensor_msgs::msg::Imu> & gyro_queue)
-{
-  using COV_IDX_XYZ = tier4_autoware_utils::xyz_covariance_index::XYZ_COV_IDX;
-  using COV_IDX_XYZRPY = tier4_autoware_utils::xyzrpy_covariance_index::XYZRPY_COV_IDX;
-
-  double vx_mean = 0;
-  geometry_msgs::msg::Vector3 gyro_mean{};
-  double vx_covariance_original = 0;
-  geometry_msgs::msg::Vector3 gyro_covariance_original{};
-  for (const auto & vehicle_twist : vehicle_twist_queue) {
-    vx_mean += vehicle_twist.twist.twist.linear.x;
-    vx_covariance_original += vehicle_twist.twist.covariance[0 * 6 + 0];
-  }
-  vx_mean /= vehicle_twist_queue.size();
-  vx_covariance_original /= vehicle_twist_queue.size();
-
-  for (const auto & gyro : gyro_queue) {
-    gyro_mean.x += gyro.angular_velocity.x;
-    gyro_mean.y += gyro.angular_velocity.y;
-    gyro_mean.z += gyro.angular_velocity.z;
-    gyro_covariance_original.x += gyro.angular_velocity_covariance[COV_IDX_XYZ::X_X];
-    gyro_covariance_original.y += gyro.angular_velocity_covariance[COV_IDX_XYZ::Y_Y];
-    gyro_covariance_original.z += gyro.angular_velocity_covariance[COV_IDX_XYZ::Z_Z];
-  }
-  gyro_mean.x /= gyro_queue.size();
-  gyro_mean.y /= gyro_queue.size();
-  gyro_mean.z /= gyro_queue.size();
-  gyro_covariance_original.x /= gyro_queue.size();
-  gyro_covariance_original.y /= gyro_queue.size();
-  gyro_covariance_original.z /= gyro_queue.size();
-
-  geometry_msgs::msg::TwistWithCovarianceStamped twist_with_cov;
-  const auto latest_vehicle_twist_stamp = rclcpp::Time(vehicle_twist_queue.back().header.stamp);
-  const auto latest_imu_stamp = rclcpp::Time(gyro_queue.back().header.stamp);
-  if (latest_vehicle_twist_stamp < latest_imu_stamp) {
-    twist_with_cov.header.stamp = latest_imu_stamp;
-  } else {
-    twist_with_cov.header.stamp = latest_vehicle_twist_stamp;
-  }
-  twist_with_cov.header.frame_id = gyro_queue.front().header.frame_id;
-  twist_with_cov.twist.twist.linear.x = vx_mean;
-  twist_with_cov.twist.twist.angular = gyro_mean;
-
-  // From a statistical point of view, here we reduce the covariances according to the number of
-  // observed data
-  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::X_X] =
-    vx_covariance_original / vehicle_twist_queue.size();
-  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::Y_Y] = 100000.0;
-  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::Z_Z] = 100000.0;
-  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::ROLL_ROLL] =
-    gyro_covariance_original.x / gyro_queue.size();
-  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::PITCH_PITCH] =
-    gyro_covariance_original.y / gyro_queue.size();
-  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::YAW_YAW] =
-    gyro_covariance_original.z / gyro_queue.size();
-
-  return twist_with_cov;
-}
-
 GyroOdometer::GyroOdometer(const rclcpp::NodeOptions & options)
 : Node("gyro_odometer", options),
   output_frame_(declare_parameter("output_frame", "base_link")),
   message_timeout_sec_(declare_parameter("message_timeout_sec", 0.2)),
+  publish_at_imu_rate_(declare_parameter("publish_at_imu_rate", false)),
+  imu_batch_size_(declare_parameter<int64_t>("imu_batch_size", 1)),
+  preintegrate_acceleration_(declare_parameter("preintegrate_acceleration", false)),
   vehicle_twist_arrived_(false),
   imu_arrived_(false)
 {
+  imu_correction_param_.enable = declare_parameter("imu_correction.enable", false);
+  imu_correction_param_.angular_velocity_offset.x =
+    declare_parameter("imu_correction.angular_velocity_offset_x", 0.0);
+  imu_correction_param_.angular_velocity_offset.y =
+    declare_parameter("imu_correction.angular_velocity_offset_y", 0.0);
+  imu_correction_param_.angular_velocity_offset.z =
+    declare_parameter("imu_correction.angular_velocity_offset_z", 0.0);
+  imu_correction_param_.angular_velocity_stddev.x =
+    declare_parameter("imu_correction.angular_velocity_stddev_xx", 0.03);
+  imu_correction_param_.angular_velocity_stddev.y =
+    declare_parameter("imu_correction.angular_velocity_stddev_yy", 0.03);
+  imu_correction_param_.angular_velocity_stddev.z =
+    declare_parameter("imu_correction.angular_velocity_stddev_zz", 0.03);
+  imu_correction_param_.acceleration_stddev =
+    declare_parameter("imu_correction.acceleration_stddev", 10000.0);
+
+  if (imu_batch_size_ < 1) {
+    RCLCPP_WARN(get_logger(), "imu_batch_size must be positive, 1 is used instead");
+    imu_batch_size_ = 1;
+  }
+
   transform_listener_ = std::make_shared<tier4_autoware_utils::TransformListener>(this);
 
   vehicle_twist_sub_ = create_subscription<geometry_msgs::msg::TwistWithCovarianceStamped>(
@@ -137,8 +100,7 @@ void GyroOdometer::callbackVehicleTwist(
   vehicle_twist_arrived_ = true;
   if (!imu_arrived_) {
     RCLCPP_WARN_THROTTLE(this->get_logger(), *this->get_clock(), 1000, "Imu msg is not subscribed");
-    vehicle_twist_queue_.clear();
-    gyro_queue_.clear();
+    preintegrator_.clear();
     return;
   }
 
@@ -147,29 +109,27 @@ void GyroOdometer::callbackVehicleTwist(
     const std::string error_msg = fmt::format(
       "Twist msg is timeout. twist_dt: {}[sec], tolerance {}[sec]", twist_dt, message_timeout_sec_);
     RCLCPP_ERROR_THROTTLE(this->get_logger(), *this->get_clock(), 1000, error_msg.c_str());
-    vehicle_twist_queue_.clear();
-    gyro_queue_.clear();
+    preintegrator_.clear();
     return;
   }
 
-  vehicle_twist_queue_.push_back(*vehicle_twist_ptr);
+  preintegrator_.addVehicleTwist(*vehicle_twist_ptr);
+
+  // the twist is published by the imu callback
+  if (publish_at_imu_rate_) return;
 
-  if (gyro_queue_.empty()) return;
-  const double imu_dt = std::abs((this->now() - gyro_queue_.back().header.stamp).seconds());
+  if (preintegrator_.getImuCount() == 0) return;
+  const double imu_dt = std::abs((this->now() - preintegrator_.getLatestImuStamp()).seconds());
   if (imu_dt > message_timeout_sec_) {
     const std::string error_msg = fmt::format(
       "Imu msg is timeout. twist_dt: {}[sec], tolerance {}[sec]", imu_dt, message_timeout_sec_);
     RCLCPP_ERROR_THROTTLE(this->get_logger(), *this->get_clock(), 1000, error_msg.c_str());
-    vehicle_twist_queue_.clear();
-    gyro_queue_.clear();
+    preintegrator_.clear();
     return;
   }
 
-  const geometry_msgs::msg::TwistWithCovarianceStamped twist_with_cov_raw =
-    concatGyroAndOdometer(vehicle_twist_queue_, gyro_queue_);
-  publishData(twist_with_cov_raw);
-  vehicle_twist_queue_.clear();
-  gyro_queue_.clear();
+  publishData(preintegrator_.getAveragedTwist());
+  preintegrator_.clearSamples();
 }
 
 void GyroOdometer::callbackImu(const sensor_msgs::msg::Imu::ConstSharedPtr imu_msg_ptr)
@@ -178,8 +138,7 @@ void GyroOdometer::callbackImu(const sensor_msgs::msg::Imu::ConstSharedPtr imu_m
   if (!vehicle_twist_arrived_) {
     RCLCPP_WARN_THROTTLE(
       this->get_logger(), *this->get_clock(), 1000, "Twist msg is not subscribed");
-    vehicle_twist_queue_.clear();
-    gyro_queue_.clear();
+    preintegrator_.clear();
     return;
   }
 
@@ -188,8 +147,7 @@ void GyroOdometer::callbackImu(const sensor_msgs::msg::Imu::ConstSharedPtr imu_m
     const std::string error_msg = fmt::format(
       "Imu msg is timeout. imu_dt: {}[sec], tolerance {}[sec]", imu_dt, message_timeout_sec_);
     RCLCPP_ERROR_THROTTLE(this->get_logger(), *this->get_clock(), 1000, error_msg.c_str());
-    vehicle_twist_queue_.clear();
-    gyro_queue_.clear();
+    preintegrator_.clear();
     return;
   }
 
@@ -199,14 +157,18 @@ void GyroOdometer::callbackImu(const sensor_msgs::msg::Imu::ConstSharedPtr imu_m
     RCLCPP_ERROR(
       this->get_logger(), "Please publish TF %s to %s", output_frame_.c_str(),
       (imu_msg_ptr->header.frame_id).c_str());
-    vehicle_twist_queue_.clear();
-    gyro_queue_.clear();
+    preintegrator_.clear();
     return;
   }
 
+  sensor_msgs::msg::Imu imu_msg = *imu_msg_ptr;
+  if (imu_correction_param_.enable) {
+    correctImu(imu_msg);
+  }
+
   geometry_msgs::msg::Vector3Stamped angular_velocity;
-  angular_velocity.header = imu_msg_ptr->header;
-  angular_velocity.vector = imu_msg_ptr->angular_velocity;
+  angular_velocity.header = imu_msg.header;
+  angular_velocity.vector = imu_msg.angular_velocity;
 
   geometry_msgs::msg::Vector3Stamped transformed_angular_velocity;
   transformed_angular_velocity.header = tf_imu2base_ptr->header;
@@ -217,27 +179,67 @@ void GyroOdometer::callbackImu(const sensor_msgs::msg::Imu::ConstSharedPtr imu_m
   gyro_base_link.header.frame_id = output_frame_;
   gyro_base_link.angular_velocity = transformed_angular_velocity.vector;
   gyro_base_link.angular_velocity_covariance =
-    transformCovariance(imu_msg_ptr->angular_velocity_covariance);
+    transformCovariance(imu_msg.angular_velocity_covariance);
+  if (preintegrate_acceleration_) {
+    geometry_msgs::msg::Vector3Stamped linear_acceleration;
+    linear_acceleration.header = imu_msg.header;
+    linear_acceleration.vector = imu_msg.linear_acceleration;
+
+    geometry_msgs::msg::Vector3Stamped transformed_linear_acceleration;
+    transformed_linear_acceleration.header = tf_imu2base_ptr->header;
+    tf2::doTransform(linear_acceleration, transformed_linear_acceleration, *tf_imu2base_ptr);
+
+    gyro_base_link.linear_acceleration = transformed_linear_acceleration.vector;
+    gyro_base_link.linear_acceleration_covariance =
+      transformCovariance(imu_msg.linear_acceleration_covariance);
+  }
 
-  gyro_queue_.push_back(gyro_base_link);
+  preintegrator_.addImu(gyro_base_link);
 
-  if (vehicle_twist_queue_.empty()) return;
+  if (publish_at_imu_rate_) {
+    if (!preintegrator_.hasLatestVehicleTwist()) return;
+  } else if (preintegrator_.getVehicleTwistCount() == 0) {
+    return;
+  }
   const double twist_dt =
-    std::abs((this->now() - vehicle_twist_queue_.back().header.stamp).seconds());
+    std::abs((this->now() - preintegrator_.getLatestVehicleTwistStamp()).seconds());
   if (twist_dt > message_timeout_sec_) {
     const std::string error_msg = fmt::format(
       "Twist msg is timeout. twist_dt: {}[sec], tolerance {}[sec]", twist_dt, message_timeout_sec_);
     RCLCPP_ERROR_THROTTLE(this->get_logger(), *this->get_clock(), 1000, error_msg.c_str());
-    vehicle_twist_queue_.clear();
-    gyro_queue_.clear();
+    preintegrator_.clear();
+    return;
+  }
+
+  if (publish_at_imu_rate_) {
+    if (preintegrator_.getImuCount() < static_cast<size_t>(imu_batch_size_)) return;
+    publishData(preintegrator_.getPropagatedTwist(preintegrate_acceleration_));
+    preintegrator_.clearSamples();
     return;
   }
 
-  const geometry_msgs::msg::TwistWithCovarianceStamped twist_with_cov_raw =
-    concatGyroAndOdometer(vehicle_twist_queue_, gyro_queue_);
-  publishData(twist_with_cov_raw);
-  vehicle_twist_queue_.clear();
-  gyro_queue_.clear();
+  publishData(preintegrator_.getAveragedTwist());
+  preintegrator_.clearSamples();
+}
+
+void GyroOdometer::correctImu(sensor_msgs::msg::Imu & imu) const
+{
+  using COV_IDX = tier4_autoware_utils::xyz_covariance_index::XYZ_COV_IDX;
+
+  const auto & p = imu_correction_param_;
+  imu.angular_velocity.x -= p.angular_velocity_offset.x;
+  imu.angular_velocity.y -= p.angular_velocity_offset.y;
+  imu.angular_velocity.z -= p.angular_velocity_offset.z;
+
+  imu.angular_velocity_covariance[COV_IDX::X_X] =
+    p.angular_velocity_stddev.x * p.angular_velocity_stddev.x;
+  imu.angular_velocity_covariance[COV_IDX::Y_Y] =
+    p.angular_velocity_stddev.y * p.angular_velocity_stddev.y;
+  imu.angular_velocity_covariance[COV_IDX::Z_Z] =
+    p.angular_velocity_stddev.z * p.angular_velocity_stddev.z;
+  imu.linear_acceleration_covariance[COV_IDX::X_X] = p.acceleration_stddev * p.acceleration_stddev;
+  imu.linear_acceleration_covariance[COV_IDX::Y_Y] = p.acceleration_stddev * p.acceleration_stddev;
+  imu.linear_acceleration_covariance[COV_IDX::Z_Z] = p.acceleration_stddev * p.acceleration_stddev;
 }
 
 void GyroOdometer::publishData(
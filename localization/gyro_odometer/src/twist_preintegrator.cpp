@@ -0,0 +1,129 @@
+// Copyright 2023 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gyro_odometer/twist_preintegrator.hpp"
+
+#include "tier4_autoware_utils/ros/msg_covariance.hpp"
+
+void TwistPreintegrator::addVehicleTwist(
+  const geometry_msgs::msg::TwistWithCovarianceStamped & vehicle_twist)
+{
+  using COV_IDX_XYZRPY = tier4_autoware_utils::xyzrpy_covariance_index::XYZRPY_COV_IDX;
+
+  ++vehicle_twist_count_;
+  vx_sum_ += vehicle_twist.twist.twist.linear.x;
+  vx_covariance_sum_ += vehicle_twist.twist.covariance[COV_IDX_XYZRPY::X_X];
+
+  has_latest_vehicle_twist_ = true;
+  latest_vx_ = vehicle_twist.twist.twist.linear.x;
+  latest_vx_covariance_ = vehicle_twist.twist.covariance[COV_IDX_XYZRPY::X_X];
+  latest_vehicle_twist_stamp_ = rclcpp::Time(vehicle_twist.header.stamp);
+
+  // the acceleration is integrated again from the new vehicle twist
+  integrated_stamp_ = latest_vehicle_twist_stamp_;
+  integrated_vx_ = 0.0;
+  integrated_vx_covariance_ = 0.0;
+}
+
+void TwistPreintegrator::addImu(const sensor_msgs::msg::Imu & imu)
+{
+  using COV_IDX_XYZ = tier4_autoware_utils::xyz_covariance_index::XYZ_COV_IDX;
+
+  if (imu_count_ == 0) {
+    imu_frame_id_ = imu.header.frame_id;
+  }
+  ++imu_count_;
+  gyro_sum_.x += imu.angular_velocity.x;
+  gyro_sum_.y += imu.angular_velocity.y;
+  gyro_sum_.z += imu.angular_velocity.z;
+  gyro_covariance_sum_.x += imu.angular_velocity_covariance[COV_IDX_XYZ::X_X];
+  gyro_covariance_sum_.y += imu.angular_velocity_covariance[COV_IDX_XYZ::Y_Y];
+  gyro_covariance_sum_.z += imu.angular_velocity_covariance[COV_IDX_XYZ::Z_Z];
+  latest_imu_stamp_ = rclcpp::Time(imu.header.stamp);
+
+  // zero-order hold of the acceleration over the interval ending at the imu stamp
+  if (has_latest_vehicle_twist_ && integrated_stamp_ < latest_imu_stamp_) {
+    const double dt = (latest_imu_stamp_ - integrated_stamp_).seconds();
+    integrated_vx_ += imu.linear_acceleration.x * dt;
+    integrated_vx_covariance_ += imu.linear_acceleration_covariance[COV_IDX_XYZ::X_X] * dt * dt;
+    integrated_stamp_ = latest_imu_stamp_;
+  }
+}
+
+geometry_msgs::msg::TwistWithCovarianceStamped TwistPreintegrator::getAveragedTwist() const
+{
+  using COV_IDX_XYZRPY = tier4_autoware_utils::xyzrpy_covariance_index::XYZRPY_COV_IDX;
+
+  const double vx_mean = vx_sum_ / vehicle_twist_count_;
+  const double vx_covariance_original = vx_covariance_sum_ / vehicle_twist_count_;
+
+  geometry_msgs::msg::TwistWithCovarianceStamped twist_with_cov = getPropagatedTwist(false);
+  if (latest_imu_stamp_ < latest_vehicle_twist_stamp_) {
+    twist_with_cov.header.stamp = latest_vehicle_twist_stamp_;
+  }
+  twist_with_cov.twist.twist.linear.x = vx_mean;
+
+  // From a statistical point of view, here we reduce the covariances according to the number of
+  // observed data
+  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::X_X] =
+    vx_covariance_original / vehicle_twist_count_;
+  return twist_with_cov;
+}
+
+geometry_msgs::msg::TwistWithCovarianceStamped TwistPreintegrator::getPropagatedTwist(
+  const bool preintegrate_acceleration) const
+{
+  using COV_IDX_XYZRPY = tier4_autoware_utils::xyzrpy_covariance_index::XYZRPY_COV_IDX;
+
+  geometry_msgs::msg::Vector3 gyro_mean{};
+  gyro_mean.x = gyro_sum_.x / imu_count_;
+  gyro_mean.y = gyro_sum_.y / imu_count_;
+  gyro_mean.z = gyro_sum_.z / imu_count_;
+
+  geometry_msgs::msg::TwistWithCovarianceStamped twist_with_cov;
+  twist_with_cov.header.stamp = latest_imu_stamp_;
+  twist_with_cov.header.frame_id = imu_frame_id_;
+  twist_with_cov.twist.twist.linear.x =
+    preintegrate_acceleration ? latest_vx_ + integrated_vx_ : latest_vx_;
+  twist_with_cov.twist.twist.angular = gyro_mean;
+
+  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::X_X] =
+    preintegrate_acceleration ? latest_vx_covariance_ + integrated_vx_covariance_
+                              : latest_vx_covariance_;
+  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::Y_Y] = 100000.0;
+  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::Z_Z] = 100000.0;
+  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::ROLL_ROLL] =
+    gyro_covariance_sum_.x / imu_count_ / imu_count_;
+  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::PITCH_PITCH] =
+    gyro_covariance_sum_.y / imu_count_ / imu_count_;
+  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::YAW_YAW] =
+    gyro_covariance_sum_.z / imu_count_ / imu_count_;
+  return twist_with_cov;
+}
+
+void TwistPreintegrator::clearSamples()
+{
+  vehicle_twist_count_ = 0;
+  vx_sum_ = 0.0;
+  vx_covariance_sum_ = 0.0;
+  imu_count_ = 0;
+  gyro_sum_ = geometry_msgs::msg::Vector3{};
+  gyro_covariance_sum_ = geometry_msgs::msg::Vector3{};
+}
+
+void TwistPreintegrator::clear()
+{
+  clearSamples();
+  has_latest_vehicle_twist_ = false;
+}
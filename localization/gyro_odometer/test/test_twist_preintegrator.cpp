@@ -0,0 +1,102 @@
+// Copyright 2023 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gyro_odometer/twist_preintegrator.hpp"
+
+#include <gtest/gtest.h>
+
+using geometry_msgs::msg::TwistWithCovarianceStamped;
+using sensor_msgs::msg::Imu;
+
+namespace
+{
+TwistWithCovarianceStamped makeVehicleTwist(
+  const double vx, const double covariance, const int32_t sec, const uint32_t nanosec)
+{
+  TwistWithCovarianceStamped twist;
+  twist.header.stamp.sec = sec;
+  twist.header.stamp.nanosec = nanosec;
+  twist.header.frame_id = "base_link";
+  twist.twist.twist.linear.x = vx;
+  twist.twist.covariance[0] = covariance;
+  return twist;
+}
+
+Imu makeImu(const double wz, const double ax, const int32_t sec, const uint32_t nanosec)
+{
+  Imu imu;
+  imu.header.stamp.sec = sec;
+  imu.header.stamp.nanosec = nanosec;
+  imu.header.frame_id = "base_link";
+  imu.angular_velocity.z = wz;
+  imu.angular_velocity_covariance[8] = 0.04;
+  imu.linear_acceleration.x = ax;
+  imu.linear_acceleration_covariance[0] = 1.0;
+  return imu;
+}
+}  // namespace
+
+TEST(TwistPreintegrator, AveragedTwist)
+{
+  TwistPreintegrator preintegrator;
+  preintegrator.addVehicleTwist(makeVehicleTwist(1.0, 0.2, 1, 0));
+  preintegrator.addVehicleTwist(makeVehicleTwist(3.0, 0.4, 1, 100000000));
+  preintegrator.addImu(makeImu(0.1, 0.0, 1, 50000000));
+  preintegrator.addImu(makeImu(0.3, 0.0, 1, 60000000));
+  ASSERT_EQ(preintegrator.getVehicleTwistCount(), 2U);
+  ASSERT_EQ(preintegrator.getImuCount(), 2U);
+
+  const auto twist = preintegrator.getAveragedTwist();
+  EXPECT_DOUBLE_EQ(twist.twist.twist.linear.x, 2.0);
+  EXPECT_DOUBLE_EQ(twist.twist.twist.angular.z, 0.2);
+  // the covariances are reduced according to the number of samples
+  EXPECT_DOUBLE_EQ(twist.twist.covariance[0], 0.15);
+  EXPECT_DOUBLE_EQ(twist.twist.covariance[35], 0.02);
+  // stamped with the latest message
+  EXPECT_EQ(twist.header.stamp.nanosec, 100000000U);
+
+  preintegrator.clearSamples();
+  EXPECT_EQ(preintegrator.getVehicleTwistCount(), 0U);
+  EXPECT_EQ(preintegrator.getImuCount(), 0U);
+  EXPECT_TRUE(preintegrator.hasLatestVehicleTwist());
+
+  preintegrator.clear();
+  EXPECT_FALSE(preintegrator.hasLatestVehicleTwist());
+}
+
+TEST(TwistPreintegrator, PropagatedTwist)
+{
+  TwistPreintegrator preintegrator;
+  preintegrator.addVehicleTwist(makeVehicleTwist(1.0, 0.2, 1, 0));
+  preintegrator.addImu(makeImu(0.1, 2.0, 1, 10000000));
+  preintegrator.clearSamples();
+
+  // the vehicle twist is kept, and the acceleration is integrated since the vehicle twist
+  preintegrator.addImu(makeImu(0.3, 4.0, 1, 20000000));
+  const auto twist = preintegrator.getPropagatedTwist(true);
+  EXPECT_DOUBLE_EQ(twist.twist.twist.linear.x, 1.0 + 2.0 * 0.01 + 4.0 * 0.01);
+  EXPECT_NEAR(twist.twist.covariance[0], 0.2 + 2.0 * 0.01 * 0.01, 1e-12);
+  EXPECT_DOUBLE_EQ(twist.twist.twist.angular.z, 0.3);
+  EXPECT_EQ(twist.header.stamp.nanosec, 20000000U);
+
+  const auto twist_without_acceleration = preintegrator.getPropagatedTwist(false);
+  EXPECT_DOUBLE_EQ(twist_without_acceleration.twist.twist.linear.x, 1.0);
+  EXPECT_DOUBLE_EQ(twist_without_acceleration.twist.covariance[0], 0.2);
+
+  // the integration restarts from a new vehicle twist
+  preintegrator.addVehicleTwist(makeVehicleTwist(5.0, 0.2, 1, 25000000));
+  preintegrator.addImu(makeImu(0.3, 4.0, 1, 30000000));
+  EXPECT_NEAR(
+    preintegrator.getPropagatedTwist(true).twist.twist.linear.x, 5.0 + 4.0 * 0.005, 1e-12);
+}
@@ -33,10 +33,13 @@
 #include <multigrid_pclomp/multigrid_ndt_omp.h>
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 class MapUpdateModule
@@ -49,7 +52,7 @@ class MapUpdateModule
 public:
   MapUpdateModule(
     rclcpp::Node * node, std::mutex * ndt_ptr_mutex,
-    std::shared_ptr<NormalDistributionsTransform> ndt_ptr,
+    std::shared_ptr<NormalDistributionsTransform> & ndt_ptr,
     std::shared_ptr<Tf2ListenerModule> tf2_listener_module, std::string map_frame,
     rclcpp::CallbackGroup::SharedPtr main_callback_group,
     std::shared_ptr<std::map<std::string, std::string>> state_ptr);
@@ -63,6 +66,11 @@ private:
     const std::vector<autoware_map_msgs::msg::PointCloudMapCellWithID> & maps_to_add,
     const std::vector<std::string> & map_ids_to_remove);
   void update_map(const geometry_msgs::msg::Point & position);
+  void request_map_update(const geometry_msgs::msg::Point & position);
+  [[nodiscard]] std::shared_ptr<autoware_map_msgs::srv::GetDifferentialPointCloudMap::Request>
+  create_map_request(const geometry_msgs::msg::Point & position) const;
+  [[nodiscard]] geometry_msgs::msg::Point predict_position(
+    const geometry_msgs::msg::Point & position) const;
   [[nodiscard]] bool should_update_map(const geometry_msgs::msg::Point & position) const;
   void publish_partial_pcd_map();
 
@@ -76,8 +84,17 @@ private:
 
   rclcpp::CallbackGroup::SharedPtr map_callback_group_;
 
-  std::shared_ptr<NormalDistributionsTransform> ndt_ptr_;
+  // the pointer owned by NDTScanMatcher, which is swapped with secondary_ndt_ptr_ on update
+  std::shared_ptr<NormalDistributionsTransform> & ndt_ptr_;
   std::mutex * ndt_ptr_mutex_;
+  // updated while ndt_ptr_ is used for the alignment, it lags one update behind ndt_ptr_
+  std::shared_ptr<NormalDistributionsTransform> secondary_ndt_ptr_;
+  std::vector<std::pair<std::string, pcl::shared_ptr<pcl::PointCloud<PointTarget>>>>
+    last_maps_to_add_;
+  std::vector<std::string> last_map_ids_to_remove_;
+  // serializes the updates of the timer and of the align service
+  std::mutex update_ndt_mutex_;
+  std::atomic<bool> is_map_update_requested_{false};
   std::string map_frame_;
   rclcpp::Logger logger_;
   rclcpp::Clock::SharedPtr clock_;
@@ -86,9 +103,12 @@ private:
 
   std::optional<geometry_msgs::msg::Point> last_update_position_ = std::nullopt;
   std::optional<geometry_msgs::msg::Point> current_position_ = std::nullopt;
+  // velocity in the map frame
+  geometry_msgs::msg::Vector3 current_velocity_;
   const double dynamic_map_loading_update_distance_;
   const double dynamic_map_loading_map_radius_;
   const double lidar_radius_;
+  const double dynamic_map_loading_prefetch_time_;
 };
 
 #endif  // NDT_SCAN_MATCHER__MAP_UPDATE_MODULE_HPP_
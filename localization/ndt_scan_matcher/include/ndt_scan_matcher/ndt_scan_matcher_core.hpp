@@ -181,6 +181,7 @@ private:
 
   int initial_estimate_particles_num_;
   int n_startup_trials_;
+  int initial_estimate_particles_batch_size_;
   double lidar_topic_timeout_sec_;
   double initial_pose_timeout_sec_;
   double initial_pose_distance_tolerance_m_;
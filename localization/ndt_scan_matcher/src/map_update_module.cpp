@@ -14,6 +14,11 @@
 
 #include "ndt_scan_matcher/map_update_module.hpp"
 
+#include <tf2/utils.h>
+
+#include <algorithm>
+#include <cmath>
+
 template <typename T, typename U>
 double norm_xy(const T p1, const U p2)
 {
@@ -24,12 +29,13 @@ double norm_xy(const T p1, const U p2)
 
 MapUpdateModule::MapUpdateModule(
   rclcpp::Node * node, std::mutex * ndt_ptr_mutex,
-  std::shared_ptr<NormalDistributionsTransform> ndt_ptr,
+  std::shared_ptr<NormalDistributionsTransform> & ndt_ptr,
   std::shared_ptr<Tf2ListenerModule> tf2_listener_module, std::string map_frame,
   rclcpp::CallbackGroup::SharedPtr main_callback_group,
   std::shared_ptr<std::map<std::string, std::string>> state_ptr)
-: ndt_ptr_(std::move(ndt_ptr)),
+: ndt_ptr_(ndt_ptr),
   ndt_ptr_mutex_(ndt_ptr_mutex),
+  secondary_ndt_ptr_(std::make_shared<NormalDistributionsTransform>(*ndt_ptr)),
   map_frame_(std::move(map_frame)),
   logger_(node->get_logger()),
   clock_(node->get_clock()),
@@ -39,7 +45,9 @@ MapUpdateModule::MapUpdateModule(
     node->declare_parameter<double>("dynamic_map_loading_update_distance")),
   dynamic_map_loading_map_radius_(
     node->declare_parameter<double>("dynamic_map_loading_map_radius")),
-  lidar_radius_(node->declare_parameter<double>("lidar_radius"))
+  lidar_radius_(node->declare_parameter<double>("lidar_radius")),
+  dynamic_map_loading_prefetch_time_(
+    node->declare_parameter<double>("dynamic_map_loading_prefetch_time"))
 {
   auto main_sub_opt = rclcpp::SubscriptionOptions();
   main_sub_opt.callback_group = main_callback_group;
@@ -67,6 +75,10 @@ MapUpdateModule::MapUpdateModule(
 void MapUpdateModule::callback_ekf_odom(nav_msgs::msg::Odometry::ConstSharedPtr odom_ptr)
 {
   current_position_ = odom_ptr->pose.pose.position;
+  const double yaw = tf2::getYaw(odom_ptr->pose.pose.orientation);
+  const auto & linear = odom_ptr->twist.twist.linear;
+  current_velocity_.x = linear.x * std::cos(yaw) - linear.y * std::sin(yaw);
+  current_velocity_.y = linear.x * std::sin(yaw) + linear.y * std::cos(yaw);
 
   if (last_update_position_ == std::nullopt) {
     return;
@@ -88,6 +100,16 @@ void MapUpdateModule::map_update_timer_callback()
   }
   if (last_update_position_ == std::nullopt) return;
 
+  // prefetch the cells ahead without blocking until they are loaded
+  if (dynamic_map_loading_prefetch_time_ > 0.0) {
+    const auto predicted_position = predict_position(current_position_.value());
+    if (!is_map_update_requested_ && should_update_map(predicted_position)) {
+      RCLCPP_INFO(logger_, "Request NDT map update ahead (timer_callback)");
+      request_map_update(predicted_position);
+    }
+    return;
+  }
+
   // continue only if we should update the map
   if (should_update_map(current_position_.value())) {
     RCLCPP_INFO(logger_, "Start updating NDT map (timer_callback)");
@@ -96,6 +118,26 @@ void MapUpdateModule::map_update_timer_callback()
   }
 }
 
+geometry_msgs::msg::Point MapUpdateModule::predict_position(
+  const geometry_msgs::msg::Point & position) const
+{
+  double dx = current_velocity_.x * dynamic_map_loading_prefetch_time_;
+  double dy = current_velocity_.y * dynamic_map_loading_prefetch_time_;
+
+  // the lidar range around the current position should stay inside the requested map
+  const double max_shift = std::max(dynamic_map_loading_map_radius_ - lidar_radius_, 0.0);
+  const double shift = std::hypot(dx, dy);
+  if (shift > max_shift) {
+    dx *= max_shift / shift;
+    dy *= max_shift / shift;
+  }
+
+  geometry_msgs::msg::Point predicted_position = position;
+  predicted_position.x += dx;
+  predicted_position.y += dy;
+  return predicted_position;
+}
+
 bool MapUpdateModule::should_update_map(const geometry_msgs::msg::Point & position) const
 {
   if (last_update_position_ == std::nullopt) return false;
@@ -103,13 +145,42 @@ bool MapUpdateModule::should_update_map(const geometry_msgs::msg::Point & positi
   return distance > dynamic_map_loading_update_distance_;
 }
 
-void MapUpdateModule::update_map(const geometry_msgs::msg::Point & position)
+std::shared_ptr<autoware_map_msgs::srv::GetDifferentialPointCloudMap::Request>
+MapUpdateModule::create_map_request(const geometry_msgs::msg::Point & position) const
 {
   auto request = std::make_shared<autoware_map_msgs::srv::GetDifferentialPointCloudMap::Request>();
   request->area.center_x = static_cast<float>(position.x);
   request->area.center_y = static_cast<float>(position.y);
   request->area.radius = static_cast<float>(dynamic_map_loading_map_radius_);
   request->cached_ids = ndt_ptr_->getCurrentMapIDs();
+  return request;
+}
+
+void MapUpdateModule::request_map_update(const geometry_msgs::msg::Point & position)
+{
+  if (!pcd_loader_client_->service_is_ready()) {
+    RCLCPP_INFO_THROTTLE(
+      logger_, *clock_, 1000,
+      "Waiting for pcd loader service. Check if the enable_differential_load in "
+      "pointcloud_map_loader is set `true`.");
+    return;
+  }
+
+  // the response is handled in the callback group of the client, not in the timer
+  is_map_update_requested_ = true;
+  pcd_loader_client_->async_send_request(
+    create_map_request(position),
+    [this, position](
+      rclcpp::Client<autoware_map_msgs::srv::GetDifferentialPointCloudMap>::SharedFuture result) {
+      update_ndt(result.get()->new_pointcloud_with_ids, result.get()->ids_to_remove);
+      last_update_position_ = position;
+      is_map_update_requested_ = false;
+    });
+}
+
+void MapUpdateModule::update_map(const geometry_msgs::msg::Point & position)
+{
+  auto request = create_map_request(position);
 
   while (!pcd_loader_client_->wait_for_service(std::chrono::seconds(1)) && rclcpp::ok()) {
     RCLCPP_INFO(
@@ -139,6 +210,7 @@ void MapUpdateModule::update_ndt(
   const std::vector<autoware_map_msgs::msg::PointCloudMapCellWithID> & maps_to_add,
   const std::vector<std::string> & map_ids_to_remove)
 {
+  std::lock_guard<std::mutex> lock(update_ndt_mutex_);
   RCLCPP_INFO(
     logger_, "Update map (Add: %lu, Remove: %lu)", maps_to_add.size(), map_ids_to_remove.size());
   if (maps_to_add.empty() && map_ids_to_remove.empty()) {
@@ -147,21 +219,30 @@ void MapUpdateModule::update_ndt(
   }
   const auto exe_start_time = std::chrono::system_clock::now();
 
-  NormalDistributionsTransform backup_ndt = *ndt_ptr_;
+  // catch up with the previous update, which only the current ndt has
+  for (const auto & [map_id, map_points_ptr] : last_maps_to_add_) {
+    secondary_ndt_ptr_->addTarget(map_points_ptr, map_id);
+  }
+  for (const std::string & map_id_to_remove : last_map_ids_to_remove_) {
+    secondary_ndt_ptr_->removeTarget(map_id_to_remove);
+  }
 
   // Add pcd
+  last_maps_to_add_.clear();
   for (const auto & map_to_add : maps_to_add) {
     pcl::shared_ptr<pcl::PointCloud<PointTarget>> map_points_ptr(new pcl::PointCloud<PointTarget>);
     pcl::fromROSMsg(map_to_add.pointcloud, *map_points_ptr);
-    backup_ndt.addTarget(map_points_ptr, map_to_add.cell_id);
+    secondary_ndt_ptr_->addTarget(map_points_ptr, map_to_add.cell_id);
+    last_maps_to_add_.emplace_back(map_to_add.cell_id, map_points_ptr);
   }
 
   // Remove pcd
   for (const std::string & map_id_to_remove : map_ids_to_remove) {
-    backup_ndt.removeTarget(map_id_to_remove);
+    secondary_ndt_ptr_->removeTarget(map_id_to_remove);
   }
+  last_map_ids_to_remove_ = map_ids_to_remove;
 
-  backup_ndt.createVoxelKdtree();
+  secondary_ndt_ptr_->createVoxelKdtree();
 
   const auto exe_end_time = std::chrono::system_clock::now();
   const auto duration_micro_sec =
@@ -169,12 +250,9 @@ void MapUpdateModule::update_ndt(
   const auto exe_time = static_cast<double>(duration_micro_sec) / 1000.0;
   RCLCPP_INFO(logger_, "Time duration for creating new ndt_ptr: %lf [ms]", exe_time);
 
-  // swap
+  // swap, the previous ndt is updated on the next call
   (*ndt_ptr_mutex_).lock();
-  // ToDo (kminoda): Here negligible NDT copy occurs during the new map loading phase, which should
-  // ideally be avoided. But I will leave this for now since I cannot come up with a solution other
-  // than using pointer of pointer.
-  *ndt_ptr_ = backup_ndt;
+  ndt_ptr_.swap(secondary_ndt_ptr_);
   (*ndt_ptr_mutex_).unlock();
 
   publish_partial_pcd_map();
@@ -149,6 +149,8 @@ NDTScanMatcher::NDTScanMatcher()
 
   initial_estimate_particles_num_ = this->declare_parameter<int>("initial_estimate_particles_num");
   n_startup_trials_ = this->declare_parameter<int>("n_startup_trials");
+  initial_estimate_particles_batch_size_ =
+    std::max(this->declare_parameter<int>("initial_estimate_particles_batch_size"), 1);
 
   estimate_scores_for_degrounded_scan_ =
     this->declare_parameter<bool>("estimate_scores_for_degrounded_scan");
@@ -393,15 +395,20 @@ void NDTScanMatcher::callback_sensor_points(
   const auto exe_start_time = std::chrono::system_clock::now();
 
   // preprocess input pointcloud
-  pcl::shared_ptr<pcl::PointCloud<PointSource>> sensor_points_in_sensor_frame(
-    new pcl::PointCloud<PointSource>);
   pcl::shared_ptr<pcl::PointCloud<PointSource>> sensor_points_in_baselink_frame(
     new pcl::PointCloud<PointSource>);
   const std::string & sensor_frame = sensor_points_msg_in_sensor_frame->header.frame_id;
 
-  pcl::fromROSMsg(*sensor_points_msg_in_sensor_frame, *sensor_points_in_sensor_frame);
-  transform_sensor_measurement(
-    sensor_frame, base_frame_, sensor_points_in_sensor_frame, sensor_points_in_baselink_frame);
+  // the points already transformed by the preprocessing are used as they are
+  if (sensor_frame == base_frame_) {
+    pcl::fromROSMsg(*sensor_points_msg_in_sensor_frame, *sensor_points_in_baselink_frame);
+  } else {
+    pcl::shared_ptr<pcl::PointCloud<PointSource>> sensor_points_in_sensor_frame(
+      new pcl::PointCloud<PointSource>);
+    pcl::fromROSMsg(*sensor_points_msg_in_sensor_frame, *sensor_points_in_sensor_frame);
+    transform_sensor_measurement(
+      sensor_frame, base_frame_, sensor_points_in_sensor_frame, sensor_points_in_baselink_frame);
+  }
   ndt_ptr_->setInputSource(sensor_points_in_baselink_frame);
   if (!is_activated_) return;
 
@@ -818,64 +825,99 @@ geometry_msgs::msg::PoseWithCovarianceStamped NDTScanMatcher::align_pose(
     TreeStructuredParzenEstimator::Direction::MAXIMIZE, n_startup_trials_, is_loop_variable);
 
   std::vector<Particle> particle_array;
-  auto output_cloud = std::make_shared<pcl::PointCloud<PointSource>>();
 
-  for (int i = 0; i < initial_estimate_particles_num_; i++) {
-    const TreeStructuredParzenEstimator::Input input = tpe.get_next_input();
-
-    geometry_msgs::msg::Pose initial_pose;
-    initial_pose.position.x =
-      initial_pose_with_cov.pose.pose.position.x + uniform_to_normal(input[0]) * stddev_x;
-    initial_pose.position.y =
-      initial_pose_with_cov.pose.pose.position.y + uniform_to_normal(input[1]) * stddev_y;
-    initial_pose.position.z =
-      initial_pose_with_cov.pose.pose.position.z + uniform_to_normal(input[2]) * stddev_z;
-    geometry_msgs::msg::Vector3 init_rpy;
-    init_rpy.x = base_rpy.x + uniform_to_normal(input[3]) * stddev_roll;
-    init_rpy.y = base_rpy.y + uniform_to_normal(input[4]) * stddev_pitch;
-    init_rpy.z = base_rpy.z + input[5] * M_PI;
-    tf2::Quaternion tf_quaternion;
-    tf_quaternion.setRPY(init_rpy.x, init_rpy.y, init_rpy.z);
-    initial_pose.orientation = tf2::toMsg(tf_quaternion);
-
-    const Eigen::Matrix4f initial_pose_matrix = pose_to_matrix4f(initial_pose);
-    ndt_ptr_->align(*output_cloud, initial_pose_matrix);
-    const pclomp::NdtResult ndt_result = ndt_ptr_->getResult();
-
-    Particle particle(
-      initial_pose, matrix4f_to_pose(ndt_result.pose), ndt_result.transform_probability,
-      ndt_result.iteration_num);
-    particle_array.push_back(particle);
-    const auto marker_array = make_debug_markers(
-      get_clock()->now(), map_frame_, tier4_autoware_utils::createMarkerScale(0.3, 0.1, 0.1),
-      particle, i);
-    ndt_monte_carlo_initial_pose_marker_pub_->publish(marker_array);
-
-    const geometry_msgs::msg::Pose pose = matrix4f_to_pose(ndt_result.pose);
-    const geometry_msgs::msg::Vector3 rpy = get_rpy(pose);
-
-    const double diff_x = pose.position.x - initial_pose_with_cov.pose.pose.position.x;
-    const double diff_y = pose.position.y - initial_pose_with_cov.pose.pose.position.y;
-    const double diff_z = pose.position.z - initial_pose_with_cov.pose.pose.position.z;
-    const double diff_roll = rpy.x - base_rpy.x;
-    const double diff_pitch = rpy.y - base_rpy.y;
-    const double diff_yaw = rpy.z - base_rpy.z;
-
-    // Only yaw is a loop_variable, so only simple normalization is performed.
-    // All other variables are converted from normal distribution to uniform distribution.
-    TreeStructuredParzenEstimator::Input result(is_loop_variable.size());
-    result[0] = normal_to_uniform(diff_x / stddev_x);
-    result[1] = normal_to_uniform(diff_y / stddev_y);
-    result[2] = normal_to_uniform(diff_z / stddev_z);
-    result[3] = normal_to_uniform(diff_roll / stddev_roll);
-    result[4] = normal_to_uniform(diff_pitch / stddev_pitch);
-    result[5] = diff_yaw / M_PI;
-    tpe.add_trial(TreeStructuredParzenEstimator::Trial{result, ndt_result.transform_probability});
-
-    auto sensor_points_in_map_ptr = std::make_shared<pcl::PointCloud<PointSource>>();
-    tier4_autoware_utils::transformPointCloud(
-      *ndt_ptr_->getInputSource(), *sensor_points_in_map_ptr, ndt_result.pose);
-    publish_point_cloud(initial_pose_with_cov.header.stamp, map_frame_, sensor_points_in_map_ptr);
+  // the particles of a batch are aligned in parallel on copies of the NDT sharing its threads
+  const int batch_size =
+    std::min(initial_estimate_particles_batch_size_, initial_estimate_particles_num_);
+  std::vector<std::shared_ptr<NormalDistributionsTransform>> batch_ndt_ptrs{ndt_ptr_};
+  if (batch_size > 1) {
+    pclomp::NdtParams batch_ndt_params = ndt_ptr_->getParams();
+    batch_ndt_params.num_threads = std::max(batch_ndt_params.num_threads / batch_size, 1);
+    batch_ndt_ptrs.clear();
+    for (int j = 0; j < batch_size; j++) {
+      batch_ndt_ptrs.push_back(std::make_shared<NormalDistributionsTransform>(*ndt_ptr_));
+      batch_ndt_ptrs.back()->setParams(batch_ndt_params);
+    }
+  }
+
+  for (int i = 0; i < initial_estimate_particles_num_; i += batch_size) {
+    const int current_batch_size = std::min(batch_size, initial_estimate_particles_num_ - i);
+
+    // the proposals of a batch are drawn from the same trials
+    std::vector<geometry_msgs::msg::Pose> initial_poses(current_batch_size);
+    for (auto & initial_pose : initial_poses) {
+      const TreeStructuredParzenEstimator::Input input = tpe.get_next_input();
+
+      initial_pose.position.x =
+        initial_pose_with_cov.pose.pose.position.x + uniform_to_normal(input[0]) * stddev_x;
+      initial_pose.position.y =
+        initial_pose_with_cov.pose.pose.position.y + uniform_to_normal(input[1]) * stddev_y;
+      initial_pose.position.z =
+        initial_pose_with_cov.pose.pose.position.z + uniform_to_normal(input[2]) * stddev_z;
+      geometry_msgs::msg::Vector3 init_rpy;
+      init_rpy.x = base_rpy.x + uniform_to_normal(input[3]) * stddev_roll;
+      init_rpy.y = base_rpy.y + uniform_to_normal(input[4]) * stddev_pitch;
+      init_rpy.z = base_rpy.z + input[5] * M_PI;
+      tf2::Quaternion tf_quaternion;
+      tf_quaternion.setRPY(init_rpy.x, init_rpy.y, init_rpy.z);
+      initial_pose.orientation = tf2::toMsg(tf_quaternion);
+    }
+
+    std::vector<pclomp::NdtResult> ndt_results(current_batch_size);
+    const auto align = [&](const int j) {
+      auto output_cloud = std::make_shared<pcl::PointCloud<PointSource>>();
+      batch_ndt_ptrs.at(j)->align(*output_cloud, pose_to_matrix4f(initial_poses.at(j)));
+      ndt_results.at(j) = batch_ndt_ptrs.at(j)->getResult();
+    };
+    std::vector<std::thread> align_threads;
+    for (int j = 1; j < current_batch_size; j++) {
+      align_threads.emplace_back(align, j);
+    }
+    align(0);
+    for (auto & align_thread : align_threads) {
+      align_thread.join();
+    }
+
+    for (int j = 0; j < current_batch_size; j++) {
+      const pclomp::NdtResult & ndt_result = ndt_results.at(j);
+
+      Particle particle(
+        initial_poses.at(j), matrix4f_to_pose(ndt_result.pose), ndt_result.transform_probability,
+        ndt_result.iteration_num);
+      particle_array.push_back(particle);
+      const auto marker_array = make_debug_markers(
+        get_clock()->now(), map_frame_, tier4_autoware_utils::createMarkerScale(0.3, 0.1, 0.1),
+        particle, i + j);
+      ndt_monte_carlo_initial_pose_marker_pub_->publish(marker_array);
+
+      const geometry_msgs::msg::Pose pose = matrix4f_to_pose(ndt_result.pose);
+      const geometry_msgs::msg::Vector3 rpy = get_rpy(pose);
+
+      const double diff_x = pose.position.x - initial_pose_with_cov.pose.pose.position.x;
+      const double diff_y = pose.position.y - initial_pose_with_cov.pose.pose.position.y;
+      const double diff_z = pose.position.z - initial_pose_with_cov.pose.pose.position.z;
+      const double diff_roll = rpy.x - base_rpy.x;
+      const double diff_pitch = rpy.y - base_rpy.y;
+      const double diff_yaw = rpy.z - base_rpy.z;
+
+      // Only yaw is a loop_variable, so only simple normalization is performed.
+      // All other variables are converted from normal distribution to uniform distribution.
+      TreeStructuredParzenEstimator::Input result(is_loop_variable.size());
+      result[0] = normal_to_uniform(diff_x / stddev_x);
+      result[1] = normal_to_uniform(diff_y / stddev_y);
+      result[2] = normal_to_uniform(diff_z / stddev_z);
+      result[3] = normal_to_uniform(diff_roll / stddev_roll);
+      result[4] = normal_to_uniform(diff_pitch / stddev_pitch);
+      result[5] = diff_yaw / M_PI;
+      tpe.add_trial(
+        TreeStructuredParzenEstimator::Trial{result, ndt_result.transform_probability});
+
+      auto sensor_points_in_map_ptr = std::make_shared<pcl::PointCloud<PointSource>>();
+      tier4_autoware_utils::transformPointCloud(
+        *ndt_ptr_->getInputSource(), *sensor_points_in_map_ptr, ndt_result.pose);
+      publish_point_cloud(
+        initial_pose_with_cov.header.stamp, map_frame_, sensor_points_in_map_ptr);
+    }
   }
 
   auto best_particle_ptr = std::max_element(
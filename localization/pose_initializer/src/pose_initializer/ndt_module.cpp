@@ -29,6 +29,11 @@ NdtModule::NdtModule(rclcpp::Node * node) : logger_(node->get_logger())
 }
 
 PoseWithCovarianceStamped NdtModule::align_pose(const PoseWithCovarianceStamped & pose)
+{
+  return get_aligned_pose(send_align_request(pose));
+}
+
+NdtModule::AlignFuture NdtModule::send_align_request(const PoseWithCovarianceStamped & pose)
 {
   const auto req = std::make_shared<RequestPoseAlignment::Request>();
   req->pose_with_covariance = pose;
@@ -38,7 +43,12 @@ PoseWithCovarianceStamped NdtModule::align_pose(const PoseWithCovarianceStamped
   }
 
   RCLCPP_INFO(logger_, "Call NDT align server.");
-  const auto res = cli_align_->async_send_request(req).get();
+  return cli_align_->async_send_request(req).share();
+}
+
+PoseWithCovarianceStamped NdtModule::get_aligned_pose(const AlignFuture & future)
+{
+  const auto res = future.get();
   if (!res->success) {
     RCLCPP_INFO(logger_, "NDT align server failed.");
     throw ServiceException(
@@ -22,7 +22,11 @@
 #include "stop_check_module.hpp"
 #include "yabloc_module.hpp"
 
+#include <chrono>
+#include <exception>
+#include <future>
 #include <memory>
+#include <optional>
 #include <vector>
 
 PoseInitializer::PoseInitializer() : Node("pose_initializer")
@@ -49,6 +53,7 @@ PoseInitializer::PoseInitializer() : Node("pose_initializer")
     ndt_ = std::make_unique<NdtModule>(this);
     ndt_localization_trigger_ = std::make_unique<NdtLocalizationTriggerModule>(this);
   }
+  parallel_alignment_ = declare_parameter<bool>("parallel_alignment", false);
   if (declare_parameter<bool>("stop_check_enabled")) {
     // Add 1.0 sec margin for twist buffer.
     stop_check_duration_ = declare_parameter<double>("stop_check_duration");
@@ -88,7 +93,9 @@ void PoseInitializer::on_initialize(
       ndt_localization_trigger_->send_request(false);
     }
     auto pose = req->pose.empty() ? get_gnss_pose() : req->pose.front();
-    if (ndt_) {
+    if (ndt_ && yabloc_ && parallel_alignment_) {
+      pose = align_pose_in_parallel(pose);
+    } else if (ndt_) {
       pose = ndt_->align_pose(pose);
     } else if (yabloc_) {
       // If both the NDT and YabLoc initializer are enabled, prioritize NDT as it offers more
@@ -121,3 +128,50 @@ geometry_msgs::msg::PoseWithCovarianceStamped PoseInitializer::get_gnss_pose()
   throw ServiceException(
     Initialize::Service::Response::ERROR_GNSS_SUPPORT, "GNSS is not supported.");
 }
+
+geometry_msgs::msg::PoseWithCovarianceStamped PoseInitializer::align_pose_in_parallel(
+  const PoseWithCovarianceStamped & pose)
+{
+  // Both of the aligners are requested at once and the first successful result is used. NDT is
+  // prioritized if both of them have finished, since it offers more accuracy pose.
+  std::optional<NdtModule::AlignFuture> ndt_future;
+  std::optional<YabLocModule::AlignFuture> yabloc_future;
+  std::exception_ptr error;
+  try {
+    ndt_future = ndt_->send_align_request(pose);
+  } catch (const ServiceException &) {
+    error = std::current_exception();
+  }
+  try {
+    yabloc_future = yabloc_->send_align_request(pose);
+  } catch (const ServiceException &) {
+    error = std::current_exception();
+  }
+
+  const auto is_ready = [](const auto & future) {
+    return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+  };
+  while (ndt_future || yabloc_future) {
+    if (ndt_future && is_ready(*ndt_future)) {
+      try {
+        return ndt_->get_aligned_pose(*ndt_future);
+      } catch (const ServiceException &) {
+        error = std::current_exception();
+        ndt_future.reset();
+      }
+    }
+    if (yabloc_future && is_ready(*yabloc_future)) {
+      try {
+        return yabloc_->get_aligned_pose(*yabloc_future);
+      } catch (const ServiceException &) {
+        error = std::current_exception();
+        yabloc_future.reset();
+      }
+    }
+    if (ndt_future || yabloc_future) {
+      const auto & pending_future = ndt_future ? *ndt_future : *yabloc_future;
+      pending_future.wait_for(std::chrono::milliseconds(10));
+    }
+  }
+  std::rethrow_exception(error);
+}
@@ -56,11 +56,13 @@ private:
   std::unique_ptr<EkfLocalizationTriggerModule> ekf_localization_trigger_;
   std::unique_ptr<NdtLocalizationTriggerModule> ndt_localization_trigger_;
   double stop_check_duration_;
+  bool parallel_alignment_;
   void change_state(State::Message::_state_type state);
   void on_initialize(
     const Initialize::Service::Request::SharedPtr req,
     const Initialize::Service::Response::SharedPtr res);
   PoseWithCovarianceStamped get_gnss_pose();
+  PoseWithCovarianceStamped align_pose_in_parallel(const PoseWithCovarianceStamped & pose);
 };
 
 #endif  // POSE_INITIALIZER__POSE_INITIALIZER_CORE_HPP_
@@ -29,6 +29,11 @@ YabLocModule::YabLocModule(rclcpp::Node * node) : logger_(node->get_logger())
 }
 
 PoseWithCovarianceStamped YabLocModule::align_pose(const PoseWithCovarianceStamped & pose)
+{
+  return get_aligned_pose(send_align_request(pose));
+}
+
+YabLocModule::AlignFuture YabLocModule::send_align_request(const PoseWithCovarianceStamped & pose)
 {
   const auto req = std::make_shared<RequestPoseAlignment::Request>();
   req->pose_with_covariance = pose;
@@ -38,7 +43,12 @@ PoseWithCovarianceStamped YabLocModule::align_pose(const PoseWithCovarianceStamp
   }
 
   RCLCPP_INFO(logger_, "Call YabLoc align server.");
-  const auto res = cli_align_->async_send_request(req).get();
+  return cli_align_->async_send_request(req).share();
+}
+
+PoseWithCovarianceStamped YabLocModule::get_aligned_pose(const AlignFuture & future)
+{
+  const auto res = future.get();
   if (!res->success) {
     RCLCPP_INFO(logger_, "YabLoc align server failed.");
     throw ServiceException(
@@ -37,6 +37,8 @@ public:
 private:
   const float target_height_ratio_;
   const int target_candidate_box_width_;
+  // ratio of the image height above which no pixel is segmented
+  const float roi_top_ratio_;
 
   rclcpp::Subscription<Image>::SharedPtr sub_image_;
   rclcpp::Publisher<Image>::SharedPtr pub_mask_image_;
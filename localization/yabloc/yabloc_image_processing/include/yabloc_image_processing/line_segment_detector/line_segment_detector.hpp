@@ -50,6 +50,8 @@ private:
   rclcpp::Publisher<PointCloud2>::SharedPtr pub_cloud_;
 
   cv::Ptr<cv::LineSegmentDetector> line_segment_detector_;
+  // ratio of the image height above which no line segment is detected
+  const double roi_top_ratio_;
 
   std::vector<cv::Mat> remove_too_outer_elements(
     const cv::Mat & lines, const cv::Size & size) const;
@@ -21,13 +21,20 @@
 #include <yabloc_common/cv_decompress.hpp>
 #include <yabloc_common/pub_sub.hpp>
 
+#include <stdexcept>
+
 namespace yabloc::graph_segment
 {
 GraphSegment::GraphSegment()
 : Node("graph_segment"),
   target_height_ratio_(declare_parameter<float>("target_height_ratio")),
-  target_candidate_box_width_(declare_parameter<int>("target_candidate_box_width"))
+  target_candidate_box_width_(declare_parameter<int>("target_candidate_box_width")),
+  roi_top_ratio_(declare_parameter<float>("roi_top_ratio"))
 {
+  if (roi_top_ratio_ < 0.0f || roi_top_ratio_ >= 1.0f) {
+    throw std::invalid_argument("roi_top_ratio should be in [0, 1)");
+  }
+
   using std::placeholders::_1;
 
   // Subscriber
@@ -71,7 +78,8 @@ int GraphSegment::search_most_road_like_class(const cv::Mat & segmented) const
       int key = seg_ptr[w];
       if (areas.count(key) == 0) areas[key] = 0;
       areas[key]++;
-      if (rect.contains(cv::Point2i{w, h})) candidates.insert(key);
+      // pixels out of the region of interest are not segmented
+      if (key >= 0 && rect.contains(cv::Point2i{w, h})) candidates.insert(key);
     }
   }
 
@@ -92,18 +100,28 @@ void GraphSegment::on_image(const Image & msg)
   cv::Mat resized;
   cv::resize(image, resized, cv::Size(), 0.5, 0.5);
 
-  // Execute graph-based segmentation
+  // Execute graph-based segmentation only below the top of the region of interest
   tier4_autoware_utils::StopWatch stop_watch;
+  const int roi_top = static_cast<int>(resized.rows * roi_top_ratio_);
+  const cv::Mat roi_resized = resized.rowRange(roi_top, resized.rows);
   cv::Mat segmented;
-  segmentation_->processImage(resized, segmented);
+  if (roi_top > 0) {
+    cv::Mat roi_segmented;
+    segmentation_->processImage(roi_resized, roi_segmented);
+    segmented = cv::Mat(resized.size(), CV_32SC1, cv::Scalar::all(-1));
+    roi_segmented.copyTo(segmented.rowRange(roi_top, resized.rows));
+  } else {
+    segmentation_->processImage(resized, segmented);
+  }
   RCLCPP_INFO_STREAM(get_logger(), "segmentation time: " << stop_watch.toc() * 1000 << "[ms]");
 
   //
   int target_class = search_most_road_like_class(segmented);
   //
   std::set<int> road_keys = {target_class};
-  if (similar_area_searcher_) {
-    road_keys = similar_area_searcher_->search(resized, segmented, target_class);
+  if (similar_area_searcher_ && target_class >= 0) {
+    road_keys = similar_area_searcher_->search(
+      roi_resized, segmented.rowRange(roi_top, resized.rows), target_class);
   }
 
   // Draw output image and debug image
@@ -118,6 +136,9 @@ void GraphSegment::on_image(const Image & msg)
     for (int w = 0; w < resized.cols; w++) {
       cv::Point2i px(w, h);
       const int key = segmented_image_ptr[w];
+      if (key < 0) {
+        continue;
+      }
       if (road_keys.count(key) > 0) {
         output_image_ptr[w] = 255;
         if (key == target_class)
@@ -21,10 +21,17 @@
 
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <stdexcept>
+
 namespace yabloc::line_segment_detector
 {
-LineSegmentDetector::LineSegmentDetector() : Node("line_detector")
+LineSegmentDetector::LineSegmentDetector()
+: Node("line_detector"), roi_top_ratio_(declare_parameter<double>("roi_top_ratio", 0.0))
 {
+  if (roi_top_ratio_ < 0.0 || roi_top_ratio_ >= 1.0) {
+    throw std::invalid_argument("roi_top_ratio should be in [0, 1)");
+  }
+
   using std::placeholders::_1;
 
   // Subscriber
@@ -50,10 +57,23 @@ void LineSegmentDetector::execute(const cv::Mat & image, const rclcpp::Time & st
   cv::Mat gray_image;
   cv::cvtColor(image, gray_image, cv::COLOR_BGR2GRAY);
 
+  // only the rows below the top of the region of interest are processed
+  const int roi_top = static_cast<int>(gray_image.rows * roi_top_ratio_);
+  const cv::Mat roi_image = gray_image.rowRange(roi_top, gray_image.rows);
+
   cv::Mat lines;
+  std::vector<cv::Mat> filtered_lines;
   {
     tier4_autoware_utils::StopWatch stop_watch;
-    line_segment_detector_->detect(gray_image, lines);
+    line_segment_detector_->detect(roi_image, lines);
+    filtered_lines = remove_too_outer_elements(lines, roi_image.size());
+
+    // the filtered lines share their data with lines, so both are moved to the image coordinates
+    for (int i = 0; i < lines.rows; i++) {
+      cv::Vec4f & xy_xy = lines.at<cv::Vec4f>(i);
+      xy_xy[1] += roi_top;
+      xy_xy[3] += roi_top;
+    }
     if (lines.size().width != 0) {
       line_segment_detector_->drawSegments(gray_image, lines);
     }
@@ -63,7 +83,6 @@ void LineSegmentDetector::execute(const cv::Mat & image, const rclcpp::Time & st
   common::publish_image(*pub_image_with_line_segments_, gray_image, stamp);
 
   pcl::PointCloud<pcl::PointNormal> line_cloud;
-  std::vector<cv::Mat> filtered_lines = remove_too_outer_elements(lines, image.size());
 
   for (const cv::Mat & xy_xy : filtered_lines) {
     Eigen::Vector3f xy1, xy2;
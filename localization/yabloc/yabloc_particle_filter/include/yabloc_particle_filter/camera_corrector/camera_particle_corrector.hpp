@@ -16,6 +16,7 @@
 #define YABLOC_PARTICLE_FILTER__CAMERA_CORRECTOR__CAMERA_PARTICLE_CORRECTOR_HPP_
 
 #include <opencv4/opencv2/core.hpp>
+#include <sophus/geometry.hpp>
 #include <yabloc_particle_filter/correction/abstract_corrector.hpp>
 #include <yabloc_particle_filter/ll2_cost_map/hierarchical_cost_map.hpp>
 
@@ -30,6 +31,7 @@
 #include <pcl/point_types.h>
 
 #include <utility>
+#include <vector>
 
 namespace yabloc::modularized_particle_filter
 {
@@ -85,8 +87,18 @@ private:
 
   std::pair<LineSegments, LineSegments> split_line_segments(const PointCloud2 & msg);
 
+  // a point sampled along a line segment in the base frame
+  struct SampledPoint
+  {
+    Eigen::Vector3f position;
+    Eigen::Vector3f tangent;
+    float weight;
+  };
+
+  std::vector<SampledPoint> sample_line_segments(const LineSegments & line_segments_cloud) const;
+
   float compute_logit(
-    const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position);
+    const std::vector<SampledPoint> & sampled_points, const Sophus::SE3f & transform);
 
   pcl::PointCloud<pcl::PointXYZI> evaluate_cloud(
     const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position);
@@ -30,6 +30,7 @@
 #include <pcl/point_types.h>
 
 #include <list>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -131,12 +132,17 @@ private:
 
   common::GammaConverter gamma_converter{4.0f};
 
-  std::unordered_map<Area, bool, Area> map_accessed_;
+  // the maps are kept in an LRU cache, whose generation advances at every erase_obsolete()
+  std::unordered_map<Area, size_t, Area> last_access_generations_;
+  size_t access_generation_{1};
 
   std::list<Area> generated_map_history_;
   std::optional<pcl::PointCloud<pcl::PointNormal>> cloud_;
   std::vector<BgPolygon> bounding_boxes_;
   std::unordered_map<Area, cv::Mat, Area> cost_maps_;
+  // the last accessed area and its map, which stays valid until the map is erased
+  std::optional<Area> cached_area_{std::nullopt};
+  const cv::Mat * cached_map_{nullptr};
 
   cv::Point to_cv_point(const Area & are, const Eigen::Vector2f) const;
   void build_map(const Area & area);
@@ -25,6 +25,9 @@
 
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <array>
+#include <vector>
+
 namespace yabloc::modularized_particle_filter
 {
 
@@ -165,15 +168,17 @@ void CameraParticleCorrector::on_line_segments(const PointCloud2 & line_segments
   cost_map_.set_height(mean_pose.position.z);
 
   if (publish_weighted_particles) {
+    // a rigid transformation keeps the intervals along the line segments, so the points are sampled
+    // once in the base frame and only transformed for each particle
+    std::vector<SampledPoint> sampled_points = sample_line_segments(line_segments_cloud);
+    const std::vector<SampledPoint> iffy_sampled_points =
+      sample_line_segments(iffy_line_segments_cloud);
+    sampled_points.insert(
+      sampled_points.end(), iffy_sampled_points.begin(), iffy_sampled_points.end());
+
     for (auto & particle : weighted_particles.particles) {
       Sophus::SE3f transform = common::pose_to_se3(particle.pose);
-      LineSegments transformed_line_segments =
-        common::transform_line_segments(line_segments_cloud, transform);
-      LineSegments transformed_iffy_line_segments =
-        common::transform_line_segments(iffy_line_segments_cloud, transform);
-      transformed_line_segments += transformed_iffy_line_segments;
-
-      float logit = compute_logit(transformed_line_segments, transform.translation());
+      float logit = compute_logit(sampled_points, transform);
       particle.weight = logit_to_prob(logit, 0.01f);
     }
 
@@ -263,33 +268,57 @@ float abs_cos(const Eigen::Vector3f & t, float deg)
   return std::abs(x.dot(y));
 }
 
-float CameraParticleCorrector::compute_logit(
-  const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position)
+std::vector<CameraParticleCorrector::SampledPoint> CameraParticleCorrector::sample_line_segments(
+  const LineSegments & line_segments_cloud) const
 {
-  float logit = 0;
+  std::vector<SampledPoint> sampled_points;
   for (const LineSegment & pn : line_segments_cloud) {
     const Eigen::Vector3f tangent = (pn.getNormalVector3fMap() - pn.getVector3fMap()).normalized();
     const float length = (pn.getVector3fMap() - pn.getNormalVector3fMap()).norm();
+    // posteriori line segments are less weighted than apriori ones
+    const float weight = (pn.label == 0) ? 0.2f : 1.0f;
 
     for (float distance = 0; distance < length; distance += 0.1f) {
-      Eigen::Vector3f p = pn.getVector3fMap() + tangent * distance;
+      sampled_points.push_back({pn.getVector3fMap() + tangent * distance, tangent, weight});
+    }
+  }
+  return sampled_points;
+}
 
-      // NOTE: Close points are prioritized
-      float squared_norm = (p - self_position).topRows(2).squaredNorm();
-      float gain = exp(-far_weight_gain_ * squared_norm);  // 0 < gain < 1
+float CameraParticleCorrector::compute_logit(
+  const std::vector<SampledPoint> & sampled_points, const Sophus::SE3f & transform)
+{
+  // the direction of each angle in the cost map, as computed by abs_cos()
+  static const std::array<Eigen::Vector2f, 256> directions = []() {
+    std::array<Eigen::Vector2f, 256> directions;
+    for (size_t deg = 0; deg < directions.size(); ++deg) {
+      const float radian = deg * M_PI / 180.0;
+      directions[deg] =
+        Eigen::Vector2f(tier4_autoware_utils::cos(radian), tier4_autoware_utils::sin(radian));
+    }
+    return directions;
+  }();
 
-      const CostMapValue v3 = cost_map_.at(p.topRows(2));
+  const Eigen::Matrix3f rotation = transform.rotationMatrix();
+  const Eigen::Vector3f self_position = transform.translation();
 
-      if (v3.unmapped) {
-        // logit does not change if target pixel is unmapped
-        continue;
-      }
-      if (pn.label == 0) {  // posteriori
-        logit += 0.2f * gain * (abs_cos(tangent, v3.angle) * v3.intensity - 0.5f);
-      } else {  // apriori
-        logit += gain * (abs_cos(tangent, v3.angle) * v3.intensity - 0.5f);
-      }
+  float logit = 0;
+  for (const SampledPoint & sampled_point : sampled_points) {
+    const Eigen::Vector3f p = rotation * sampled_point.position + self_position;
+
+    // NOTE: Close points are prioritized
+    float squared_norm = (p - self_position).topRows(2).squaredNorm();
+    float gain = exp(-far_weight_gain_ * squared_norm);  // 0 < gain < 1
+
+    const CostMapValue v3 = cost_map_.at(p.topRows(2));
+
+    if (v3.unmapped) {
+      // logit does not change if target pixel is unmapped
+      continue;
     }
+    const Eigen::Vector2f tangent = (rotation * sampled_point.tangent).topRows(2).normalized();
+    const float abs_cosine = std::abs(tangent.dot(directions[v3.angle]));
+    logit += sampled_point.weight * gain * (abs_cosine * v3.intensity - 0.5f);
   }
   return logit;
 }
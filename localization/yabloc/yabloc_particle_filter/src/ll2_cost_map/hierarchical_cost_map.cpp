@@ -22,6 +22,9 @@
 
 #include <boost/geometry/geometry.hpp>
 
+#include <algorithm>
+#include <vector>
+
 namespace yabloc
 {
 float Area::unit_length_ = -1;
@@ -51,14 +54,19 @@ CostMapValue HierarchicalCostMap::at(const Eigen::Vector2f & position)
     return CostMapValue{0.5f, 0, true};
   }
 
+  // consecutive accesses mostly fall in the same area
   Area key(position);
-  if (cost_maps_.count(key) == 0) {
-    build_map(key);
+  if (!cached_area_ || *cached_area_ != key) {
+    if (cost_maps_.count(key) == 0) {
+      build_map(key);
+    }
+    last_access_generations_[key] = access_generation_;
+    cached_area_ = key;
+    cached_map_ = &cost_maps_.at(key);
   }
-  map_accessed_[key] = true;
 
   cv::Point2i tmp = to_cv_point(key, position);
-  cv::Vec3b b3 = cost_maps_.at(key).ptr<cv::Vec3b>(tmp.y)[tmp.x];
+  cv::Vec3b b3 = cached_map_->ptr<cv::Vec3b>(tmp.y)[tmp.x];
   return {b3[0] / 255.f, b3[1], b3[2] == 1};
 }
 
@@ -68,7 +76,8 @@ void HierarchicalCostMap::set_height(float height)
     if (std::abs(*height_ - height) > 2) {
       generated_map_history_.clear();
       cost_maps_.clear();
-      map_accessed_.clear();
+      last_access_generations_.clear();
+      cached_area_ = std::nullopt;
     }
   }
 
@@ -110,7 +119,6 @@ void HierarchicalCostMap::build_map(const Area & area)
     return this->to_cv_point(area, p.topRows(2));
   };
 
-  // TODO(KYabuuchi) We can speed up by skipping too far line_segments
   for (const auto pn : cloud_.value()) {
     if (height_) {
       if (std::abs(pn.z - *height_) > 4) continue;
@@ -120,6 +128,14 @@ void HierarchicalCostMap::build_map(const Area & area)
     cv::Point2i from = cvPoint(pn.getVector3fMap());
     cv::Point2i to = cvPoint(pn.getNormalVector3fMap());
 
+    // line segments entirely on one side of the image are clipped without drawing any pixel
+    const int image_size = static_cast<int>(image_size_);
+    if (
+      std::max(from.x, to.x) < 0 || std::min(from.x, to.x) >= image_size ||
+      std::max(from.y, to.y) < 0 || std::min(from.y, to.y) >= image_size) {
+      continue;
+    }
+
     float radian = std::atan2(from.y - to.y, from.x - to.x);
     if (radian < 0) radian += M_PI;
     float degree = radian * 180 / M_PI;
@@ -219,18 +235,27 @@ cv::Mat HierarchicalCostMap::get_map_image(const Pose & pose)
 
 void HierarchicalCostMap::erase_obsolete()
 {
-  if (cost_maps_.size() < max_map_count_) return;
-
-  for (auto itr = generated_map_history_.begin(); itr != generated_map_history_.end();) {
-    if (map_accessed_[*itr]) {
-      ++itr;
-      continue;
+  if (cost_maps_.size() >= max_map_count_) {
+    // the least recently accessed maps are erased first, and the maps accessed since the last call
+    // are always kept
+    std::vector<Area> areas(generated_map_history_.begin(), generated_map_history_.end());
+    std::stable_sort(areas.begin(), areas.end(), [this](const Area & lhs, const Area & rhs) {
+      return last_access_generations_[lhs] < last_access_generations_[rhs];
+    });
+    for (const Area & area : areas) {
+      if (
+        cost_maps_.size() < max_map_count_ ||
+        last_access_generations_[area] == access_generation_) {
+        break;
+      }
+      cost_maps_.erase(area);
+      last_access_generations_.erase(area);
+      generated_map_history_.remove(area);
     }
-    cost_maps_.erase(*itr);
-    itr = generated_map_history_.erase(itr);
   }
 
-  map_accessed_.clear();
+  ++access_generation_;
+  cached_area_ = std::nullopt;
 }
 
 cv::Mat HierarchicalCostMap::create_available_area_image(const Area & area) const
@@ -23,9 +23,154 @@
 #include <pcl_conversions/pcl_conversions.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 namespace map_height_fitter
 {
 
+/**
+ * @brief points of the map bucketed by their 2D position in square cells
+ * @details The grid is built once when the map is received, so that the ground height is searched
+ * only in the cells around the position instead of scanning the whole map for every request.
+ */
+class MapGrid
+{
+public:
+  static constexpr double cell_size = 1.0;
+
+  explicit MapGrid(const pcl::PointCloud<pcl::PointXYZ> & cloud)
+  {
+    for (const auto & p : cloud.points) {
+      if (!std::isfinite(p.x) || !std::isfinite(p.y)) {
+        continue;
+      }
+      const int64_t x = get_cell(p.x);
+      const int64_t y = get_cell(p.y);
+      cells_[get_key(x, y)].push_back(p);
+      min_x_ = std::min(min_x_, x);
+      max_x_ = std::max(max_x_, x);
+      min_y_ = std::min(min_y_, y);
+      max_y_ = std::max(max_y_, y);
+    }
+  }
+
+  bool empty() const { return cells_.empty(); }
+
+  // squared 2D distance to the closest point, the rings are searched until no point can be closer
+  double get_min_dist2(const double x, const double y) const
+  {
+    const int64_t center_x = get_cell(x);
+    const int64_t center_y = get_cell(y);
+    const int64_t max_ring = std::max(
+      {center_x - min_x_, max_x_ - center_x, center_y - min_y_, max_y_ - center_y, int64_t{0}});
+
+    double min_dist2 = INFINITY;
+    for (int64_t ring = 0; ring <= max_ring; ++ring) {
+      for_each_ring_cell(center_x, center_y, ring, [&](const std::vector<pcl::PointXYZ> & cell) {
+        for (const auto & p : cell) {
+          const double dx = x - p.x;
+          const double dy = y - p.y;
+          min_dist2 = std::min(min_dist2, (dx * dx) + (dy * dy));
+        }
+      });
+      // the points in the outer rings are farther than ring * cell_size
+      const double ring_dist = ring * cell_size;
+      if (min_dist2 <= ring_dist * ring_dist) {
+        break;
+      }
+    }
+    return min_dist2;
+  }
+
+  // lowest height of the points within the radius
+  double get_min_height(const double x, const double y, const double radius) const
+  {
+    const double radius2 = radius * radius;
+    const int64_t center_x = get_cell(x);
+    const int64_t center_y = get_cell(y);
+    const auto max_ring = static_cast<int64_t>(std::ceil(radius / cell_size));
+
+    double height = INFINITY;
+    for (int64_t ring = 0; ring <= max_ring; ++ring) {
+      for_each_ring_cell(center_x, center_y, ring, [&](const std::vector<pcl::PointXYZ> & cell) {
+        for (const auto & p : cell) {
+          const double dx = x - p.x;
+          const double dy = y - p.y;
+          if ((dx * dx) + (dy * dy) < radius2) {
+            height = std::min(height, static_cast<double>(p.z));
+          }
+        }
+      });
+    }
+    return height;
+  }
+
+private:
+  static int64_t get_cell(const double value)
+  {
+    return static_cast<int64_t>(std::floor(value / cell_size));
+  }
+
+  static uint64_t get_key(const int64_t x, const int64_t y)
+  {
+    return (static_cast<uint64_t>(x) << 32) ^ static_cast<uint64_t>(static_cast<uint32_t>(y));
+  }
+
+  template <class F>
+  void for_each_ring_cell(
+    const int64_t center_x, const int64_t center_y, const int64_t ring, const F & func) const
+  {
+    const auto visit = [&](const int64_t x, const int64_t y) {
+      const auto itr = cells_.find(get_key(x, y));
+      if (itr != cells_.end()) {
+        func(itr->second);
+      }
+    };
+    // the edges of the ring are clipped by the bounds so that a far position does not visit cells
+    // out of the map
+    const auto visit_row = [&](const int64_t y) {
+      if (y < min_y_ || max_y_ < y) {
+        return;
+      }
+      const int64_t begin = std::max(center_x - ring, min_x_);
+      const int64_t end = std::min(center_x + ring, max_x_);
+      for (int64_t x = begin; x <= end; ++x) {
+        visit(x, y);
+      }
+    };
+    const auto visit_column = [&](const int64_t x) {
+      if (x < min_x_ || max_x_ < x) {
+        return;
+      }
+      const int64_t begin = std::max(center_y - ring + 1, min_y_);
+      const int64_t end = std::min(center_y + ring - 1, max_y_);
+      for (int64_t y = begin; y <= end; ++y) {
+        visit(x, y);
+      }
+    };
+    visit_row(center_y - ring);
+    if (ring == 0) {
+      return;
+    }
+    visit_row(center_y + ring);
+    visit_column(center_x - ring);
+    visit_column(center_x + ring);
+  }
+
+  std::unordered_map<uint64_t, std::vector<pcl::PointXYZ>> cells_;
+  int64_t min_x_{std::numeric_limits<int64_t>::max()};
+  int64_t max_x_{std::numeric_limits<int64_t>::min()};
+  int64_t min_y_{std::numeric_limits<int64_t>::max()};
+  int64_t max_y_{std::numeric_limits<int64_t>::min()};
+};
+
 struct MapHeightFitter::Impl
 {
   static constexpr char enable_partial_load[] = "enable_partial_load";
@@ -39,7 +184,7 @@ struct MapHeightFitter::Impl
   tf2::BufferCore tf2_buffer_;
   tf2_ros::TransformListener tf2_listener_;
   std::string map_frame_;
-  pcl::PointCloud<pcl::PointXYZ>::Ptr map_cloud_;
+  std::shared_ptr<const MapGrid> map_grid_;
   rclcpp::Node * node_;
 
   rclcpp::CallbackGroup::SharedPtr group_;
@@ -78,9 +223,10 @@ MapHeightFitter::Impl::Impl(rclcpp::Node * node) : tf2_listener_(tf2_buffer_), n
 
 void MapHeightFitter::Impl::on_map(const sensor_msgs::msg::PointCloud2::ConstSharedPtr msg)
 {
+  pcl::PointCloud<pcl::PointXYZ> map_cloud;
+  pcl::fromROSMsg(*msg, map_cloud);
   map_frame_ = msg->header.frame_id;
-  map_cloud_ = pcl::PointCloud<pcl::PointXYZ>::Ptr(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::fromROSMsg(*msg, *map_cloud_);
+  map_grid_ = std::make_shared<const MapGrid>(map_cloud);
 }
 
 bool MapHeightFitter::Impl::get_partial_point_cloud_map(const Point & point)
@@ -128,9 +274,10 @@ bool MapHeightFitter::Impl::get_partial_point_cloud_map(const Point & point)
         pcd_msg.data.end(), pcd_with_id.pointcloud.data.begin(), pcd_with_id.pointcloud.data.end());
     }
   }
+  pcl::PointCloud<pcl::PointXYZ> map_cloud;
+  pcl::fromROSMsg(pcd_msg, map_cloud);
   map_frame_ = res->header.frame_id;
-  map_cloud_ = pcl::PointCloud<pcl::PointXYZ>::Ptr(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::fromROSMsg(pcd_msg, *map_cloud_);
+  map_grid_ = std::make_shared<const MapGrid>(map_cloud);
   return true;
 }
 
@@ -138,27 +285,16 @@ double MapHeightFitter::Impl::get_ground_height(const tf2::Vector3 & point) cons
 {
   const double x = point.getX();
   const double y = point.getY();
+  const auto map_grid = map_grid_;
+  if (map_grid->empty()) {
+    return point.getZ();
+  }
 
   // find distance d to closest point
-  double min_dist2 = INFINITY;
-  for (const auto & p : map_cloud_->points) {
-    const double dx = x - p.x;
-    const double dy = y - p.y;
-    const double sd = (dx * dx) + (dy * dy);
-    min_dist2 = std::min(min_dist2, sd);
-  }
+  const double min_dist2 = map_grid->get_min_dist2(x, y);
 
   // find lowest height within radius (d+1.0)
-  const double radius2 = std::pow(std::sqrt(min_dist2) + 1.0, 2.0);
-  double height = INFINITY;
-  for (const auto & p : map_cloud_->points) {
-    const double dx = x - p.x;
-    const double dy = y - p.y;
-    const double sd = (dx * dx) + (dy * dy);
-    if (sd < radius2) {
-      height = std::min(height, static_cast<double>(p.z));
-    }
-  }
+  const double height = map_grid->get_min_height(x, y, std::sqrt(min_dist2) + 1.0);
 
   return std::isfinite(height) ? height : point.getZ();
 }
@@ -176,7 +312,7 @@ std::optional<Point> MapHeightFitter::Impl::fit(const Point & position, const st
     }
   }
 
-  if (!map_cloud_) {
+  if (!map_grid_) {
     RCLCPP_WARN_STREAM(logger, "point cloud map is not ready");
     return std::nullopt;
   }
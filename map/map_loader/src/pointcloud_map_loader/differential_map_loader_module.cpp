@@ -15,8 +15,11 @@
 #include "differential_map_loader_module.hpp"
 
 DifferentialMapLoaderModule::DifferentialMapLoaderModule(
-  rclcpp::Node * node, const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict)
-: logger_(node->get_logger()), all_pcd_file_metadata_dict_(pcd_file_metadata_dict)
+  rclcpp::Node * node, const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict,
+  const int num_loading_threads)
+: logger_(node->get_logger()),
+  all_pcd_file_metadata_dict_(pcd_file_metadata_dict),
+  num_loading_threads_(std::max(num_loading_threads, 1))
 {
   get_differential_pcd_maps_service_ = node->create_service<GetDifferentialPointCloudMap>(
     "service/get_differential_pcd_map",
@@ -31,6 +34,7 @@ void DifferentialMapLoaderModule::differentialAreaLoad(
 {
   // iterate over all the available pcd map grids
   std::vector<bool> should_remove(static_cast<int>(cached_ids.size()), true);
+  std::vector<const std::pair<const std::string, PCDFileMetadata> *> grids_to_load;
   for (const auto & ele : all_pcd_file_metadata_dict_) {
     std::string path = ele.first;
     PCDFileMetadata metadata = ele.second;
@@ -46,16 +50,25 @@ void DifferentialMapLoaderModule::differentialAreaLoad(
       int index = id_in_cached_list - cached_ids.begin();
       should_remove[index] = false;
     } else {
-      autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id =
-        loadPointCloudMapCellWithID(path, map_id);
-      pointcloud_map_cell_with_id.metadata.min_x = metadata.min.x;
-      pointcloud_map_cell_with_id.metadata.min_y = metadata.min.y;
-      pointcloud_map_cell_with_id.metadata.max_x = metadata.max.x;
-      pointcloud_map_cell_with_id.metadata.max_y = metadata.max.y;
-      response->new_pointcloud_with_ids.push_back(pointcloud_map_cell_with_id);
+      grids_to_load.push_back(&ele);
     }
   }
 
+  // load the new grids in parallel, keeping the order of the metadata dictionary in the response
+  auto & new_pointcloud_with_ids = response->new_pointcloud_with_ids;
+  const size_t num_loaded_grids = new_pointcloud_with_ids.size();
+  new_pointcloud_with_ids.resize(num_loaded_grids + grids_to_load.size());
+  runInParallel(grids_to_load.size(), num_loading_threads_, [&](const size_t i) {
+    const auto & [path, metadata] = *grids_to_load[i];
+    // assume that the map ID = map path (for now)
+    auto & pointcloud_map_cell_with_id = new_pointcloud_with_ids[num_loaded_grids + i];
+    pointcloud_map_cell_with_id = loadPointCloudMapCellWithID(path, path);
+    pointcloud_map_cell_with_id.metadata.min_x = metadata.min.x;
+    pointcloud_map_cell_with_id.metadata.min_y = metadata.min.y;
+    pointcloud_map_cell_with_id.metadata.max_x = metadata.max.x;
+    pointcloud_map_cell_with_id.metadata.max_y = metadata.max.y;
+  });
+
   for (size_t i = 0; i < cached_ids.size(); ++i) {
     if (should_remove[i]) {
       response->ids_to_remove.push_back(cached_ids[i]);
@@ -83,7 +96,7 @@ DifferentialMapLoaderModule::loadPointCloudMapCellWithID(
     RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
   }
   autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
-  pointcloud_map_cell_with_id.pointcloud = pcd;
+  pointcloud_map_cell_with_id.pointcloud = std::move(pcd);
   pointcloud_map_cell_with_id.cell_id = map_id;
   return pointcloud_map_cell_with_id;
 }
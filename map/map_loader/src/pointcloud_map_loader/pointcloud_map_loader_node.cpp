@@ -55,6 +55,7 @@ PointCloudMapLoaderNode::PointCloudMapLoaderNode(const rclcpp::NodeOptions & opt
   bool enable_partial_load = declare_parameter<bool>("enable_partial_load");
   bool enable_differential_load = declare_parameter<bool>("enable_differential_load");
   bool enable_selected_load = declare_parameter<bool>("enable_selected_load");
+  int num_loading_threads = declare_parameter<int>("num_loading_threads");
 
   if (enable_whole_load) {
     std::string publisher_name = "output/pointcloud_map";
@@ -77,12 +78,13 @@ PointCloudMapLoaderNode::PointCloudMapLoaderNode(const rclcpp::NodeOptions & opt
     }
 
     if (enable_partial_load) {
-      partial_map_loader_ = std::make_unique<PartialMapLoaderModule>(this, pcd_metadata_dict);
+      partial_map_loader_ =
+        std::make_unique<PartialMapLoaderModule>(this, pcd_metadata_dict, num_loading_threads);
     }
 
     if (enable_differential_load) {
       differential_map_loader_ =
-        std::make_unique<DifferentialMapLoaderModule>(this, pcd_metadata_dict);
+        std::make_unique<DifferentialMapLoaderModule>(this, pcd_metadata_dict, num_loading_threads);
     }
 
     if (enable_selected_load) {
@@ -16,8 +16,11 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <atomic>
 #include <map>
 #include <string>
+#include <thread>
 #include <vector>
 
 std::map<std::string, PCDFileMetadata> loadPCDMetadata(const std::string & pcd_metadata_path)
@@ -99,3 +102,23 @@ bool isGridWithinQueriedArea(
   bool res = cylinderAndBoxOverlapExists(center_x, center_y, radius, metadata.min, metadata.max);
   return res;
 }
+
+void runInParallel(
+  const size_t size, const size_t num_threads, const std::function<void(size_t)> & function)
+{
+  std::atomic<size_t> next_index{0};
+  const auto work = [&]() {
+    for (size_t i = next_index++; i < size; i = next_index++) {
+      function(i);
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < std::min(num_threads, size); ++i) {
+    workers.emplace_back(work);
+  }
+  work();
+  for (auto & worker : workers) {
+    worker.join();
+  }
+}
@@ -21,6 +21,7 @@
 #include <pcl/common/common.h>
 #include <yaml-cpp/yaml.h>
 
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
@@ -47,4 +48,8 @@ bool cylinderAndBoxOverlapExists(
 bool isGridWithinQueriedArea(
   const autoware_map_msgs::msg::AreaInfo area, const PCDFileMetadata metadata);
 
+// call function(i) for i in [0, size) from num_threads threads, including the calling thread
+void runInParallel(
+  const size_t size, const size_t num_threads, const std::function<void(size_t)> & function);
+
 #endif  // POINTCLOUD_MAP_LOADER__UTILS_HPP_
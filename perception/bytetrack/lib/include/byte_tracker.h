@@ -38,6 +38,7 @@
 
 #pragma once
 
+#include "lapjv.h"
 #include "strack.h"
 
 #include <vector>
@@ -70,19 +71,19 @@ private:
     std::vector<STrack> & stracksb);
 
   void linear_assignment(
-    std::vector<std::vector<float>> & cost_matrix, int cost_matrix_size, int cost_matrix_size_size,
-    float thresh, std::vector<std::vector<int>> & matches, std::vector<int> & unmatched_a,
+    const std::vector<float> & cost_matrix, int cost_matrix_size, int cost_matrix_size_size,
+    float thresh, std::vector<MATCH_DATA> & matches, std::vector<int> & unmatched_a,
     std::vector<int> & unmatched_b);
-  std::vector<std::vector<float>> iou_distance(
-    std::vector<STrack *> & atracks, std::vector<STrack> & btracks, int & dist_size,
-    int & dist_size_size);
-  std::vector<std::vector<float>> iou_distance(
-    std::vector<STrack> & atracks, std::vector<STrack> & btracks);
-  std::vector<std::vector<float>> ious(
-    std::vector<std::vector<float>> & atlbrs, std::vector<std::vector<float>> & btlbrs);
+  // the cost matrices are flat and row-major, and empty when either of the tracks is empty
+  void iou_distance(
+    const std::vector<STrack *> & atracks, const std::vector<STrack> & btracks,
+    std::vector<float> & cost_matrix, int & dist_size, int & dist_size_size);
+  void iou_distance(
+    const std::vector<STrack> & atracks, const std::vector<STrack> & btracks,
+    std::vector<float> & cost_matrix);
 
   double lapjv(
-    const std::vector<std::vector<float>> & cost, std::vector<int> & rowsol,
+    const std::vector<float> & cost, int n_rows, int n_cols, std::vector<int> & rowsol,
     std::vector<int> & colsol, bool extend_cost = false, float cost_limit = LONG_MAX,
     bool return_cost = true);
 
@@ -97,4 +98,14 @@ private:
   std::vector<STrack> lost_stracks;
   std::vector<STrack> removed_stracks;
   byte_kalman::KalmanFilter kalman_filter;
+
+  // buffers of the association, kept between the frames to avoid allocations
+  std::vector<float> dists;
+  std::vector<int> rowsol;
+  std::vector<int> colsol;
+  std::vector<double> lapjv_cost;
+  std::vector<double *> lapjv_cost_rows;
+  std::vector<int> lapjv_x;
+  std::vector<int> lapjv_y;
+  LapjvWorkspace lapjv_workspace;
 };
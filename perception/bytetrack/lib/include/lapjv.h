@@ -39,6 +39,8 @@
 #ifndef LAPJV_H_
 #define LAPJV_H_
 
+#include <vector>
+
 #define LARGE 1000000
 
 #if !defined TRUE
@@ -105,6 +107,30 @@ typedef double cost_t;
 typedef char boolean;
 typedef enum fp_t { FP_1 = 1, FP_2 = 2, FP_DYNAMIC = 3 } fp_t;
 
+/** Working arrays of lapjv_internal, which can be kept between the calls to avoid allocations.
+ */
+struct LapjvWorkspace
+{
+  std::vector<int_t> free_rows;
+  std::vector<cost_t> v;
+  std::vector<boolean> unique;
+  std::vector<int_t> pred;
+  std::vector<int_t> cols;
+  std::vector<cost_t> d;
+
+  void resize(const uint_t n)
+  {
+    free_rows.resize(n);
+    v.resize(n);
+    unique.resize(n);
+    pred.resize(n);
+    cols.resize(n);
+    d.resize(n);
+  }
+};
+
 extern int_t lapjv_internal(const uint_t n, cost_t * cost[], int_t * x, int_t * y);
+extern int_t lapjv_internal(
+  const uint_t n, cost_t * cost[], int_t * x, int_t * y, LapjvWorkspace & workspace);
 
 #endif  // LAPJV_H_
@@ -60,6 +60,7 @@ public:
   void static_tlwh();
   void static_tlbr();
   std::vector<float> tlwh_to_xyah(std::vector<float> tlwh_tmp);
+  static DETECTBOX tlwh_to_xyah_box(const std::vector<float> & tlwh_tmp);
   std::vector<float> to_xyah();
   void mark_lost();
   void mark_removed();
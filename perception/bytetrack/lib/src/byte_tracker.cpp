@@ -108,17 +108,16 @@ std::vector<STrack> ByteTracker::update(const std::vector<ByteTrackObject> & obj
   strack_pool = joint_stracks(tracked_stracks, this->lost_stracks);
   STrack::multi_predict(strack_pool, this->kalman_filter);
 
-  std::vector<std::vector<float> > dists;
   int dist_size = 0, dist_size_size = 0;
-  dists = iou_distance(strack_pool, detections, dist_size, dist_size_size);
+  iou_distance(strack_pool, detections, dists, dist_size, dist_size_size);
 
-  std::vector<std::vector<int> > matches;
+  std::vector<MATCH_DATA> matches;
   std::vector<int> u_track, u_detection;
   linear_assignment(dists, dist_size, dist_size_size, match_thresh, matches, u_track, u_detection);
 
   for (size_t i = 0; i < matches.size(); i++) {
-    STrack * track = strack_pool[matches[i][0]];
-    STrack * det = &detections[matches[i][1]];
+    STrack * track = strack_pool[matches[i].first];
+    STrack * det = &detections[matches[i].second];
     if (track->state == TrackState::Tracked) {
       track->update(*det, this->frame_id);
       activated_stracks.push_back(*track);
@@ -141,8 +140,7 @@ std::vector<STrack> ByteTracker::update(const std::vector<ByteTrackObject> & obj
     }
   }
 
-  dists.clear();
-  dists = iou_distance(r_tracked_stracks, detections, dist_size, dist_size_size);
+  iou_distance(r_tracked_stracks, detections, dists, dist_size, dist_size_size);
 
   matches.clear();
   u_track.clear();
@@ -150,8 +148,8 @@ std::vector<STrack> ByteTracker::update(const std::vector<ByteTrackObject> & obj
   linear_assignment(dists, dist_size, dist_size_size, 0.5, matches, u_track, u_detection);
 
   for (size_t i = 0; i < matches.size(); i++) {
-    STrack * track = r_tracked_stracks[matches[i][0]];
-    STrack * det = &detections[matches[i][1]];
+    STrack * track = r_tracked_stracks[matches[i].first];
+    STrack * det = &detections[matches[i].second];
     if (track->state == TrackState::Tracked) {
       track->update(*det, this->frame_id);
       activated_stracks.push_back(*track);
@@ -173,8 +171,7 @@ std::vector<STrack> ByteTracker::update(const std::vector<ByteTrackObject> & obj
   detections.clear();
   detections.assign(detections_cp.begin(), detections_cp.end());
 
-  dists.clear();
-  dists = iou_distance(unconfirmed, detections, dist_size, dist_size_size);
+  iou_distance(unconfirmed, detections, dists, dist_size, dist_size_size);
 
   matches.clear();
   std::vector<int> u_unconfirmed;
@@ -182,8 +179,8 @@ std::vector<STrack> ByteTracker::update(const std::vector<ByteTrackObject> & obj
   linear_assignment(dists, dist_size, dist_size_size, 0.7, matches, u_unconfirmed, u_detection);
 
   for (size_t i = 0; i < matches.size(); i++) {
-    unconfirmed[matches[i][0]]->update(detections[matches[i][1]], this->frame_id);
-    activated_stracks.push_back(*unconfirmed[matches[i][0]]);
+    unconfirmed[matches[i].first]->update(detections[matches[i].second], this->frame_id);
+    activated_stracks.push_back(*unconfirmed[matches[i].first]);
   }
 
   for (size_t i = 0; i < u_unconfirmed.size(); i++) {
@@ -49,11 +49,11 @@ KalmanFilter::KalmanFilter()
   int ndim = 4;
   double dt = 1.;
 
-  _motion_mat = Eigen::MatrixXf::Identity(8, 8);
+  _motion_mat = KAL_COVA::Identity();
   for (int i = 0; i < ndim; i++) {
     _motion_mat(i, ndim + i) = dt;
   }
-  _update_mat = Eigen::MatrixXf::Identity(4, 8);
+  _update_mat = Eigen::Matrix<float, 4, 8, Eigen::RowMajor>::Identity();
 
   this->_std_weight_position = 1. / 20;
   this->_std_weight_velocity = 1. / 160;
@@ -165,7 +165,7 @@ Eigen::Matrix<float, 1, -1> KalmanFilter::gating_distance(
   for (DETECTBOX box : measurements) {
     d.row(pos++) = box - mean1;
   }
-  Eigen::Matrix<float, -1, -1, Eigen::RowMajor> factor = covariance1.llt().matrixL();
+  KAL_HCOVA factor = covariance1.llt().matrixL();
   Eigen::Matrix<float, -1, -1> z =
     factor.triangularView<Eigen::Lower>().solve<Eigen::OnTheRight>(d).transpose();
   auto zz = ((z.array()) * (z.array())).matrix();
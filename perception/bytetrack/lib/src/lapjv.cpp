@@ -45,10 +45,10 @@
 /** Column-reduction and reduction transfer for a dense cost matrix.
  */
 int_t _ccrrt_dense(
-  const uint_t n, cost_t * cost[], int_t * free_rows, int_t * x, int_t * y, cost_t * v)
+  const uint_t n, cost_t * cost[], int_t * free_rows, int_t * x, int_t * y, cost_t * v,
+  boolean * unique)
 {
   int_t n_free_rows;
-  boolean * unique;
 
   for (uint_t i = 0; i < n; i++) {
     x[i] = -1;
@@ -67,7 +67,6 @@ int_t _ccrrt_dense(
   }
   PRINT_COST_ARRAY(v, n);
   PRINT_INDEX_ARRAY(y, n);
-  NEW(unique, boolean, n);
   memset(unique, TRUE, n);
   {
     int_t j = n;
@@ -102,7 +101,6 @@ int_t _ccrrt_dense(
       v[j] -= min;
     }
   }
-  FREE(unique);
   return n_free_rows;
 }
 
@@ -244,16 +242,12 @@ int_t _scan_dense(
  * \return The closest free column index.
  */
 int_t find_path_dense(
-  const uint_t n, cost_t * cost[], const int_t start_i, int_t * y, cost_t * v, int_t * pred)
+  const uint_t n, cost_t * cost[], const int_t start_i, int_t * y, cost_t * v, int_t * pred,
+  int_t * cols, cost_t * d)
 {
   uint_t lo = 0, hi = 0;
   int_t final_j = -1;
   uint_t n_ready = 0;
-  int_t * cols;
-  cost_t * d;
-
-  NEW(cols, int_t, n);
-  NEW(d, cost_t, n);
 
   for (uint_t i = 0; i < n; i++) {
     cols[i] = i;
@@ -295,9 +289,6 @@ int_t find_path_dense(
     }
   }
 
-  FREE(cols);
-  FREE(d);
-
   return final_j;
 }
 
@@ -305,18 +296,14 @@ int_t find_path_dense(
  */
 int_t _ca_dense(
   const uint_t n, cost_t * cost[], const uint_t n_free_rows, int_t * free_rows, int_t * x,
-  int_t * y, cost_t * v)
+  int_t * y, cost_t * v, int_t * pred, int_t * cols, cost_t * d)
 {
-  int_t * pred;
-
-  NEW(pred, int_t, n);
-
   for (int_t * pfree_i = free_rows; pfree_i < free_rows + n_free_rows; pfree_i++) {
     int_t i = -1, j;
     uint_t k = 0;
 
     PRINTF("looking at free_i=%d\n", *pfree_i);
-    j = find_path_dense(n, cost, *pfree_i, y, v, pred);
+    j = find_path_dense(n, cost, *pfree_i, y, v, pred, cols, d);
     ASSERT(j >= 0);
     ASSERT(j < n);
     while (i != *pfree_i) {
@@ -333,30 +320,37 @@ int_t _ca_dense(
       }
     }
   }
-  FREE(pred);
   return 0;
 }
 
 /** Solve dense sparse LAP.
  */
 int lapjv_internal(const uint_t n, cost_t * cost[], int_t * x, int_t * y)
+{
+  LapjvWorkspace workspace;
+  return lapjv_internal(n, cost, x, y, workspace);
+}
+
+/** Solve dense sparse LAP with the working arrays of the workspace, which are resized to n.
+ */
+int lapjv_internal(
+  const uint_t n, cost_t * cost[], int_t * x, int_t * y, LapjvWorkspace & workspace)
 {
   int ret;
-  int_t * free_rows;
-  cost_t * v;
+  workspace.resize(n);
+  int_t * free_rows = workspace.free_rows.data();
+  cost_t * v = workspace.v.data();
 
-  NEW(free_rows, int_t, n);
-  NEW(v, cost_t, n);
-  ret = _ccrrt_dense(n, cost, free_rows, x, y, v);
+  ret = _ccrrt_dense(n, cost, free_rows, x, y, v, workspace.unique.data());
   int i = 0;
   while (ret > 0 && i < 2) {
     ret = _carr_dense(n, cost, ret, free_rows, x, y, v);
     i++;
   }
   if (ret > 0) {
-    ret = _ca_dense(n, cost, ret, free_rows, x, y, v);
+    ret = _ca_dense(
+      n, cost, ret, free_rows, x, y, v, workspace.pred.data(), workspace.cols.data(),
+      workspace.d.data());
   }
-  FREE(v);
-  FREE(free_rows);
   return ret;
 }
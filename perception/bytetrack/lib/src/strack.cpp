@@ -71,17 +71,7 @@ void STrack::activate(byte_kalman::KalmanFilter & kalman_filter, int frame_id)
   this->track_id = this->next_id();
   this->unique_id = boost::uuids::random_generator()();
 
-  std::vector<float> _tlwh_tmp(4);
-  _tlwh_tmp[0] = this->_tlwh[0];
-  _tlwh_tmp[1] = this->_tlwh[1];
-  _tlwh_tmp[2] = this->_tlwh[2];
-  _tlwh_tmp[3] = this->_tlwh[3];
-  std::vector<float> xyah = tlwh_to_xyah(_tlwh_tmp);
-  DETECTBOX xyah_box;
-  xyah_box[0] = xyah[0];
-  xyah_box[1] = xyah[1];
-  xyah_box[2] = xyah[2];
-  xyah_box[3] = xyah[3];
+  DETECTBOX xyah_box = tlwh_to_xyah_box(this->_tlwh);
   auto mc = this->kalman_filter.initiate(xyah_box);
   this->mean = mc.first;
   this->covariance = mc.second;
@@ -102,12 +92,7 @@ void STrack::activate(byte_kalman::KalmanFilter & kalman_filter, int frame_id)
 
 void STrack::re_activate(STrack & new_track, int frame_id, bool new_id)
 {
-  std::vector<float> xyah = tlwh_to_xyah(new_track.tlwh);
-  DETECTBOX xyah_box;
-  xyah_box[0] = xyah[0];
-  xyah_box[1] = xyah[1];
-  xyah_box[2] = xyah[2];
-  xyah_box[3] = xyah[3];
+  DETECTBOX xyah_box = tlwh_to_xyah_box(new_track.tlwh);
   auto mc = this->kalman_filter.update(this->mean, this->covariance, xyah_box);
   this->mean = mc.first;
   this->covariance = mc.second;
@@ -131,12 +116,7 @@ void STrack::update(STrack & new_track, int frame_id)
   this->frame_id = frame_id;
   this->tracklet_len++;
 
-  std::vector<float> xyah = tlwh_to_xyah(new_track.tlwh);
-  DETECTBOX xyah_box;
-  xyah_box[0] = xyah[0];
-  xyah_box[1] = xyah[1];
-  xyah_box[2] = xyah[2];
-  xyah_box[3] = xyah[3];
+  DETECTBOX xyah_box = tlwh_to_xyah_box(new_track.tlwh);
 
   auto mc = this->kalman_filter.update(this->mean, this->covariance, xyah_box);
   this->mean = mc.first;
@@ -188,6 +168,16 @@ std::vector<float> STrack::tlwh_to_xyah(std::vector<float> tlwh_tmp)
   return tlwh_output;
 }
 
+DETECTBOX STrack::tlwh_to_xyah_box(const std::vector<float> & tlwh_tmp)
+{
+  DETECTBOX xyah_box;
+  xyah_box[0] = tlwh_tmp[0] + tlwh_tmp[2] / 2;
+  xyah_box[1] = tlwh_tmp[1] + tlwh_tmp[3] / 2;
+  xyah_box[2] = tlwh_tmp[2] / tlwh_tmp[3];
+  xyah_box[3] = tlwh_tmp[3];
+  return xyah_box;
+}
+
 std::vector<float> STrack::to_xyah()
 {
   return tlwh_to_xyah(tlwh);
@@ -39,8 +39,52 @@
 #include "byte_tracker.h"
 #include "lapjv.h"
 
+#include <algorithm>
 #include <cstddef>
 
+namespace
+{
+const STrack & get_track(const STrack * track)
+{
+  return *track;
+}
+
+const STrack & get_track(const STrack & track)
+{
+  return track;
+}
+
+float calc_iou(const std::vector<float> & atlbr, const std::vector<float> & btlbr)
+{
+  float box_area = (btlbr[2] - btlbr[0] + 1) * (btlbr[3] - btlbr[1] + 1);
+  float iw = std::min(atlbr[2], btlbr[2]) - std::max(atlbr[0], btlbr[0]) + 1;
+  if (iw > 0) {
+    float ih = std::min(atlbr[3], btlbr[3]) - std::max(atlbr[1], btlbr[1]) + 1;
+    if (ih > 0) {
+      float ua = (atlbr[2] - atlbr[0] + 1) * (atlbr[3] - atlbr[1] + 1) + box_area - iw * ih;
+      return iw * ih / ua;
+    }
+  }
+  return 0.0;
+}
+
+template <class TracksT>
+void calc_iou_distance(
+  const TracksT & atracks, const std::vector<STrack> & btracks, std::vector<float> & cost_matrix)
+{
+  cost_matrix.clear();
+  if (atracks.size() * btracks.size() == 0) return;
+
+  cost_matrix.resize(atracks.size() * btracks.size());
+  for (size_t i = 0; i < atracks.size(); i++) {
+    const auto & atlbr = get_track(atracks[i]).tlbr;
+    for (size_t j = 0; j < btracks.size(); j++) {
+      cost_matrix[i * btracks.size() + j] = 1 - calc_iou(atlbr, btracks[j].tlbr);
+    }
+  }
+}
+}  // namespace
+
 std::vector<STrack *> ByteTracker::joint_stracks(
   std::vector<STrack *> & tlista, std::vector<STrack> & tlistb)
 {
@@ -106,11 +150,11 @@ void ByteTracker::remove_duplicate_stracks(
   std::vector<STrack> & resa, std::vector<STrack> & resb, std::vector<STrack> & stracksa,
   std::vector<STrack> & stracksb)
 {
-  std::vector<std::vector<float>> pdist = iou_distance(stracksa, stracksb);
+  iou_distance(stracksa, stracksb, dists);
   std::vector<std::pair<int, int>> pairs;
-  for (size_t i = 0; i < pdist.size(); i++) {
-    for (size_t j = 0; j < pdist[i].size(); j++) {
-      if (pdist[i][j] < 0.15) {
+  for (size_t i = 0; i < stracksa.size(); i++) {
+    for (size_t j = 0; j < stracksb.size(); j++) {
+      if (dists[i * stracksb.size() + j] < 0.15) {
         pairs.push_back(std::pair<int, int>(i, j));
       }
     }
@@ -142,8 +186,8 @@ void ByteTracker::remove_duplicate_stracks(
 }
 
 void ByteTracker::linear_assignment(
-  std::vector<std::vector<float>> & cost_matrix, int cost_matrix_size, int cost_matrix_size_size,
-  float thresh, std::vector<std::vector<int>> & matches, std::vector<int> & unmatched_a,
+  const std::vector<float> & cost_matrix, int cost_matrix_size, int cost_matrix_size_size,
+  float thresh, std::vector<MATCH_DATA> & matches, std::vector<int> & unmatched_a,
   std::vector<int> & unmatched_b)
 {
   if (cost_matrix.size() == 0) {
@@ -156,15 +200,11 @@ void ByteTracker::linear_assignment(
     return;
   }
 
-  std::vector<int> rowsol;
-  std::vector<int> colsol;
-  [[maybe_unused]] float c = lapjv(cost_matrix, rowsol, colsol, true, thresh);
+  [[maybe_unused]] float c =
+    lapjv(cost_matrix, cost_matrix_size, cost_matrix_size_size, rowsol, colsol, true, thresh);
   for (size_t i = 0; i < rowsol.size(); i++) {
     if (rowsol[i] >= 0) {
-      std::vector<int> match;
-      match.push_back(i);
-      match.push_back(rowsol[i]);
-      matches.push_back(match);
+      matches.push_back(MATCH_DATA(i, rowsol[i]));
     } else {
       unmatched_a.push_back(i);
     }
@@ -177,112 +217,28 @@ void ByteTracker::linear_assignment(
   }
 }
 
-std::vector<std::vector<float>> ByteTracker::ious(
-  std::vector<std::vector<float>> & atlbrs, std::vector<std::vector<float>> & btlbrs)
-{
-  std::vector<std::vector<float>> ious;
-  if (atlbrs.size() * btlbrs.size() == 0) return ious;
-
-  ious.resize(atlbrs.size());
-  for (size_t i = 0; i < ious.size(); i++) {
-    ious[i].resize(btlbrs.size());
-  }
-
-  // bbox_ious
-  for (size_t k = 0; k < btlbrs.size(); k++) {
-    std::vector<float> ious_tmp;
-    float box_area = (btlbrs[k][2] - btlbrs[k][0] + 1) * (btlbrs[k][3] - btlbrs[k][1] + 1);
-    for (size_t n = 0; n < atlbrs.size(); n++) {
-      float iw = std::min(atlbrs[n][2], btlbrs[k][2]) - std::max(atlbrs[n][0], btlbrs[k][0]) + 1;
-      if (iw > 0) {
-        float ih = std::min(atlbrs[n][3], btlbrs[k][3]) - std::max(atlbrs[n][1], btlbrs[k][1]) + 1;
-        if (ih > 0) {
-          float ua = (atlbrs[n][2] - atlbrs[n][0] + 1) * (atlbrs[n][3] - atlbrs[n][1] + 1) +
-                     box_area - iw * ih;
-          ious[n][k] = iw * ih / ua;
-        } else {
-          ious[n][k] = 0.0;
-        }
-      } else {
-        ious[n][k] = 0.0;
-      }
-    }
-  }
-
-  return ious;
-}
-
-std::vector<std::vector<float>> ByteTracker::iou_distance(
-  std::vector<STrack *> & atracks, std::vector<STrack> & btracks, int & dist_size,
-  int & dist_size_size)
+void ByteTracker::iou_distance(
+  const std::vector<STrack *> & atracks, const std::vector<STrack> & btracks,
+  std::vector<float> & cost_matrix, int & dist_size, int & dist_size_size)
 {
-  std::vector<std::vector<float>> cost_matrix;
-  if (atracks.size() * btracks.size() == 0) {
-    dist_size = atracks.size();
-    dist_size_size = btracks.size();
-    return cost_matrix;
-  }
-  std::vector<std::vector<float>> atlbrs, btlbrs;
-  for (size_t i = 0; i < atracks.size(); i++) {
-    atlbrs.push_back(atracks[i]->tlbr);
-  }
-  for (size_t i = 0; i < btracks.size(); i++) {
-    btlbrs.push_back(btracks[i].tlbr);
-  }
-
   dist_size = atracks.size();
   dist_size_size = btracks.size();
-
-  std::vector<std::vector<float>> _ious = ious(atlbrs, btlbrs);
-
-  for (size_t i = 0; i < _ious.size(); i++) {
-    std::vector<float> _iou;
-    for (size_t j = 0; j < _ious[i].size(); j++) {
-      _iou.push_back(1 - _ious[i][j]);
-    }
-    cost_matrix.push_back(_iou);
-  }
-
-  return cost_matrix;
+  calc_iou_distance(atracks, btracks, cost_matrix);
 }
 
-std::vector<std::vector<float>> ByteTracker::iou_distance(
-  std::vector<STrack> & atracks, std::vector<STrack> & btracks)
+void ByteTracker::iou_distance(
+  const std::vector<STrack> & atracks, const std::vector<STrack> & btracks,
+  std::vector<float> & cost_matrix)
 {
-  std::vector<std::vector<float>> atlbrs, btlbrs;
-  for (size_t i = 0; i < atracks.size(); i++) {
-    atlbrs.push_back(atracks[i].tlbr);
-  }
-  for (size_t i = 0; i < btracks.size(); i++) {
-    btlbrs.push_back(btracks[i].tlbr);
-  }
-
-  std::vector<std::vector<float>> _ious = ious(atlbrs, btlbrs);
-  std::vector<std::vector<float>> cost_matrix;
-  for (size_t i = 0; i < _ious.size(); i++) {
-    std::vector<float> _iou;
-    for (size_t j = 0; j < _ious[i].size(); j++) {
-      _iou.push_back(1 - _ious[i][j]);
-    }
-    cost_matrix.push_back(_iou);
-  }
-
-  return cost_matrix;
+  calc_iou_distance(atracks, btracks, cost_matrix);
 }
 
 double ByteTracker::lapjv(
-  const std::vector<std::vector<float>> & cost, std::vector<int> & rowsol,
+  const std::vector<float> & cost, int n_rows, int n_cols, std::vector<int> & rowsol,
   std::vector<int> & colsol, bool extend_cost, float cost_limit, bool return_cost)
 {
-  std::vector<std::vector<float>> cost_c;
-  cost_c.assign(cost.begin(), cost.end());
-
-  std::vector<std::vector<float>> cost_c_extended;
-
-  int n_rows = cost.size();
-  int n_cols = cost[0].size();
-  rowsol.resize(n_rows);
-  colsol.resize(n_cols);
+  rowsol.assign(n_rows, 0);
+  colsol.assign(n_cols, 0);
 
   int n = 0;
   if (n_rows == n_cols) {
@@ -295,60 +251,55 @@ double ByteTracker::lapjv(
     }
   }
 
-  if (extend_cost || cost_limit < LONG_MAX) {
+  // the square cost matrix is built in flat buffers which are kept between the calls
+  const bool is_extended = extend_cost || cost_limit < LONG_MAX;
+  if (is_extended) {
     n = n_rows + n_cols;
-    cost_c_extended.resize(n);
-    for (size_t i = 0; i < cost_c_extended.size(); i++) cost_c_extended[i].resize(n);
+  }
+  lapjv_cost.resize(static_cast<size_t>(n) * n);
+  lapjv_cost_rows.resize(n);
+  for (int i = 0; i < n; i++) {
+    lapjv_cost_rows[i] = lapjv_cost.data() + static_cast<size_t>(i) * n;
+  }
+  double ** cost_ptr = lapjv_cost_rows.data();
 
+  if (is_extended) {
+    float extended_cost;
     if (cost_limit < LONG_MAX) {
-      for (size_t i = 0; i < cost_c_extended.size(); i++) {
-        for (size_t j = 0; j < cost_c_extended[i].size(); j++) {
-          cost_c_extended[i][j] = cost_limit / 2.0;
-        }
-      }
+      extended_cost = cost_limit / 2.0;
     } else {
       float cost_max = -1;
-      for (size_t i = 0; i < cost_c.size(); i++) {
-        for (size_t j = 0; j < cost_c[i].size(); j++) {
-          if (cost_c[i][j] > cost_max) cost_max = cost_c[i][j];
-        }
-      }
-      for (size_t i = 0; i < cost_c_extended.size(); i++) {
-        for (size_t j = 0; j < cost_c_extended[i].size(); j++) {
-          cost_c_extended[i][j] = cost_max + 1;
-        }
+      for (size_t i = 0; i < cost.size(); i++) {
+        if (cost[i] > cost_max) cost_max = cost[i];
       }
+      extended_cost = cost_max + 1;
     }
 
-    for (size_t i = n_rows; i < cost_c_extended.size(); i++) {
-      for (size_t j = n_cols; j < cost_c_extended[i].size(); j++) {
-        cost_c_extended[i][j] = 0;
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) {
+        if (i < n_rows && j < n_cols) {
+          cost_ptr[i][j] = cost[i * n_cols + j];
+        } else if (i >= n_rows && j >= n_cols) {
+          cost_ptr[i][j] = 0;
+        } else {
+          cost_ptr[i][j] = extended_cost;
+        }
       }
     }
-    for (int i = 0; i < n_rows; i++) {
-      for (int j = 0; j < n_cols; j++) {
-        cost_c_extended[i][j] = cost_c[i][j];
+  } else {
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) {
+        cost_ptr[i][j] = cost[i * n_cols + j];
       }
     }
-
-    cost_c.clear();
-    cost_c.assign(cost_c_extended.begin(), cost_c_extended.end());
   }
 
-  double ** cost_ptr;
-  cost_ptr = new double *[sizeof(double *) * n];
-  for (int i = 0; i < n; i++) cost_ptr[i] = new double[sizeof(double) * n];
-
-  for (int i = 0; i < n; i++) {
-    for (int j = 0; j < n; j++) {
-      cost_ptr[i][j] = cost_c[i][j];
-    }
-  }
+  lapjv_x.resize(n);
+  lapjv_y.resize(n);
+  int * x_c = lapjv_x.data();
+  int * y_c = lapjv_y.data();
 
-  int * x_c = new int[sizeof(int) * n];
-  int * y_c = new int[sizeof(int) * n];
-
-  int ret = lapjv_internal(n, cost_ptr, x_c, y_c);
+  int ret = lapjv_internal(n, cost_ptr, x_c, y_c, lapjv_workspace);
   if (ret != 0) {
     std::cout << "Calculate Wrong!" << std::endl;
     // system("pause");
@@ -382,13 +333,6 @@ double ByteTracker::lapjv(
     }
   }
 
-  for (int i = 0; i < n; i++) {
-    delete[] cost_ptr[i];
-  }
-  delete[] cost_ptr;
-  delete[] x_c;
-  delete[] y_c;
-
   return opt;
 }
 
@@ -16,8 +16,10 @@
 
 #include "object_recognition_utils/object_recognition_utils.hpp"
 
+#include <iterator>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 namespace cluster_merger
 {
@@ -58,14 +60,15 @@ void ClusterMergerNode::objectsCallback(
     return;
   }
 
-  DetectedObjectsWithFeature output_objects;
-  output_objects.header = input_objects0_msg->header;
-  // add check frame id and transform if they are different
-  output_objects.feature_objects = transformed_objects0.feature_objects;
-  output_objects.feature_objects.insert(
-    output_objects.feature_objects.end(), transformed_objects1.feature_objects.begin(),
-    transformed_objects1.feature_objects.end());
-  pub_objects_->publish(output_objects);
+  // the transformed objects own their clusters, move them instead of copying
+  auto output_objects = std::make_unique<DetectedObjectsWithFeature>();
+  output_objects->header = input_objects0_msg->header;
+  output_objects->feature_objects = std::move(transformed_objects0.feature_objects);
+  output_objects->feature_objects.insert(
+    output_objects->feature_objects.end(),
+    std::make_move_iterator(transformed_objects1.feature_objects.begin()),
+    std::make_move_iterator(transformed_objects1.feature_objects.end()));
+  pub_objects_->publish(std::move(output_objects));
 }
 }  // namespace cluster_merger
 
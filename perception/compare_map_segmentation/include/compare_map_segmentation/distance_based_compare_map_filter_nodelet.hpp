@@ -94,8 +94,10 @@ public:
     current_voxel_grid_list_item.map_cell_kdtree = tree_tmp;
 
     // add
+    const auto current_voxel_grid_list_item_ptr =
+      std::make_shared<MapGridVoxelInfo>(std::move(current_voxel_grid_list_item));
     (*mutex_ptr_).lock();
-    current_voxel_grid_dict_.insert({map_cell_to_add.cell_id, current_voxel_grid_list_item});
+    current_voxel_grid_dict_.insert({map_cell_to_add.cell_id, current_voxel_grid_list_item_ptr});
     (*mutex_ptr_).unlock();
   }
 };
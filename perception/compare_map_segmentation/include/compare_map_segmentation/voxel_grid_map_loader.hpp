@@ -118,6 +118,9 @@ public:
   bool is_in_voxel(
     const pcl::PointXYZ & src_point, const pcl::PointXYZ & target_point,
     const double distance_threshold, const PointCloudPtr & map, VoxelGridPointXYZ & voxel) const;
+  bool is_in_voxel(
+    const Eigen::Vector3i & voxel_coordinates, const pcl::PointXYZ & target_point,
+    const double distance_threshold, const PointCloudPtr & map, VoxelGridPointXYZ & voxel) const;
 
   void publish_downsampled_map(const pcl::PointCloud<pcl::PointXYZ> & downsampled_pc);
   bool is_close_points(
@@ -152,9 +155,9 @@ protected:
     pcl::search::Search<pcl::PointXYZ>::Ptr map_cell_kdtree;
   };
 
-  typedef typename std::map<std::string, struct MapGridVoxelInfo> VoxelGridDict;
+  typedef typename std::map<std::string, std::shared_ptr<MapGridVoxelInfo>> VoxelGridDict;
 
-  /** \brief Map to hold loaded map grid id and it's voxel filter */
+  /** \brief Map to hold loaded map grid id and it's voxel filter, shared with the grid array */
   VoxelGridDict current_voxel_grid_dict_;
   rclcpp::Subscription<nav_msgs::msg::Odometry>::SharedPtr sub_kinematic_state_;
 
@@ -208,7 +211,7 @@ public:
   {
     pcl::PointCloud<pcl::PointXYZ> output;
     for (const auto & kv : current_voxel_grid_dict_) {
-      output = output + *(kv.second.map_cell_pc_ptr);
+      output = output + *(kv.second->map_cell_pc_ptr);
     }
     return output;
   }
@@ -258,13 +261,13 @@ public:
       map_grids_x_ * map_grid_size_y_, std::make_shared<MapGridVoxelInfo>());
     for (const auto & kv : current_voxel_grid_dict_) {
       int index = static_cast<int>(
-        std::floor((kv.second.min_b_x - origin_x_) / map_grid_size_x_) +
-        map_grids_x_ * std::floor((kv.second.min_b_y - origin_y_) / map_grid_size_y_));
+        std::floor((kv.second->min_b_x - origin_x_) / map_grid_size_x_) +
+        map_grids_x_ * std::floor((kv.second->min_b_y - origin_y_) / map_grid_size_y_));
       // TODO(1222-takeshi): check if index is valid
       if (index >= map_grids_x_ * map_grids_y_ || index < 0) {
         continue;
       }
-      current_voxel_grid_array_.at(index) = std::make_shared<MapGridVoxelInfo>(kv.second);
+      current_voxel_grid_array_.at(index) = kv.second;
     }
     (*mutex_ptr_).unlock();
   }
@@ -313,8 +316,10 @@ public:
     current_voxel_grid_list_item.map_cell_pc_ptr.reset(new pcl::PointCloud<pcl::PointXYZ>);
     current_voxel_grid_list_item.map_cell_pc_ptr = std::move(map_cell_downsampled_pc_ptr_tmp);
     // add
+    const auto current_voxel_grid_list_item_ptr =
+      std::make_shared<MapGridVoxelInfo>(std::move(current_voxel_grid_list_item));
     (*mutex_ptr_).lock();
-    current_voxel_grid_dict_.insert({map_cell_to_add.cell_id, current_voxel_grid_list_item});
+    current_voxel_grid_dict_.insert({map_cell_to_add.cell_id, current_voxel_grid_list_item_ptr});
     (*mutex_ptr_).unlock();
   }
 };
@@ -76,157 +76,41 @@ bool VoxelGridMapLoader::is_close_to_neighbor_voxels(
   if (map == NULL) {
     return false;
   }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y, point.z), point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y - distance_threshold, point.z - distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y - distance_threshold, point.z), point, distance_threshold,
-        map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y - distance_threshold, point.z + distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y, point.z - distance_threshold_z), point, distance_threshold,
-        map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y, point.z + distance_threshold_z), point, distance_threshold,
-        map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y + distance_threshold, point.z - distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y + distance_threshold, point.z), point, distance_threshold,
-        map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y + distance_threshold, point.z + distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x - distance_threshold, point.y - distance_threshold,
-          point.z - distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x - distance_threshold, point.y - distance_threshold, point.z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x - distance_threshold, point.y - distance_threshold,
-          point.z + distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x - distance_threshold, point.y, point.z - distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x - distance_threshold, point.y, point.z), point, distance_threshold,
-        map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x - distance_threshold, point.y, point.z + distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x - distance_threshold, point.y + distance_threshold,
-          point.z - distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x - distance_threshold, point.y + distance_threshold, point.z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x - distance_threshold, point.y + distance_threshold,
-          point.z + distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x + distance_threshold, point.y - distance_threshold,
-          point.z - distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x + distance_threshold, point.y - distance_threshold, point.z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x + distance_threshold, point.y - distance_threshold,
-          point.z + distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x + distance_threshold, point.y, point.z - distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x + distance_threshold, point.y, point.z), point, distance_threshold,
-        map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x + distance_threshold, point.y, point.z + distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x + distance_threshold, point.y + distance_threshold,
-          point.z - distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x + distance_threshold, point.y + distance_threshold, point.z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x + distance_threshold, point.y + distance_threshold,
-          point.z + distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
+  // the grid coordinates are computed per axis, so the 27 neighbors are the product of the lower,
+  // center and upper coordinates of each axis and only distinct voxels need to be looked up
+  const Eigen::Vector3i center = voxel.getGridCoordinates(point.x, point.y, point.z);
+  if (is_in_voxel(center, point, distance_threshold, map, voxel)) {
+    return true;
+  }
+  const Eigen::Vector3i lower = voxel.getGridCoordinates(
+    static_cast<float>(point.x - distance_threshold),
+    static_cast<float>(point.y - distance_threshold),
+    static_cast<float>(point.z - distance_threshold_z));
+  const Eigen::Vector3i upper = voxel.getGridCoordinates(
+    static_cast<float>(point.x + distance_threshold),
+    static_cast<float>(point.y + distance_threshold),
+    static_cast<float>(point.z + distance_threshold_z));
+  for (int x = lower.x(); x <= upper.x(); ++x) {
+    if (x != lower.x() && x != center.x() && x != upper.x()) {
+      continue;
+    }
+    for (int y = lower.y(); y <= upper.y(); ++y) {
+      if (y != lower.y() && y != center.y() && y != upper.y()) {
+        continue;
+      }
+      for (int z = lower.z(); z <= upper.z(); ++z) {
+        if (z != lower.z() && z != center.z() && z != upper.z()) {
+          continue;
+        }
+        const Eigen::Vector3i coordinates(x, y, z);
+        if (coordinates == center) {
+          continue;
+        }
+        if (is_in_voxel(coordinates, point, distance_threshold, map, voxel)) {
+          return true;
+        }
+      }
+    }
   }
   return false;
 }
@@ -235,8 +119,16 @@ bool VoxelGridMapLoader::is_in_voxel(
   const pcl::PointXYZ & src_point, const pcl::PointXYZ & target_point,
   const double distance_threshold, const PointCloudPtr & map, VoxelGridPointXYZ & voxel) const
 {
-  int voxel_index =
-    voxel.getCentroidIndexAt(voxel.getGridCoordinates(src_point.x, src_point.y, src_point.z));
+  return is_in_voxel(
+    voxel.getGridCoordinates(src_point.x, src_point.y, src_point.z), target_point,
+    distance_threshold, map, voxel);
+}
+
+bool VoxelGridMapLoader::is_in_voxel(
+  const Eigen::Vector3i & voxel_coordinates, const pcl::PointXYZ & target_point,
+  const double distance_threshold, const PointCloudPtr & map, VoxelGridPointXYZ & voxel) const
+{
+  int voxel_index = voxel.getCentroidIndexAt(voxel_coordinates);
   if (voxel_index != -1) {  // not empty voxel
     const double dist_x = map->points.at(voxel_index).x - target_point.x;
     const double dist_y = map->points.at(voxel_index).y - target_point.y;
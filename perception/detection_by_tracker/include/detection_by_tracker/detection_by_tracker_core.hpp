@@ -45,6 +45,8 @@
 #include <deque>
 #include <map>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 class TrackerHandler
@@ -82,6 +84,10 @@ private:
   std::map<uint8_t, int> max_search_distance_for_divider_;
 
   bool ignore_unknown_tracker_;
+  bool reuse_previous_cluster_range_;
+  int num_threads_;
+  // iteration of the cluster range search which divided each tracker in the last frame
+  std::unordered_map<std::string, int> previous_iter_counts_;
 
   void setMaxSearchRange();
 
@@ -90,19 +96,25 @@ private:
 
   void divideUnderSegmentedObjects(
     const autoware_auto_perception_msgs::msg::DetectedObjects & tracked_objects,
+    const std::vector<std::string> & tracked_uuids,
     const tier4_perception_msgs::msg::DetectedObjectsWithFeature & in_objects,
+    const std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> & in_clusters,
     autoware_auto_perception_msgs::msg::DetectedObjects & out_no_found_tracked_objects,
     tier4_perception_msgs::msg::DetectedObjectsWithFeature & out_objects);
 
   float optimizeUnderSegmentedObject(
     const autoware_auto_perception_msgs::msg::DetectedObject & target_object,
-    const sensor_msgs::msg::PointCloud2 & under_segmented_cluster,
-    tier4_perception_msgs::msg::DetectedObjectWithFeature & output);
+    const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & under_segmented_cluster,
+    const std_msgs::msg::Header & header, const int initial_iter_count,
+    tier4_perception_msgs::msg::DetectedObjectWithFeature & output, int & output_iter_count);
 
   void mergeOverSegmentedObjects(
     const autoware_auto_perception_msgs::msg::DetectedObjects & tracked_objects,
+    const std::vector<std::string> & tracked_uuids,
     const tier4_perception_msgs::msg::DetectedObjectsWithFeature & in_objects,
+    const std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> & in_clusters,
     autoware_auto_perception_msgs::msg::DetectedObjects & out_no_found_tracked_objects,
+    std::vector<std::string> & out_no_found_tracked_uuids,
     tier4_perception_msgs::msg::DetectedObjectsWithFeature & out_objects);
 };
 
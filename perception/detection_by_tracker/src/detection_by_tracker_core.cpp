@@ -18,11 +18,19 @@
 
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 #include <tier4_autoware_utils/math/unit_conversion.hpp>
+#include <tier4_autoware_utils/ros/uuid_helper.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #define EIGEN_MPL2_ONLY
@@ -78,6 +86,25 @@ boost::optional<ReferenceShapeSizeInfo> getReferenceShapeSizeInfo(
     return boost::none;
   }
 }
+
+void runInParallel(
+  const size_t size, const size_t nb_threads, const std::function<void(size_t)> & function)
+{
+  std::atomic<size_t> next_idx{0};
+  const auto work = [&]() {
+    for (auto idx = next_idx++; idx < size; idx = next_idx++) {
+      function(idx);
+    }
+  };
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < std::min(nb_threads, size); ++i) {
+    workers.emplace_back(work);
+  }
+  work();
+  for (auto & worker : workers) {
+    worker.join();
+  }
+}
 }  // namespace
 
 void TrackerHandler::onTrackedObjects(
@@ -161,6 +188,8 @@ DetectionByTracker::DetectionByTracker(const rclcpp::NodeOptions & node_options)
     "~/output", rclcpp::QoS{1});
 
   ignore_unknown_tracker_ = declare_parameter<bool>("ignore_unknown_tracker", true);
+  reuse_previous_cluster_range_ = declare_parameter<bool>("reuse_previous_cluster_range", false);
+  num_threads_ = std::max<int>(declare_parameter<int>("num_threads", 1), 1);
 
   // set maximum search setting for merger/divider
   setMaxSearchRange();
@@ -203,6 +232,7 @@ void DetectionByTracker::onObjects(
 
   // get objects from tracking module
   autoware_auto_perception_msgs::msg::DetectedObjects tracked_objects;
+  std::vector<std::string> tracked_uuids;
   {
     autoware_auto_perception_msgs::msg::TrackedObjects objects, transformed_objects;
     const bool available_trackers =
@@ -216,21 +246,36 @@ void DetectionByTracker::onObjects(
     }
     // to simplify post processes, convert tracked_objects to DetectedObjects message.
     tracked_objects = object_recognition_utils::toDetectedObjects(transformed_objects);
+    for (const auto & object : transformed_objects.objects) {
+      tracked_uuids.push_back(tier4_autoware_utils::toHexString(object.object_id));
+    }
   }
   debugger_->publishInitialObjects(*input_msg);
   debugger_->publishTrackedObjects(tracked_objects);
 
+  // convert the clusters once, they are shared by all the trackers
+  std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> initial_clusters;
+  initial_clusters.reserve(input_msg->feature_objects.size());
+  for (const auto & initial_object : input_msg->feature_objects) {
+    initial_clusters.emplace_back(new pcl::PointCloud<pcl::PointXYZ>);
+    pcl::fromROSMsg(initial_object.feature.cluster, *initial_clusters.back());
+  }
+
   // merge over segmented objects
   tier4_perception_msgs::msg::DetectedObjectsWithFeature merged_objects;
   autoware_auto_perception_msgs::msg::DetectedObjects no_found_tracked_objects;
-  mergeOverSegmentedObjects(tracked_objects, *input_msg, no_found_tracked_objects, merged_objects);
+  std::vector<std::string> no_found_tracked_uuids;
+  mergeOverSegmentedObjects(
+    tracked_objects, tracked_uuids, *input_msg, initial_clusters, no_found_tracked_objects,
+    no_found_tracked_uuids, merged_objects);
   debugger_->publishMergedObjects(merged_objects);
 
   // divide under segmented objects
   tier4_perception_msgs::msg::DetectedObjectsWithFeature divided_objects;
   autoware_auto_perception_msgs::msg::DetectedObjects temp_no_found_tracked_objects;
   divideUnderSegmentedObjects(
-    no_found_tracked_objects, *input_msg, temp_no_found_tracked_objects, divided_objects);
+    no_found_tracked_objects, no_found_tracked_uuids, *input_msg, initial_clusters,
+    temp_no_found_tracked_objects, divided_objects);
   debugger_->publishDividedObjects(divided_objects);
 
   // merge under/over segmented objects to build output objects
@@ -246,7 +291,9 @@ void DetectionByTracker::onObjects(
 
 void DetectionByTracker::divideUnderSegmentedObjects(
   const autoware_auto_perception_msgs::msg::DetectedObjects & tracked_objects,
+  const std::vector<std::string> & tracked_uuids,
   const tier4_perception_msgs::msg::DetectedObjectsWithFeature & in_cluster_objects,
+  const std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> & in_clusters,
   autoware_auto_perception_msgs::msg::DetectedObjects & out_no_found_tracked_objects,
   tier4_perception_msgs::msg::DetectedObjectsWithFeature & out_objects)
 {
@@ -257,18 +304,35 @@ void DetectionByTracker::divideUnderSegmentedObjects(
   out_objects.header = in_cluster_objects.header;
   out_no_found_tracked_objects.header = tracked_objects.header;
 
-  for (const auto & tracked_object : tracked_objects.objects) {
-    const auto & label = tracked_object.classification.front().label;
-    if (ignore_unknown_tracker_ && (label == Label::UNKNOWN)) continue;
+  // change search range according to label type
+  const size_t nb_trackers = tracked_objects.objects.size();
+  std::vector<float> max_search_ranges(nb_trackers);
+  std::vector<int> initial_iter_counts(nb_trackers, 0);
+  for (size_t tracker_idx = 0; tracker_idx < nb_trackers; ++tracker_idx) {
+    const auto & label = tracked_objects.objects.at(tracker_idx).classification.front().label;
+    max_search_ranges.at(tracker_idx) = max_search_distance_for_divider_[label];
+    const auto previous_iter_count = previous_iter_counts_.find(tracked_uuids.at(tracker_idx));
+    if (reuse_previous_cluster_range_ && previous_iter_count != previous_iter_counts_.end()) {
+      // start one step coarser than the last optimum, so that the range can also grow back
+      initial_iter_counts.at(tracker_idx) = std::max(previous_iter_count->second - 1, 0);
+    }
+  }
 
-    // change search range according to label type
-    const float max_search_range = max_search_distance_for_divider_[label];
+  // the trackers are independent, so they are divided in parallel and gathered in order
+  std::vector<std::optional<tier4_perception_msgs::msg::DetectedObjectWithFeature>>
+    highest_score_divided_objects(nb_trackers);
+  std::vector<int> highest_score_iter_counts(nb_trackers, 0);
+  runInParallel(nb_trackers, num_threads_, [&](const size_t tracker_idx) {
+    const auto & tracked_object = tracked_objects.objects.at(tracker_idx);
+    const auto & label = tracked_object.classification.front().label;
+    if (ignore_unknown_tracker_ && (label == Label::UNKNOWN)) return;
 
-    std::optional<tier4_perception_msgs::msg::DetectedObjectWithFeature>
-      highest_score_divided_object = std::nullopt;
+    const float max_search_range = max_search_ranges.at(tracker_idx);
     float highest_score = 0.0;
 
-    for (const auto & initial_object : in_cluster_objects.feature_objects) {
+    for (size_t initial_idx = 0; initial_idx < in_cluster_objects.feature_objects.size();
+         ++initial_idx) {
+      const auto & initial_object = in_cluster_objects.feature_objects.at(initial_idx);
       // search near object
       const float distance = tier4_autoware_utils::calcDistance2d(
         tracked_object.kinematics.pose_with_covariance.pose,
@@ -288,36 +352,50 @@ void DetectionByTracker::divideUnderSegmentedObjects(
       }
       // optimize clustering
       tier4_perception_msgs::msg::DetectedObjectWithFeature divided_object;
+      int iter_count = 0;
       float score = optimizeUnderSegmentedObject(
-        tracked_object, initial_object.feature.cluster, divided_object);
+        tracked_object, in_clusters.at(initial_idx), initial_object.feature.cluster.header,
+        initial_iter_counts.at(tracker_idx), divided_object, iter_count);
       if (score < min_score_threshold) {
         continue;
       }
 
       if (highest_score < score) {
         highest_score = score;
-        highest_score_divided_object = divided_object;
+        highest_score_divided_objects.at(tracker_idx) = divided_object;
+        highest_score_iter_counts.at(tracker_idx) = iter_count;
       }
     }
-    if (highest_score_divided_object) {  // found
-      out_objects.feature_objects.push_back(highest_score_divided_object.value());
+  });
+
+  std::unordered_map<std::string, int> iter_counts;
+  for (size_t tracker_idx = 0; tracker_idx < nb_trackers; ++tracker_idx) {
+    const auto & tracked_object = tracked_objects.objects.at(tracker_idx);
+    const auto & label = tracked_object.classification.front().label;
+    if (ignore_unknown_tracker_ && (label == Label::UNKNOWN)) continue;
+
+    if (highest_score_divided_objects.at(tracker_idx)) {  // found
+      out_objects.feature_objects.push_back(highest_score_divided_objects.at(tracker_idx).value());
+      iter_counts[tracked_uuids.at(tracker_idx)] = highest_score_iter_counts.at(tracker_idx);
     } else {  // not found
       out_no_found_tracked_objects.objects.push_back(tracked_object);
     }
   }
+  previous_iter_counts_ = std::move(iter_counts);
 }
 
 float DetectionByTracker::optimizeUnderSegmentedObject(
   const autoware_auto_perception_msgs::msg::DetectedObject & target_object,
-  const sensor_msgs::msg::PointCloud2 & under_segmented_cluster,
-  tier4_perception_msgs::msg::DetectedObjectWithFeature & output)
+  const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & under_segmented_cluster,
+  const std_msgs::msg::Header & header, const int initial_iter_count,
+  tier4_perception_msgs::msg::DetectedObjectWithFeature & output, int & output_iter_count)
 {
   constexpr float iter_rate = 0.8;
   constexpr int iter_max_count = 5;
   constexpr float initial_cluster_range = 0.7;
-  float cluster_range = initial_cluster_range;
+  float cluster_range = initial_cluster_range * std::pow(iter_rate, initial_iter_count);
   constexpr float initial_voxel_size = initial_cluster_range / 2.0f;
-  float voxel_size = initial_voxel_size;
+  float voxel_size = initial_voxel_size * std::pow(iter_rate, initial_iter_count);
 
   const auto & label = target_object.classification.front().label;
 
@@ -325,20 +403,17 @@ float DetectionByTracker::optimizeUnderSegmentedObject(
   euclidean_cluster::VoxelGridBasedEuclideanCluster cluster(
     false, 4, 10000, initial_cluster_range, initial_voxel_size, 0);
 
-  // convert to pcl
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_cluster(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::fromROSMsg(under_segmented_cluster, *pcl_cluster);
-
   // iterate to find best fit divided object
   float highest_iou = 0.0;
   tier4_perception_msgs::msg::DetectedObjectWithFeature highest_iou_object;
-  for (int iter_count = 0; iter_count < iter_max_count;
+  output_iter_count = initial_iter_count;
+  for (int iter_count = initial_iter_count; iter_count < iter_max_count;
        ++iter_count, cluster_range *= iter_rate, voxel_size *= iter_rate) {
     // divide under segmented cluster
     std::vector<pcl::PointCloud<pcl::PointXYZ>> divided_clusters;
     cluster.setTolerance(cluster_range);
     cluster.setVoxelLeafSize(voxel_size);
-    cluster.cluster(pcl_cluster, divided_clusters);
+    cluster.cluster(under_segmented_cluster, divided_clusters);
 
     // find highest iou object in divided clusters
     float highest_iou_in_current_iter = 0.0f;
@@ -359,8 +434,7 @@ float DetectionByTracker::optimizeUnderSegmentedObject(
         highest_iou_object_in_current_iter.object, target_object);
       if (highest_iou_in_current_iter < iou) {
         highest_iou_in_current_iter = iou;
-        setClusterInObjectWithFeature(
-          under_segmented_cluster.header, divided_cluster, highest_iou_object_in_current_iter);
+        setClusterInObjectWithFeature(header, divided_cluster, highest_iou_object_in_current_iter);
       }
     }
 
@@ -372,6 +446,7 @@ float DetectionByTracker::optimizeUnderSegmentedObject(
     // copy for next iteration
     highest_iou = highest_iou_in_current_iter;
     highest_iou_object = highest_iou_object_in_current_iter;
+    output_iter_count = iter_count;
   }
 
   // build output
@@ -385,15 +460,19 @@ float DetectionByTracker::optimizeUnderSegmentedObject(
 
 void DetectionByTracker::mergeOverSegmentedObjects(
   const autoware_auto_perception_msgs::msg::DetectedObjects & tracked_objects,
+  const std::vector<std::string> & tracked_uuids,
   const tier4_perception_msgs::msg::DetectedObjectsWithFeature & in_cluster_objects,
+  const std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> & in_clusters,
   autoware_auto_perception_msgs::msg::DetectedObjects & out_no_found_tracked_objects,
+  std::vector<std::string> & out_no_found_tracked_uuids,
   tier4_perception_msgs::msg::DetectedObjectsWithFeature & out_objects)
 {
   constexpr float precision_threshold = 0.5;
   out_objects.header = in_cluster_objects.header;
   out_no_found_tracked_objects.header = tracked_objects.header;
 
-  for (const auto & tracked_object : tracked_objects.objects) {
+  for (size_t tracker_idx = 0; tracker_idx < tracked_objects.objects.size(); ++tracker_idx) {
+    const auto & tracked_object = tracked_objects.objects.at(tracker_idx);
     const auto & label = tracked_object.classification.front().label;
     if (ignore_unknown_tracker_ && (label == Label::UNKNOWN)) continue;
 
@@ -405,7 +484,9 @@ void DetectionByTracker::mergeOverSegmentedObjects(
     extended_tracked_object.shape = extendShape(tracked_object.shape, /*scale*/ 1.1);
 
     pcl::PointCloud<pcl::PointXYZ> pcl_merged_cluster;
-    for (const auto & initial_object : in_cluster_objects.feature_objects) {
+    for (size_t initial_idx = 0; initial_idx < in_cluster_objects.feature_objects.size();
+         ++initial_idx) {
+      const auto & initial_object = in_cluster_objects.feature_objects.at(initial_idx);
       const float distance = tier4_autoware_utils::calcDistance2d(
         tracked_object.kinematics.pose_with_covariance.pose,
         initial_object.object.kinematics.pose_with_covariance.pose);
@@ -420,13 +501,12 @@ void DetectionByTracker::mergeOverSegmentedObjects(
       if (precision < precision_threshold) {
         continue;
       }
-      pcl::PointCloud<pcl::PointXYZ> pcl_cluster;
-      pcl::fromROSMsg(initial_object.feature.cluster, pcl_cluster);
-      pcl_merged_cluster += pcl_cluster;
+      pcl_merged_cluster += *in_clusters.at(initial_idx);
     }
 
     if (pcl_merged_cluster.points.empty()) {  // if clusters aren't found
       out_no_found_tracked_objects.objects.push_back(tracked_object);
+      out_no_found_tracked_uuids.push_back(tracked_uuids.at(tracker_idx));
       continue;
     }
 
@@ -442,6 +522,7 @@ void DetectionByTracker::mergeOverSegmentedObjects(
       feature_object.object.kinematics.pose_with_covariance.pose);
     if (!is_shape_estimated) {
       out_no_found_tracked_objects.objects.push_back(tracked_object);
+      out_no_found_tracked_uuids.push_back(tracked_uuids.at(tracker_idx));
       continue;
     }
 
@@ -41,12 +41,19 @@ public:
   {
     min_points_number_per_voxel_ = min_points_number_per_voxel;
   }
+  void setUseGridConnectivity(bool use_grid_connectivity)
+  {
+    use_grid_connectivity_ = use_grid_connectivity;
+  }
+  void setNumThreads(int num_threads) { num_threads_ = num_threads; }
 
 private:
   pcl::VoxelGrid<pcl::PointXYZ> voxel_grid_;
   float tolerance_;
   float voxel_leaf_size_;
   int min_points_number_per_voxel_;
+  bool use_grid_connectivity_ = false;
+  int num_threads_ = 1;
 };
 
 }  // namespace euclidean_cluster
@@ -17,10 +17,145 @@
 #include <pcl/kdtree/kdtree.h>
 #include <pcl/segmentation/extract_clusters.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <thread>
 #include <unordered_map>
+#include <utility>
 
 namespace euclidean_cluster
 {
+namespace
+{
+int findRoot(std::vector<int> & parents, int node)
+{
+  while (parents.at(node) != node) {
+    parents.at(node) = parents.at(parents.at(node));
+    node = parents.at(node);
+  }
+  return node;
+}
+
+/**
+ * @brief same clusters as pcl::EuclideanClusterExtraction but the neighbors of each point are
+ * looked up in a grid whose cells are as large as the tolerance
+ * @details The grid is split into columns of cells searched by separate threads, and the pairs of
+ * points closer than the tolerance are merged by a union-find afterwards.
+ */
+std::vector<pcl::PointIndices> extractClustersOnGrid(
+  const pcl::PointCloud<pcl::PointXYZ> & pointcloud, const float tolerance,
+  const int max_cluster_size, const int num_threads)
+{
+  // a slightly larger cell keeps rounding errors from putting close points two cells apart
+  const float inverse_cell_size = 1.0f / (tolerance * 1.001f);
+  const auto getCellKey = [](const int64_t x, const int64_t y) {
+    return (x << 32) ^ static_cast<uint32_t>(y);
+  };
+
+  // points sorted by cell, and the range of points in each cell
+  std::vector<std::pair<int64_t, int>> sorted_points;
+  sorted_points.reserve(pointcloud.size());
+  for (size_t i = 0; i < pointcloud.size(); ++i) {
+    const auto x = static_cast<int64_t>(std::floor(pointcloud.points.at(i).x * inverse_cell_size));
+    const auto y = static_cast<int64_t>(std::floor(pointcloud.points.at(i).y * inverse_cell_size));
+    sorted_points.emplace_back(getCellKey(x, y), i);
+  }
+  std::sort(sorted_points.begin(), sorted_points.end());
+  std::vector<size_t> cell_begins;
+  std::unordered_map<int64_t, size_t> cell_indices;
+  for (size_t i = 0; i < sorted_points.size(); ++i) {
+    if (i == 0 || sorted_points.at(i).first != sorted_points.at(i - 1).first) {
+      cell_indices.emplace(sorted_points.at(i).first, cell_begins.size());
+      cell_begins.push_back(i);
+    }
+  }
+  cell_begins.push_back(sorted_points.size());
+
+  // search the pairs of close points, each pair of cells is checked once
+  const float squared_tolerance = tolerance * tolerance;
+  const size_t nb_cells = cell_begins.size() - 1;
+  const size_t nb_workers = std::clamp<size_t>(num_threads, 1, std::max<size_t>(nb_cells, 1));
+  std::vector<std::vector<std::pair<int, int>>> edges(nb_workers);
+  const auto searchEdges = [&](const size_t worker_idx) {
+    auto & worker_edges = edges.at(worker_idx);
+    const size_t cell_begin = nb_cells * worker_idx / nb_workers;
+    const size_t cell_end = nb_cells * (worker_idx + 1) / nb_workers;
+    for (size_t cell_idx = cell_begin; cell_idx < cell_end; ++cell_idx) {
+      const int64_t key = sorted_points.at(cell_begins.at(cell_idx)).first;
+      const int64_t x = key >> 32;
+      const auto y = static_cast<int32_t>(static_cast<uint32_t>(key));
+      for (const auto & [dx, dy] :
+           {std::make_pair(0, 0), std::make_pair(0, 1), std::make_pair(1, -1),
+            std::make_pair(1, 0), std::make_pair(1, 1)}) {
+        const auto neighbor_cell = cell_indices.find(getCellKey(x + dx, y + dy));
+        if (neighbor_cell == cell_indices.end()) {
+          continue;
+        }
+        for (size_t i = cell_begins.at(cell_idx); i < cell_begins.at(cell_idx + 1); ++i) {
+          const auto & p = pointcloud.points.at(sorted_points.at(i).second);
+          // points of the same cell are paired with the following ones only
+          const size_t j_begin = neighbor_cell->second == cell_idx
+                                   ? i + 1
+                                   : cell_begins.at(neighbor_cell->second);
+          for (size_t j = j_begin; j < cell_begins.at(neighbor_cell->second + 1); ++j) {
+            const auto & q = pointcloud.points.at(sorted_points.at(j).second);
+            const float dx_p = p.x - q.x;
+            const float dy_p = p.y - q.y;
+            const float dz_p = p.z - q.z;
+            if (dx_p * dx_p + dy_p * dy_p + dz_p * dz_p <= squared_tolerance) {
+              worker_edges.emplace_back(sorted_points.at(i).second, sorted_points.at(j).second);
+            }
+          }
+        }
+      }
+    }
+  };
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < nb_workers; ++i) {
+    workers.emplace_back(searchEdges, i);
+  }
+  searchEdges(0);
+  for (auto & worker : workers) {
+    worker.join();
+  }
+
+  // merge the clusters found by all the threads
+  std::vector<int> parents(pointcloud.size());
+  std::iota(parents.begin(), parents.end(), 0);
+  for (const auto & worker_edges : edges) {
+    for (const auto & [i, j] : worker_edges) {
+      parents.at(findRoot(parents, i)) = findRoot(parents, j);
+    }
+  }
+
+  // clusters are ordered by their first point, then by size as pcl does
+  std::vector<pcl::PointIndices> cluster_indices;
+  std::vector<int> root_to_cluster(pointcloud.size(), -1);
+  for (size_t i = 0; i < pointcloud.size(); ++i) {
+    const int root = findRoot(parents, i);
+    if (root_to_cluster.at(root) < 0) {
+      root_to_cluster.at(root) = cluster_indices.size();
+      cluster_indices.emplace_back();
+    }
+    cluster_indices.at(root_to_cluster.at(root)).indices.push_back(i);
+  }
+  cluster_indices.erase(
+    std::remove_if(
+      cluster_indices.begin(), cluster_indices.end(),
+      [&](const auto & cluster) {
+        return static_cast<int>(cluster.indices.size()) > max_cluster_size;
+      }),
+    cluster_indices.end());
+  std::stable_sort(
+    cluster_indices.begin(), cluster_indices.end(),
+    [](const auto & a, const auto & b) { return a.indices.size() > b.indices.size(); });
+  return cluster_indices;
+}
+}  // namespace
+
 VoxelGridBasedEuclideanCluster::VoxelGridBasedEuclideanCluster()
 {
 }
@@ -65,19 +200,24 @@ bool VoxelGridBasedEuclideanCluster::cluster(
     pointcloud_2d_ptr->push_back(point2d);
   }
 
-  // create tree
-  pcl::search::KdTree<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
-  tree->setInputCloud(pointcloud_2d_ptr);
-
   // clustering
   std::vector<pcl::PointIndices> cluster_indices;
-  pcl::EuclideanClusterExtraction<pcl::PointXYZ> pcl_euclidean_cluster;
-  pcl_euclidean_cluster.setClusterTolerance(tolerance_);
-  pcl_euclidean_cluster.setMinClusterSize(1);
-  pcl_euclidean_cluster.setMaxClusterSize(max_cluster_size_);
-  pcl_euclidean_cluster.setSearchMethod(tree);
-  pcl_euclidean_cluster.setInputCloud(pointcloud_2d_ptr);
-  pcl_euclidean_cluster.extract(cluster_indices);
+  if (use_grid_connectivity_) {
+    cluster_indices =
+      extractClustersOnGrid(*pointcloud_2d_ptr, tolerance_, max_cluster_size_, num_threads_);
+  } else {
+    // create tree
+    pcl::search::KdTree<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
+    tree->setInputCloud(pointcloud_2d_ptr);
+
+    pcl::EuclideanClusterExtraction<pcl::PointXYZ> pcl_euclidean_cluster;
+    pcl_euclidean_cluster.setClusterTolerance(tolerance_);
+    pcl_euclidean_cluster.setMinClusterSize(1);
+    pcl_euclidean_cluster.setMaxClusterSize(max_cluster_size_);
+    pcl_euclidean_cluster.setSearchMethod(tree);
+    pcl_euclidean_cluster.setInputCloud(pointcloud_2d_ptr);
+    pcl_euclidean_cluster.extract(cluster_indices);
+  }
 
   // create map to search cluster index from voxel grid index
   std::unordered_map</* voxel grid index */ int, /* cluster index */ int> map;
@@ -15,6 +15,7 @@
 #ifndef FRONT_VEHICLE_VELOCITY_ESTIMATOR__FRONT_VEHICLE_VELOCITY_ESTIMATOR_HPP_
 #define FRONT_VEHICLE_VELOCITY_ESTIMATOR__FRONT_VEHICLE_VELOCITY_ESTIMATOR_HPP_
 
+#include "front_vehicle_velocity_estimator/lead_vehicle_kalman_filter.hpp"
 #include "pcl/point_cloud.h"
 #include "pcl/point_types.h"
 #include "pcl_conversions/pcl_conversions.h"
@@ -22,11 +23,14 @@
 #include "tier4_autoware_utils/geometry/boost_geometry.hpp"
 
 #include "autoware_auto_perception_msgs/msg/detected_objects.hpp"
+#include "geometry_msgs/msg/transform_stamped.hpp"
 #include "nav_msgs/msg/odometry.hpp"
+#include "radar_msgs/msg/radar_scan.hpp"
 #include "sensor_msgs/msg/point_cloud2.hpp"
 
 #include <deque>
 #include <memory>
+#include <optional>
 #include <string>
 
 namespace front_vehicle_velocity_estimator
@@ -35,10 +39,13 @@ using autoware_auto_perception_msgs::msg::DetectedObject;
 using autoware_auto_perception_msgs::msg::DetectedObjectKinematics;
 using autoware_auto_perception_msgs::msg::DetectedObjects;
 using autoware_auto_perception_msgs::msg::ObjectClassification;
+using geometry_msgs::msg::TransformStamped;
 using nav_msgs::msg::Odometry;
+using radar_msgs::msg::RadarScan;
 using sensor_msgs::msg::PointCloud2;
 using tier4_autoware_utils::LinearRing2d;
 using tier4_autoware_utils::Point2d;
+using tier4_autoware_utils::Point3d;
 
 class FrontVehicleVelocityEstimator
 {
@@ -65,11 +72,29 @@ public:
     float threshold_pointcloud_z_low{};
     double threshold_relative_velocity{};
     double threshold_absolute_velocity{};
+    double process_noise_acceleration{};
+    double lidar_distance_stddev{};
+    double radar_velocity_stddev{};
+    double reset_time_threshold{};
   };
 
-  void setParam(const Param & param) { param_ = param; }
+  struct RadarInput
+  {
+    RadarScan::ConstSharedPtr radar{};
+    TransformStamped::ConstSharedPtr transform{};  // from radar frame to pointcloud frame
+    Odometry::ConstSharedPtr odometry{};
+  };
+
+  void setParam(const Param & param);
   Output update(const Input & input);
 
+  /**
+   * @brief update the velocity of the front vehicle found by the last update() with radar Doppler
+   * @return objects of the last update() with the updated front vehicle, or nullopt if there is no
+   * front vehicle to update
+   */
+  std::optional<DetectedObjects> updateWithRadar(const RadarInput & input);
+
 private:
   struct ObjectsWithFrontVehicle
   {
@@ -83,20 +108,26 @@ private:
   // Buffer data
   Param param_{};
   std::deque<double> velocity_queue_{};
-  rclcpp::Time prev_time_{};
-  pcl::PointXYZ prev_point_{};
+  LeadVehicleKalmanFilter kalman_filter_{};
+  rclcpp::Time prev_time_{};  // time of the last prediction or update of the filter
+  double prev_point_distance_{};
+  DetectedObjects prev_objects_without_front_vehicle_{};
+  std::optional<DetectedObject> prev_front_vehicle_{};
 
   // Function
   LinearRing2d createBoxArea(const Point2d size);
   LinearRing2d createObjectArea(const DetectedObject & object);
   ObjectsWithFrontVehicle filterFrontVehicle(
     DetectedObjects::ConstSharedPtr objects, const LinearRing2d & front_area);
-  pcl::PointXYZ getNearestNeighborPoint(
+  std::optional<pcl::PointXYZ> getNearestNeighborPoint(
     const DetectedObject & object, PointCloud2::ConstSharedPtr pointcloud,
     const Point2d & front_size);
-  double estimateRelativeVelocity(const pcl::PointXYZ & point, const rclcpp::Time & header_time);
+  void predict(const rclcpp::Time & time);
+  double estimateRelativeVelocity(
+    const std::optional<pcl::PointXYZ> & point, const rclcpp::Time & header_time);
   double estimateAbsoluteVelocity(
     const double relative_velocity, Odometry::ConstSharedPtr odometry);
+  double averageVelocity(const double absolute_velocity);
   bool isFrontVehicle(const DetectedObject & object, const LinearRing2d & front_area);
   bool isWithinVehicle(
     const DetectedObject & object, const pcl::PointXYZ & point, const Point2d & front_size);
@@ -17,9 +17,11 @@
 
 #include "front_vehicle_velocity_estimator/front_vehicle_velocity_estimator.hpp"
 #include "rclcpp/rclcpp.hpp"
+#include "tier4_autoware_utils/ros/transform_listener.hpp"
 
 #include "autoware_auto_perception_msgs/msg/detected_objects.hpp"
 #include "nav_msgs/msg/odometry.hpp"
+#include "radar_msgs/msg/radar_scan.hpp"
 #include "sensor_msgs/msg/point_cloud2.hpp"
 
 #include <message_filters/subscriber.h>
@@ -36,6 +38,7 @@ namespace front_vehicle_velocity_estimator
 using autoware_auto_perception_msgs::msg::DetectedObject;
 using autoware_auto_perception_msgs::msg::DetectedObjects;
 using nav_msgs::msg::Odometry;
+using radar_msgs::msg::RadarScan;
 using sensor_msgs::msg::PointCloud2;
 using tier4_autoware_utils::LinearRing2d;
 using tier4_autoware_utils::Point2d;
@@ -48,6 +51,7 @@ public:
   struct NodeParam
   {
     double update_rate_hz{};
+    bool use_radar{};
   };
 
 private:
@@ -60,11 +64,14 @@ private:
     message_filters::sync_policies::ApproximateTime<PointCloud2, DetectedObjects, Odometry>;
   using Sync = message_filters::Synchronizer<SyncPolicy>;
   typename std::shared_ptr<Sync> sync_ptr_;
+  rclcpp::Subscription<RadarScan>::SharedPtr sub_radar_{};
+  std::shared_ptr<tier4_autoware_utils::TransformListener> transform_listener_{};
 
   // Callback
   void onData(
     const PointCloud2::ConstSharedPtr pointcloud_msg,
     const DetectedObjects::ConstSharedPtr object_msg, const Odometry::ConstSharedPtr odometry_msg);
+  void onRadar(const RadarScan::ConstSharedPtr radar_msg);
 
   // Data Buffer
   PointCloud2::ConstSharedPtr pointcloud_data_{};
@@ -0,0 +1,93 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FRONT_VEHICLE_VELOCITY_ESTIMATOR__LEAD_VEHICLE_KALMAN_FILTER_HPP_
+#define FRONT_VEHICLE_VELOCITY_ESTIMATOR__LEAD_VEHICLE_KALMAN_FILTER_HPP_
+
+#include <Eigen/Core>
+
+namespace front_vehicle_velocity_estimator
+{
+/**
+ * @brief constant velocity Kalman filter of the relative distance and velocity of the front vehicle
+ * @details The state is [relative distance, relative velocity]. LiDAR observes the distance and
+ * radar Doppler observes the velocity, so each update is a scalar update without matrix inversion.
+ */
+class LeadVehicleKalmanFilter
+{
+public:
+  struct Param
+  {
+    double process_noise_acceleration{};  // standard deviation of the relative acceleration
+    double initial_velocity_stddev{};     // standard deviation of the velocity at initialization
+  };
+
+  void setParam(const Param & param) { param_ = param; }
+
+  bool isInitialized() const { return is_initialized_; }
+  double getDistance() const { return x_(0); }
+  double getVelocity() const { return x_(1); }
+  double getVelocityVariance() const { return P_(1, 1); }
+
+  void reset() { is_initialized_ = false; }
+
+  void initialize(const double distance, const double distance_variance)
+  {
+    x_ << distance, 0.0;
+    P_ << distance_variance, 0.0, 0.0,
+      param_.initial_velocity_stddev * param_.initial_velocity_stddev;
+    is_initialized_ = true;
+  }
+
+  void predict(const double dt)
+  {
+    Eigen::Matrix2d F;
+    F << 1.0, dt, 0.0, 1.0;
+    // discrete white noise acceleration
+    const double q = param_.process_noise_acceleration * param_.process_noise_acceleration;
+    const double dt2 = dt * dt;
+    Eigen::Matrix2d Q;
+    Q << 0.25 * dt2 * dt2, 0.5 * dt2 * dt, 0.5 * dt2 * dt, dt2;
+    x_ = F * x_;
+    P_ = F * P_ * F.transpose() + q * Q;
+  }
+
+  void updateDistance(const double distance, const double variance)
+  {
+    update(0, distance, variance);
+  }
+
+  void updateVelocity(const double velocity, const double variance)
+  {
+    update(1, velocity, variance);
+  }
+
+private:
+  void update(const int index, const double measurement, const double variance)
+  {
+    const double innovation = measurement - x_(index);
+    const double S = P_(index, index) + variance;
+    const Eigen::Vector2d K = P_.col(index) / S;
+    x_ += K * innovation;
+    P_ -= K * P_.row(index);
+  }
+
+  Param param_{};
+  bool is_initialized_{false};
+  Eigen::Vector2d x_{Eigen::Vector2d::Zero()};
+  Eigen::Matrix2d P_{Eigen::Matrix2d::Identity()};
+};
+}  // namespace front_vehicle_velocity_estimator
+
+#endif  // FRONT_VEHICLE_VELOCITY_ESTIMATOR__LEAD_VEHICLE_KALMAN_FILTER_HPP_
@@ -18,12 +18,25 @@
 
 #include <boost/geometry.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <numeric>
 #include <utility>
+#include <vector>
 
 namespace front_vehicle_velocity_estimator
 {
+void FrontVehicleVelocityEstimator::setParam(const Param & param)
+{
+  param_ = param;
+
+  LeadVehicleKalmanFilter::Param kalman_filter_param{};
+  kalman_filter_param.process_noise_acceleration = param.process_noise_acceleration;
+  kalman_filter_param.initial_velocity_stddev = param.threshold_relative_velocity;
+  kalman_filter_.setParam(kalman_filter_param);
+}
+
 FrontVehicleVelocityEstimator::Output FrontVehicleVelocityEstimator::update(
   const FrontVehicleVelocityEstimator::Input & input)
 {
@@ -36,7 +49,7 @@ FrontVehicleVelocityEstimator::Output FrontVehicleVelocityEstimator::update(
   objects_with_front_vehicle = filterFrontVehicle(input.objects, front_area);
 
   // Get nearest neighbor pointcloud
-  pcl::PointXYZ nearest_neighbor_point =
+  const auto nearest_neighbor_point =
     getNearestNeighborPoint(objects_with_front_vehicle.front_vehicle, input.pointcloud, front_size);
 
   // Set objects output
@@ -44,6 +57,9 @@ FrontVehicleVelocityEstimator::Output FrontVehicleVelocityEstimator::update(
 
   // If there is no front vehicle, return output
   if (!objects_with_front_vehicle.is_front_vehicle) {
+    kalman_filter_.reset();
+    velocity_queue_.clear();
+    prev_front_vehicle_ = std::nullopt;
     return output_;
   }
 
@@ -59,40 +75,34 @@ FrontVehicleVelocityEstimator::Output FrontVehicleVelocityEstimator::update(
     !isfinite(now_relative_velocity) ||
     now_relative_velocity > param_.threshold_relative_velocity ||
     now_relative_velocity < -param_.threshold_relative_velocity) {
+    kalman_filter_.reset();
+    velocity_queue_.clear();
+    prev_front_vehicle_ = std::nullopt;
     output_.objects.objects.emplace_back(objects_with_front_vehicle.front_vehicle);
     return output_;
   }
-  now_absolute_velocity = std::min(param_.threshold_absolute_velocity, now_absolute_velocity);
-
-  // Set queue of nearest_neighbor_point
-  if (static_cast<int>(velocity_queue_.size()) >= param_.moving_average_num) {
-    velocity_queue_.pop_front();
-  }
-
-  // Estimate average velocity
-  velocity_queue_.push_back(now_absolute_velocity);
-  double velocity = std::accumulate(std::begin(velocity_queue_), std::end(velocity_queue_), 0.0) /
-                    velocity_queue_.size();
-  // RCLCPP_INFO(
-  //   rclcpp::get_logger("front_vehicle_velocity_estimator"), "x=%f, v=%f km/h, v_a=%f km/h",
-  //   objects_with_front_vehicle.front_vehicle.kinematics.pose_with_covariance.pose.position.x,
-  //   now_absolute_velocity * 3.6, velocity * 3.6);
+  const double velocity = averageVelocity(now_absolute_velocity);
 
   // Set kinematics information for front vehicle
-  objects_with_front_vehicle.front_vehicle.kinematics.has_twist = true;
-  objects_with_front_vehicle.front_vehicle.kinematics.twist_with_covariance.twist.linear.x =
-    velocity;
-  objects_with_front_vehicle.front_vehicle.kinematics.has_twist_covariance = true;
-  objects_with_front_vehicle.front_vehicle.kinematics.twist_with_covariance.covariance.at(0) = 1.0;
-  output_.objects.objects.emplace_back(objects_with_front_vehicle.front_vehicle);
+  auto & front_vehicle = objects_with_front_vehicle.front_vehicle;
+  front_vehicle.kinematics.has_twist = true;
+  front_vehicle.kinematics.twist_with_covariance.twist.linear.x = velocity;
+  front_vehicle.kinematics.has_twist_covariance = true;
+  front_vehicle.kinematics.twist_with_covariance.covariance.at(0) =
+    kalman_filter_.getVelocityVariance();
 
-  // Set previous data buffer
-  prev_time_ = input.pointcloud->header.stamp;
-  prev_point_ = nearest_neighbor_point;
+  // Set previous data buffer for the update with radar
+  prev_objects_without_front_vehicle_ = output_.objects;
+  prev_front_vehicle_ = front_vehicle;
+  prev_point_distance_ = kalman_filter_.getDistance();
+
+  output_.objects.objects.emplace_back(front_vehicle);
 
   // Set nearest_neighbor_pointcloud output for debug
   pcl::PointCloud<pcl::PointXYZ> output_pointcloud;
-  output_pointcloud.points.push_back(nearest_neighbor_point);
+  if (nearest_neighbor_point) {
+    output_pointcloud.points.push_back(*nearest_neighbor_point);
+  }
   pcl::toROSMsg(output_pointcloud, output_.nearest_neighbor_pointcloud);
   output_.nearest_neighbor_pointcloud.header = input.pointcloud->header;
 
@@ -166,21 +176,89 @@ FrontVehicleVelocityEstimator::filterFrontVehicle(
   return output;
 }
 
-pcl::PointXYZ FrontVehicleVelocityEstimator::getNearestNeighborPoint(
+std::optional<DetectedObjects> FrontVehicleVelocityEstimator::updateWithRadar(
+  const RadarInput & input)
+{
+  if (!prev_front_vehicle_ || !kalman_filter_.isInitialized()) {
+    return std::nullopt;
+  }
+  const rclcpp::Time radar_time = input.radar->header.stamp;
+  if ((radar_time - prev_time_).seconds() > param_.reset_time_threshold) {
+    return std::nullopt;
+  }
+
+  // Move the front vehicle to the predicted distance
+  predict(radar_time);
+  DetectedObject front_vehicle = *prev_front_vehicle_;
+  front_vehicle.kinematics.pose_with_covariance.pose.position.x +=
+    kalman_filter_.getDistance() - prev_point_distance_;
+  const LinearRing2d object_area = createObjectArea(front_vehicle);
+
+  // Convert Doppler velocity of the radar returns on the front vehicle to the longitudinal
+  // relative velocity
+  const auto & transform = input.transform->transform;
+  const Point3d origin = tier4_autoware_utils::transformPoint(Point3d{0.0, 0.0, 0.0}, transform);
+  double velocity_sum = 0.0;
+  size_t velocity_num = 0;
+  for (const auto & radar_return : input.radar->returns) {
+    const double horizontal_range = radar_return.range * std::cos(radar_return.elevation);
+    const Point3d radar_point{
+      horizontal_range * std::cos(radar_return.azimuth),
+      horizontal_range * std::sin(radar_return.azimuth),
+      radar_return.range * std::sin(radar_return.elevation)};
+    const Point3d point = tier4_autoware_utils::transformPoint(radar_point, transform);
+    if (!boost::geometry::within(Point2d{point.x(), point.y()}, object_area)) {
+      continue;
+    }
+    // Doppler velocity is the relative velocity along the line of sight
+    const double line_of_sight_x = (point - origin).normalized().x();
+    if (line_of_sight_x < 0.5) {
+      continue;
+    }
+    velocity_sum += radar_return.doppler_velocity / line_of_sight_x;
+    ++velocity_num;
+  }
+  if (velocity_num == 0) {
+    return std::nullopt;
+  }
+
+  const double radar_velocity_variance =
+    param_.radar_velocity_stddev * param_.radar_velocity_stddev;
+  kalman_filter_.updateVelocity(
+    velocity_sum / static_cast<double>(velocity_num),
+    radar_velocity_variance / static_cast<double>(velocity_num));
+
+  const double relative_velocity = kalman_filter_.getVelocity();
+  if (
+    !std::isfinite(relative_velocity) ||
+    std::abs(relative_velocity) > param_.threshold_relative_velocity) {
+    return std::nullopt;
+  }
+  const double velocity =
+    averageVelocity(estimateAbsoluteVelocity(relative_velocity, input.odometry));
+
+  front_vehicle.kinematics.has_twist = true;
+  front_vehicle.kinematics.twist_with_covariance.twist.linear.x = velocity;
+  front_vehicle.kinematics.has_twist_covariance = true;
+  front_vehicle.kinematics.twist_with_covariance.covariance.at(0) =
+    kalman_filter_.getVelocityVariance();
+
+  DetectedObjects objects = prev_objects_without_front_vehicle_;
+  objects.header.stamp = input.radar->header.stamp;
+  objects.objects.emplace_back(front_vehicle);
+  return objects;
+}
+
+std::optional<pcl::PointXYZ> FrontVehicleVelocityEstimator::getNearestNeighborPoint(
   const DetectedObject & object, PointCloud2::ConstSharedPtr pointcloud, const Point2d & front_size)
 {
   pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_msg(new pcl::PointCloud<pcl::PointXYZ>);
   pcl::fromROSMsg(*pointcloud, *pcl_msg);
 
-  // Initialize
-  pcl::PointXYZ nearest_neighbor_point;
-  bool is_initialized = false;
-
+  std::optional<pcl::PointXYZ> nearest_neighbor_point{};
   for (const auto & point : *pcl_msg) {
     if (isWithinVehicle(object, point, front_size)) {
-      if (!is_initialized) {
-        nearest_neighbor_point = point;
-      } else if (point.x < nearest_neighbor_point.x) {
+      if (!nearest_neighbor_point || point.x < nearest_neighbor_point->x) {
         nearest_neighbor_point = point;
       }
     }
@@ -211,15 +289,40 @@ bool FrontVehicleVelocityEstimator::isWithinVehicle(
   return true;
 }
 
+void FrontVehicleVelocityEstimator::predict(const rclcpp::Time & time)
+{
+  // The measurement older than the filter is applied to the current state.
+  const double dt = (time - prev_time_).seconds();
+  if (dt > 0.0) {
+    kalman_filter_.predict(dt);
+    prev_time_ = time;
+  }
+}
+
 double FrontVehicleVelocityEstimator::estimateRelativeVelocity(
-  const pcl::PointXYZ & point, const rclcpp::Time & header_time)
+  const std::optional<pcl::PointXYZ> & point, const rclcpp::Time & header_time)
 {
-  if (velocity_queue_.size() == 0) {
+  if (
+    kalman_filter_.isInitialized() &&
+    (header_time - prev_time_).seconds() > param_.reset_time_threshold) {
+    kalman_filter_.reset();
+    velocity_queue_.clear();
+  }
+
+  const double distance_variance = param_.lidar_distance_stddev * param_.lidar_distance_stddev;
+  if (!kalman_filter_.isInitialized()) {
+    if (point) {
+      kalman_filter_.initialize(point->x, distance_variance);
+      prev_time_ = header_time;
+    }
     return 0.0;
   }
-  const double dt = (header_time - prev_time_).seconds();
-  const double relative_velocity = (point.x - prev_point_.x) / dt;
-  return relative_velocity;
+
+  predict(header_time);
+  if (point) {
+    kalman_filter_.updateDistance(point->x, distance_variance);
+  }
+  return kalman_filter_.getVelocity();
 }
 
 double FrontVehicleVelocityEstimator::estimateAbsoluteVelocity(
@@ -229,6 +332,16 @@ double FrontVehicleVelocityEstimator::estimateAbsoluteVelocity(
   return velocity;
 }
 
+double FrontVehicleVelocityEstimator::averageVelocity(const double absolute_velocity)
+{
+  if (static_cast<int>(velocity_queue_.size()) >= param_.moving_average_num) {
+    velocity_queue_.pop_front();
+  }
+  velocity_queue_.push_back(std::min(param_.threshold_absolute_velocity, absolute_velocity));
+  return std::accumulate(std::begin(velocity_queue_), std::end(velocity_queue_), 0.0) /
+         velocity_queue_.size();
+}
+
 bool FrontVehicleVelocityEstimator::isFrontVehicle(
   const DetectedObject & object, const LinearRing2d & front_area)
 {
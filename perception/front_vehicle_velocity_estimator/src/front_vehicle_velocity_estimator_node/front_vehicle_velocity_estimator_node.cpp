@@ -58,6 +58,7 @@ FrontVehicleVelocityEstimatorNode::FrontVehicleVelocityEstimatorNode(
 
   // Node Parameter
   node_param_.update_rate_hz = declare_parameter<double>("node_params.update_rate_hz", 10.0);
+  node_param_.use_radar = declare_parameter<bool>("node_params.use_radar", false);
 
   // Core Parameter
   core_param_.moving_average_num = declare_parameter<int>("core_params.moving_average_num", 1);
@@ -69,6 +70,14 @@ FrontVehicleVelocityEstimatorNode::FrontVehicleVelocityEstimatorNode(
     declare_parameter<double>("core_params.threshold_relative_velocity", 10.0);
   core_param_.threshold_absolute_velocity =
     declare_parameter<double>("core_params.threshold_absolute_velocity", 20.0);
+  core_param_.process_noise_acceleration =
+    declare_parameter<double>("core_params.process_noise_acceleration", 2.0);
+  core_param_.lidar_distance_stddev =
+    declare_parameter<double>("core_params.lidar_distance_stddev", 0.1);
+  core_param_.radar_velocity_stddev =
+    declare_parameter<double>("core_params.radar_velocity_stddev", 0.3);
+  core_param_.reset_time_threshold =
+    declare_parameter<double>("core_params.reset_time_threshold", 0.5);
 
   // Core
   front_vehicle_velocity_estimator_ = std::make_unique<FrontVehicleVelocityEstimator>(get_logger());
@@ -86,6 +95,12 @@ FrontVehicleVelocityEstimatorNode::FrontVehicleVelocityEstimatorNode(
   sync_ptr_ = std::make_shared<Sync>(SyncPolicy(20), sub_pointcloud_, sub_objects_, sub_odometry_);
   sync_ptr_->registerCallback(
     std::bind(&FrontVehicleVelocityEstimatorNode::onData, this, _1, _2, _3));
+  if (node_param_.use_radar) {
+    transform_listener_ = std::make_shared<tier4_autoware_utils::TransformListener>(this);
+    sub_radar_ = create_subscription<RadarScan>(
+      "~/input/radar", rclcpp::SensorDataQoS(),
+      std::bind(&FrontVehicleVelocityEstimatorNode::onRadar, this, _1));
+  }
 
   // Publisher
   pub_objects_ = create_publisher<DetectedObjects>("~/output/objects", 1);
@@ -123,6 +138,28 @@ void FrontVehicleVelocityEstimatorNode::onData(
   }
 }
 
+void FrontVehicleVelocityEstimatorNode::onRadar(const RadarScan::ConstSharedPtr radar_msg)
+{
+  if (!pointcloud_data_ || !odometry_data_) {
+    return;
+  }
+
+  FrontVehicleVelocityEstimator::RadarInput radar_input{};
+  radar_input.radar = radar_msg;
+  radar_input.odometry = odometry_data_;
+  radar_input.transform = transform_listener_->getLatestTransform(
+    pointcloud_data_->header.frame_id, radar_msg->header.frame_id);
+  if (!radar_input.transform) {
+    return;
+  }
+
+  // Publish the front vehicle at radar rate between the updates with LiDAR
+  const auto objects = front_vehicle_velocity_estimator_->updateWithRadar(radar_input);
+  if (objects) {
+    pub_objects_->publish(*objects);
+  }
+}
+
 rcl_interfaces::msg::SetParametersResult FrontVehicleVelocityEstimatorNode::onSetParam(
   const std::vector<rclcpp::Parameter> & params)
 {
@@ -150,6 +187,11 @@ rcl_interfaces::msg::SetParametersResult FrontVehicleVelocityEstimatorNode::onSe
         params, "core_params.threshold_relative_velocity", p.threshold_relative_velocity);
       update_param(
         params, "core_params.threshold_absolute_velocity", p.threshold_absolute_velocity);
+      update_param(
+        params, "core_params.process_noise_acceleration", p.process_noise_acceleration);
+      update_param(params, "core_params.lidar_distance_stddev", p.lidar_distance_stddev);
+      update_param(params, "core_params.radar_velocity_stddev", p.radar_velocity_stddev);
+      update_param(params, "core_params.reset_time_threshold", p.reset_time_threshold);
 
       // Set parameter to instance
       if (front_vehicle_velocity_estimator_) {
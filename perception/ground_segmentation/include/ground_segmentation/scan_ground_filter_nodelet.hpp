@@ -34,6 +34,7 @@
 
 #include <tf2_ros/transform_listener.h>
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -174,8 +175,13 @@ private:
   bool use_virtual_ground_point_;
   bool use_recheck_ground_cluster_;  // to enable recheck ground cluster
   size_t radial_dividers_num_;
+  int num_threads_;  // threads to process the radial divisions
   VehicleInfo vehicle_info_;
 
+  // buffers reused across frames
+  std::vector<PointCloudRefVector> radial_ordered_points_;
+  std::vector<pcl::PointIndices> radial_no_ground_indices_;
+
   /*!
    * Output transformed PointCloud from in_cloud_ptr->header.frame_id to in_target_frame
    * @param[in] in_target_frame Coordinate system to perform transform
@@ -223,6 +229,12 @@ private:
   void classifyPointCloudGridScan(
     std::vector<PointCloudRefVector> & in_radial_ordered_clouds,
     pcl::PointIndices & out_no_ground_indices);
+  void classifyRadialDivisionGridScan(
+    PointCloudRefVector & in_radial_ordered_cloud, pcl::PointIndices & out_no_ground_indices);
+  /*!
+   * Calls function with each index in [0, size), using num_threads_ threads
+   */
+  void runInParallel(const size_t size, const std::function<void(const size_t)> & function) const;
   /*!
    * Re-classifies point of ground cluster based on their height
    * @param gnd_cluster Input ground cluster for re-checking
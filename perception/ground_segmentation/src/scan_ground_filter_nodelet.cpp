@@ -19,8 +19,11 @@
 #include <tier4_autoware_utils/math/unit_conversion.hpp>
 #include <vehicle_info_util/vehicle_info_util.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace ground_segmentation
@@ -55,6 +58,7 @@ ScanGroundFilterComponent::ScanGroundFilterComponent(const rclcpp::NodeOptions &
     split_height_distance_ = declare_parameter("split_height_distance", 0.2);
     use_virtual_ground_point_ = declare_parameter("use_virtual_ground_point", true);
     use_recheck_ground_cluster_ = declare_parameter("use_recheck_ground_cluster", true);
+    num_threads_ = static_cast<int>(declare_parameter("num_threads", 1));
     radial_dividers_num_ = std::ceil(2.0 * M_PI / radial_divider_angle_rad_);
     vehicle_info_ = VehicleInfoUtil(*this).getVehicleInfo();
 
@@ -83,7 +87,11 @@ void ScanGroundFilterComponent::convertPointcloudGridScan(
   const pcl::PointCloud<pcl::PointXYZ>::Ptr in_cloud,
   std::vector<PointCloudRefVector> & out_radial_ordered_points)
 {
+  // the buffers of each radial division are kept to be reused in the next frame
   out_radial_ordered_points.resize(radial_dividers_num_);
+  for (auto & radial_ordered_points : out_radial_ordered_points) {
+    radial_ordered_points.clear();
+  }
   PointRef current_point;
   uint16_t back_steps_num = 1;
 
@@ -130,17 +138,20 @@ void ScanGroundFilterComponent::convertPointcloudGridScan(
   }
 
   // sort by distance
-  for (size_t i = 0; i < radial_dividers_num_; ++i) {
+  runInParallel(radial_dividers_num_, [&](const size_t i) {
     std::sort(
       out_radial_ordered_points[i].begin(), out_radial_ordered_points[i].end(),
       [](const PointRef & a, const PointRef & b) { return a.radius < b.radius; });
-  }
+  });
 }
 void ScanGroundFilterComponent::convertPointcloud(
   const pcl::PointCloud<pcl::PointXYZ>::Ptr in_cloud,
   std::vector<PointCloudRefVector> & out_radial_ordered_points)
 {
   out_radial_ordered_points.resize(radial_dividers_num_);
+  for (auto & radial_ordered_points : out_radial_ordered_points) {
+    radial_ordered_points.clear();
+  }
   PointRef current_point;
 
   for (size_t i = 0; i < in_cloud->points.size(); ++i) {
@@ -287,129 +298,145 @@ void ScanGroundFilterComponent::classifyPointCloudGridScan(
   std::vector<PointCloudRefVector> & in_radial_ordered_clouds,
   pcl::PointIndices & out_no_ground_indices)
 {
-  out_no_ground_indices.indices.clear();
-  for (size_t i = 0; i < in_radial_ordered_clouds.size(); ++i) {
-    PointsCentroid ground_cluster;
-    ground_cluster.initialize();
-    std::vector<GridCenter> gnd_grids;
-    GridCenter curr_gnd_grid;
+  // radial divisions are independent, so they are classified in parallel and their results are
+  // merged in order
+  radial_no_ground_indices_.resize(in_radial_ordered_clouds.size());
+  runInParallel(in_radial_ordered_clouds.size(), [&](const size_t i) {
+    radial_no_ground_indices_[i].indices.clear();
+    classifyRadialDivisionGridScan(in_radial_ordered_clouds[i], radial_no_ground_indices_[i]);
+  });
 
-    // check empty ray
-    if (in_radial_ordered_clouds[i].size() == 0) {
-      continue;
-    }
+  out_no_ground_indices.indices.clear();
+  for (const auto & radial_no_ground_indices : radial_no_ground_indices_) {
+    out_no_ground_indices.indices.insert(
+      out_no_ground_indices.indices.end(), radial_no_ground_indices.indices.begin(),
+      radial_no_ground_indices.indices.end());
+  }
+}
 
-    // check the first point in ray
-    auto * p = &in_radial_ordered_clouds[i][0];
-    PointRef * prev_p;
-    prev_p = &in_radial_ordered_clouds[i][0];  // for checking the distance to prev point
+void ScanGroundFilterComponent::classifyRadialDivisionGridScan(
+  PointCloudRefVector & in_radial_ordered_cloud, pcl::PointIndices & out_no_ground_indices)
+{
+  PointsCentroid ground_cluster;
+  ground_cluster.initialize();
+  std::vector<GridCenter> gnd_grids;
+  GridCenter curr_gnd_grid;
 
-    bool initialized_first_gnd_grid = false;
-    bool prev_list_init = false;
+  // check empty ray
+  if (in_radial_ordered_cloud.size() == 0) {
+    return;
+  }
 
-    for (size_t j = 0; j < in_radial_ordered_clouds[i].size(); ++j) {
-      p = &in_radial_ordered_clouds[i][j];
-      float global_slope_p = std::atan(p->orig_point->z / p->radius);
-      float non_ground_height_threshold_local = non_ground_height_threshold_;
-      if (p->orig_point->x < low_priority_region_x_) {
-        non_ground_height_threshold_local =
-          non_ground_height_threshold_ * abs(p->orig_point->x / low_priority_region_x_);
-      }
-      // classify first grid's point cloud
-      if (
-        !initialized_first_gnd_grid && global_slope_p >= global_slope_max_angle_rad_ &&
-        p->orig_point->z > non_ground_height_threshold_local) {
-        out_no_ground_indices.indices.push_back(p->orig_index);
-        p->point_state = PointLabel::NON_GROUND;
-        prev_p = p;
-        continue;
-      }
+  // check the first point in ray
+  auto * p = &in_radial_ordered_cloud[0];
+  PointRef * prev_p;
+  prev_p = &in_radial_ordered_cloud[0];  // for checking the distance to prev point
+
+  bool initialized_first_gnd_grid = false;
+  bool prev_list_init = false;
+
+  for (size_t j = 0; j < in_radial_ordered_cloud.size(); ++j) {
+    p = &in_radial_ordered_cloud[j];
+    float global_slope_p = std::atan(p->orig_point->z / p->radius);
+    float non_ground_height_threshold_local = non_ground_height_threshold_;
+    if (p->orig_point->x < low_priority_region_x_) {
+      non_ground_height_threshold_local =
+        non_ground_height_threshold_ * abs(p->orig_point->x / low_priority_region_x_);
+    }
+    // classify first grid's point cloud
+    if (
+      !initialized_first_gnd_grid && global_slope_p >= global_slope_max_angle_rad_ &&
+      p->orig_point->z > non_ground_height_threshold_local) {
+      out_no_ground_indices.indices.push_back(p->orig_index);
+      p->point_state = PointLabel::NON_GROUND;
+      prev_p = p;
+      continue;
+    }
 
-      if (
-        !initialized_first_gnd_grid && abs(global_slope_p) < global_slope_max_angle_rad_ &&
-        abs(p->orig_point->z) < non_ground_height_threshold_local) {
-        ground_cluster.addPoint(p->radius, p->orig_point->z, p->orig_index);
-        p->point_state = PointLabel::GROUND;
-        initialized_first_gnd_grid = static_cast<bool>(p->grid_id - prev_p->grid_id);
-        prev_p = p;
-        continue;
-      }
+    if (
+      !initialized_first_gnd_grid && abs(global_slope_p) < global_slope_max_angle_rad_ &&
+      abs(p->orig_point->z) < non_ground_height_threshold_local) {
+      ground_cluster.addPoint(p->radius, p->orig_point->z, p->orig_index);
+      p->point_state = PointLabel::GROUND;
+      initialized_first_gnd_grid = static_cast<bool>(p->grid_id - prev_p->grid_id);
+      prev_p = p;
+      continue;
+    }
 
-      if (!initialized_first_gnd_grid) {
-        prev_p = p;
-        continue;
-      }
+    if (!initialized_first_gnd_grid) {
+      prev_p = p;
+      continue;
+    }
 
-      // initialize lists of previous gnd grids
-      if (prev_list_init == false && initialized_first_gnd_grid == true) {
-        float h = ground_cluster.getAverageHeight();
-        float r = ground_cluster.getAverageRadius();
-        initializeFirstGndGrids(h, r, p->grid_id, gnd_grids);
-        prev_list_init = true;
-      }
+    // initialize lists of previous gnd grids
+    if (prev_list_init == false && initialized_first_gnd_grid == true) {
+      float h = ground_cluster.getAverageHeight();
+      float r = ground_cluster.getAverageRadius();
+      initializeFirstGndGrids(h, r, p->grid_id, gnd_grids);
+      prev_list_init = true;
+    }
 
-      if (prev_list_init == false && initialized_first_gnd_grid == false) {
-        // assume first gnd grid is zero
-        initializeFirstGndGrids(0.0f, p->radius, p->grid_id, gnd_grids);
-        prev_list_init = true;
-      }
+    if (prev_list_init == false && initialized_first_gnd_grid == false) {
+      // assume first gnd grid is zero
+      initializeFirstGndGrids(0.0f, p->radius, p->grid_id, gnd_grids);
+      prev_list_init = true;
+    }
 
-      // move to new grid
-      if (p->grid_id > prev_p->grid_id && ground_cluster.getAverageRadius() > 0.0) {
-        // check if the prev grid have ground point cloud
-        if (use_recheck_ground_cluster_) {
-          recheckGroundCluster(ground_cluster, non_ground_height_threshold_, out_no_ground_indices);
-        }
-        curr_gnd_grid.radius = ground_cluster.getAverageRadius();
-        curr_gnd_grid.avg_height = ground_cluster.getAverageHeight();
-        curr_gnd_grid.max_height = ground_cluster.getMaxHeight();
-        curr_gnd_grid.grid_id = prev_p->grid_id;
-        gnd_grids.push_back(curr_gnd_grid);
-        ground_cluster.initialize();
-      }
-      // classify
-      if (p->orig_point->z - gnd_grids.back().avg_height > detection_range_z_max_) {
-        p->point_state = PointLabel::OUT_OF_RANGE;
-        prev_p = p;
-        continue;
-      }
-      float points_xy_distance = std::hypot(
-        p->orig_point->x - prev_p->orig_point->x, p->orig_point->y - prev_p->orig_point->y);
-      if (
-        prev_p->point_state == PointLabel::NON_GROUND &&
-        points_xy_distance < split_points_distance_tolerance_ &&
-        p->orig_point->z > prev_p->orig_point->z) {
-        p->point_state = PointLabel::NON_GROUND;
-        out_no_ground_indices.indices.push_back(p->orig_index);
-        prev_p = p;
-        continue;
+    // move to new grid
+    if (p->grid_id > prev_p->grid_id && ground_cluster.getAverageRadius() > 0.0) {
+      // check if the prev grid have ground point cloud
+      if (use_recheck_ground_cluster_) {
+        recheckGroundCluster(ground_cluster, non_ground_height_threshold_, out_no_ground_indices);
       }
+      curr_gnd_grid.radius = ground_cluster.getAverageRadius();
+      curr_gnd_grid.avg_height = ground_cluster.getAverageHeight();
+      curr_gnd_grid.max_height = ground_cluster.getMaxHeight();
+      curr_gnd_grid.grid_id = prev_p->grid_id;
+      gnd_grids.push_back(curr_gnd_grid);
+      ground_cluster.initialize();
+    }
+    // classify
+    if (p->orig_point->z - gnd_grids.back().avg_height > detection_range_z_max_) {
+      p->point_state = PointLabel::OUT_OF_RANGE;
+      prev_p = p;
+      continue;
+    }
+    float points_xy_distance = std::hypot(
+      p->orig_point->x - prev_p->orig_point->x, p->orig_point->y - prev_p->orig_point->y);
+    if (
+      prev_p->point_state == PointLabel::NON_GROUND &&
+      points_xy_distance < split_points_distance_tolerance_ &&
+      p->orig_point->z > prev_p->orig_point->z) {
+      p->point_state = PointLabel::NON_GROUND;
+      out_no_ground_indices.indices.push_back(p->orig_index);
+      prev_p = p;
+      continue;
+    }
 
-      if (global_slope_p > global_slope_max_angle_rad_) {
-        out_no_ground_indices.indices.push_back(p->orig_index);
-        prev_p = p;
-        continue;
-      }
-      // gnd grid is continuous, the last gnd grid is close
-      uint16_t next_gnd_grid_id_thresh = (gnd_grids.end() - gnd_grid_buffer_size_)->grid_id +
-                                         gnd_grid_buffer_size_ + gnd_grid_continual_thresh_;
-      if (
-        p->grid_id < next_gnd_grid_id_thresh &&
-        p->radius - gnd_grids.back().radius < gnd_grid_continual_thresh_ * p->grid_size) {
-        checkContinuousGndGrid(*p, gnd_grids);
-
-      } else if (p->radius - gnd_grids.back().radius < gnd_grid_continual_thresh_ * p->grid_size) {
-        checkDiscontinuousGndGrid(*p, gnd_grids);
-      } else {
-        checkBreakGndGrid(*p, gnd_grids);
-      }
-      if (p->point_state == PointLabel::NON_GROUND) {
-        out_no_ground_indices.indices.push_back(p->orig_index);
-      } else if (p->point_state == PointLabel::GROUND) {
-        ground_cluster.addPoint(p->radius, p->orig_point->z, p->orig_index);
-      }
+    if (global_slope_p > global_slope_max_angle_rad_) {
+      out_no_ground_indices.indices.push_back(p->orig_index);
       prev_p = p;
+      continue;
+    }
+    // gnd grid is continuous, the last gnd grid is close
+    uint16_t next_gnd_grid_id_thresh = (gnd_grids.end() - gnd_grid_buffer_size_)->grid_id +
+                                       gnd_grid_buffer_size_ + gnd_grid_continual_thresh_;
+    if (
+      p->grid_id < next_gnd_grid_id_thresh &&
+      p->radius - gnd_grids.back().radius < gnd_grid_continual_thresh_ * p->grid_size) {
+      checkContinuousGndGrid(*p, gnd_grids);
+
+    } else if (p->radius - gnd_grids.back().radius < gnd_grid_continual_thresh_ * p->grid_size) {
+      checkDiscontinuousGndGrid(*p, gnd_grids);
+    } else {
+      checkBreakGndGrid(*p, gnd_grids);
+    }
+    if (p->point_state == PointLabel::NON_GROUND) {
+      out_no_ground_indices.indices.push_back(p->orig_index);
+    } else if (p->point_state == PointLabel::GROUND) {
+      ground_cluster.addPoint(p->radius, p->orig_point->z, p->orig_index);
     }
+    prev_p = p;
   }
 }
 
@@ -528,6 +555,26 @@ void ScanGroundFilterComponent::classifyPointCloud(
   }
 }
 
+void ScanGroundFilterComponent::runInParallel(
+  const size_t size, const std::function<void(const size_t)> & function) const
+{
+  const size_t nb_workers = std::min(static_cast<size_t>(std::max(num_threads_, 1)), size);
+  std::atomic<size_t> next_idx{0};
+  const auto work = [&]() {
+    for (auto idx = next_idx++; idx < size; idx = next_idx++) {
+      function(idx);
+    }
+  };
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < nb_workers; ++i) {
+    workers.emplace_back(work);
+  }
+  work();
+  for (auto & worker : workers) {
+    worker.join();
+  }
+}
+
 void ScanGroundFilterComponent::extractObjectPoints(
   const pcl::PointCloud<pcl::PointXYZ>::Ptr in_cloud_ptr, const pcl::PointIndices & in_indices,
   pcl::PointCloud<pcl::PointXYZ>::Ptr out_object_cloud_ptr)
@@ -546,18 +593,16 @@ void ScanGroundFilterComponent::filter(
   pcl::PointCloud<pcl::PointXYZ>::Ptr current_sensor_cloud_ptr(new pcl::PointCloud<pcl::PointXYZ>);
   pcl::fromROSMsg(*input, *current_sensor_cloud_ptr);
 
-  std::vector<PointCloudRefVector> radial_ordered_points;
-
   pcl::PointIndices no_ground_indices;
   pcl::PointCloud<pcl::PointXYZ>::Ptr no_ground_cloud_ptr(new pcl::PointCloud<pcl::PointXYZ>);
   no_ground_cloud_ptr->points.reserve(current_sensor_cloud_ptr->points.size());
 
   if (elevation_grid_mode_) {
-    convertPointcloudGridScan(current_sensor_cloud_ptr, radial_ordered_points);
-    classifyPointCloudGridScan(radial_ordered_points, no_ground_indices);
+    convertPointcloudGridScan(current_sensor_cloud_ptr, radial_ordered_points_);
+    classifyPointCloudGridScan(radial_ordered_points_, no_ground_indices);
   } else {
-    convertPointcloud(current_sensor_cloud_ptr, radial_ordered_points);
-    classifyPointCloud(radial_ordered_points, no_ground_indices);
+    convertPointcloud(current_sensor_cloud_ptr, radial_ordered_points_);
+    classifyPointCloud(radial_ordered_points_, no_ground_indices);
   }
 
   extractObjectPoints(current_sensor_cloud_ptr, no_ground_indices, no_ground_cloud_ptr);
@@ -619,6 +664,9 @@ rcl_interfaces::msg::SetParametersResult ScanGroundFilterComponent::onParameter(
       get_logger(),
       "Setting use_recheck_ground_cluster to: " << std::boolalpha << use_recheck_ground_cluster_);
   }
+  if (get_param(p, "num_threads", num_threads_)) {
+    RCLCPP_DEBUG(get_logger(), "Setting num_threads to: %d.", num_threads_);
+  }
   rcl_interfaces::msg::SetParametersResult result;
   result.successful = true;
   result.reason = "success";
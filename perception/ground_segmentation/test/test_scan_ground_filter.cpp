@@ -188,3 +188,21 @@ TEST_F(ScanGroundFilterTest, TestCase1)
   //           << ",percentage:" << percent << std::endl;
   EXPECT_GE(percent, 0.9);
 }
+
+TEST_F(ScanGroundFilterTest, TestParallelClassification)
+{
+  scan_ground_filter_->set_parameter(rclcpp::Parameter("elevation_grid_mode", true));
+
+  sensor_msgs::msg::PointCloud2 sequential_out_cloud;
+  scan_ground_filter_->set_parameter(rclcpp::Parameter("num_threads", 1));
+  filter(sequential_out_cloud);
+
+  // the buffers of the previous frame are reused
+  sensor_msgs::msg::PointCloud2 parallel_out_cloud;
+  scan_ground_filter_->set_parameter(rclcpp::Parameter("num_threads", 4));
+  filter(parallel_out_cloud);
+
+  EXPECT_GT(sequential_out_cloud.width, 0U);
+  EXPECT_EQ(sequential_out_cloud.width, parallel_out_cloud.width);
+  EXPECT_EQ(sequential_out_cloud.data, parallel_out_cloud.data);
+}
@@ -94,6 +94,9 @@ protected:
   void timer_callback();
   void setPeriod(const int64_t new_period);
 
+  // true if every camera is fused, or cannot be fused anymore in the event-driven sync
+  bool isFusionFinished() const;
+
   std::size_t rois_number_{1};
   tf2_ros::Buffer tf_buffer_;
   tf2_ros::TransformListener tf_listener_;
@@ -105,6 +108,7 @@ protected:
   rclcpp::TimerBase::SharedPtr timer_;
   double timeout_ms_{};
   double match_threshold_ms_{};
+  bool event_driven_sync_{false};
   std::vector<std::string> input_rois_topics_;
   std::vector<std::string> input_camera_info_topics_;
   std::vector<std::string> input_camera_topics_;
@@ -118,6 +122,8 @@ protected:
 
   // cache for fusion
   std::vector<bool> is_fused_;
+  // cameras whose rois already passed the cached Msg without a match
+  std::vector<bool> is_unmatchable_;
   std::pair<int64_t, typename Msg::SharedPtr> sub_std_pair_;
   std::vector<std::map<int64_t, DetectedObjectsWithFeature::ConstSharedPtr>> roi_stdmap_;
   std::mutex mutex_;
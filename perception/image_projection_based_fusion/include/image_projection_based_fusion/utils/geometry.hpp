@@ -24,6 +24,7 @@
 #include <geometry_msgs/msg/pose.hpp>
 #include <sensor_msgs/msg/region_of_interest.hpp>
 
+#include <cstddef>
 #include <vector>
 
 namespace image_projection_based_fusion
@@ -64,6 +65,28 @@ bool is_inside(
   const sensor_msgs::msg::RegionOfInterest & outer,
   const sensor_msgs::msg::RegionOfInterest & inner, const double outer_offset_scale = 1.1);
 
+/**
+ * @brief bucket grid over the image to find the ROIs which may contain a pixel
+ */
+class RoiGrid
+{
+public:
+  explicit RoiGrid(
+    const std::vector<sensor_msgs::msg::RegionOfInterest> & rois, const int cell_size = 32);
+
+  /**
+   * @brief get the indices of the ROIs overlapping the cell of the given pixel, in ascending order
+   */
+  const std::vector<std::size_t> & getCandidates(const double x, const double y) const;
+
+private:
+  int cell_size_;
+  int nb_cells_x_{0};
+  int nb_cells_y_{0};
+  std::vector<std::vector<std::size_t>> cells_;
+  std::vector<std::size_t> no_candidates_;
+};
+
 }  // namespace image_projection_based_fusion
 
 #endif  // IMAGE_PROJECTION_BASED_FUSION__UTILS__GEOMETRY_HPP_
@@ -61,6 +61,7 @@ FusionNode<Msg, ObjType>::FusionNode(
   // Set parameters
   match_threshold_ms_ = declare_parameter<double>("match_threshold_ms");
   timeout_ms_ = declare_parameter<double>("timeout_ms");
+  event_driven_sync_ = declare_parameter<bool>("event_driven_sync");
 
   input_rois_topics_.resize(rois_number_);
   input_camera_topics_.resize(rois_number_);
@@ -98,6 +99,7 @@ FusionNode<Msg, ObjType>::FusionNode(
   rois_subs_.resize(rois_number_);
   roi_stdmap_.resize(rois_number_);
   is_fused_.resize(rois_number_, false);
+  is_unmatchable_.resize(rois_number_, false);
   for (std::size_t roi_i = 0; roi_i < rois_number_; ++roi_i) {
     std::function<void(const DetectedObjectsWithFeature::ConstSharedPtr msg)> roi_callback =
       std::bind(&FusionNode::roiCallback, this, std::placeholders::_1, roi_i);
@@ -170,6 +172,7 @@ void FusionNode<Msg, Obj>::subCallback(const typename Msg::ConstSharedPtr input_
     publish(*(sub_std_pair_.second));
     sub_std_pair_.second = nullptr;
     std::fill(is_fused_.begin(), is_fused_.end(), false);
+    std::fill(is_unmatchable_.begin(), is_unmatchable_.end(), false);
 
     // add processing time for debug
     if (debug_publisher_) {
@@ -207,6 +210,7 @@ void FusionNode<Msg, Obj>::subCallback(const typename Msg::ConstSharedPtr input_
     if (camera_info_map_.find(roi_i) == camera_info_map_.end()) {
       RCLCPP_WARN_THROTTLE(
         this->get_logger(), *this->get_clock(), 5000, "no camera info. id is %zu", roi_i);
+      is_unmatchable_.at(roi_i) = true;
       continue;
     }
 
@@ -232,6 +236,13 @@ void FusionNode<Msg, Obj>::subCallback(const typename Msg::ConstSharedPtr input_
         (roi_stdmap_.at(roi_i)).erase(stamp);
       }
 
+      // rois arrive in order, so a newer roi than the matching window means no match will come
+      if (matched_stamp == -1 && !roi_stdmap_.at(roi_i).empty()) {
+        const int64_t new_stamp = timestamp_nsec + input_offset_ms_.at(roi_i) * (int64_t)1e6;
+        is_unmatchable_.at(roi_i) = roi_stdmap_.at(roi_i).rbegin()->first - new_stamp >
+                                    match_threshold_ms_ * (int64_t)1e6;
+      }
+
       // fuseOnSingle
       if (matched_stamp != -1) {
         if (debugger_) {
@@ -259,11 +270,12 @@ void FusionNode<Msg, Obj>::subCallback(const typename Msg::ConstSharedPtr input_
 
   // if all camera fused, postprocess; else, publish the old Msg(if exists) and cache the current
   // Msg
-  if (std::count(is_fused_.begin(), is_fused_.end(), true) == static_cast<int>(rois_number_)) {
+  if (isFusionFinished()) {
     timer_->cancel();
     postprocess(*output_msg);
     publish(*output_msg);
     std::fill(is_fused_.begin(), is_fused_.end(), false);
+    std::fill(is_unmatchable_.begin(), is_unmatchable_.end(), false);
     sub_std_pair_.second = nullptr;
 
     // add processing time for debug
@@ -322,11 +334,12 @@ void FusionNode<Msg, Obj>::roiCallback(
           timestamp_interval_ms - input_offset_ms_.at(roi_i));
       }
 
-      if (std::count(is_fused_.begin(), is_fused_.end(), true) == static_cast<int>(rois_number_)) {
+      if (isFusionFinished()) {
         timer_->cancel();
         postprocess(*(sub_std_pair_.second));
         publish(*(sub_std_pair_.second));
         std::fill(is_fused_.begin(), is_fused_.end(), false);
+        std::fill(is_unmatchable_.begin(), is_unmatchable_.end(), false);
         sub_std_pair_.second = nullptr;
 
         // add processing time for debug
@@ -343,6 +356,33 @@ void FusionNode<Msg, Obj>::roiCallback(
       processing_time_ms = processing_time_ms + stop_watch_ptr_->toc("processing_time", true);
       return;
     }
+
+    // the cached Msg is published as soon as the last camera which can be fused has passed it,
+    // instead of waiting for the timeout
+    if (
+      event_driven_sync_ && is_fused_.at(roi_i) == false &&
+      timestamp_nsec - new_stamp > match_threshold_ms_ * (int64_t)1e6) {
+      is_unmatchable_.at(roi_i) = true;
+      if (isFusionFinished()) {
+        timer_->cancel();
+        postprocess(*(sub_std_pair_.second));
+        publish(*(sub_std_pair_.second));
+        std::fill(is_fused_.begin(), is_fused_.end(), false);
+        std::fill(is_unmatchable_.begin(), is_unmatchable_.end(), false);
+        sub_std_pair_.second = nullptr;
+
+        // add processing time for debug
+        if (debug_publisher_) {
+          const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
+          debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+            "debug/cyclic_time_ms", cyclic_time_ms);
+          debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+            "debug/processing_time_ms",
+            processing_time_ms + stop_watch_ptr_->toc("processing_time", true));
+          processing_time_ms = 0;
+        }
+      }
+    }
   }
   // store roi msg if not matched
   (roi_stdmap_.at(roi_i))[timestamp_nsec] = input_roi_msg;
@@ -379,6 +419,7 @@ void FusionNode<Msg, Obj>::timer_callback()
       }
     }
     std::fill(is_fused_.begin(), is_fused_.end(), false);
+    std::fill(is_unmatchable_.begin(), is_unmatchable_.end(), false);
     sub_std_pair_.second = nullptr;
 
     mutex_.unlock();
@@ -393,6 +434,17 @@ void FusionNode<Msg, Obj>::timer_callback()
   }
 }
 
+template <class Msg, class Obj>
+bool FusionNode<Msg, Obj>::isFusionFinished() const
+{
+  for (std::size_t roi_i = 0; roi_i < rois_number_; ++roi_i) {
+    if (!is_fused_.at(roi_i) && !(event_driven_sync_ && is_unmatchable_.at(roi_i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
 template <class Msg, class Obj>
 void FusionNode<Msg, Obj>::setPeriod(const int64_t new_period)
 {
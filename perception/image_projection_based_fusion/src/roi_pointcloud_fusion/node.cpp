@@ -114,28 +114,41 @@ void RoiPointCloudFusionNode::fuseOnSingleImage(
     transform_stamped = transform_stamped_optional.value();
   }
 
-  sensor_msgs::msg::PointCloud2 transformed_cloud;
-  tf2::doTransform(input_pointcloud_msg, transformed_cloud, transform_stamped);
+  // the same float transform as tf2::doTransform(), applied on the fly instead of to a copy
+  const Eigen::Affine3f transform =
+    Eigen::Translation3f(
+      transform_stamped.transform.translation.x, transform_stamped.transform.translation.y,
+      transform_stamped.transform.translation.z) *
+    Eigen::Quaternionf(
+      transform_stamped.transform.rotation.w, transform_stamped.transform.rotation.x,
+      transform_stamped.transform.rotation.y, transform_stamped.transform.rotation.z);
+
+  std::vector<sensor_msgs::msg::RegionOfInterest> rois;
+  rois.reserve(output_objs.size());
+  for (const auto & feature_obj : output_objs) {
+    rois.push_back(feature_obj.feature.roi);
+  }
+  const RoiGrid roi_grid(rois);
 
   std::vector<PointCloud> clusters;
   clusters.resize(output_objs.size());
 
-  for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(transformed_cloud, "x"),
-       iter_y(transformed_cloud, "y"), iter_z(transformed_cloud, "z"),
-       iter_orig_x(input_pointcloud_msg, "x"), iter_orig_y(input_pointcloud_msg, "y"),
-       iter_orig_z(input_pointcloud_msg, "z");
-       iter_x != iter_x.end();
-       ++iter_x, ++iter_y, ++iter_z, ++iter_orig_x, ++iter_orig_y, ++iter_orig_z) {
-    if (*iter_z <= 0.0) {
+  for (sensor_msgs::PointCloud2ConstIterator<float> iter_orig_x(input_pointcloud_msg, "x"),
+       iter_orig_y(input_pointcloud_msg, "y"), iter_orig_z(input_pointcloud_msg, "z");
+       iter_orig_x != iter_orig_x.end(); ++iter_orig_x, ++iter_orig_y, ++iter_orig_z) {
+    const Eigen::Vector3f point =
+      transform * Eigen::Vector3f(*iter_orig_x, *iter_orig_y, *iter_orig_z);
+    if (point.z() <= 0.0) {
       continue;
     }
-    Eigen::Vector4d projected_point = projection * Eigen::Vector4d(*iter_x, *iter_y, *iter_z, 1.0);
+    Eigen::Vector4d projected_point =
+      projection * Eigen::Vector4d(point.x(), point.y(), point.z(), 1.0);
     Eigen::Vector2d normalized_projected_point = Eigen::Vector2d(
       projected_point.x() / projected_point.z(), projected_point.y() / projected_point.z());
 
-    for (std::size_t i = 0; i < output_objs.size(); ++i) {
-      auto & feature_obj = output_objs.at(i);
-      const auto & check_roi = feature_obj.feature.roi;
+    for (const auto i :
+         roi_grid.getCandidates(normalized_projected_point.x(), normalized_projected_point.y())) {
+      const auto & check_roi = rois.at(i);
       auto & cluster = clusters.at(i);
 
       if (
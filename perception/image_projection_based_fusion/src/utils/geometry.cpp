@@ -16,6 +16,8 @@
 
 #include <rclcpp/rclcpp.hpp>
 
+#include <algorithm>
+
 namespace image_projection_based_fusion
 {
 
@@ -173,4 +175,41 @@ bool is_inside(
          inner.y_offset + inner.height <= (outer.y_offset + outer.height) * outer_offset_scale;
 }
 
+RoiGrid::RoiGrid(
+  const std::vector<sensor_msgs::msg::RegionOfInterest> & rois, const int cell_size)
+: cell_size_(cell_size)
+{
+  for (const auto & roi : rois) {
+    nb_cells_x_ = std::max<int>(nb_cells_x_, (roi.x_offset + roi.width) / cell_size_ + 1);
+    nb_cells_y_ = std::max<int>(nb_cells_y_, (roi.y_offset + roi.height) / cell_size_ + 1);
+  }
+  cells_.resize(nb_cells_x_ * nb_cells_y_);
+  // ROI bounds are inclusive, as in the point-in-ROI checks of the fusion nodes
+  for (std::size_t i = 0; i < rois.size(); ++i) {
+    const auto & roi = rois.at(i);
+    const int min_cx = roi.x_offset / cell_size_;
+    const int min_cy = roi.y_offset / cell_size_;
+    const int max_cx = (roi.x_offset + roi.width) / cell_size_;
+    const int max_cy = (roi.y_offset + roi.height) / cell_size_;
+    for (int cy = min_cy; cy <= max_cy; ++cy) {
+      for (int cx = min_cx; cx <= max_cx; ++cx) {
+        cells_.at(cy * nb_cells_x_ + cx).push_back(i);
+      }
+    }
+  }
+}
+
+const std::vector<std::size_t> & RoiGrid::getCandidates(const double x, const double y) const
+{
+  if (!(x >= 0.0 && y >= 0.0)) {
+    return no_candidates_;
+  }
+  const double cx = x / cell_size_;
+  const double cy = y / cell_size_;
+  if (cx >= nb_cells_x_ || cy >= nb_cells_y_) {
+    return no_candidates_;
+  }
+  return cells_.at(static_cast<int>(cy) * nb_cells_x_ + static_cast<int>(cx));
+}
+
 }  // namespace image_projection_based_fusion
@@ -100,6 +100,11 @@ public:
     const pcl::PointIndices & valid_indices, float objectness_thresh,
     bool use_all_grids_for_clustering);
 
+  // the same as above with the grids grouped on the device, see clusterGrids_launch()
+  void cluster(
+    const float * inferred_data, const int * root_data,
+    const pcl::PointCloud<pcl::PointXYZI>::Ptr & pc_ptr, const pcl::PointIndices & valid_indices);
+
   void filter(const float * inferred_data);
   void classify(const float * inferred_data);
 
@@ -122,6 +127,7 @@ private:
   std::vector<int> point2grid_;
   std::vector<Obstacle> obstacles_;
   std::vector<int> id_img_;
+  std::vector<int> root_to_obstacle_id_;
 
   pcl::PointCloud<pcl::PointXYZI>::Ptr pc_ptr_;
   const std::vector<int> * valid_indices_in_pc_ = nullptr;
@@ -159,6 +165,8 @@ private:
   inline int RowCol2Grid(int row, int col) const { return row * cols_ + col; }
 
   void traverse(Node * x);
+  void setPointCloud(
+    const pcl::PointCloud<pcl::PointXYZI>::Ptr & pc_ptr, const pcl::PointIndices & valid_indices);
 };
 }  // namespace lidar_apollo_instance_segmentation
 
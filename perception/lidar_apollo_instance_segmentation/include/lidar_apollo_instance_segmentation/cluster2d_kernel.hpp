@@ -0,0 +1,37 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LIDAR_APOLLO_INSTANCE_SEGMENTATION__CLUSTER2D_KERNEL_HPP_
+#define LIDAR_APOLLO_INSTANCE_SEGMENTATION__CLUSTER2D_KERNEL_HPP_
+
+#include <cuda.h>
+#include <cuda_runtime_api.h>
+
+#include <cstddef>
+
+namespace lidar_apollo_instance_segmentation
+{
+// number of ints of the workspace for clusterGrids_launch()
+std::size_t getClusterWorkspaceSize(const int rows, const int cols);
+
+// group the grids in the same way as Cluster2D::cluster(), root_data is the representative grid
+// of the obstacle of each grid, or -1 if the grid is not an object
+// point_num_data is the number of points in each grid, nullptr to use all the grids
+cudaError_t clusterGrids_launch(
+  const float * inferred_data, const int * point_num_data, const int rows, const int cols,
+  const float scale, const float objectness_thresh, int * workspace, int * root_data,
+  cudaStream_t stream);
+}  // namespace lidar_apollo_instance_segmentation
+
+#endif  // LIDAR_APOLLO_INSTANCE_SEGMENTATION__CLUSTER2D_KERNEL_HPP_
@@ -17,6 +17,7 @@
 
 #include "cluster2d.hpp"
 #include "feature_generator.hpp"
+#include "feature_generator_kernel.hpp"
 #include "lidar_apollo_instance_segmentation/node.hpp"
 
 #include <cuda_utils/cuda_unique_ptr.hpp>
@@ -51,6 +52,7 @@ private:
   bool transformCloud(
     const sensor_msgs::msg::PointCloud2 & input, sensor_msgs::msg::PointCloud2 & transformed_cloud,
     float z_offset);
+  void generateFeatureMapOnDevice(const pcl::PointCloud<pcl::PointXYZI> & pointcloud);
 
   std::unique_ptr<tensorrt_common::TrtCommon> trt_common_;
 
@@ -63,12 +65,29 @@ private:
   tf2_ros::TransformListener tf_listener_;
   std::string target_frame_;
   float z_offset_;
+  int range_;
+  int width_;
+  int height_;
+
+  // generate the feature map into the input of the network, instead of on the host
+  bool use_gpu_feature_generator_;
+  // group the grids on the device before copying the output of the network to the host
+  bool use_gpu_clustering_;
 
   size_t output_size_;
   CudaUniquePtr<float[]> input_d_;
   CudaUniquePtr<float[]> output_d_;
   CudaUniquePtrHost<float[]> output_h_;
 
+  FeatureMapChannels feature_map_channels_;
+  std::size_t points_capacity_{0};
+  CudaUniquePtrHost<float4[]> points_h_;
+  CudaUniquePtr<float4[]> points_d_;
+  CudaUniquePtr<unsigned long long[]> max_height_keys_d_;
+  CudaUniquePtr<int[]> cluster_workspace_d_;
+  CudaUniquePtr<int[]> root_d_;
+  CudaUniquePtrHost<int[]> root_h_;
+
   StreamUniquePtr stream_{makeCudaStream()};
 };
 }  // namespace lidar_apollo_instance_segmentation
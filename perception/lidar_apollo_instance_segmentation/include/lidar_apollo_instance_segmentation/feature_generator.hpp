@@ -42,6 +42,10 @@ public:
 
   std::shared_ptr<FeatureMapInterface> generate(
     const pcl::PointCloud<pcl::PointXYZI>::Ptr & pc_ptr);
+
+  std::shared_ptr<FeatureMapInterface> getMap() const { return map_ptr_; }
+  float getMinHeight() const { return min_height_; }
+  float getMaxHeight() const { return max_height_; }
 };
 }  // namespace lidar_apollo_instance_segmentation
 
@@ -0,0 +1,51 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_GENERATOR_KERNEL_HPP_
+#define LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_GENERATOR_KERNEL_HPP_
+
+#include <cuda.h>
+#include <cuda_runtime_api.h>
+
+namespace lidar_apollo_instance_segmentation
+{
+// offsets of the channels in the feature map, -1 if the map does not have the channel
+struct FeatureMapChannels
+{
+  int max_height;
+  int mean_height;
+  int count;
+  int top_intensity;
+  int mean_intensity;
+  int nonempty;
+};
+
+// clear the channels computed from the points, the constant channels are kept
+cudaError_t resetFeatureMap_launch(
+  float * map, unsigned long long * max_height_keys, const int width, const int height,
+  const FeatureMapChannels channels, cudaStream_t stream);
+
+// accumulate the points (x, y, z, intensity) into the grids of the map with atomics
+cudaError_t accumulatePoints_launch(
+  const float4 * points, const int num_points, const int width, const int height,
+  const int range, const float min_height, const float max_height, float * map,
+  unsigned long long * max_height_keys, const FeatureMapChannels channels, cudaStream_t stream);
+
+// compute the mean, max and log count features, the same as FeatureGenerator::generate()
+cudaError_t finalizeFeatureMap_launch(
+  const float4 * points, const unsigned long long * max_height_keys, const int width,
+  const int height, const FeatureMapChannels channels, float * map, cudaStream_t stream);
+}  // namespace lidar_apollo_instance_segmentation
+
+#endif  // LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_GENERATOR_KERNEL_HPP_
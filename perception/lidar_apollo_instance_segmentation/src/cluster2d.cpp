@@ -112,24 +112,12 @@ void Cluster2D::cluster(
   const float * instance_pt_x_data = inferred_data + size_;
   const float * instance_pt_y_data = inferred_data + size_ * 2;
 
-  pc_ptr_ = pc_ptr;
+  setPointCloud(pc_ptr, valid_indices);
 
   std::vector<std::vector<Node>> nodes(rows_, std::vector<Node>(cols_, Node()));
-
-  valid_indices_in_pc_ = &(valid_indices.indices);
-  point2grid_.assign(valid_indices_in_pc_->size(), -1);
-
-  for (size_t i = 0; i < valid_indices_in_pc_->size(); ++i) {
-    int point_id = valid_indices_in_pc_->at(i);
-    const auto & point = pc_ptr_->points[point_id];
-    // * the coordinates of x and y have been exchanged in feature generation
-    // step,
-    // so we swap them back here.
-    int pos_x = F2I(point.y, range_, inv_res_x_);  // col
-    int pos_y = F2I(point.x, range_, inv_res_y_);  // row
-    if (IsValidRowCol(pos_y, pos_x)) {
-      point2grid_[i] = RowCol2Grid(pos_y, pos_x);
-      nodes[pos_y][pos_x].point_num++;
+  for (const int grid : point2grid_) {
+    if (grid >= 0) {
+      nodes[grid / cols_][grid % cols_].point_num++;
     }
   }
 
@@ -199,6 +187,54 @@ void Cluster2D::cluster(
   classify(inferred_data);
 }
 
+void Cluster2D::cluster(
+  const float * inferred_data, const int * root_data,
+  const pcl::PointCloud<pcl::PointXYZI>::Ptr & pc_ptr, const pcl::PointIndices & valid_indices)
+{
+  setPointCloud(pc_ptr, valid_indices);
+
+  // the obstacles are numbered in the order of their first grids, the same as on the host
+  obstacles_.clear();
+  id_img_.assign(size_, -1);
+  root_to_obstacle_id_.assign(size_, -1);
+  for (int grid = 0; grid < size_; ++grid) {
+    const int root = root_data[grid];
+    if (root < 0) {
+      continue;
+    }
+    int & obstacle_id = root_to_obstacle_id_[root];
+    if (obstacle_id < 0) {
+      obstacle_id = static_cast<int>(obstacles_.size());
+      obstacles_.push_back(Obstacle());
+    }
+    id_img_[grid] = obstacle_id;
+    obstacles_[obstacle_id].grids.push_back(grid);
+  }
+  filter(inferred_data);
+  classify(inferred_data);
+}
+
+void Cluster2D::setPointCloud(
+  const pcl::PointCloud<pcl::PointXYZI>::Ptr & pc_ptr, const pcl::PointIndices & valid_indices)
+{
+  pc_ptr_ = pc_ptr;
+  valid_indices_in_pc_ = &(valid_indices.indices);
+  point2grid_.assign(valid_indices_in_pc_->size(), -1);
+
+  for (size_t i = 0; i < valid_indices_in_pc_->size(); ++i) {
+    int point_id = valid_indices_in_pc_->at(i);
+    const auto & point = pc_ptr_->points[point_id];
+    // * the coordinates of x and y have been exchanged in feature generation
+    // step,
+    // so we swap them back here.
+    int pos_x = F2I(point.y, range_, inv_res_x_);  // col
+    int pos_y = F2I(point.x, range_, inv_res_y_);  // row
+    if (IsValidRowCol(pos_y, pos_x)) {
+      point2grid_[i] = RowCol2Grid(pos_y, pos_x);
+    }
+  }
+}
+
 void Cluster2D::filter(const float * inferred_data)
 {
   const float * confidence_pt_data = inferred_data + size_ * 3;
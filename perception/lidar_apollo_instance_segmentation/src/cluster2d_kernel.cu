@@ -0,0 +1,201 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lidar_apollo_instance_segmentation/cluster2d_kernel.hpp"
+
+// The centers of the objects are found on the host by following the center nodes from each
+// object grid. On the device, the center nodes are followed by pointer jumping instead: after
+// 2^k >= size jumps every grid reaches a cycle of center nodes, and the cycle is represented by
+// its smallest grid. The adjacent centers are then merged by a lock-free union-find.
+
+namespace
+{
+const int THREADS_PER_BLOCK = 256;
+
+const int FLAG_OBJECT = 1;
+const int FLAG_ON_CYCLE = 2;
+const int FLAG_REACHED = 4;
+const int FLAG_CENTER = 8;
+
+int divup(const int a, const int b)
+{
+  return (a + b - 1) / b;
+}
+
+__device__ int findRoot(const int * parent, int x)
+{
+  while (parent[x] != x) {
+    x = parent[x];
+  }
+  return x;
+}
+
+// link the larger root to the smaller one
+__device__ void unionRoots(int * parent, int a, int b)
+{
+  while (true) {
+    a = findRoot(parent, a);
+    b = findRoot(parent, b);
+    if (a == b) {
+      return;
+    }
+    if (a > b) {
+      const int tmp = a;
+      a = b;
+      b = tmp;
+    }
+    const int old = atomicCAS(&parent[b], b, a);
+    if (old == b) {
+      return;
+    }
+    b = old;
+  }
+}
+}  // namespace
+
+namespace lidar_apollo_instance_segmentation
+{
+__global__ void initNodes_kernel(
+  const float * inferred_data, const int * point_num_data, const int rows, const int cols,
+  const float scale, const float objectness_thresh, int * jump, int * min_grid, int * flags)
+{
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  const int size = rows * cols;
+  if (grid >= size) return;
+
+  const float * category_pt_data = inferred_data;
+  const float * instance_pt_x_data = inferred_data + size;
+  const float * instance_pt_y_data = inferred_data + size * 2;
+
+  const int row = grid / cols;
+  const int col = grid % cols;
+  const bool has_points = point_num_data == nullptr || point_num_data[grid] > 0;
+  flags[grid] = (has_points && category_pt_data[grid] >= objectness_thresh) ? FLAG_OBJECT : 0;
+
+  int center_row = roundf(row + instance_pt_x_data[grid] * scale);
+  int center_col = roundf(col + instance_pt_y_data[grid] * scale);
+  center_row = min(max(center_row, 0), rows - 1);
+  center_col = min(max(center_col, 0), cols - 1);
+  jump[grid] = center_row * cols + center_col;
+  min_grid[grid] = grid;
+}
+
+__global__ void jumpNodes_kernel(
+  const int * jump, const int * min_grid, const int size, int * next_jump, int * next_min_grid)
+{
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid >= size) return;
+
+  const int target = jump[grid];
+  next_jump[grid] = jump[target];
+  next_min_grid[grid] = min(min_grid[grid], min_grid[target]);
+}
+
+__global__ void markCycles_kernel(
+  const int * jump, const int * min_grid, const int size, int * representative, int * flags)
+{
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid >= size) return;
+
+  const int cycle_grid = jump[grid];
+  representative[grid] = min_grid[cycle_grid];
+  atomicOr(&flags[cycle_grid], FLAG_ON_CYCLE);
+  if (flags[grid] & FLAG_OBJECT) {
+    atomicOr(&flags[min_grid[cycle_grid]], FLAG_REACHED);
+  }
+}
+
+// the cycles reached from the objects are the centers, the same as Cluster2D::traverse()
+__global__ void initCenters_kernel(
+  const int * representative, const int size, int * flags, int * parent)
+{
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid >= size) return;
+
+  const bool is_center =
+    (flags[grid] & FLAG_ON_CYCLE) && (flags[representative[grid]] & FLAG_REACHED);
+  if (is_center) {
+    atomicOr(&flags[grid], FLAG_CENTER);
+  }
+  parent[grid] = is_center ? representative[grid] : grid;
+}
+
+__global__ void unionCenters_kernel(
+  const int * flags, const int rows, const int cols, int * parent)
+{
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid >= rows * cols || !(flags[grid] & FLAG_CENTER)) return;
+
+  const int row = grid / cols;
+  const int col = grid % cols;
+  if (col + 1 < cols && (flags[grid + 1] & FLAG_CENTER)) {
+    unionRoots(parent, grid, grid + 1);
+  }
+  if (row + 1 < rows && (flags[grid + cols] & FLAG_CENTER)) {
+    unionRoots(parent, grid, grid + cols);
+  }
+}
+
+__global__ void labelObjects_kernel(
+  const int * flags, const int * representative, const int * parent, const int size,
+  int * root_data)
+{
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid >= size) return;
+
+  root_data[grid] =
+    (flags[grid] & FLAG_OBJECT) ? findRoot(parent, representative[grid]) : -1;
+}
+
+std::size_t getClusterWorkspaceSize(const int rows, const int cols)
+{
+  return static_cast<std::size_t>(rows) * cols * 6;
+}
+
+cudaError_t clusterGrids_launch(
+  const float * inferred_data, const int * point_num_data, const int rows, const int cols,
+  const float scale, const float objectness_thresh, int * workspace, int * root_data,
+  cudaStream_t stream)
+{
+  const int size = rows * cols;
+  int * jump[2] = {workspace, workspace + size};
+  int * min_grid[2] = {workspace + size * 2, workspace + size * 3};
+  int * flags = workspace + size * 4;
+  int * parent = workspace + size * 5;
+  const dim3 blocks(divup(size, THREADS_PER_BLOCK));
+  const dim3 threads(THREADS_PER_BLOCK);
+
+  initNodes_kernel<<<blocks, threads, 0, stream>>>(
+    inferred_data, point_num_data, rows, cols, scale, objectness_thresh, jump[0], min_grid[0],
+    flags);
+
+  int current = 0;
+  for (long long num_jumps = 1; num_jumps < size; num_jumps *= 2) {
+    jumpNodes_kernel<<<blocks, threads, 0, stream>>>(
+      jump[current], min_grid[current], size, jump[1 - current], min_grid[1 - current]);
+    current = 1 - current;
+  }
+
+  // the other buffer of the jumps is reused for the representatives
+  int * representative = jump[1 - current];
+  markCycles_kernel<<<blocks, threads, 0, stream>>>(
+    jump[current], min_grid[current], size, representative, flags);
+  initCenters_kernel<<<blocks, threads, 0, stream>>>(representative, size, flags, parent);
+  unionCenters_kernel<<<blocks, threads, 0, stream>>>(flags, rows, cols, parent);
+  labelObjects_kernel<<<blocks, threads, 0, stream>>>(
+    flags, representative, parent, size, root_data);
+
+  return cudaGetLastError();
+}
+}  // namespace lidar_apollo_instance_segmentation
@@ -14,6 +14,7 @@
 
 #include "lidar_apollo_instance_segmentation/detector.hpp"
 
+#include "lidar_apollo_instance_segmentation/cluster2d_kernel.hpp"
 #include "lidar_apollo_instance_segmentation/feature_map.hpp"
 
 #include <NvCaffeParser.h>
@@ -25,19 +26,20 @@ namespace lidar_apollo_instance_segmentation
 LidarApolloInstanceSegmentation::LidarApolloInstanceSegmentation(rclcpp::Node * node)
 : node_(node), tf_buffer_(node_->get_clock()), tf_listener_(tf_buffer_)
 {
-  int range, width, height;
   bool use_intensity_feature, use_constant_feature;
   std::string onnx_file;
   score_threshold_ = node_->declare_parameter("score_threshold", 0.8);
-  range = node_->declare_parameter("range", 60);
-  width = node_->declare_parameter("width", 640);
-  height = node_->declare_parameter("height", 640);
+  range_ = node_->declare_parameter("range", 60);
+  width_ = node_->declare_parameter("width", 640);
+  height_ = node_->declare_parameter("height", 640);
   onnx_file = node_->declare_parameter("onnx_file", "vls-128.onnx");
   use_intensity_feature = node_->declare_parameter("use_intensity_feature", true);
   use_constant_feature = node_->declare_parameter("use_constant_feature", true);
   target_frame_ = node_->declare_parameter("target_frame", "base_link");
   z_offset_ = node_->declare_parameter<float>("z_offset", -2.0);
   const auto precision = node_->declare_parameter("precision", "fp32");
+  use_gpu_feature_generator_ = node_->declare_parameter("use_gpu_feature_generator", false);
+  use_gpu_clustering_ = node_->declare_parameter("use_gpu_clustering", false);
 
   trt_common_ = std::make_unique<tensorrt_common::TrtCommon>(
     onnx_file, precision, nullptr, tensorrt_common::BatchConfig{1, 1, 1}, 1 << 30);
@@ -61,10 +63,64 @@ LidarApolloInstanceSegmentation::LidarApolloInstanceSegmentation(rclcpp::Node *
 
   // feature map generator: pre process
   feature_generator_ = std::make_shared<FeatureGenerator>(
-    width, height, range, use_intensity_feature, use_constant_feature);
+    width_, height_, range_, use_intensity_feature, use_constant_feature);
+
+  if (use_gpu_feature_generator_) {
+    const auto map_ptr = feature_generator_->getMap();
+    const auto channel = [&map_ptr](const float * data) {
+      const int size = map_ptr->width * map_ptr->height;
+      return data == nullptr ? -1 : static_cast<int>((data - map_ptr->map_data.data()) / size);
+    };
+    feature_map_channels_.max_height = channel(map_ptr->max_height_data);
+    feature_map_channels_.mean_height = channel(map_ptr->mean_height_data);
+    feature_map_channels_.count = channel(map_ptr->count_data);
+    feature_map_channels_.top_intensity = channel(map_ptr->top_intensity_data);
+    feature_map_channels_.mean_intensity = channel(map_ptr->mean_intensity_data);
+    feature_map_channels_.nonempty = channel(map_ptr->nonempty_data);
+    max_height_keys_d_ = cuda_utils::make_unique<unsigned long long[]>(width_ * height_);
+    // the constant channels are not modified by the inference, copy them only once
+    CHECK_CUDA_ERROR(cudaMemcpy(
+      input_d_.get(), map_ptr->map_data.data(), map_ptr->map_data.size() * sizeof(float),
+      cudaMemcpyHostToDevice));
+  }
 
   // cluster: post process
-  cluster2d_ = std::make_shared<Cluster2D>(width, height, range);
+  cluster2d_ = std::make_shared<Cluster2D>(width_, height_, range_);
+  if (use_gpu_clustering_) {
+    cluster_workspace_d_ = cuda_utils::make_unique<int[]>(getClusterWorkspaceSize(width_, height_));
+    root_d_ = cuda_utils::make_unique<int[]>(width_ * height_);
+    root_h_ = cuda_utils::make_unique_host<int[]>(width_ * height_, cudaHostAllocPortable);
+  }
+}
+
+void LidarApolloInstanceSegmentation::generateFeatureMapOnDevice(
+  const pcl::PointCloud<pcl::PointXYZI> & pointcloud)
+{
+  const std::size_t num_points = pointcloud.size();
+  if (points_capacity_ < num_points) {
+    points_capacity_ = num_points;
+    points_h_ = cuda_utils::make_unique_host<float4[]>(points_capacity_, cudaHostAllocPortable);
+    points_d_ = cuda_utils::make_unique<float4[]>(points_capacity_);
+  }
+  for (std::size_t i = 0; i < num_points; ++i) {
+    const auto & point = pointcloud.points[i];
+    points_h_[i] = make_float4(point.x, point.y, point.z, point.intensity);
+  }
+  if (num_points > 0) {
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      points_d_.get(), points_h_.get(), num_points * sizeof(float4), cudaMemcpyHostToDevice,
+      *stream_));
+  }
+
+  CHECK_CUDA_ERROR(resetFeatureMap_launch(
+    input_d_.get(), max_height_keys_d_.get(), width_, height_, feature_map_channels_, *stream_));
+  CHECK_CUDA_ERROR(accumulatePoints_launch(
+    points_d_.get(), static_cast<int>(num_points), width_, height_, range_,
+    feature_generator_->getMinHeight(), feature_generator_->getMaxHeight(), input_d_.get(),
+    max_height_keys_d_.get(), feature_map_channels_, *stream_));
+  CHECK_CUDA_ERROR(finalizeFeatureMap_launch(
+    points_d_.get(), max_height_keys_d_.get(), width_, height_, feature_map_channels_,
+    input_d_.get(), *stream_));
 }
 
 bool LidarApolloInstanceSegmentation::transformCloud(
@@ -123,30 +179,48 @@ bool LidarApolloInstanceSegmentation::detectDynamicObjects(
   pcl::fromROSMsg(transformed_cloud, *pcl_pointcloud_raw_ptr);
 
   // generate feature map
-  std::shared_ptr<FeatureMapInterface> feature_map_ptr =
-    feature_generator_->generate(pcl_pointcloud_raw_ptr);
+  if (use_gpu_feature_generator_) {
+    generateFeatureMapOnDevice(*pcl_pointcloud_raw_ptr);
+  } else {
+    std::shared_ptr<FeatureMapInterface> feature_map_ptr =
+      feature_generator_->generate(pcl_pointcloud_raw_ptr);
 
-  CHECK_CUDA_ERROR(cudaMemcpy(
-    input_d_.get(), feature_map_ptr->map_data.data(),
-    feature_map_ptr->map_data.size() * sizeof(float), cudaMemcpyHostToDevice));
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      input_d_.get(), feature_map_ptr->map_data.data(),
+      feature_map_ptr->map_data.size() * sizeof(float), cudaMemcpyHostToDevice, *stream_));
+  }
 
   std::vector<void *> buffers = {input_d_.get(), output_d_.get()};
 
   trt_common_->enqueueV2(buffers.data(), *stream_, nullptr);
 
+  const float objectness_thresh = 0.5;
+  if (use_gpu_clustering_) {
+    const float scale = 0.5 * static_cast<float>(width_) / range_;
+    CHECK_CUDA_ERROR(clusterGrids_launch(
+      output_d_.get(), nullptr /*use all grids for clustering*/, width_, height_, scale,
+      objectness_thresh, cluster_workspace_d_.get(), root_d_.get(), *stream_));
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      root_h_.get(), root_d_.get(), sizeof(int) * width_ * height_, cudaMemcpyDeviceToHost,
+      *stream_));
+  }
+
   CHECK_CUDA_ERROR(cudaMemcpyAsync(
     output_h_.get(), output_d_.get(), sizeof(float) * output_size_, cudaMemcpyDeviceToHost,
     *stream_));
   cudaStreamSynchronize(*stream_);
 
   // post process
-  const float objectness_thresh = 0.5;
   pcl::PointIndices valid_idx;
   valid_idx.indices.resize(pcl_pointcloud_raw_ptr->size());
   std::iota(valid_idx.indices.begin(), valid_idx.indices.end(), 0);
-  cluster2d_->cluster(
-    output_h_.get(), pcl_pointcloud_raw_ptr, valid_idx, objectness_thresh,
-    true /*use all grids for clustering*/);
+  if (use_gpu_clustering_) {
+    cluster2d_->cluster(output_h_.get(), root_h_.get(), pcl_pointcloud_raw_ptr, valid_idx);
+  } else {
+    cluster2d_->cluster(
+      output_h_.get(), pcl_pointcloud_raw_ptr, valid_idx, objectness_thresh,
+      true /*use all grids for clustering*/);
+  }
   const float height_thresh = 0.5;
   const int min_pts_num = 3;
   cluster2d_->getObjects(
@@ -0,0 +1,154 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lidar_apollo_instance_segmentation/feature_generator_kernel.hpp"
+
+namespace
+{
+const int THREADS_PER_BLOCK = 256;
+
+int divup(const int a, const int b)
+{
+  return (a + b - 1) / b;
+}
+
+// map the float to an unsigned integer with the same order
+__device__ unsigned int orderedFloatBits(const float value)
+{
+  const unsigned int bits = __float_as_uint(value);
+  return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+__device__ float orderedBitsToFloat(const unsigned int bits)
+{
+  return __uint_as_float((bits & 0x80000000u) ? (bits & 0x7fffffffu) : ~bits);
+}
+}  // namespace
+
+namespace lidar_apollo_instance_segmentation
+{
+__global__ void resetFeatureMap_kernel(
+  float * map, unsigned long long * max_height_keys, const int size,
+  const FeatureMapChannels channels)
+{
+  const int idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (idx >= size) return;
+
+  max_height_keys[idx] = 0;
+  map[channels.mean_height * size + idx] = 0.0f;
+  map[channels.count * size + idx] = 0.0f;
+  map[channels.nonempty * size + idx] = 0.0f;
+  if (channels.top_intensity >= 0) {
+    map[channels.top_intensity * size + idx] = 0.0f;
+  }
+  if (channels.mean_intensity >= 0) {
+    map[channels.mean_intensity * size + idx] = 0.0f;
+  }
+}
+
+__global__ void accumulatePoints_kernel(
+  const float4 * points, const int num_points, const int width, const int height,
+  const int range, const float min_height, const float max_height, float * map,
+  unsigned long long * max_height_keys, const FeatureMapChannels channels)
+{
+  const int point_idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (point_idx >= num_points) return;
+
+  const float4 point = points[point_idx];
+  if (point.z <= min_height || max_height <= point.z) return;
+
+  const float inv_res_x = 0.5 * width / range;
+  const float inv_res_y = 0.5 * height / range;
+  const int pos_x = floorf((range - point.y) * inv_res_x);
+  const int pos_y = floorf((range - point.x) * inv_res_y);
+  if (pos_x < 0 || width <= pos_x || pos_y < 0 || height <= pos_y) return;
+
+  const int size = width * height;
+  const int idx = pos_y * width + pos_x;
+
+  // the highest point wins, and the first one of the same height as on the host
+  const unsigned long long key =
+    (static_cast<unsigned long long>(orderedFloatBits(point.z)) << 32) |
+    static_cast<unsigned long long>(0xffffffffu - static_cast<unsigned int>(point_idx));
+  atomicMax(&max_height_keys[idx], key);
+
+  atomicAdd(&map[channels.mean_height * size + idx], point.z);
+  if (channels.mean_intensity >= 0) {
+    atomicAdd(&map[channels.mean_intensity * size + idx], point.w / 255.0f);
+  }
+  atomicAdd(&map[channels.count * size + idx], 1.0f);
+}
+
+__global__ void finalizeFeatureMap_kernel(
+  const float4 * points, const unsigned long long * max_height_keys, const int size,
+  const FeatureMapChannels channels, float * map)
+{
+  const int idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (idx >= size) return;
+
+  const float count = map[channels.count * size + idx];
+  if (count <= 0.0f) {
+    map[channels.max_height * size + idx] = 0.0f;
+  } else {
+    const unsigned long long key = max_height_keys[idx];
+    const unsigned int height_bits = static_cast<unsigned int>(key >> 32);
+    map[channels.max_height * size + idx] = orderedBitsToFloat(height_bits);
+    if (channels.top_intensity >= 0) {
+      const unsigned int point_idx = 0xffffffffu - static_cast<unsigned int>(key & 0xffffffffu);
+      map[channels.top_intensity * size + idx] = points[point_idx].w / 255.0f;
+    }
+    map[channels.mean_height * size + idx] /= count;
+    if (channels.mean_intensity >= 0) {
+      map[channels.mean_intensity * size + idx] /= count;
+    }
+    map[channels.nonempty * size + idx] = 1.0f;
+  }
+  // the counts are integers, for which calcApproximateLog() gives log1p()
+  map[channels.count * size + idx] = log1pf(count);
+}
+
+cudaError_t resetFeatureMap_launch(
+  float * map, unsigned long long * max_height_keys, const int width, const int height,
+  const FeatureMapChannels channels, cudaStream_t stream)
+{
+  const int size = width * height;
+  resetFeatureMap_kernel<<<divup(size, THREADS_PER_BLOCK), THREADS_PER_BLOCK, 0, stream>>>(
+    map, max_height_keys, size, channels);
+  return cudaGetLastError();
+}
+
+cudaError_t accumulatePoints_launch(
+  const float4 * points, const int num_points, const int width, const int height,
+  const int range, const float min_height, const float max_height, float * map,
+  unsigned long long * max_height_keys, const FeatureMapChannels channels, cudaStream_t stream)
+{
+  if (num_points == 0) {
+    return cudaSuccess;
+  }
+  accumulatePoints_kernel<<<divup(num_points, THREADS_PER_BLOCK), THREADS_PER_BLOCK, 0, stream>>>(
+    points, num_points, width, height, range, min_height, max_height, map, max_height_keys,
+    channels);
+  return cudaGetLastError();
+}
+
+cudaError_t finalizeFeatureMap_launch(
+  const float4 * points, const unsigned long long * max_height_keys, const int width,
+  const int height, const FeatureMapChannels channels, float * map, cudaStream_t stream)
+{
+  const int size = width * height;
+  finalizeFeatureMap_kernel<<<divup(size, THREADS_PER_BLOCK), THREADS_PER_BLOCK, 0, stream>>>(
+    points, max_height_keys, size, channels, map);
+  return cudaGetLastError();
+}
+}  // namespace lidar_apollo_instance_segmentation
@@ -57,7 +57,8 @@ class CenterPointTRT
 public:
   explicit CenterPointTRT(
     const NetworkParam & encoder_param, const NetworkParam & head_param,
-    const DensificationParam & densification_param, const CenterPointConfig & config);
+    const DensificationParam & densification_param, const CenterPointConfig & config,
+    const bool use_cuda_graph = false);
 
   ~CenterPointTRT();
 
@@ -73,6 +74,8 @@ protected:
 
   void inference();
 
+  void enqueueInference(const std::size_t num_voxels);
+
   void postProcess(std::vector<Box3D> & det_boxes3d);
 
   std::unique_ptr<VoxelGeneratorTemplate> vg_ptr_{nullptr};
@@ -81,6 +84,12 @@ protected:
   std::unique_ptr<PostProcessCUDA> post_proc_ptr_{nullptr};
   cudaStream_t stream_{nullptr};
 
+  // the encoder, scatter and head launches are captured once and replayed for every frame
+  bool use_cuda_graph_{false};
+  bool is_warmed_up_{false};
+  cudaGraph_t graph_{nullptr};
+  cudaGraphExec_t graph_exec_{nullptr};
+
   std::size_t class_size_{0};
   CenterPointConfig config_;
   std::size_t num_voxels_{0};
@@ -55,6 +55,10 @@ public:
   std::size_t pointsToVoxels(
     std::vector<float> & voxels, std::vector<int> & coordinates,
     std::vector<float> & num_points_per_voxel) override;
+
+private:
+  // voxel index of each grid cell, kept between frames and reset only where voxels were created
+  std::vector<int> coord_to_voxel_idx_;
 };
 
 }  // namespace centerpoint
@@ -28,8 +28,9 @@ namespace centerpoint
 {
 CenterPointTRT::CenterPointTRT(
   const NetworkParam & encoder_param, const NetworkParam & head_param,
-  const DensificationParam & densification_param, const CenterPointConfig & config)
-: config_(config)
+  const DensificationParam & densification_param, const CenterPointConfig & config,
+  const bool use_cuda_graph)
+: use_cuda_graph_(use_cuda_graph), config_(config)
 {
   vg_ptr_ = std::make_unique<VoxelGenerator>(densification_param, config_);
   post_proc_ptr_ = std::make_unique<PostProcessCUDA>(config_);
@@ -61,6 +62,12 @@ CenterPointTRT::CenterPointTRT(
 
 CenterPointTRT::~CenterPointTRT()
 {
+  if (graph_exec_) {
+    cudaGraphExecDestroy(graph_exec_);
+  }
+  if (graph_) {
+    cudaGraphDestroy(graph_);
+  }
   if (stream_) {
     cudaStreamSynchronize(stream_);
     cudaStreamDestroy(stream_);
@@ -81,7 +88,7 @@ void CenterPointTRT::initPtr()
 
   // host
   voxels_.resize(voxels_size);
-  coordinates_.resize(coordinates_size);
+  coordinates_.resize(coordinates_size, -1);
   num_points_per_voxel_.resize(config_.max_voxel_size_);
 
   // device
@@ -103,13 +110,22 @@ bool CenterPointTRT::detect(
   const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const tf2_ros::Buffer & tf_buffer,
   std::vector<Box3D> & det_boxes3d)
 {
-  std::fill(voxels_.begin(), voxels_.end(), 0);
-  std::fill(coordinates_.begin(), coordinates_.end(), -1);
-  std::fill(num_points_per_voxel_.begin(), num_points_per_voxel_.end(), 0);
+  // only the voxels of the previous frame were written, the rest of the buffers is still cleared
+  std::fill(
+    voxels_.begin(),
+    voxels_.begin() + num_voxels_ * config_.max_point_in_voxel_size_ * config_.point_feature_size_,
+    0);
+  std::fill(coordinates_.begin(), coordinates_.begin() + num_voxels_ * config_.point_dim_size_, -1);
+  std::fill(num_points_per_voxel_.begin(), num_points_per_voxel_.begin() + num_voxels_, 0);
   CHECK_CUDA_ERROR(cudaMemsetAsync(
     encoder_in_features_d_.get(), 0, encoder_in_feature_size_ * sizeof(float), stream_));
   CHECK_CUDA_ERROR(
     cudaMemsetAsync(spatial_features_d_.get(), 0, spatial_features_size_ * sizeof(float), stream_));
+  if (use_cuda_graph_) {
+    // the captured scatter kernel goes over all the voxels and skips the ones without coordinates
+    CHECK_CUDA_ERROR(
+      cudaMemsetAsync(coordinates_d_.get(), -1, coordinates_.size() * sizeof(int), stream_));
+  }
 
   if (!preprocess(input_pointcloud_msg, tf_buffer)) {
     RCLCPP_WARN_STREAM(
@@ -165,13 +181,39 @@ void CenterPointTRT::inference()
     throw std::runtime_error("Failed to create tensorrt context.");
   }
 
+  if (!use_cuda_graph_) {
+    enqueueInference(num_voxels_);
+    return;
+  }
+
+  if (graph_exec_) {
+    CHECK_CUDA_ERROR(cudaGraphLaunch(graph_exec_, stream_));
+    return;
+  }
+
+  // TensorRT may allocate memory in the first enqueue, which cannot be captured
+  if (!is_warmed_up_) {
+    enqueueInference(config_.max_voxel_size_);
+    is_warmed_up_ = true;
+    return;
+  }
+
+  CHECK_CUDA_ERROR(cudaStreamBeginCapture(stream_, cudaStreamCaptureModeThreadLocal));
+  enqueueInference(config_.max_voxel_size_);
+  CHECK_CUDA_ERROR(cudaStreamEndCapture(stream_, &graph_));
+  CHECK_CUDA_ERROR(cudaGraphInstantiate(&graph_exec_, graph_, nullptr, nullptr, 0));
+  CHECK_CUDA_ERROR(cudaGraphLaunch(graph_exec_, stream_));
+}
+
+void CenterPointTRT::enqueueInference(const std::size_t num_voxels)
+{
   // pillar encoder network
   std::vector<void *> encoder_buffers{encoder_in_features_d_.get(), pillar_features_d_.get()};
   encoder_trt_ptr_->context_->enqueueV2(encoder_buffers.data(), stream_, nullptr);
 
   // scatter
   CHECK_CUDA_ERROR(scatterFeatures_launch(
-    pillar_features_d_.get(), coordinates_d_.get(), num_voxels_, config_.max_voxel_size_,
+    pillar_features_d_.get(), coordinates_d_.get(), num_voxels, config_.max_voxel_size_,
     config_.encoder_out_feature_size_, config_.grid_size_x_, config_.grid_size_y_,
     spatial_features_d_.get(), stream_));
 
@@ -52,7 +52,9 @@ std::size_t VoxelGenerator::pointsToVoxels(
   // num_points_per_voxel (float): (max_voxel_size)
 
   const std::size_t grid_size = config_.grid_size_z_ * config_.grid_size_y_ * config_.grid_size_x_;
-  std::vector<int> coord_to_voxel_idx(grid_size, -1);
+  if (coord_to_voxel_idx_.size() != grid_size) {
+    coord_to_voxel_idx_.assign(grid_size, -1);
+  }
 
   std::size_t voxel_cnt = 0;  // @return
   std::vector<float> point;
@@ -66,7 +68,7 @@ std::size_t VoxelGenerator::pointsToVoxels(
 
   for (auto pc_cache_iter = pd_ptr_->getPointCloudCacheIter(); !pd_ptr_->isCacheEnd(pc_cache_iter);
        pc_cache_iter++) {
-    auto pc_msg = pc_cache_iter->pointcloud_msg;
+    const auto & pc_msg = pc_cache_iter->pointcloud_msg;
     auto affine_past2current =
       pd_ptr_->pointcloud_cache_size() > 1
         ? pd_ptr_->getAffineWorldToCurrent() * pc_cache_iter->affine_past2world
@@ -100,7 +102,7 @@ std::size_t VoxelGenerator::pointsToVoxels(
 
       coord_idx = coord_zyx[0] * config_.grid_size_y_ * config_.grid_size_x_ +
                   coord_zyx[1] * config_.grid_size_x_ + coord_zyx[2];
-      voxel_idx = coord_to_voxel_idx[coord_idx];
+      voxel_idx = coord_to_voxel_idx_[coord_idx];
       if (voxel_idx == -1) {
         voxel_idx = voxel_cnt;
         if (voxel_cnt >= config_.max_voxel_size_) {
@@ -108,7 +110,7 @@ std::size_t VoxelGenerator::pointsToVoxels(
         }
 
         voxel_cnt++;
-        coord_to_voxel_idx[coord_idx] = voxel_idx;
+        coord_to_voxel_idx_[coord_idx] = voxel_idx;
         for (std::size_t di = 0; di < config_.point_dim_size_; di++) {
           coordinates[voxel_idx * config_.point_dim_size_ + di] = coord_zyx[di];
         }
@@ -126,6 +128,13 @@ std::size_t VoxelGenerator::pointsToVoxels(
     }
   }
 
+  for (std::size_t vi = 0; vi < voxel_cnt; vi++) {
+    const int * voxel_coord_zyx = &coordinates[vi * config_.point_dim_size_];
+    coord_idx = voxel_coord_zyx[0] * config_.grid_size_y_ * config_.grid_size_x_ +
+                voxel_coord_zyx[1] * config_.grid_size_x_ + voxel_coord_zyx[2];
+    coord_to_voxel_idx_[coord_idx] = -1;
+  }
+
   return voxel_cnt;
 }
 
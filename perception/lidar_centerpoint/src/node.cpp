@@ -103,8 +103,9 @@ LidarCenterPointNode::LidarCenterPointNode(const rclcpp::NodeOptions & node_opti
     class_names_.size(), point_feature_size, max_voxel_size, point_cloud_range, voxel_size,
     downsample_factor, encoder_in_feature_size, score_threshold, circle_nms_dist_threshold,
     yaw_norm_thresholds);
-  detector_ptr_ =
-    std::make_unique<CenterPointTRT>(encoder_param, head_param, densification_param, config);
+  const bool use_cuda_graph = this->declare_parameter("use_cuda_graph", false);
+  detector_ptr_ = std::make_unique<CenterPointTRT>(
+    encoder_param, head_param, densification_param, config, use_cuda_graph);
 
   pointcloud_sub_ = this->create_subscription<sensor_msgs::msg::PointCloud2>(
     "~/input/pointcloud", rclcpp::SensorDataQoS{}.keep_last(1),
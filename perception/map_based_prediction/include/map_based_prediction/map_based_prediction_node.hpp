@@ -17,6 +17,7 @@
 
 #include "map_based_prediction/path_generator.hpp"
 
+#include <latency_aggregator/latency_hop_publisher.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <tier4_autoware_utils/ros/transform_listener.hpp>
 #include <tier4_autoware_utils/system/stop_watch.hpp>
@@ -26,6 +27,7 @@
 #include <autoware_auto_perception_msgs/msg/tracked_objects.hpp>
 #include <geometry_msgs/msg/pose.hpp>
 #include <geometry_msgs/msg/pose_stamped.hpp>
+#include <geometry_msgs/msg/transform_stamped.hpp>
 #include <geometry_msgs/msg/twist.hpp>
 #include <tier4_debug_msgs/msg/string_stamped.hpp>
 #include <visualization_msgs/msg/marker_array.hpp>
@@ -35,7 +37,12 @@
 #include <lanelet2_traffic_rules/TrafficRules.h>
 
 #include <deque>
+#include <functional>
+#include <list>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -84,7 +91,7 @@ struct LaneletData
 struct PredictedRefPath
 {
   float probability;
-  PosePath path;
+  std::shared_ptr<const PosePath> path;
   Maneuver maneuver;
 };
 
@@ -102,6 +109,16 @@ using autoware_auto_perception_msgs::msg::TrackedObjects;
 using tier4_autoware_utils::StopWatch;
 using tier4_debug_msgs::msg::StringStamped;
 
+// intermediate results of the prediction of a single object in objectsCallback
+struct ObjectPredictionData
+{
+  TrackedObject transformed_object;
+  ObjectClassification::_label_type label;
+  LaneletsData current_lanelets;
+  std::optional<PredictedObject> predicted_object;
+  std::optional<Maneuver> debug_maneuver;
+};
+
 class MapBasedPredictionNode : public rclcpp::Node
 {
 public:
@@ -114,6 +131,7 @@ private:
   rclcpp::Publisher<StringStamped>::SharedPtr pub_calculation_time_;
   rclcpp::Subscription<TrackedObjects>::SharedPtr sub_objects_;
   rclcpp::Subscription<HADMapBin>::SharedPtr sub_map_;
+  std::unique_ptr<latency_aggregator::LatencyHopPublisher> latency_hop_publisher_;
 
   // Object History
   std::unordered_map<std::string, std::deque<ObjectData>> objects_history_;
@@ -129,6 +147,13 @@ private:
   // Path Generator
   std::shared_ptr<PathGenerator> path_generator_;
 
+  // Resampled reference paths by lanelet ids, the least recently used path first
+  std::list<std::pair<std::vector<lanelet::Id>, std::shared_ptr<const PosePath>>>
+    reference_path_cache_;
+  std::map<std::vector<lanelet::Id>, decltype(reference_path_cache_)::iterator>
+    reference_path_cache_index_;
+  std::mutex reference_path_cache_mutex_;
+
   // Crosswalk Entry Points
   lanelet::ConstLanelets crosswalks_;
 
@@ -157,6 +182,7 @@ private:
   double diff_dist_threshold_to_right_bound_;
   int num_continuous_state_transition_;
   double reference_path_resolution_;
+  int num_threads_;
 
   // Stop watch
   StopWatch<std::chrono::milliseconds> stop_watch_;
@@ -165,6 +191,13 @@ private:
   void mapCallback(const HADMapBin::ConstSharedPtr msg);
   void objectsCallback(const TrackedObjects::ConstSharedPtr in_objects);
 
+  void preprocessObject(
+    const TrackedObject & object, const std::string & frame_id,
+    const geometry_msgs::msg::TransformStamped & world2map_transform,
+    ObjectPredictionData & object_data);
+  void predictObject(const double objects_detected_time, ObjectPredictionData & object_data);
+  void runInParallel(const size_t size, const std::function<void(const size_t)> & function) const;
+
   bool doesPathCrossAnyFence(const PredictedPath & predicted_path);
   bool doesPathCrossFence(
     const PredictedPath & predicted_path, const lanelet::ConstLineString3d & fence_line);
@@ -183,6 +216,9 @@ private:
   void removeOldObjectsHistory(const double current_time);
 
   LaneletsData getCurrentLanelets(const TrackedObject & object);
+  LaneletsData getSameDirectionLanelets(
+    const std::vector<std::pair<double, lanelet::Lanelet>> & surrounding_lanelets,
+    const TrackedObject & object);
   bool checkCloseLaneletCondition(
     const std::pair<double, lanelet::Lanelet> & lanelet, const TrackedObject & object);
   float calculateLocalLikelihood(
@@ -215,7 +251,9 @@ private:
     const TrackedObject & object, const lanelet::routing::LaneletPaths & candidate_paths,
     const float path_probability, const ManeuverProbability & maneuver_probability,
     const Maneuver & maneuver, std::vector<PredictedRefPath> & reference_paths);
-  std::vector<PosePath> convertPathType(const lanelet::routing::LaneletPaths & paths);
+  std::vector<std::shared_ptr<const PosePath>> convertPathType(
+    const lanelet::routing::LaneletPaths & paths);
+  PosePath convertPathType(const lanelet::routing::LaneletPath & path);
 
   void updateFuturePossibleLanelets(
     const TrackedObject & object, const lanelet::routing::LaneletPaths & paths);
@@ -44,10 +44,15 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cmath>
 #include <functional>
+#include <iterator>
 #include <limits>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
 
 namespace map_based_prediction
 {
@@ -687,6 +692,27 @@ lanelet::Lanelets getLeftOppositeLanelets(
 
   return opposite_lanelets;
 }
+
+// maximum number of resampled reference paths kept in memory
+constexpr size_t reference_path_cache_size = 1000;
+
+bool isVehicleLabel(const ObjectClassification::_label_type & label)
+{
+  return label == ObjectClassification::CAR || label == ObjectClassification::BUS ||
+         label == ObjectClassification::TRAILER || label == ObjectClassification::MOTORCYCLE ||
+         label == ObjectClassification::TRUCK;
+}
+
+bool hasUniqueObjectIds(const std::vector<TrackedObject> & objects)
+{
+  std::unordered_set<std::string> object_ids;
+  for (const auto & object : objects) {
+    if (!object_ids.insert(tier4_autoware_utils::toHexString(object.object_id)).second) {
+      return false;
+    }
+  }
+  return true;
+}
 }  // namespace
 
 MapBasedPredictionNode::MapBasedPredictionNode(const rclcpp::NodeOptions & node_options)
@@ -734,6 +760,7 @@ MapBasedPredictionNode::MapBasedPredictionNode(const rclcpp::NodeOptions & node_
       declare_parameter<int>("lane_change_detection.num_continuous_state_transition");
   }
   reference_path_resolution_ = declare_parameter<double>("reference_path_resolution");
+  num_threads_ = declare_parameter<int>("num_threads");
   /* prediction path will disabled when the estimated path length exceeds lanelet length. This
    * parameter control the estimated path length = vx * th * (rate)  */
   prediction_time_horizon_rate_for_validate_lane_length_ =
@@ -750,6 +777,8 @@ MapBasedPredictionNode::MapBasedPredictionNode(const rclcpp::NodeOptions & node_
     std::bind(&MapBasedPredictionNode::mapCallback, this, std::placeholders::_1));
 
   pub_objects_ = this->create_publisher<PredictedObjects>("~/output/objects", rclcpp::QoS{1});
+  latency_hop_publisher_ = std::make_unique<latency_aggregator::LatencyHopPublisher>(
+    this, pub_objects_->get_topic_name());
   pub_debug_markers_ =
     this->create_publisher<visualization_msgs::msg::MarkerArray>("maneuver", rclcpp::QoS{1});
   pub_calculation_time_ = create_publisher<StringStamped>("~/debug/calculation_time", 1);
@@ -791,11 +820,22 @@ void MapBasedPredictionNode::mapCallback(const HADMapBin::ConstSharedPtr msg)
   const auto walkways = lanelet::utils::query::walkwayLanelets(all_lanelets);
   crosswalks_.insert(crosswalks_.end(), crosswalks.begin(), crosswalks.end());
   crosswalks_.insert(crosswalks_.end(), walkways.begin(), walkways.end());
+
+  reference_path_cache_.clear();
+  reference_path_cache_index_.clear();
+
+  // lanelets compute their centerline lazily on first access, which is not safe while objects are
+  // predicted in parallel
+  for (const auto & lanelet : all_lanelets) {
+    lanelet.centerline();
+  }
 }
 
 void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPtr in_objects)
 {
   stop_watch_.tic();
+  const auto hop_input =
+    latency_hop_publisher_->createInput(sub_objects_->get_topic_name(), in_objects->header.stamp);
   // Guard for map pointer and frame transformation
   if (!lanelet_map_ptr_) {
     return;
@@ -830,150 +870,225 @@ void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPt
   // result debug
   visualization_msgs::msg::MarkerArray debug_markers;
 
-  for (const auto & object : in_objects->objects) {
-    std::string object_id = tier4_autoware_utils::toHexString(object.object_id);
-    TrackedObject transformed_object = object;
-
-    // transform object frame if it's based on map frame
-    if (in_objects->header.frame_id != "map") {
-      geometry_msgs::msg::PoseStamped pose_in_map;
-      geometry_msgs::msg::PoseStamped pose_orig;
-      pose_orig.pose = object.kinematics.pose_with_covariance.pose;
-      tf2::doTransform(pose_orig, pose_in_map, *world2map_transform);
-      transformed_object.kinematics.pose_with_covariance.pose = pose_in_map.pose;
-    }
-
-    // get tracking label and update it for the prediction
-    const auto & label_ = transformed_object.classification.front().label;
-    const auto label = changeLabelForPrediction(label_, object, lanelet_map_ptr_);
-
-    switch (label) {
-      case ObjectClassification::PEDESTRIAN:
-      case ObjectClassification::BICYCLE: {
-        const auto predicted_object_crosswalk =
-          getPredictedObjectAsCrosswalkUser(transformed_object);
-        output.objects.push_back(predicted_object_crosswalk);
-        break;
-      }
-      case ObjectClassification::CAR:
-      case ObjectClassification::BUS:
-      case ObjectClassification::TRAILER:
-      case ObjectClassification::MOTORCYCLE:
-      case ObjectClassification::TRUCK: {
-        // Update object yaw and velocity
-        updateObjectData(transformed_object);
-
-        // Get Closest Lanelet
-        const auto current_lanelets = getCurrentLanelets(transformed_object);
-
-        // Update Objects History
-        updateObjectsHistory(output.header, transformed_object, current_lanelets);
-
-        // For off lane obstacles
-        if (current_lanelets.empty()) {
-          PredictedPath predicted_path =
-            path_generator_->generatePathForOffLaneVehicle(transformed_object);
-          predicted_path.confidence = 1.0;
-          if (predicted_path.path.empty()) break;
-
-          auto predicted_object_vehicle = convertToPredictedObject(transformed_object);
-          predicted_object_vehicle.kinematics.predicted_paths.push_back(predicted_path);
-          output.objects.push_back(predicted_object_vehicle);
-          break;
-        }
+  // Objects are predicted in three steps:
+  // 1. transform the object and search its current lanelets (reads the object history only)
+  // 2. update the object history (modifies the object history)
+  // 3. predict the paths (modifies the history entry of the object only)
+  // All objects must have different ids to run steps 1 and 3 in parallel, otherwise an object
+  // would see the history updated by another object with the same id.
+  const auto & objects = in_objects->objects;
+  std::vector<ObjectPredictionData> objects_data(objects.size());
+  const auto update_history = [&](const size_t i) {
+    if (isVehicleLabel(objects_data.at(i).label)) {
+      updateObjectsHistory(
+        output.header, objects_data.at(i).transformed_object, objects_data.at(i).current_lanelets);
+    }
+  };
+  if (num_threads_ > 1 && hasUniqueObjectIds(objects)) {
+    runInParallel(objects.size(), [&](const size_t i) {
+      preprocessObject(
+        objects.at(i), in_objects->header.frame_id, *world2map_transform, objects_data.at(i));
+    });
+    for (size_t i = 0; i < objects.size(); ++i) {
+      update_history(i);
+    }
+    runInParallel(objects.size(), [&](const size_t i) {
+      predictObject(objects_detected_time, objects_data.at(i));
+    });
+  } else {
+    for (size_t i = 0; i < objects.size(); ++i) {
+      preprocessObject(
+        objects.at(i), in_objects->header.frame_id, *world2map_transform, objects_data.at(i));
+      update_history(i);
+      predictObject(objects_detected_time, objects_data.at(i));
+    }
+  }
 
-        // For too-slow vehicle
-        const double abs_obj_speed = std::hypot(
-          transformed_object.kinematics.twist_with_covariance.twist.linear.x,
-          transformed_object.kinematics.twist_with_covariance.twist.linear.y);
-        if (std::fabs(abs_obj_speed) < min_velocity_for_map_based_prediction_) {
-          PredictedPath predicted_path =
-            path_generator_->generatePathForLowSpeedVehicle(transformed_object);
-          predicted_path.confidence = 1.0;
-          if (predicted_path.path.empty()) break;
-
-          auto predicted_slow_object = convertToPredictedObject(transformed_object);
-          predicted_slow_object.kinematics.predicted_paths.push_back(predicted_path);
-          output.objects.push_back(predicted_slow_object);
-          break;
-        }
+  // output in the order of the input objects
+  for (size_t i = 0; i < objects.size(); ++i) {
+    auto & object_data = objects_data.at(i);
+    if (object_data.debug_maneuver) {
+      // Get Debug Marker for On Lane Vehicles
+      const auto debug_marker = getDebugMarker(
+        objects.at(i), object_data.debug_maneuver.value(), debug_markers.markers.size());
+      debug_markers.markers.push_back(debug_marker);
+    }
+    if (object_data.predicted_object) {
+      output.objects.push_back(std::move(object_data.predicted_object.value()));
+    }
+  }
 
-        // Get Predicted Reference Path for Each Maneuver and current lanelets
-        // return: <probability, paths>
-        const auto ref_paths =
-          getPredictedReferencePath(transformed_object, current_lanelets, objects_detected_time);
-
-        // If predicted reference path is empty, assume this object is out of the lane
-        if (ref_paths.empty()) {
-          PredictedPath predicted_path =
-            path_generator_->generatePathForLowSpeedVehicle(transformed_object);
-          predicted_path.confidence = 1.0;
-          if (predicted_path.path.empty()) break;
-
-          auto predicted_object_out_of_lane = convertToPredictedObject(transformed_object);
-          predicted_object_out_of_lane.kinematics.predicted_paths.push_back(predicted_path);
-          output.objects.push_back(predicted_object_out_of_lane);
-          break;
-        }
+  // Publish Results
+  pub_objects_->publish(output);
+  latency_hop_publisher_->publish(hop_input, output.header.stamp);
+  pub_debug_markers_->publish(debug_markers);
+  const auto calculation_time_msg = createStringStamped(now(), stop_watch_.toc());
+  pub_calculation_time_->publish(calculation_time_msg);
+}
 
-        // Get Debug Marker for On Lane Vehicles
-        const auto max_prob_path = std::max_element(
-          ref_paths.begin(), ref_paths.end(),
-          [](const PredictedRefPath & a, const PredictedRefPath & b) {
-            return a.probability < b.probability;
-          });
-        const auto debug_marker =
-          getDebugMarker(object, max_prob_path->maneuver, debug_markers.markers.size());
-        debug_markers.markers.push_back(debug_marker);
-
-        // Generate Predicted Path
-        std::vector<PredictedPath> predicted_paths;
-        for (const auto & ref_path : ref_paths) {
-          PredictedPath predicted_path =
-            path_generator_->generatePathForOnLaneVehicle(transformed_object, ref_path.path);
-          if (predicted_path.path.empty()) {
-            continue;
-          }
-          predicted_path.confidence = ref_path.probability;
-          predicted_paths.push_back(predicted_path);
-        }
+void MapBasedPredictionNode::preprocessObject(
+  const TrackedObject & object, const std::string & frame_id,
+  const geometry_msgs::msg::TransformStamped & world2map_transform,
+  ObjectPredictionData & object_data)
+{
+  TrackedObject & transformed_object = object_data.transformed_object;
+  transformed_object = object;
 
-        // Normalize Path Confidence and output the predicted object
+  // transform object frame if it's based on map frame
+  if (frame_id != "map") {
+    geometry_msgs::msg::PoseStamped pose_in_map;
+    geometry_msgs::msg::PoseStamped pose_orig;
+    pose_orig.pose = object.kinematics.pose_with_covariance.pose;
+    tf2::doTransform(pose_orig, pose_in_map, world2map_transform);
+    transformed_object.kinematics.pose_with_covariance.pose = pose_in_map.pose;
+  }
 
-        float sum_confidence = 0.0;
-        for (const auto & predicted_path : predicted_paths) {
-          sum_confidence += predicted_path.confidence;
-        }
-        const float min_sum_confidence_value = 1e-3;
-        sum_confidence = std::max(sum_confidence, min_sum_confidence_value);
+  // get tracking label and update it for the prediction
+  const auto & label_ = transformed_object.classification.front().label;
+  object_data.label = changeLabelForPrediction(label_, object, lanelet_map_ptr_);
 
-        auto predicted_object = convertToPredictedObject(transformed_object);
+  if (isVehicleLabel(object_data.label)) {
+    // Update object yaw and velocity
+    updateObjectData(transformed_object);
 
-        for (auto & predicted_path : predicted_paths) {
-          predicted_path.confidence = predicted_path.confidence / sum_confidence;
-          predicted_object.kinematics.predicted_paths.push_back(predicted_path);
-        }
-        output.objects.push_back(predicted_object);
+    // Get Closest Lanelet
+    object_data.current_lanelets = getCurrentLanelets(transformed_object);
+  }
+}
+
+void MapBasedPredictionNode::predictObject(
+  const double objects_detected_time, ObjectPredictionData & object_data)
+{
+  const auto & transformed_object = object_data.transformed_object;
+  const auto & current_lanelets = object_data.current_lanelets;
+
+  switch (object_data.label) {
+    case ObjectClassification::PEDESTRIAN:
+    case ObjectClassification::BICYCLE: {
+      object_data.predicted_object = getPredictedObjectAsCrosswalkUser(transformed_object);
+      break;
+    }
+    case ObjectClassification::CAR:
+    case ObjectClassification::BUS:
+    case ObjectClassification::TRAILER:
+    case ObjectClassification::MOTORCYCLE:
+    case ObjectClassification::TRUCK: {
+      // For off lane obstacles
+      if (current_lanelets.empty()) {
+        PredictedPath predicted_path =
+          path_generator_->generatePathForOffLaneVehicle(transformed_object);
+        predicted_path.confidence = 1.0;
+        if (predicted_path.path.empty()) break;
+
+        auto predicted_object_vehicle = convertToPredictedObject(transformed_object);
+        predicted_object_vehicle.kinematics.predicted_paths.push_back(predicted_path);
+        object_data.predicted_object = predicted_object_vehicle;
+        break;
+      }
+
+      // For too-slow vehicle
+      const double abs_obj_speed = std::hypot(
+        transformed_object.kinematics.twist_with_covariance.twist.linear.x,
+        transformed_object.kinematics.twist_with_covariance.twist.linear.y);
+      if (std::fabs(abs_obj_speed) < min_velocity_for_map_based_prediction_) {
+        PredictedPath predicted_path =
+          path_generator_->generatePathForLowSpeedVehicle(transformed_object);
+        predicted_path.confidence = 1.0;
+        if (predicted_path.path.empty()) break;
+
+        auto predicted_slow_object = convertToPredictedObject(transformed_object);
+        predicted_slow_object.kinematics.predicted_paths.push_back(predicted_path);
+        object_data.predicted_object = predicted_slow_object;
         break;
       }
-      default: {
-        auto predicted_unknown_object = convertToPredictedObject(transformed_object);
+
+      // Get Predicted Reference Path for Each Maneuver and current lanelets
+      // return: <probability, paths>
+      const auto ref_paths =
+        getPredictedReferencePath(transformed_object, current_lanelets, objects_detected_time);
+
+      // If predicted reference path is empty, assume this object is out of the lane
+      if (ref_paths.empty()) {
         PredictedPath predicted_path =
-          path_generator_->generatePathForNonVehicleObject(transformed_object);
+          path_generator_->generatePathForLowSpeedVehicle(transformed_object);
         predicted_path.confidence = 1.0;
+        if (predicted_path.path.empty()) break;
 
-        predicted_unknown_object.kinematics.predicted_paths.push_back(predicted_path);
-        output.objects.push_back(predicted_unknown_object);
+        auto predicted_object_out_of_lane = convertToPredictedObject(transformed_object);
+        predicted_object_out_of_lane.kinematics.predicted_paths.push_back(predicted_path);
+        object_data.predicted_object = predicted_object_out_of_lane;
         break;
       }
+
+      // Maneuver for the debug marker, which is created in the output order
+      const auto max_prob_path = std::max_element(
+        ref_paths.begin(), ref_paths.end(),
+        [](const PredictedRefPath & a, const PredictedRefPath & b) {
+          return a.probability < b.probability;
+        });
+      object_data.debug_maneuver = max_prob_path->maneuver;
+
+      // Generate Predicted Path
+      std::vector<PredictedPath> predicted_paths;
+      for (const auto & ref_path : ref_paths) {
+        PredictedPath predicted_path =
+          path_generator_->generatePathForOnLaneVehicle(transformed_object, *ref_path.path);
+        if (predicted_path.path.empty()) {
+          continue;
+        }
+        predicted_path.confidence = ref_path.probability;
+        predicted_paths.push_back(predicted_path);
+      }
+
+      // Normalize Path Confidence and output the predicted object
+
+      float sum_confidence = 0.0;
+      for (const auto & predicted_path : predicted_paths) {
+        sum_confidence += predicted_path.confidence;
+      }
+      const float min_sum_confidence_value = 1e-3;
+      sum_confidence = std::max(sum_confidence, min_sum_confidence_value);
+
+      auto predicted_object = convertToPredictedObject(transformed_object);
+
+      for (auto & predicted_path : predicted_paths) {
+        predicted_path.confidence = predicted_path.confidence / sum_confidence;
+        predicted_object.kinematics.predicted_paths.push_back(predicted_path);
+      }
+      object_data.predicted_object = predicted_object;
+      break;
+    }
+    default: {
+      auto predicted_unknown_object = convertToPredictedObject(transformed_object);
+      PredictedPath predicted_path =
+        path_generator_->generatePathForNonVehicleObject(transformed_object);
+      predicted_path.confidence = 1.0;
+
+      predicted_unknown_object.kinematics.predicted_paths.push_back(predicted_path);
+      object_data.predicted_object = predicted_unknown_object;
+      break;
     }
   }
+}
 
-  // Publish Results
-  pub_objects_->publish(output);
-  pub_debug_markers_->publish(debug_markers);
-  const auto calculation_time_msg = createStringStamped(now(), stop_watch_.toc());
-  pub_calculation_time_->publish(calculation_time_msg);
+void MapBasedPredictionNode::runInParallel(
+  const size_t size, const std::function<void(const size_t)> & function) const
+{
+  const size_t nb_workers = std::min(static_cast<size_t>(std::max(num_threads_, 1)), size);
+  std::atomic<size_t> next_idx{0};
+  const auto work = [&]() {
+    for (auto idx = next_idx++; idx < size; idx = next_idx++) {
+      function(idx);
+    }
+  };
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < nb_workers; ++i) {
+    workers.emplace_back(work);
+  }
+  work();
+  for (auto & worker : workers) {
+    worker.join();
+  }
 }
 
 bool MapBasedPredictionNode::doesPathCrossAnyFence(const PredictedPath & predicted_path)
@@ -1233,6 +1348,31 @@ LaneletsData MapBasedPredictionNode::getCurrentLanelets(const TrackedObject & ob
     object.kinematics.pose_with_covariance.pose.position.x,
     object.kinematics.pose_with_covariance.pose.position.y);
 
+  // The lanelets accepted by checkCloseLaneletCondition() are limited to the lanelets the object
+  // may have reached since the previous frame, so check them before searching the whole map.
+  const std::string object_id = tier4_autoware_utils::toHexString(object.object_id);
+  const auto history = objects_history_.find(object_id);
+  if (history != objects_history_.end() && !history->second.empty()) {
+    std::vector<std::pair<double, lanelet::Lanelet>> possible_lanelets;
+    for (const auto & possible_lanelet : history->second.back().future_possible_lanelets) {
+      const auto lanelet = lanelet_map_ptr_->laneletLayer.find(possible_lanelet.id());
+      if (lanelet == lanelet_map_ptr_->laneletLayer.end()) {
+        continue;
+      }
+      const double distance = lanelet::geometry::distance2d(*lanelet, search_point);
+      possible_lanelets.emplace_back(distance, *lanelet);
+    }
+    std::stable_sort(
+      possible_lanelets.begin(), possible_lanelets.end(),
+      [](const auto & a, const auto & b) { return a.first < b.first; });
+
+    // the object is still in its corridor
+    const auto object_lanelets = getSameDirectionLanelets(possible_lanelets, object);
+    if (!object_lanelets.empty()) {
+      return object_lanelets;
+    }
+  }
+
   // nearest lanelet
   std::vector<std::pair<double, lanelet::Lanelet>> surrounding_lanelets =
     lanelet::geometry::findNearest(lanelet_map_ptr_->laneletLayer, search_point, 10);
@@ -1243,37 +1383,10 @@ LaneletsData MapBasedPredictionNode::getCurrentLanelets(const TrackedObject & ob
       return {};
     }
 
-    LaneletsData object_lanelets;
-    std::optional<std::pair<double, lanelet::Lanelet>> closest_lanelet{std::nullopt};
-    for (const auto & lanelet : surrounding_lanelets) {
-      // Check if the close lanelets meet the necessary condition for start lanelets and
-      // Check if similar lanelet is inside the object lanelet
-      if (!checkCloseLaneletCondition(lanelet, object) || isDuplicated(lanelet, object_lanelets)) {
-        continue;
-      }
-
-      // Memorize closest lanelet
-      // NOTE: The object may be outside the lanelet.
-      if (!closest_lanelet || lanelet.first < closest_lanelet->first) {
-        closest_lanelet = lanelet;
-      }
-
-      // Check if the obstacle is inside of this lanelet
-      constexpr double epsilon = 1e-3;
-      if (lanelet.first < epsilon) {
-        const auto object_lanelet =
-          LaneletData{lanelet.second, calculateLocalLikelihood(lanelet.second, object)};
-        object_lanelets.push_back(object_lanelet);
-      }
-    }
-
+    const auto object_lanelets = getSameDirectionLanelets(surrounding_lanelets, object);
     if (!object_lanelets.empty()) {
       return object_lanelets;
     }
-    if (closest_lanelet) {
-      return LaneletsData{LaneletData{
-        closest_lanelet->second, calculateLocalLikelihood(closest_lanelet->second, object)}};
-    }
   }
 
   {  // Step 2. Search opposite directional lanelets
@@ -1315,6 +1428,44 @@ LaneletsData MapBasedPredictionNode::getCurrentLanelets(const TrackedObject & ob
   return LaneletsData{};
 }
 
+LaneletsData MapBasedPredictionNode::getSameDirectionLanelets(
+  const std::vector<std::pair<double, lanelet::Lanelet>> & surrounding_lanelets,
+  const TrackedObject & object)
+{
+  LaneletsData object_lanelets;
+  std::optional<std::pair<double, lanelet::Lanelet>> closest_lanelet{std::nullopt};
+  for (const auto & lanelet : surrounding_lanelets) {
+    // Check if the close lanelets meet the necessary condition for start lanelets and
+    // Check if similar lanelet is inside the object lanelet
+    if (!checkCloseLaneletCondition(lanelet, object) || isDuplicated(lanelet, object_lanelets)) {
+      continue;
+    }
+
+    // Memorize closest lanelet
+    // NOTE: The object may be outside the lanelet.
+    if (!closest_lanelet || lanelet.first < closest_lanelet->first) {
+      closest_lanelet = lanelet;
+    }
+
+    // Check if the obstacle is inside of this lanelet
+    constexpr double epsilon = 1e-3;
+    if (lanelet.first < epsilon) {
+      const auto object_lanelet =
+        LaneletData{lanelet.second, calculateLocalLikelihood(lanelet.second, object)};
+      object_lanelets.push_back(object_lanelet);
+    }
+  }
+
+  if (!object_lanelets.empty()) {
+    return object_lanelets;
+  }
+  if (closest_lanelet) {
+    return LaneletsData{LaneletData{
+      closest_lanelet->second, calculateLocalLikelihood(closest_lanelet->second, object)}};
+  }
+  return LaneletsData{};
+}
+
 bool MapBasedPredictionNode::checkCloseLaneletCondition(
   const std::pair<double, lanelet::Lanelet> & lanelet, const TrackedObject & object)
 {
@@ -1930,42 +2081,58 @@ ManeuverProbability MapBasedPredictionNode::calculateManeuverProbability(
   return maneuver_prob;
 }
 
-std::vector<PosePath> MapBasedPredictionNode::convertPathType(
+std::vector<std::shared_ptr<const PosePath>> MapBasedPredictionNode::convertPathType(
   const lanelet::routing::LaneletPaths & paths)
 {
-  std::vector<PosePath> converted_paths;
+  std::vector<std::shared_ptr<const PosePath>> converted_paths;
   for (const auto & path : paths) {
-    PosePath converted_path;
-
-    // Insert Positions. Note that we start inserting points from previous lanelet
-    if (!path.empty()) {
-      lanelet::ConstLanelets prev_lanelets = routing_graph_ptr_->previous(path.front());
-      if (!prev_lanelets.empty()) {
-        lanelet::ConstLanelet prev_lanelet = prev_lanelets.front();
-        bool init_flag = true;
-        geometry_msgs::msg::Pose prev_p;
-        for (const auto & lanelet_p : prev_lanelet.centerline()) {
-          geometry_msgs::msg::Pose current_p;
-          current_p.position = lanelet::utils::conversion::toGeomMsgPt(lanelet_p);
-          if (init_flag) {
-            init_flag = false;
-            prev_p = current_p;
-            continue;
-          }
-
-          const double lane_yaw = std::atan2(
-            current_p.position.y - prev_p.position.y, current_p.position.x - prev_p.position.x);
-          current_p.orientation = tier4_autoware_utils::createQuaternionFromYaw(lane_yaw);
-          converted_path.push_back(current_p);
-          prev_p = current_p;
-        }
+    // inverted lanelets have the opposite centerline
+    std::vector<lanelet::Id> lanelet_ids;
+    for (const auto & lanelet : path) {
+      lanelet_ids.push_back(lanelet.inverted() ? -lanelet.id() : lanelet.id());
+    }
+
+    {  // the same lanelet path is often used by several objects and in the following frames
+      std::lock_guard<std::mutex> lock(reference_path_cache_mutex_);
+      const auto cached_path = reference_path_cache_index_.find(lanelet_ids);
+      if (cached_path != reference_path_cache_index_.end()) {
+        reference_path_cache_.splice(
+          reference_path_cache_.end(), reference_path_cache_, cached_path->second);
+        converted_paths.push_back(cached_path->second->second);
+        continue;
       }
     }
 
-    for (const auto & lanelet : path) {
+    const auto converted_path = std::make_shared<const PosePath>(convertPathType(path));
+    converted_paths.push_back(converted_path);
+
+    std::lock_guard<std::mutex> lock(reference_path_cache_mutex_);
+    if (reference_path_cache_index_.count(lanelet_ids) != 0) {
+      continue;
+    }
+    if (reference_path_cache_.size() >= reference_path_cache_size) {
+      reference_path_cache_index_.erase(reference_path_cache_.front().first);
+      reference_path_cache_.pop_front();
+    }
+    reference_path_cache_.emplace_back(lanelet_ids, converted_path);
+    reference_path_cache_index_.emplace(lanelet_ids, std::prev(reference_path_cache_.end()));
+  }
+
+  return converted_paths;
+}
+
+PosePath MapBasedPredictionNode::convertPathType(const lanelet::routing::LaneletPath & path)
+{
+  PosePath converted_path;
+
+  // Insert Positions. Note that we start inserting points from previous lanelet
+  if (!path.empty()) {
+    lanelet::ConstLanelets prev_lanelets = routing_graph_ptr_->previous(path.front());
+    if (!prev_lanelets.empty()) {
+      lanelet::ConstLanelet prev_lanelet = prev_lanelets.front();
       bool init_flag = true;
       geometry_msgs::msg::Pose prev_p;
-      for (const auto & lanelet_p : lanelet.centerline()) {
+      for (const auto & lanelet_p : prev_lanelet.centerline()) {
         geometry_msgs::msg::Pose current_p;
         current_p.position = lanelet::utils::conversion::toGeomMsgPt(lanelet_p);
         if (init_flag) {
@@ -1974,16 +2141,6 @@ std::vector<PosePath> MapBasedPredictionNode::convertPathType(
           continue;
         }
 
-        // Prevent from inserting same points
-        if (!converted_path.empty()) {
-          const auto last_p = converted_path.back();
-          const double tmp_dist = tier4_autoware_utils::calcDistance2d(last_p, current_p);
-          if (tmp_dist < 1e-6) {
-            prev_p = current_p;
-            continue;
-          }
-        }
-
         const double lane_yaw = std::atan2(
           current_p.position.y - prev_p.position.y, current_p.position.x - prev_p.position.x);
         current_p.orientation = tier4_autoware_utils::createQuaternionFromYaw(lane_yaw);
@@ -1991,14 +2148,40 @@ std::vector<PosePath> MapBasedPredictionNode::convertPathType(
         prev_p = current_p;
       }
     }
+  }
+
+  for (const auto & lanelet : path) {
+    bool init_flag = true;
+    geometry_msgs::msg::Pose prev_p;
+    for (const auto & lanelet_p : lanelet.centerline()) {
+      geometry_msgs::msg::Pose current_p;
+      current_p.position = lanelet::utils::conversion::toGeomMsgPt(lanelet_p);
+      if (init_flag) {
+        init_flag = false;
+        prev_p = current_p;
+        continue;
+      }
+
+      // Prevent from inserting same points
+      if (!converted_path.empty()) {
+        const auto last_p = converted_path.back();
+        const double tmp_dist = tier4_autoware_utils::calcDistance2d(last_p, current_p);
+        if (tmp_dist < 1e-6) {
+          prev_p = current_p;
+          continue;
+        }
+      }
 
-    // Resample Path
-    const auto resampled_converted_path =
-      motion_utils::resamplePoseVector(converted_path, reference_path_resolution_);
-    converted_paths.push_back(resampled_converted_path);
+      const double lane_yaw = std::atan2(
+        current_p.position.y - prev_p.position.y, current_p.position.x - prev_p.position.x);
+      current_p.orientation = tier4_autoware_utils::createQuaternionFromYaw(lane_yaw);
+      converted_path.push_back(current_p);
+      prev_p = current_p;
+    }
   }
 
-  return converted_paths;
+  // Resample Path
+  return motion_utils::resamplePoseVector(converted_path, reference_path_resolution_);
 }
 
 bool MapBasedPredictionNode::isDuplicated(
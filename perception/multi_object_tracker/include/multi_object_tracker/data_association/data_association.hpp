@@ -21,6 +21,7 @@
 
 #include <list>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -50,7 +51,8 @@ public:
   DataAssociation(
     std::vector<int> can_assign_vector, std::vector<double> max_dist_vector,
     std::vector<double> max_area_vector, std::vector<double> min_area_vector,
-    std::vector<double> max_rad_vector, std::vector<double> min_iou_vector);
+    std::vector<double> max_rad_vector, std::vector<double> min_iou_vector,
+    const std::string & gnn_solver = "mussp", const size_t gnn_solver_num_threads = 1);
   void assign(
     const Eigen::MatrixXd & src, std::unordered_map<int, int> & direct_assignment,
     std::unordered_map<int, int> & reverse_assignment);
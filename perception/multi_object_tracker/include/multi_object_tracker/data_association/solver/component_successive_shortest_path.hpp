@@ -0,0 +1,49 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MULTI_OBJECT_TRACKER__DATA_ASSOCIATION__SOLVER__COMPONENT_SUCCESSIVE_SHORTEST_PATH_HPP_
+#define MULTI_OBJECT_TRACKER__DATA_ASSOCIATION__SOLVER__COMPONENT_SUCCESSIVE_SHORTEST_PATH_HPP_
+
+#include "multi_object_tracker/data_association/solver/gnn_solver_interface.hpp"
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace gnn_solver
+{
+/**
+ * @brief successive shortest path solved independently on each connected component of the gated
+ * pairs, the components being distributed over nb_threads threads
+ */
+class ComponentSSP : public GnnSolverInterface
+{
+public:
+  explicit ComponentSSP(const size_t nb_threads = 1);
+  ~ComponentSSP() = default;
+
+  void maximizeLinearAssignment(
+    const std::vector<std::vector<double>> & cost, std::unordered_map<int, int> * direct_assignment,
+    std::unordered_map<int, int> * reverse_assignment) override;
+
+  void maximizeSparseLinearAssignment(
+    const SparseScore & score, std::unordered_map<int, int> * direct_assignment,
+    std::unordered_map<int, int> * reverse_assignment) override;
+
+private:
+  const size_t nb_threads_;
+};
+}  // namespace gnn_solver
+
+#endif  // MULTI_OBJECT_TRACKER__DATA_ASSOCIATION__SOLVER__COMPONENT_SUCCESSIVE_SHORTEST_PATH_HPP_
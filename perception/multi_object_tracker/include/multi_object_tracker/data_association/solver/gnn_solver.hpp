@@ -15,6 +15,7 @@
 #ifndef MULTI_OBJECT_TRACKER__DATA_ASSOCIATION__SOLVER__GNN_SOLVER_HPP_
 #define MULTI_OBJECT_TRACKER__DATA_ASSOCIATION__SOLVER__GNN_SOLVER_HPP_
 
+#include "multi_object_tracker/data_association/solver/component_successive_shortest_path.hpp"
 #include "multi_object_tracker/data_association/solver/gnn_solver_interface.hpp"
 #include "multi_object_tracker/data_association/solver/mu_successive_shortest_path.hpp"
 #include "multi_object_tracker/data_association/solver/successive_shortest_path.hpp"
@@ -20,6 +20,20 @@
 
 namespace gnn_solver
 {
+/**
+ * @brief scores of the gated pairs of agents and tasks in compressed sparse row format, the
+ * scores of agent i are in [agent_offsets[i], agent_offsets[i + 1])
+ */
+struct SparseScore
+{
+  int nb_tasks{0};
+  std::vector<int> agent_offsets{0};
+  std::vector<int> tasks;
+  std::vector<double> scores;
+
+  int nbAgents() const { return static_cast<int>(agent_offsets.size()) - 1; }
+};
+
 class GnnSolverInterface
 {
 public:
@@ -29,6 +43,23 @@ public:
   virtual void maximizeLinearAssignment(
     const std::vector<std::vector<double>> & cost, std::unordered_map<int, int> * direct_assignment,
     std::unordered_map<int, int> * reverse_assignment) = 0;
+
+  /**
+   * @brief solve with only the gated pairs, the other pairs have a zero score
+   */
+  virtual void maximizeSparseLinearAssignment(
+    const SparseScore & score, std::unordered_map<int, int> * direct_assignment,
+    std::unordered_map<int, int> * reverse_assignment)
+  {
+    std::vector<std::vector<double>> cost(
+      score.nbAgents(), std::vector<double>(score.nb_tasks, 0.0));
+    for (int agent = 0; agent < score.nbAgents(); ++agent) {
+      for (int i = score.agent_offsets.at(agent); i < score.agent_offsets.at(agent + 1); ++i) {
+        cost.at(agent).at(score.tasks.at(i)) = score.scores.at(i);
+      }
+    }
+    maximizeLinearAssignment(cost, direct_assignment, reverse_assignment);
+  }
 };
 }  // namespace gnn_solver
 
@@ -22,6 +22,7 @@
 #include "multi_object_tracker/data_association/data_association.hpp"
 #include "multi_object_tracker/tracker/model/tracker_base.hpp"
 
+#include <latency_aggregator/latency_hop_publisher.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_auto_perception_msgs/msg/detected_objects.hpp>
@@ -64,6 +65,10 @@ private:
 
   std::map<std::uint8_t, std::string> tracker_map_;
 
+  // end-to-end latency
+  std::unique_ptr<latency_aggregator::LatencyHopPublisher> latency_hop_publisher_;
+  latency_aggregator::LatencyHopInput measurement_hop_input_;
+
   void onMeasurement(
     const autoware_auto_perception_msgs::msg::DetectedObjects::ConstSharedPtr input_objects_msg);
   void onTimer();
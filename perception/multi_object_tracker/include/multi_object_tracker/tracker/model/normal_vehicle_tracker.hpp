@@ -21,7 +21,7 @@
 
 #include "tracker_base.hpp"
 
-#include <kalman_filter/kalman_filter.hpp>
+#include <kalman_filter/kalman_filter_n.hpp>
 
 class NormalVehicleTracker : public Tracker
 {
@@ -31,7 +31,8 @@ private:
   int last_nearest_corner_index_;
 
 private:
-  KalmanFilter ekf_;
+  using EKF = KalmanFilterN<5, 4>;
+  EKF ekf_;
   rclcpp::Time last_update_time_;
   enum IDX { X = 0, Y = 1, YAW = 2, VX = 3, SLIP = 4 };
 
@@ -78,7 +79,7 @@ public:
     const geometry_msgs::msg::Transform & self_transform);
 
   bool predict(const rclcpp::Time & time) override;
-  bool predict(const double dt, KalmanFilter & ekf) const;
+  bool predict(const double dt, EKF & ekf) const;
   bool measure(
     const autoware_auto_perception_msgs::msg::DetectedObject & object, const rclcpp::Time & time,
     const geometry_msgs::msg::Transform & self_transform) override;
@@ -0,0 +1,175 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "multi_object_tracker/data_association/solver/component_successive_shortest_path.hpp"
+
+#include "multi_object_tracker/data_association/solver/successive_shortest_path.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace gnn_solver
+{
+namespace
+{
+// pairs with a lower score are not connected, as in SSP
+constexpr double EPS = 1e-5;
+
+struct Component
+{
+  std::vector<int> agents;
+  std::vector<int> tasks;
+  std::vector<std::pair<int, int>> assignment;
+};
+
+int findRoot(std::vector<int> & parents, int node)
+{
+  while (parents.at(node) != node) {
+    parents.at(node) = parents.at(parents.at(node));
+    node = parents.at(node);
+  }
+  return node;
+}
+
+void solveComponent(
+  const SparseScore & score, const std::vector<int> & local_task_indices, Component & component)
+{
+  // most components are a single pair
+  if (component.agents.size() == 1 && component.tasks.size() == 1) {
+    component.assignment.emplace_back(component.agents.front(), component.tasks.front());
+    return;
+  }
+
+  std::vector<std::vector<double>> cost(
+    component.agents.size(), std::vector<double>(component.tasks.size(), 0.0));
+  for (size_t local_agent = 0; local_agent < component.agents.size(); ++local_agent) {
+    const int agent = component.agents.at(local_agent);
+    for (int i = score.agent_offsets.at(agent); i < score.agent_offsets.at(agent + 1); ++i) {
+      if (score.scores.at(i) > EPS) {
+        cost.at(local_agent).at(local_task_indices.at(score.tasks.at(i))) = score.scores.at(i);
+      }
+    }
+  }
+
+  std::unordered_map<int, int> direct_assignment;
+  std::unordered_map<int, int> reverse_assignment;
+  SSP().maximizeLinearAssignment(cost, &direct_assignment, &reverse_assignment);
+  for (const auto & [local_agent, local_task] : direct_assignment) {
+    component.assignment.emplace_back(
+      component.agents.at(local_agent), component.tasks.at(local_task));
+  }
+}
+}  // namespace
+
+ComponentSSP::ComponentSSP(const size_t nb_threads) : nb_threads_(std::max<size_t>(nb_threads, 1))
+{
+}
+
+void ComponentSSP::maximizeLinearAssignment(
+  const std::vector<std::vector<double>> & cost, std::unordered_map<int, int> * direct_assignment,
+  std::unordered_map<int, int> * reverse_assignment)
+{
+  if (cost.size() == 0 || cost.at(0).size() == 0) {
+    return;
+  }
+
+  SparseScore score;
+  score.nb_tasks = cost.at(0).size();
+  for (const auto & agent_cost : cost) {
+    for (int task = 0; task < score.nb_tasks; ++task) {
+      if (agent_cost.at(task) > EPS) {
+        score.tasks.push_back(task);
+        score.scores.push_back(agent_cost.at(task));
+      }
+    }
+    score.agent_offsets.push_back(score.tasks.size());
+  }
+  maximizeSparseLinearAssignment(score, direct_assignment, reverse_assignment);
+}
+
+void ComponentSSP::maximizeSparseLinearAssignment(
+  const SparseScore & score, std::unordered_map<int, int> * direct_assignment,
+  std::unordered_map<int, int> * reverse_assignment)
+{
+  const int nb_agents = score.nbAgents();
+  if (nb_agents <= 0 || score.nb_tasks <= 0) {
+    return;
+  }
+
+  // union-find over agents [0, nb_agents) and tasks [nb_agents, nb_agents + nb_tasks)
+  std::vector<int> parents(nb_agents + score.nb_tasks);
+  std::iota(parents.begin(), parents.end(), 0);
+  std::vector<bool> is_connected(parents.size(), false);
+  for (int agent = 0; agent < nb_agents; ++agent) {
+    for (int i = score.agent_offsets.at(agent); i < score.agent_offsets.at(agent + 1); ++i) {
+      if (score.scores.at(i) > EPS) {
+        const int task_node = nb_agents + score.tasks.at(i);
+        parents.at(findRoot(parents, agent)) = findRoot(parents, task_node);
+        is_connected.at(agent) = true;
+        is_connected.at(task_node) = true;
+      }
+    }
+  }
+
+  // agents and tasks without any gated pair stay unassigned and are not in any component
+  std::vector<int> component_indices(parents.size(), -1);
+  std::vector<Component> components;
+  std::vector<int> local_task_indices(score.nb_tasks, -1);
+  for (int node = 0; node < static_cast<int>(parents.size()); ++node) {
+    if (!is_connected.at(node)) {
+      continue;
+    }
+    const int root = findRoot(parents, node);
+    if (component_indices.at(root) < 0) {
+      component_indices.at(root) = components.size();
+      components.emplace_back();
+    }
+    auto & component = components.at(component_indices.at(root));
+    if (node < nb_agents) {
+      component.agents.push_back(node);
+    } else {
+      local_task_indices.at(node - nb_agents) = component.tasks.size();
+      component.tasks.push_back(node - nb_agents);
+    }
+  }
+
+  const size_t nb_workers = std::min(nb_threads_, components.size());
+  std::atomic<size_t> next_component_idx{0};
+  const auto work = [&]() {
+    for (auto idx = next_component_idx++; idx < components.size(); idx = next_component_idx++) {
+      solveComponent(score, local_task_indices, components.at(idx));
+    }
+  };
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < nb_workers; ++i) {
+    workers.emplace_back(work);
+  }
+  work();
+  for (auto & worker : workers) {
+    worker.join();
+  }
+
+  for (const auto & component : components) {
+    for (const auto & [agent, task] : component.assignment) {
+      (*direct_assignment)[agent] = task;
+      (*reverse_assignment)[task] = agent;
+    }
+  }
+}
+}  // namespace gnn_solver
@@ -16,11 +16,15 @@
 
 #include "multi_object_tracker/data_association/solver/gnn_solver.hpp"
 #include "multi_object_tracker/utils/utils.hpp"
+#include "object_recognition_utils/object_grid.hpp"
 #include "object_recognition_utils/object_recognition_utils.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <list>
 #include <memory>
+#include <stdexcept>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -66,12 +70,14 @@ double getFormedYawAngle(
   }
   return std::fabs(measurement_fixed_yaw - tracker_yaw);
 }
+
 }  // namespace
 
 DataAssociation::DataAssociation(
   std::vector<int> can_assign_vector, std::vector<double> max_dist_vector,
   std::vector<double> max_area_vector, std::vector<double> min_area_vector,
-  std::vector<double> max_rad_vector, std::vector<double> min_iou_vector)
+  std::vector<double> max_rad_vector, std::vector<double> min_iou_vector,
+  const std::string & gnn_solver, const size_t gnn_solver_num_threads)
 : score_threshold_(0.01)
 {
   {
@@ -111,22 +117,34 @@ DataAssociation::DataAssociation(
     min_iou_matrix_ = min_iou_matrix_tmp.transpose();
   }
 
-  gnn_solver_ptr_ = std::make_unique<gnn_solver::MuSSP>();
+  if (gnn_solver == "mussp") {
+    gnn_solver_ptr_ = std::make_unique<gnn_solver::MuSSP>();
+  } else if (gnn_solver == "component_ssp") {
+    gnn_solver_ptr_ = std::make_unique<gnn_solver::ComponentSSP>(gnn_solver_num_threads);
+  } else {
+    throw std::invalid_argument("Unknown gnn_solver: " + gnn_solver);
+  }
 }
 
 void DataAssociation::assign(
   const Eigen::MatrixXd & src, std::unordered_map<int, int> & direct_assignment,
   std::unordered_map<int, int> & reverse_assignment)
 {
-  std::vector<std::vector<double>> score(src.rows());
+  // only the gated pairs have a non zero score
+  gnn_solver::SparseScore score;
+  score.nb_tasks = src.cols();
+  score.agent_offsets.reserve(src.rows() + 1);
   for (int row = 0; row < src.rows(); ++row) {
-    score.at(row).resize(src.cols());
     for (int col = 0; col < src.cols(); ++col) {
-      score.at(row).at(col) = src(row, col);
+      if (src(row, col) != 0.0) {
+        score.tasks.push_back(col);
+        score.scores.push_back(src(row, col));
+      }
     }
+    score.agent_offsets.push_back(score.tasks.size());
   }
   // Solve
-  gnn_solver_ptr_->maximizeLinearAssignment(score, &direct_assignment, &reverse_assignment);
+  gnn_solver_ptr_->maximizeSparseLinearAssignment(score, &direct_assignment, &reverse_assignment);
 
   for (auto itr = direct_assignment.begin(); itr != direct_assignment.end();) {
     if (src(itr->first, itr->second) < score_threshold_) {
@@ -152,13 +170,25 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
 {
   Eigen::MatrixXd score_matrix =
     Eigen::MatrixXd::Zero(trackers.size(), measurements.objects.size());
+  if (trackers.empty() || measurements.objects.empty()) {
+    return score_matrix;
+  }
+
+  // pairs out of the largest distance gate are never evaluated and keep a zero score
+  const object_recognition_utils::ObjectGrid measurement_grid(
+    measurements.objects, std::max(max_dist_matrix_.maxCoeff(), 1.0));
+  std::vector<size_t> measurement_indices;
   size_t tracker_idx = 0;
   for (auto tracker_itr = trackers.begin(); tracker_itr != trackers.end();
        ++tracker_itr, ++tracker_idx) {
     const std::uint8_t tracker_label = (*tracker_itr)->getHighestProbLabel();
+    // the prediction at the measurement stamp is the same for all the measurements
+    autoware_auto_perception_msgs::msg::TrackedObject tracked_object;
+    (*tracker_itr)->getTrackedObject(measurements.header.stamp, tracked_object);
+    measurement_grid.getCandidates(
+      tracked_object.kinematics.pose_with_covariance.pose.position, measurement_indices);
 
-    for (size_t measurement_idx = 0; measurement_idx < measurements.objects.size();
-         ++measurement_idx) {
+    for (const auto measurement_idx : measurement_indices) {
       const autoware_auto_perception_msgs::msg::DetectedObject & measurement_object =
         measurements.objects.at(measurement_idx);
       const std::uint8_t measurement_label =
@@ -166,9 +196,6 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
 
       double score = 0.0;
       if (can_assign_matrix_(tracker_label, measurement_label)) {
-        autoware_auto_perception_msgs::msg::TrackedObject tracked_object;
-        (*tracker_itr)->getTrackedObject(measurements.header.stamp, tracked_object);
-
         const double max_dist = max_dist_matrix_(tracker_label, measurement_label);
         const double dist = tier4_autoware_utils::calcDistance2d(
           measurement_object.kinematics.pose_with_covariance.pose.position,
@@ -19,9 +19,12 @@
 #include <tf2_ros/create_timer_interface.h>
 #include <tf2_ros/create_timer_ros.h>
 
+#include <algorithm>
+#include <cmath>
 #include <iterator>
 #include <list>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -76,6 +79,8 @@ MultiObjectTracker::MultiObjectTracker(const rclcpp::NodeOptions & node_options)
     std::bind(&MultiObjectTracker::onMeasurement, this, std::placeholders::_1));
   tracked_objects_pub_ =
     create_publisher<autoware_auto_perception_msgs::msg::TrackedObjects>("output", rclcpp::QoS{1});
+  latency_hop_publisher_ = std::make_unique<latency_aggregator::LatencyHopPublisher>(
+    this, tracked_objects_pub_->get_topic_name());
 
   // Parameters
   double publish_rate = declare_parameter<double>("publish_rate", 30.0);
@@ -118,14 +123,20 @@ MultiObjectTracker::MultiObjectTracker(const rclcpp::NodeOptions & node_options)
   tracker_map_.insert(
     std::make_pair(Label::MOTORCYCLE, this->declare_parameter<std::string>("motorcycle_tracker")));
 
+  const auto gnn_solver = declare_parameter<std::string>("gnn_solver", "mussp");
+  const auto gnn_solver_num_threads = declare_parameter<int>("gnn_solver_num_threads", 1);
+
   data_association_ = std::make_unique<DataAssociation>(
     can_assign_matrix, max_dist_matrix, max_area_matrix, min_area_matrix, max_rad_matrix,
-    min_iou_matrix);
+    min_iou_matrix, gnn_solver, static_cast<size_t>(std::max(gnn_solver_num_threads, 1)));
 }
 
 void MultiObjectTracker::onMeasurement(
   const autoware_auto_perception_msgs::msg::DetectedObjects::ConstSharedPtr input_objects_msg)
 {
+  const auto hop_input = latency_hop_publisher_->createInput(
+    detected_object_sub_->get_topic_name(), input_objects_msg->header.stamp);
+
   const auto self_transform = getTransformAnonymous(
     tf_buffer_, "base_link", world_frame_id_, input_objects_msg->header.stamp);
   if (!self_transform) {
@@ -179,6 +190,7 @@ void MultiObjectTracker::onMeasurement(
     if (tracker) list_tracker_.push_back(tracker);
   }
 
+  measurement_hop_input_ = hop_input;
   if (publish_timer_ == nullptr) {
     publish(measurement_time);
   }
@@ -254,12 +266,72 @@ void MultiObjectTracker::sanitizeTracker(
   constexpr float min_iou_for_unknown_object = 0.001;
   constexpr double distance_threshold = 5.0;
   /* delete collision tracker */
-  for (auto itr1 = list_tracker.begin(); itr1 != list_tracker.end(); ++itr1) {
-    autoware_auto_perception_msgs::msg::TrackedObject object1;
-    (*itr1)->getTrackedObject(time, object1);
-    for (auto itr2 = std::next(itr1); itr2 != list_tracker.end(); ++itr2) {
-      autoware_auto_perception_msgs::msg::TrackedObject object2;
-      (*itr2)->getTrackedObject(time, object2);
+  struct TrackerState
+  {
+    std::list<std::shared_ptr<Tracker>>::iterator itr;
+    autoware_auto_perception_msgs::msg::TrackedObject object;
+    bool is_deleted{false};
+  };
+  std::vector<TrackerState> trackers;
+  trackers.reserve(list_tracker.size());
+  for (auto itr = list_tracker.begin(); itr != list_tracker.end(); ++itr) {
+    trackers.emplace_back();
+    trackers.back().itr = itr;
+    (*itr)->getTrackedObject(time, trackers.back().object);
+  }
+  const auto getPosition = [&](const size_t idx) -> const geometry_msgs::msg::Point & {
+    return trackers.at(idx).object.kinematics.pose_with_covariance.pose.position;
+  };
+
+  // sweep along x so that only the trackers within distance_threshold are compared, the others
+  // can not collide. Trackers at a non finite position are compared with all the others to keep
+  // the result of the exhaustive comparison.
+  std::vector<size_t> sorted_indices;
+  std::vector<size_t> non_finite_indices;
+  for (size_t idx = 0; idx < trackers.size(); ++idx) {
+    const auto & position = getPosition(idx);
+    if (std::isfinite(position.x) && std::isfinite(position.y)) {
+      sorted_indices.push_back(idx);
+    } else {
+      non_finite_indices.push_back(idx);
+    }
+  }
+  std::sort(sorted_indices.begin(), sorted_indices.end(), [&](const size_t a, const size_t b) {
+    return getPosition(a).x < getPosition(b).x;
+  });
+
+  std::vector<size_t> candidate_indices;
+  for (size_t idx1 = 0; idx1 < trackers.size(); ++idx1) {
+    const auto & position1 = getPosition(idx1);
+    candidate_indices.clear();
+    if (std::isfinite(position1.x) && std::isfinite(position1.y)) {
+      const auto begin = std::lower_bound(
+        sorted_indices.begin(), sorted_indices.end(), position1.x - distance_threshold,
+        [&](const size_t idx, const double x) { return getPosition(idx).x < x; });
+      const auto end = std::upper_bound(
+        begin, sorted_indices.end(), position1.x + distance_threshold,
+        [&](const double x, const size_t idx) { return x < getPosition(idx).x; });
+      candidate_indices.assign(begin, end);
+      candidate_indices.insert(
+        candidate_indices.end(), non_finite_indices.begin(), non_finite_indices.end());
+    } else {
+      candidate_indices.resize(trackers.size());
+      std::iota(candidate_indices.begin(), candidate_indices.end(), 0);
+    }
+    // compare in the order of the tracker list as the deletion depends on it
+    std::sort(candidate_indices.begin(), candidate_indices.end());
+
+    const auto & tracker1 = *trackers.at(idx1).itr;
+    const auto & object1 = trackers.at(idx1).object;
+    for (const auto idx2 : candidate_indices) {
+      if (trackers.at(idx1).is_deleted) {
+        break;
+      }
+      if (idx2 <= idx1 || trackers.at(idx2).is_deleted) {
+        continue;
+      }
+      const auto & tracker2 = *trackers.at(idx2).itr;
+      const auto & object2 = trackers.at(idx2).object;
       const double distance = std::hypot(
         object1.kinematics.pose_with_covariance.pose.position.x -
           object2.kinematics.pose_with_covariance.pose.position.x,
@@ -271,8 +343,8 @@ void MultiObjectTracker::sanitizeTracker(
 
       const double min_union_iou_area = 1e-2;
       const auto iou = object_recognition_utils::get2dIoU(object1, object2, min_union_iou_area);
-      const auto & label1 = (*itr1)->getHighestProbLabel();
-      const auto & label2 = (*itr2)->getHighestProbLabel();
+      const auto & label1 = tracker1->getHighestProbLabel();
+      const auto & label2 = tracker2->getHighestProbLabel();
       bool should_delete_tracker1 = false;
       bool should_delete_tracker2 = false;
 
@@ -281,7 +353,7 @@ void MultiObjectTracker::sanitizeTracker(
       if (label1 == Label::UNKNOWN || label2 == Label::UNKNOWN) {
         if (min_iou_for_unknown_object < iou) {
           if (label1 == Label::UNKNOWN && label2 == Label::UNKNOWN) {
-            if ((*itr1)->getTotalMeasurementCount() < (*itr2)->getTotalMeasurementCount()) {
+            if (tracker1->getTotalMeasurementCount() < tracker2->getTotalMeasurementCount()) {
               should_delete_tracker1 = true;
             } else {
               should_delete_tracker2 = true;
@@ -294,7 +366,7 @@ void MultiObjectTracker::sanitizeTracker(
         }
       } else {  // If neither is UNKNOWN, delete the one with lower IOU.
         if (min_iou < iou) {
-          if ((*itr1)->getTotalMeasurementCount() < (*itr2)->getTotalMeasurementCount()) {
+          if (tracker1->getTotalMeasurementCount() < tracker2->getTotalMeasurementCount()) {
             should_delete_tracker1 = true;
           } else {
             should_delete_tracker2 = true;
@@ -303,15 +375,18 @@ void MultiObjectTracker::sanitizeTracker(
       }
 
       if (should_delete_tracker1) {
-        itr1 = list_tracker.erase(itr1);
-        --itr1;
-        break;
+        trackers.at(idx1).is_deleted = true;
       } else if (should_delete_tracker2) {
-        itr2 = list_tracker.erase(itr2);
-        --itr2;
+        trackers.at(idx2).is_deleted = true;
       }
     }
   }
+
+  for (const auto & tracker : trackers) {
+    if (tracker.is_deleted) {
+      list_tracker.erase(tracker.itr);
+    }
+  }
 }
 
 inline bool MultiObjectTracker::shouldTrackerPublish(
@@ -346,6 +421,9 @@ void MultiObjectTracker::publish(const rclcpp::Time & time) const
 
   // Publish
   tracked_objects_pub_->publish(output_msg);
+  if (!measurement_hop_input_.topic.empty()) {
+    latency_hop_publisher_->publish(measurement_hop_input_, output_msg.header.stamp);
+  }
 }
 
 RCLCPP_COMPONENTS_REGISTER_NODE(MultiObjectTracker)
@@ -85,7 +85,7 @@ NormalVehicleTracker::NormalVehicleTracker(
   velocity_deviation_threshold_ = tier4_autoware_utils::kmph2mps(10);  // [m/s]
 
   // initialize X matrix
-  Eigen::MatrixXd X(ekf_params_.dim_x, 1);
+  EKF::StateVector X;
   X(IDX::X) = object.kinematics.pose_with_covariance.pose.position.x;
   X(IDX::Y) = object.kinematics.pose_with_covariance.pose.position.y;
   X(IDX::YAW) = tf2::getYaw(object.kinematics.pose_with_covariance.pose.orientation);
@@ -97,7 +97,7 @@ NormalVehicleTracker::NormalVehicleTracker(
   X(IDX::SLIP) = 0.0;
 
   // initialize P matrix
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(ekf_params_.dim_x, ekf_params_.dim_x);
+  EKF::StateMatrix P = EKF::StateMatrix::Zero();
   if (!object.kinematics.has_position_covariance) {
     const double cos_yaw = std::cos(X(IDX::YAW));
     const double sin_yaw = std::sin(X(IDX::YAW));
@@ -167,7 +167,7 @@ bool NormalVehicleTracker::predict(const rclcpp::Time & time)
   return ret;
 }
 
-bool NormalVehicleTracker::predict(const double dt, KalmanFilter & ekf) const
+bool NormalVehicleTracker::predict(const double dt, EKF & ekf) const
 {
   /*  == Nonlinear model == static bicycle model
    *
@@ -189,7 +189,7 @@ bool NormalVehicleTracker::predict(const double dt, KalmanFilter & ekf) const
    */
 
   // X t
-  Eigen::MatrixXd X_t(ekf_params_.dim_x, 1);  // predicted state
+  EKF::StateVector X_t;  // predicted state
   ekf.getX(X_t);
   const double cos_yaw = std::cos(X_t(IDX::YAW) + X_t(IDX::SLIP));
   const double sin_yaw = std::sin(X_t(IDX::YAW) + X_t(IDX::SLIP));
@@ -199,7 +199,7 @@ bool NormalVehicleTracker::predict(const double dt, KalmanFilter & ekf) const
   const double sin_2yaw = std::sin(2.0f * X_t(IDX::YAW));
 
   // X t+1
-  Eigen::MatrixXd X_next_t(ekf_params_.dim_x, 1);                 // predicted state
+  EKF::StateVector X_next_t;                                      // predicted state
   X_next_t(IDX::X) = X_t(IDX::X) + vx * cos_yaw * dt;             // dx = v * cos(yaw)
   X_next_t(IDX::Y) = X_t(IDX::Y) + vx * sin_yaw * dt;             // dy = v * sin(yaw)
   X_next_t(IDX::YAW) = X_t(IDX::YAW) + vx / lr_ * sin_slip * dt;  // dyaw = omega
@@ -207,7 +207,7 @@ bool NormalVehicleTracker::predict(const double dt, KalmanFilter & ekf) const
   X_next_t(IDX::SLIP) = X_t(IDX::SLIP);
 
   // A
-  Eigen::MatrixXd A = Eigen::MatrixXd::Identity(ekf_params_.dim_x, ekf_params_.dim_x);
+  EKF::StateMatrix A = EKF::StateMatrix::Identity();
   A(IDX::X, IDX::YAW) = -vx * sin_yaw * dt;
   A(IDX::X, IDX::VX) = cos_yaw * dt;
   A(IDX::X, IDX::SLIP) = -vx * sin_yaw * dt;
@@ -218,7 +218,7 @@ bool NormalVehicleTracker::predict(const double dt, KalmanFilter & ekf) const
   A(IDX::YAW, IDX::SLIP) = vx / lr_ * cos_slip * dt;
 
   // Q
-  Eigen::MatrixXd Q = Eigen::MatrixXd::Zero(ekf_params_.dim_x, ekf_params_.dim_x);
+  EKF::StateMatrix Q = EKF::StateMatrix::Zero();
   // Rotate the covariance matrix according to the vehicle yaw
   // because q_cov_x and y are in the vehicle coordinate system.
   Q(IDX::X, IDX::X) =
@@ -230,8 +230,6 @@ bool NormalVehicleTracker::predict(const double dt, KalmanFilter & ekf) const
   Q(IDX::YAW, IDX::YAW) = ekf_params_.q_cov_yaw * dt * dt;
   Q(IDX::VX, IDX::VX) = ekf_params_.q_cov_vx * dt * dt;
   Q(IDX::SLIP, IDX::SLIP) = ekf_params_.q_cov_slip * dt * dt;
-  Eigen::MatrixXd B = Eigen::MatrixXd::Zero(ekf_params_.dim_x, ekf_params_.dim_x);
-  Eigen::MatrixXd u = Eigen::MatrixXd::Zero(ekf_params_.dim_x, 1);
 
   if (!ekf.predict(X_next_t, A, Q)) {
     RCLCPP_WARN(logger_, "Cannot predict");
@@ -263,7 +261,7 @@ bool NormalVehicleTracker::measureWithPose(
   }
 
   // extract current state
-  Eigen::MatrixXd X_t(ekf_params_.dim_x, 1);  // predicted state
+  EKF::StateVector X_t;  // predicted state
   ekf_.getX(X_t);
 
   // Decide dimension of measurement vector
@@ -307,9 +305,9 @@ bool NormalVehicleTracker::measureWithPose(
     bbox_object, X_t(IDX::YAW), offset_object, tracking_offset_);
 
   /* Set measurement matrix and noise covariance*/
-  Eigen::MatrixXd Y(dim_y, 1);
-  Eigen::MatrixXd C = Eigen::MatrixXd::Zero(dim_y, ekf_params_.dim_x);
-  Eigen::MatrixXd R = Eigen::MatrixXd::Zero(dim_y, dim_y);
+  EKF::MeasurementVector Y(dim_y);
+  EKF::MeasurementMatrix C = EKF::MeasurementMatrix::Zero(dim_y, ekf_params_.dim_x);
+  EKF::MeasurementCovariance R = EKF::MeasurementCovariance::Zero(dim_y, dim_y);
 
   Y(IDX::X, 0) = offset_object.kinematics.pose_with_covariance.pose.position.x;
   Y(IDX::Y, 0) = offset_object.kinematics.pose_with_covariance.pose.position.y;
@@ -359,8 +357,8 @@ bool NormalVehicleTracker::measureWithPose(
 
   // normalize yaw and limit vx, wz
   {
-    Eigen::MatrixXd X_t(ekf_params_.dim_x, 1);
-    Eigen::MatrixXd P_t(ekf_params_.dim_x, ekf_params_.dim_x);
+    EKF::StateVector X_t;
+    EKF::StateMatrix P_t;
     ekf_.getX(X_t);
     ekf_.getP(P_t);
     X_t(IDX::YAW) = tier4_autoware_utils::normalizeRadian(X_t(IDX::YAW));
@@ -423,8 +421,8 @@ bool NormalVehicleTracker::measure(
   measureWithShape(object);
 
   // refinement
-  Eigen::MatrixXd X_t(ekf_params_.dim_x, 1);
-  Eigen::MatrixXd P_t(ekf_params_.dim_x, ekf_params_.dim_x);
+  EKF::StateVector X_t;
+  EKF::StateMatrix P_t;
   ekf_.getX(X_t);
   ekf_.getP(P_t);
 
@@ -442,13 +440,13 @@ bool NormalVehicleTracker::getTrackedObject(
   object.classification = getClassification();
 
   // predict kinematics
-  KalmanFilter tmp_ekf_for_no_update = ekf_;
+  EKF tmp_ekf_for_no_update = ekf_;
   const double dt = (time - last_update_time_).seconds();
   if (0.001 /*1msec*/ < dt) {
     predict(dt, tmp_ekf_for_no_update);
   }
-  Eigen::MatrixXd X_t(ekf_params_.dim_x, 1);                // predicted state
-  Eigen::MatrixXd P(ekf_params_.dim_x, ekf_params_.dim_x);  // predicted state
+  EKF::StateVector X_t;  // predicted state
+  EKF::StateMatrix P;    // predicted state
   tmp_ekf_for_no_update.getX(X_t);
   tmp_ekf_for_no_update.getP(P);
 
@@ -528,7 +526,7 @@ bool NormalVehicleTracker::getTrackedObject(
 void NormalVehicleTracker::setNearestCornerOrSurfaceIndex(
   const geometry_msgs::msg::Transform & self_transform)
 {
-  Eigen::MatrixXd X_t(ekf_params_.dim_x, 1);
+  EKF::StateVector X_t;
   ekf_.getX(X_t);
   last_nearest_corner_index_ = utils::getNearestCornerOrSurface(
     X_t(IDX::X), X_t(IDX::Y), X_t(IDX::YAW), bounding_box_.width, bounding_box_.length,
@@ -16,6 +16,7 @@
 
 #include "object_association_merger/data_association/solver/gnn_solver.hpp"
 #include "object_association_merger/utils/utils.hpp"
+#include "object_recognition_utils/object_grid.hpp"
 #include "object_recognition_utils/object_recognition_utils.hpp"
 #include "tier4_autoware_utils/geometry/geometry.hpp"
 
@@ -118,13 +119,23 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
 {
   Eigen::MatrixXd score_matrix =
     Eigen::MatrixXd::Zero(objects1.objects.size(), objects0.objects.size());
+  if (objects0.objects.empty() || objects1.objects.empty()) {
+    return score_matrix;
+  }
+
+  // pairs out of the largest distance gate are never evaluated and keep a zero score
+  const object_recognition_utils::ObjectGrid objects0_grid(
+    objects0.objects, std::max(max_dist_matrix_.maxCoeff(), 1.0));
+  std::vector<size_t> objects0_indices;
   for (size_t objects1_idx = 0; objects1_idx < objects1.objects.size(); ++objects1_idx) {
     const autoware_auto_perception_msgs::msg::DetectedObject & object1 =
       objects1.objects.at(objects1_idx);
     const std::uint8_t object1_label =
       object_recognition_utils::getHighestProbLabel(object1.classification);
+    objects0_grid.getCandidates(
+      object1.kinematics.pose_with_covariance.pose.position, objects0_indices);
 
-    for (size_t objects0_idx = 0; objects0_idx < objects0.objects.size(); ++objects0_idx) {
+    for (const auto objects0_idx : objects0_indices) {
       const autoware_auto_perception_msgs::msg::DetectedObject & object0 =
         objects0.objects.at(objects0_idx);
       const std::uint8_t object0_label =
@@ -29,8 +29,7 @@ public:
   explicit ObjectRangeSplitterNode(const rclcpp::NodeOptions & node_options);
 
 private:
-  void objectCallback(
-    const autoware_auto_perception_msgs::msg::DetectedObjects::ConstSharedPtr input_msg);
+  void objectCallback(autoware_auto_perception_msgs::msg::DetectedObjects::UniquePtr input_msg);
 
   rclcpp::Publisher<autoware_auto_perception_msgs::msg::DetectedObjects>::SharedPtr
     long_range_object_pub_;
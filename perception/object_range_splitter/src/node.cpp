@@ -14,6 +14,11 @@
 
 #include "object_range_splitter/node.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <utility>
+
 namespace object_range_splitter
 {
 ObjectRangeSplitterNode::ObjectRangeSplitterNode(const rclcpp::NodeOptions & node_options)
@@ -32,7 +37,7 @@ ObjectRangeSplitterNode::ObjectRangeSplitterNode(const rclcpp::NodeOptions & nod
 }
 
 void ObjectRangeSplitterNode::objectCallback(
-  const autoware_auto_perception_msgs::msg::DetectedObjects::ConstSharedPtr input_msg)
+  autoware_auto_perception_msgs::msg::DetectedObjects::UniquePtr input_msg)
 {
   // Guard
   if (
@@ -40,26 +45,27 @@ void ObjectRangeSplitterNode::objectCallback(
     short_range_object_pub_->get_subscription_count() < 1) {
     return;
   }
-  // build output msg
-  autoware_auto_perception_msgs::msg::DetectedObjects output_long_range_object_msg,
-    output_short_range_object_msg;
-  output_long_range_object_msg.header = input_msg->header;
-  output_short_range_object_msg.header = input_msg->header;
+  // split in place, the input msg becomes the short range msg
+  auto & objects = input_msg->objects;
+  const auto long_range_begin = std::stable_partition(
+    objects.begin(), objects.end(),
+    [this](const autoware_auto_perception_msgs::msg::DetectedObject & object) {
+      const auto & position = object.kinematics.pose_with_covariance.pose.position;
+      const auto object_sq_dist = position.x * position.x + position.y * position.y;
+      return object_sq_dist < spilt_range_ * spilt_range_;
+    });
 
-  // split
-  for (const auto & object : input_msg->objects) {
-    const auto & position = object.kinematics.pose_with_covariance.pose.position;
-    const auto object_sq_dist = position.x * position.x + position.y * position.y;
-    if (object_sq_dist < spilt_range_ * spilt_range_) {  // short range
-      output_short_range_object_msg.objects.push_back(object);
-    } else {  // long range
-      output_long_range_object_msg.objects.push_back(object);
-    }
-  }
+  // build output msg
+  auto output_long_range_object_msg =
+    std::make_unique<autoware_auto_perception_msgs::msg::DetectedObjects>();
+  output_long_range_object_msg->header = input_msg->header;
+  output_long_range_object_msg->objects.assign(
+    std::make_move_iterator(long_range_begin), std::make_move_iterator(objects.end()));
+  objects.erase(long_range_begin, objects.end());
 
   // publish output msg
-  long_range_object_pub_->publish(output_long_range_object_msg);
-  short_range_object_pub_->publish(output_short_range_object_msg);
+  long_range_object_pub_->publish(std::move(output_long_range_object_msg));
+  short_range_object_pub_->publish(std::move(input_msg));
 }
 }  // namespace object_range_splitter
 
@@ -16,8 +16,11 @@
 
 #include "tier4_autoware_utils/geometry/geometry.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace
@@ -65,25 +68,26 @@ ObjectVelocitySplitterNode::ObjectVelocitySplitterNode(const rclcpp::NodeOptions
   pub_low_speed_objects_ = create_publisher<DetectedObjects>("~/output/low_speed_objects", 1);
 }
 
-void ObjectVelocitySplitterNode::onObjects(const DetectedObjects::ConstSharedPtr objects_data_)
+void ObjectVelocitySplitterNode::onObjects(DetectedObjects::UniquePtr objects_data_)
 {
-  DetectedObjects high_speed_objects;
-  DetectedObjects low_speed_objects;
-  high_speed_objects.header = objects_data_->header;
-  low_speed_objects.header = objects_data_->header;
-
-  for (const auto & object : objects_data_->objects) {
-    if (
-      std::abs(tier4_autoware_utils::calcNorm(
-        object.kinematics.twist_with_covariance.twist.linear)) < node_param_.velocity_threshold) {
-      low_speed_objects.objects.emplace_back(object);
-    } else {
-      high_speed_objects.objects.emplace_back(object);
-    }
-  }
+  // split in place, the input msg becomes the low speed objects
+  auto & objects = objects_data_->objects;
+  const auto high_speed_begin =
+    std::stable_partition(objects.begin(), objects.end(), [this](const DetectedObject & object) {
+      return std::abs(tier4_autoware_utils::calcNorm(
+               object.kinematics.twist_with_covariance.twist.linear)) <
+             node_param_.velocity_threshold;
+    });
+
+  auto high_speed_objects = std::make_unique<DetectedObjects>();
+  high_speed_objects->header = objects_data_->header;
+  high_speed_objects->objects.assign(
+    std::make_move_iterator(high_speed_begin), std::make_move_iterator(objects.end()));
+  objects.erase(high_speed_begin, objects.end());
+
   // publish
-  pub_high_speed_objects_->publish(high_speed_objects);
-  pub_low_speed_objects_->publish(low_speed_objects);
+  pub_high_speed_objects_->publish(std::move(high_speed_objects));
+  pub_low_speed_objects_->publish(std::move(objects_data_));
 }
 
 rcl_interfaces::msg::SetParametersResult ObjectVelocitySplitterNode::onSetParam(
@@ -0,0 +1,91 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OCCUPANCY_GRID_MAP_OUTLIER_FILTER__CUDA_OUTLIER_FILTER_HPP_
+#define OCCUPANCY_GRID_MAP_OUTLIER_FILTER__CUDA_OUTLIER_FILTER_HPP_
+
+#include <cuda_utils/cuda_unique_ptr.hpp>
+#include <cuda_utils/stream_unique_ptr.hpp>
+
+#include <geometry_msgs/msg/pose.hpp>
+#include <nav_msgs/msg/occupancy_grid.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <std_msgs/msg/header.hpp>
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace occupancy_grid_map_outlier_filter
+{
+/**
+ * @brief occupancy grid map based filter and radius search 2d filter on the GPU
+ * @details The grid stays on the device while the map is unchanged. The low confidence points
+ * count their neighbors through a hash of the cells whose size is the search radius, instead of the
+ * KD-tree of RadiusSearch2dFilter.
+ */
+class CudaOutlierFilter
+{
+public:
+  struct Param
+  {
+    int cost_threshold;
+    bool use_radius_search_2d_filter;
+    float search_radius;
+    float min_points_and_distance_ratio;
+    int min_points;
+    int max_points;
+    std::size_t max_filter_points_nb;
+  };
+
+  explicit CudaOutlierFilter(const Param & param);
+
+  /**
+   * @brief split the point cloud in the map frame in the same way as the CPU filters
+   */
+  void filter(
+    const nav_msgs::msg::OccupancyGrid & occupancy_grid_map,
+    const sensor_msgs::msg::PointCloud2 & pointcloud, const geometry_msgs::msg::Pose & pose,
+    pcl::PointCloud<pcl::PointXYZ> & high_confidence,
+    pcl::PointCloud<pcl::PointXYZ> & filtered_low_confidence,
+    pcl::PointCloud<pcl::PointXYZ> & outlier, pcl::PointCloud<pcl::PointXYZ> & out_ogm);
+
+private:
+  void uploadOccupancyGridMap(const nav_msgs::msg::OccupancyGrid & occupancy_grid_map);
+  void reservePoints(const std::size_t points_num);
+
+  Param param_;
+  cuda_utils::StreamUniquePtr stream_;
+
+  cuda_utils::CudaUniquePtr<int8_t[]> grid_d_;
+  std::size_t grid_capacity_{0};
+  std_msgs::msg::Header grid_header_;
+  nav_msgs::msg::MapMetaData grid_info_;
+
+  cuda_utils::CudaUniquePtr<uint8_t[]> points_d_;
+  std::size_t points_data_capacity_{0};
+  cuda_utils::CudaUniquePtr<uint8_t[]> labels_d_;
+  cuda_utils::CudaUniquePtr<uint64_t[]> cell_keys_d_;
+  cuda_utils::CudaUniquePtr<uint32_t[]> point_indices_d_;
+  cuda_utils::CudaUniquePtr<uint64_t[]> table_keys_d_;
+  cuda_utils::CudaUniquePtr<uint32_t[]> table_values_d_;
+  std::size_t points_capacity_{0};
+  std::size_t table_size_{0};
+  std::vector<uint8_t> labels_;
+};
+}  // namespace occupancy_grid_map_outlier_filter
+
+#endif  // OCCUPANCY_GRID_MAP_OUTLIER_FILTER__CUDA_OUTLIER_FILTER_HPP_
@@ -0,0 +1,81 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OCCUPANCY_GRID_MAP_OUTLIER_FILTER__CUDA_OUTLIER_FILTER_KERNEL_HPP_
+#define OCCUPANCY_GRID_MAP_OUTLIER_FILTER__CUDA_OUTLIER_FILTER_KERNEL_HPP_
+
+#include <cuda.h>
+#include <cuda_runtime_api.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace occupancy_grid_map_outlier_filter
+{
+enum PointLabel : uint8_t {
+  OUT_OF_MAP = 0,
+  HIGH_CONFIDENCE = 1,
+  LOW_CONFIDENCE = 2,
+  OUTLIER = 3,
+};
+
+struct GridInfo
+{
+  const int8_t * data;
+  int width;
+  int height;
+  float origin_x;
+  float origin_y;
+  float resolution;
+};
+
+struct PointCloudLayout
+{
+  const uint8_t * data;
+  std::size_t points_num;
+  std::size_t point_step;
+  std::size_t x_offset;
+  std::size_t y_offset;
+};
+
+struct RadiusSearchParam
+{
+  float search_radius;
+  float min_points_and_distance_ratio;
+  int min_points;
+  int max_points;
+  float sensor_x;
+  float sensor_y;
+};
+
+// label the points by the cost of the grid and hash the confident points by their cell
+cudaError_t classifyPoints_launch(
+  const PointCloudLayout & points, const GridInfo & grid, const int cost_threshold,
+  const float cell_size, uint8_t * labels, uint64_t * cell_keys, uint32_t * point_indices,
+  cudaStream_t stream);
+
+// sort the points by the cell and register the first point of each cell to the hash table
+cudaError_t buildCellHashTable_launch(
+  const std::size_t points_num, const std::size_t table_size, uint64_t * cell_keys,
+  uint32_t * point_indices, uint64_t * table_keys, uint32_t * table_values, cudaStream_t stream);
+
+// count the confident points around each low confidence point and label the outliers
+cudaError_t labelOutliers_launch(
+  const PointCloudLayout & points, const RadiusSearchParam & param,
+  const uint64_t * sorted_cell_keys, const uint32_t * sorted_point_indices,
+  const std::size_t table_size, const uint64_t * table_keys, const uint32_t * table_values,
+  uint8_t * labels, cudaStream_t stream);
+}  // namespace occupancy_grid_map_outlier_filter
+
+#endif  // OCCUPANCY_GRID_MAP_OUTLIER_FILTER__CUDA_OUTLIER_FILTER_KERNEL_HPP_
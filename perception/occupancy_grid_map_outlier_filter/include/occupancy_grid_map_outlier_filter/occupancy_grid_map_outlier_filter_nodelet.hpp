@@ -17,6 +17,10 @@
 
 #include "pointcloud_preprocessor/filter.hpp"
 
+#if ENABLE_GPU
+#include "occupancy_grid_map_outlier_filter/cuda_outlier_filter.hpp"
+#endif
+
 #include <pcl/common/impl/common.hpp>
 #include <rclcpp/rclcpp.hpp>
 
@@ -116,6 +120,11 @@ private:
   // 2d outlier filter
   std::shared_ptr<RadiusSearch2dFilter> radius_search_2d_filter_ptr_;
 
+#if ENABLE_GPU
+  // occupancy grid map based filter and 2d outlier filter on the GPU
+  std::unique_ptr<CudaOutlierFilter> cuda_outlier_filter_ptr_;
+#endif
+
   // Debugger
   std::shared_ptr<Debugger> debugger_ptr_;
   std::unique_ptr<tier4_autoware_utils::StopWatch<std::chrono::milliseconds>> stop_watch_ptr_;
@@ -0,0 +1,194 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "occupancy_grid_map_outlier_filter/cuda_outlier_filter.hpp"
+
+#include "occupancy_grid_map_outlier_filter/cuda_outlier_filter_kernel.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+std::size_t getFieldOffset(
+  const sensor_msgs::msg::PointCloud2 & pointcloud, const std::string & field_name)
+{
+  for (const auto & field : pointcloud.fields) {
+    if (field.name == field_name && field.datatype == sensor_msgs::msg::PointField::FLOAT32) {
+      return field.offset;
+    }
+  }
+  throw std::runtime_error("Point cloud does not have a float field " + field_name);
+}
+
+std::size_t getTableSize(const std::size_t points_num)
+{
+  // keep the load factor of the cell hash table at most 0.5
+  std::size_t table_size = 1;
+  while (table_size < 2 * points_num) {
+    table_size <<= 1;
+  }
+  return table_size;
+}
+}  // namespace
+
+namespace occupancy_grid_map_outlier_filter
+{
+CudaOutlierFilter::CudaOutlierFilter(const Param & param)
+: param_(param), stream_(cuda_utils::makeCudaStream())
+{
+  if (!stream_) {
+    throw std::runtime_error("Failed to create a CUDA stream");
+  }
+}
+
+void CudaOutlierFilter::uploadOccupancyGridMap(
+  const nav_msgs::msg::OccupancyGrid & occupancy_grid_map)
+{
+  if (
+    grid_d_ && occupancy_grid_map.header == grid_header_ &&
+    occupancy_grid_map.info == grid_info_) {
+    return;
+  }
+  const std::size_t grid_size = occupancy_grid_map.data.size();
+  if (grid_capacity_ < grid_size) {
+    grid_d_ = cuda_utils::make_unique<int8_t[]>(grid_size);
+    grid_capacity_ = grid_size;
+  }
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    grid_d_.get(), occupancy_grid_map.data.data(), grid_size, cudaMemcpyHostToDevice, *stream_));
+  grid_header_ = occupancy_grid_map.header;
+  grid_info_ = occupancy_grid_map.info;
+}
+
+void CudaOutlierFilter::reservePoints(const std::size_t points_num)
+{
+  if (points_num <= points_capacity_) {
+    return;
+  }
+  labels_d_ = cuda_utils::make_unique<uint8_t[]>(points_num);
+  cell_keys_d_ = cuda_utils::make_unique<uint64_t[]>(points_num);
+  point_indices_d_ = cuda_utils::make_unique<uint32_t[]>(points_num);
+  table_size_ = getTableSize(points_num);
+  table_keys_d_ = cuda_utils::make_unique<uint64_t[]>(table_size_);
+  table_values_d_ = cuda_utils::make_unique<uint32_t[]>(table_size_);
+  points_capacity_ = points_num;
+}
+
+void CudaOutlierFilter::filter(
+  const nav_msgs::msg::OccupancyGrid & occupancy_grid_map,
+  const sensor_msgs::msg::PointCloud2 & pointcloud, const geometry_msgs::msg::Pose & pose,
+  pcl::PointCloud<pcl::PointXYZ> & high_confidence,
+  pcl::PointCloud<pcl::PointXYZ> & filtered_low_confidence,
+  pcl::PointCloud<pcl::PointXYZ> & outlier, pcl::PointCloud<pcl::PointXYZ> & out_ogm)
+{
+  const std::size_t points_num = pointcloud.width * pointcloud.height;
+  if (points_num == 0) {
+    return;
+  }
+  uploadOccupancyGridMap(occupancy_grid_map);
+  reservePoints(points_num);
+
+  const std::size_t data_size = pointcloud.data.size();
+  if (points_data_capacity_ < data_size) {
+    points_d_ = cuda_utils::make_unique<uint8_t[]>(data_size);
+    points_data_capacity_ = data_size;
+  }
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    points_d_.get(), pointcloud.data.data(), data_size, cudaMemcpyHostToDevice, *stream_));
+
+  PointCloudLayout layout{};
+  layout.data = points_d_.get();
+  layout.points_num = points_num;
+  layout.point_step = pointcloud.point_step;
+  layout.x_offset = getFieldOffset(pointcloud, "x");
+  layout.y_offset = getFieldOffset(pointcloud, "y");
+
+  GridInfo grid{};
+  grid.data = grid_d_.get();
+  grid.width = static_cast<int>(grid_info_.width);
+  grid.height = static_cast<int>(grid_info_.height);
+  grid.origin_x = static_cast<float>(grid_info_.origin.position.x);
+  grid.origin_y = static_cast<float>(grid_info_.origin.position.y);
+  grid.resolution = grid_info_.resolution;
+
+  CHECK_CUDA_ERROR(classifyPoints_launch(
+    layout, grid, param_.cost_threshold, param_.search_radius, labels_d_.get(),
+    cell_keys_d_.get(), point_indices_d_.get(), *stream_));
+  if (param_.use_radius_search_2d_filter) {
+    RadiusSearchParam radius_search_param{};
+    radius_search_param.search_radius = param_.search_radius;
+    radius_search_param.min_points_and_distance_ratio = param_.min_points_and_distance_ratio;
+    radius_search_param.min_points = param_.min_points;
+    radius_search_param.max_points = param_.max_points;
+    radius_search_param.sensor_x = static_cast<float>(pose.position.x);
+    radius_search_param.sensor_y = static_cast<float>(pose.position.y);
+    CHECK_CUDA_ERROR(buildCellHashTable_launch(
+      points_num, table_size_, cell_keys_d_.get(), point_indices_d_.get(), table_keys_d_.get(),
+      table_values_d_.get(), *stream_));
+    CHECK_CUDA_ERROR(labelOutliers_launch(
+      layout, radius_search_param, cell_keys_d_.get(), point_indices_d_.get(), table_size_,
+      table_keys_d_.get(), table_values_d_.get(), labels_d_.get(), *stream_));
+  }
+  labels_.resize(points_num);
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    labels_.data(), labels_d_.get(), points_num, cudaMemcpyDeviceToHost, *stream_));
+  CHECK_CUDA_ERROR(cudaStreamSynchronize(*stream_));
+
+  // the same limit as RadiusSearch2dFilter to keep the output of both filters consistent
+  std::size_t low_confidence_num = 0;
+  for (const auto label : labels_) {
+    if (label == LOW_CONFIDENCE || label == OUTLIER) {
+      ++low_confidence_num;
+    }
+  }
+  const bool skip_low_confidence =
+    param_.use_radius_search_2d_filter && low_confidence_num > param_.max_filter_points_nb;
+  if (skip_low_confidence) {
+    RCLCPP_WARN(
+      rclcpp::get_logger("OccupancyGridMapOutlierFilterComponent"),
+      "Skip outlier filter since too much low_confidence pointcloud!");
+  }
+
+  std::size_t idx = 0;
+  for (sensor_msgs::PointCloud2ConstIterator<float> x(pointcloud, "x"), y(pointcloud, "y"),
+       z(pointcloud, "z");
+       x != x.end(); ++x, ++y, ++z, ++idx) {
+    const pcl::PointXYZ point(*x, *y, *z);
+    switch (labels_.at(idx)) {
+      case HIGH_CONFIDENCE:
+        high_confidence.push_back(point);
+        break;
+      case LOW_CONFIDENCE:
+        if (skip_low_confidence) break;
+        if (param_.use_radius_search_2d_filter) {
+          filtered_low_confidence.push_back(point);
+        } else {
+          outlier.push_back(point);
+        }
+        break;
+      case OUTLIER:
+        if (!skip_low_confidence) outlier.push_back(point);
+        break;
+      default:
+        out_ogm.push_back(point);
+        break;
+    }
+  }
+}
+}  // namespace occupancy_grid_map_outlier_filter
@@ -0,0 +1,201 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "occupancy_grid_map_outlier_filter/cuda_outlier_filter_kernel.hpp"
+
+#include <thrust/execution_policy.h>
+#include <thrust/sort.h>
+
+namespace
+{
+const std::size_t THREADS_PER_BLOCK = 256;
+const uint64_t EMPTY_KEY = 0xFFFFFFFFFFFFFFFFULL;
+// cells farther than this from the origin are clamped, which only adds neighbor candidates
+const int MAX_CELL = 1 << 30;
+
+std::size_t divup(const std::size_t a, const std::size_t b)
+{
+  return (a + b - 1) / b;
+}
+
+__device__ inline float2 getPoint(
+  const occupancy_grid_map_outlier_filter::PointCloudLayout & points, const std::size_t idx)
+{
+  const uint8_t * point = points.data + idx * points.point_step;
+  return make_float2(
+    *reinterpret_cast<const float *>(point + points.x_offset),
+    *reinterpret_cast<const float *>(point + points.y_offset));
+}
+
+__device__ inline int getCell(const float value, const float inverse_cell_size)
+{
+  return static_cast<int>(
+    fminf(fmaxf(floorf(value * inverse_cell_size), -MAX_CELL), static_cast<float>(MAX_CELL)));
+}
+
+// the offset keeps every key of a real cell different from EMPTY_KEY
+__device__ inline uint64_t getCellKey(const int cell_x, const int cell_y)
+{
+  const uint32_t x = static_cast<uint32_t>(cell_x) + 0x80000000U;
+  const uint32_t y = static_cast<uint32_t>(cell_y) + 0x80000000U;
+  return (static_cast<uint64_t>(x) << 32) | static_cast<uint64_t>(y);
+}
+
+__device__ inline std::size_t getHash(const uint64_t key, const std::size_t table_size)
+{
+  return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32) & (table_size - 1);
+}
+}  // namespace
+
+namespace occupancy_grid_map_outlier_filter
+{
+__global__ void classifyPoints_kernel(
+  const PointCloudLayout points, const GridInfo grid, const int cost_threshold,
+  const float inverse_cell_size, uint8_t * labels, uint64_t * cell_keys, uint32_t * point_indices)
+{
+  const std::size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (idx >= points.points_num) return;
+
+  point_indices[idx] = static_cast<uint32_t>(idx);
+  const float2 p = getPoint(points, idx);
+  const float max_x = grid.origin_x + grid.width * grid.resolution;
+  const float max_y = grid.origin_y + grid.height * grid.resolution;
+  if (!(grid.origin_x < p.x && p.x < max_x && grid.origin_y < p.y && p.y < max_y)) {
+    labels[idx] = OUT_OF_MAP;
+    cell_keys[idx] = EMPTY_KEY;
+    return;
+  }
+
+  const int map_cell_x =
+    min(static_cast<int>((p.x - grid.origin_x) / grid.resolution), grid.width - 1);
+  const int map_cell_y =
+    min(static_cast<int>((p.y - grid.origin_y) / grid.resolution), grid.height - 1);
+  const int8_t cost = grid.data[map_cell_y * grid.width + map_cell_x];
+  labels[idx] = cost_threshold < cost ? HIGH_CONFIDENCE : LOW_CONFIDENCE;
+  cell_keys[idx] = getCellKey(getCell(p.x, inverse_cell_size), getCell(p.y, inverse_cell_size));
+}
+
+__global__ void buildCellHashTable_kernel(
+  const std::size_t points_num, const std::size_t table_size, const uint64_t * cell_keys,
+  uint64_t * table_keys, uint32_t * table_values)
+{
+  const std::size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (idx >= points_num) return;
+
+  const uint64_t key = cell_keys[idx];
+  if (key == EMPTY_KEY || (idx != 0 && cell_keys[idx - 1] == key)) return;
+
+  // only the first point of each cell is registered, so every key is inserted once
+  std::size_t slot = getHash(key, table_size);
+  while (true) {
+    const auto prev = atomicCAS(
+      reinterpret_cast<unsigned long long *>(&table_keys[slot]),
+      static_cast<unsigned long long>(EMPTY_KEY), static_cast<unsigned long long>(key));
+    if (prev == EMPTY_KEY) {
+      table_values[slot] = static_cast<uint32_t>(idx);
+      return;
+    }
+    slot = (slot + 1) & (table_size - 1);
+  }
+}
+
+__global__ void labelOutliers_kernel(
+  const PointCloudLayout points, const RadiusSearchParam param,
+  const uint64_t * sorted_cell_keys, const uint32_t * sorted_point_indices,
+  const std::size_t table_size, const uint64_t * table_keys, const uint32_t * table_values,
+  uint8_t * labels)
+{
+  const std::size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (idx >= points.points_num || labels[idx] != LOW_CONFIDENCE) return;
+
+  const float2 p = getPoint(points, idx);
+  const float distance = hypotf(p.x - param.sensor_x, p.y - param.sensor_y);
+  const int min_points_threshold = min(
+    max(static_cast<int>(param.min_points_and_distance_ratio / distance + 0.5f), param.min_points),
+    param.max_points);
+  const float inverse_cell_size = 1.0f / param.search_radius;
+  const float squared_radius = param.search_radius * param.search_radius;
+  const int cell_x = getCell(p.x, inverse_cell_size);
+  const int cell_y = getCell(p.y, inverse_cell_size);
+
+  // the cell size is the search radius, so the neighbors are in the surrounding 3x3 cells
+  int points_num = 0;
+  for (int dx = -1; dx <= 1; ++dx) {
+    for (int dy = -1; dy <= 1; ++dy) {
+      const uint64_t key = getCellKey(cell_x + dx, cell_y + dy);
+      std::size_t slot = getHash(key, table_size);
+      while (table_keys[slot] != EMPTY_KEY && table_keys[slot] != key) {
+        slot = (slot + 1) & (table_size - 1);
+      }
+      if (table_keys[slot] == EMPTY_KEY) continue;
+
+      for (std::size_t i = table_values[slot];
+           i < points.points_num && sorted_cell_keys[i] == key; ++i) {
+        const float2 q = getPoint(points, sorted_point_indices[i]);
+        const float dist_x = q.x - p.x;
+        const float dist_y = q.y - p.y;
+        if (dist_x * dist_x + dist_y * dist_y <= squared_radius) {
+          if (min_points_threshold <= ++points_num) return;
+        }
+      }
+    }
+  }
+  labels[idx] = OUTLIER;
+}
+
+cudaError_t classifyPoints_launch(
+  const PointCloudLayout & points, const GridInfo & grid, const int cost_threshold,
+  const float cell_size, uint8_t * labels, uint64_t * cell_keys, uint32_t * point_indices,
+  cudaStream_t stream)
+{
+  const dim3 blocks(divup(points.points_num, THREADS_PER_BLOCK));
+  const dim3 threads(THREADS_PER_BLOCK);
+  classifyPoints_kernel<<<blocks, threads, 0, stream>>>(
+    points, grid, cost_threshold, 1.0f / cell_size, labels, cell_keys, point_indices);
+  return cudaGetLastError();
+}
+
+cudaError_t buildCellHashTable_launch(
+  const std::size_t points_num, const std::size_t table_size, uint64_t * cell_keys,
+  uint32_t * point_indices, uint64_t * table_keys, uint32_t * table_values, cudaStream_t stream)
+{
+  // the points out of the map have EMPTY_KEY and are sorted to the end
+  thrust::sort_by_key(
+    thrust::cuda::par.on(stream), cell_keys, cell_keys + points_num, point_indices);
+
+  const cudaError_t err = cudaMemsetAsync(table_keys, 0xFF, sizeof(uint64_t) * table_size, stream);
+  if (err != cudaSuccess) {
+    return err;
+  }
+  const dim3 blocks(divup(points_num, THREADS_PER_BLOCK));
+  const dim3 threads(THREADS_PER_BLOCK);
+  buildCellHashTable_kernel<<<blocks, threads, 0, stream>>>(
+    points_num, table_size, cell_keys, table_keys, table_values);
+  return cudaGetLastError();
+}
+
+cudaError_t labelOutliers_launch(
+  const PointCloudLayout & points, const RadiusSearchParam & param,
+  const uint64_t * sorted_cell_keys, const uint32_t * sorted_point_indices,
+  const std::size_t table_size, const uint64_t * table_keys, const uint32_t * table_values,
+  uint8_t * labels, cudaStream_t stream)
+{
+  const dim3 blocks(divup(points.points_num, THREADS_PER_BLOCK));
+  const dim3 threads(THREADS_PER_BLOCK);
+  labelOutliers_kernel<<<blocks, threads, 0, stream>>>(
+    points, param, sorted_cell_keys, sorted_point_indices, table_size, table_keys, table_values,
+    labels);
+  return cudaGetLastError();
+}
+}  // namespace occupancy_grid_map_outlier_filter
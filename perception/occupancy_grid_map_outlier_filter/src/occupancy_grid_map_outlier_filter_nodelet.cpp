@@ -230,6 +230,28 @@ OccupancyGridMapOutlierFilterComponent::OccupancyGridMapOutlierFilterComponent(
   if (use_radius_search_2d_filter) {
     radius_search_2d_filter_ptr_ = std::make_shared<RadiusSearch2dFilter>(*this);
   }
+  /* CUDA filter */
+  if (declare_parameter("use_cuda", false)) {
+#if ENABLE_GPU
+    // the radius search parameters are declared by RadiusSearch2dFilter
+    CudaOutlierFilter::Param param{};
+    param.cost_threshold = cost_threshold_;
+    param.use_radius_search_2d_filter = use_radius_search_2d_filter;
+    param.search_radius = 1.0f;
+    if (use_radius_search_2d_filter) {
+      param.search_radius = get_parameter("radius_search_2d_filter.search_radius").as_double();
+      param.min_points_and_distance_ratio =
+        get_parameter("radius_search_2d_filter.min_points_and_distance_ratio").as_double();
+      param.min_points = get_parameter("radius_search_2d_filter.min_points").as_int();
+      param.max_points = get_parameter("radius_search_2d_filter.max_points").as_int();
+      param.max_filter_points_nb =
+        get_parameter("radius_search_2d_filter.max_filter_points_nb").as_int();
+    }
+    cuda_outlier_filter_ptr_ = std::make_unique<CudaOutlierFilter>(param);
+#else
+    RCLCPP_WARN(get_logger(), "use_cuda is ignored since this node is built without CUDA");
+#endif
+  }
   /* debugger */
   if (enable_debugger) {
     debugger_ptr_ = std::make_shared<Debugger>(*this);
@@ -277,19 +299,33 @@ void OccupancyGridMapOutlierFilterComponent::onOccupancyGridMapAndPointCloud2(
   PclPointCloud out_ogm_pc{};
   PclPointCloud ogm_frame_behind_pc;
   pcl::fromROSMsg(ogm_frame_input_behind_pc, ogm_frame_behind_pc);
-  filterByOccupancyGridMap(
-    *input_ogm, ogm_frame_pc, high_confidence_pc, low_confidence_pc, out_ogm_pc);
-  // Apply Radius search 2d filter for low confidence pointcloud
   PclPointCloud filtered_low_confidence_pc{};
   PclPointCloud outlier_pc{};
-  if (radius_search_2d_filter_ptr_) {
-    auto pc_frame_pose_stamped = getPoseStamped(
+  bool is_filtered_on_gpu = false;
+#if ENABLE_GPU
+  // both filters run on the GPU without the KD-tree
+  if (cuda_outlier_filter_ptr_) {
+    const auto pc_frame_pose_stamped = getPoseStamped(
       *tf2_, input_ogm->header.frame_id, input_pc->header.frame_id, input_ogm->header.stamp);
-    radius_search_2d_filter_ptr_->filter(
-      high_confidence_pc, low_confidence_pc, pc_frame_pose_stamped.pose, filtered_low_confidence_pc,
-      outlier_pc);
-  } else {
-    outlier_pc = low_confidence_pc;
+    cuda_outlier_filter_ptr_->filter(
+      *input_ogm, ogm_frame_pc, pc_frame_pose_stamped.pose, high_confidence_pc,
+      filtered_low_confidence_pc, outlier_pc, out_ogm_pc);
+    is_filtered_on_gpu = true;
+  }
+#endif
+  if (!is_filtered_on_gpu) {
+    filterByOccupancyGridMap(
+      *input_ogm, ogm_frame_pc, high_confidence_pc, low_confidence_pc, out_ogm_pc);
+    // Apply Radius search 2d filter for low confidence pointcloud
+    if (radius_search_2d_filter_ptr_) {
+      auto pc_frame_pose_stamped = getPoseStamped(
+        *tf2_, input_ogm->header.frame_id, input_pc->header.frame_id, input_ogm->header.stamp);
+      radius_search_2d_filter_ptr_->filter(
+        high_confidence_pc, low_confidence_pc, pc_frame_pose_stamped.pose,
+        filtered_low_confidence_pc, outlier_pc);
+    } else {
+      outlier_pc = low_confidence_pc;
+    }
   }
   // Concatenate high confidence pointcloud from occupancy grid map and non-outlier pointcloud
   PclPointCloud concat_pc =
@@ -20,6 +20,8 @@
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 
+#include <array>
+
 namespace costmap_2d
 {
 class OccupancyGridMapBBFUpdater : public OccupancyGridMapUpdaterInterface
@@ -35,6 +37,8 @@ private:
   inline unsigned char applyBBF(const unsigned char & z, const unsigned char & o);
   Eigen::Matrix2f probability_matrix_;
   double v_ratio_;
+  // applyBBF() results for every pair of observed and current costs, indexed as [z][o]
+  std::array<std::array<unsigned char, 256>, 256> bbf_table_;
 };
 
 }  // namespace costmap_2d
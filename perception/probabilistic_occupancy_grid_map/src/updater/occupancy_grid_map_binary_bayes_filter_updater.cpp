@@ -38,6 +38,13 @@ void OccupancyGridMapBBFUpdater::initRosParam(rclcpp::Node & node)
   probability_matrix_(Index::OCCUPIED, Index::FREE) =
     node.declare_parameter<double>("probability_matrix.free_to_occupied");
   v_ratio_ = node.declare_parameter<double>("v_ratio");
+
+  for (size_t z = 0; z < bbf_table_.size(); ++z) {
+    for (size_t o = 0; o < bbf_table_.at(z).size(); ++o) {
+      bbf_table_.at(z).at(o) =
+        applyBBF(static_cast<unsigned char>(z), static_cast<unsigned char>(o));
+    }
+  }
 }
 
 inline unsigned char OccupancyGridMapBBFUpdater::applyBBF(
@@ -69,10 +76,21 @@ bool OccupancyGridMapBBFUpdater::update(const Costmap2D & single_frame_occupancy
 {
   updateOrigin(
     single_frame_occupancy_grid_map.getOriginX(), single_frame_occupancy_grid_map.getOriginY());
-  for (unsigned int x = 0; x < getSizeInCellsX(); x++) {
-    for (unsigned int y = 0; y < getSizeInCellsY(); y++) {
+  if (
+    single_frame_occupancy_grid_map.getSizeInCellsX() == getSizeInCellsX() &&
+    single_frame_occupancy_grid_map.getSizeInCellsY() == getSizeInCellsY()) {
+    // both maps share the same layout, so the cells are updated in memory order
+    const unsigned char * single_frame_costmap = single_frame_occupancy_grid_map.getCharMap();
+    const unsigned int size = getSizeInCellsX() * getSizeInCellsY();
+    for (unsigned int index = 0; index < size; index++) {
+      costmap_[index] = bbf_table_[single_frame_costmap[index]][costmap_[index]];
+    }
+    return true;
+  }
+  for (unsigned int y = 0; y < getSizeInCellsY(); y++) {
+    for (unsigned int x = 0; x < getSizeInCellsX(); x++) {
       unsigned int index = getIndex(x, y);
-      costmap_[index] = applyBBF(single_frame_occupancy_grid_map.getCost(x, y), costmap_[index]);
+      costmap_[index] = bbf_table_[single_frame_occupancy_grid_map.getCost(x, y)][costmap_[index]];
     }
   }
   return true;
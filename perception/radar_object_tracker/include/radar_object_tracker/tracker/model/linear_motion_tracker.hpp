@@ -17,7 +17,7 @@
 
 #include "radar_object_tracker/tracker/model/tracker_base.hpp"
 
-#include <kalman_filter/kalman_filter.hpp>
+#include <kalman_filter/kalman_filter_n.hpp>
 
 #include <string>
 
@@ -29,7 +29,8 @@ private:
   rclcpp::Logger logger_;
 
 private:
-  KalmanFilter ekf_;
+  using EKF = KalmanFilterN<6, 4>;
+  EKF ekf_;
   rclcpp::Time last_update_time_;
   enum IDX { X = 0, Y = 1, VX = 2, VY = 3, AX = 4, AY = 5 };
 
@@ -91,7 +92,7 @@ public:
 
   void loadDefaultModelParameters(const std::string & path);
   bool predict(const rclcpp::Time & time) override;
-  bool predict(const double dt, KalmanFilter & ekf) const;
+  bool predict(const double dt, EKF & ekf) const;
   bool measure(
     const autoware_auto_perception_msgs::msg::DetectedObject & object, const rclcpp::Time & time,
     const geometry_msgs::msg::Transform & self_transform) override;
@@ -62,7 +62,7 @@ LinearMotionTracker::LinearMotionTracker(
   // loadModelParameters(tracker_param_file, label);
 
   // initialize X matrix and position
-  Eigen::MatrixXd X(ekf_params_.dim_x, 1);
+  EKF::StateVector X;
   X(IDX::X) = object.kinematics.pose_with_covariance.pose.position.x;
   X(IDX::Y) = object.kinematics.pose_with_covariance.pose.position.y;
   const auto yaw = tf2::getYaw(object.kinematics.pose_with_covariance.pose.orientation);
@@ -82,7 +82,7 @@ LinearMotionTracker::LinearMotionTracker(
   X(IDX::AY) = 0.0;
 
   // initialize P matrix
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(ekf_params_.dim_x, ekf_params_.dim_x);
+  EKF::StateMatrix P = EKF::StateMatrix::Zero();
 
   // create rotation matrix to rotate covariance matrix
   const double cos_yaw = std::cos(yaw);
@@ -236,7 +236,7 @@ bool LinearMotionTracker::predict(const rclcpp::Time & time)
   return ret;
 }
 
-bool LinearMotionTracker::predict(const double dt, KalmanFilter & ekf) const
+bool LinearMotionTracker::predict(const double dt, EKF & ekf) const
 {
   /*  == Linear model ==
    *
@@ -259,7 +259,7 @@ bool LinearMotionTracker::predict(const double dt, KalmanFilter & ekf) const
    */
 
   // X t
-  Eigen::MatrixXd X_t(ekf_params_.dim_x, 1);  // predicted state
+  EKF::StateVector X_t;  // predicted state
   ekf.getX(X_t);
   const auto x = X_t(IDX::X);
   const auto y = X_t(IDX::Y);
@@ -269,7 +269,7 @@ bool LinearMotionTracker::predict(const double dt, KalmanFilter & ekf) const
   const auto ay = X_t(IDX::AY);
 
   // X t+1
-  Eigen::MatrixXd X_next_t(ekf_params_.dim_x, 1);
+  EKF::StateVector X_next_t;
   X_next_t(IDX::X) = x + vx * dt + 0.5 * ax * dt * dt;
   X_next_t(IDX::Y) = y + vy * dt + 0.5 * ay * dt * dt;
   X_next_t(IDX::VX) = vx + ax * dt;
@@ -278,7 +278,7 @@ bool LinearMotionTracker::predict(const double dt, KalmanFilter & ekf) const
   X_next_t(IDX::AY) = ay;
 
   // A: state transition matrix
-  Eigen::MatrixXd A = Eigen::MatrixXd::Identity(ekf_params_.dim_x, ekf_params_.dim_x);
+  EKF::StateMatrix A = EKF::StateMatrix::Identity();
   A(IDX::X, IDX::VX) = dt;
   A(IDX::Y, IDX::VY) = dt;
   A(IDX::X, IDX::AX) = 0.5 * dt * dt;
@@ -287,8 +287,8 @@ bool LinearMotionTracker::predict(const double dt, KalmanFilter & ekf) const
   A(IDX::VY, IDX::AY) = dt;
 
   // Q: system noise
-  Eigen::MatrixXd Q = Eigen::MatrixXd::Zero(ekf_params_.dim_x, ekf_params_.dim_x);
-  Eigen::MatrixXd Q_local = Eigen::MatrixXd::Zero(ekf_params_.dim_x, ekf_params_.dim_x);
+  EKF::StateMatrix Q = EKF::StateMatrix::Zero();
+  EKF::StateMatrix Q_local = EKF::StateMatrix::Zero();
 
   // system noise in local coordinate
   // we assume acceleration random walk model
@@ -301,7 +301,7 @@ bool LinearMotionTracker::predict(const double dt, KalmanFilter & ekf) const
   // qy << 0, dt * dt * dt / 6, 0, dt * dt / 2, 0, dt;
   // Q_local = qx * ekf_params_.q_cov_ax * qx.transpose() + qy * ekf_params_.q_cov_ay *
   // qy.transpose(); just create diag matrix
-  Eigen::VectorXd q_diag_vector = Eigen::VectorXd::Zero(ekf_params_.dim_x);
+  EKF::StateVector q_diag_vector = EKF::StateVector::Zero();
   q_diag_vector << ekf_params_.q_cov_x, ekf_params_.q_cov_y, ekf_params_.q_cov_vx,
     ekf_params_.q_cov_vy, ekf_params_.q_cov_ax, ekf_params_.q_cov_ay;
   Q_local = q_diag_vector.asDiagonal();
@@ -313,17 +313,14 @@ bool LinearMotionTracker::predict(const double dt, KalmanFilter & ekf) const
   // [R 0 0]             [R^T 0 0]
   // [0 R 0] * Q_local * [0 R^T 0]
   // [0 0 R]             [0 0 R^T]
-  Eigen::MatrixXd R = Eigen::MatrixXd::Zero(2, 2);
+  Eigen::Matrix2d R = Eigen::Matrix2d::Zero();
   R << cos(yaw_), -sin(yaw_), sin(yaw_), cos(yaw_);
-  Eigen::MatrixXd RotateCovMatrix = Eigen::MatrixXd::Zero(ekf_params_.dim_x, ekf_params_.dim_x);
+  EKF::StateMatrix RotateCovMatrix = EKF::StateMatrix::Zero();
   RotateCovMatrix.block<2, 2>(IDX::X, IDX::X) = R;
   RotateCovMatrix.block<2, 2>(IDX::VX, IDX::VX) = R;
   RotateCovMatrix.block<2, 2>(IDX::AX, IDX::AX) = R;
   Q = RotateCovMatrix * Q_local * RotateCovMatrix.transpose();
 
-  Eigen::MatrixXd B = Eigen::MatrixXd::Zero(ekf_params_.dim_x, ekf_params_.dim_x);
-  Eigen::MatrixXd u = Eigen::MatrixXd::Zero(ekf_params_.dim_x, 1);
-
   // call kalman filter library
   if (!ekf.predict(X_next_t, A, Q)) {
     RCLCPP_WARN(logger_, "Cannot predict");
@@ -436,8 +433,8 @@ bool LinearMotionTracker::measureWithPose(
 
   // 5. normalize: limit vx, vy
   {
-    Eigen::MatrixXd X_t(ekf_params_.dim_x, 1);
-    Eigen::MatrixXd P_t(ekf_params_.dim_x, ekf_params_.dim_x);
+    EKF::StateVector X_t;
+    EKF::StateMatrix P_t;
     ekf_.getX(X_t);
     ekf_.getP(P_t);
     if (!(-max_vx_ <= X_t(IDX::VX) && X_t(IDX::VX) <= max_vx_)) {
@@ -509,13 +506,13 @@ bool LinearMotionTracker::getTrackedObject(
   object.classification = getClassification();
 
   // predict kinematics
-  KalmanFilter tmp_ekf_for_no_update = ekf_;
+  EKF tmp_ekf_for_no_update = ekf_;
   const double dt = (time - last_update_time_).seconds();
   if (0.001 /*1msec*/ < dt) {
     predict(dt, tmp_ekf_for_no_update);
   }
-  Eigen::MatrixXd X_t(ekf_params_.dim_x, 1);                // predicted state
-  Eigen::MatrixXd P(ekf_params_.dim_x, ekf_params_.dim_x);  // predicted state
+  EKF::StateVector X_t;  // predicted state
+  EKF::StateMatrix P;    // predicted state
   tmp_ekf_for_no_update.getX(X_t);
   tmp_ekf_for_no_update.getP(P);
 
@@ -28,17 +28,26 @@ private:
     autoware_auto_perception_msgs::msg::Shape & shape_output,
     geometry_msgs::msg::Pose & pose_output);
   float calcClosenessCriterion(const std::vector<float> & C_1, const std::vector<float> & C_2);
+  float calcClosenessCriterion(const pcl::PointCloud<pcl::PointXYZ> & cluster, const float theta);
   float optimize(
     const pcl::PointCloud<pcl::PointXYZ> & cluster, const float min_angle, const float max_angle);
   float boostOptimize(
     const pcl::PointCloud<pcl::PointXYZ> & cluster, const float min_angle, const float max_angle);
+  float coarseToFineOptimize(
+    const pcl::PointCloud<pcl::PointXYZ> & cluster, const float min_angle, const float max_angle);
+
+  // projections of the cluster points, reused for every searched angle
+  std::vector<float> C_1_;
+  std::vector<float> C_2_;
 
 public:
   BoundingBoxShapeModel();
   explicit BoundingBoxShapeModel(
-    const boost::optional<ReferenceYawInfo> & ref_yaw_info, bool use_boost_bbox_optimizer = false);
+    const boost::optional<ReferenceYawInfo> & ref_yaw_info, bool use_boost_bbox_optimizer = false,
+    bool use_coarse_to_fine_bbox_optimizer = false);
   boost::optional<ReferenceYawInfo> ref_yaw_info_;
   bool use_boost_bbox_optimizer_;
+  bool use_coarse_to_fine_bbox_optimizer_;
 
   ~BoundingBoxShapeModel() {}
 
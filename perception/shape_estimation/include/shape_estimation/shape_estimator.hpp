@@ -26,6 +26,7 @@
 #include <pcl_conversions/pcl_conversions.h>
 
 #include <string>
+#include <vector>
 
 struct ReferenceYawInfo
 {
@@ -45,6 +46,21 @@ struct ReferenceShapeSizeInfo
   Mode mode;
 };
 
+struct ShapeEstimationInput
+{
+  uint8_t label;
+  pcl::PointCloud<pcl::PointXYZ> cluster;
+  boost::optional<ReferenceYawInfo> ref_yaw_info;
+  boost::optional<ReferenceShapeSizeInfo> ref_shape_size_info;
+};
+
+struct ShapeEstimationOutput
+{
+  bool is_estimated{false};
+  autoware_auto_perception_msgs::msg::Shape shape;
+  geometry_msgs::msg::Pose pose;
+};
+
 class ShapeEstimator
 {
 private:
@@ -64,9 +80,12 @@ private:
   bool use_corrector_;
   bool use_filter_;
   bool use_boost_bbox_optimizer_;
+  bool use_coarse_to_fine_bbox_optimizer_;
 
 public:
-  ShapeEstimator(bool use_corrector, bool use_filter, bool use_boost_bbox_optimizer = false);
+  ShapeEstimator(
+    bool use_corrector, bool use_filter, bool use_boost_bbox_optimizer = false,
+    bool use_coarse_to_fine_bbox_optimizer = false);
 
   virtual ~ShapeEstimator() = default;
 
@@ -76,6 +95,13 @@ public:
     const boost::optional<ReferenceShapeSizeInfo> & ref_shape_size_info,
     autoware_auto_perception_msgs::msg::Shape & shape_output,
     geometry_msgs::msg::Pose & pose_output);
+
+  /**
+   * @brief estimate the shapes of all the clusters of a frame, distributed over several threads
+   * @return the outputs in the order of the inputs
+   */
+  std::vector<ShapeEstimationOutput> estimateShapesAndPoses(
+    const std::vector<ShapeEstimationInput> & inputs, const size_t nb_threads);
 };
 
 #endif  // SHAPE_ESTIMATION__SHAPE_ESTIMATOR_HPP_
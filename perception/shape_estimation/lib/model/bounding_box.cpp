@@ -45,13 +45,18 @@
 constexpr float epsilon = 0.001;
 
 BoundingBoxShapeModel::BoundingBoxShapeModel()
-: ref_yaw_info_(boost::none), use_boost_bbox_optimizer_(false)
+: ref_yaw_info_(boost::none),
+  use_boost_bbox_optimizer_(false),
+  use_coarse_to_fine_bbox_optimizer_(false)
 {
 }
 
 BoundingBoxShapeModel::BoundingBoxShapeModel(
-  const boost::optional<ReferenceYawInfo> & ref_yaw_info, bool use_boost_bbox_optimizer)
-: ref_yaw_info_(ref_yaw_info), use_boost_bbox_optimizer_(use_boost_bbox_optimizer)
+  const boost::optional<ReferenceYawInfo> & ref_yaw_info, bool use_boost_bbox_optimizer,
+  bool use_coarse_to_fine_bbox_optimizer)
+: ref_yaw_info_(ref_yaw_info),
+  use_boost_bbox_optimizer_(use_boost_bbox_optimizer),
+  use_coarse_to_fine_bbox_optimizer_(use_coarse_to_fine_bbox_optimizer)
 {
 }
 
@@ -91,6 +96,8 @@ bool BoundingBoxShapeModel::fitLShape(
   double theta_star;
   if (use_boost_bbox_optimizer_) {
     theta_star = boostOptimize(cluster, min_angle, max_angle);
+  } else if (use_coarse_to_fine_bbox_optimizer_) {
+    theta_star = coarseToFineOptimize(cluster, min_angle, max_angle);
   } else {
     theta_star = optimize(cluster, min_angle, max_angle);
   }
@@ -171,48 +178,48 @@ float BoundingBoxShapeModel::calcClosenessCriterion(
   const float min_c_2 = *std::min_element(C_2.begin(), C_2.end());  // col.3, Algo.4
   const float max_c_2 = *std::max_element(C_2.begin(), C_2.end());  // col.3, Algo.4
 
-  std::vector<float> D_1;  // col.4, Algo.4
-  for (const auto & c_1_element : C_1) {
-    const float v = std::min(max_c_1 - c_1_element, c_1_element - min_c_1);
-    D_1.push_back(v * v);
-  }
-
-  std::vector<float> D_2;  // col.5, Algo.4
-  for (const auto & c_2_element : C_2) {
-    const float v = std::min(max_c_2 - c_2_element, c_2_element - min_c_2);
-    D_2.push_back(v * v);
-  }
   constexpr float d_min = 0.1 * 0.1;
   constexpr float d_max = 0.4 * 0.4;
   float beta = 0;  // col.6, Algo.4
-  for (size_t i = 0; i < D_1.size(); ++i) {
-    if (d_max < std::min(D_1.at(i), D_2.at(i))) {
+  for (size_t i = 0; i < C_1.size(); ++i) {
+    const float v_1 = std::min(max_c_1 - C_1[i], C_1[i] - min_c_1);
+    const float v_2 = std::min(max_c_2 - C_2[i], C_2[i] - min_c_2);
+    const float d_1 = v_1 * v_1;  // col.4, Algo.4
+    const float d_2 = v_2 * v_2;  // col.5, Algo.4
+    if (d_max < std::min(d_1, d_2)) {
       continue;
     }
-    const float d = std::max(std::min(D_1.at(i), D_2.at(i)), d_min);
+    const float d = std::max(std::min(d_1, d_2), d_min);
     beta += 1.0 / d;
   }
   return beta;
 }
 
+float BoundingBoxShapeModel::calcClosenessCriterion(
+  const pcl::PointCloud<pcl::PointXYZ> & cluster, const float theta)
+{
+  Eigen::Vector2f e_1;
+  e_1 << std::cos(theta), std::sin(theta);  // col.3, Algo.2
+  Eigen::Vector2f e_2;
+  e_2 << -std::sin(theta), std::cos(theta);  // col.4, Algo.2
+  C_1_.resize(cluster.size());               // col.5, Algo.2
+  C_2_.resize(cluster.size());               // col.6, Algo.2
+  for (size_t i = 0; i < cluster.size(); ++i) {
+    const auto & point = cluster[i];
+    C_1_[i] = point.x * e_1.x() + point.y * e_1.y();
+    C_2_[i] = point.x * e_2.x() + point.y * e_2.y();
+  }
+  return calcClosenessCriterion(C_1_, C_2_);
+}
+
 float BoundingBoxShapeModel::optimize(
   const pcl::PointCloud<pcl::PointXYZ> & cluster, const float min_angle, const float max_angle)
 {
   std::vector<std::pair<float /*theta*/, float /*q*/>> Q;
   constexpr float angle_resolution = M_PI / 180.0;
   for (float theta = min_angle; theta <= max_angle + epsilon; theta += angle_resolution) {
-    Eigen::Vector2f e_1;
-    e_1 << std::cos(theta), std::sin(theta);  // col.3, Algo.2
-    Eigen::Vector2f e_2;
-    e_2 << -std::sin(theta), std::cos(theta);  // col.4, Algo.2
-    std::vector<float> C_1;                    // col.5, Algo.2
-    std::vector<float> C_2;                    // col.6, Algo.2
-    for (const auto & point : cluster) {
-      C_1.push_back(point.x * e_1.x() + point.y * e_1.y());
-      C_2.push_back(point.x * e_2.x() + point.y * e_2.y());
-    }
-    float q = calcClosenessCriterion(C_1, C_2);  // col.7, Algo.2
-    Q.push_back(std::make_pair(theta, q));       // col.8, Algo.2
+    float q = calcClosenessCriterion(cluster, theta);  // col.7, Algo.2
+    Q.push_back(std::make_pair(theta, q));             // col.8, Algo.2
   }
 
   float theta_star{0.0};  // col.10, Algo.2
@@ -230,20 +237,7 @@ float BoundingBoxShapeModel::optimize(
 float BoundingBoxShapeModel::boostOptimize(
   const pcl::PointCloud<pcl::PointXYZ> & cluster, const float min_angle, const float max_angle)
 {
-  auto closeness_func = [&](float theta) {
-    Eigen::Vector2f e_1;
-    e_1 << std::cos(theta), std::sin(theta);  // col.3, Algo.2
-    Eigen::Vector2f e_2;
-    e_2 << -std::sin(theta), std::cos(theta);  // col.4, Algo.2
-    std::vector<float> C_1;                    // col.5, Algo.2
-    std::vector<float> C_2;                    // col.6, Algo.2
-    for (const auto & point : cluster) {
-      C_1.push_back(point.x * e_1.x() + point.y * e_1.y());
-      C_2.push_back(point.x * e_2.x() + point.y * e_2.y());
-    }
-    float q = calcClosenessCriterion(C_1, C_2);
-    return -q;
-  };
+  auto closeness_func = [&](float theta) { return -calcClosenessCriterion(cluster, theta); };
 
   int bits = 6;
   boost::uintmax_t max_iter = 20;
@@ -252,3 +246,38 @@ float BoundingBoxShapeModel::boostOptimize(
   float theta_star = min.first;
   return theta_star;
 }
+
+float BoundingBoxShapeModel::coarseToFineOptimize(
+  const pcl::PointCloud<pcl::PointXYZ> & cluster, const float min_angle, const float max_angle)
+{
+  // search every 5 degrees, then every degree around the best coarse angle
+  constexpr float coarse_angle_resolution = 5.0 * M_PI / 180.0;
+  constexpr float fine_angle_resolution = M_PI / 180.0;
+
+  float theta_star = min_angle;
+  float max_q = calcClosenessCriterion(cluster, min_angle);
+  for (float theta = min_angle + coarse_angle_resolution; theta <= max_angle + epsilon;
+       theta += coarse_angle_resolution) {
+    const float q = calcClosenessCriterion(cluster, theta);
+    if (max_q < q) {
+      max_q = q;
+      theta_star = theta;
+    }
+  }
+
+  const float coarse_theta_star = theta_star;
+  const float fine_min_angle =
+    std::max(min_angle, coarse_theta_star - coarse_angle_resolution + fine_angle_resolution);
+  const float fine_max_angle =
+    std::min(max_angle, coarse_theta_star + coarse_angle_resolution - fine_angle_resolution);
+  for (float theta = fine_min_angle; theta <= fine_max_angle + epsilon;
+       theta += fine_angle_resolution) {
+    const float q = calcClosenessCriterion(cluster, theta);
+    if (max_q < q) {
+      max_q = q;
+      theta_star = theta;
+    }
+  }
+
+  return theta_star;
+}
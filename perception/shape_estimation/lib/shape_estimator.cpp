@@ -18,15 +18,22 @@
 #include "shape_estimation/filter/filter.hpp"
 #include "shape_estimation/model/model.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <memory>
+#include <thread>
+#include <vector>
 
 using Label = autoware_auto_perception_msgs::msg::ObjectClassification;
 
-ShapeEstimator::ShapeEstimator(bool use_corrector, bool use_filter, bool use_boost_bbox_optimizer)
+ShapeEstimator::ShapeEstimator(
+  bool use_corrector, bool use_filter, bool use_boost_bbox_optimizer,
+  bool use_coarse_to_fine_bbox_optimizer)
 : use_corrector_(use_corrector),
   use_filter_(use_filter),
-  use_boost_bbox_optimizer_(use_boost_bbox_optimizer)
+  use_boost_bbox_optimizer_(use_boost_bbox_optimizer),
+  use_coarse_to_fine_bbox_optimizer_(use_coarse_to_fine_bbox_optimizer)
 {
 }
 
@@ -63,6 +70,34 @@ bool ShapeEstimator::estimateShapeAndPose(
   return true;
 }
 
+std::vector<ShapeEstimationOutput> ShapeEstimator::estimateShapesAndPoses(
+  const std::vector<ShapeEstimationInput> & inputs, const size_t nb_threads)
+{
+  std::vector<ShapeEstimationOutput> outputs(inputs.size());
+
+  // each cluster is independent, so the workers only share the index of the next cluster
+  std::atomic<size_t> next_idx{0};
+  const auto work = [&]() {
+    for (auto idx = next_idx++; idx < inputs.size(); idx = next_idx++) {
+      const auto & input = inputs.at(idx);
+      auto & output = outputs.at(idx);
+      output.is_estimated = estimateShapeAndPose(
+        input.label, input.cluster, input.ref_yaw_info, input.ref_shape_size_info, output.shape,
+        output.pose);
+    }
+  };
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < std::min(nb_threads, inputs.size()); ++i) {
+    workers.emplace_back(work);
+  }
+  work();
+  for (auto & worker : workers) {
+    worker.join();
+  }
+
+  return outputs;
+}
+
 bool ShapeEstimator::estimateOriginalShapeAndPose(
   const uint8_t label, const pcl::PointCloud<pcl::PointXYZ> & cluster,
   const boost::optional<ReferenceYawInfo> & ref_yaw_info,
@@ -73,7 +108,8 @@ bool ShapeEstimator::estimateOriginalShapeAndPose(
   if (
     label == Label::CAR || label == Label::TRUCK || label == Label::BUS ||
     label == Label::TRAILER || label == Label::MOTORCYCLE || label == Label::BICYCLE) {
-    model_ptr.reset(new BoundingBoxShapeModel(ref_yaw_info, use_boost_bbox_optimizer_));
+    model_ptr.reset(new BoundingBoxShapeModel(
+      ref_yaw_info, use_boost_bbox_optimizer_, use_coarse_to_fine_bbox_optimizer_));
   } else if (label == Label::PEDESTRIAN) {
     model_ptr.reset(new CylinderShapeModel());
   } else {
@@ -31,6 +31,8 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 using Label = autoware_auto_perception_msgs::msg::ObjectClassification;
 
@@ -47,9 +49,12 @@ ShapeEstimationNode::ShapeEstimationNode(const rclcpp::NodeOptions & node_option
   use_vehicle_reference_yaw_ = declare_parameter("use_vehicle_reference_yaw", true);
   use_vehicle_reference_shape_size_ = declare_parameter("use_vehicle_reference_shape_size", true);
   bool use_boost_bbox_optimizer = declare_parameter("use_boost_bbox_optimizer", false);
+  bool use_coarse_to_fine_bbox_optimizer =
+    declare_parameter("use_coarse_to_fine_bbox_optimizer", false);
+  num_threads_ = static_cast<int>(declare_parameter("num_threads", 1));
   RCLCPP_INFO(this->get_logger(), "using boost shape estimation : %d", use_boost_bbox_optimizer);
-  estimator_ =
-    std::make_unique<ShapeEstimator>(use_corrector, use_filter, use_boost_bbox_optimizer);
+  estimator_ = std::make_unique<ShapeEstimator>(
+    use_corrector, use_filter, use_boost_bbox_optimizer, use_coarse_to_fine_bbox_optimizer);
 }
 
 void ShapeEstimationNode::callback(const DetectedObjectsWithFeature::ConstSharedPtr input_msg)
@@ -63,8 +68,13 @@ void ShapeEstimationNode::callback(const DetectedObjectsWithFeature::ConstShared
   DetectedObjectsWithFeature output_msg;
   output_msg.header = input_msg->header;
 
-  // Estimate shape for each object and pack msg
-  for (const auto & feature_object : input_msg->feature_objects) {
+  // Collect the clusters to estimate
+  std::vector<ShapeEstimationInput> inputs;
+  std::vector<size_t> object_indices;
+  inputs.reserve(input_msg->feature_objects.size());
+  object_indices.reserve(input_msg->feature_objects.size());
+  for (size_t i = 0; i < input_msg->feature_objects.size(); ++i) {
+    const auto & feature_object = input_msg->feature_objects.at(i);
     const auto & object = feature_object.object;
     const auto & label = object.classification.front().label;
     const auto & feature = feature_object.feature;
@@ -72,38 +82,42 @@ void ShapeEstimationNode::callback(const DetectedObjectsWithFeature::ConstShared
                             Label::TRAILER == label;
 
     // convert ros to pcl
-    pcl::PointCloud<pcl::PointXYZ>::Ptr cluster(new pcl::PointCloud<pcl::PointXYZ>);
-    pcl::fromROSMsg(feature.cluster, *cluster);
+    ShapeEstimationInput input;
+    input.label = label;
+    pcl::fromROSMsg(feature.cluster, input.cluster);
 
     // check cluster data
-    if (cluster->empty()) {
+    if (input.cluster.empty()) {
       continue;
     }
 
-    // estimate shape and pose
-    autoware_auto_perception_msgs::msg::Shape shape;
-    geometry_msgs::msg::Pose pose;
-    boost::optional<ReferenceYawInfo> ref_yaw_info = boost::none;
-    boost::optional<ReferenceShapeSizeInfo> ref_shape_size_info = boost::none;
     if (use_vehicle_reference_yaw_ && is_vehicle) {
-      ref_yaw_info = ReferenceYawInfo{
+      input.ref_yaw_info = ReferenceYawInfo{
         static_cast<float>(tf2::getYaw(object.kinematics.pose_with_covariance.pose.orientation)),
         tier4_autoware_utils::deg2rad(10)};
     }
     if (use_vehicle_reference_shape_size_ && is_vehicle) {
-      ref_shape_size_info = ReferenceShapeSizeInfo{object.shape, ReferenceShapeSizeInfo::Mode::Min};
+      input.ref_shape_size_info =
+        ReferenceShapeSizeInfo{object.shape, ReferenceShapeSizeInfo::Mode::Min};
     }
-    const bool estimated_success = estimator_->estimateShapeAndPose(
-      label, *cluster, ref_yaw_info, ref_shape_size_info, shape, pose);
+    inputs.push_back(std::move(input));
+    object_indices.push_back(i);
+  }
+
+  // estimate shape and pose
+  const auto outputs = estimator_->estimateShapesAndPoses(inputs, num_threads_);
 
+  // Pack msg
+  for (size_t i = 0; i < outputs.size(); ++i) {
     // If the shape estimation fails, ignore it.
-    if (!estimated_success) {
+    if (!outputs.at(i).is_estimated) {
       continue;
     }
 
-    output_msg.feature_objects.push_back(feature_object);
-    output_msg.feature_objects.back().object.shape = shape;
-    output_msg.feature_objects.back().object.kinematics.pose_with_covariance.pose = pose;
+    output_msg.feature_objects.push_back(input_msg->feature_objects.at(object_indices.at(i)));
+    output_msg.feature_objects.back().object.shape = outputs.at(i).shape;
+    output_msg.feature_objects.back().object.kinematics.pose_with_covariance.pose =
+      outputs.at(i).pose;
   }
 
   // Publish
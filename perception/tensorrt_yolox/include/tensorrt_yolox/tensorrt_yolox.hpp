@@ -18,6 +18,7 @@
 #include <cuda_utils/cuda_unique_ptr.hpp>
 #include <cuda_utils/stream_unique_ptr.hpp>
 #include <opencv2/opencv.hpp>
+#include <tensorrt_common/profile_diagnostics.hpp>
 #include <tensorrt_common/tensorrt_common.hpp>
 #include <tensorrt_yolox/preprocess.hpp>
 
@@ -130,6 +131,16 @@ public:
    */
   void printProfiling(void);
 
+  /**
+   * @brief enable or disable the TensorRT profiler for each layer
+   */
+  void setProfiling(const bool enable);
+
+  /**
+   * @brief get the TensorRT profiles as a diagnostic status
+   */
+  diagnostic_msgs::msg::DiagnosticStatus getProfileDiagnosticStatus(const std::string & name) const;
+
 private:
   /**
    * @brief run preprocess including resizing, letterbox, NHWC2NCHW and toFloat on CPU
@@ -208,7 +219,6 @@ private:
 
   std::unique_ptr<tensorrt_common::TrtCommon> trt_common_;
 
-  std::vector<float> input_h_;
   CudaUniquePtr<float[]> input_d_;
   CudaUniquePtr<int32_t[]> out_num_detections_d_;
   CudaUniquePtr<float[]> out_boxes_d_;
@@ -0,0 +1,76 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORRT_YOLOX__TENSORRT_YOLOX_MULTI_CAMERA_NODE_HPP_
+#define TENSORRT_YOLOX__TENSORRT_YOLOX_MULTI_CAMERA_NODE_HPP_
+
+#include <image_transport/image_transport.hpp>
+#include <opencv2/opencv.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <tensorrt_yolox/tensorrt_yolox.hpp>
+
+#include <sensor_msgs/msg/image.hpp>
+#include <tier4_perception_msgs/msg/detected_objects_with_feature.hpp>
+
+#if __has_include(<cv_bridge/cv_bridge.hpp>)
+#include <cv_bridge/cv_bridge.hpp>
+#else
+#include <cv_bridge/cv_bridge.h>
+#endif
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tensorrt_yolox
+{
+using LabelMap = std::map<int, std::string>;
+
+/**
+ * @brief run one YOLOX engine for several cameras
+ * @details The images received from all the cameras within a time window are inferred in a single
+ * batch, and the results of each camera are published on its own topics.
+ */
+class TrtYoloXMultiCameraNode : public rclcpp::Node
+{
+public:
+  explicit TrtYoloXMultiCameraNode(const rclcpp::NodeOptions & node_options);
+
+private:
+  void onImage(const sensor_msgs::msg::Image::ConstSharedPtr msg, const size_t camera_id);
+  void inferBatch();
+  void publish(const size_t camera_id, const ObjectArray & objects, cv_bridge::CvImage & image);
+  bool readLabelFile(const std::string & label_path);
+  void replaceLabelMap();
+
+  std::vector<image_transport::Publisher> image_pubs_;
+  std::vector<rclcpp::Publisher<tier4_perception_msgs::msg::DetectedObjectsWithFeature>::SharedPtr>
+    objects_pubs_;
+
+  std::vector<image_transport::Subscriber> image_subs_;
+
+  // images waiting for the next batch, nullptr for cameras without a new image
+  std::vector<cv_bridge::CvImagePtr> pending_images_;
+  std::chrono::nanoseconds batch_window_;
+  rclcpp::TimerBase::SharedPtr batch_timer_;
+
+  LabelMap label_map_;
+  std::unique_ptr<tensorrt_yolox::TrtYoloX> trt_yolox_;
+};
+
+}  // namespace tensorrt_yolox
+
+#endif  // TENSORRT_YOLOX__TENSORRT_YOLOX_MULTI_CAMERA_NODE_HPP_
@@ -302,6 +302,17 @@ void TrtYoloX::printProfiling(void)
   trt_common_->printProfiling();
 }
 
+void TrtYoloX::setProfiling(const bool enable)
+{
+  trt_common_->setProfiling(enable);
+}
+
+diagnostic_msgs::msg::DiagnosticStatus TrtYoloX::getProfileDiagnosticStatus(
+  const std::string & name) const
+{
+  return tensorrt_common::toProfileDiagnosticStatus(*trt_common_, name);
+}
+
 void TrtYoloX::preprocessGpu(const std::vector<cv::Mat> & images)
 {
   const auto batch_size = images.size();
@@ -342,18 +353,16 @@ void TrtYoloX::preprocessGpu(const std::vector<cv::Mat> & images)
       image_buf_d_ =
         cuda_utils::make_unique<unsigned char[]>(image.cols * image.rows * 3 * batch_size);
     }
-    int index = b * image.cols * image.rows * 3;
+    const auto image_size = image.cols * image.rows * 3;
+    int index = b * image_size;
     // Copy into pinned memory
-    memcpy(
-      image_buf_h_.get() + index, &image.data[0],
-      image.cols * image.rows * 3 * sizeof(unsigned char));
+    memcpy(image_buf_h_.get() + index, &image.data[0], image_size * sizeof(unsigned char));
+    // Copy into device memory while the next image is copied into pinned memory
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      image_buf_d_.get() + index, image_buf_h_.get() + index, image_size * sizeof(unsigned char),
+      cudaMemcpyHostToDevice, *stream_));
     b++;
   }
-  // Copy into device memory
-  CHECK_CUDA_ERROR(cudaMemcpyAsync(
-    image_buf_d_.get(), image_buf_h_.get(),
-    images[0].cols * images[0].rows * 3 * batch_size * sizeof(unsigned char),
-    cudaMemcpyHostToDevice, *stream_));
   // Preprocess on GPU
   resize_bilinear_letterbox_nhwc_to_nchw32_batch_gpu(
     input_d_.get(), image_buf_d_.get(), input_width, input_height, 3, images[0].cols,
@@ -397,12 +406,11 @@ void TrtYoloX::preprocess(const std::vector<cv::Mat> & images)
   const auto chw_images = cv::dnn::blobFromImages(
     dst_images, norm_factor_, cv::Size(), cv::Scalar(), false, false, CV_32F);
 
-  const auto data_length = chw_images.total();
-  input_h_.reserve(data_length);
-  const auto flat = chw_images.reshape(1, data_length);
-  input_h_ = chw_images.isContinuous() ? flat : flat.clone();
-  CHECK_CUDA_ERROR(cudaMemcpy(
-    input_d_.get(), input_h_.data(), input_h_.size() * sizeof(float), cudaMemcpyHostToDevice));
+  // upload the blob directly, the copy returns once the pageable memory has been staged
+  const auto flat = chw_images.isContinuous() ? chw_images : chw_images.clone();
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    input_d_.get(), flat.ptr<float>(), flat.total() * sizeof(float), cudaMemcpyHostToDevice,
+    *stream_));
   // No Need for Sync
 }
 
@@ -474,24 +482,20 @@ void TrtYoloX::preprocessWithRoiGpu(
       image_buf_d_ =
         cuda_utils::make_unique<unsigned char[]>(image.cols * image.rows * 3 * batch_size);
     }
-    int index = b * image.cols * image.rows * 3;
+    const auto image_size = image.cols * image.rows * 3;
+    int index = b * image_size;
     // Copy into pinned memory
-    // memcpy(&(m_h_img[index]), &image.data[0], image.cols * image.rows * 3 * sizeof(unsigned
-    // char));
-    memcpy(
-      image_buf_h_.get() + index, &image.data[0],
-      image.cols * image.rows * 3 * sizeof(unsigned char));
+    memcpy(image_buf_h_.get() + index, &image.data[0], image_size * sizeof(unsigned char));
+    // Copy into device memory while the next image is copied into pinned memory
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      image_buf_d_.get() + index, image_buf_h_.get() + index, image_size * sizeof(unsigned char),
+      cudaMemcpyHostToDevice, *stream_));
     roi_h_[b].x = rois[b].x;
     roi_h_[b].y = rois[b].y;
     roi_h_[b].w = rois[b].width;
     roi_h_[b].h = rois[b].height;
     b++;
   }
-  // Copy into device memory
-  CHECK_CUDA_ERROR(cudaMemcpyAsync(
-    image_buf_d_.get(), image_buf_h_.get(),
-    images[0].cols * images[0].rows * 3 * batch_size * sizeof(unsigned char),
-    cudaMemcpyHostToDevice, *stream_));
   CHECK_CUDA_ERROR(cudaMemcpyAsync(
     roi_d_.get(), roi_h_.get(), batch_size * sizeof(Roi), cudaMemcpyHostToDevice, *stream_));
   crop_resize_bilinear_letterbox_nhwc_to_nchw32_batch_gpu(
@@ -542,12 +546,11 @@ void TrtYoloX::preprocessWithRoi(
   const auto chw_images = cv::dnn::blobFromImages(
     dst_images, norm_factor_, cv::Size(), cv::Scalar(), false, false, CV_32F);
 
-  const auto data_length = chw_images.total();
-  input_h_.reserve(data_length);
-  const auto flat = chw_images.reshape(1, data_length);
-  input_h_ = chw_images.isContinuous() ? flat : flat.clone();
-  CHECK_CUDA_ERROR(cudaMemcpy(
-    input_d_.get(), input_h_.data(), input_h_.size() * sizeof(float), cudaMemcpyHostToDevice));
+  // upload the blob directly, the copy returns once the pageable memory has been staged
+  const auto flat = chw_images.isContinuous() ? chw_images : chw_images.clone();
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    input_d_.get(), flat.ptr<float>(), flat.total() * sizeof(float), cudaMemcpyHostToDevice,
+    *stream_));
   // No Need for Sync
 }
 
@@ -647,12 +650,11 @@ void TrtYoloX::multiScalePreprocess(const cv::Mat & image, const std::vector<cv:
   const auto chw_images = cv::dnn::blobFromImages(
     dst_images, norm_factor_, cv::Size(), cv::Scalar(), false, false, CV_32F);
 
-  const auto data_length = chw_images.total();
-  input_h_.reserve(data_length);
-  const auto flat = chw_images.reshape(1, data_length);
-  input_h_ = chw_images.isContinuous() ? flat : flat.clone();
-  CHECK_CUDA_ERROR(cudaMemcpy(
-    input_d_.get(), input_h_.data(), input_h_.size() * sizeof(float), cudaMemcpyHostToDevice));
+  // upload the blob directly, the copy returns once the pageable memory has been staged
+  const auto flat = chw_images.isContinuous() ? chw_images : chw_images.clone();
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    input_d_.get(), flat.ptr<float>(), flat.total() * sizeof(float), cudaMemcpyHostToDevice,
+    *stream_));
   // No Need for Sync
 }
 
@@ -0,0 +1,242 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorrt_yolox/tensorrt_yolox_multi_camera_node.hpp"
+
+#include "object_recognition_utils/object_classification.hpp"
+
+#include <autoware_auto_perception_msgs/msg/object_classification.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace tensorrt_yolox
+{
+TrtYoloXMultiCameraNode::TrtYoloXMultiCameraNode(const rclcpp::NodeOptions & node_options)
+: Node("tensorrt_yolox_multi_camera", node_options)
+{
+  auto declare_parameter_with_description =
+    [this](std::string name, auto default_val, std::string description = "") {
+      auto param_desc = rcl_interfaces::msg::ParameterDescriptor{};
+      param_desc.description = description;
+      return this->declare_parameter(name, default_val, param_desc);
+    };
+
+  std::string model_path =
+    declare_parameter_with_description("model_path", "", "The onnx file name for YOLOX model");
+  std::string label_path = declare_parameter_with_description(
+    "label_path", "",
+    "The label file that consists of label name texts for detected object categories");
+  std::string precision = declare_parameter_with_description(
+    "precision", "fp32",
+    "operation precision to be used on inference. Valid value is one of: [fp32, fp16, int8]");
+  float score_threshold = declare_parameter_with_description(
+    "score_threshold", 0.3,
+    ("Objects with a score lower than this value will be ignored. "
+     "This threshold will be ignored if specified model contains EfficientNMS_TRT module in it"));
+  float nms_threshold = declare_parameter_with_description(
+    "nms_threshold", 0.7,
+    ("Detection results will be ignored if IoU over this value. "
+     "This threshold will be ignored if specified model contains EfficientNMS_TRT module in it"));
+  bool preprocess_on_gpu = declare_parameter_with_description(
+    "preprocess_on_gpu", true, "If true, pre-processing is performed on GPU");
+  int num_cameras = declare_parameter_with_description(
+    "num_cameras", 1, "The number of cameras, which is also the batch size of the engine");
+  double batch_window_ms = declare_parameter_with_description(
+    "batch_window_ms", 30.0,
+    ("Time to wait for the images of the other cameras after the first image of a batch. "
+     "Cameras without an image in the window are skipped in the batch"));
+
+  if (num_cameras < 1) {
+    RCLCPP_ERROR(this->get_logger(), "num_cameras should be positive");
+    rclcpp::shutdown();
+    return;
+  }
+
+  if (!readLabelFile(label_path)) {
+    RCLCPP_ERROR(this->get_logger(), "Could not find label file");
+    rclcpp::shutdown();
+  }
+  replaceLabelMap();
+
+  // the engine always runs with the full batch, so that the preprocessing buffers keep their size
+  const tensorrt_common::BatchConfig batch_config{num_cameras, num_cameras, num_cameras};
+  trt_yolox_ = std::make_unique<tensorrt_yolox::TrtYoloX>(
+    model_path, precision, label_map_.size(), score_threshold, nms_threshold,
+    tensorrt_common::BuildConfig(), preprocess_on_gpu, std::string(), 1.0, "", batch_config);
+
+  batch_window_ = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::duration<double, std::milli>(batch_window_ms));
+  pending_images_.resize(num_cameras);
+  for (int camera_id = 0; camera_id < num_cameras; ++camera_id) {
+    const auto suffix = std::to_string(camera_id);
+    objects_pubs_.push_back(
+      this->create_publisher<tier4_perception_msgs::msg::DetectedObjectsWithFeature>(
+        "~/out/objects" + suffix, 1));
+    image_pubs_.push_back(image_transport::create_publisher(this, "~/out/image" + suffix));
+    image_subs_.push_back(image_transport::create_subscription(
+      this, "~/in/image" + suffix,
+      [this, camera_id](const sensor_msgs::msg::Image::ConstSharedPtr msg) {
+        onImage(msg, camera_id);
+      },
+      "raw", rmw_qos_profile_sensor_data));
+  }
+
+  if (declare_parameter("build_only", false)) {
+    RCLCPP_INFO(this->get_logger(), "TensorRT engine file is built and exit.");
+    rclcpp::shutdown();
+  }
+}
+
+void TrtYoloXMultiCameraNode::onImage(
+  const sensor_msgs::msg::Image::ConstSharedPtr msg, const size_t camera_id)
+{
+  cv_bridge::CvImagePtr in_image_ptr;
+  try {
+    in_image_ptr = cv_bridge::toCvCopy(msg, sensor_msgs::image_encodings::BGR8);
+  } catch (cv_bridge::Exception & e) {
+    RCLCPP_ERROR(this->get_logger(), "cv_bridge exception: %s", e.what());
+    return;
+  }
+
+  // the previous image of this camera is not dropped but inferred with the images received so far
+  if (pending_images_.at(camera_id)) {
+    inferBatch();
+  }
+  pending_images_.at(camera_id) = in_image_ptr;
+
+  const bool is_batch_complete = std::all_of(
+    pending_images_.begin(), pending_images_.end(), [](const auto & image) { return !!image; });
+  if (is_batch_complete) {
+    inferBatch();
+  } else if (!batch_timer_) {
+    batch_timer_ = rclcpp::create_timer(
+      this, get_clock(), batch_window_, std::bind(&TrtYoloXMultiCameraNode::inferBatch, this));
+  }
+}
+
+void TrtYoloXMultiCameraNode::inferBatch()
+{
+  if (batch_timer_) {
+    batch_timer_->cancel();
+    batch_timer_.reset();
+  }
+
+  const auto reference_image = std::find_if(
+    pending_images_.begin(), pending_images_.end(), [](const auto & image) { return !!image; });
+  if (reference_image == pending_images_.end()) {
+    return;
+  }
+  const auto image_size = (*reference_image)->image.size();
+
+  // cameras without an image are filled with a blank one and their results are discarded
+  std::vector<cv::Mat> images;
+  images.reserve(pending_images_.size());
+  for (auto & pending_image : pending_images_) {
+    if (pending_image && pending_image->image.size() != image_size) {
+      RCLCPP_WARN_THROTTLE(
+        this->get_logger(), *get_clock(), 5000,
+        "All the cameras should have the same image size, skip the image of %s",
+        pending_image->header.frame_id.c_str());
+      pending_image.reset();
+    }
+    images.push_back(
+      pending_image ? pending_image->image : cv::Mat(image_size, CV_8UC3, cv::Scalar(0, 0, 0)));
+  }
+
+  tensorrt_yolox::ObjectArrays objects;
+  if (!trt_yolox_->doInference(images, objects)) {
+    RCLCPP_WARN(this->get_logger(), "Fail to inference");
+  } else {
+    for (size_t camera_id = 0; camera_id < pending_images_.size(); ++camera_id) {
+      if (pending_images_.at(camera_id)) {
+        publish(camera_id, objects.at(camera_id), *pending_images_.at(camera_id));
+      }
+    }
+  }
+  std::fill(pending_images_.begin(), pending_images_.end(), nullptr);
+}
+
+void TrtYoloXMultiCameraNode::publish(
+  const size_t camera_id, const ObjectArray & objects, cv_bridge::CvImage & image)
+{
+  tier4_perception_msgs::msg::DetectedObjectsWithFeature out_objects;
+  const auto width = image.image.cols;
+  const auto height = image.image.rows;
+  for (const auto & yolox_object : objects) {
+    tier4_perception_msgs::msg::DetectedObjectWithFeature object;
+    object.feature.roi.x_offset = yolox_object.x_offset;
+    object.feature.roi.y_offset = yolox_object.y_offset;
+    object.feature.roi.width = yolox_object.width;
+    object.feature.roi.height = yolox_object.height;
+    object.object.existence_probability = yolox_object.score;
+    object.object.classification =
+      object_recognition_utils::toObjectClassifications(label_map_[yolox_object.type], 1.0f);
+    out_objects.feature_objects.push_back(object);
+    const auto left = std::max(0, static_cast<int>(object.feature.roi.x_offset));
+    const auto top = std::max(0, static_cast<int>(object.feature.roi.y_offset));
+    const auto right =
+      std::min(static_cast<int>(object.feature.roi.x_offset + object.feature.roi.width), width);
+    const auto bottom =
+      std::min(static_cast<int>(object.feature.roi.y_offset + object.feature.roi.height), height);
+    cv::rectangle(
+      image.image, cv::Point(left, top), cv::Point(right, bottom), cv::Scalar(0, 0, 255), 3, 8, 0);
+  }
+  image_pubs_.at(camera_id).publish(image.toImageMsg());
+
+  out_objects.header = image.header;
+  objects_pubs_.at(camera_id)->publish(out_objects);
+}
+
+bool TrtYoloXMultiCameraNode::readLabelFile(const std::string & label_path)
+{
+  std::ifstream label_file(label_path);
+  if (!label_file.is_open()) {
+    RCLCPP_ERROR(this->get_logger(), "Could not open label file. [%s]", label_path.c_str());
+    return false;
+  }
+  int label_index{};
+  std::string label;
+  while (getline(label_file, label)) {
+    std::transform(
+      label.begin(), label.end(), label.begin(), [](auto c) { return std::toupper(c); });
+    label_map_.insert({label_index, label});
+    ++label_index;
+  }
+  return true;
+}
+
+void TrtYoloXMultiCameraNode::replaceLabelMap()
+{
+  for (std::size_t i = 0; i < label_map_.size(); ++i) {
+    auto & label = label_map_[i];
+    if (label == "PERSON") {
+      label = "PEDESTRIAN";
+    } else if (label == "MOTORBIKE") {
+      label = "MOTORCYCLE";
+    } else if (
+      label != "CAR" && label != "PEDESTRIAN" && label != "BUS" && label != "TRUCK" &&
+      label != "BICYCLE" && label != "MOTORCYCLE") {
+      label = "UNKNOWN";
+    }
+  }
+}
+
+}  // namespace tensorrt_yolox
+
+#include "rclcpp_components/register_node_macro.hpp"
+RCLCPP_COMPONENTS_REGISTER_NODE(tensorrt_yolox::TrtYoloXMultiCameraNode)
@@ -109,6 +109,20 @@ TrtYoloXNode::TrtYoloXNode(const rclcpp::NodeOptions & node_options)
     "~/out/objects", 1);
   image_pub_ = image_transport::create_publisher(this, "~/out/image");
 
+  // TensorRT profiles can be enabled at runtime, which synchronizes each inference
+  const bool publish_profile = declare_parameter_with_description(
+    "publish_profile", false, "If true, TensorRT profiles are published on ~/debug/profile");
+  trt_yolox_->setProfiling(publish_profile || profile_per_layer);
+  profile_pub_ =
+    this->create_publisher<diagnostic_msgs::msg::DiagnosticArray>("~/debug/profile", 1);
+  profile_timer_ =
+    rclcpp::create_timer(this, get_clock(), 1000ms, std::bind(&TrtYoloXNode::onProfileTimer, this));
+  if (!publish_profile) {
+    profile_timer_->cancel();
+  }
+  set_param_res_ =
+    this->add_on_set_parameters_callback(std::bind(&TrtYoloXNode::onSetParam, this, _1));
+
   if (declare_parameter("build_only", false)) {
     RCLCPP_INFO(this->get_logger(), "TensorRT engine file is built and exit.");
     rclcpp::shutdown();
@@ -175,6 +189,35 @@ void TrtYoloXNode::onImage(const sensor_msgs::msg::Image::ConstSharedPtr msg)
   objects_pub_->publish(out_objects);
 }
 
+void TrtYoloXNode::onProfileTimer()
+{
+  diagnostic_msgs::msg::DiagnosticArray diagnostics;
+  diagnostics.header.stamp = this->now();
+  diagnostics.status.push_back(trt_yolox_->getProfileDiagnosticStatus(this->get_name()));
+  profile_pub_->publish(diagnostics);
+}
+
+rcl_interfaces::msg::SetParametersResult TrtYoloXNode::onSetParam(
+  const std::vector<rclcpp::Parameter> & parameters)
+{
+  for (const auto & parameter : parameters) {
+    if (parameter.get_name() != "publish_profile") {
+      continue;
+    }
+    const bool publish_profile = parameter.as_bool();
+    trt_yolox_->setProfiling(publish_profile);
+    if (publish_profile) {
+      profile_timer_->reset();
+    } else {
+      profile_timer_->cancel();
+    }
+  }
+  rcl_interfaces::msg::SetParametersResult result;
+  result.successful = true;
+  result.reason = "success";
+  return result;
+}
+
 bool TrtYoloXNode::readLabelFile(const std::string & label_path)
 {
   std::ifstream label_file(label_path);
@@ -14,6 +14,7 @@
 
 #include "tracking_object_merger/data_association/data_association.hpp"
 
+#include "object_recognition_utils/object_grid.hpp"
 #include "object_recognition_utils/object_recognition_utils.hpp"
 #include "tier4_autoware_utils/geometry/geometry.hpp"
 #include "tracking_object_merger/data_association/solver/gnn_solver.hpp"
@@ -134,9 +135,19 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
 {
   Eigen::MatrixXd score_matrix =
     Eigen::MatrixXd::Zero(objects1.objects.size(), objects0.objects.size());
+  if (objects0.objects.empty() || objects1.objects.empty()) {
+    return score_matrix;
+  }
+
+  // pairs out of the largest distance gate are never evaluated and keep a zero score
+  const object_recognition_utils::ObjectGrid objects0_grid(
+    objects0.objects, std::max(max_dist_matrix_.maxCoeff(), 1.0));
+  std::vector<size_t> objects0_indices;
   for (size_t objects1_idx = 0; objects1_idx < objects1.objects.size(); ++objects1_idx) {
     const auto & object1 = objects1.objects.at(objects1_idx);
-    for (size_t objects0_idx = 0; objects0_idx < objects0.objects.size(); ++objects0_idx) {
+    objects0_grid.getCandidates(
+      object1.kinematics.pose_with_covariance.pose.position, objects0_indices);
+    for (const auto objects0_idx : objects0_indices) {
       const auto & object0 = objects0.objects.at(objects0_idx);
       const double score = calcScoreBetweenObjects(object0, object1);
 
@@ -158,10 +169,20 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
   const std::vector<TrackerState> & trackers)
 {
   Eigen::MatrixXd score_matrix = Eigen::MatrixXd::Zero(trackers.size(), objects0.objects.size());
+  if (objects0.objects.empty() || trackers.empty()) {
+    return score_matrix;
+  }
+
+  // pairs out of the largest distance gate are never evaluated and keep a zero score
+  const object_recognition_utils::ObjectGrid objects0_grid(
+    objects0.objects, std::max(max_dist_matrix_.maxCoeff(), 1.0));
+  std::vector<size_t> objects0_indices;
   for (size_t trackers_idx = 0; trackers_idx < trackers.size(); ++trackers_idx) {
     const auto & object1 = trackers.at(trackers_idx).getObject();
+    objects0_grid.getCandidates(
+      object1.kinematics.pose_with_covariance.pose.position, objects0_indices);
 
-    for (size_t objects0_idx = 0; objects0_idx < objects0.objects.size(); ++objects0_idx) {
+    for (const auto objects0_idx : objects0_indices) {
       const auto & object0 = objects0.objects.at(objects0_idx);
       const double score = calcScoreBetweenObjects(object0, object1);
 
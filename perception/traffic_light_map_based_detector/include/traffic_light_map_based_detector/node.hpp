@@ -58,6 +58,20 @@ private:
     double max_timestamp_offset;
     double timestamp_sample_len;
     double max_detection_range;
+    double traffic_light_cache_margin;
+  };
+
+  /**
+   * @brief traffic light with the geometry used for the visibility check every frame
+   *
+   */
+  struct TrafficLightCandidate
+  {
+    lanelet::ConstLineString3d traffic_light;
+    tf2::Vector3 top_left;
+    tf2::Vector3 bottom_right;
+    tf2::Vector3 center;
+    double yaw;
   };
 
   struct IdLessThan
@@ -97,6 +111,15 @@ private:
   lanelet::traffic_rules::TrafficRulesPtr traffic_rules_ptr_;
   lanelet::routing::RoutingGraphPtr routing_graph_ptr_;
 
+  /**
+   * @brief traffic lights around nearby_traffic_lights_origin_, which are updated when the camera
+   * moves more than traffic_light_cache_margin or the route or the map is updated
+   *
+   */
+  std::vector<TrafficLightCandidate> nearby_traffic_lights_;
+  tf2::Vector3 nearby_traffic_lights_origin_;
+  bool is_nearby_traffic_lights_valid_{false};
+
   Config config_;
   /**
    * @brief Calculated the transform from map to frame_id at timestamp t
@@ -127,16 +150,26 @@ private:
    * @param input_msg
    */
   void routeCallback(const autoware_planning_msgs::msg::LaneletRoute::ConstSharedPtr input_msg);
+  /**
+   * @brief Update the traffic lights around the camera if the camera is out of the cached area
+   *
+   * @param all_traffic_lights  all the traffic lights in the route or in the map
+   * @param tf_map2camera       the transformation from map to camera
+   * @param tf_map2camera_vec   the transformation sequences from map to camera
+   */
+  void updateNearbyTrafficLights(
+    const TrafficLightSet & all_traffic_lights, const tf2::Transform & tf_map2camera,
+    const std::vector<tf2::Transform> & tf_map2camera_vec);
   /**
    * @brief Get the Visible Traffic Lights object
    *
-   * @param all_traffic_lights      all the traffic lights in the route or in the map
+   * @param traffic_lights          the traffic lights around the camera
    * @param tf_map2camera_vec           the transformation sequences from map to camera
    * @param pinhole_camera_model    pinhole model calculated from camera_info
    * @param visible_traffic_lights  the visible traffic lights object
    */
   void getVisibleTrafficLights(
-    const TrafficLightSet & all_traffic_lights,
+    const std::vector<TrafficLightCandidate> & traffic_lights,
     const std::vector<tf2::Transform> & tf_map2camera_vec,
     const image_geometry::PinholeCameraModel & pinhole_camera_model,
     std::vector<lanelet::ConstLineString3d> & visible_traffic_lights) const;
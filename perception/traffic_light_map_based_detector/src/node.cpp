@@ -137,6 +137,8 @@ MapBasedDetector::MapBasedDetector(const rclcpp::NodeOptions & node_options)
   config_.max_timestamp_offset = declare_parameter<double>("max_timestamp_offset", 0.0);
   config_.timestamp_sample_len = declare_parameter<double>("timestamp_sample_len", 0.01);
   config_.max_detection_range = declare_parameter<double>("max_detection_range", 200.0);
+  config_.traffic_light_cache_margin =
+    declare_parameter<double>("traffic_light_cache_margin", 50.0);
 
   if (config_.max_detection_range <= 0) {
     RCLCPP_ERROR_STREAM(
@@ -156,6 +158,12 @@ MapBasedDetector::MapBasedDetector(const rclcpp::NodeOptions & node_options)
     config_.max_timestamp_offset = 0.0;
     config_.min_timestamp_offset = 0.0;
   }
+  if (config_.traffic_light_cache_margin < 0) {
+    RCLCPP_ERROR_STREAM(
+      get_logger(), "Invalid param traffic_light_cache_margin = "
+                      << config_.traffic_light_cache_margin << ", set to 0");
+    config_.traffic_light_cache_margin = 0.0;
+  }
 
   // subscribers
   map_sub_ = create_subscription<autoware_auto_mapping_msgs::msg::HADMapBin>(
@@ -236,16 +244,16 @@ void MapBasedDetector::cameraInfoCallback(
   std::vector<lanelet::ConstLineString3d> visible_traffic_lights;
   // If get a route, use only traffic lights on the route.
   if (route_traffic_lights_ptr_ != nullptr) {
-    getVisibleTrafficLights(
-      *route_traffic_lights_ptr_, tf_map2camera_vec, pinhole_camera_model, visible_traffic_lights);
+    updateNearbyTrafficLights(*route_traffic_lights_ptr_, tf_map2camera, tf_map2camera_vec);
     // If don't get a route, use the traffic lights around ego vehicle.
   } else if (all_traffic_lights_ptr_ != nullptr) {
-    getVisibleTrafficLights(
-      *all_traffic_lights_ptr_, tf_map2camera_vec, pinhole_camera_model, visible_traffic_lights);
+    updateNearbyTrafficLights(*all_traffic_lights_ptr_, tf_map2camera, tf_map2camera_vec);
     // This shouldn't run.
   } else {
     return;
   }
+  getVisibleTrafficLights(
+    nearby_traffic_lights_, tf_map2camera_vec, pinhole_camera_model, visible_traffic_lights);
 
   /*
    * Get the ROI from the lanelet and the intrinsic matrix of camera to determine where it appears
@@ -389,6 +397,7 @@ void MapBasedDetector::mapCallback(
   std::vector<lanelet::AutowareTrafficLightConstPtr> all_lanelet_traffic_lights =
     lanelet::utils::query::autowareTrafficLights(all_lanelets);
   all_traffic_lights_ptr_ = std::make_shared<MapBasedDetector::TrafficLightSet>();
+  is_nearby_traffic_lights_valid_ = false;
   for (auto tl_itr = all_lanelet_traffic_lights.begin(); tl_itr != all_lanelet_traffic_lights.end();
        ++tl_itr) {
     lanelet::AutowareTrafficLightConstPtr tl = *tl_itr;
@@ -424,6 +433,7 @@ void MapBasedDetector::routeCallback(
   std::vector<lanelet::AutowareTrafficLightConstPtr> route_lanelet_traffic_lights =
     lanelet::utils::query::autowareTrafficLights(route_lanelets);
   route_traffic_lights_ptr_ = std::make_shared<MapBasedDetector::TrafficLightSet>();
+  is_nearby_traffic_lights_valid_ = false;
   for (auto tl_itr = route_lanelet_traffic_lights.begin();
        tl_itr != route_lanelet_traffic_lights.end(); ++tl_itr) {
     lanelet::AutowareTrafficLightConstPtr tl = *tl_itr;
@@ -438,12 +448,31 @@ void MapBasedDetector::routeCallback(
   }
 }
 
-void MapBasedDetector::getVisibleTrafficLights(
+void MapBasedDetector::updateNearbyTrafficLights(
   const MapBasedDetector::TrafficLightSet & all_traffic_lights,
-  const std::vector<tf2::Transform> & tf_map2camera_vec,
-  const image_geometry::PinholeCameraModel & pinhole_camera_model,
-  std::vector<lanelet::ConstLineString3d> & visible_traffic_lights) const
+  const tf2::Transform & tf_map2camera, const std::vector<tf2::Transform> & tf_map2camera_vec)
 {
+  const auto getMaxDistance = [&tf_map2camera_vec](const tf2::Vector3 & origin) {
+    double max_distance = 0.0;
+    for (const auto & tf : tf_map2camera_vec) {
+      const tf2::Vector3 diff = tf.getOrigin() - origin;
+      max_distance = std::max(max_distance, std::hypot(diff.x(), diff.y()));
+    }
+    return max_distance;
+  };
+
+  // All the cameras in the period are within the margin from the origin of the cache, so the
+  // traffic lights in their detection range are in the cache.
+  if (
+    is_nearby_traffic_lights_valid_ &&
+    getMaxDistance(nearby_traffic_lights_origin_) < config_.traffic_light_cache_margin) {
+    return;
+  }
+
+  nearby_traffic_lights_origin_ = tf_map2camera.getOrigin();
+  const double cache_range = config_.max_detection_range + config_.traffic_light_cache_margin +
+                             getMaxDistance(nearby_traffic_lights_origin_);
+  nearby_traffic_lights_.clear();
   for (const auto & traffic_light : all_traffic_lights) {
     // some "Traffic Light" are actually not traffic lights
     if (
@@ -451,45 +480,72 @@ void MapBasedDetector::getVisibleTrafficLights(
       traffic_light.attribute("subtype").value() == "solid") {
       continue;
     }
+    TrafficLightCandidate candidate;
+    candidate.center = getTrafficLightCenter(traffic_light);
+    if (!isInDistanceRange(candidate.center, nearby_traffic_lights_origin_, cache_range)) {
+      continue;
+    }
     // traffic light bottom left
     const auto & tl_bl = traffic_light.front();
     // traffic light bottom right
     const auto & tl_br = traffic_light.back();
-    // check distance range
-    tf2::Vector3 tl_center = getTrafficLightCenter(traffic_light);
+    candidate.traffic_light = traffic_light;
+    candidate.top_left = getTrafficLightTopLeft(traffic_light);
+    candidate.bottom_right = getTrafficLightBottomRight(traffic_light);
+    candidate.yaw = tier4_autoware_utils::normalizeRadian(
+      std::atan2(tl_br.y() - tl_bl.y(), tl_br.x() - tl_bl.x()) + M_PI_2);
+    nearby_traffic_lights_.push_back(candidate);
+  }
+  is_nearby_traffic_lights_valid_ = true;
+}
+
+void MapBasedDetector::getVisibleTrafficLights(
+  const std::vector<MapBasedDetector::TrafficLightCandidate> & traffic_lights,
+  const std::vector<tf2::Transform> & tf_map2camera_vec,
+  const image_geometry::PinholeCameraModel & pinhole_camera_model,
+  std::vector<lanelet::ConstLineString3d> & visible_traffic_lights) const
+{
+  // calculate the inverse and the yaw of every camera pose once for all the traffic lights
+  std::vector<tf2::Transform> tf_camera2map_vec;
+  std::vector<double> camera_yaw_vec;
+  tf_camera2map_vec.reserve(tf_map2camera_vec.size());
+  camera_yaw_vec.reserve(tf_map2camera_vec.size());
+  for (const auto & tf_map2camera : tf_map2camera_vec) {
+    tf_camera2map_vec.push_back(tf_map2camera.inverse());
+    // get direction of z axis
+    tf2::Vector3 camera_z_dir(0, 0, 1);
+    tf2::Matrix3x3 camera_rotation_matrix(tf_map2camera.getRotation());
+    camera_z_dir = camera_rotation_matrix * camera_z_dir;
+    double camera_yaw = std::atan2(camera_z_dir.y(), camera_z_dir.x());
+    camera_yaw_vec.push_back(tier4_autoware_utils::normalizeRadian(camera_yaw));
+  }
+
+  constexpr double max_angle_range = tier4_autoware_utils::deg2rad(40.0);
+  for (const auto & candidate : traffic_lights) {
     // for every possible transformation, check if the tl is visible.
     // If under any tf the tl is visible, keep it
-    for (const auto & tf_map2camera : tf_map2camera_vec) {
-      if (!isInDistanceRange(tl_center, tf_map2camera.getOrigin(), config_.max_detection_range)) {
+    for (size_t i = 0; i < tf_map2camera_vec.size(); ++i) {
+      // check distance range
+      if (!isInDistanceRange(
+            candidate.center, tf_map2camera_vec[i].getOrigin(), config_.max_detection_range)) {
         continue;
       }
 
       // check angle range
-      const double tl_yaw = tier4_autoware_utils::normalizeRadian(
-        std::atan2(tl_br.y() - tl_bl.y(), tl_br.x() - tl_bl.x()) + M_PI_2);
-      constexpr double max_angle_range = tier4_autoware_utils::deg2rad(40.0);
-
-      // get direction of z axis
-      tf2::Vector3 camera_z_dir(0, 0, 1);
-      tf2::Matrix3x3 camera_rotation_matrix(tf_map2camera.getRotation());
-      camera_z_dir = camera_rotation_matrix * camera_z_dir;
-      double camera_yaw = std::atan2(camera_z_dir.y(), camera_z_dir.x());
-      camera_yaw = tier4_autoware_utils::normalizeRadian(camera_yaw);
-      if (!isInAngleRange(tl_yaw, camera_yaw, max_angle_range)) {
+      if (!isInAngleRange(candidate.yaw, camera_yaw_vec[i], max_angle_range)) {
         continue;
       }
 
       // check within image frame
       // cspell: ignore tltl
-      tf2::Vector3 tf_camera2tltl = tf_map2camera.inverse() * getTrafficLightTopLeft(traffic_light);
-      tf2::Vector3 tf_camera2tlbr =
-        tf_map2camera.inverse() * getTrafficLightBottomRight(traffic_light);
+      tf2::Vector3 tf_camera2tltl = tf_camera2map_vec[i] * candidate.top_left;
+      tf2::Vector3 tf_camera2tlbr = tf_camera2map_vec[i] * candidate.bottom_right;
       if (
         !isInImageFrame(pinhole_camera_model, tf_camera2tltl) &&
         !isInImageFrame(pinhole_camera_model, tf_camera2tlbr)) {
         continue;
       }
-      visible_traffic_lights.push_back(traffic_light);
+      visible_traffic_lights.push_back(candidate.traffic_light);
       break;
     }
   }
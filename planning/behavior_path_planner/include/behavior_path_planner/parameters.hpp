@@ -77,6 +77,7 @@ struct BehaviorPathPlannerParameters
 {
   bool verbose;
   size_t max_iteration_num{100};
+  size_t candidate_module_thread_num{1};
 
   ModuleConfigParameters config_avoidance;
   ModuleConfigParameters config_avoidance_by_lc;
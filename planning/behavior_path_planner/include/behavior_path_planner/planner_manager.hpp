@@ -30,6 +30,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -94,7 +95,9 @@ struct SceneModuleStatus
 class PlannerManager
 {
 public:
-  PlannerManager(rclcpp::Node & node, const size_t max_iteration_num, const bool verbose);
+  PlannerManager(
+    rclcpp::Node & node, const size_t max_iteration_num, const size_t candidate_module_thread_num,
+    const bool verbose);
 
   /**
    * @brief run all candidate and approved modules.
@@ -260,7 +263,10 @@ private:
     const SceneModulePtr & module_ptr, const std::shared_ptr<PlannerData> & planner_data,
     const BehaviorModuleOutput & previous_module_output) const
   {
-    stop_watch_.tic(module_ptr->name());
+    {
+      std::lock_guard<std::mutex> lock(processing_time_mutex_);
+      stop_watch_.tic(module_ptr->name());
+    }
 
     module_ptr->setData(planner_data);
     module_ptr->setPreviousModuleOutput(previous_module_output);
@@ -275,6 +281,7 @@ private:
 
     module_ptr->publishRTCStatus();
 
+    std::lock_guard<std::mutex> lock(processing_time_mutex_);
     processing_time_.at(module_ptr->name()) += stop_watch_.toc(module_ptr->name(), true);
 
     return result;
@@ -439,12 +446,17 @@ private:
 
   mutable std::unordered_map<std::string, double> processing_time_;
 
+  // the request modules may be run concurrently
+  mutable std::mutex processing_time_mutex_;
+
   mutable std::vector<ModuleUpdateInfo> debug_info_;
 
   mutable std::shared_ptr<SceneModuleVisitor> debug_msg_ptr_;
 
   size_t max_iteration_num_{100};
 
+  size_t candidate_module_thread_num_{1};
+
   bool verbose_{false};
 };
 }  // namespace behavior_path_planner
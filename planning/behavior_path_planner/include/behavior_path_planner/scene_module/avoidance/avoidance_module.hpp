@@ -249,10 +249,14 @@ private:
 
   /**
    * @brief fill additional data so that the module judges target objects.
+   * @param avoidance data.
+   * @param predicted object.
+   * @param envelope polygons to be reused in the next cycle.
    * @return object that has additional data.
    */
   ObjectData createObjectData(
-    const AvoidancePlanningData & data, const PredictedObject & object) const;
+    const AvoidancePlanningData & data, const PredictedObject & object,
+    ObjectEnvelopeCacheMap & next_envelope_cache) const;
 
   /**
    * @brief fill additional data so that the module judges target objects.
@@ -606,6 +610,8 @@ private:
 
   mutable ObjectDataArray stopped_objects_;
 
+  mutable ObjectEnvelopeCacheMap envelope_cache_;
+
   mutable DebugData debug_data_;
 
   mutable std::shared_ptr<AvoidanceDebugMsgArray> debug_msg_ptr_;
@@ -164,6 +164,15 @@ public:
   void publishMarker() const
   {
     using tier4_autoware_utils::appendMarkerArray;
+    using tier4_autoware_utils::hasSubscription;
+
+    // the markers are only built when someone looks at them
+    const bool is_info_subscribed = hasSubscription(*pub_info_marker_);
+    const bool is_debug_subscribed = hasSubscription(*pub_debug_marker_);
+    const bool is_drivable_lanes_subscribed = hasSubscription(*pub_drivable_lanes_);
+    if (!is_info_subscribed && !is_debug_subscribed && !is_drivable_lanes_subscribed) {
+      return;
+    }
 
     MarkerArray info_markers{};
     MarkerArray debug_markers{};
@@ -177,33 +186,51 @@ public:
         continue;
       }
 
-      for (auto & marker : m.lock()->getInfoMarkers().markers) {
-        marker.id += marker_id;
-        info_markers.markers.push_back(marker);
+      if (is_info_subscribed) {
+        for (auto & marker : m.lock()->getInfoMarkers().markers) {
+          marker.id += marker_id;
+          info_markers.markers.push_back(marker);
+        }
       }
 
-      for (auto & marker : m.lock()->getDebugMarkers().markers) {
-        marker.id += marker_id;
-        debug_markers.markers.push_back(marker);
+      if (is_debug_subscribed) {
+        for (auto & marker : m.lock()->getDebugMarkers().markers) {
+          marker.id += marker_id;
+          debug_markers.markers.push_back(marker);
+        }
       }
 
-      for (auto & marker : m.lock()->getDrivableLanesMarkers().markers) {
-        marker.id += marker_id;
-        drivable_lanes_markers.markers.push_back(marker);
+      if (is_drivable_lanes_subscribed) {
+        for (auto & marker : m.lock()->getDrivableLanesMarkers().markers) {
+          marker.id += marker_id;
+          drivable_lanes_markers.markers.push_back(marker);
+        }
       }
 
       marker_id += marker_offset;
     }
 
     if (observers_.empty() && idle_module_ptr_ != nullptr) {
-      appendMarkerArray(idle_module_ptr_->getInfoMarkers(), &info_markers);
-      appendMarkerArray(idle_module_ptr_->getDebugMarkers(), &debug_markers);
-      appendMarkerArray(idle_module_ptr_->getDrivableLanesMarkers(), &drivable_lanes_markers);
+      if (is_info_subscribed) {
+        appendMarkerArray(idle_module_ptr_->getInfoMarkers(), &info_markers);
+      }
+      if (is_debug_subscribed) {
+        appendMarkerArray(idle_module_ptr_->getDebugMarkers(), &debug_markers);
+      }
+      if (is_drivable_lanes_subscribed) {
+        appendMarkerArray(idle_module_ptr_->getDrivableLanesMarkers(), &drivable_lanes_markers);
+      }
     }
 
-    pub_info_marker_->publish(info_markers);
-    pub_debug_marker_->publish(debug_markers);
-    pub_drivable_lanes_->publish(drivable_lanes_markers);
+    if (is_info_subscribed) {
+      pub_info_marker_->publish(info_markers);
+    }
+    if (is_debug_subscribed) {
+      pub_debug_marker_->publish(debug_markers);
+    }
+    if (is_drivable_lanes_subscribed) {
+      pub_drivable_lanes_->publish(drivable_lanes_markers);
+    }
   }
 
   bool exist(const SceneModulePtr & module_ptr) const
@@ -243,6 +243,13 @@ struct AvoidanceParameters
   // lost_count and the registered object will be removed when the count exceeds this max count.
   double object_last_seen_threshold{0.0};
 
+  // reuse the envelope polygon of an object while it and the path around it do not move.
+  bool enable_object_envelope_cache{false};
+
+  // the cached envelope polygon is reused while the object pose is within these thresholds.
+  double object_envelope_cache_position_threshold{0.0};
+  double object_envelope_cache_yaw_threshold{0.0};
+
   // The avoidance path generation is performed when the shift distance of the
   // avoidance points is greater than this threshold.
   // In multiple targets case: if there are multiple vehicles in a row to be avoided, no new
@@ -388,6 +395,27 @@ struct ObjectData  // avoidance target
 };
 using ObjectDataArray = std::vector<ObjectData>;
 
+/*
+ * Envelope polygon and overhang of an object computed in the previous cycles
+ */
+struct ObjectEnvelopeCache
+{
+  // object pose and closest path pose the envelope polygon was created for
+  Pose object_pose;
+  Pose closest_pose;
+
+  double distance_factor{0.0};
+
+  Polygon2d envelope_poly{};
+
+  Point2d centroid{};
+
+  double overhang_dist{0.0};
+
+  Pose overhang_pose;
+};
+using ObjectEnvelopeCacheMap = std::unordered_map<std::string, ObjectEnvelopeCache>;
+
 /*
  * Shift point with additional info for avoidance planning
  */
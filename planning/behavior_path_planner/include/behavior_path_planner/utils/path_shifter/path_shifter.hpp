@@ -177,6 +177,24 @@ private:
 
   double longitudinal_acc_{0.0};
 
+  // incremented whenever a different reference path is set
+  size_t reference_path_revision_{0};
+
+  // inputs and result of the last generated path, which is returned while the inputs are the same
+  struct GenerateCache
+  {
+    size_t reference_path_revision{0};
+    ShiftLineArray shift_lines{};
+    double base_offset{0.0};
+    double velocity{0.0};
+    double lateral_acc_limit{0.0};
+    double longitudinal_acc{0.0};
+    bool offset_back{true};
+    SHIFT_TYPE type{SHIFT_TYPE::SPLINE};
+    ShiftedPath shifted_path{};
+  };
+  mutable boost::optional<GenerateCache> generate_cache_{boost::none};
+
   // Logger
   mutable rclcpp::Logger logger_{
     rclcpp::get_logger("behavior_path_planner").get_child("path_shifter")};
@@ -217,6 +235,11 @@ private:
    */
   void applySplineShifter(ShiftedPath * shifted_path, const bool offset_back) const;
 
+  /**
+   * @brief Check if the last generated path was generated from the current inputs.
+   */
+  bool isGenerateCacheValid(const bool offset_back, const SHIFT_TYPE type) const;
+
   ////////////////////////////////////////
   // Helper Functions
   ////////////////////////////////////////
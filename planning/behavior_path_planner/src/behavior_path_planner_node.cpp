@@ -29,6 +29,7 @@
 
 #include <tier4_planning_msgs/msg/path_change_module_id.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -136,7 +137,8 @@ BehaviorPathPlannerNode::BehaviorPathPlannerNode(const rclcpp::NodeOptions & nod
     const std::lock_guard<std::mutex> lock(mutex_manager_);  // for planner_manager_
 
     const auto & p = planner_data_->parameters;
-    planner_manager_ = std::make_shared<PlannerManager>(*this, p.max_iteration_num, p.verbose);
+    planner_manager_ = std::make_shared<PlannerManager>(
+      *this, p.max_iteration_num, p.candidate_module_thread_num, p.verbose);
 
     const auto register_and_create_publisher =
       [&](const auto & manager, const bool create_publishers) {
@@ -277,6 +279,8 @@ BehaviorPathPlannerParameters BehaviorPathPlannerNode::getCommonParam()
 
   p.verbose = declare_parameter<bool>("verbose");
   p.max_iteration_num = declare_parameter<int>("max_iteration_num");
+  p.candidate_module_thread_num =
+    std::max(declare_parameter<int>("candidate_module_thread_num"), 1);
 
   const auto get_scene_module_manager_param = [&](std::string && ns) {
     ModuleConfigParameters config;
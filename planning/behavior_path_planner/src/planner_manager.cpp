@@ -23,16 +23,22 @@
 
 #include <boost/format.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace behavior_path_planner
 {
 PlannerManager::PlannerManager(
-  rclcpp::Node & node, const size_t max_iteration_num, const bool verbose)
+  rclcpp::Node & node, const size_t max_iteration_num, const size_t candidate_module_thread_num,
+  const bool verbose)
 : logger_(node.get_logger().get_child("planner_manager")),
   clock_(*node.get_clock()),
   max_iteration_num_{max_iteration_num},
+  candidate_module_thread_num_{std::max<size_t>(candidate_module_thread_num, 1)},
   verbose_{verbose}
 {
   processing_time_.emplace("total_time", 0.0);
@@ -485,8 +491,27 @@ std::pair<SceneModulePtr, BehaviorModuleOutput> PlannerManager::runRequestModule
       manager_ptr->registerNewModule(
         std::weak_ptr<SceneModuleInterface>(module_ptr), previous_module_output);
     }
+  }
 
-    results.emplace(module_ptr->name(), run(module_ptr, data, previous_module_output));
+  // the modules only share the planner data and the previous module output, which they do not
+  // modify, so that they can be run concurrently
+  std::vector<BehaviorModuleOutput> outputs(executable_modules.size());
+  std::atomic<size_t> next_module_idx{0};
+  const auto work = [&]() {
+    for (auto idx = next_module_idx++; idx < executable_modules.size(); idx = next_module_idx++) {
+      outputs.at(idx) = run(executable_modules.at(idx), data, previous_module_output);
+    }
+  };
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < std::min(candidate_module_thread_num_, executable_modules.size()); ++i) {
+    workers.emplace_back(work);
+  }
+  work();
+  for (auto & worker : workers) {
+    worker.join();
+  }
+  for (size_t idx = 0; idx < executable_modules.size(); ++idx) {
+    results.emplace(executable_modules.at(idx)->name(), outputs.at(idx));
   }
 
   /**
@@ -331,10 +331,13 @@ void AvoidanceModule::fillAvoidanceTargetObjects(
     data.other_objects.push_back(other_object);
   }
 
+  // the objects which are not observed in this cycle are removed from the cache.
+  ObjectEnvelopeCacheMap next_envelope_cache;
   ObjectDataArray objects;
   for (const auto & object : object_within_target_lane.objects) {
-    objects.push_back(createObjectData(data, object));
+    objects.push_back(createObjectData(data, object, next_envelope_cache));
   }
+  envelope_cache_ = std::move(next_envelope_cache);
 
   // Filter out the objects to determine the ones to be avoided.
   filterTargetObjects(objects, data, debug, planner_data_, parameters_);
@@ -368,7 +371,8 @@ void AvoidanceModule::fillAvoidanceTargetObjects(
 }
 
 ObjectData AvoidanceModule::createObjectData(
-  const AvoidancePlanningData & data, const PredictedObject & object) const
+  const AvoidancePlanningData & data, const PredictedObject & object,
+  ObjectEnvelopeCacheMap & next_envelope_cache) const
 {
   using boost::geometry::return_centroid;
 
@@ -389,12 +393,49 @@ ObjectData AvoidanceModule::createObjectData(
     std::clamp(calcDistance2d(getEgoPose(), object_pose) - lower, 0.0, upper) / upper;
   object_data.distance_factor = object_parameter.max_expand_ratio * clamp + 1.0;
 
-  // Calc envelop polygon.
-  utils::avoidance::fillObjectEnvelopePolygon(
-    object_data, registered_objects_, object_closest_pose, parameters_);
+  // Reuse the envelope polygon if neither the object nor the path around it has moved.
+  const auto id = toHexString(object.object_id);
+  const auto cache = envelope_cache_.find(id);
+  const auto is_cache_valid = [&]() {
+    if (!parameters_->enable_object_envelope_cache || cache == envelope_cache_.end()) {
+      return false;
+    }
+    constexpr double epsilon = 1e-3;
+    const auto & c = cache->second;
+    const auto yaw_diff = tier4_autoware_utils::normalizeRadian(
+      tf2::getYaw(object_pose.orientation) - tf2::getYaw(c.object_pose.orientation));
+    return calcDistance2d(c.object_pose, object_pose) <
+             parameters_->object_envelope_cache_position_threshold &&
+           std::abs(yaw_diff) < parameters_->object_envelope_cache_yaw_threshold &&
+           calcDistance2d(c.closest_pose, object_closest_pose) < epsilon &&
+           std::abs(c.distance_factor - object_data.distance_factor) < epsilon;
+  };
+
+  if (is_cache_valid()) {
+    const auto & c = cache->second;
+    object_data.envelope_poly = c.envelope_poly;
+    object_data.centroid = c.centroid;
+    object_data.overhang_dist = c.overhang_dist;
+    object_data.overhang_pose = c.overhang_pose;
+    next_envelope_cache.emplace(id, c);
+  } else {
+    // Calc envelop polygon.
+    utils::avoidance::fillObjectEnvelopePolygon(
+      object_data, registered_objects_, object_closest_pose, parameters_);
 
-  // calc object centroid.
-  object_data.centroid = return_centroid<Point2d>(object_data.envelope_poly);
+    // calc object centroid.
+    object_data.centroid = return_centroid<Point2d>(object_data.envelope_poly);
+
+    // Find the footprint point closest to the path, set to object_data.overhang_distance.
+    object_data.overhang_dist = utils::avoidance::calcEnvelopeOverhangDistance(
+      object_data, data.reference_path, object_data.overhang_pose.position);
+
+    next_envelope_cache.emplace(
+      id, ObjectEnvelopeCache{
+            object_pose, object_closest_pose, object_data.distance_factor,
+            object_data.envelope_poly, object_data.centroid, object_data.overhang_dist,
+            object_data.overhang_pose});
+  }
 
   // Calc moving time.
   utils::avoidance::fillObjectMovingTime(object_data, stopped_objects_, parameters_);
@@ -402,10 +443,6 @@ ObjectData AvoidanceModule::createObjectData(
   // Calc lateral deviation from path to target object.
   object_data.lateral = calcLateralDeviation(object_closest_pose, object_pose.position);
 
-  // Find the footprint point closest to the path, set to object_data.overhang_distance.
-  object_data.overhang_dist = utils::avoidance::calcEnvelopeOverhangDistance(
-    object_data, data.reference_path, object_data.overhang_pose.position);
-
   // Check whether the the ego should avoid the object.
   const auto & vehicle_width = planner_data_->parameters.vehicle_width;
   utils::avoidance::fillAvoidanceNecessity(
@@ -126,6 +126,15 @@ AvoidanceModuleManager::AvoidanceModuleManager(
       getOrDeclareParameter<double>(*node, ns + "object_last_seen_threshold");
   }
 
+  {
+    std::string ns = "avoidance.target_filtering.envelope_cache.";
+    p.enable_object_envelope_cache = getOrDeclareParameter<bool>(*node, ns + "enable");
+    p.object_envelope_cache_position_threshold =
+      getOrDeclareParameter<double>(*node, ns + "position_threshold");
+    p.object_envelope_cache_yaw_threshold =
+      getOrDeclareParameter<double>(*node, ns + "yaw_threshold");
+  }
+
   {
     std::string ns = "avoidance.target_filtering.detection_area.";
     p.use_static_detection_area = getOrDeclareParameter<bool>(*node, ns + "static");
@@ -34,6 +34,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -159,35 +160,63 @@ void GoalPlannerModule::onTimer()
   std::vector<PullOverPath> path_candidates{};
   std::optional<Pose> closest_start_pose{};
   double min_start_arc_length = std::numeric_limits<double>::max();
-  const auto planCandidatePaths = [&](
-                                    const std::shared_ptr<PullOverPlannerBase> & planner,
-                                    const GoalCandidate & goal_candidate) {
+
+  // each planner plans for all the goal candidates on its own thread since a planner keeps its
+  // intermediate results in its members, and the paths are collected in the priority order
+  std::vector<std::vector<boost::optional<PullOverPath>>> pull_over_paths(
+    pull_over_planners_.size(), std::vector<boost::optional<PullOverPath>>(goal_candidates.size()));
+  const auto planCandidatePaths = [&](const size_t planner_idx) {
+    const auto & planner = pull_over_planners_.at(planner_idx);
     planner->setPlannerData(planner_data_);
-    auto pull_over_path = planner->plan(goal_candidate.goal_pose);
-    if (pull_over_path && isCrossingPossible(*pull_over_path)) {
-      pull_over_path->goal_id = goal_candidate.id;
-      path_candidates.push_back(*pull_over_path);
-      // calculate closest pull over start pose for stop path
-      const double start_arc_length =
-        lanelet::utils::getArcCoordinates(current_lanes, pull_over_path->start_pose).length;
-      if (start_arc_length < min_start_arc_length) {
-        min_start_arc_length = start_arc_length;
-        // closest start pose is stop point when not finding safe path
-        closest_start_pose = pull_over_path->start_pose;
+    for (size_t goal_idx = 0; goal_idx < goal_candidates.size(); ++goal_idx) {
+      auto pull_over_path = planner->plan(goal_candidates.at(goal_idx).goal_pose);
+      if (pull_over_path && isCrossingPossible(*pull_over_path)) {
+        pull_over_paths.at(planner_idx).at(goal_idx) = pull_over_path;
       }
     }
   };
-  // plan candidate paths and set them to the member variable
+  if (parameters_->enable_parallel_planning) {
+    std::vector<std::thread> workers;
+    for (size_t planner_idx = 1; planner_idx < pull_over_planners_.size(); ++planner_idx) {
+      workers.emplace_back(planCandidatePaths, planner_idx);
+    }
+    planCandidatePaths(0);
+    for (auto & worker : workers) {
+      worker.join();
+    }
+  } else {
+    for (size_t planner_idx = 0; planner_idx < pull_over_planners_.size(); ++planner_idx) {
+      planCandidatePaths(planner_idx);
+    }
+  }
+
+  const auto addCandidatePath = [&](const size_t planner_idx, const size_t goal_idx) {
+    auto & pull_over_path = pull_over_paths.at(planner_idx).at(goal_idx);
+    if (!pull_over_path) {
+      return;
+    }
+    pull_over_path->goal_id = goal_candidates.at(goal_idx).id;
+    path_candidates.push_back(*pull_over_path);
+    // calculate closest pull over start pose for stop path
+    const double start_arc_length =
+      lanelet::utils::getArcCoordinates(current_lanes, pull_over_path->start_pose).length;
+    if (start_arc_length < min_start_arc_length) {
+      min_start_arc_length = start_arc_length;
+      // closest start pose is stop point when not finding safe path
+      closest_start_pose = pull_over_path->start_pose;
+    }
+  };
+  // set the candidate paths to the member variable in the order of the priority
   if (parameters_->path_priority == "efficient_path") {
-    for (const auto & planner : pull_over_planners_) {
-      for (const auto & goal_candidate : goal_candidates) {
-        planCandidatePaths(planner, goal_candidate);
+    for (size_t planner_idx = 0; planner_idx < pull_over_planners_.size(); ++planner_idx) {
+      for (size_t goal_idx = 0; goal_idx < goal_candidates.size(); ++goal_idx) {
+        addCandidatePath(planner_idx, goal_idx);
       }
     }
   } else if (parameters_->path_priority == "close_goal") {
-    for (const auto & goal_candidate : goal_candidates) {
-      for (const auto & planner : pull_over_planners_) {
-        planCandidatePaths(planner, goal_candidate);
+    for (size_t goal_idx = 0; goal_idx < goal_candidates.size(); ++goal_idx) {
+      for (size_t planner_idx = 0; planner_idx < pull_over_planners_.size(); ++planner_idx) {
+        addCandidatePath(planner_idx, goal_idx);
       }
     }
   } else {
@@ -116,6 +116,7 @@ GoalPlannerModuleManager::GoalPlannerModuleManager(
     p.path_priority = node->declare_parameter<std::string>(ns + "path_priority");
     p.efficient_path_order =
       node->declare_parameter<std::vector<std::string>>(ns + "efficient_path_order");
+    p.enable_parallel_planning = node->declare_parameter<bool>(ns + "enable_parallel_planning");
   }
 
   // shift parking
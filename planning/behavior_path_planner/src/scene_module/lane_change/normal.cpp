@@ -1092,6 +1092,20 @@ bool NormalLaneChange::getLaneChangePaths(
 
   const auto prepare_durations = calcPrepareDuration(current_lanes, target_lanes);
 
+  // the values below do not depend on the candidate, so they are computed once for all of them
+  const auto target_lane_polygon =
+    lanelet::utils::getPolygonFromArcLength(target_lanes, 0, std::numeric_limits<double>::max());
+  const auto target_lane_poly_2d = lanelet::utils::to2D(target_lane_polygon).basicPolygon();
+
+  const double s_goal =
+    is_goal_in_route
+      ? lanelet::utils::getArcCoordinates(target_lanes, route_handler.getGoalPose()).length
+      : 0.0;
+  const double backward_buffer =
+    std::abs(route_handler.getNumLaneToPreferredLane(target_lanes.back(), direction)) == 0
+      ? 0.0
+      : common_parameters.backward_length_buffer_for_end_of_lane;
+
   candidate_paths->reserve(
     longitudinal_acc_sampling_values.size() * lateral_acc_sampling_num * prepare_durations.size());
 
@@ -1142,6 +1156,26 @@ bool NormalLaneChange::getLaneChangePaths(
       const auto shift_length =
         lanelet::utils::getLateralDistanceToClosestLanelet(target_lanes, lane_changing_start_pose);
 
+      // the start point is shared by all the lateral accelerations, so check it before sampling
+      const lanelet::BasicPoint2d lc_start_point(
+        lane_changing_start_pose.position.x, lane_changing_start_pose.position.y);
+
+      const auto is_valid_start_point =
+        boost::geometry::covered_by(lc_start_point, target_neighbor_preferred_lane_poly_2d) ||
+        boost::geometry::covered_by(lc_start_point, target_lane_poly_2d);
+
+      if (!is_valid_start_point) {
+        debug_print(
+          "Reject: lane changing points are not inside of the target preferred lanes or its "
+          "neighbors");
+        continue;
+      }
+
+      const double s_start =
+        is_goal_in_route
+          ? lanelet::utils::getArcCoordinates(target_lanes, lane_changing_start_pose).length
+          : 0.0;
+
       const auto initial_lane_changing_velocity = prepare_velocity;
       const auto max_path_velocity = prepare_segment.points.back().point.longitudinal_velocity_mps;
 
@@ -1185,14 +1219,6 @@ bool NormalLaneChange::getLaneChangePaths(
         }
 
         if (is_goal_in_route) {
-          const double s_start =
-            lanelet::utils::getArcCoordinates(target_lanes, lane_changing_start_pose).length;
-          const double s_goal =
-            lanelet::utils::getArcCoordinates(target_lanes, route_handler.getGoalPose()).length;
-          const auto num =
-            std::abs(route_handler.getNumLaneToPreferredLane(target_lanes.back(), direction));
-          const double backward_buffer =
-            num == 0 ? 0.0 : common_parameters.backward_length_buffer_for_end_of_lane;
           const double finish_judge_buffer = common_parameters.lane_change_finish_judge_buffer;
           if (
             s_start + lane_changing_length + finish_judge_buffer + backward_buffer +
@@ -1212,25 +1238,6 @@ bool NormalLaneChange::getLaneChangePaths(
           continue;
         }
 
-        const lanelet::BasicPoint2d lc_start_point(
-          prepare_segment.points.back().point.pose.position.x,
-          prepare_segment.points.back().point.pose.position.y);
-
-        const auto target_lane_polygon = lanelet::utils::getPolygonFromArcLength(
-          target_lanes, 0, std::numeric_limits<double>::max());
-        const auto target_lane_poly_2d = lanelet::utils::to2D(target_lane_polygon).basicPolygon();
-
-        const auto is_valid_start_point =
-          boost::geometry::covered_by(lc_start_point, target_neighbor_preferred_lane_poly_2d) ||
-          boost::geometry::covered_by(lc_start_point, target_lane_poly_2d);
-
-        if (!is_valid_start_point) {
-          debug_print(
-            "Reject: lane changing points are not inside of the target preferred lanes or its "
-            "neighbors");
-          continue;
-        }
-
         const auto resample_interval = utils::lane_change::calcLaneChangeResampleInterval(
           lane_changing_length, initial_lane_changing_velocity);
         const auto target_lane_reference_path = utils::lane_change::getReferencePathFromTargetLane(
@@ -90,12 +90,13 @@ void reuse_previous_poses(
     const auto max_path_arc_length = motion_utils::calcArcLength(path.points);
     const auto first_arc_length = motion_utils::calcSignedArcLength(
       path.points, path.points.front().point.pose.position, cropped_poses.back().position);
+    motion_utils::InterpolatedPoseCursor pose_cursor(path.points);
     for (auto arc_length = first_arc_length + params.resample_interval;
          (params.max_path_arc_length <= 0.0 ||
           initial_arc_length + (arc_length - first_arc_length) <= params.max_path_arc_length) &&
          arc_length <= max_path_arc_length;
          arc_length += params.resample_interval)
-      cropped_poses.push_back(motion_utils::calcInterpolatedPose(path.points, arc_length));
+      cropped_poses.push_back(pose_cursor.calcInterpolatedPose(arc_length));
   }
   prev_poses = motion_utils::removeOverlapPoints(cropped_poses);
   prev_curvatures = cropped_curvatures;
@@ -786,13 +786,14 @@ std::vector<PoseWithVelocityStamped> convertToPredictedPath(
     convertToFrenetPoint(path.points, vehicle_pose.position, nearest_seg_idx);
   const double initial_velocity = std::abs(vehicle_twist.linear.x);
 
+  motion_utils::InterpolatedPoseCursor pose_cursor(path.points);
+
   // prepare segment
   for (double t = 0.0; t < prepare_time; t += resolution) {
     const double velocity =
       std::max(initial_velocity + prepare_acc * t, minimum_lane_changing_velocity);
     const double length = initial_velocity * t + 0.5 * prepare_acc * t * t;
-    const auto pose =
-      motion_utils::calcInterpolatedPose(path.points, vehicle_pose_frenet.length + length);
+    const auto pose = pose_cursor.calcInterpolatedPose(vehicle_pose_frenet.length + length);
     predicted_path.emplace_back(t, pose, velocity);
   }
 
@@ -806,8 +807,7 @@ std::vector<PoseWithVelocityStamped> convertToPredictedPath(
     const double velocity = lane_changing_velocity + lane_changing_acc * delta_t;
     const double length =
       lane_changing_velocity * delta_t + 0.5 * lane_changing_acc * delta_t * delta_t + offset;
-    const auto pose =
-      motion_utils::calcInterpolatedPose(path.points, vehicle_pose_frenet.length + length);
+    const auto pose = pose_cursor.calcInterpolatedPose(vehicle_pose_frenet.length + length);
     predicted_path.emplace_back(t, pose, velocity);
   }
 
@@ -234,6 +234,7 @@ std::vector<PoseWithVelocityStamped> createPredictedPath(
   const auto vehicle_pose_frenet =
     convertToFrenetPoint(path_points, vehicle_pose.position, ego_seg_idx);
 
+  motion_utils::InterpolatedPoseCursor pose_cursor(path_points);
   for (double t = 0.0; t < time_horizon; t += time_resolution) {
     double velocity = 0.0;
     double length = 0.0;
@@ -248,8 +249,7 @@ std::vector<PoseWithVelocityStamped> createPredictedPath(
       length = current_velocity * t_with_delay + 0.5 * acceleration * t_with_delay * t_with_delay;
     }
 
-    const auto pose =
-      motion_utils::calcInterpolatedPose(path_points, vehicle_pose_frenet.length + length);
+    const auto pose = pose_cursor.calcInterpolatedPose(vehicle_pose_frenet.length + length);
     predicted_path.emplace_back(t, pose, velocity);
   }
 
@@ -22,6 +22,8 @@
 #include <boost/geometry/algorithms/overlaps.hpp>
 #include <boost/geometry/strategies/strategies.hpp>
 
+#include <cmath>
+
 namespace behavior_path_planner::utils::path_safety_checker
 {
 
@@ -225,6 +227,14 @@ double calcMinimumLongitudinalLength(
 
 boost::optional<PoseWithVelocityStamped> calcInterpolatedPoseWithVelocity(
   const std::vector<PoseWithVelocityStamped> & path, const double relative_time)
+{
+  size_t start_idx = 1;
+  return calcInterpolatedPoseWithVelocity(path, relative_time, start_idx);
+}
+
+boost::optional<PoseWithVelocityStamped> calcInterpolatedPoseWithVelocity(
+  const std::vector<PoseWithVelocityStamped> & path, const double relative_time,
+  size_t & start_idx)
 {
   // Check if relative time is in the valid range
   if (path.empty() || relative_time < 0.0) {
@@ -232,7 +242,8 @@ boost::optional<PoseWithVelocityStamped> calcInterpolatedPoseWithVelocity(
   }
 
   constexpr double epsilon = 1e-6;
-  for (size_t path_idx = 1; path_idx < path.size(); ++path_idx) {
+  for (size_t path_idx = std::max<size_t>(start_idx, 1); path_idx < path.size(); ++path_idx) {
+    start_idx = path_idx;
     const auto & pt = path.at(path_idx);
     const auto & prev_pt = path.at(path_idx - 1);
     if (relative_time < pt.time + epsilon) {
@@ -254,7 +265,17 @@ boost::optional<PoseWithVelocityAndPolygonStamped> getInterpolatedPoseWithVeloci
   const std::vector<PoseWithVelocityStamped> & pred_path, const double current_time,
   const VehicleInfo & ego_info)
 {
-  const auto interpolation_result = calcInterpolatedPoseWithVelocity(pred_path, current_time);
+  size_t start_idx = 1;
+  return getInterpolatedPoseWithVelocityAndPolygonStamped(
+    pred_path, current_time, ego_info, start_idx);
+}
+
+boost::optional<PoseWithVelocityAndPolygonStamped> getInterpolatedPoseWithVelocityAndPolygonStamped(
+  const std::vector<PoseWithVelocityStamped> & pred_path, const double current_time,
+  const VehicleInfo & ego_info, size_t & start_idx)
+{
+  const auto interpolation_result =
+    calcInterpolatedPoseWithVelocity(pred_path, current_time, start_idx);
 
   if (!interpolation_result) {
     return {};
@@ -301,6 +322,13 @@ std::vector<Polygon2d> getCollidedPolygons(
     debug.current_obj_pose = target_object.initial_pose.pose;
   }
 
+  const auto & ego_vehicle_info = common_parameters.vehicle_info;
+  const double ego_radius = std::hypot(
+    std::max(ego_vehicle_info.max_longitudinal_offset_m, ego_vehicle_info.rear_overhang_m),
+    ego_vehicle_info.vehicle_width_m / 2.0);
+
+  // the time of the object path is ascending, so the ego path is searched from the last segment
+  size_t ego_path_idx = 1;
   std::vector<Polygon2d> collided_polygons{};
   collided_polygons.reserve(target_object_path.path.size());
   for (const auto & obj_pose_with_poly : target_object_path.path) {
@@ -314,9 +342,8 @@ std::vector<Polygon2d> getCollidedPolygons(
     // get ego information at current time
     // Note: we can create these polygons in advance. However, it can decrease the readability and
     // variability
-    const auto & ego_vehicle_info = common_parameters.vehicle_info;
     const auto interpolated_data = getInterpolatedPoseWithVelocityAndPolygonStamped(
-      predicted_ego_path, current_time, ego_vehicle_info);
+      predicted_ego_path, current_time, ego_vehicle_info, ego_path_idx);
     if (!interpolated_data) {
       continue;
     }
@@ -324,8 +351,18 @@ std::vector<Polygon2d> getCollidedPolygons(
     const auto & ego_polygon = interpolated_data->poly;
     const auto & ego_velocity = interpolated_data->velocity;
 
+    // polygons farther apart than the sum of their radii around the poses can not overlap
+    double obj_radius = 0.0;
+    for (const auto & p : obj_polygon.outer()) {
+      obj_radius = std::max(
+        obj_radius, std::hypot(p.x() - obj_pose.position.x, p.y() - obj_pose.position.y));
+    }
+    const double distance = tier4_autoware_utils::calcDistance2d(ego_pose, obj_pose);
+
     // check overlap
-    if (boost::geometry::overlaps(ego_polygon, obj_polygon)) {
+    if (
+      distance <= ego_radius + obj_radius &&
+      boost::geometry::overlaps(ego_polygon, obj_polygon)) {
       debug.unsafe_reason = "overlap_polygon";
       collided_polygons.push_back(obj_polygon);
 
@@ -354,6 +391,18 @@ std::vector<Polygon2d> getCollidedPolygons(
     const auto & lat_margin = rss_parameters.lateral_distance_max_threshold * hysteresis_factor;
     // TODO(watanabe) fix hard coding value
     const bool is_stopped_object = object_velocity < 0.3;
+
+    // the extended polygons are bounded by the radii extended by the offsets. the extended
+    // object polygon is built from the bounding box of the object in its own frame.
+    constexpr double radius_margin = 1e-3;
+    const double extension = lon_offset + lat_margin + radius_margin;
+    const double max_distance =
+      is_object_front ? ego_radius + extension + obj_radius
+                      : ego_radius + std::sqrt(2.0) * obj_radius + extension;
+    if (distance > max_distance) {
+      continue;
+    }
+
     const auto & extended_ego_polygon = is_object_front ? createExtendedPolygon(
                                                             ego_pose, ego_vehicle_info, lon_offset,
                                                             lat_margin, is_stopped_object, debug)
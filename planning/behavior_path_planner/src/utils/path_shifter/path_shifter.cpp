@@ -20,6 +20,7 @@
 #include <lanelet2_extension/utility/utilities.hpp>
 #include <motion_utils/trajectory/path_with_lane_id.hpp>
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <vector>
@@ -38,6 +39,15 @@ std::string toStr(const behavior_path_planner::ShiftLine & p)
          ", end idx = " + std::to_string(p.end_idx) +
          ", length = " + std::to_string(p.end_shift_length);
 }
+bool isSameShiftLines(
+  const behavior_path_planner::ShiftLineArray & a, const behavior_path_planner::ShiftLineArray & b)
+{
+  return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const auto & l, const auto & r) {
+    return l.start == r.start && l.end == r.end && l.start_shift_length == r.start_shift_length &&
+           l.end_shift_length == r.end_shift_length && l.start_idx == r.start_idx &&
+           l.end_idx == r.end_idx;
+  });
+}
 std::string toStr(const std::vector<double> & v)
 {
   std::stringstream ss;
@@ -58,6 +68,9 @@ using motion_utils::removeOverlapPoints;
 
 void PathShifter::setPath(const PathWithLaneId & path)
 {
+  if (path != reference_path_) {
+    ++reference_path_revision_;
+  }
   reference_path_ = path;
 
   updateShiftLinesIndices(shift_lines_);
@@ -142,6 +155,11 @@ bool PathShifter::generate(
     }
   }
 
+  if (isGenerateCacheValid(offset_back, type)) {
+    *shifted_path = generate_cache_->shifted_path;
+    return true;
+  }
+
   // Calculate shifted path
   type == SHIFT_TYPE::SPLINE ? applySplineShifter(shifted_path, offset_back)
                              : applyLinearShifter(shifted_path);
@@ -164,9 +182,26 @@ bool PathShifter::generate(
     logger_, clock_, 3000,
     "PathShifter::generate end. shift_lines_.size = " << shift_lines_.size());
 
+  generate_cache_ = GenerateCache{reference_path_revision_, shift_lines_, base_offset_,
+                                  velocity_, lateral_acc_limit_, longitudinal_acc_,
+                                  offset_back, type, *shifted_path};
+
   return true;
 }
 
+bool PathShifter::isGenerateCacheValid(const bool offset_back, const SHIFT_TYPE type) const
+{
+  if (!generate_cache_) {
+    return false;
+  }
+
+  const auto & c = *generate_cache_;
+  return c.reference_path_revision == reference_path_revision_ && c.base_offset == base_offset_ &&
+         c.velocity == velocity_ && c.lateral_acc_limit == lateral_acc_limit_ &&
+         c.longitudinal_acc == longitudinal_acc_ && c.offset_back == offset_back &&
+         c.type == type && isSameShiftLines(c.shift_lines, shift_lines_);
+}
+
 void PathShifter::applyLinearShifter(ShiftedPath * shifted_path) const
 {
   const auto arclength_arr = utils::calcPathArcLengthArray(reference_path_);
@@ -33,9 +33,13 @@
 #include <lanelet2_routing/RoutingGraphContainer.h>
 
 #include <algorithm>
+#include <functional>
 #include <limits>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace
@@ -1362,6 +1366,102 @@ geometry_msgs::msg::Point calcLongitudinalOffsetGoalPoint(
   return offset_point ? offset_point.get() : points.at(nearest_segment_idx + 1);
 }
 
+namespace
+{
+struct DrivableBoundKey
+{
+  const lanelet::LaneletMap * lanelet_map{nullptr};
+  lanelet::Id goal_lanelet_id{lanelet::InvalId};
+  bool enable_expanding_hatched_road_markings{false};
+  bool enable_expanding_intersection_areas{false};
+  double vehicle_length{0.0};
+  std::vector<lanelet::Id> lanelet_ids{};
+  std::vector<std::string> intersection_areas{};
+  std::vector<size_t> bound_sizes{};
+  // the points are held so that their data are not reused by other points while cached
+  std::vector<lanelet::ConstPoint3d> points{};
+
+  bool operator==(const DrivableBoundKey & other) const
+  {
+    return lanelet_map == other.lanelet_map && goal_lanelet_id == other.goal_lanelet_id &&
+           enable_expanding_hatched_road_markings ==
+             other.enable_expanding_hatched_road_markings &&
+           enable_expanding_intersection_areas == other.enable_expanding_intersection_areas &&
+           vehicle_length == other.vehicle_length && lanelet_ids == other.lanelet_ids &&
+           intersection_areas == other.intersection_areas && bound_sizes == other.bound_sizes &&
+           std::equal(
+             points.begin(), points.end(), other.points.begin(), other.points.end(),
+             [](const auto & a, const auto & b) { return a.constData() == b.constData(); });
+  }
+};
+
+// the drivable lanes are often regenerated every cycle, e.g. by cutOverlappedLanes(), so the key
+// holds the points of their bounds instead of the lanelets themselves
+DrivableBoundKey createDrivableBoundKey(
+  const std::shared_ptr<RouteHandler> & route_handler, const std::vector<DrivableLanes> & lanes,
+  const bool enable_expanding_hatched_road_markings, const bool enable_expanding_intersection_areas,
+  const double vehicle_length)
+{
+  DrivableBoundKey key;
+  key.lanelet_map = route_handler->getLaneletMapPtr().get();
+  lanelet::ConstLanelet goal_lanelet;
+  if (route_handler->getGoalLanelet(&goal_lanelet)) {
+    key.goal_lanelet_id = goal_lanelet.id();
+  }
+  key.enable_expanding_hatched_road_markings = enable_expanding_hatched_road_markings;
+  key.enable_expanding_intersection_areas = enable_expanding_intersection_areas;
+  key.vehicle_length = vehicle_length;
+
+  const auto add_lanelet = [&key](const lanelet::ConstLanelet & lanelet) {
+    key.lanelet_ids.push_back(lanelet.id());
+    key.intersection_areas.push_back(lanelet.attributeOr("intersection_area", "else"));
+    for (const auto & bound : {lanelet.leftBound3d(), lanelet.rightBound3d()}) {
+      key.bound_sizes.push_back(bound.size());
+      key.points.insert(key.points.end(), bound.begin(), bound.end());
+    }
+  };
+  for (const auto & lane : lanes) {
+    add_lanelet(lane.left_lane);
+    add_lanelet(lane.right_lane);
+    for (const auto & middle_lane : lane.middle_lanes) {
+      add_lanelet(middle_lane);
+    }
+  }
+  return key;
+}
+
+// the drivable lanes of most cycles are the same as the previous ones, so the bounds generated
+// from them are reused. the modules may run concurrently, so the cache is guarded by a mutex
+std::pair<std::vector<Point>, std::vector<Point>> getCachedDrivableBounds(
+  const DrivableBoundKey & key,
+  const std::function<std::pair<std::vector<Point>, std::vector<Point>>()> & calc_bounds)
+{
+  constexpr size_t max_cache_size = 16;
+  static std::mutex mutex;
+  static std::list<std::pair<DrivableBoundKey, std::pair<std::vector<Point>, std::vector<Point>>>>
+    cache;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto itr =
+      std::find_if(cache.begin(), cache.end(), [&key](const auto & c) { return c.first == key; });
+    if (itr != cache.end()) {
+      cache.splice(cache.begin(), cache, itr);
+      return cache.front().second;
+    }
+  }
+
+  auto bounds = calc_bounds();
+
+  std::lock_guard<std::mutex> lock(mutex);
+  cache.emplace_front(key, bounds);
+  if (cache.size() > max_cache_size) {
+    cache.pop_back();
+  }
+  return bounds;
+}
+}  // namespace
+
 void generateDrivableArea(
   PathWithLaneId & path, const std::vector<DrivableLanes> & lanes,
   const bool enable_expanding_hatched_road_markings, const bool enable_expanding_intersection_areas,
@@ -1405,12 +1505,62 @@ void generateDrivableArea(
     };
 
   // Insert Position
-  auto left_bound = calcBound(
-    route_handler, lanes, enable_expanding_hatched_road_markings,
-    enable_expanding_intersection_areas, true);
-  auto right_bound = calcBound(
-    route_handler, lanes, enable_expanding_hatched_road_markings,
-    enable_expanding_intersection_areas, false);
+  const auto calc_bounds = [&]() {
+    auto left_bound = calcBound(
+      route_handler, lanes, enable_expanding_hatched_road_markings,
+      enable_expanding_intersection_areas, true);
+    auto right_bound = calcBound(
+      route_handler, lanes, enable_expanding_hatched_road_markings,
+      enable_expanding_intersection_areas, false);
+
+    if (left_bound.empty() || right_bound.empty()) {
+      return std::make_pair(left_bound, right_bound);
+    }
+
+    // Insert points after goal
+    lanelet::ConstLanelet goal_lanelet;
+    if (
+      route_handler->getGoalLanelet(&goal_lanelet) &&
+      checkHasSameLane(transformed_lanes, goal_lanelet)) {
+      const auto lanes_after_goal = route_handler->getLanesAfterGoal(vehicle_length);
+      const auto next_lanes_after_goal = route_handler->getNextLanelets(goal_lanelet);
+      const auto goal_left_lanelet = route_handler->getLeftLanelet(goal_lanelet);
+      const auto goal_right_lanelet = route_handler->getRightLanelet(goal_lanelet);
+      lanelet::ConstLanelets goal_lanelets = {goal_lanelet};
+      if (goal_left_lanelet) {
+        goal_lanelets.push_back(*goal_left_lanelet);
+      }
+      if (goal_right_lanelet) {
+        goal_lanelets.push_back(*goal_right_lanelet);
+      }
+
+      for (const auto & lane : lanes_after_goal) {
+        // If lane is already in the transformed lanes, ignore it
+        if (checkHasSameLane(transformed_lanes, lane)) {
+          continue;
+        }
+        // Check if overlapped
+        const bool is_overlapped =
+          (checkHasSameLane(next_lanes_after_goal, lane) ? has_overlap(lane, goal_lanelets)
+                                                         : has_overlap(lane));
+        if (is_overlapped) {
+          continue;
+        }
+
+        addPoints(lane.leftBound3d(), left_bound);
+        addPoints(lane.rightBound3d(), right_bound);
+      }
+    }
+
+    return std::make_pair(left_bound, right_bound);
+  };
+  auto bounds = getCachedDrivableBounds(
+    createDrivableBoundKey(
+      route_handler, lanes, enable_expanding_hatched_road_markings,
+      enable_expanding_intersection_areas, vehicle_length),
+    calc_bounds);
+  auto & left_bound = bounds.first;
+  auto & right_bound = bounds.second;
 
   if (left_bound.empty() || right_bound.empty()) {
     auto clock{rclcpp::Clock{RCL_ROS_TIME}};
@@ -1420,41 +1570,6 @@ void generateDrivableArea(
     return;
   }
 
-  // Insert points after goal
-  lanelet::ConstLanelet goal_lanelet;
-  if (
-    route_handler->getGoalLanelet(&goal_lanelet) &&
-    checkHasSameLane(transformed_lanes, goal_lanelet)) {
-    const auto lanes_after_goal = route_handler->getLanesAfterGoal(vehicle_length);
-    const auto next_lanes_after_goal = route_handler->getNextLanelets(goal_lanelet);
-    const auto goal_left_lanelet = route_handler->getLeftLanelet(goal_lanelet);
-    const auto goal_right_lanelet = route_handler->getRightLanelet(goal_lanelet);
-    lanelet::ConstLanelets goal_lanelets = {goal_lanelet};
-    if (goal_left_lanelet) {
-      goal_lanelets.push_back(*goal_left_lanelet);
-    }
-    if (goal_right_lanelet) {
-      goal_lanelets.push_back(*goal_right_lanelet);
-    }
-
-    for (const auto & lane : lanes_after_goal) {
-      // If lane is already in the transformed lanes, ignore it
-      if (checkHasSameLane(transformed_lanes, lane)) {
-        continue;
-      }
-      // Check if overlapped
-      const bool is_overlapped =
-        (checkHasSameLane(next_lanes_after_goal, lane) ? has_overlap(lane, goal_lanelets)
-                                                       : has_overlap(lane));
-      if (is_overlapped) {
-        continue;
-      }
-
-      addPoints(lane.leftBound3d(), left_bound);
-      addPoints(lane.rightBound3d(), right_bound);
-    }
-  }
-
   if (!is_driving_forward) {
     std::reverse(left_bound.begin(), left_bound.end());
     std::reverse(right_bound.begin(), right_bound.end());
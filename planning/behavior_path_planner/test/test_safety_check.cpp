@@ -201,3 +201,30 @@ TEST(BehaviorPathPlanningSafetyUtilsTest, calcRssDistance)
     EXPECT_NEAR(calcRssDistance(front_vel, rear_vel, params), 63.75, epsilon);
   }
 }
+
+TEST(BehaviorPathPlanningSafetyUtilsTest, calcInterpolatedPoseWithVelocity)
+{
+  using behavior_path_planner::utils::path_safety_checker::calcInterpolatedPoseWithVelocity;
+  using behavior_path_planner::utils::path_safety_checker::PoseWithVelocityStamped;
+
+  std::vector<PoseWithVelocityStamped> path;
+  for (size_t i = 0; i < 10; ++i) {
+    Pose pose;
+    pose.position.x = 2.0 * i;
+    pose.orientation.w = 1.0;
+    path.emplace_back(0.5 * i, pose, 1.0 * i);
+  }
+
+  // searching from the last segment gives the same result as searching from the beginning
+  size_t start_idx = 1;
+  for (double time = 0.0; time < 5.0; time += 0.3) {
+    const auto expected = calcInterpolatedPoseWithVelocity(path, time);
+    const auto result = calcInterpolatedPoseWithVelocity(path, time, start_idx);
+    ASSERT_EQ(!!expected, !!result);
+    if (expected) {
+      EXPECT_NEAR(result->pose.position.x, expected->pose.position.x, epsilon);
+      EXPECT_NEAR(result->velocity, expected->velocity, epsilon);
+    }
+  }
+  EXPECT_FALSE(calcInterpolatedPoseWithVelocity(path, -1.0, start_idx));
+}
@@ -143,8 +143,8 @@ void CrosswalkModuleManager::launchNewModules(const PathWithLaneId & path)
     updateRTCStatus(getUUID(id), true, std::numeric_limits<double>::lowest(), path.header.stamp);
   };
 
-  const auto crosswalk_leg_elem_map = planning_utils::getRegElemMapOnPath<Crosswalk>(
-    path, rh->getLaneletMapPtr(), planner_data_->current_odometry->pose);
+  const auto crosswalk_leg_elem_map =
+    planning_utils::getRegElemMapOnPath<Crosswalk>(*getPathView(path));
 
   for (const auto & crosswalk : crosswalk_leg_elem_map) {
     launch(crosswalk.first->id(), true);
@@ -168,8 +168,8 @@ CrosswalkModuleManager::getModuleExpiredFunction(const PathWithLaneId & path)
   crosswalk_id_set = getCrosswalkIdSetOnPath(
     planner_data_->current_odometry->pose, path, rh->getLaneletMapPtr(), rh->getOverallGraphPtr());
 
-  const auto crosswalk_leg_elem_map = planning_utils::getRegElemMapOnPath<Crosswalk>(
-    path, rh->getLaneletMapPtr(), planner_data_->current_odometry->pose);
+  const auto crosswalk_leg_elem_map =
+    planning_utils::getRegElemMapOnPath<Crosswalk>(*getPathView(path));
 
   for (const auto & crosswalk : crosswalk_leg_elem_map) {
     crosswalk_id_set.insert(crosswalk.first->id());
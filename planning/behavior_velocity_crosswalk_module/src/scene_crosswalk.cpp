@@ -106,6 +106,24 @@ Polygon2d createMultiStepPolygon(
   return hull_multi_step_polygon;
 }
 
+// box covering the object footprints along all its predicted paths
+tier4_autoware_utils::Box2d calcPredictedPathsBox(const PredictedObject & object)
+{
+  tier4_autoware_utils::Box2d box;
+  bg::assign_inverse(box);
+  for (const auto & obj_path : object.kinematics.predicted_paths) {
+    for (const auto & pose : obj_path.path) {
+      bg::expand(box, Point2d(pose.position.x, pose.position.y));
+    }
+  }
+  const double radius = std::hypot(object.shape.dimensions.x, object.shape.dimensions.y) / 2.0;
+  box.min_corner().x() -= radius;
+  box.min_corner().y() -= radius;
+  box.max_corner().x() += radius;
+  box.max_corner().y() += radius;
+  return box;
+}
+
 void sortCrosswalksByDistance(
   const PathWithLaneId & ego_path, const geometry_msgs::msg::Point & ego_pos,
   lanelet::ConstLanelets & crosswalks)
@@ -199,6 +217,7 @@ CrosswalkModule::CrosswalkModule(
     }
     crosswalk_ = lanelet_map_ptr->laneletLayer.get(module_id);
   }
+  crosswalk_polygon_ = crosswalk_.polygon2d().basicPolygon();
 
   collision_info_pub_ =
     node.create_publisher<tier4_debug_msgs::msg::StringStamped>("~/debug/collision_info", 1);
@@ -222,14 +241,13 @@ bool CrosswalkModule::modifyPathVelocity(PathWithLaneId * path, StopReason * sto
 
   // Initialize debug data
   debug_data_ = DebugData(planner_data_);
-  for (const auto & p : crosswalk_.polygon2d().basicPolygon()) {
+  for (const auto & p : crosswalk_polygon_) {
     debug_data_.crosswalk_polygon.push_back(createPoint(p.x(), p.y(), ego_pos.z));
   }
   recordTime(1);
 
   // Calculate intersection between path and crosswalks
-  const auto path_intersects =
-    getPolygonIntersects(*path, crosswalk_.polygon2d().basicPolygon(), ego_pos, 2);
+  const auto path_intersects = getPolygonIntersects(*path, crosswalk_polygon_, ego_pos, 2);
 
   // Apply safety slow down speed if defined in Lanelet2 map
   if (crosswalk_.hasAttribute("safety_slow_down_speed")) {
@@ -908,6 +926,13 @@ void CrosswalkModule::updateObjectState(
   const auto ignore_crosswalk = isRedSignalForPedestrians();
   debug_data_.ignore_crosswalk = ignore_crosswalk;
 
+  // the objects whose predicted paths stay away from the attention area never collide with ego
+  tier4_autoware_utils::Box2d attention_area_box;
+  bg::assign_inverse(attention_area_box);
+  for (const auto & p : attention_area.outer()) {
+    bg::expand(attention_area_box, p);
+  }
+
   // Update object state
   object_info_manager_.init();
   for (const auto & object : objects_ptr->objects) {
@@ -924,10 +949,14 @@ void CrosswalkModule::updateObjectState(
     }
 
     const auto collision_point =
-      getCollisionPoint(sparse_resample_path, object, crosswalk_attention_range, attention_area);
+      attention_area.outer().empty() ||
+          bg::disjoint(calcPredictedPathsBox(object), attention_area_box)
+        ? std::nullopt
+        : getCollisionPoint(
+            sparse_resample_path, object, crosswalk_attention_range, attention_area);
     object_info_manager_.update(
       obj_uuid, obj_pos, std::hypot(obj_vel.x, obj_vel.y), clock_->now(), is_ego_yielding,
-      has_traffic_light, collision_point, planner_param_, crosswalk_.polygon2d().basicPolygon());
+      has_traffic_light, collision_point, planner_param_, crosswalk_polygon_);
 
     if (collision_point) {
       const auto collision_state = object_info_manager_.getCollisionState(obj_uuid);
@@ -405,6 +405,8 @@ private:
   rclcpp::Publisher<tier4_debug_msgs::msg::StringStamped>::SharedPtr collision_info_pub_;
 
   lanelet::ConstLanelet crosswalk_;
+  // 2D polygon of crosswalk_, which is used several times in every cycle
+  lanelet::BasicPolygon2d crosswalk_polygon_;
 
   lanelet::ConstLineStrings3d stop_lines_;
 
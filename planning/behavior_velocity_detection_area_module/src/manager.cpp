@@ -55,9 +55,7 @@ void DetectionAreaModuleManager::launchNewModules(
   const autoware_auto_planning_msgs::msg::PathWithLaneId & path)
 {
   for (const auto & detection_area_with_lane_id :
-       planning_utils::getRegElemMapOnPath<DetectionArea>(
-         path, planner_data_->route_handler_->getLaneletMapPtr(),
-         planner_data_->current_odometry->pose)) {
+       planning_utils::getRegElemMapOnPath<DetectionArea>(*getPathView(path))) {
     // Use lanelet_id to unregister module when the route is changed
     const auto lane_id = detection_area_with_lane_id.second.id();
     const auto module_id = detection_area_with_lane_id.first->id();
@@ -76,8 +74,8 @@ std::function<bool(const std::shared_ptr<SceneModuleInterface> &)>
 DetectionAreaModuleManager::getModuleExpiredFunction(
   const autoware_auto_planning_msgs::msg::PathWithLaneId & path)
 {
-  const auto detection_area_id_set = planning_utils::getRegElemIdSetOnPath<DetectionArea>(
-    path, planner_data_->route_handler_->getLaneletMapPtr(), planner_data_->current_odometry->pose);
+  const auto detection_area_id_set =
+    planning_utils::getRegElemIdSetOnPath<DetectionArea>(*getPathView(path));
 
   return [detection_area_id_set](const std::shared_ptr<SceneModuleInterface> & scene_module) {
     return detection_area_id_set.count(scene_module->getModuleId()) == 0;
@@ -26,7 +26,9 @@
 #include <lanelet2_core/geometry/Polygon.h>
 
 #include <algorithm>
+#include <cmath>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
@@ -279,11 +281,24 @@ std::vector<geometry_msgs::msg::Point> DetectionAreaModule::getObstaclePoints()
 
   const auto detection_areas = detection_area_reg_elem_.detectionAreas();
   const auto & points = *(planner_data_->no_ground_pointcloud);
+  const auto & points_index = planner_data_->no_ground_pointcloud_index;
 
   for (const auto & detection_area : detection_areas) {
     const auto poly = lanelet::utils::to2D(detection_area);
     const auto circle = calcSmallestEnclosingCircle(poly);
-    for (const auto p : points) {
+    // only the points around the circle are checked, in the same order as in the whole cloud
+    std::vector<size_t> point_indices;
+    if (points_index) {
+      const double radius = std::sqrt(circle.second);
+      point_indices = points_index->getPointIndicesInBox(
+        circle.first.x() - radius, circle.first.y() - radius, circle.first.x() + radius,
+        circle.first.y() + radius);
+    } else {
+      point_indices.resize(points.size());
+      std::iota(point_indices.begin(), point_indices.end(), 0);
+    }
+    for (const auto i : point_indices) {
+      const auto & p = points.at(i);
       const double squared_dist = (circle.first.x() - p.x) * (circle.first.x() - p.x) +
                                   (circle.first.y() - p.y) * (circle.first.y() - p.y);
       if (squared_dist <= circle.second) {
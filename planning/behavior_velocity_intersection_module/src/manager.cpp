@@ -180,8 +180,7 @@ void IntersectionModuleManager::launchNewModules(
   const auto routing_graph = planner_data_->route_handler_->getRoutingGraphPtr();
   const auto lanelet_map = planner_data_->route_handler_->getLaneletMapPtr();
 
-  const auto lanelets =
-    planning_utils::getLaneletsOnPath(path, lanelet_map, planner_data_->current_odometry->pose);
+  const auto lanelets = planning_utils::getLaneletsOnPath(*getPathView(path));
   // run occlusion detection only in the first intersection
   const bool enable_occlusion_detection = intersection_param_.occlusion.enable;
   for (size_t i = 0; i < lanelets.size(); i++) {
@@ -234,8 +233,7 @@ std::function<bool(const std::shared_ptr<SceneModuleInterface> &)>
 IntersectionModuleManager::getModuleExpiredFunction(
   const autoware_auto_planning_msgs::msg::PathWithLaneId & path)
 {
-  const auto lane_set = planning_utils::getLaneletsOnPath(
-    path, planner_data_->route_handler_->getLaneletMapPtr(), planner_data_->current_odometry->pose);
+  const auto lane_set = planning_utils::getLaneletsOnPath(*getPathView(path));
 
   return [this, lane_set](const std::shared_ptr<SceneModuleInterface> & scene_module) {
     const auto intersection_module = std::dynamic_pointer_cast<IntersectionModule>(scene_module);
@@ -341,8 +339,7 @@ void MergeFromPrivateModuleManager::launchNewModules(
   const auto routing_graph = planner_data_->route_handler_->getRoutingGraphPtr();
   const auto lanelet_map = planner_data_->route_handler_->getLaneletMapPtr();
 
-  const auto lanelets =
-    planning_utils::getLaneletsOnPath(path, lanelet_map, planner_data_->current_odometry->pose);
+  const auto lanelets = planning_utils::getLaneletsOnPath(*getPathView(path));
   for (size_t i = 0; i < lanelets.size(); i++) {
     const auto ll = lanelets.at(i);
     const auto lane_id = ll.id();
@@ -405,8 +402,7 @@ std::function<bool(const std::shared_ptr<SceneModuleInterface> &)>
 MergeFromPrivateModuleManager::getModuleExpiredFunction(
   const autoware_auto_planning_msgs::msg::PathWithLaneId & path)
 {
-  const auto lane_set = planning_utils::getLaneletsOnPath(
-    path, planner_data_->route_handler_->getLaneletMapPtr(), planner_data_->current_odometry->pose);
+  const auto lane_set = planning_utils::getLaneletsOnPath(*getPathView(path));
 
   return [this, lane_set](const std::shared_ptr<SceneModuleInterface> & scene_module) {
     const auto merge_from_private_module =
@@ -27,6 +27,9 @@
 
 #include <boost/geometry/algorithms/convex_hull.hpp>
 #include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
 #include <boost/geometry/algorithms/intersection.hpp>
 
 #include <lanelet2_core/geometry/LineString.h>
@@ -35,6 +38,7 @@
 #include <lanelet2_core/primitives/LineString.h>
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <memory>
@@ -68,6 +72,29 @@ Polygon2d createOneStepPolygon(
 
   return convex_one_step_poly;
 }
+
+// the largest distance from the pose to the footprint of the shape
+double calcFootprintRadius(const autoware_auto_perception_msgs::msg::Shape & shape)
+{
+  double radius = 0.0;
+  const auto footprint = tier4_autoware_utils::toPolygon2d(geometry_msgs::msg::Pose{}, shape);
+  for (const auto & p : footprint.outer()) {
+    radius = std::max(radius, std::hypot(p.x(), p.y()));
+  }
+  return radius;
+}
+
+// the box around the two poses which contains the footprints of the given radius on both of them
+tier4_autoware_utils::Box2d createFootprintBox(
+  const geometry_msgs::msg::Pose & prev_pose, const geometry_msgs::msg::Pose & next_pose,
+  const double radius)
+{
+  const auto & p1 = prev_pose.position;
+  const auto & p2 = next_pose.position;
+  return tier4_autoware_utils::Box2d{
+    Point2d{std::min(p1.x, p2.x) - radius, std::min(p1.y, p2.y) - radius},
+    Point2d{std::max(p1.x, p2.x) + radius, std::max(p1.y, p2.y) + radius}};
+}
 }  // namespace
 
 static bool isTargetCollisionVehicleType(
@@ -945,6 +972,9 @@ IntersectionModule::DecisionResult IntersectionModule::modifyPathVelocityDetail(
       planner_param_.common.attention_area_length,
       planner_param_.occlusion.occlusion_attention_area_length,
       planner_param_.common.consider_wrong_direction_vehicle);
+    intersection_area_ = planner_param_.common.use_intersection_area
+                           ? util::getIntersectionArea(assigned_lanelet, lanelet_map_ptr)
+                           : std::nullopt;
   }
   auto & intersection_lanelets = intersection_lanelets_.value();
 
@@ -1111,12 +1141,9 @@ IntersectionModule::DecisionResult IntersectionModule::modifyPathVelocityDetail(
   debug_data_.adjacent_area = intersection_lanelets.adjacent_area();
 
   // get intersection area
-  const auto intersection_area = planner_param_.common.use_intersection_area
-                                   ? util::getIntersectionArea(assigned_lanelet, lanelet_map_ptr)
-                                   : std::nullopt;
+  const auto & intersection_area = intersection_area_;
   if (intersection_area) {
-    const auto intersection_area_2d = intersection_area.value();
-    debug_data_.intersection_area = toGeomPoly(intersection_area_2d);
+    debug_data_.intersection_area = toGeomPoly(intersection_area.value());
   }
 
   auto target_objects = generateTargetObjects(intersection_lanelets, intersection_area);
@@ -1360,7 +1387,7 @@ util::TargetObjects IntersectionModule::generateTargetObjects(
                                          : target_objects.attention_objects;
     if (intersection_area) {
       const auto obj_poly = tier4_autoware_utils::toPolygon2d(object);
-      const auto intersection_area_2d = intersection_area.value();
+      const auto & intersection_area_2d = intersection_area.value();
       const auto belong_attention_lanelet_id = util::checkAngleForTargetLanelets(
         object_direction, attention_lanelets, planner_param_.common.attention_area_angle_thr,
         planner_param_.common.consider_wrong_direction_vehicle,
@@ -1432,6 +1459,16 @@ bool IntersectionModule::checkCollision(
   const auto & ego_lane = path_lanelets.ego_or_entry2exit;
   debug_data_.ego_lane = ego_lane.polygon3d();
   const auto ego_poly = ego_lane.polygon2d().basicPolygon();
+  const double concat_lanelets_length = lanelet::utils::getLaneletLength2d(concat_lanelets);
+
+  // the steps of the predicted paths whose footprint box does not overlap with the box of the ego
+  // lane can not intersect with the ego lane, so the polygons are not created for them
+  tier4_autoware_utils::Box2d ego_box{
+    Point2d{std::numeric_limits<double>::max(), std::numeric_limits<double>::max()},
+    Point2d{std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()}};
+  for (const auto & p : ego_poly) {
+    bg::expand(ego_box, Point2d{p.x(), p.y()});
+  }
 
   // change TTC margin based on ego traffic light color
   const auto [collision_start_margin_time, collision_end_margin_time] = [&]() {
@@ -1476,6 +1513,13 @@ bool IntersectionModule::checkCollision(
       debug_data_.amber_ignore_targets.objects.push_back(object);
       continue;
     }
+    const double footprint_radius = calcFootprintRadius(object.shape);
+    const auto intersects_ego_poly = [&](const auto & a, const auto & b) {
+      if (bg::disjoint(ego_box, createFootprintBox(a, b, footprint_radius))) {
+        return false;
+      }
+      return bg::intersects(ego_poly, createOneStepPolygon(a, b, object.shape));
+    };
     for (const auto & predicted_path : object.kinematics.predicted_paths) {
       if (
         predicted_path.confidence <
@@ -1486,16 +1530,10 @@ bool IntersectionModule::checkCollision(
 
       // collision point
       const auto first_itr = std::adjacent_find(
-        predicted_path.path.cbegin(), predicted_path.path.cend(),
-        [&ego_poly, &object](const auto & a, const auto & b) {
-          return bg::intersects(ego_poly, createOneStepPolygon(a, b, object.shape));
-        });
+        predicted_path.path.cbegin(), predicted_path.path.cend(), intersects_ego_poly);
       if (first_itr == predicted_path.path.cend()) continue;
       const auto last_itr = std::adjacent_find(
-        predicted_path.path.crbegin(), predicted_path.path.crend(),
-        [&ego_poly, &object](const auto & a, const auto & b) {
-          return bg::intersects(ego_poly, createOneStepPolygon(a, b, object.shape));
-        });
+        predicted_path.path.crbegin(), predicted_path.path.crend(), intersects_ego_poly);
       if (last_itr == predicted_path.path.crend()) continue;
 
       // possible collision time interval
@@ -1533,7 +1571,7 @@ bool IntersectionModule::checkCollision(
       const double end_arc_length = std::min(
         closest_arc_coords.length + (*end_time_distance_itr).second +
           planner_data_->vehicle_info_.max_longitudinal_offset_m,
-        lanelet::utils::getLaneletLength2d(concat_lanelets));
+        concat_lanelets_length);
 
       const auto trimmed_ego_polygon =
         getPolygonFromArcLength(concat_lanelets, start_arc_length, end_arc_length);
@@ -1548,8 +1586,12 @@ bool IntersectionModule::checkCollision(
       }
       bg::correct(polygon);
       debug_data_.candidate_collision_ego_lane_polygon = toGeomPoly(polygon);
+      const auto polygon_box = bg::return_envelope<tier4_autoware_utils::Box2d>(polygon);
 
       for (auto itr = first_itr; itr != last_itr.base(); ++itr) {
+        if (bg::disjoint(polygon_box, createFootprintBox(*itr, *itr, footprint_radius))) {
+          continue;
+        }
         const auto footprint_polygon = tier4_autoware_utils::toPolygon2d(*itr, object.shape);
         if (bg::intersects(polygon, footprint_polygon)) {
           collision_detected = true;
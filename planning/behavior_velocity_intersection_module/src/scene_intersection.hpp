@@ -267,6 +267,8 @@ private:
   PlannerParam planner_param_;
 
   std::optional<util::IntersectionLanelets> intersection_lanelets_{std::nullopt};
+  // the intersection area only depends on the map, so it is cached with intersection_lanelets_
+  std::optional<Polygon2d> intersection_area_{std::nullopt};
 
   // for occlusion detection
   const bool enable_occlusion_detection_;
@@ -249,13 +249,18 @@ getFirstPointInsidePolygonsByFootprint(
   const auto & path_ip = interpolated_path_info.path;
   const auto [lane_start, lane_end] = interpolated_path_info.lane_id_interval.value();
 
+  std::vector<lanelet::BasicPolygon2d> areas_2d;
+  areas_2d.reserve(polygons.size());
+  for (const auto & polygon : polygons) {
+    areas_2d.push_back(lanelet::utils::to2D(polygon).basicPolygon());
+  }
+
   for (size_t i = lane_start; i <= lane_end; ++i) {
     const auto & pose = path_ip.points.at(i).point.pose;
     const auto path_footprint =
       tier4_autoware_utils::transformVector(footprint, tier4_autoware_utils::pose2transform(pose));
-    for (size_t j = 0; j < polygons.size(); ++j) {
-      const auto area_2d = lanelet::utils::to2D(polygons.at(j)).basicPolygon();
-      const bool is_in_polygon = bg::intersects(area_2d, path_footprint);
+    for (size_t j = 0; j < areas_2d.size(); ++j) {
+      const bool is_in_polygon = bg::intersects(areas_2d.at(j), path_footprint);
       if (is_in_polygon) {
         return std::make_optional<std::pair<size_t, size_t>>(i, j);
       }
@@ -489,16 +494,21 @@ getFirstPointInsidePolygons(
   const std::pair<size_t, size_t> lane_interval,
   const std::vector<lanelet::CompoundPolygon3d> & polygons, const bool search_forward = true)
 {
+  std::vector<lanelet::CompoundPolygon2d> polygons_2d;
+  polygons_2d.reserve(polygons.size());
+  for (const auto & polygon : polygons) {
+    polygons_2d.push_back(lanelet::utils::to2D(polygon));
+  }
+
   if (search_forward) {
     for (size_t i = lane_interval.first; i <= lane_interval.second; ++i) {
       bool is_in_lanelet = false;
       const auto & p = path.points.at(i).point.pose.position;
-      for (const auto & polygon : polygons) {
-        const auto polygon_2d = lanelet::utils::to2D(polygon);
-        is_in_lanelet = bg::within(to_bg2d(p), polygon_2d);
+      for (size_t j = 0; j < polygons.size(); ++j) {
+        is_in_lanelet = bg::within(to_bg2d(p), polygons_2d.at(j));
         if (is_in_lanelet) {
           return std::make_optional<std::pair<size_t, const lanelet::CompoundPolygon3d &>>(
-            i, polygon);
+            i, polygons.at(j));
         }
       }
       if (is_in_lanelet) {
@@ -509,12 +519,11 @@ getFirstPointInsidePolygons(
     for (size_t i = lane_interval.second; i >= lane_interval.first; --i) {
       bool is_in_lanelet = false;
       const auto & p = path.points.at(i).point.pose.position;
-      for (const auto & polygon : polygons) {
-        const auto polygon_2d = lanelet::utils::to2D(polygon);
-        is_in_lanelet = bg::within(to_bg2d(p), polygon_2d);
+      for (size_t j = 0; j < polygons.size(); ++j) {
+        is_in_lanelet = bg::within(to_bg2d(p), polygons_2d.at(j));
         if (is_in_lanelet) {
           return std::make_optional<std::pair<size_t, const lanelet::CompoundPolygon3d &>>(
-            i, polygon);
+            i, polygons.at(j));
         }
       }
       if (is_in_lanelet) {
@@ -55,9 +55,7 @@ NoStoppingAreaModuleManager::NoStoppingAreaModuleManager(rclcpp::Node & node)
 void NoStoppingAreaModuleManager::launchNewModules(
   const autoware_auto_planning_msgs::msg::PathWithLaneId & path)
 {
-  for (const auto & m : planning_utils::getRegElemMapOnPath<NoStoppingArea>(
-         path, planner_data_->route_handler_->getLaneletMapPtr(),
-         planner_data_->current_odometry->pose)) {
+  for (const auto & m : planning_utils::getRegElemMapOnPath<NoStoppingArea>(*getPathView(path))) {
     // Use lanelet_id to unregister module when the route is changed
     const int64_t module_id = m.first->id();
     const int64_t lane_id = m.second.id();
@@ -78,8 +76,8 @@ std::function<bool(const std::shared_ptr<SceneModuleInterface> &)>
 NoStoppingAreaModuleManager::getModuleExpiredFunction(
   const autoware_auto_planning_msgs::msg::PathWithLaneId & path)
 {
-  const auto no_stopping_area_id_set = planning_utils::getRegElemIdSetOnPath<NoStoppingArea>(
-    path, planner_data_->route_handler_->getLaneletMapPtr(), planner_data_->current_odometry->pose);
+  const auto no_stopping_area_id_set =
+    planning_utils::getRegElemIdSetOnPath<NoStoppingArea>(*getPathView(path));
 
   return [no_stopping_area_id_set](const std::shared_ptr<SceneModuleInterface> & scene_module) {
     return no_stopping_area_id_set.count(scene_module->getModuleId()) == 0;
@@ -15,7 +15,9 @@
 #include "grid_utils.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
+#include <memory>
 #include <stdexcept>
 #include <utility>
 #include <vector>
@@ -81,10 +83,36 @@ void findOcclusionSpots(
   }
 }
 
+bool isFarFromOccupiedCells(
+  const grid_map::GridMap & grid, const grid_map::Position & p1, const grid_map::Position & p2,
+  const double radius)
+{
+  const grid_map::Matrix & distance = grid[OCCUPIED_DISTANCE_LAYER];
+  const double resolution = grid.getResolution();
+  // the distance of the cell center is used instead of the distance of the sample point
+  const double cell_margin = 0.5 * std::sqrt(2.0) * resolution;
+  const int num_samples = std::max(1, static_cast<int>(std::ceil((p2 - p1).norm() / resolution)));
+  // each sample covers its part of the segment widened by the radius
+  const double step = (p2 - p1).norm() / num_samples;
+  const double min_distance = std::hypot(0.5 * step, radius) + cell_margin;
+  for (int i = 0; i < num_samples; ++i) {
+    const grid_map::Position p = p1 + (p2 - p1) * ((i + 0.5) / num_samples);
+    grid_map::Index index;
+    if (!grid.getIndex(p, index) || distance(index.x(), index.y()) <= min_distance) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool isCollisionFree(
   const grid_map::GridMap & grid, const grid_map::Position & p1, const grid_map::Position & p2,
   const double radius)
 {
+  // no occupied cell can be in the polygon if every point of the segment is far enough from them
+  if (grid.exists(OCCUPIED_DISTANCE_LAYER) && isFarFromOccupiedCells(grid, p1, p2, radius)) {
+    return true;
+  }
   const grid_map::Matrix & grid_data = grid["layer"];
   bool polys = true;
   try {
@@ -226,15 +254,25 @@ void generateOccupiedImage(
   const OccupancyGrid & occ_grid, cv::Mat & inout_image,
   const Polygons2d & stuck_vehicle_foot_prints, const Polygons2d & moving_vehicle_foot_prints,
   const bool use_object_foot_print, const bool use_object_raycast)
+{
+  generateOccupiedImage(
+    occ_grid, occ_grid.info, inout_image, stuck_vehicle_foot_prints, moving_vehicle_foot_prints,
+    use_object_foot_print, use_object_raycast);
+}
+
+void generateOccupiedImage(
+  const OccupancyGrid & occ_grid, const MapMetaData & scan_area, cv::Mat & inout_image,
+  const Polygons2d & stuck_vehicle_foot_prints, const Polygons2d & moving_vehicle_foot_prints,
+  const bool use_object_foot_print, const bool use_object_raycast)
 {
   const auto & occ = occ_grid;
   OccupancyGrid occupancy_grid;
   PoseStamped grid_origin;
   const double width = occ.info.width * occ.info.resolution;
   const double height = occ.info.height * occ.info.resolution;
-  Point scan_origin = occ.info.origin.position;
-  scan_origin.x += 0.5 * width;
-  scan_origin.y += 0.5 * height;
+  Point scan_origin = scan_area.origin.position;
+  scan_origin.x += 0.5 * scan_area.width * scan_area.resolution;
+  scan_origin.y += 0.5 * scan_area.height * scan_area.resolution;
 
   // calculate grid origin
   {
@@ -270,7 +308,11 @@ void generateOccupiedImage(
   // create not Detection Area using opencv
   std::vector<std::vector<cv::Point>> cv_polygons;
   std::vector<cv::Point> cv_polygon;
-  Polygon2d occupancy_poly = generateOccupancyPolygon(occupancy_grid.info);
+  // the shadows are clipped by the scanned area, not by the given (possibly cropped) grid
+  MapMetaData scan_area_info = occupancy_grid.info;
+  scan_area_info.origin.position.x = scan_area.origin.position.x;
+  scan_area_info.origin.position.y = scan_area.origin.position.y;
+  Polygon2d occupancy_poly = generateOccupancyPolygon(scan_area_info);
   if (use_object_raycast) {
     for (const auto & foot_print : moving_vehicle_foot_prints) {
       // calculate occlusion polygon from moving vehicle
@@ -366,6 +408,18 @@ void denoiseOccupancyGridCV(
   const Polygons2d & stuck_vehicle_foot_prints, const Polygons2d & moving_vehicle_foot_prints,
   grid_map::GridMap & grid_map, const GridParam & param, const bool is_show_debug_window,
   const int num_iter, const bool use_object_footprints, const bool use_object_ray_casts)
+{
+  denoiseOccupancyGridCV(
+    occupancy_grid_ptr, occupancy_grid_ptr->info, stuck_vehicle_foot_prints,
+    moving_vehicle_foot_prints, grid_map, param, is_show_debug_window, num_iter,
+    use_object_footprints, use_object_ray_casts);
+}
+
+void denoiseOccupancyGridCV(
+  const OccupancyGrid::ConstSharedPtr occupancy_grid_ptr, const MapMetaData & scan_area,
+  const Polygons2d & stuck_vehicle_foot_prints, const Polygons2d & moving_vehicle_foot_prints,
+  grid_map::GridMap & grid_map, const GridParam & param, const bool is_show_debug_window,
+  const int num_iter, const bool use_object_footprints, const bool use_object_ray_casts)
 {
   OccupancyGrid occupancy_grid = *occupancy_grid_ptr;
   cv::Mat border_image(
@@ -386,8 +440,8 @@ void denoiseOccupancyGridCV(
   //! raycast object shadow using vehicle
   if (use_object_footprints || use_object_ray_casts) {
     generateOccupiedImage(
-      occupancy_grid, border_image, stuck_vehicle_foot_prints, moving_vehicle_foot_prints,
-      use_object_footprints, use_object_ray_casts);
+      occupancy_grid, scan_area, border_image, stuck_vehicle_foot_prints,
+      moving_vehicle_foot_prints, use_object_footprints, use_object_ray_casts);
     if (is_show_debug_window) {
       cv::namedWindow("object ray shadow", cv::WINDOW_NORMAL);
       cv::imshow("object ray shadow", border_image);
@@ -414,5 +468,155 @@ void denoiseOccupancyGridCV(
   imageToOccupancyGrid(border_image, &occupancy_grid);
   grid_map::GridMapRosConverter::fromOccupancyGrid(occupancy_grid, "layer", grid_map);
 }
+
+bool cropOccupancyGrid(
+  const OccupancyGrid & occupancy_grid, const tier4_autoware_utils::Box2d & box,
+  OccupancyGrid & cropped_grid)
+{
+  const auto & info = occupancy_grid.info;
+  // box corners in the grid frame, in cell units
+  const double yaw = tf2::getYaw(info.origin.orientation);
+  const double cos_yaw = std::cos(yaw);
+  const double sin_yaw = std::sin(yaw);
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  for (const double x : {box.min_corner().x(), box.max_corner().x()}) {
+    for (const double y : {box.min_corner().y(), box.max_corner().y()}) {
+      const double dx = x - info.origin.position.x;
+      const double dy = y - info.origin.position.y;
+      const double cell_x = (cos_yaw * dx + sin_yaw * dy) / info.resolution;
+      const double cell_y = (-sin_yaw * dx + cos_yaw * dy) / info.resolution;
+      min_x = std::min(min_x, cell_x);
+      min_y = std::min(min_y, cell_y);
+      max_x = std::max(max_x, cell_x);
+      max_y = std::max(max_y, cell_y);
+    }
+  }
+  const auto clamp_cell = [](const double cell, const uint32_t size) {
+    return static_cast<uint32_t>(std::clamp(cell, 0.0, static_cast<double>(size)));
+  };
+  const uint32_t begin_x = clamp_cell(std::floor(min_x), info.width);
+  const uint32_t begin_y = clamp_cell(std::floor(min_y), info.height);
+  const uint32_t end_x = clamp_cell(std::ceil(max_x), info.width);
+  const uint32_t end_y = clamp_cell(std::ceil(max_y), info.height);
+  if (begin_x >= end_x || begin_y >= end_y) {
+    return false;
+  }
+
+  cropped_grid.header = occupancy_grid.header;
+  cropped_grid.info = info;
+  cropped_grid.info.width = end_x - begin_x;
+  cropped_grid.info.height = end_y - begin_y;
+  cropped_grid.info.origin = tier4_autoware_utils::calcOffsetPose(
+    info.origin, begin_x * info.resolution, begin_y * info.resolution, 0.0);
+  cropped_grid.data.resize(cropped_grid.info.width * cropped_grid.info.height);
+  for (uint32_t y = begin_y; y < end_y; ++y) {
+    const auto row_begin = occupancy_grid.data.begin() + y * info.width;
+    std::copy(
+      row_begin + begin_x, row_begin + end_x,
+      cropped_grid.data.begin() + (y - begin_y) * cropped_grid.info.width);
+  }
+  return true;
+}
+
+void addOccupiedDistanceLayer(grid_map::GridMap & grid)
+{
+  const grid_map::Matrix & grid_data = grid["layer"];
+  cv::Mat free_image(grid_data.rows(), grid_data.cols(), CV_8UC1);
+  for (int i = 0; i < grid_data.rows(); ++i) {
+    for (int j = 0; j < grid_data.cols(); ++j) {
+      const bool is_occupied = grid_data(i, j) == grid_utils::occlusion_cost_value::OCCUPIED;
+      free_image.at<unsigned char>(i, j) = is_occupied ? 0 : 255;
+    }
+  }
+  cv::Mat distance_image;
+  cv::distanceTransform(free_image, distance_image, cv::DIST_L2, cv::DIST_MASK_PRECISE);
+
+  grid.add(OCCUPIED_DISTANCE_LAYER);
+  grid_map::Matrix & distance = grid[OCCUPIED_DISTANCE_LAYER];
+  const double resolution = grid.getResolution();
+  for (int i = 0; i < distance.rows(); ++i) {
+    for (int j = 0; j < distance.cols(); ++j) {
+      distance(i, j) = distance_image.at<float>(i, j) * resolution;
+    }
+  }
+}
+
+namespace
+{
+bool isSamePolygons(const Polygons2d & polygons1, const Polygons2d & polygons2)
+{
+  if (polygons1.size() != polygons2.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < polygons1.size(); ++i) {
+    const auto & outer1 = polygons1.at(i).outer();
+    const auto & outer2 = polygons2.at(i).outer();
+    if (outer1.size() != outer2.size()) {
+      return false;
+    }
+    for (size_t j = 0; j < outer1.size(); ++j) {
+      if (outer1.at(j).x() != outer2.at(j).x() || outer1.at(j).y() != outer2.at(j).y()) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}  // namespace
+
+bool DenoisedGridCache::isValid(
+  const OccupancyGrid::ConstSharedPtr & occupancy_grid_ptr,
+  const tier4_autoware_utils::Box2d & roi, const Polygons2d & stuck_vehicle_foot_prints,
+  const Polygons2d & moving_vehicle_foot_prints, const int num_iter) const
+{
+  return occupancy_grid_ptr_ && occupancy_grid_ptr_ == occupancy_grid_ptr &&
+         num_iter_ == num_iter && bg::covered_by(roi, roi_) &&
+         isSamePolygons(stuck_vehicle_foot_prints_, stuck_vehicle_foot_prints) &&
+         isSamePolygons(moving_vehicle_foot_prints_, moving_vehicle_foot_prints);
+}
+
+const grid_map::GridMap & DenoisedGridCache::get(
+  const OccupancyGrid::ConstSharedPtr occupancy_grid_ptr,
+  const tier4_autoware_utils::Box2d & roi, const Polygons2d & stuck_vehicle_foot_prints,
+  const Polygons2d & moving_vehicle_foot_prints, const GridParam & param,
+  const bool is_show_debug_window, const int num_iter, const bool use_object_footprints,
+  const bool use_object_ray_casts)
+{
+  if (isValid(
+        occupancy_grid_ptr, roi, stuck_vehicle_foot_prints, moving_vehicle_foot_prints,
+        num_iter)) {
+    return grid_map_;
+  }
+
+  // the erosion of the cells in the roi depends on num_iter cells around them
+  const double margin = (std::max(num_iter, 0) + 1) * occupancy_grid_ptr->info.resolution;
+  tier4_autoware_utils::Box2d crop_box = roi;
+  crop_box.min_corner().x() -= margin;
+  crop_box.min_corner().y() -= margin;
+  crop_box.max_corner().x() += margin;
+  crop_box.max_corner().y() += margin;
+  auto cropped_grid = std::make_shared<OccupancyGrid>();
+  if (!cropOccupancyGrid(*occupancy_grid_ptr, crop_box, *cropped_grid)) {
+    // the roi is outside of the grid, fall back to the whole grid
+    *cropped_grid = *occupancy_grid_ptr;
+  }
+
+  grid_map_ = grid_map::GridMap();
+  denoiseOccupancyGridCV(
+    cropped_grid, occupancy_grid_ptr->info, stuck_vehicle_foot_prints, moving_vehicle_foot_prints,
+    grid_map_, param, is_show_debug_window, num_iter, use_object_footprints,
+    use_object_ray_casts);
+  addOccupiedDistanceLayer(grid_map_);
+
+  occupancy_grid_ptr_ = occupancy_grid_ptr;
+  roi_ = roi;
+  stuck_vehicle_foot_prints_ = stuck_vehicle_foot_prints;
+  moving_vehicle_foot_prints_ = moving_vehicle_foot_prints;
+  num_iter_ = num_iter;
+  return grid_map_;
+}
 }  // namespace grid_utils
 }  // namespace behavior_velocity_planner
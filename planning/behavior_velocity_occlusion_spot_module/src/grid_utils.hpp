@@ -22,6 +22,7 @@
 #include <grid_map_ros/GridMapRosConverter.hpp>
 #include <grid_map_utils/polygon_iterator.hpp>
 #include <opencv2/opencv.hpp>
+#include <tier4_autoware_utils/geometry/boost_geometry.hpp>
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 #include <tier4_autoware_utils/math/normalization.hpp>
 
@@ -70,6 +71,9 @@ static constexpr unsigned char UNKNOWN_IMAGE = 100;
 static constexpr unsigned char OCCUPIED_IMAGE = 255;
 }  // namespace occlusion_cost_value
 
+//!< @brief layer with the distance [m] from each cell to the nearest occupied cell
+static constexpr char OCCUPIED_DISTANCE_LAYER[] = "occupied_distance";
+
 struct PolarCoordinates
 {
   double radius;
@@ -107,6 +111,11 @@ void generateOccupiedImage(
   const OccupancyGrid & occ_grid, cv::Mat & inout_image,
   const Polygons2d & stuck_vehicle_foot_prints, const Polygons2d & moving_vehicle_foot_prints,
   const bool use_object_foot_print, const bool use_object_raycast);
+//!< @brief generate occupied polygon from foot print, shadows are cast from the center of scan_area
+void generateOccupiedImage(
+  const OccupancyGrid & occ_grid, const MapMetaData & scan_area, cv::Mat & inout_image,
+  const Polygons2d & stuck_vehicle_foot_prints, const Polygons2d & moving_vehicle_foot_prints,
+  const bool use_object_foot_print, const bool use_object_raycast);
 cv::Point toCVPoint(
   const Point & geom_point, const double width_m, const double height_m, const double resolution);
 void imageToOccupancyGrid(const cv::Mat & cv_image, nav_msgs::msg::OccupancyGrid * occupancy_grid);
@@ -117,6 +126,49 @@ void denoiseOccupancyGridCV(
   const Polygons2d & stuck_vehicle_foot_prints, const Polygons2d & moving_vehicle_foot_prints,
   grid_map::GridMap & grid_map, const GridParam & param, const bool is_show_debug_window,
   const int num_iter, const bool use_object_footprints, const bool use_object_ray_casts);
+//!< @brief denoise the occupancy grid which is a part of scan_area, the area of the original grid
+void denoiseOccupancyGridCV(
+  const OccupancyGrid::ConstSharedPtr occupancy_grid_ptr, const MapMetaData & scan_area,
+  const Polygons2d & stuck_vehicle_foot_prints, const Polygons2d & moving_vehicle_foot_prints,
+  grid_map::GridMap & grid_map, const GridParam & param, const bool is_show_debug_window,
+  const int num_iter, const bool use_object_footprints, const bool use_object_ray_casts);
+//!< @brief crop the occupancy grid to the cells overlapping the box, return false if none does
+bool cropOccupancyGrid(
+  const OccupancyGrid & occupancy_grid, const tier4_autoware_utils::Box2d & box,
+  OccupancyGrid & cropped_grid);
+//!< @brief add OCCUPIED_DISTANCE_LAYER computed from the occupied cells of "layer"
+void addOccupiedDistanceLayer(grid_map::GridMap & grid);
+
+/**
+ * @brief denoised occupancy grid restricted to a region of interest
+ * @details The grid is cropped to the region of interest with a margin covering the erosion, so
+ * the denoised cells inside the region are the same as with denoiseOccupancyGridCV() on the whole
+ * grid. The result is reused while the occupancy grid message and the vehicle footprints are the
+ * same and the requested region stays inside the previous one.
+ */
+class DenoisedGridCache
+{
+public:
+  const grid_map::GridMap & get(
+    const OccupancyGrid::ConstSharedPtr occupancy_grid_ptr,
+    const tier4_autoware_utils::Box2d & roi, const Polygons2d & stuck_vehicle_foot_prints,
+    const Polygons2d & moving_vehicle_foot_prints, const GridParam & param,
+    const bool is_show_debug_window, const int num_iter, const bool use_object_footprints,
+    const bool use_object_ray_casts);
+
+private:
+  bool isValid(
+    const OccupancyGrid::ConstSharedPtr & occupancy_grid_ptr,
+    const tier4_autoware_utils::Box2d & roi, const Polygons2d & stuck_vehicle_foot_prints,
+    const Polygons2d & moving_vehicle_foot_prints, const int num_iter) const;
+
+  OccupancyGrid::ConstSharedPtr occupancy_grid_ptr_;
+  tier4_autoware_utils::Box2d roi_;
+  Polygons2d stuck_vehicle_foot_prints_;
+  Polygons2d moving_vehicle_foot_prints_;
+  int num_iter_{0};
+  grid_map::GridMap grid_map_;
+};
 }  // namespace grid_utils
 }  // namespace behavior_velocity_planner
 
@@ -153,7 +153,6 @@ bool OcclusionSpotModule::modifyPathVelocity(
   if (param_.detection_method == utils::DETECTION_METHOD::OCCUPANCY_GRID) {
     const auto & occ_grid_ptr = planner_data_->occupancy_grid;
     if (!occ_grid_ptr) return true;  // no data
-    grid_map::GridMap grid_map;
     Polygons2d stuck_vehicle_foot_prints;
     Polygons2d moving_vehicle_foot_prints;
     utils::categorizeVehicles(
@@ -163,8 +162,23 @@ bool OcclusionSpotModule::modifyPathVelocity(
     // find out occlusion from erode occlusion candidate num iter is strength of filter
     const int num_iter = static_cast<int>(
       (param_.detection_area.min_occlusion_spot_size / occ_grid_ptr->info.resolution) - 1);
-    grid_utils::denoiseOccupancyGridCV(
-      occ_grid_ptr, stuck_vehicle_foot_prints, moving_vehicle_foot_prints, grid_map, param_.grid,
+    // only the cells around the detection area and the path are searched
+    tier4_autoware_utils::Box2d roi;
+    bg::assign_inverse(roi);
+    for (const auto & detection_area_slice : debug_data_.detection_area_polygons) {
+      bg::expand(roi, bg::return_envelope<tier4_autoware_utils::Box2d>(detection_area_slice));
+    }
+    for (const auto & p : path_interpolated.points) {
+      bg::expand(roi, Point2d(p.point.pose.position.x, p.point.pose.position.y));
+    }
+    const double roi_margin = param_.pedestrian_radius + 0.5 * param_.wheel_tread +
+                              std::max(param_.left_overhang, param_.right_overhang);
+    roi.min_corner().x() -= roi_margin;
+    roi.min_corner().y() -= roi_margin;
+    roi.max_corner().x() += roi_margin;
+    roi.max_corner().y() += roi_margin;
+    const auto & grid_map = denoised_grid_cache_.get(
+      occ_grid_ptr, roi, stuck_vehicle_foot_prints, moving_vehicle_foot_prints, param_.grid,
       param_.is_show_cv_window, num_iter, param_.use_object_info,
       param_.use_moving_object_ray_cast);
     DEBUG_PRINT(show_time, "grid [ms]: ", stop_watch_.toc("processing_time", true));
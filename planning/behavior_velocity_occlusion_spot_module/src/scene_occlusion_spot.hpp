@@ -63,6 +63,7 @@ private:
   PlannerParam param_;
   tier4_autoware_utils::StopWatch<std::chrono::milliseconds> stop_watch_;
   std::vector<lanelet::BasicPolygon2d> partition_lanelets_;
+  grid_utils::DenoisedGridCache denoised_grid_cache_;
 
 protected:
   int64_t module_id_{};
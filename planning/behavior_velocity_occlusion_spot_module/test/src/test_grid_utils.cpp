@@ -178,3 +178,31 @@ TEST(test, erode_with_custom_kernel)
   // cv::imshow("erode", cv_image);
   // cv::waitKey(5000);
 }
+
+TEST(isCollisionFree, same_result_with_occupied_distance_layer)
+{
+  using behavior_velocity_planner::grid_utils::addOccupiedDistanceLayer;
+  using behavior_velocity_planner::grid_utils::isCollisionFree;
+  const size_t cell_size = 100;
+  grid_map::GridMap grid = test::generateGrid(cell_size, cell_size, 0.5);
+  // a few occupied blocks
+  for (int i = 0; i < static_cast<int>(cell_size); ++i) {
+    for (int j = 0; j < static_cast<int>(cell_size); ++j) {
+      if ((i / 10) % 3 == 1 && (j / 10) % 4 == 2) {
+        grid.at("layer", grid_map::Index(i, j)) = OCCUPIED;
+      }
+    }
+  }
+  grid_map::GridMap grid_with_distance = grid;
+  addOccupiedDistanceLayer(grid_with_distance);
+
+  for (int k = 0; k < 200; ++k) {
+    const grid_map::Position p1(1.0 + (k * 7) % 48, 1.0 + (k * 13) % 48);
+    const grid_map::Position p2(1.0 + (k * 11) % 48, 1.0 + (k * 3) % 48);
+    for (const double radius : {0.25, 1.0}) {
+      EXPECT_EQ(
+        isCollisionFree(grid, p1, p2, radius),
+        isCollisionFree(grid_with_distance, p1, p2, radius));
+    }
+  }
+}
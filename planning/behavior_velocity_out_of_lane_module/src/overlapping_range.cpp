@@ -15,18 +15,30 @@
 #include "overlapping_range.hpp"
 
 #include <lanelet2_extension/utility/utilities.hpp>
+#include <tier4_autoware_utils/geometry/boost_geometry.hpp>
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 
 #include <geometry_msgs/msg/pose.hpp>
 
+#include <boost/geometry/index/rtree.hpp>
+
 #include <lanelet2_core/geometry/LaneletMap.h>
 #include <tf2/utils.h>
 
 #include <algorithm>
+#include <iterator>
 #include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
 
 namespace behavior_velocity_planner::out_of_lane
 {
+namespace
+{
+using FootprintRtree = boost::geometry::index::rtree<
+  std::pair<tier4_autoware_utils::Box2d, size_t>, boost::geometry::index::rstar<16>>;
+}  // namespace
 
 Overlap calculate_overlap(
   const lanelet::BasicPolygon2d & path_footprint, const lanelet::ConstLanelets & path_lanelets,
@@ -73,10 +85,24 @@ OverlapRanges calculate_overlapping_ranges(
   const std::vector<lanelet::BasicPolygon2d> & path_footprints,
   const lanelet::ConstLanelets & path_lanelets, const lanelet::ConstLanelet & lanelet,
   const PlannerParam & params)
+{
+  std::vector<size_t> footprint_indices(path_footprints.size());
+  std::iota(footprint_indices.begin(), footprint_indices.end(), 0UL);
+  return calculate_overlapping_ranges(
+    path_footprints, footprint_indices, path_lanelets, lanelet, params);
+}
+
+OverlapRanges calculate_overlapping_ranges(
+  const std::vector<lanelet::BasicPolygon2d> & path_footprints,
+  const std::vector<size_t> & footprint_indices, const lanelet::ConstLanelets & path_lanelets,
+  const lanelet::ConstLanelet & lanelet, const PlannerParam & params)
 {
   OverlapRanges ranges;
   OtherLane other_lane(lanelet);
-  for (auto i = 0UL; i < path_footprints.size(); ++i) {
+  for (const auto i : footprint_indices) {
+    // the skipped footprints do not overlap the lanelet
+    if (other_lane.range_is_open && i > other_lane.last_range_bound.index + 1)
+      ranges.push_back(other_lane.close_range());
     const auto overlap = calculate_overlap(path_footprints[i], path_lanelets, lanelet);
     const auto has_overlap = overlap.inside_distance > params.overlap_min_dist;
     if (has_overlap) {  // open/update the range
@@ -106,10 +132,34 @@ OverlapRanges calculate_overlapping_ranges(
   const lanelet::ConstLanelets & path_lanelets, const lanelet::ConstLanelets & lanelets,
   const PlannerParam & params)
 {
+  // only the footprints whose box intersects the box of a lanelet can overlap it
+  const auto make_box = [](const auto & polygon) {
+    tier4_autoware_utils::Box2d box;
+    boost::geometry::assign_inverse(box);
+    for (const auto & p : polygon)
+      boost::geometry::expand(box, tier4_autoware_utils::Point2d(p.x(), p.y()));
+    return box;
+  };
+  std::vector<std::pair<tier4_autoware_utils::Box2d, size_t>> footprint_boxes;
+  footprint_boxes.reserve(path_footprints.size());
+  for (auto i = 0UL; i < path_footprints.size(); ++i)
+    footprint_boxes.emplace_back(make_box(path_footprints[i]), i);
+  const FootprintRtree footprint_rtree(footprint_boxes);
+
   OverlapRanges ranges;
+  std::vector<std::pair<tier4_autoware_utils::Box2d, size_t>> candidates;
+  std::vector<size_t> footprint_indices;
   for (auto & lanelet : lanelets) {
-    const auto lanelet_ranges =
-      calculate_overlapping_ranges(path_footprints, path_lanelets, lanelet, params);
+    candidates.clear();
+    footprint_rtree.query(
+      boost::geometry::index::intersects(make_box(lanelet.polygon2d().basicPolygon())),
+      std::back_inserter(candidates));
+    if (candidates.empty()) continue;
+    footprint_indices.clear();
+    for (const auto & candidate : candidates) footprint_indices.push_back(candidate.second);
+    std::sort(footprint_indices.begin(), footprint_indices.end());
+    const auto lanelet_ranges = calculate_overlapping_ranges(
+      path_footprints, footprint_indices, path_lanelets, lanelet, params);
     ranges.insert(ranges.end(), lanelet_ranges.begin(), lanelet_ranges.end());
   }
   return ranges;
@@ -54,7 +54,20 @@ OverlapRanges calculate_overlapping_ranges(
   const std::vector<lanelet::BasicPolygon2d> & path_footprints,
   const lanelet::ConstLanelets & path_lanelets, const lanelet::ConstLanelet & lanelet,
   const PlannerParam & params);
+/// @brief calculate the overlapping ranges between some of the path footprints and a lanelet
+/// @details the footprints not in footprint_indices are considered to not overlap the lanelet
+/// @param [in] path_footprints footprints used to calculate the overlaps
+/// @param [in] footprint_indices sorted indices of the footprints that may overlap the lanelet
+/// @param [in] path_lanelets path lanelets used to calculate arc length along the ego path
+/// @param [in] lanelet lanelet used to calculate the overlaps
+/// @param [in] params parameters
+/// @return the overlapping ranges found between the footprints and the lanelet
+OverlapRanges calculate_overlapping_ranges(
+  const std::vector<lanelet::BasicPolygon2d> & path_footprints,
+  const std::vector<size_t> & footprint_indices, const lanelet::ConstLanelets & path_lanelets,
+  const lanelet::ConstLanelet & lanelet, const PlannerParam & params);
 /// @brief calculate the overlapping ranges between the path footprints and some lanelets
+/// @details the footprints are only checked against the lanelets whose bounding box they intersect
 /// @param [in] path_footprints footprints used to calculate the overlaps
 /// @param [in] path_lanelets path lanelets used to calculate arc length along the ego path
 /// @param [in] lanelets lanelets used to calculate the overlaps
@@ -138,6 +138,8 @@ BehaviorVelocityPlannerNode::BehaviorVelocityPlannerNode(const rclcpp::NodeOptio
   // Parameters
   forward_path_length_ = this->declare_parameter<double>("forward_path_length");
   backward_path_length_ = this->declare_parameter<double>("backward_path_length");
+  no_ground_pointcloud_grid_size_ =
+    this->declare_parameter<double>("no_ground_pointcloud_grid_size");
   planner_data_.stop_line_extend_length =
     this->declare_parameter<double>("stop_line_extend_length");
 
@@ -148,6 +150,7 @@ BehaviorVelocityPlannerNode::BehaviorVelocityPlannerNode(const rclcpp::NodeOptio
     this->declare_parameter<double>("ego_nearest_yaw_threshold");
 
   // Initialize PlannerManager
+  planner_manager_.setPluginThreadNum(declare_parameter<int>("plugin_thread_num"));
   for (const auto & name : declare_parameter<std::vector<std::string>>("launch_modules")) {
     planner_manager_.launchScenePlugin(*this, name);
   }
@@ -219,15 +222,13 @@ bool BehaviorVelocityPlannerNode::isDataReady(
 void BehaviorVelocityPlannerNode::onOccupancyGrid(
   const nav_msgs::msg::OccupancyGrid::ConstSharedPtr msg)
 {
-  std::lock_guard<std::mutex> lock(mutex_);
-  planner_data_.occupancy_grid = msg;
+  occupancy_grid_mailbox_.store(msg);
 }
 
 void BehaviorVelocityPlannerNode::onPredictedObjects(
   const autoware_auto_perception_msgs::msg::PredictedObjects::ConstSharedPtr msg)
 {
-  std::lock_guard<std::mutex> lock(mutex_);
-  planner_data_.predicted_objects = msg;
+  predicted_objects_mailbox_.store(msg);
 }
 
 void BehaviorVelocityPlannerNode::onNoGroundPointCloud(
@@ -251,10 +252,9 @@ void BehaviorVelocityPlannerNode::onNoGroundPointCloud(
     tier4_autoware_utils::transformPointCloud(pc, *pc_transformed, affine);
   }
 
-  {
-    std::lock_guard<std::mutex> lock(mutex_);
-    planner_data_.no_ground_pointcloud = pc_transformed;
-  }
+  // the grid index is built here once so that the scene modules only query their own area
+  no_ground_pointcloud_mailbox_.store(
+    std::make_shared<const PointCloudGridIndex>(pc_transformed, no_ground_pointcloud_grid_size_));
 }
 
 void BehaviorVelocityPlannerNode::onOdometry(const nav_msgs::msg::Odometry::ConstSharedPtr msg)
@@ -293,8 +293,7 @@ void BehaviorVelocityPlannerNode::onOdometry(const nav_msgs::msg::Odometry::Cons
 void BehaviorVelocityPlannerNode::onAcceleration(
   const geometry_msgs::msg::AccelWithCovarianceStamped::ConstSharedPtr msg)
 {
-  std::lock_guard<std::mutex> lock(mutex_);
-  planner_data_.current_acceleration = msg;
+  current_acceleration_mailbox_.store(msg);
 }
 
 void BehaviorVelocityPlannerNode::onParam()
@@ -346,6 +345,14 @@ void BehaviorVelocityPlannerNode::onTrigger(
 {
   std::unique_lock<std::mutex> lk(mutex_);
 
+  planner_data_.predicted_objects = predicted_objects_mailbox_.load();
+  planner_data_.no_ground_pointcloud_index = no_ground_pointcloud_mailbox_.load();
+  planner_data_.no_ground_pointcloud = planner_data_.no_ground_pointcloud_index
+                                         ? planner_data_.no_ground_pointcloud_index->points()
+                                         : nullptr;
+  planner_data_.occupancy_grid = occupancy_grid_mailbox_.load();
+  planner_data_.current_acceleration = current_acceleration_mailbox_.load();
+
   if (!isDataReady(planner_data_, *get_clock())) {
     return;
   }
@@ -399,9 +406,15 @@ autoware_auto_planning_msgs::msg::Path BehaviorVelocityPlannerNode::generatePath
     return output_path_msg;
   }
 
+  // the lookups over the input path are shared by all the scene module managers
+  auto planner_data_ptr = std::make_shared<PlannerData>(planner_data);
+  planner_data_ptr->input_path_view = std::make_shared<const PathView>(
+    *input_path_msg, planner_data.route_handler_->getLaneletMapPtr(),
+    planner_data.current_odometry->pose);
+
   // Plan path velocity
-  const auto velocity_planned_path = planner_manager_.planPathVelocity(
-    std::make_shared<const PlannerData>(planner_data), *input_path_msg);
+  const auto velocity_planned_path =
+    planner_manager_.planPathVelocity(planner_data_ptr, *input_path_msg);
 
   // screening
   const auto filtered_path = filterLitterPathPoint(to_path(velocity_planned_path));
@@ -17,16 +17,19 @@
 
 #include "planner_manager.hpp"
 #include "tier4_autoware_utils/ros/logger_level_configure.hpp"
+#include "tier4_autoware_utils/system/latest_mailbox.hpp"
 
 #include <behavior_velocity_planner/srv/load_plugin.hpp>
 #include <behavior_velocity_planner/srv/unload_plugin.hpp>
 #include <behavior_velocity_planner_common/planner_data.hpp>
+#include <behavior_velocity_planner_common/utilization/pointcloud_grid_index.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_auto_mapping_msgs/msg/had_map_bin.hpp>
 #include <autoware_auto_perception_msgs/msg/predicted_objects.hpp>
 #include <autoware_auto_planning_msgs/msg/path.hpp>
 #include <autoware_auto_planning_msgs/msg/path_with_lane_id.hpp>
+#include <geometry_msgs/msg/accel_with_covariance_stamped.hpp>
 #include <nav_msgs/msg/occupancy_grid.hpp>
 #include <nav_msgs/msg/odometry.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
@@ -35,6 +38,8 @@
 #include <tier4_planning_msgs/msg/velocity_limit.hpp>
 #include <visualization_msgs/msg/marker_array.hpp>
 
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
 
@@ -48,6 +53,7 @@ namespace behavior_velocity_planner
 using autoware_auto_mapping_msgs::msg::HADMapBin;
 using behavior_velocity_planner::srv::LoadPlugin;
 using behavior_velocity_planner::srv::UnloadPlugin;
+using tier4_autoware_utils::LatestMailbox;
 using tier4_planning_msgs::msg::VelocityLimit;
 
 class BehaviorVelocityPlannerNode : public rclcpp::Node
@@ -102,9 +108,16 @@ private:
   //  parameter
   double forward_path_length_;
   double backward_path_length_;
+  double no_ground_pointcloud_grid_size_;
 
   // member
   PlannerData planner_data_;
+  // latest values of the high rate topics, written without locking mutex_ and copied to
+  // planner_data_ at the start of each planning cycle
+  LatestMailbox<autoware_auto_perception_msgs::msg::PredictedObjects> predicted_objects_mailbox_;
+  LatestMailbox<PointCloudGridIndex> no_ground_pointcloud_mailbox_;
+  LatestMailbox<nav_msgs::msg::OccupancyGrid> occupancy_grid_mailbox_;
+  LatestMailbox<geometry_msgs::msg::AccelWithCovarianceStamped> current_acceleration_mailbox_;
   BehaviorVelocityPlannerManager planner_manager_;
   bool is_driving_forward_{true};
   HADMapBin::ConstSharedPtr map_ptr_{nullptr};
@@ -14,10 +14,18 @@
 
 #include "planner_manager.hpp"
 
+#include <tier4_autoware_utils/geometry/geometry.hpp>
+
 #include <boost/format.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
 #include <memory>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace behavior_velocity_planner
 {
@@ -47,6 +55,76 @@ diagnostic_msgs::msg::DiagnosticStatus makeStopReasonDiag(
   stop_reason_diag.values.push_back(stop_reason_diag_kv);
   return stop_reason_diag;
 }
+
+std::vector<double> calcArcLengths(const autoware_auto_planning_msgs::msg::PathWithLaneId & path)
+{
+  std::vector<double> arc_lengths;
+  arc_lengths.reserve(path.points.size());
+  for (size_t i = 0; i < path.points.size(); ++i) {
+    arc_lengths.push_back(
+      i == 0 ? 0.0
+             : arc_lengths.back() +
+                 tier4_autoware_utils::calcDistance2d(path.points.at(i - 1), path.points.at(i)));
+  }
+  return arc_lengths;
+}
+
+/**
+ * @brief merge the paths planned by the plugins from the same input path.
+ * @details The points inserted by any plugin are kept, and the velocity of each point is the
+ * minimum of the velocities the plugins set at its arc length.
+ * @return the merged path and the arc length of its points.
+ */
+std::pair<autoware_auto_planning_msgs::msg::PathWithLaneId, std::vector<double>> mergePlannedPaths(
+  const autoware_auto_planning_msgs::msg::PathWithLaneId & input_path,
+  const std::vector<autoware_auto_planning_msgs::msg::PathWithLaneId> & planned_paths,
+  const std::vector<std::vector<double>> & planned_arc_lengths)
+{
+  // points closer than this are considered the same point.
+  constexpr double epsilon = 1e-3;
+
+  // the points of the earlier plugin come first at the same arc length.
+  std::vector<std::pair<double, const autoware_auto_planning_msgs::msg::PathPointWithLaneId *>>
+    points;
+  for (size_t i = 0; i < planned_paths.size(); ++i) {
+    for (size_t j = 0; j < planned_paths.at(i).points.size(); ++j) {
+      points.emplace_back(planned_arc_lengths.at(i).at(j), &planned_paths.at(i).points.at(j));
+    }
+  }
+  std::stable_sort(points.begin(), points.end(), [](const auto & a, const auto & b) {
+    return a.first < b.first;
+  });
+
+  auto merged_path = input_path;
+  merged_path.points.clear();
+  std::vector<double> merged_arc_lengths;
+  for (const auto & [arc_length, point] : points) {
+    if (!merged_arc_lengths.empty() && arc_length - merged_arc_lengths.back() < epsilon) {
+      continue;
+    }
+    merged_path.points.push_back(*point);
+    merged_path.points.back().point.longitudinal_velocity_mps = std::numeric_limits<float>::max();
+    merged_arc_lengths.push_back(arc_length);
+  }
+
+  // the velocity of a point is applied until the next point.
+  for (size_t i = 0; i < planned_paths.size(); ++i) {
+    const auto & planned_points = planned_paths.at(i).points;
+    const auto & arc_lengths = planned_arc_lengths.at(i);
+    size_t planned_idx = 0;
+    for (size_t j = 0; j < merged_path.points.size(); ++j) {
+      while (planned_idx + 1 < planned_points.size() &&
+             arc_lengths.at(planned_idx + 1) < merged_arc_lengths.at(j) + epsilon) {
+        ++planned_idx;
+      }
+      auto & velocity = merged_path.points.at(j).point.longitudinal_velocity_mps;
+      velocity =
+        std::min(velocity, planned_points.at(planned_idx).point.longitudinal_velocity_mps);
+    }
+  }
+
+  return {merged_path, merged_arc_lengths};
+}
 }  // namespace
 
 BehaviorVelocityPlannerManager::BehaviorVelocityPlannerManager()
@@ -105,6 +183,61 @@ autoware_auto_planning_msgs::msg::PathWithLaneId BehaviorVelocityPlannerManager:
   int first_stop_path_point_index = static_cast<int>(output_path_msg.points.size() - 1);
   std::string stop_reason_msg("path_end");
 
+  if (plugin_thread_num_ > 1 && scene_manager_plugins_.size() > 1) {
+    const auto plugin_num = scene_manager_plugins_.size();
+    for (const auto & plugin : scene_manager_plugins_) {
+      plugin->updateSceneModuleInstances(planner_data, input_path_msg);
+    }
+
+    // phase 1: each plugin plans on its own copy of the input path.
+    std::vector<autoware_auto_planning_msgs::msg::PathWithLaneId> planned_paths(
+      plugin_num, input_path_msg);
+    std::vector<std::vector<double>> planned_arc_lengths(plugin_num);
+    std::vector<boost::optional<int>> stop_indices(plugin_num);
+    std::atomic<size_t> next_plugin_idx{0};
+    const auto work = [&]() {
+      for (auto idx = next_plugin_idx++; idx < plugin_num; idx = next_plugin_idx++) {
+        const auto & plugin = scene_manager_plugins_.at(idx);
+        plugin->plan(&planned_paths.at(idx));
+        stop_indices.at(idx) = plugin->getFirstStopPathPointIndex();
+        planned_arc_lengths.at(idx) = calcArcLengths(planned_paths.at(idx));
+      }
+    };
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < std::min(plugin_thread_num_, plugin_num); ++i) {
+      workers.emplace_back(work);
+    }
+    work();
+    for (auto & worker : workers) {
+      worker.join();
+    }
+
+    // phase 2: merge the planned paths in the order of the plugins.
+    const auto [merged_path, merged_arc_lengths] =
+      mergePlannedPaths(input_path_msg, planned_paths, planned_arc_lengths);
+    output_path_msg = merged_path;
+    first_stop_path_point_index = static_cast<int>(output_path_msg.points.size() - 1);
+    for (size_t i = 0; i < plugin_num; ++i) {
+      if (!stop_indices.at(i)) {
+        continue;
+      }
+      const auto stop_arc_length = planned_arc_lengths.at(i).at(stop_indices.at(i).get());
+      const auto merged_idx = static_cast<int>(
+        std::lower_bound(
+          merged_arc_lengths.begin(), merged_arc_lengths.end(), stop_arc_length - 1e-3) -
+        merged_arc_lengths.begin());
+      if (merged_idx < first_stop_path_point_index) {
+        first_stop_path_point_index = merged_idx;
+        stop_reason_msg = scene_manager_plugins_.at(i)->getModuleName();
+      }
+    }
+
+    stop_reason_diag_ = makeStopReasonDiag(
+      stop_reason_msg, output_path_msg.points[first_stop_path_point_index].point.pose);
+
+    return output_path_msg;
+  }
+
   for (const auto & plugin : scene_manager_plugins_) {
     plugin->updateSceneModuleInstances(planner_data, input_path_msg);
     plugin->plan(&output_path_msg);
@@ -128,4 +261,9 @@ diagnostic_msgs::msg::DiagnosticStatus BehaviorVelocityPlannerManager::getStopRe
 {
   return stop_reason_diag_;
 }
+
+void BehaviorVelocityPlannerManager::setPluginThreadNum(const size_t plugin_thread_num)
+{
+  plugin_thread_num_ = std::max<size_t>(plugin_thread_num, 1);
+}
 }  // namespace behavior_velocity_planner
@@ -51,8 +51,16 @@ public:
 
   diagnostic_msgs::msg::DiagnosticStatus getStopReasonDiag() const;
 
+  /**
+   * @brief set the number of threads to plan the plugins with.
+   * @details With more than one thread, every plugin plans on its own copy of the input path in
+   * parallel, and the planned paths are merged taking the minimum velocity at each point.
+   */
+  void setPluginThreadNum(const size_t plugin_thread_num);
+
 private:
   diagnostic_msgs::msg::DiagnosticStatus stop_reason_diag_;
+  size_t plugin_thread_num_{1};
   pluginlib::ClassLoader<PluginInterface> plugin_loader_;
   std::vector<std::shared_ptr<PluginInterface>> scene_manager_plugins_;
 };
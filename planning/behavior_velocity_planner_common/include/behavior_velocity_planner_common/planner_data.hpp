@@ -17,6 +17,8 @@
 
 #include "route_handler/route_handler.hpp"
 
+#include <behavior_velocity_planner_common/utilization/path_view.hpp>
+#include <behavior_velocity_planner_common/utilization/pointcloud_grid_index.hpp>
 #include <behavior_velocity_planner_common/utilization/util.hpp>
 #include <motion_velocity_smoother/smoother/smoother_base.hpp>
 #include <vehicle_info_util/vehicle_info_util.hpp>
@@ -69,9 +71,14 @@ struct PlannerData
   std::deque<geometry_msgs::msg::TwistStamped> velocity_buffer;
   autoware_auto_perception_msgs::msg::PredictedObjects::ConstSharedPtr predicted_objects;
   pcl::PointCloud<pcl::PointXYZ>::ConstPtr no_ground_pointcloud;
+  // grid index over no_ground_pointcloud, built once for each received cloud
+  std::shared_ptr<const PointCloudGridIndex> no_ground_pointcloud_index;
   // occupancy grid
   nav_msgs::msg::OccupancyGrid::ConstSharedPtr occupancy_grid;
 
+  // lookups over the input path of the current cycle
+  std::shared_ptr<const PathView> input_path_view;
+
   // nearest search
   double ego_nearest_dist_threshold;
   double ego_nearest_yaw_threshold;
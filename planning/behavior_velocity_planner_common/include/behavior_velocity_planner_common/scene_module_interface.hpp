@@ -16,6 +16,7 @@
 #define BEHAVIOR_VELOCITY_PLANNER_COMMON__SCENE_MODULE_INTERFACE_HPP_
 
 #include <behavior_velocity_planner_common/planner_data.hpp>
+#include <behavior_velocity_planner_common/utilization/processing_time_statistics.hpp>
 #include <behavior_velocity_planner_common/velocity_factor_interface.hpp>
 #include <builtin_interfaces/msg/time.hpp>
 #include <motion_utils/marker/virtual_wall_marker_creator.hpp>
@@ -27,6 +28,7 @@
 #include <autoware_auto_planning_msgs/msg/path.hpp>
 #include <autoware_auto_planning_msgs/msg/path_with_lane_id.hpp>
 #include <tier4_debug_msgs/msg/float64_stamped.hpp>
+#include <tier4_debug_msgs/msg/int64_stamped.hpp>
 #include <tier4_planning_msgs/msg/stop_reason.hpp>
 #include <tier4_planning_msgs/msg/stop_reason_array.hpp>
 #include <tier4_v2x_msgs/msg/infrastructure_command_array.hpp>
@@ -50,6 +52,7 @@ using builtin_interfaces::msg::Time;
 using rtc_interface::RTCInterface;
 using tier4_autoware_utils::DebugPublisher;
 using tier4_debug_msgs::msg::Float64Stamped;
+using tier4_debug_msgs::msg::Int64Stamped;
 using tier4_planning_msgs::msg::StopFactor;
 using tier4_planning_msgs::msg::StopReason;
 using tier4_rtc_msgs::msg::Module;
@@ -155,6 +158,17 @@ protected:
   size_t findEgoSegmentIndex(
     const std::vector<autoware_auto_planning_msgs::msg::PathPointWithLaneId> & points) const;
 
+  // return the shared view of the input path, or a new view if the path is another one
+  std::shared_ptr<const PathView> getPathView(
+    const autoware_auto_planning_msgs::msg::PathWithLaneId & path) const;
+
+  // accumulate the processing times of a scene module into the ones of the current cycle
+  void addSceneModuleProcessingTime(
+    const int64_t module_id, const double plan_time_ms, const double debug_marker_time_ms);
+
+  // publish the processing times of the current cycle and reset them
+  void publishProcessingTimes(const double processing_time_ms);
+
   std::set<std::shared_ptr<SceneModuleInterface>> scene_modules_;
   std::set<int64_t> registered_module_id_set_;
 
@@ -177,6 +191,19 @@ protected:
     pub_infrastructure_commands_;
 
   std::shared_ptr<DebugPublisher> processing_time_publisher_;
+
+  // processing times of the current cycle, the plan and debug marker times are summed over the
+  // scene modules
+  struct ProcessingTimes
+  {
+    double update_time_ms{0.0};
+    double plan_time_ms{0.0};
+    double debug_marker_time_ms{0.0};
+    double slowest_scene_module_time_ms{0.0};
+    int64_t slowest_scene_module_id{-1};
+  };
+  ProcessingTimes processing_times_;
+  ProcessingTimeStatistics processing_time_statistics_;
 };
 
 class SceneModuleManagerInterfaceWithRTC : public SceneModuleManagerInterface
@@ -0,0 +1,152 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__PATH_VIEW_HPP_
+#define BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__PATH_VIEW_HPP_
+
+#include <autoware_auto_planning_msgs/msg/path_with_lane_id.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <boost/optional.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace behavior_velocity_planner
+{
+/**
+ * @brief immutable lookups over the input path of a planning cycle
+ * @details The arc lengths, the lane ids and the lanelets on the path are computed once when the
+ * path is received, and shared by the scene module managers through PlannerData instead of being
+ * recomputed from the path points by each of them.
+ */
+class PathView
+{
+public:
+  using PathWithLaneId = autoware_auto_planning_msgs::msg::PathWithLaneId;
+
+  PathView(
+    const PathWithLaneId & path, const lanelet::LaneletMapPtr lanelet_map,
+    const geometry_msgs::msg::Pose & current_pose);
+
+  /**
+   * @brief return true if the view was built from the given path object
+   * @details Only the address is compared, so a view must not be used past the lifetime of its
+   * path.
+   */
+  bool isViewOf(const PathWithLaneId & path) const { return &path == path_; }
+
+  size_t size() const { return arc_lengths_.size(); }
+
+  /**
+   * @brief arc length from the first point of the path to the given point
+   */
+  double getArcLength(const size_t idx) const { return arc_lengths_.at(idx); }
+
+  /**
+   * @brief same as motion_utils::calcSignedArcLength(points, src_idx, dst_idx) in O(1)
+   */
+  double calcSignedArcLength(const size_t src_idx, const size_t dst_idx) const
+  {
+    return arc_lengths_.at(dst_idx) - arc_lengths_.at(src_idx);
+  }
+
+  /**
+   * @brief index of the segment containing the given arc length, clamped to the path
+   */
+  size_t getSegmentIndexAtArcLength(const double arc_length) const;
+
+  /**
+   * @brief lane ids of the path in the order they first appear, as getSortedLaneIdsFromPath()
+   */
+  const std::vector<int64_t> & getSortedLaneIds() const { return sorted_lane_ids_; }
+
+  /**
+   * @brief indices of the first and the last points having the given lane id
+   */
+  boost::optional<std::pair<size_t, size_t>> getLaneIdInterval(const int64_t lane_id) const;
+
+  const boost::optional<int64_t> & getNearestLaneId() const { return nearest_lane_id_; }
+
+  /**
+   * @brief lanelets of the path from the nearest lanelet to ego, as getLaneletsOnPath()
+   */
+  const std::vector<lanelet::ConstLanelet> & getLaneletsOnPath() const { return lanelets_on_path_; }
+
+  std::set<int64_t> getLaneIdSetOnPath() const;
+
+  template <class T>
+  std::unordered_map<typename std::shared_ptr<const T>, lanelet::ConstLanelet> getRegElemMapOnPath()
+    const
+  {
+    std::unordered_map<typename std::shared_ptr<const T>, lanelet::ConstLanelet> reg_elem_map;
+    for (const auto & ll : lanelets_on_path_) {
+      for (const auto & reg_elem : ll.regulatoryElementsAs<const T>()) {
+        reg_elem_map.insert(std::make_pair(reg_elem, ll));
+      }
+    }
+    return reg_elem_map;
+  }
+
+private:
+  const PathWithLaneId * path_;
+  std::vector<double> arc_lengths_;
+  std::vector<int64_t> sorted_lane_ids_;
+  std::unordered_map<int64_t, std::pair<size_t, size_t>> lane_id_intervals_;
+  boost::optional<int64_t> nearest_lane_id_;
+  std::vector<lanelet::ConstLanelet> lanelets_on_path_;
+};
+
+namespace planning_utils
+{
+std::vector<lanelet::ConstLanelet> getLaneletsOnPath(const PathView & path_view);
+
+std::set<int64_t> getLaneIdSetOnPath(const PathView & path_view);
+
+template <class T>
+std::unordered_map<typename std::shared_ptr<const T>, lanelet::ConstLanelet> getRegElemMapOnPath(
+  const PathView & path_view)
+{
+  return path_view.getRegElemMapOnPath<T>();
+}
+
+template <class T>
+std::set<int64_t> getRegElemIdSetOnPath(const PathView & path_view)
+{
+  std::set<int64_t> reg_elem_id_set;
+  for (const auto & m : path_view.getRegElemMapOnPath<const T>()) {
+    reg_elem_id_set.insert(m.first->id());
+  }
+  return reg_elem_id_set;
+}
+
+template <class T>
+std::set<int64_t> getLaneletIdSetOnPath(const PathView & path_view)
+{
+  std::set<int64_t> id_set;
+  for (const auto & m : path_view.getRegElemMapOnPath<const T>()) {
+    id_set.insert(m.second.id());
+  }
+  return id_set;
+}
+}  // namespace planning_utils
+}  // namespace behavior_velocity_planner
+
+#endif  // BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__PATH_VIEW_HPP_
@@ -0,0 +1,60 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__POINTCLOUD_GRID_INDEX_HPP_
+#define BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__POINTCLOUD_GRID_INDEX_HPP_
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace behavior_velocity_planner
+{
+/**
+ * @brief points of a cloud bucketed by the 2D cells of a grid
+ * @details Only the cells with points are stored, so the index covers the whole cloud whatever its
+ * extent. It is built once for each received cloud and shared by the scene modules, which query
+ * the points around their own area instead of iterating over the whole cloud.
+ */
+class PointCloudGridIndex
+{
+public:
+  using PointCloud = pcl::PointCloud<pcl::PointXYZ>;
+
+  PointCloudGridIndex(const PointCloud::ConstPtr & points, const double cell_size);
+
+  const PointCloud::ConstPtr & points() const { return points_; }
+
+  /**
+   * @brief get the indices of the points in the cells overlapping the box, in ascending order
+   * @details Points outside of the box but in the same cells are included, so the caller still has
+   * to check the points against its own area.
+   */
+  std::vector<size_t> getPointIndicesInBox(
+    const double min_x, const double min_y, const double max_x, const double max_y) const;
+
+private:
+  int64_t toCell(const double coordinate) const;
+  static int64_t toKey(const int64_t cell_x, const int64_t cell_y);
+
+  PointCloud::ConstPtr points_;
+  double cell_size_;
+  std::unordered_map<int64_t, std::vector<size_t>> cells_;
+};
+}  // namespace behavior_velocity_planner
+
+#endif  // BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__POINTCLOUD_GRID_INDEX_HPP_
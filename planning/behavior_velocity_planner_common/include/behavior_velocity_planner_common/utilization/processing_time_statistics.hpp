@@ -0,0 +1,45 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__PROCESSING_TIME_STATISTICS_HPP_
+#define BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__PROCESSING_TIME_STATISTICS_HPP_
+
+#include <cstddef>
+#include <deque>
+
+namespace behavior_velocity_planner
+{
+/**
+ * @brief percentiles of the processing times over a rolling window of the latest cycles
+ */
+class ProcessingTimeStatistics
+{
+public:
+  explicit ProcessingTimeStatistics(const size_t window_size);
+
+  void add(const double processing_time_ms);
+
+  /**
+   * @brief nearest-rank percentile of the processing times in the window, 0 if it is empty
+   * @param ratio ratio in [0, 1] of the processing times lower than or equal to the result
+   */
+  double getPercentile(const double ratio) const;
+
+private:
+  size_t window_size_;
+  std::deque<double> processing_times_ms_;
+};
+}  // namespace behavior_velocity_planner
+
+#endif  // BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__PROCESSING_TIME_STATISTICS_HPP_
@@ -15,6 +15,7 @@
 #include <behavior_velocity_planner_common/scene_module_interface.hpp>
 #include <behavior_velocity_planner_common/utilization/util.hpp>
 #include <motion_utils/trajectory/trajectory.hpp>
+#include <tier4_autoware_utils/ros/parameter.hpp>
 #include <tier4_autoware_utils/ros/uuid_helper.hpp>
 #include <tier4_autoware_utils/system/stop_watch.hpp>
 
@@ -47,7 +48,11 @@ size_t SceneModuleInterface::findEgoSegmentIndex(
 
 SceneModuleManagerInterface::SceneModuleManagerInterface(
   rclcpp::Node & node, [[maybe_unused]] const char * module_name)
-: node_(node), clock_(node.get_clock()), logger_(node.get_logger())
+: node_(node),
+  clock_(node.get_clock()),
+  logger_(node.get_logger()),
+  processing_time_statistics_(
+    tier4_autoware_utils::getOrDeclareParameter<int>(node, "processing_time_window_size"))
 {
   const auto ns = std::string("~/debug/") + module_name;
   pub_debug_ = node.create_publisher<visualization_msgs::msg::MarkerArray>(ns, 1);
@@ -81,14 +86,64 @@ size_t SceneModuleManagerInterface::findEgoSegmentIndex(
     points, p->current_odometry->pose, p->ego_nearest_dist_threshold, p->ego_nearest_yaw_threshold);
 }
 
+std::shared_ptr<const PathView> SceneModuleManagerInterface::getPathView(
+  const autoware_auto_planning_msgs::msg::PathWithLaneId & path) const
+{
+  const auto & p = planner_data_;
+  if (p->input_path_view && p->input_path_view->isViewOf(path)) {
+    return p->input_path_view;
+  }
+  return std::make_shared<const PathView>(
+    path, p->route_handler_->getLaneletMapPtr(), p->current_odometry->pose);
+}
+
+void SceneModuleManagerInterface::addSceneModuleProcessingTime(
+  const int64_t module_id, const double plan_time_ms, const double debug_marker_time_ms)
+{
+  auto & t = processing_times_;
+  t.plan_time_ms += plan_time_ms;
+  t.debug_marker_time_ms += debug_marker_time_ms;
+  if (t.slowest_scene_module_id < 0 || plan_time_ms > t.slowest_scene_module_time_ms) {
+    t.slowest_scene_module_time_ms = plan_time_ms;
+    t.slowest_scene_module_id = module_id;
+  }
+}
+
+void SceneModuleManagerInterface::publishProcessingTimes(const double processing_time_ms)
+{
+  const auto & t = processing_times_;
+  const auto ns = std::string(getModuleName()) + "/";
+  const auto total_time_ms = t.update_time_ms + processing_time_ms;
+  processing_time_statistics_.add(total_time_ms);
+  processing_time_publisher_->publish<Float64Stamped>(
+    ns + "processing_time_ms", processing_time_ms);
+  processing_time_publisher_->publish<Float64Stamped>(ns + "update_time_ms", t.update_time_ms);
+  processing_time_publisher_->publish<Float64Stamped>(ns + "plan_time_ms", t.plan_time_ms);
+  processing_time_publisher_->publish<Float64Stamped>(
+    ns + "debug_marker_time_ms", t.debug_marker_time_ms);
+  processing_time_publisher_->publish<Float64Stamped>(
+    ns + "slowest_scene_module_time_ms", t.slowest_scene_module_time_ms);
+  processing_time_publisher_->publish<Int64Stamped>(
+    ns + "slowest_scene_module_id", t.slowest_scene_module_id);
+  processing_time_publisher_->publish<Float64Stamped>(ns + "total_time_ms", total_time_ms);
+  processing_time_publisher_->publish<Float64Stamped>(
+    ns + "total_time_ms_p50", processing_time_statistics_.getPercentile(0.5));
+  processing_time_publisher_->publish<Float64Stamped>(
+    ns + "total_time_ms_p99", processing_time_statistics_.getPercentile(0.99));
+  processing_times_ = ProcessingTimes{};
+}
+
 void SceneModuleManagerInterface::updateSceneModuleInstances(
   const std::shared_ptr<const PlannerData> & planner_data,
   const autoware_auto_planning_msgs::msg::PathWithLaneId & path)
 {
+  StopWatch<std::chrono::milliseconds> stop_watch;
+  stop_watch.tic("Total");
   planner_data_ = planner_data;
 
   launchNewModules(path);
   deleteExpiredModules(path);
+  processing_times_.update_time_ms = stop_watch.toc("Total");
 }
 
 void SceneModuleManagerInterface::modifyPathVelocity(
@@ -107,12 +162,17 @@ void SceneModuleManagerInterface::modifyPathVelocity(
   tier4_v2x_msgs::msg::InfrastructureCommandArray infrastructure_command_array;
   infrastructure_command_array.stamp = clock_->now();
 
+  // the debug markers are only built when someone looks at them
+  const bool is_debug_subscribed = tier4_autoware_utils::hasSubscription(*pub_debug_);
+
   first_stop_path_point_index_ = static_cast<int>(path->points.size()) - 1;
   for (const auto & scene_module : scene_modules_) {
     tier4_planning_msgs::msg::StopReason stop_reason;
     scene_module->resetVelocityFactor();
     scene_module->setPlannerData(planner_data_);
+    stop_watch.tic("SceneModule");
     scene_module->modifyPathVelocity(path, &stop_reason);
+    const auto plan_time_ms = stop_watch.toc("SceneModule", true);
 
     // The velocity factor must be called after modifyPathVelocity.
     const auto velocity_factor = scene_module->getVelocityFactor();
@@ -131,11 +191,15 @@ void SceneModuleManagerInterface::modifyPathVelocity(
       first_stop_path_point_index_ = scene_module->getFirstStopPathPointIndex();
     }
 
-    for (const auto & marker : scene_module->createDebugMarkerArray().markers) {
-      debug_marker_array.markers.push_back(marker);
+    if (is_debug_subscribed) {
+      for (const auto & marker : scene_module->createDebugMarkerArray().markers) {
+        debug_marker_array.markers.push_back(marker);
+      }
     }
 
     virtual_wall_marker_creator_.add_virtual_walls(scene_module->createVirtualWalls());
+    addSceneModuleProcessingTime(
+      scene_module->getModuleId(), plan_time_ms, stop_watch.toc("SceneModule"));
   }
 
   if (!stop_reason_array.stop_reasons.empty()) {
@@ -143,7 +207,9 @@ void SceneModuleManagerInterface::modifyPathVelocity(
   }
   pub_velocity_factor_->publish(velocity_factor_array);
   pub_infrastructure_commands_->publish(infrastructure_command_array);
-  pub_debug_->publish(debug_marker_array);
+  if (is_debug_subscribed) {
+    pub_debug_->publish(debug_marker_array);
+  }
   if (is_publish_debug_path_) {
     autoware_auto_planning_msgs::msg::PathWithLaneId debug_path;
     debug_path.header = path->header;
@@ -151,8 +217,7 @@ void SceneModuleManagerInterface::modifyPathVelocity(
     pub_debug_path_->publish(debug_path);
   }
   pub_virtual_wall_->publish(virtual_wall_marker_creator_.create_markers(clock_->now()));
-  processing_time_publisher_->publish<Float64Stamped>(
-    std::string(getModuleName()) + "/processing_time_ms", stop_watch.toc("Total"));
+  publishProcessingTimes(stop_watch.toc("Total"));
 }
 
 void SceneModuleManagerInterface::deleteExpiredModules(
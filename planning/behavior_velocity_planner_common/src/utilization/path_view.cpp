@@ -0,0 +1,101 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <behavior_velocity_planner_common/utilization/path_view.hpp>
+#include <lanelet2_extension/utility/query.hpp>
+#include <tier4_autoware_utils/geometry/geometry.hpp>
+
+#include <algorithm>
+
+namespace behavior_velocity_planner
+{
+PathView::PathView(
+  const PathWithLaneId & path, const lanelet::LaneletMapPtr lanelet_map,
+  const geometry_msgs::msg::Pose & current_pose)
+: path_(&path)
+{
+  arc_lengths_.reserve(path.points.size());
+  for (size_t i = 0; i < path.points.size(); ++i) {
+    const auto & p = path.points.at(i);
+    const double segment_length =
+      i == 0 ? 0.0 : tier4_autoware_utils::calcDistance2d(path.points.at(i - 1), p);
+    arc_lengths_.push_back(i == 0 ? 0.0 : arc_lengths_.back() + segment_length);
+    for (const auto lane_id : p.lane_ids) {
+      const auto [itr, is_new] = lane_id_intervals_.emplace(lane_id, std::make_pair(i, i));
+      if (is_new) {
+        sorted_lane_ids_.push_back(lane_id);
+      } else {
+        itr->second.second = i;
+      }
+    }
+  }
+
+  // same as getNearestLaneId() and getLaneletsOnPath()
+  lanelet::ConstLanelets lanes;
+  for (const auto lane_id : sorted_lane_ids_) {
+    lanes.push_back(lanelet_map->laneletLayer.get(lane_id));
+  }
+  lanelet::Lanelet closest_lane;
+  if (lanelet::utils::query::getClosestLanelet(lanes, current_pose, &closest_lane)) {
+    nearest_lane_id_ = closest_lane.id();
+  }
+  const auto first_lane =
+    nearest_lane_id_ ? std::find_if(
+                         lanes.begin(), lanes.end(),
+                         [&](const auto & lane) { return lane.id() == *nearest_lane_id_; })
+                     : lanes.begin();
+  lanelets_on_path_.assign(first_lane, lanes.end());
+}
+
+size_t PathView::getSegmentIndexAtArcLength(const double arc_length) const
+{
+  if (arc_lengths_.size() < 2) {
+    return 0;
+  }
+  const auto itr = std::upper_bound(arc_lengths_.begin(), arc_lengths_.end(), arc_length);
+  const auto idx = static_cast<size_t>(std::max<std::ptrdiff_t>(itr - arc_lengths_.begin(), 1));
+  return std::min(idx - 1, arc_lengths_.size() - 2);
+}
+
+boost::optional<std::pair<size_t, size_t>> PathView::getLaneIdInterval(const int64_t lane_id) const
+{
+  const auto itr = lane_id_intervals_.find(lane_id);
+  if (itr == lane_id_intervals_.end()) {
+    return boost::none;
+  }
+  return itr->second;
+}
+
+std::set<int64_t> PathView::getLaneIdSetOnPath() const
+{
+  std::set<int64_t> lane_id_set;
+  for (const auto & lane : lanelets_on_path_) {
+    lane_id_set.insert(lane.id());
+  }
+  return lane_id_set;
+}
+
+namespace planning_utils
+{
+std::vector<lanelet::ConstLanelet> getLaneletsOnPath(const PathView & path_view)
+{
+  return path_view.getLaneletsOnPath();
+}
+
+std::set<int64_t> getLaneIdSetOnPath(const PathView & path_view)
+{
+  return path_view.getLaneIdSetOnPath();
+}
+}  // namespace planning_utils
+}  // namespace behavior_velocity_planner
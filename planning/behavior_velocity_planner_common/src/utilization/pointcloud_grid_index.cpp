@@ -0,0 +1,90 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <behavior_velocity_planner_common/utilization/pointcloud_grid_index.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace behavior_velocity_planner
+{
+PointCloudGridIndex::PointCloudGridIndex(
+  const PointCloud::ConstPtr & points, const double cell_size)
+: points_(points), cell_size_(cell_size)
+{
+  if (cell_size_ <= 0.0) {
+    throw std::invalid_argument("cell size of the point cloud grid index should be positive");
+  }
+  if (!points_) {
+    return;
+  }
+  for (size_t i = 0; i < points_->size(); ++i) {
+    const auto & p = points_->at(i);
+    if (!std::isfinite(p.x) || !std::isfinite(p.y)) {
+      continue;
+    }
+    cells_[toKey(toCell(p.x), toCell(p.y))].push_back(i);
+  }
+}
+
+std::vector<size_t> PointCloudGridIndex::getPointIndicesInBox(
+  const double min_x, const double min_y, const double max_x, const double max_y) const
+{
+  std::vector<size_t> indices;
+  if (cells_.empty() || min_x > max_x || min_y > max_y) {
+    return indices;
+  }
+
+  const int64_t begin_x = toCell(min_x);
+  const int64_t begin_y = toCell(min_y);
+  const int64_t end_x = toCell(max_x);
+  const int64_t end_y = toCell(max_y);
+  const auto nb_box_cells = static_cast<double>(end_x - begin_x + 1) * (end_y - begin_y + 1);
+  if (nb_box_cells <= static_cast<double>(cells_.size())) {
+    for (int64_t x = begin_x; x <= end_x; ++x) {
+      for (int64_t y = begin_y; y <= end_y; ++y) {
+        const auto cell = cells_.find(toKey(x, y));
+        if (cell != cells_.end()) {
+          indices.insert(indices.end(), cell->second.begin(), cell->second.end());
+        }
+      }
+    }
+  } else {
+    // the box is larger than the cloud, visit the cells with points instead
+    for (const auto & [key, cell_indices] : cells_) {
+      const auto & p = points_->at(cell_indices.front());
+      const int64_t x = toCell(p.x);
+      const int64_t y = toCell(p.y);
+      if (begin_x <= x && x <= end_x && begin_y <= y && y <= end_y) {
+        indices.insert(indices.end(), cell_indices.begin(), cell_indices.end());
+      }
+    }
+  }
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+
+int64_t PointCloudGridIndex::toCell(const double coordinate) const
+{
+  return static_cast<int64_t>(std::floor(coordinate / cell_size_));
+}
+
+int64_t PointCloudGridIndex::toKey(const int64_t cell_x, const int64_t cell_y)
+{
+  return static_cast<int64_t>(
+    (static_cast<uint64_t>(static_cast<uint32_t>(cell_x)) << 32) |
+    static_cast<uint32_t>(cell_y));
+}
+}  // namespace behavior_velocity_planner
@@ -0,0 +1,48 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <behavior_velocity_planner_common/utilization/processing_time_statistics.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace behavior_velocity_planner
+{
+ProcessingTimeStatistics::ProcessingTimeStatistics(const size_t window_size)
+: window_size_(std::max<size_t>(window_size, 1))
+{
+}
+
+void ProcessingTimeStatistics::add(const double processing_time_ms)
+{
+  processing_times_ms_.push_back(processing_time_ms);
+  while (processing_times_ms_.size() > window_size_) {
+    processing_times_ms_.pop_front();
+  }
+}
+
+double ProcessingTimeStatistics::getPercentile(const double ratio) const
+{
+  if (processing_times_ms_.empty()) {
+    return 0.0;
+  }
+  std::vector<double> sorted_times(processing_times_ms_.begin(), processing_times_ms_.end());
+  const auto rank =
+    static_cast<size_t>(std::ceil(std::clamp(ratio, 0.0, 1.0) * sorted_times.size()));
+  const auto nth = sorted_times.begin() + std::max<size_t>(rank, 1) - 1;
+  std::nth_element(sorted_times.begin(), nth, sorted_times.end());
+  return *nth;
+}
+}  // namespace behavior_velocity_planner
@@ -0,0 +1,110 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "motion_utils/trajectory/trajectory.hpp"
+#include "utils.hpp"
+
+#include <behavior_velocity_planner_common/utilization/path_view.hpp>
+#include <behavior_velocity_planner_common/utilization/util.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+#include <lanelet2_core/utility/Utilities.h>
+
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace
+{
+lanelet::Lanelet generateLanelet(const lanelet::Id id, const double x0, const double x1)
+{
+  const lanelet::LineString3d left(
+    lanelet::utils::getId(), {lanelet::Point3d(lanelet::utils::getId(), x0, 1.0, 0.0),
+                              lanelet::Point3d(lanelet::utils::getId(), x1, 1.0, 0.0)});
+  const lanelet::LineString3d right(
+    lanelet::utils::getId(), {lanelet::Point3d(lanelet::utils::getId(), x0, -1.0, 0.0),
+                              lanelet::Point3d(lanelet::utils::getId(), x1, -1.0, 0.0)});
+  return lanelet::Lanelet(id, left, right);
+}
+
+// straight path along three lanelets of 10m, the point at the border has the ids of both lanelets
+autoware_auto_planning_msgs::msg::PathWithLaneId generatePathOnLanelets()
+{
+  auto path = test::generatePath(0.0, 0.0, 29.0, 0.0, 30);
+  for (size_t i = 0; i < path.points.size(); ++i) {
+    path.points.at(i).lane_ids.push_back(1000 + i / 10);
+    if (i == 10) {
+      path.points.at(i).lane_ids = {1000, 1001};
+    }
+  }
+  return path;
+}
+}  // namespace
+
+TEST(PathView, arcLength)
+{
+  using behavior_velocity_planner::PathView;
+  const auto lanelet_map = std::make_shared<lanelet::LaneletMap>();
+  for (int i = 0; i < 3; ++i) {
+    lanelet_map->add(generateLanelet(1000 + i, 10.0 * i, 10.0 * (i + 1)));
+  }
+  const auto path = generatePathOnLanelets();
+  const PathView path_view(path, lanelet_map, test::generatePose(15.0));
+
+  EXPECT_TRUE(path_view.isViewOf(path));
+  EXPECT_FALSE(path_view.isViewOf(generatePathOnLanelets()));
+  ASSERT_EQ(path_view.size(), path.points.size());
+  for (size_t i = 0; i < path.points.size(); i += 7) {
+    for (size_t j = 0; j < path.points.size(); j += 5) {
+      EXPECT_NEAR(
+        path_view.calcSignedArcLength(i, j), motion_utils::calcSignedArcLength(path.points, i, j),
+        1e-6);
+    }
+  }
+  EXPECT_EQ(path_view.getSegmentIndexAtArcLength(-1.0), 0u);
+  EXPECT_EQ(path_view.getSegmentIndexAtArcLength(0.0), 0u);
+  EXPECT_EQ(path_view.getSegmentIndexAtArcLength(12.5), 12u);
+  EXPECT_EQ(path_view.getSegmentIndexAtArcLength(29.0), 28u);
+  EXPECT_EQ(path_view.getSegmentIndexAtArcLength(100.0), 28u);
+}
+
+TEST(PathView, laneIds)
+{
+  using behavior_velocity_planner::PathView;
+  namespace planning_utils = behavior_velocity_planner::planning_utils;
+  const auto lanelet_map = std::make_shared<lanelet::LaneletMap>();
+  for (int i = 0; i < 3; ++i) {
+    lanelet_map->add(generateLanelet(1000 + i, 10.0 * i, 10.0 * (i + 1)));
+  }
+  const auto path = generatePathOnLanelets();
+  const auto current_pose = test::generatePose(15.0);
+  const PathView path_view(path, lanelet_map, current_pose);
+
+  EXPECT_EQ(path_view.getSortedLaneIds(), planning_utils::getSortedLaneIdsFromPath(path));
+  EXPECT_EQ(path_view.getLaneIdInterval(1000), std::make_pair(size_t{0}, size_t{10}));
+  EXPECT_EQ(path_view.getLaneIdInterval(1001), std::make_pair(size_t{10}, size_t{19}));
+  EXPECT_EQ(path_view.getLaneIdInterval(1002), std::make_pair(size_t{20}, size_t{29}));
+  EXPECT_FALSE(path_view.getLaneIdInterval(1003));
+
+  // same lanelets as the functions computing them from the path
+  EXPECT_EQ(
+    path_view.getNearestLaneId(),
+    planning_utils::getNearestLaneId(path, lanelet_map, current_pose));
+  EXPECT_EQ(
+    planning_utils::getLaneIdSetOnPath(path_view),
+    planning_utils::getLaneIdSetOnPath(path, lanelet_map, current_pose));
+  EXPECT_EQ(planning_utils::getLaneIdSetOnPath(path_view), (std::set<int64_t>{1001, 1002}));
+}
@@ -0,0 +1,58 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <behavior_velocity_planner_common/utilization/pointcloud_grid_index.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using behavior_velocity_planner::PointCloudGridIndex;
+
+TEST(PointCloudGridIndex, getPointIndicesInBox)
+{
+  auto points = std::make_shared<PointCloudGridIndex::PointCloud>();
+  for (int x = -10; x < 10; ++x) {
+    for (int y = -10; y < 10; ++y) {
+      points->emplace_back(x + 0.5, y + 0.5, 0.0);
+    }
+  }
+  const PointCloudGridIndex index(points, 2.0);
+
+  // every point in the box is found, in the order of the cloud
+  const auto indices = index.getPointIndicesInBox(-1.0, -1.0, 3.0, 1.0);
+  std::vector<size_t> expected_indices;
+  for (size_t i = 0; i < points->size(); ++i) {
+    const auto & p = points->at(i);
+    if (-1.0 <= p.x && p.x <= 3.0 && -1.0 <= p.y && p.y <= 1.0) {
+      expected_indices.push_back(i);
+    }
+  }
+  std::vector<size_t> indices_in_box;
+  for (const auto i : indices) {
+    const auto & p = points->at(i);
+    if (-1.0 <= p.x && p.x <= 3.0 && -1.0 <= p.y && p.y <= 1.0) {
+      indices_in_box.push_back(i);
+    }
+  }
+  EXPECT_EQ(indices_in_box, expected_indices);
+  EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+
+  // a box larger than the cloud returns all the points
+  EXPECT_EQ(index.getPointIndicesInBox(-1e3, -1e3, 1e3, 1e3).size(), points->size());
+  // a box away from the cloud returns nothing
+  EXPECT_TRUE(index.getPointIndicesInBox(100.0, 100.0, 101.0, 101.0).empty());
+}
@@ -0,0 +1,49 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <behavior_velocity_planner_common/utilization/processing_time_statistics.hpp>
+
+#include <gtest/gtest.h>
+
+using behavior_velocity_planner::ProcessingTimeStatistics;
+
+TEST(ProcessingTimeStatistics, getPercentile)
+{
+  ProcessingTimeStatistics statistics(100);
+  EXPECT_DOUBLE_EQ(statistics.getPercentile(0.5), 0.0);
+
+  // 1, 2, ..., 100 in a shuffled order
+  for (int i = 0; i < 100; ++i) {
+    statistics.add((i * 37) % 100 + 1);
+  }
+  EXPECT_DOUBLE_EQ(statistics.getPercentile(0.0), 1.0);
+  EXPECT_DOUBLE_EQ(statistics.getPercentile(0.5), 50.0);
+  EXPECT_DOUBLE_EQ(statistics.getPercentile(0.99), 99.0);
+  EXPECT_DOUBLE_EQ(statistics.getPercentile(1.0), 100.0);
+}
+
+TEST(ProcessingTimeStatistics, rollingWindow)
+{
+  ProcessingTimeStatistics statistics(3);
+  statistics.add(100.0);
+  for (int i = 0; i < 3; ++i) {
+    statistics.add(1.0);
+  }
+  // the spike is out of the window
+  EXPECT_DOUBLE_EQ(statistics.getPercentile(1.0), 1.0);
+
+  statistics.add(10.0);
+  EXPECT_DOUBLE_EQ(statistics.getPercentile(0.5), 1.0);
+  EXPECT_DOUBLE_EQ(statistics.getPercentile(0.99), 10.0);
+}
@@ -119,11 +119,11 @@ public:
   visualization_msgs::msg::MarkerArray createVisualizationMarkerArray();
   void setHeight(const double height);
   motion_utils::VirtualWalls createVirtualWalls();
+  void clearDebugMarker();
 
 private:
   visualization_msgs::msg::MarkerArray createVisualizationMarkerArrayFromDebugData(
     const builtin_interfaces::msg::Time & current_time);
-  void clearDebugMarker();
 
   rclcpp::Node & node_;
   rclcpp::Publisher<Float32MultiArrayStamped>::SharedPtr pub_debug_values_;
@@ -67,6 +67,9 @@ bool RunOutModule::modifyPathVelocity(
   const auto current_acc = planner_data_->current_acceleration->accel.accel.linear.x;
   const auto & current_pose = planner_data_->current_odometry->pose;
 
+  // the debug data is not cleared by createDebugMarkerArray() if the markers are not subscribed
+  debug_ptr_->clearDebugMarker();
+
   // set height of debug data
   debug_ptr_->setHeight(current_pose.position.z);
 
@@ -56,9 +56,8 @@ SpeedBumpModuleManager::SpeedBumpModuleManager(rclcpp::Node & node)
 void SpeedBumpModuleManager::launchNewModules(
   const autoware_auto_planning_msgs::msg::PathWithLaneId & path)
 {
-  for (const auto & speed_bump_with_lane_id : planning_utils::getRegElemMapOnPath<SpeedBump>(
-         path, planner_data_->route_handler_->getLaneletMapPtr(),
-         planner_data_->current_odometry->pose)) {
+  for (const auto & speed_bump_with_lane_id :
+       planning_utils::getRegElemMapOnPath<SpeedBump>(*getPathView(path))) {
     const auto lane_id = speed_bump_with_lane_id.second.id();
     const auto module_id = speed_bump_with_lane_id.first->id();
     if (!isModuleRegistered(module_id)) {
@@ -73,8 +72,8 @@ std::function<bool(const std::shared_ptr<SceneModuleInterface> &)>
 SpeedBumpModuleManager::getModuleExpiredFunction(
   const autoware_auto_planning_msgs::msg::PathWithLaneId & path)
 {
-  const auto speed_bump_id_set = planning_utils::getRegElemIdSetOnPath<SpeedBump>(
-    path, planner_data_->route_handler_->getLaneletMapPtr(), planner_data_->current_odometry->pose);
+  const auto speed_bump_id_set =
+    planning_utils::getRegElemIdSetOnPath<SpeedBump>(*getPathView(path));
 
   return [speed_bump_id_set](const std::shared_ptr<SceneModuleInterface> & scene_module) {
     return speed_bump_id_set.count(scene_module->getModuleId()) == 0;
@@ -43,13 +43,11 @@ StopLineModuleManager::StopLineModuleManager(rclcpp::Node & node)
 }
 
 std::vector<StopLineWithLaneId> StopLineModuleManager::getStopLinesWithLaneIdOnPath(
-  const autoware_auto_planning_msgs::msg::PathWithLaneId & path,
-  const lanelet::LaneletMapPtr lanelet_map)
+  const autoware_auto_planning_msgs::msg::PathWithLaneId & path)
 {
   std::vector<StopLineWithLaneId> stop_lines_with_lane_id;
 
-  for (const auto & m : planning_utils::getRegElemMapOnPath<TrafficSign>(
-         path, lanelet_map, planner_data_->current_odometry->pose)) {
+  for (const auto & m : planning_utils::getRegElemMapOnPath<TrafficSign>(*getPathView(path))) {
     const auto & traffic_sign_reg_elem = m.first;
     const int64_t lane_id = m.second.id();
     // Is stop sign?
@@ -66,12 +64,11 @@ std::vector<StopLineWithLaneId> StopLineModuleManager::getStopLinesWithLaneIdOnP
 }
 
 std::set<int64_t> StopLineModuleManager::getStopLineIdSetOnPath(
-  const autoware_auto_planning_msgs::msg::PathWithLaneId & path,
-  const lanelet::LaneletMapPtr lanelet_map)
+  const autoware_auto_planning_msgs::msg::PathWithLaneId & path)
 {
   std::set<int64_t> stop_line_id_set;
 
-  for (const auto & stop_line_with_lane_id : getStopLinesWithLaneIdOnPath(path, lanelet_map)) {
+  for (const auto & stop_line_with_lane_id : getStopLinesWithLaneIdOnPath(path)) {
     stop_line_id_set.insert(stop_line_with_lane_id.first.id());
   }
 
@@ -81,8 +78,7 @@ std::set<int64_t> StopLineModuleManager::getStopLineIdSetOnPath(
 void StopLineModuleManager::launchNewModules(
   const autoware_auto_planning_msgs::msg::PathWithLaneId & path)
 {
-  for (const auto & stop_line_with_lane_id :
-       getStopLinesWithLaneIdOnPath(path, planner_data_->route_handler_->getLaneletMapPtr())) {
+  for (const auto & stop_line_with_lane_id : getStopLinesWithLaneIdOnPath(path)) {
     const auto module_id = stop_line_with_lane_id.first.id();
     const auto lane_id = stop_line_with_lane_id.second;
     if (!isModuleRegistered(module_id)) {
@@ -97,8 +93,7 @@ std::function<bool(const std::shared_ptr<SceneModuleInterface> &)>
 StopLineModuleManager::getModuleExpiredFunction(
   const autoware_auto_planning_msgs::msg::PathWithLaneId & path)
 {
-  const auto stop_line_id_set =
-    getStopLineIdSetOnPath(path, planner_data_->route_handler_->getLaneletMapPtr());
+  const auto stop_line_id_set = getStopLineIdSetOnPath(path);
 
   return [stop_line_id_set](const std::shared_ptr<SceneModuleInterface> & scene_module) {
     return stop_line_id_set.count(scene_module->getModuleId()) == 0;
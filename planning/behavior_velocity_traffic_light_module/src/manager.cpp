@@ -16,6 +16,7 @@
 
 #include <behavior_velocity_planner_common/utilization/util.hpp>
 #include <tier4_autoware_utils/ros/parameter.hpp>
+#include <tier4_autoware_utils/system/stop_watch.hpp>
 
 #include <tf2/utils.h>
 
@@ -29,6 +30,7 @@ namespace behavior_velocity_planner
 {
 using lanelet::TrafficLight;
 using tier4_autoware_utils::getOrDeclareParameter;
+using tier4_autoware_utils::StopWatch;
 
 TrafficLightModuleManager::TrafficLightModuleManager(rclcpp::Node & node)
 : SceneModuleManagerInterfaceWithRTC(
@@ -48,6 +50,8 @@ TrafficLightModuleManager::TrafficLightModuleManager(rclcpp::Node & node)
 void TrafficLightModuleManager::modifyPathVelocity(
   autoware_auto_planning_msgs::msg::PathWithLaneId * path)
 {
+  StopWatch<std::chrono::milliseconds> stop_watch;
+  stop_watch.tic("Total");
   visualization_msgs::msg::MarkerArray debug_marker_array;
   visualization_msgs::msg::MarkerArray virtual_wall_marker_array;
 
@@ -61,6 +65,8 @@ void TrafficLightModuleManager::modifyPathVelocity(
   stop_reason_array.header.frame_id = "map";
   stop_reason_array.header.stamp = path->header.stamp;
 
+  const bool is_debug_subscribed = tier4_autoware_utils::hasSubscription(*pub_debug_);
+
   first_stop_path_point_index_ = static_cast<int>(path->points.size() - 1);
   first_ref_stop_path_point_index_ = static_cast<int>(path->points.size() - 1);
   for (const auto & scene_module : scene_modules_) {
@@ -69,7 +75,9 @@ void TrafficLightModuleManager::modifyPathVelocity(
       std::dynamic_pointer_cast<TrafficLightModule>(scene_module));
     traffic_light_scene_module->resetVelocityFactor();
     traffic_light_scene_module->setPlannerData(planner_data_);
+    stop_watch.tic("SceneModule");
     traffic_light_scene_module->modifyPathVelocity(path, &stop_reason);
+    const auto plan_time_ms = stop_watch.toc("SceneModule", true);
 
     // The velocity factor must be called after modifyPathVelocity.
     const auto velocity_factor = traffic_light_scene_module->getVelocityFactor();
@@ -94,27 +102,33 @@ void TrafficLightModuleManager::modifyPathVelocity(
         tl_state = traffic_light_scene_module->getTrafficSignal();
       }
     }
-    for (const auto & marker : traffic_light_scene_module->createDebugMarkerArray().markers) {
-      debug_marker_array.markers.push_back(marker);
+    if (is_debug_subscribed) {
+      for (const auto & marker : traffic_light_scene_module->createDebugMarkerArray().markers) {
+        debug_marker_array.markers.push_back(marker);
+      }
     }
     virtual_wall_marker_creator_.add_virtual_walls(
       traffic_light_scene_module->createVirtualWalls());
+    addSceneModuleProcessingTime(
+      scene_module->getModuleId(), plan_time_ms, stop_watch.toc("SceneModule"));
   }
   if (!stop_reason_array.stop_reasons.empty()) {
     pub_stop_reason_->publish(stop_reason_array);
   }
   pub_velocity_factor_->publish(velocity_factor_array);
-  pub_debug_->publish(debug_marker_array);
+  if (is_debug_subscribed) {
+    pub_debug_->publish(debug_marker_array);
+  }
   pub_virtual_wall_->publish(virtual_wall_marker_creator_.create_markers(clock_->now()));
   pub_tl_state_->publish(tl_state);
+  publishProcessingTimes(stop_watch.toc("Total"));
 }
 
 void TrafficLightModuleManager::launchNewModules(
   const autoware_auto_planning_msgs::msg::PathWithLaneId & path)
 {
-  for (const auto & traffic_light_reg_elem : planning_utils::getRegElemMapOnPath<TrafficLight>(
-         path, planner_data_->route_handler_->getLaneletMapPtr(),
-         planner_data_->current_odometry->pose)) {
+  for (const auto & traffic_light_reg_elem :
+       planning_utils::getRegElemMapOnPath<TrafficLight>(*getPathView(path))) {
     const auto stop_line = traffic_light_reg_elem.first->stopLine();
 
     if (!stop_line) {
@@ -142,8 +156,8 @@ std::function<bool(const std::shared_ptr<SceneModuleInterface> &)>
 TrafficLightModuleManager::getModuleExpiredFunction(
   const autoware_auto_planning_msgs::msg::PathWithLaneId & path)
 {
-  const auto lanelet_id_set = planning_utils::getLaneletIdSetOnPath<TrafficLight>(
-    path, planner_data_->route_handler_->getLaneletMapPtr(), planner_data_->current_odometry->pose);
+  const auto lanelet_id_set =
+    planning_utils::getLaneletIdSetOnPath<TrafficLight>(*getPathView(path));
 
   return [this, lanelet_id_set](const std::shared_ptr<SceneModuleInterface> & scene_module) {
     for (const auto & id : lanelet_id_set) {
@@ -51,9 +51,8 @@ VirtualTrafficLightModuleManager::VirtualTrafficLightModuleManager(rclcpp::Node
 void VirtualTrafficLightModuleManager::launchNewModules(
   const autoware_auto_planning_msgs::msg::PathWithLaneId & path)
 {
-  for (const auto & m : planning_utils::getRegElemMapOnPath<VirtualTrafficLight>(
-         path, planner_data_->route_handler_->getLaneletMapPtr(),
-         planner_data_->current_odometry->pose)) {
+  for (const auto & m :
+       planning_utils::getRegElemMapOnPath<VirtualTrafficLight>(*getPathView(path))) {
     // Use lanelet_id to unregister module when the route is changed
     const auto lane_id = m.second.id();
     const auto module_id = lane_id;
@@ -69,8 +68,8 @@ std::function<bool(const std::shared_ptr<SceneModuleInterface> &)>
 VirtualTrafficLightModuleManager::getModuleExpiredFunction(
   const autoware_auto_planning_msgs::msg::PathWithLaneId & path)
 {
-  const auto id_set = planning_utils::getLaneletIdSetOnPath<VirtualTrafficLight>(
-    path, planner_data_->route_handler_->getLaneletMapPtr(), planner_data_->current_odometry->pose);
+  const auto id_set =
+    planning_utils::getLaneletIdSetOnPath<VirtualTrafficLight>(*getPathView(path));
 
   return [id_set](const std::shared_ptr<SceneModuleInterface> & scene_module) {
     return id_set.count(scene_module->getModuleId()) == 0;
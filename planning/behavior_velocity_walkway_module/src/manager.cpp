@@ -64,8 +64,8 @@ void WalkwayModuleManager::launchNewModules(const PathWithLaneId & path)
       lanelet.id(), lanelet_map_ptr, p, use_regulatory_element, logger, clock_));
   };
 
-  const auto crosswalk_leg_elem_map = planning_utils::getRegElemMapOnPath<Crosswalk>(
-    path, rh->getLaneletMapPtr(), planner_data_->current_odometry->pose);
+  const auto crosswalk_leg_elem_map =
+    planning_utils::getRegElemMapOnPath<Crosswalk>(*getPathView(path));
 
   for (const auto & crosswalk : crosswalk_leg_elem_map) {
     launch(crosswalk.first->crosswalkLanelet(), true);
@@ -89,8 +89,8 @@ WalkwayModuleManager::getModuleExpiredFunction(const PathWithLaneId & path)
   walkway_id_set = getCrosswalkIdSetOnPath(
     planner_data_->current_odometry->pose, path, rh->getLaneletMapPtr(), rh->getOverallGraphPtr());
 
-  const auto crosswalk_leg_elem_map = planning_utils::getRegElemMapOnPath<Crosswalk>(
-    path, rh->getLaneletMapPtr(), planner_data_->current_odometry->pose);
+  const auto crosswalk_leg_elem_map =
+    planning_utils::getRegElemMapOnPath<Crosswalk>(*getPathView(path));
 
   for (const auto & crosswalk : crosswalk_leg_elem_map) {
     walkway_id_set.insert(crosswalk.first->id());
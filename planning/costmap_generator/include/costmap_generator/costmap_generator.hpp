@@ -68,8 +68,10 @@
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 class CostmapGenerator : public rclcpp::Node
@@ -82,6 +84,7 @@ private:
   bool use_points_;
   bool use_wayarea_;
   bool use_parkinglot_;
+  bool use_incremental_update_;
 
   lanelet::LaneletMapPtr lanelet_map_;
   autoware_auto_perception_msgs::msg::PredictedObjects::ConstSharedPtr objects_;
@@ -126,6 +129,10 @@ private:
 
   std::vector<std::vector<geometry_msgs::msg::Point>> primitives_points_;
 
+  // primitives costmap of the tiles around the costmap, keyed by the indices of the tiles
+  std::map<std::pair<int, int>, grid_map::GridMap> primitives_tiles_;
+  grid_map::Position tiles_origin_;
+
   PointsToCostmap points2costmap_;
   ObjectsToCostmap objects2costmap_;
 
@@ -164,6 +171,10 @@ private:
   /// \brief initialize gridmap parameters based on rosparam
   void initGridmap();
 
+  /// \brief move gridmap by shifting its circular buffer, and clear the newly exposed cells
+  /// \param[in] position new position of the gridmap
+  void moveGridmap(const grid_map::Position & position);
+
   /// \brief publish ros msg: grid_map::GridMap, and nav_msgs::OccupancyGrid
   /// \param[in] gridmap with calculated cost
   void publishCostmap(const grid_map::GridMap & costmap);
@@ -195,6 +206,13 @@ private:
   /// \brief calculate cost from lanelet2 map
   grid_map::Matrix generatePrimitivesCostmap();
 
+  /// \brief calculate cost from lanelet2 map by copying it from the cached tiles
+  grid_map::Matrix generatePrimitivesCostmapFromTiles();
+
+  /// \brief get the tile of the given indices, calculating its cost from lanelet2 map if not cached
+  /// \param[in] tile_index: indices of the tile, the tiles have the size of the costmap
+  const grid_map::GridMap & getPrimitivesTile(const std::pair<int, int> & tile_index);
+
   /// \brief calculate cost for final output
   grid_map::Matrix generateCombinedCostmap();
 };
@@ -55,7 +55,10 @@
 
 #include <autoware_auto_perception_msgs/msg/predicted_objects.hpp>
 
+#include <array>
+#include <map>
 #include <string>
+#include <vector>
 
 class ObjectsToCostmap
 {
@@ -73,12 +76,36 @@ public:
     const double size_of_expansion_kernel,
     const autoware_auto_perception_msgs::msg::PredictedObjects::ConstSharedPtr in_objects);
 
+  /// \brief update the cost of the objects which changed since the previous call
+  /// \details Objects are matched by UUID and only the cells of added, removed or moved objects
+  /// and the cells newly exposed by a move of the costmap are rasterized again. The cost is then
+  /// blurred with a mean filter computed from the unblurred cost.
+  /// \param[in] costmap: gridmap moved with grid_map::GridMap::move() between calls
+  /// \param[in] expand_polygon_size: expand object's costmap polygon
+  /// \param[in] size_of_expansion_kernel: kernel size for blurring cost
+  /// \param[in] in_objects: subscribed PredictedObjects
+  /// \param[out] calculated cost in grid_map::Matrix format
+  grid_map::Matrix updateCostmapFromObjects(
+    const grid_map::GridMap & costmap, const double expand_polygon_size,
+    const double size_of_expansion_kernel,
+    const autoware_auto_perception_msgs::msg::PredictedObjects::ConstSharedPtr in_objects);
+
 private:
+  struct ObjectCost
+  {
+    grid_map::Polygon polygon;
+    float score;
+  };
+
   const int NUMBER_OF_POINTS;
   const int NUMBER_OF_DIMENSIONS;
   const std::string OBJECTS_COSTMAP_LAYER_;
   const std::string BLURRED_OBJECTS_COSTMAP_LAYER_;
 
+  // costmap and objects of the previous updateCostmapFromObjects() call
+  grid_map::GridMap incremental_costmap_;
+  std::map<std::array<uint8_t, 16>, ObjectCost> previous_object_costs_;
+
   /// \brief make 4 rectangle points from centroid position and orientation
   /// \param[in] in_object: subscribed one of PredictedObjects
   /// \param[in] expand_rectangle_size: expanding 4 points
@@ -114,6 +141,24 @@ private:
     const autoware_auto_perception_msgs::msg::PredictedObject & in_object,
     const double expand_polygon_size);
 
+  /// \brief make polygon(grid_map::Polygon) for the shape of the object
+  /// \param[in] in_object: subscribed one of PredictedObjects
+  /// \param[in] expand_polygon_size: expanding the shape of the object
+  /// \param[out] polygon of the object
+  grid_map::Polygon makePolygonFromObject(
+    const std_msgs::msg::Header & header,
+    const autoware_auto_perception_msgs::msg::PredictedObject & in_object,
+    const double expand_polygon_size);
+
+  /// \brief compute the cost of the object from its highest classification probability
+  float getObjectScore(const autoware_auto_perception_msgs::msg::PredictedObject & in_object);
+
+  /// \brief blur the cost of the objects with a mean filter of the given kernel size
+  /// \param[in] size_of_expansion_kernel: kernel size for blurring cost
+  /// \param[in] objects_costmap: set max(cost, blurred cost) in
+  /// objects_costmap[BLURRED_OBJECTS_COSTMAP_LAYER_]
+  void blurCost(const double size_of_expansion_kernel, grid_map::GridMap & objects_costmap);
+
   /// \brief set cost in polygon by using DynamicObject's score
   /// \param[in] polygon: 4 rectangle points in polygon format
   /// \param[in] gridmap_layer_name: target gridmap layer name for calculated cost
@@ -59,6 +59,7 @@
 #include <tf2_eigen/tf2_eigen.hpp>
 #endif
 
+#include <cmath>
 #include <memory>
 #include <string>
 #include <utility>
@@ -181,6 +182,7 @@ CostmapGenerator::CostmapGenerator(const rclcpp::NodeOptions & node_options)
   use_parkinglot_ = this->declare_parameter<bool>("use_parkinglot");
   expand_polygon_size_ = this->declare_parameter<double>("expand_polygon_size");
   size_of_expansion_kernel_ = this->declare_parameter<int>("size_of_expansion_kernel");
+  use_incremental_update_ = this->declare_parameter<bool>("use_incremental_update");
 
   // Wait for first tf
   // We want to do this before creating subscriptions
@@ -275,6 +277,8 @@ void CostmapGenerator::onLaneletMapBin(
   if (use_parkinglot_) {
     loadParkingAreasFromLaneletMap(lanelet_map_, &primitives_points_);
   }
+
+  primitives_tiles_.clear();
 }
 
 void CostmapGenerator::onObjects(
@@ -313,10 +317,15 @@ void CostmapGenerator::onTimer()
   grid_map::Position p;
   p.x() = tf.transform.translation.x;
   p.y() = tf.transform.translation.y;
-  costmap_.setPosition(p);
+  if (use_incremental_update_) {
+    moveGridmap(p);
+  } else {
+    costmap_.setPosition(p);
+  }
 
   if ((use_wayarea_ || use_parkinglot_) && lanelet_map_) {
-    costmap_[LayerName::primitives] = generatePrimitivesCostmap();
+    costmap_[LayerName::primitives] =
+      use_incremental_update_ ? generatePrimitivesCostmapFromTiles() : generatePrimitivesCostmap();
   }
 
   if (use_objects_ && objects_) {
@@ -366,6 +375,22 @@ void CostmapGenerator::initGridmap()
   costmap_.add(LayerName::objects, grid_min_value_);
   costmap_.add(LayerName::primitives, grid_min_value_);
   costmap_.add(LayerName::combined, grid_min_value_);
+
+  // the gridmap only moves by whole cells in incremental mode, so the tiles share its cells
+  tiles_origin_ = costmap_.getPosition() - 0.5 * costmap_.getLength().matrix();
+}
+
+void CostmapGenerator::moveGridmap(const grid_map::Position & position)
+{
+  std::vector<grid_map::BufferRegion> new_regions;
+  costmap_.move(position, new_regions);
+  for (const auto & region : new_regions) {
+    const auto & start = region.getStartIndex();
+    const auto & size = region.getSize();
+    for (const auto & layer : costmap_.getLayers()) {
+      costmap_[layer].block(start(0), start(1), size(0), size(1)).setConstant(grid_min_value_);
+    }
+  }
 }
 
 grid_map::Matrix CostmapGenerator::generatePointsCostmap(
@@ -421,6 +446,11 @@ grid_map::Matrix CostmapGenerator::generateObjectsCostmap(
   const auto transformed_objects =
     transformObjects(tf_buffer_, in_objects, costmap_frame_, object_frame);
 
+  if (use_incremental_update_) {
+    return objects2costmap_.updateCostmapFromObjects(
+      costmap_, expand_polygon_size_, size_of_expansion_kernel_, transformed_objects);
+  }
+
   grid_map::Matrix objects_costmap = objects2costmap_.makeCostmapFromObjects(
     costmap_, expand_polygon_size_, size_of_expansion_kernel_, transformed_objects);
 
@@ -438,6 +468,74 @@ grid_map::Matrix CostmapGenerator::generatePrimitivesCostmap()
   return lanelet2_costmap[LayerName::primitives];
 }
 
+grid_map::Matrix CostmapGenerator::generatePrimitivesCostmapFromTiles()
+{
+  const grid_map::Length tile_length = costmap_.getLength();
+  const auto get_tile_index = [&](const grid_map::Position & position) {
+    const Eigen::Array2d tile_position = (position - tiles_origin_).array() / tile_length;
+    return std::make_pair(
+      static_cast<int>(std::floor(tile_position.x())),
+      static_cast<int>(std::floor(tile_position.y())));
+  };
+
+  // drop the tiles which are not next to the costmap any more
+  const grid_map::Position half_cell = grid_map::Position::Constant(0.5 * grid_resolution_);
+  const grid_map::Position half_length = 0.5 * costmap_.getLength().matrix();
+  const auto min_tile_index = get_tile_index(costmap_.getPosition() - half_length + half_cell);
+  const auto max_tile_index = get_tile_index(costmap_.getPosition() + half_length - half_cell);
+  for (auto itr = primitives_tiles_.begin(); itr != primitives_tiles_.end();) {
+    const auto & [x, y] = itr->first;
+    if (
+      x < min_tile_index.first - 1 || x > max_tile_index.first + 1 ||
+      y < min_tile_index.second - 1 || y > max_tile_index.second + 1) {
+      itr = primitives_tiles_.erase(itr);
+    } else {
+      ++itr;
+    }
+  }
+
+  grid_map::Matrix primitives_costmap = costmap_[LayerName::primitives];
+  std::pair<int, int> last_tile_index{min_tile_index.first - 1, min_tile_index.second - 1};
+  const grid_map::GridMap * tile = nullptr;
+  for (grid_map::GridMapIterator itr(costmap_); !itr.isPastEnd(); ++itr) {
+    grid_map::Position position;
+    costmap_.getPosition(*itr, position);
+    const auto tile_index = get_tile_index(position);
+    if (!tile || tile_index != last_tile_index) {
+      tile = &getPrimitivesTile(tile_index);
+      last_tile_index = tile_index;
+    }
+    grid_map::Index index_in_tile;
+    tile->getIndex(position, index_in_tile);
+    primitives_costmap((*itr)(0), (*itr)(1)) = tile->at(LayerName::primitives, index_in_tile);
+  }
+  return primitives_costmap;
+}
+
+const grid_map::GridMap & CostmapGenerator::getPrimitivesTile(
+  const std::pair<int, int> & tile_index)
+{
+  const auto cached_tile = primitives_tiles_.find(tile_index);
+  if (cached_tile != primitives_tiles_.end()) {
+    return cached_tile->second;
+  }
+
+  // the primitives are static as long as costmap_frame is fixed to map_frame
+  const grid_map::Length tile_length = costmap_.getLength();
+  const Eigen::Array2d tile_center(tile_index.first + 0.5, tile_index.second + 0.5);
+  grid_map::GridMap tile({LayerName::primitives});
+  tile.setFrameId(costmap_frame_);
+  tile.setGeometry(
+    tile_length, grid_resolution_, tiles_origin_ + (tile_center * tile_length).matrix());
+  tile[LayerName::primitives].setConstant(grid_min_value_);
+  if (!primitives_points_.empty()) {
+    object_map::FillPolygonAreas(
+      tile, primitives_points_, LayerName::primitives, grid_max_value_, grid_min_value_,
+      grid_min_value_, grid_max_value_, costmap_frame_, map_frame_, tf_buffer_);
+  }
+  return primitives_tiles_.emplace(tile_index, std::move(tile)).first->second;
+}
+
 grid_map::Matrix CostmapGenerator::generateCombinedCostmap()
 {
   // assuming combined_costmap is calculated by element wise max operation
@@ -75,7 +75,11 @@ void FillPolygonAreas(
     out_grid_map, in_grid_layer_name, CV_8UC1, in_layer_min_value, in_layer_max_value,
     original_image);
 
-  cv::Mat merged_filled_image = original_image.clone();
+  // the background is uniform, so filling every polygon with the cleared color gives the same
+  // image as merging an image per polygon
+  cv::Mat merged_filled_image = original_image;
+  const int merged_fill_color =
+    original_image.at<unsigned char>(0, 0) & cv::saturate_cast<unsigned char>(in_fill_color);
 
   geometry_msgs::msg::TransformStamped transform;
   transform = in_tf_buffer.lookupTransform(
@@ -86,8 +90,10 @@ void FillPolygonAreas(
   const double origin_x_offset = out_grid_map.getLength().x() / 2.0 - map_pos.x();
   const double origin_y_offset = out_grid_map.getLength().y() / 2.0 - map_pos.y();
 
+  std::vector<std::vector<cv::Point>> cv_polygons(1);
   for (const auto & points : in_points) {
-    std::vector<cv::Point> cv_polygon;
+    auto & cv_polygon = cv_polygons.front();
+    cv_polygon.clear();
 
     for (const auto & p : points) {
       // transform to GridMap coordinate
@@ -105,13 +111,13 @@ void FillPolygonAreas(
       cv_polygon.emplace_back(cv_x, cv_y);
     }
 
-    cv::Mat filled_image = original_image.clone();
-
-    std::vector<std::vector<cv::Point>> cv_polygons;
-    cv_polygons.push_back(cv_polygon);
-    cv::fillPoly(filled_image, cv_polygons, cv::Scalar(in_fill_color));
+    // skip the primitives outside of the gridmap, which can be most of the map
+    const cv::Rect image_rect(0, 0, merged_filled_image.cols, merged_filled_image.rows);
+    if ((cv::boundingRect(cv_polygon) & image_rect).empty()) {
+      continue;
+    }
 
-    merged_filled_image &= filled_image;
+    cv::fillPoly(merged_filled_image, cv_polygons, cv::Scalar(merged_fill_color));
   }
 
   // convert to ROS msg
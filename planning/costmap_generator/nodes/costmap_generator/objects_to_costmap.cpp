@@ -46,8 +46,11 @@
 
 #include <tf2/utils.h>
 
+#include <algorithm>
 #include <cmath>
 #include <string>
+#include <utility>
+#include <vector>
 
 // Constructor
 ObjectsToCostmap::ObjectsToCostmap()
@@ -142,6 +145,70 @@ grid_map::Polygon ObjectsToCostmap::makePolygonFromObjectConvexHull(
   return polygon;
 }
 
+grid_map::Polygon ObjectsToCostmap::makePolygonFromObject(
+  const std_msgs::msg::Header & header,
+  const autoware_auto_perception_msgs::msg::PredictedObject & in_object,
+  const double expand_polygon_size)
+{
+  grid_map::Polygon polygon;
+  if (in_object.shape.type == autoware_auto_perception_msgs::msg::Shape::POLYGON) {
+    polygon = makePolygonFromObjectConvexHull(header, in_object, expand_polygon_size);
+  } else if (in_object.shape.type == autoware_auto_perception_msgs::msg::Shape::BOUNDING_BOX) {
+    polygon = makePolygonFromObjectBox(header, in_object, expand_polygon_size);
+  } else if (in_object.shape.type == autoware_auto_perception_msgs::msg::Shape::CYLINDER) {
+    // TODO(Kenji Miyake): Add makePolygonFromObjectCylinder
+    polygon = makePolygonFromObjectBox(header, in_object, expand_polygon_size);
+  }
+  return polygon;
+}
+
+float ObjectsToCostmap::getObjectScore(
+  const autoware_auto_perception_msgs::msg::PredictedObject & in_object)
+{
+  const auto highest_probability_label = *std::max_element(
+    in_object.classification.begin(), in_object.classification.end(),
+    [](const auto & c1, const auto & c2) { return c1.probability < c2.probability; });
+  return highest_probability_label.probability;
+}
+
+void ObjectsToCostmap::blurCost(
+  const double size_of_expansion_kernel, grid_map::GridMap & objects_costmap)
+{
+  // mean over the kernel cropped at the edges of the gridmap, from a summed area table built in
+  // the unwrapped index order
+  const grid_map::Size size = objects_costmap.getSize();
+  const grid_map::Index start_index = objects_costmap.getStartIndex();
+  const grid_map::Matrix & cost = objects_costmap[OBJECTS_COSTMAP_LAYER_];
+  grid_map::Matrix & blurred_cost = objects_costmap[BLURRED_OBJECTS_COSTMAP_LAYER_];
+  const auto to_buffer_index = [&](const int i, const int j) {
+    return grid_map::getBufferIndexFromIndex(grid_map::Index(i, j), size, start_index);
+  };
+
+  Eigen::MatrixXd summed_area = Eigen::MatrixXd::Zero(size(0) + 1, size(1) + 1);
+  for (int i = 0; i < size(0); ++i) {
+    for (int j = 0; j < size(1); ++j) {
+      const grid_map::Index index = to_buffer_index(i, j);
+      summed_area(i + 1, j + 1) = cost(index(0), index(1)) + summed_area(i, j + 1) +
+                                  summed_area(i + 1, j) - summed_area(i, j);
+    }
+  }
+
+  const int margin = std::max(0, (static_cast<int>(size_of_expansion_kernel) - 1) / 2);
+  for (int i = 0; i < size(0); ++i) {
+    const int i_min = std::max(0, i - margin);
+    const int i_max = std::min<int>(size(0), i + margin + 1);
+    for (int j = 0; j < size(1); ++j) {
+      const int j_min = std::max(0, j - margin);
+      const int j_max = std::min<int>(size(1), j + margin + 1);
+      const double sum = summed_area(i_max, j_max) - summed_area(i_min, j_max) -
+                         summed_area(i_max, j_min) + summed_area(i_min, j_min);
+      const grid_map::Index index = to_buffer_index(i, j);
+      const float mean = sum / ((i_max - i_min) * (j_max - j_min));
+      blurred_cost(index(0), index(1)) = std::max(cost(index(0), index(1)), mean);
+    }
+  }
+}
+
 void ObjectsToCostmap::setCostInPolygon(
   const grid_map::Polygon & polygon, const std::string & gridmap_layer_name, const float score,
   grid_map::GridMap & objects_costmap)
@@ -164,19 +231,9 @@ grid_map::Matrix ObjectsToCostmap::makeCostmapFromObjects(
   objects_costmap.add(BLURRED_OBJECTS_COSTMAP_LAYER_, 0);
 
   for (const auto & object : in_objects->objects) {
-    grid_map::Polygon polygon;
-    if (object.shape.type == autoware_auto_perception_msgs::msg::Shape::POLYGON) {
-      polygon = makePolygonFromObjectConvexHull(in_objects->header, object, expand_polygon_size);
-    } else if (object.shape.type == autoware_auto_perception_msgs::msg::Shape::BOUNDING_BOX) {
-      polygon = makePolygonFromObjectBox(in_objects->header, object, expand_polygon_size);
-    } else if (object.shape.type == autoware_auto_perception_msgs::msg::Shape::CYLINDER) {
-      // TODO(Kenji Miyake): Add makePolygonFromObjectCylinder
-      polygon = makePolygonFromObjectBox(in_objects->header, object, expand_polygon_size);
-    }
-    const auto highest_probability_label = *std::max_element(
-      object.classification.begin(), object.classification.end(),
-      [](const auto & c1, const auto & c2) { return c1.probability < c2.probability; });
-    const double highest_probability = static_cast<double>(highest_probability_label.probability);
+    const grid_map::Polygon polygon =
+      makePolygonFromObject(in_objects->header, object, expand_polygon_size);
+    const double highest_probability = getObjectScore(object);
     setCostInPolygon(polygon, OBJECTS_COSTMAP_LAYER_, highest_probability, objects_costmap);
     setCostInPolygon(polygon, BLURRED_OBJECTS_COSTMAP_LAYER_, highest_probability, objects_costmap);
   }
@@ -196,3 +253,103 @@ grid_map::Matrix ObjectsToCostmap::makeCostmapFromObjects(
 
   return objects_costmap[OBJECTS_COSTMAP_LAYER_];
 }
+
+grid_map::Matrix ObjectsToCostmap::updateCostmapFromObjects(
+  const grid_map::GridMap & costmap, const double expand_polygon_size,
+  const double size_of_expansion_kernel,
+  const autoware_auto_perception_msgs::msg::PredictedObjects::ConstSharedPtr in_objects)
+{
+  // follow the move of the costmap, the newly exposed cells are rasterized again
+  std::vector<grid_map::BufferRegion> new_regions;
+  bool is_full_update =
+    !incremental_costmap_.exists(OBJECTS_COSTMAP_LAYER_) ||
+    incremental_costmap_.getFrameId() != costmap.getFrameId() ||
+    incremental_costmap_.getResolution() != costmap.getResolution() ||
+    (incremental_costmap_.getSize() != costmap.getSize()).any();
+  if (!is_full_update) {
+    incremental_costmap_.move(costmap.getPosition(), new_regions);
+    is_full_update =
+      (incremental_costmap_.getStartIndex() != costmap.getStartIndex()).any() ||
+      (incremental_costmap_.getPosition() - costmap.getPosition()).norm() >
+        0.5 * costmap.getResolution();
+  }
+
+  std::map<std::array<uint8_t, 16>, ObjectCost> object_costs;
+  for (const auto & object : in_objects->objects) {
+    const ObjectCost object_cost{
+      makePolygonFromObject(in_objects->header, object, expand_polygon_size),
+      getObjectScore(object)};
+    if (!object_costs.emplace(object.object_id.uuid, object_cost).second) {
+      // objects can not be matched with duplicated UUIDs
+      is_full_update = true;
+    }
+  }
+
+  if (is_full_update) {
+    incremental_costmap_ =
+      grid_map::GridMap({OBJECTS_COSTMAP_LAYER_, BLURRED_OBJECTS_COSTMAP_LAYER_});
+    incremental_costmap_.setFrameId(costmap.getFrameId());
+    incremental_costmap_.setGeometry(
+      costmap.getLength(), costmap.getResolution(), costmap.getPosition());
+    incremental_costmap_.setStartIndex(costmap.getStartIndex());
+    incremental_costmap_[OBJECTS_COSTMAP_LAYER_].setZero();
+    for (const auto & object : in_objects->objects) {
+      setCostInPolygon(
+        makePolygonFromObject(in_objects->header, object, expand_polygon_size),
+        OBJECTS_COSTMAP_LAYER_, getObjectScore(object), incremental_costmap_);
+    }
+    blurCost(size_of_expansion_kernel, incremental_costmap_);
+    previous_object_costs_ = std::move(object_costs);
+    return incremental_costmap_[BLURRED_OBJECTS_COSTMAP_LAYER_];
+  }
+
+  const auto is_same = [](const ObjectCost & c1, const ObjectCost & c2) {
+    return c1.score == c2.score && c1.polygon.getVertices() == c2.polygon.getVertices();
+  };
+
+  // reset the cells of the new regions and of the removed or changed objects
+  grid_map::Matrix & cost = incremental_costmap_[OBJECTS_COSTMAP_LAYER_];
+  Eigen::Matrix<uint8_t, Eigen::Dynamic, Eigen::Dynamic> is_reset =
+    Eigen::Matrix<uint8_t, Eigen::Dynamic, Eigen::Dynamic>::Zero(cost.rows(), cost.cols());
+  bool is_changed = false;
+  for (const auto & region : new_regions) {
+    const auto & start = region.getStartIndex();
+    const auto & size = region.getSize();
+    cost.block(start(0), start(1), size(0), size(1)).setZero();
+    is_reset.block(start(0), start(1), size(0), size(1)).setOnes();
+    is_changed = true;
+  }
+  for (const auto & [uuid, previous_object_cost] : previous_object_costs_) {
+    const auto object_cost = object_costs.find(uuid);
+    if (object_cost != object_costs.end() && is_same(object_cost->second, previous_object_cost)) {
+      continue;
+    }
+    for (grid_map::PolygonIterator itr(incremental_costmap_, previous_object_cost.polygon);
+         !itr.isPastEnd(); ++itr) {
+      cost((*itr)(0), (*itr)(1)) = 0.0;
+      is_reset((*itr)(0), (*itr)(1)) = 1;
+    }
+    is_changed = true;
+  }
+
+  // unchanged objects only need to fill the reset cells again
+  for (const auto & [uuid, object_cost] : object_costs) {
+    const auto previous_object_cost = previous_object_costs_.find(uuid);
+    const bool is_unchanged = previous_object_cost != previous_object_costs_.end() &&
+                              is_same(object_cost, previous_object_cost->second);
+    is_changed |= !is_unchanged;
+    for (grid_map::PolygonIterator itr(incremental_costmap_, object_cost.polygon);
+         !itr.isPastEnd(); ++itr) {
+      if (is_unchanged && !is_reset((*itr)(0), (*itr)(1))) {
+        continue;
+      }
+      cost((*itr)(0), (*itr)(1)) = std::max(cost((*itr)(0), (*itr)(1)), object_cost.score);
+    }
+  }
+
+  if (is_changed) {
+    blurCost(size_of_expansion_kernel, incremental_costmap_);
+  }
+  previous_object_costs_ = std::move(object_costs);
+  return incremental_costmap_[BLURRED_OBJECTS_COSTMAP_LAYER_];
+}
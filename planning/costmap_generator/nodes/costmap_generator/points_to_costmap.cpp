@@ -112,15 +112,18 @@ grid_map::Matrix PointsToCostmap::calculateCostmap(
   grid_map::Matrix gridmap_data = gridmap[gridmap_layer_name];
   for (size_t x_ind = 0; x_ind < grid_vec.size(); x_ind++) {
     for (size_t y_ind = 0; y_ind < grid_vec[0].size(); y_ind++) {
+      // the data is stored in a circular buffer once the gridmap has been moved
+      const grid_map::Index buffer_ind = grid_map::getBufferIndexFromIndex(
+        grid_map::Index(x_ind, y_ind), gridmap.getSize(), gridmap.getStartIndex());
       if (grid_vec[x_ind][y_ind].size() == 0) {
-        gridmap_data(x_ind, y_ind) = grid_min_value;
+        gridmap_data(buffer_ind.x(), buffer_ind.y()) = grid_min_value;
         continue;
       }
       for (const auto & z : grid_vec[x_ind][y_ind]) {
         if (z > maximum_height_thres || z < minimum_lidar_height_thres) {
           continue;
         }
-        gridmap_data(x_ind, y_ind) = grid_max_value;
+        gridmap_data(buffer_ind.x(), buffer_ind.y()) = grid_max_value;
         break;
       }
     }
@@ -134,3 +134,68 @@ TEST_F(ObjectsToCostMapTest, TestMakeCostmapFromObjects)
     }
   }
 }
+
+TEST_F(ObjectsToCostMapTest, TestUpdateCostmapFromObjects)
+{
+  const auto make_object = [](const uint8_t id, const double x, const double y, const float score) {
+    autoware_auto_perception_msgs::msg::PredictedObject object;
+    object.object_id.uuid.fill(id);
+    object.classification.push_back(autoware_auto_perception_msgs::msg::ObjectClassification{});
+    object.classification.at(0).label = LABEL::CAR;
+    object.classification.at(0).probability = score;
+    object.kinematics.initial_pose_with_covariance.pose.position.x = x;
+    object.kinematics.initial_pose_with_covariance.pose.position.y = y;
+    object.kinematics.initial_pose_with_covariance.pose.orientation.w = 1;
+    object.shape.type = autoware_auto_perception_msgs::msg::Shape::BOUNDING_BOX;
+    object.shape.dimensions.x = 5;
+    object.shape.dimensions.y = 3;
+    object.shape.dimensions.z = 2;
+    return object;
+  };
+
+  const double expand_polygon_size = 0.0;
+  for (const double size_of_expansion_kernel : {1.0, 3.0}) {
+    grid_map::GridMap gridmap = construct_gridmap();
+    ObjectsToCostmap incremental_objects_to_costmap;
+
+    auto objs = std::make_shared<autoware_auto_perception_msgs::msg::PredictedObjects>();
+    objs->objects.push_back(make_object(1, 1, 2, 0.8));
+    objs->objects.push_back(make_object(2, -4, -3, 0.6));
+    objs->objects.push_back(make_object(3, 5, -5, 0.4));
+    incremental_objects_to_costmap.updateCostmapFromObjects(
+      gridmap, expand_polygon_size, size_of_expansion_kernel, objs);
+
+    // move, remove and add objects while moving the gridmap
+    objs = std::make_shared<autoware_auto_perception_msgs::msg::PredictedObjects>();
+    objs->objects.push_back(make_object(1, 1, 2, 0.8));
+    objs->objects.push_back(make_object(2, -2, -3, 0.6));
+    objs->objects.push_back(make_object(4, 8, 6, 0.9));
+    gridmap.move(grid_map::Position(3, -2));
+    const grid_map::Matrix incremental_costmap =
+      incremental_objects_to_costmap.updateCostmapFromObjects(
+        gridmap, expand_polygon_size, size_of_expansion_kernel, objs);
+
+    // the result is the same as the one computed from scratch
+    ObjectsToCostmap objects_to_costmap;
+    const grid_map::Matrix expected_costmap = objects_to_costmap.updateCostmapFromObjects(
+      gridmap, expand_polygon_size, size_of_expansion_kernel, objs);
+    ASSERT_EQ(incremental_costmap.rows(), expected_costmap.rows());
+    ASSERT_EQ(incremental_costmap.cols(), expected_costmap.cols());
+    for (int i = 0; i < expected_costmap.rows(); i++) {
+      for (int j = 0; j < expected_costmap.cols(); j++) {
+        EXPECT_FLOAT_EQ(incremental_costmap(i, j), expected_costmap(i, j));
+      }
+    }
+
+    // without blurring, the cost is the same as makeCostmapFromObjects()
+    if (size_of_expansion_kernel == 1.0) {
+      const grid_map::Matrix not_blurred_costmap = objects_to_costmap.makeCostmapFromObjects(
+        gridmap, expand_polygon_size, size_of_expansion_kernel, objs);
+      for (int i = 0; i < not_blurred_costmap.rows(); i++) {
+        for (int j = 0; j < not_blurred_costmap.cols(); j++) {
+          EXPECT_FLOAT_EQ(incremental_costmap(i, j), not_blurred_costmap(i, j));
+        }
+      }
+    }
+  }
+}
@@ -23,6 +23,7 @@
 
 #include <deque>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
@@ -31,7 +32,15 @@ using tier4_planning_msgs::msg::VelocityLimit;
 using tier4_planning_msgs::msg::VelocityLimitClearCommand;
 using tier4_planning_msgs::msg::VelocityLimitConstraints;
 
-using VelocityLimitTable = std::unordered_map<std::string, VelocityLimit>;
+struct VelocityLimitEntry
+{
+  VelocityLimit velocity_limit;
+  rclcpp::Time received_time;
+  // the velocity limit is removed when it is not updated within the timeout
+  bool can_expire;
+};
+
+using VelocityLimitTable = std::unordered_map<std::string, VelocityLimitEntry>;
 
 class ExternalVelocityLimitSelectorNode : public rclcpp::Node
 {
@@ -55,6 +64,10 @@ public:
     double limit_max_acc;
     double limit_min_jerk;
     double limit_max_jerk;
+    // publish the hardest velocity limit only when it is changed
+    bool publish_on_change_only;
+    // timeout of the velocity limits from internal, disabled if not positive [s]
+    double velocity_limit_timeout;
   };
 
 private:
@@ -63,11 +76,16 @@ private:
   rclcpp::Subscription<VelocityLimitClearCommand>::SharedPtr sub_velocity_limit_clear_command_;
   rclcpp::Publisher<VelocityLimit>::SharedPtr pub_external_velocity_limit_;
   rclcpp::Publisher<StringStamped>::SharedPtr pub_debug_string_;
+  rclcpp::TimerBase::SharedPtr timer_;
 
+  void onTimer();
   void publishVelocityLimit(const VelocityLimit & velocity_limit);
   void setVelocityLimitFromAPI(const VelocityLimit & velocity_limit);
   void setVelocityLimitFromInternal(const VelocityLimit & velocity_limit);
+  void setVelocityLimit(
+    const std::string & sender, const VelocityLimit & velocity_limit, const bool can_expire);
   void clearVelocityLimit(const std::string & sender);
+  bool removeExpiredVelocityLimits();
   void updateVelocityLimit();
   void publishDebugString();
   VelocityLimit getCurrentVelocityLimit() { return hardest_limit_; }
@@ -76,6 +94,7 @@ private:
   NodeParam node_param_{};
   VelocityLimit hardest_limit_{};
   VelocityLimitTable velocity_limit_table_;
+  std::optional<VelocityLimit> published_limit_;
 };
 
 #endif  // EXTERNAL_VELOCITY_LIMIT_SELECTOR__EXTERNAL_VELOCITY_LIMIT_SELECTOR_NODE_HPP_
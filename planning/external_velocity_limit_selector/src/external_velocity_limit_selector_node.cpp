@@ -38,22 +38,23 @@ VelocityLimit getHardestLimit(
   double hardest_max_velocity = node_param.max_velocity;
   double hardest_max_jerk = 0.0;
 
-  for (const auto & limit : velocity_limits) {
+  for (const auto & entry : velocity_limits) {
+    const auto & limit = entry.second.velocity_limit;
+
     // guard nan, inf
-    const auto max_velocity = std::isfinite(limit.second.max_velocity) ? limit.second.max_velocity
-                                                                       : node_param.max_velocity;
+    const auto max_velocity =
+      std::isfinite(limit.max_velocity) ? limit.max_velocity : node_param.max_velocity;
 
     // find hardest max velocity
     if (max_velocity < hardest_max_velocity) {
-      hardest_limit.stamp = limit.second.stamp;
+      hardest_limit.stamp = limit.stamp;
       hardest_limit.max_velocity = max_velocity;
       hardest_max_velocity = max_velocity;
     }
 
-    const auto constraints =
-      limit.second.use_constraints && std::isfinite(limit.second.constraints.max_jerk)
-        ? limit.second.constraints
-        : normal_constraints;
+    const auto constraints = limit.use_constraints && std::isfinite(limit.constraints.max_jerk)
+                               ? limit.constraints
+                               : normal_constraints;
 
     // find hardest jerk
     if (hardest_max_jerk < constraints.max_jerk) {
@@ -70,18 +71,28 @@ std::string getDebugString(const VelocityLimitTable & velocity_limits)
 {
   std::ostringstream string_stream;
   string_stream << std::boolalpha << std::fixed << std::setprecision(2);
-  for (const auto & limit : velocity_limits) {
-    string_stream << "[" << limit.first << "]";
+  for (const auto & entry : velocity_limits) {
+    const auto & limit = entry.second.velocity_limit;
+    string_stream << "[" << entry.first << "]";
     string_stream << "(";
-    string_stream << limit.second.use_constraints << ",";
-    string_stream << limit.second.max_velocity << ",";
-    string_stream << limit.second.constraints.min_acceleration << ",";
-    string_stream << limit.second.constraints.min_jerk << ",";
-    string_stream << limit.second.constraints.max_jerk << ")";
+    string_stream << limit.use_constraints << ",";
+    string_stream << limit.max_velocity << ",";
+    string_stream << limit.constraints.min_acceleration << ",";
+    string_stream << limit.constraints.min_jerk << ",";
+    string_stream << limit.constraints.max_jerk << ")";
   }
 
   return string_stream.str();
 }
+
+// the stamp and the sender are ignored, since they do not change the velocity planning
+bool isSameVelocityLimit(const VelocityLimit & a, const VelocityLimit & b)
+{
+  return a.max_velocity == b.max_velocity && a.use_constraints == b.use_constraints &&
+         a.constraints.min_acceleration == b.constraints.min_acceleration &&
+         a.constraints.min_jerk == b.constraints.min_jerk &&
+         a.constraints.max_jerk == b.constraints.max_jerk;
+}
 }  // namespace
 
 ExternalVelocityLimitSelectorNode::ExternalVelocityLimitSelectorNode(
@@ -103,8 +114,9 @@ ExternalVelocityLimitSelectorNode::ExternalVelocityLimitSelectorNode(
     std::bind(&ExternalVelocityLimitSelectorNode::onVelocityLimitClearCommand, this, _1));
 
   // Output
-  pub_external_velocity_limit_ =
-    this->create_publisher<VelocityLimit>("output/external_velocity_limit", 1);
+  // NOTE: the velocity limit is latched, since it may be published only when it is changed.
+  pub_external_velocity_limit_ = this->create_publisher<VelocityLimit>(
+    "output/external_velocity_limit", rclcpp::QoS{1}.transient_local());
 
   pub_debug_string_ = this->create_publisher<StringStamped>("output/debug", 1);
 
@@ -120,7 +132,31 @@ ExternalVelocityLimitSelectorNode::ExternalVelocityLimitSelectorNode(
     p.limit_max_acc = this->declare_parameter<double>("limit.max_acc");
     p.limit_min_jerk = this->declare_parameter<double>("limit.min_jerk");
     p.limit_max_jerk = this->declare_parameter<double>("limit.max_jerk");
+    p.publish_on_change_only = this->declare_parameter<bool>("publish_on_change_only", false);
+    p.velocity_limit_timeout = this->declare_parameter<double>("velocity_limit_timeout", 0.0);
+  }
+
+  // Timer
+  if (node_param_.velocity_limit_timeout > 0.0) {
+    // check the expiration twice within the timeout
+    const auto period_ns = rclcpp::Rate(2.0 / node_param_.velocity_limit_timeout).period();
+    timer_ = rclcpp::create_timer(
+      this, get_clock(), period_ns, std::bind(&ExternalVelocityLimitSelectorNode::onTimer, this));
+  }
+}
+
+void ExternalVelocityLimitSelectorNode::onTimer()
+{
+  if (!removeExpiredVelocityLimits()) {
+    return;
   }
+
+  updateVelocityLimit();
+
+  const auto velocity_limit = getCurrentVelocityLimit();
+  publishVelocityLimit(velocity_limit);
+
+  publishDebugString();
 }
 
 void ExternalVelocityLimitSelectorNode::onVelocityLimitFromAPI(
@@ -164,7 +200,16 @@ void ExternalVelocityLimitSelectorNode::onVelocityLimitClearCommand(
 
 void ExternalVelocityLimitSelectorNode::publishVelocityLimit(const VelocityLimit & velocity_limit)
 {
+  // the conflicting velocity limits published at a high rate make the subscribers replan on every
+  // message, even if the hardest velocity limit is not changed
+  if (
+    node_param_.publish_on_change_only && published_limit_ &&
+    isSameVelocityLimit(*published_limit_, velocity_limit)) {
+    return;
+  }
+
   pub_external_velocity_limit_->publish(velocity_limit);
+  published_limit_ = velocity_limit;
 }
 
 void ExternalVelocityLimitSelectorNode::publishDebugString()
@@ -178,27 +223,25 @@ void ExternalVelocityLimitSelectorNode::publishDebugString()
 void ExternalVelocityLimitSelectorNode::setVelocityLimitFromAPI(
   const VelocityLimit & velocity_limit)
 {
-  const std::string sender = "api";
-
-  if (velocity_limit_table_.count(sender) == 0) {
-    velocity_limit_table_.emplace(sender, velocity_limit);
-  } else {
-    velocity_limit_table_.at(sender) = velocity_limit;
-    RCLCPP_DEBUG(get_logger(), "overwrite velocity limit. sender:%s", sender.c_str());
-  }
-
-  updateVelocityLimit();
+  // the velocity limit from api is kept until it is overwritten
+  setVelocityLimit("api", velocity_limit, false);
 }
 
 void ExternalVelocityLimitSelectorNode::setVelocityLimitFromInternal(
   const VelocityLimit & velocity_limit)
 {
-  const auto sender = velocity_limit.sender;
+  setVelocityLimit(velocity_limit.sender, velocity_limit, true);
+}
+
+void ExternalVelocityLimitSelectorNode::setVelocityLimit(
+  const std::string & sender, const VelocityLimit & velocity_limit, const bool can_expire)
+{
+  VelocityLimitEntry entry{velocity_limit, this->now(), can_expire};
 
   if (velocity_limit_table_.count(sender) == 0) {
-    velocity_limit_table_.emplace(sender, velocity_limit);
+    velocity_limit_table_.emplace(sender, std::move(entry));
   } else {
-    velocity_limit_table_.at(sender) = velocity_limit;
+    velocity_limit_table_.at(sender) = std::move(entry);
     RCLCPP_DEBUG(get_logger(), "overwrite velocity limit. sender:%s", sender.c_str());
   }
 
@@ -217,6 +260,25 @@ void ExternalVelocityLimitSelectorNode::clearVelocityLimit(const std::string & s
   updateVelocityLimit();
 }
 
+bool ExternalVelocityLimitSelectorNode::removeExpiredVelocityLimits()
+{
+  const auto now = this->now();
+  bool is_removed = false;
+  for (auto itr = velocity_limit_table_.begin(); itr != velocity_limit_table_.end();) {
+    const auto & entry = itr->second;
+    if (
+      entry.can_expire &&
+      (now - entry.received_time).seconds() > node_param_.velocity_limit_timeout) {
+      RCLCPP_DEBUG(get_logger(), "velocity limit is expired. sender:%s", itr->first.c_str());
+      itr = velocity_limit_table_.erase(itr);
+      is_removed = true;
+    } else {
+      ++itr;
+    }
+  }
+  return is_removed;
+}
+
 void ExternalVelocityLimitSelectorNode::updateVelocityLimit()
 {
   if (velocity_limit_table_.empty()) {
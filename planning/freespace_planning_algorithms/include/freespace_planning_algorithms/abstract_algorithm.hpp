@@ -23,6 +23,7 @@
 
 #include <tf2/utils.h>
 
+#include <cstdint>
 #include <vector>
 
 namespace freespace_planning_algorithms
@@ -158,7 +159,7 @@ protected:
     // NOTE: Accessing by .at() instead makes 1.2 times slower here.
     // Also, boundary check is already done in isOutOfRange before calling this function.
     // So, basically .at() is not necessary.
-    return is_obstacle_table_[index.y][index.x];
+    return is_obstacle_table_[index.y * costmap_.info.width + index.x];
   }
 
   PlannerCommonParam planner_common_param_;
@@ -170,11 +171,14 @@ protected:
   // collision indexes cache
   std::vector<std::vector<IndexXY>> coll_indexes_table_;
 
+  // collision indexes cache as offsets in is_obstacle_table_, updated with the costmap width
+  std::vector<std::vector<int>> coll_offsets_table_;
+
   // vehicle vertex indexes cache
   std::vector<std::vector<IndexXY>> vertex_indexes_table_;
 
-  // is_obstacle's table
-  std::vector<std::vector<bool>> is_obstacle_table_;
+  // is_obstacle's table, flattened in row-major order
+  std::vector<uint8_t> is_obstacle_table_;
 
   // pose in costmap frame
   geometry_msgs::msg::Pose start_pose_;
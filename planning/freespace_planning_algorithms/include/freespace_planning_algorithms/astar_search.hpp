@@ -17,6 +17,7 @@
 
 #include "freespace_planning_algorithms/abstract_algorithm.hpp"
 #include "freespace_planning_algorithms/reeds_shepp.hpp"
+#include "freespace_planning_algorithms/reeds_shepp_distance_table.hpp"
 
 #include <rclcpp/rclcpp.hpp>
 
@@ -26,10 +27,10 @@
 #include <cmath>
 #include <functional>
 #include <iostream>
-#include <queue>
+#include <memory>
 #include <string>
 #include <tuple>
-#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace freespace_planning_algorithms
@@ -44,6 +45,11 @@ struct AstarParam
 
   // search configs
   double distance_heuristic_weight;  // obstacle threshold on grid [0,255]
+
+  // reeds-shepp distance table configs
+  bool use_reeds_shepp_table = false;         // interpolate the heuristic from a precomputed table
+  double reeds_shepp_table_range = 0.0;       // relative positions covered by the table [m]
+  double reeds_shepp_table_resolution = 0.0;  // distance between the table positions [m]
 };
 
 struct AstarNode
@@ -55,17 +61,24 @@ struct AstarNode
   double gc = 0;                         // actual cost
   double hc = 0;                         // heuristic cost
   bool is_back;                          // true if the current direction of the vehicle is back
-  AstarNode * parent = nullptr;          // parent node
+  int parent_idx = -1;                   // index of the parent node, -1 for the start node
 
   double cost() const { return gc + hc; }
 };
 
-struct NodeComparison
+/// @brief open list of the search as a 4-ary min-heap of node indexes sorted by their cost
+class OpenList
 {
-  bool operator()(const AstarNode * lhs, const AstarNode * rhs)
-  {
-    return lhs->cost() > rhs->cost();
-  }
+public:
+  bool empty() const { return heap_.empty(); }
+  void clear() { heap_.clear(); }
+  void push(const double cost, const int node_idx);
+  /// @brief remove and return the index of the node with the minimum cost
+  int pop();
+
+private:
+  // the cost is stored with the index so that sorting does not access the nodes
+  std::vector<std::pair<double, int>> heap_;
 };
 
 struct NodeUpdate
@@ -120,7 +133,10 @@ public:
       AstarParam{
         node.declare_parameter<bool>("astar.only_behind_solutions"),
         node.declare_parameter<bool>("astar.use_back"),
-        node.declare_parameter<double>("astar.distance_heuristic_weight")})
+        node.declare_parameter<double>("astar.distance_heuristic_weight"),
+        node.declare_parameter<bool>("astar.use_reeds_shepp_table"),
+        node.declare_parameter<double>("astar.reeds_shepp_table_range"),
+        node.declare_parameter<double>("astar.reeds_shepp_table_resolution")})
   {
   }
 
@@ -131,7 +147,7 @@ public:
 
   const PlannerWaypoints & getWaypoints() const { return waypoints_; }
 
-  inline int getKey(const IndexXYT & index)
+  inline int getKey(const IndexXYT & index) const
   {
     return (index.theta + (index.y * x_scale_ + index.x) * y_scale_);
   }
@@ -142,13 +158,19 @@ private:
   void setPath(const AstarNode & goal);
   bool setStartNode();
   bool setGoalNode();
-  double estimateCost(const geometry_msgs::msg::Pose & pose) const;
+  double estimateCost(const double x, const double y, const double theta) const;
   bool isGoal(const AstarNode & node) const;
   geometry_msgs::msg::Pose node2pose(const AstarNode & node) const;
 
-  AstarNode * getNodeRef(const IndexXYT & index)
+  int getNodeIndex(const IndexXYT & index)
   {
-    return &(graph_.emplace(getKey(index), AstarNode()).first->second);
+    auto & node_idx = node_index_table_[getKey(index)];
+    if (node_idx < 0) {
+      node_idx = static_cast<int>(nodes_.size());
+      nodes_.emplace_back();
+      node_keys_.push_back(getKey(index));
+    }
+    return node_idx;
   }
 
   // Algorithm specific param
@@ -156,15 +178,21 @@ private:
 
   // hybrid astar variables
   TransitionTable transition_table_;
-  std::unordered_map<uint, AstarNode> graph_;
+  // nodes created by the search, indexed by node_index_table_ for each (x, y, theta) cell
+  std::vector<AstarNode> nodes_;
+  std::vector<int> node_keys_;
+  std::vector<int> node_index_table_;
 
-  std::priority_queue<AstarNode *, std::vector<AstarNode *>, NodeComparison> openlist_;
+  OpenList openlist_;
 
   // goal node, which may helpful in testing and debugging
-  AstarNode * goal_node_;
+  const AstarNode * goal_node_;
 
   // distance metric option (removed when the reeds_shepp gets stable)
   bool use_reeds_shepp_;
+  ReedsSheppStateSpace rs_space_;
+  // nullptr when the reeds-shepp distance is computed exactly
+  std::unique_ptr<ReedsSheppDistanceTable> rs_distance_table_;
 
   int x_scale_;
   int y_scale_;
@@ -0,0 +1,68 @@
+// Copyright 2023 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FREESPACE_PLANNING_ALGORITHMS__REEDS_SHEPP_DISTANCE_TABLE_HPP_
+#define FREESPACE_PLANNING_ALGORITHMS__REEDS_SHEPP_DISTANCE_TABLE_HPP_
+
+#include "freespace_planning_algorithms/reeds_shepp.hpp"
+
+#include <vector>
+
+namespace freespace_planning_algorithms
+{
+/**
+ * @brief reeds-shepp distances precomputed over a grid of relative poses
+ * @details The distance only depends on the pose of the second state relative to the first one.
+ * It is also unchanged when the relative pose is mirrored by the x or y axes, so the table only
+ * covers the relative positions with positive x and y, and the relative angles over a full turn.
+ * Between the poses of the table the distance is trilinearly interpolated, so it is only an
+ * approximation of the exact distance.
+ */
+class ReedsSheppDistanceTable
+{
+public:
+  using StateXYT = ReedsSheppStateSpace::StateXYT;
+
+  /**
+   * @brief compute the table
+   * @param [in] turning_radius turning radius of the reeds-shepp paths [m]
+   * @param [in] range relative positions within [-range, range] are covered by the table [m]
+   * @param [in] resolution distance between two relative positions of the table [m]
+   * @param [in] theta_size number of relative angles of the table
+   */
+  ReedsSheppDistanceTable(
+    const double turning_radius, const double range, const double resolution,
+    const int theta_size);
+
+  /**
+   * @brief return the interpolated distance from s0 to s1
+   * @details the exact distance is computed if the relative pose is out of the table
+   */
+  double distance(const StateXYT & s0, const StateXYT & s1) const;
+
+private:
+  float getDistance(const int index_x, const int index_y, const int index_theta) const
+  {
+    return distances_[(index_x * nb_positions_ + index_y) * theta_size_ + index_theta];
+  }
+
+  ReedsSheppStateSpace rs_space_;
+  double resolution_;
+  int nb_positions_;
+  int theta_size_;
+  std::vector<float> distances_;
+};
+}  // namespace freespace_planning_algorithms
+
+#endif  // FREESPACE_PLANNING_ALGORITHMS__REEDS_SHEPP_DISTANCE_TABLE_HPP_
@@ -29,6 +29,7 @@
 #include <memory>
 #include <random>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace rrtstar_core
@@ -122,6 +123,35 @@ struct Node
   NodeSharedPtr getParent() const { return parent.lock(); }
 };
 
+// Uniform grid over the node positions. As the reeds-shepp distance is bounded below by the
+// euclidean distance, the near nodes of a pose are only searched in the cells around it.
+class NodeGrid
+{
+public:
+  explicit NodeGrid(double cell_size) : cell_size_(cell_size) {}
+  void insert(const NodeSharedPtr & node);
+  void clear();
+  size_t size() const { return nb_nodes_; }
+  double getCellSize() const { return cell_size_; }
+  int getCellIndex(double coordinate) const
+  {
+    return static_cast<int>(std::floor(coordinate / cell_size_));
+  }
+  // nullptr if the cell has no node
+  const std::vector<NodeSharedPtr> * getCell(int index_x, int index_y) const;
+
+private:
+  static uint64_t getKey(int index_x, int index_y)
+  {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(index_x)) << 32) |
+           static_cast<uint64_t>(static_cast<uint32_t>(index_y));
+  }
+
+  const double cell_size_;
+  size_t nb_nodes_ = 0;
+  std::unordered_map<uint64_t, std::vector<NodeSharedPtr>> cells_;
+};
+
 class RRTStar
 {
 public:
@@ -151,6 +181,7 @@ private:
   NodeSharedPtr node_start_;
   NodeSharedPtr node_goal_;
   std::vector<NodeSharedPtr> nodes_;
+  NodeGrid node_grid_;
   std::vector<NodeSharedPtr> reached_nodes_;
   // std::vector<Node> nodes_;
   const double mu_;
@@ -109,19 +109,13 @@ void AbstractPlanningAlgorithm::setMap(const nav_msgs::msg::OccupancyGrid & cost
   const auto width = costmap_.info.width;
 
   // Initialize status
-  std::vector<std::vector<bool>> is_obstacle_table;
-  is_obstacle_table.resize(height);
-  for (uint32_t i = 0; i < height; i++) {
-    is_obstacle_table.at(i).resize(width);
-    for (uint32_t j = 0; j < width; j++) {
-      const int cost = costmap_.data[i * width + j];
-
-      if (cost < 0 || planner_common_param_.obstacle_threshold <= cost) {
-        is_obstacle_table[i][j] = true;
-      }
+  is_obstacle_table_.assign(height * width, 0);
+  for (uint32_t i = 0; i < height * width; i++) {
+    const int cost = costmap_.data[i];
+    if (cost < 0 || planner_common_param_.obstacle_threshold <= cost) {
+      is_obstacle_table_[i] = 1;
     }
   }
-  is_obstacle_table_ = is_obstacle_table;
 
   // construct collision indexes table
   if (is_collision_table_initialized == false) {
@@ -133,6 +127,16 @@ void AbstractPlanningAlgorithm::setMap(const nav_msgs::msg::OccupancyGrid & cost
     }
     is_collision_table_initialized = true;
   }
+
+  coll_offsets_table_.clear();
+  for (const auto & coll_indexes_2d : coll_indexes_table_) {
+    std::vector<int> coll_offsets;
+    coll_offsets.reserve(coll_indexes_2d.size());
+    for (const auto & coll_index_2d : coll_indexes_2d) {
+      coll_offsets.push_back(coll_index_2d.y * static_cast<int>(width) + coll_index_2d.x);
+    }
+    coll_offsets_table_.push_back(coll_offsets);
+  }
 }
 
 void AbstractPlanningAlgorithm::computeCollisionIndexes(
@@ -219,15 +223,10 @@ bool AbstractPlanningAlgorithm::detectCollision(const IndexXYT & base_index) con
     }
   }
 
-  const auto & coll_indexes_2d = coll_indexes_table_[base_index.theta];
-  for (const auto & coll_index_2d : coll_indexes_2d) {
-    int idx_theta = 0;  // whatever. Yaw is nothing to do with collision detection between grids.
-    IndexXYT coll_index{coll_index_2d.x, coll_index_2d.y, idx_theta};
-    // must slide to current base position
-    coll_index.x += base_index.x;
-    coll_index.y += base_index.y;
-
-    if (isObs(coll_index)) {
+  // the footprint cells are inside the vertices so sliding the offsets stays in the costmap
+  const int base_offset = base_index.y * static_cast<int>(costmap_.info.width) + base_index.x;
+  for (const auto coll_offset : coll_offsets_table_[base_index.theta]) {
+    if (is_obstacle_table_[base_offset + coll_offset]) {
       return true;
     }
   }
@@ -15,6 +15,7 @@
 #include "freespace_planning_algorithms/astar_search.hpp"
 
 #include <tier4_autoware_utils/geometry/geometry.hpp>
+#include <tier4_autoware_utils/math/normalization.hpp>
 #include <tier4_autoware_utils/math/unit_conversion.hpp>
 
 #include <tf2/utils.h>
@@ -25,24 +26,67 @@
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 #endif
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace freespace_planning_algorithms
 {
-double calcReedsSheppDistance(
-  const geometry_msgs::msg::Pose & p1, const geometry_msgs::msg::Pose & p2, double radius)
+namespace
 {
-  const auto rs_space = ReedsSheppStateSpace(radius);
-  const ReedsSheppStateSpace::StateXYT pose0{
-    p1.position.x, p1.position.y, tf2::getYaw(p1.orientation)};
-  const ReedsSheppStateSpace::StateXYT pose1{
-    p2.position.x, p2.position.y, tf2::getYaw(p2.orientation)};
-  return rs_space.distance(pose0, pose1);
+// number of children of each node of the open list heap
+constexpr size_t heap_arity = 4;
+}  // namespace
+
+void OpenList::push(const double cost, const int node_idx)
+{
+  // sift up
+  size_t idx = heap_.size();
+  heap_.emplace_back(cost, node_idx);
+  while (idx > 0) {
+    const size_t parent_idx = (idx - 1) / heap_arity;
+    if (heap_[parent_idx].first <= cost) {
+      break;
+    }
+    heap_[idx] = heap_[parent_idx];
+    idx = parent_idx;
+  }
+  heap_[idx] = {cost, node_idx};
 }
 
-void setYaw(geometry_msgs::msg::Quaternion * orientation, const double yaw)
+int OpenList::pop()
 {
-  *orientation = tier4_autoware_utils::createQuaternionFromYaw(yaw);
+  const int top_node_idx = heap_.front().second;
+  const auto last = heap_.back();
+  heap_.pop_back();
+  if (heap_.empty()) {
+    return top_node_idx;
+  }
+
+  // sift down the last element from the root
+  size_t idx = 0;
+  while (true) {
+    const size_t first_child_idx = idx * heap_arity + 1;
+    if (first_child_idx >= heap_.size()) {
+      break;
+    }
+    const size_t end_child_idx = std::min(first_child_idx + heap_arity, heap_.size());
+    size_t min_child_idx = first_child_idx;
+    for (size_t child_idx = first_child_idx + 1; child_idx < end_child_idx; ++child_idx) {
+      if (heap_[child_idx].first < heap_[min_child_idx].first) {
+        min_child_idx = child_idx;
+      }
+    }
+    if (last.first <= heap_[min_child_idx].first) {
+      break;
+    }
+    heap_[idx] = heap_[min_child_idx];
+    idx = min_child_idx;
+  }
+  heap_[idx] = last;
+  return top_node_idx;
 }
 
 geometry_msgs::msg::Pose calcRelativePose(
@@ -116,7 +160,10 @@ AstarSearch::AstarSearch(
 : AbstractPlanningAlgorithm(planner_common_param, collision_vehicle_shape),
   astar_param_(astar_param),
   goal_node_(nullptr),
-  use_reeds_shepp_(true)
+  use_reeds_shepp_(true),
+  rs_space_(
+    (planner_common_param.minimum_turning_radius + planner_common_param.maximum_turning_radius) *
+    0.5)
 {
   transition_table_ = createTransitionTable(
     planner_common_param_.minimum_turning_radius, planner_common_param_.maximum_turning_radius,
@@ -124,6 +171,12 @@ AstarSearch::AstarSearch(
     astar_param_.use_back);
 
   y_scale_ = planner_common_param.theta_size;
+
+  if (astar_param_.use_reeds_shepp_table) {
+    rs_distance_table_ = std::make_unique<ReedsSheppDistanceTable>(
+      rs_space_.rho_, astar_param_.reeds_shepp_table_range,
+      astar_param_.reeds_shepp_table_resolution, planner_common_param_.theta_size);
+  }
 }
 
 void AstarSearch::setMap(const nav_msgs::msg::OccupancyGrid & costmap)
@@ -132,8 +185,12 @@ void AstarSearch::setMap(const nav_msgs::msg::OccupancyGrid & costmap)
 
   clearNodes();
 
-  x_scale_ = costmap_.info.height;
-  graph_.reserve(100000);
+  x_scale_ = costmap_.info.width;
+  // entries of the created nodes are reset by clearNodes so the table is only filled here
+  node_index_table_.resize(
+    static_cast<size_t>(costmap_.info.width) * costmap_.info.height * y_scale_, -1);
+  nodes_.reserve(100000);
+  node_keys_.reserve(100000);
 }
 
 bool AstarSearch::makePlan(
@@ -142,6 +199,8 @@ bool AstarSearch::makePlan(
   start_pose_ = global2local(costmap_, start_pose);
   goal_pose_ = global2local(costmap_, goal_pose);
 
+  clearNodes();
+
   if (!setStartNode()) {
     return false;
   }
@@ -157,9 +216,14 @@ void AstarSearch::clearNodes()
 {
   // clearing openlist is necessary because otherwise remaining elements of openlist
   // point to deleted node.
-  openlist_ = std::priority_queue<AstarNode *, std::vector<AstarNode *>, NodeComparison>();
+  openlist_.clear();
 
-  graph_ = std::unordered_map<uint, AstarNode>();
+  for (const auto key : node_keys_) {
+    node_index_table_[key] = -1;
+  }
+  nodes_.clear();
+  node_keys_.clear();
+  goal_node_ = nullptr;
 }
 
 bool AstarSearch::setStartNode()
@@ -171,18 +235,20 @@ bool AstarSearch::setStartNode()
   }
 
   // Set start node
-  AstarNode * start_node = getNodeRef(index);
+  const int start_node_idx = getNodeIndex(index);
+  AstarNode * start_node = &nodes_[start_node_idx];
   start_node->x = start_pose_.position.x;
   start_node->y = start_pose_.position.y;
   start_node->theta = 2.0 * M_PI / planner_common_param_.theta_size * index.theta;
   start_node->gc = 0;
-  start_node->hc = estimateCost(start_pose_);
+  start_node->hc =
+    estimateCost(start_node->x, start_node->y, tf2::getYaw(start_pose_.orientation));
   start_node->is_back = false;
   start_node->status = NodeStatus::Open;
-  start_node->parent = nullptr;
+  start_node->parent_idx = -1;
 
   // Push start node to openlist
-  openlist_.push(start_node);
+  openlist_.push(start_node->cost(), start_node_idx);
 
   return true;
 }
@@ -198,18 +264,20 @@ bool AstarSearch::setGoalNode()
   return true;
 }
 
-double AstarSearch::estimateCost(const geometry_msgs::msg::Pose & pose) const
+double AstarSearch::estimateCost(const double x, const double y, const double theta) const
 {
   double total_cost = 0.0;
   // Temporarily, until reeds_shepp gets stable.
   if (use_reeds_shepp_) {
-    const double radius = (planner_common_param_.minimum_turning_radius +
-                           planner_common_param_.maximum_turning_radius) *
-                          0.5;
-    total_cost +=
-      calcReedsSheppDistance(pose, goal_pose_, radius) * astar_param_.distance_heuristic_weight;
+    const ReedsSheppStateSpace::StateXYT pose{x, y, theta};
+    const ReedsSheppStateSpace::StateXYT goal{
+      goal_pose_.position.x, goal_pose_.position.y, tf2::getYaw(goal_pose_.orientation)};
+    // the distance is the same in both directions, the table is relative to the fixed goal
+    const double distance = rs_distance_table_ ? rs_distance_table_->distance(goal, pose)
+                                               : rs_space_.distance(pose, goal);
+    total_cost += distance * astar_param_.distance_heuristic_weight;
   } else {
-    total_cost += tier4_autoware_utils::calcDistance2d(pose, goal_pose_) *
+    total_cost += std::hypot(x - goal_pose_.position.x, y - goal_pose_.position.y) *
                   astar_param_.distance_heuristic_weight;
   }
   return total_cost;
@@ -229,48 +297,53 @@ bool AstarSearch::search()
     }
 
     // Expand minimum cost node
-    AstarNode * current_node = openlist_.top();
-    openlist_.pop();
-    current_node->status = NodeStatus::Closed;
-
-    if (isGoal(*current_node)) {
-      goal_node_ = current_node;
-      setPath(*current_node);
+    const int current_node_idx = openlist_.pop();
+    // copied since creating the next nodes may reallocate the nodes
+    const AstarNode current_node = nodes_[current_node_idx];
+    nodes_[current_node_idx].status = NodeStatus::Closed;
+
+    if (isGoal(current_node)) {
+      goal_node_ = &nodes_[current_node_idx];
+      setPath(current_node);
       return true;
     }
 
     // Transit
-    const auto index_theta = discretizeAngle(current_node->theta, planner_common_param_.theta_size);
+    const auto index_theta = discretizeAngle(current_node.theta, planner_common_param_.theta_size);
     for (const auto & transition : transition_table_[index_theta]) {
-      const bool is_turning_point = transition.is_back != current_node->is_back;
+      const bool is_turning_point = transition.is_back != current_node.is_back;
 
       const double move_cost = is_turning_point
                                  ? planner_common_param_.reverse_weight * transition.distance
                                  : transition.distance;
 
       // Calculate index of the next state
-      geometry_msgs::msg::Pose next_pose;
-      next_pose.position.x = current_node->x + transition.shift_x;
-      next_pose.position.y = current_node->y + transition.shift_y;
-      setYaw(&next_pose.orientation, current_node->theta + transition.shift_theta);
-      const auto next_index = pose2index(costmap_, next_pose, planner_common_param_.theta_size);
-
-      if (detectCollision(next_index)) {
+      const double next_x = current_node.x + transition.shift_x;
+      const double next_y = current_node.y + transition.shift_y;
+      const double next_theta =
+        tier4_autoware_utils::normalizeRadian(current_node.theta + transition.shift_theta);
+      const IndexXYT next_index{
+        static_cast<int>(next_x / costmap_.info.resolution),
+        static_cast<int>(next_y / costmap_.info.resolution),
+        discretizeAngle(next_theta, planner_common_param_.theta_size)};
+
+      if (isOutOfRange(next_index) || detectCollision(next_index)) {
         continue;
       }
 
       // Compare cost
-      AstarNode * next_node = getNodeRef(next_index);
-      if (next_node->status == NodeStatus::None) {
-        next_node->status = NodeStatus::Open;
-        next_node->x = next_pose.position.x;
-        next_node->y = next_pose.position.y;
-        next_node->theta = tf2::getYaw(next_pose.orientation);
-        next_node->gc = current_node->gc + move_cost;
-        next_node->hc = estimateCost(next_pose);
-        next_node->is_back = transition.is_back;
-        next_node->parent = current_node;
-        openlist_.push(next_node);
+      const int next_node_idx = getNodeIndex(next_index);
+      AstarNode & next_node = nodes_[next_node_idx];
+      if (next_node.status == NodeStatus::None) {
+        next_node.status = NodeStatus::Open;
+        next_node.x = next_x;
+        next_node.y = next_y;
+        next_node.theta = next_theta;
+        next_node.gc = current_node.gc + move_cost;
+        next_node.hc = estimateCost(next_x, next_y, next_theta);
+        next_node.is_back = transition.is_back;
+        next_node.parent_idx = current_node_idx;
+        openlist_.push(next_node.cost(), next_node_idx);
         continue;
       }
     }
@@ -304,7 +377,7 @@ void AstarSearch::setPath(const AstarNode & goal_node)
     waypoints_.waypoints.push_back(pw);
 
     // To the next node
-    node = node->parent;
+    node = node->parent_idx < 0 ? nullptr : &nodes_[node->parent_idx];
   }
 
   // Reverse the vector to be start to goal order
@@ -0,0 +1,94 @@
+// Copyright 2023 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "freespace_planning_algorithms/reeds_shepp_distance_table.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace freespace_planning_algorithms
+{
+ReedsSheppDistanceTable::ReedsSheppDistanceTable(
+  const double turning_radius, const double range, const double resolution, const int theta_size)
+: rs_space_(turning_radius),
+  resolution_(resolution),
+  nb_positions_(static_cast<int>(std::ceil(range / resolution)) + 1),
+  theta_size_(theta_size)
+{
+  if (resolution <= 0.0 || range < 0.0 || theta_size <= 0) {
+    throw std::invalid_argument("invalid reeds-shepp distance table size");
+  }
+
+  const StateXYT origin{0.0, 0.0, 0.0};
+  distances_.resize(static_cast<size_t>(nb_positions_) * nb_positions_ * theta_size_);
+  for (int index_x = 0; index_x < nb_positions_; ++index_x) {
+    for (int index_y = 0; index_y < nb_positions_; ++index_y) {
+      for (int index_theta = 0; index_theta < theta_size_; ++index_theta) {
+        const StateXYT pose{
+          index_x * resolution_, index_y * resolution_, 2.0 * M_PI * index_theta / theta_size_};
+        distances_[(index_x * nb_positions_ + index_y) * theta_size_ + index_theta] =
+          rs_space_.distance(origin, pose);
+      }
+    }
+  }
+}
+
+double ReedsSheppDistanceTable::distance(const StateXYT & s0, const StateXYT & s1) const
+{
+  // pose of s1 relative to s0, mirrored to positive x and y
+  const double dx = s1.x - s0.x;
+  const double dy = s1.y - s0.y;
+  const double cos_yaw = std::cos(s0.yaw);
+  const double sin_yaw = std::sin(s0.yaw);
+  double x = cos_yaw * dx + sin_yaw * dy;
+  double y = -sin_yaw * dx + cos_yaw * dy;
+  double theta = s1.yaw - s0.yaw;
+  if (x < 0.0) {
+    x = -x;
+    theta = -theta;
+  }
+  if (y < 0.0) {
+    y = -y;
+    theta = -theta;
+  }
+
+  const double grid_x = x / resolution_;
+  const double grid_y = y / resolution_;
+  if (grid_x >= nb_positions_ - 1 || grid_y >= nb_positions_ - 1) {
+    return rs_space_.distance(StateXYT{0.0, 0.0, 0.0}, StateXYT{x, y, theta});
+  }
+  double grid_theta = std::fmod(theta / (2.0 * M_PI) * theta_size_, theta_size_);
+  if (grid_theta < 0.0) {
+    grid_theta += theta_size_;
+  }
+
+  const int x0 = static_cast<int>(grid_x);
+  const int y0 = static_cast<int>(grid_y);
+  const int theta0 = std::min(static_cast<int>(grid_theta), theta_size_ - 1);
+  const int theta1 = (theta0 + 1) % theta_size_;
+  const double tx = grid_x - x0;
+  const double ty = grid_y - y0;
+  const double ttheta = grid_theta - theta0;
+
+  const auto interpolate_theta = [&](const int index_x, const int index_y) {
+    return (1.0 - ttheta) * getDistance(index_x, index_y, theta0) +
+           ttheta * getDistance(index_x, index_y, theta1);
+  };
+  const double d0 = (1.0 - ty) * interpolate_theta(x0, y0) + ty * interpolate_theta(x0, y0 + 1);
+  const double d1 =
+    (1.0 - ty) * interpolate_theta(x0 + 1, y0) + ty * interpolate_theta(x0 + 1, y0 + 1);
+  return (1.0 - tx) * d0 + tx * d1;
+}
+}  // namespace freespace_planning_algorithms
@@ -127,10 +127,29 @@ bool CSpace::isValidPath_child2parent(
   return true;
 }
 
+void NodeGrid::insert(const NodeSharedPtr & node)
+{
+  cells_[getKey(getCellIndex(node->pose.x), getCellIndex(node->pose.y))].push_back(node);
+  ++nb_nodes_;
+}
+
+void NodeGrid::clear()
+{
+  cells_.clear();
+  nb_nodes_ = 0;
+}
+
+const std::vector<NodeSharedPtr> * NodeGrid::getCell(int index_x, int index_y) const
+{
+  const auto cell_iter = cells_.find(getKey(index_x, index_y));
+  return cell_iter == cells_.end() ? nullptr : &cell_iter->second;
+}
+
 RRTStar::RRTStar(
   Pose x_start, Pose x_goal, double mu, double collision_check_resolution, bool is_informed,
   CSpace cspace)
-: mu_(mu),
+: node_grid_(mu),
+  mu_(mu),
   collision_check_resolution_(collision_check_resolution),
   is_informed_(is_informed),
   cspace_(cspace)
@@ -138,6 +157,7 @@ RRTStar::RRTStar(
   node_goal_ = std::make_shared<Node>(Node{x_goal, boost::none, 0.0});
   node_start_ = std::make_shared<Node>(Node{x_start, 0.0});
   nodes_.push_back(node_start_);
+  node_grid_.insert(node_start_);
 }
 
 void RRTStar::extend()
@@ -257,6 +277,13 @@ void RRTStar::deleteNodeUsingBranchAndBound()
   for (const size_t delete_idx : delete_indices_vec) {
     nodes_.erase(nodes_.begin() + delete_idx);
   }
+
+  if (!delete_indices_vec.empty()) {
+    node_grid_.clear();
+    for (const auto & node : nodes_) {
+      node_grid_.insert(node);
+    }
+  }
 }
 
 std::vector<Pose> RRTStar::sampleSolutionWaypoints() const
@@ -332,14 +359,40 @@ NodeConstSharedPtr RRTStar::findNearestNode(const Pose & x_rand) const
 {
   double dist_min = inf;
   NodeConstSharedPtr node_nearest;
-  for (const auto & node : nodes_) {
-    if (cspace_.distanceLowerBound(node->pose, x_rand) < dist_min) {
-      const double dist_real = cspace_.distance(node->pose, x_rand);
-      if (dist_real < dist_min) {
-        dist_min = dist_real;
-        node_nearest = node;
+  const auto check_cell = [&](const int index_x, const int index_y) {
+    const auto * cell = node_grid_.getCell(index_x, index_y);
+    if (!cell) {
+      return size_t{0};
+    }
+    for (const auto & node : *cell) {
+      if (cspace_.distanceLowerBound(node->pose, x_rand) < dist_min) {
+        const double dist_real = cspace_.distance(node->pose, x_rand);
+        if (dist_real < dist_min) {
+          dist_min = dist_real;
+          node_nearest = node;
+        }
       }
     }
+    return cell->size();
+  };
+
+  // visit the rings of cells around the cell of x_rand. The nodes outside of the first n rings
+  // are at least (n - 1) cells away, so the search stops when none of them can be nearer.
+  const int center_x = node_grid_.getCellIndex(x_rand.x);
+  const int center_y = node_grid_.getCellIndex(x_rand.y);
+  size_t nb_visited_nodes = check_cell(center_x, center_y);
+  for (int ring = 1; nb_visited_nodes < node_grid_.size(); ++ring) {
+    if (dist_min <= (ring - 1) * node_grid_.getCellSize()) {
+      break;
+    }
+    for (int offset = -ring; offset <= ring; ++offset) {
+      nb_visited_nodes += check_cell(center_x + offset, center_y - ring);
+      nb_visited_nodes += check_cell(center_x + offset, center_y + ring);
+    }
+    for (int offset = -ring + 1; offset < ring; ++offset) {
+      nb_visited_nodes += check_cell(center_x - ring, center_y + offset);
+      nb_visited_nodes += check_cell(center_x + ring, center_y + offset);
+    }
   }
   return node_nearest;
 }
@@ -360,11 +413,21 @@ std::vector<NodeConstSharedPtr> RRTStar::findNeighborNodes(const Pose & x_new) c
   const double radius_neighbor = mu_;
 
   std::vector<NodeConstSharedPtr> nodes;
-  for (auto & node : nodes_) {
-    if (cspace_.distanceLowerBound(node->pose, x_new) > radius_neighbor) continue;
-    const bool is_neighbor = (cspace_.distance(node->pose, x_new) < radius_neighbor);
-    if (is_neighbor) {
-      nodes.push_back(node);
+  const int begin_x = node_grid_.getCellIndex(x_new.x - radius_neighbor);
+  const int end_x = node_grid_.getCellIndex(x_new.x + radius_neighbor);
+  const int begin_y = node_grid_.getCellIndex(x_new.y - radius_neighbor);
+  const int end_y = node_grid_.getCellIndex(x_new.y + radius_neighbor);
+  for (int index_x = begin_x; index_x <= end_x; ++index_x) {
+    for (int index_y = begin_y; index_y <= end_y; ++index_y) {
+      const auto * cell = node_grid_.getCell(index_x, index_y);
+      if (!cell) continue;
+      for (const auto & node : *cell) {
+        if (cspace_.distanceLowerBound(node->pose, x_new) > radius_neighbor) continue;
+        const bool is_neighbor = (cspace_.distance(node->pose, x_new) < radius_neighbor);
+        if (is_neighbor) {
+          nodes.push_back(node);
+        }
+      }
     }
   }
   return nodes;
@@ -377,6 +440,7 @@ NodeSharedPtr RRTStar::addNewNode(const Pose & pose, NodeSharedPtr node_parent)
   auto node_new =
     std::make_shared<Node>(Node{pose, cost_from_start, boost::none, cost_to_parent, node_parent});
   nodes_.push_back(node_new);
+  node_grid_.insert(node_new);
   node_parent->childs.push_back(node_new);
   return node_new;
 }
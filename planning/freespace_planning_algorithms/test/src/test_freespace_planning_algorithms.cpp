@@ -14,6 +14,7 @@
 
 #include "freespace_planning_algorithms/abstract_algorithm.hpp"
 #include "freespace_planning_algorithms/astar_search.hpp"
+#include "freespace_planning_algorithms/reeds_shepp_distance_table.hpp"
 #include "freespace_planning_algorithms/rrtstar.hpp"
 
 #include <rclcpp/rclcpp.hpp>
@@ -199,7 +200,8 @@ fpa::PlannerCommonParam get_default_planner_params()
     obstacle_threshold};
 }
 
-std::unique_ptr<fpa::AbstractPlanningAlgorithm> configure_astar(bool use_multi)
+std::unique_ptr<fpa::AbstractPlanningAlgorithm> configure_astar(
+  bool use_multi, bool use_reeds_shepp_table = false)
 {
   auto planner_common_param = get_default_planner_params();
   if (use_multi) {
@@ -211,8 +213,11 @@ std::unique_ptr<fpa::AbstractPlanningAlgorithm> configure_astar(bool use_multi)
   const bool only_behind_solutions = false;
   const bool use_back = true;
   const double distance_heuristic_weight = 1.0;
-  const auto astar_param =
-    fpa::AstarParam{only_behind_solutions, use_back, distance_heuristic_weight};
+  const double reeds_shepp_table_range = 20.0;
+  const double reeds_shepp_table_resolution = 0.5;
+  const auto astar_param = fpa::AstarParam{
+    only_behind_solutions,  use_back, distance_heuristic_weight, use_reeds_shepp_table,
+    reeds_shepp_table_range, reeds_shepp_table_resolution};
 
   auto algo = std::make_unique<fpa::AstarSearch>(planner_common_param, vehicle_shape, astar_param);
   return algo;
@@ -234,6 +239,7 @@ std::unique_ptr<fpa::AbstractPlanningAlgorithm> configure_rrtstar(bool informed,
 enum AlgorithmType {
   ASTAR_SINGLE,
   ASTAR_MULTI,
+  ASTAR_SINGLE_REEDS_SHEPP_TABLE,
   RRTSTAR_FASTEST,
   RRTSTAR_UPDATE,
   RRTSTAR_INFORMED_UPDATE,
@@ -242,6 +248,7 @@ enum AlgorithmType {
 std::unordered_map<AlgorithmType, std::string> rosbag_dir_prefix_table(
   {{ASTAR_SINGLE, "fpalgos-astar_single"},
    {ASTAR_MULTI, "fpalgos-astar_multi"},
+   {ASTAR_SINGLE_REEDS_SHEPP_TABLE, "fpalgos-astar_single_reeds_shepp_table"},
    {RRTSTAR_FASTEST, "fpalgos-rrtstar_fastest"},
    {RRTSTAR_UPDATE, "fpalgos-rrtstar_update"},
    {RRTSTAR_INFORMED_UPDATE, "fpalgos-rrtstar_informed_update"}});
@@ -253,6 +260,8 @@ bool test_algorithm(enum AlgorithmType algo_type, bool dump_rosbag = false)
     algo = configure_astar(true);
   } else if (algo_type == AlgorithmType::ASTAR_MULTI) {
     algo = configure_astar(false);
+  } else if (algo_type == AlgorithmType::ASTAR_SINGLE_REEDS_SHEPP_TABLE) {
+    algo = configure_astar(true, true);
   } else if (algo_type == AlgorithmType::RRTSTAR_FASTEST) {
     algo = configure_rrtstar(false, false);
   } else if (algo_type == AlgorithmType::RRTSTAR_UPDATE) {
@@ -364,6 +373,51 @@ TEST(AstarSearchTestSuite, MultiCurvature)
   EXPECT_TRUE(test_algorithm(AlgorithmType::ASTAR_MULTI));
 }
 
+TEST(AstarSearchTestSuite, SingleCurvatureReedsSheppTable)
+{
+  EXPECT_TRUE(test_algorithm(AlgorithmType::ASTAR_SINGLE_REEDS_SHEPP_TABLE));
+}
+
+TEST(ReedsSheppDistanceTableTestSuite, MatchExactDistance)
+{
+  const double radius = 9.0;
+  const int theta_size = 144;
+  const auto table = fpa::ReedsSheppDistanceTable(radius, 10.0, 0.5, theta_size);
+  const auto rs_space = fpa::ReedsSheppStateSpace(radius);
+
+  // exact on the poses of the table, in any frame and mirrored to any quadrant
+  const fpa::ReedsSheppStateSpace::StateXYT s0{3.0, -2.0, 0.7};
+  for (const double x : {-4.5, 0.0, 2.0, 9.5}) {
+    for (const double y : {-1.0, 0.5, 6.0}) {
+      for (const int theta_index : {0, 17, 100}) {
+        const fpa::ReedsSheppStateSpace::StateXYT s1{
+          s0.x + std::cos(s0.yaw) * x - std::sin(s0.yaw) * y,
+          s0.y + std::sin(s0.yaw) * x + std::cos(s0.yaw) * y,
+          s0.yaw + 2.0 * M_PI * theta_index / theta_size};
+        EXPECT_NEAR(table.distance(s0, s1), rs_space.distance(s0, s1), 1e-4);
+      }
+    }
+  }
+
+  // exact out of the table
+  const fpa::ReedsSheppStateSpace::StateXYT s1{20.0, 15.0, 0.3};
+  EXPECT_DOUBLE_EQ(table.distance(s0, s1), rs_space.distance(s0, s1));
+}
+
+TEST(AstarSearchTestSuite, NonSquareCostmapRepeatedPlans)
+{
+  const auto algo = configure_astar(true);
+  // wider than high so that the node indexes depend on the width of the costmap
+  const auto costmap_msg = construct_cost_map(200, 150, 0.2, 10);
+  algo->setMap(costmap_msg);
+  for (const auto & goal_pose : goal_poses) {
+    // the nodes of the previous plan must not be reused
+    for (size_t i = 0; i < 2; ++i) {
+      EXPECT_TRUE(algo->makePlan(create_pose_msg(start_pose), create_pose_msg(goal_pose)));
+    }
+  }
+}
+
 TEST(RRTStarTestSuite, Fastest)
 {
   EXPECT_TRUE(test_algorithm(AlgorithmType::RRTSTAR_FASTEST));
@@ -63,32 +63,14 @@ bool is_in_lane(const lanelet::ConstLanelet & lanelet, const lanelet::ConstPoint
   return distance < th_distance;
 }
 
-bool is_in_parking_space(
-  const lanelet::ConstLineStrings3d & parking_spaces, const lanelet::ConstPoint3d & point)
+// check if the point is in one of the parking spaces or parking lots
+bool is_in_parking_area(
+  const std::vector<lanelet::BasicPolygon2d> & parking_polygons,
+  const lanelet::ConstPoint3d & point)
 {
-  for (const auto & parking_space : parking_spaces) {
-    lanelet::ConstPolygon3d parking_space_polygon;
-    if (!lanelet::utils::lineStringWithWidthToPolygon(parking_space, &parking_space_polygon)) {
-      continue;
-    }
-
-    const double distance = boost::geometry::distance(
-      lanelet::utils::to2D(parking_space_polygon).basicPolygon(),
-      lanelet::utils::to2D(point).basicPoint());
-    constexpr double th_distance = std::numeric_limits<double>::epsilon();
-    if (distance < th_distance) {
-      return true;
-    }
-  }
-  return false;
-}
-
-bool is_in_parking_lot(
-  const lanelet::ConstPolygons3d & parking_lots, const lanelet::ConstPoint3d & point)
-{
-  for (const auto & parking_lot : parking_lots) {
-    const double distance = boost::geometry::distance(
-      lanelet::utils::to2D(parking_lot).basicPolygon(), lanelet::utils::to2D(point).basicPoint());
+  const auto point_2d = lanelet::utils::to2D(point).basicPoint();
+  for (const auto & parking_polygon : parking_polygons) {
+    const double distance = boost::geometry::distance(parking_polygon, point_2d);
     constexpr double th_distance = std::numeric_limits<double>::epsilon();
     if (distance < th_distance) {
       return true;
@@ -107,11 +89,11 @@ double project_goal_to_map(
 }
 
 geometry_msgs::msg::Pose get_closest_centerline_pose(
-  const lanelet::ConstLanelets & road_lanelets, const geometry_msgs::msg::Pose & point,
+  const route_handler::LaneletGridIndex & lanelets_index, const geometry_msgs::msg::Pose & point,
   vehicle_info_util::VehicleInfo vehicle_info)
 {
   lanelet::Lanelet closest_lanelet;
-  lanelet::utils::query::getClosestLanelet(road_lanelets, point, &closest_lanelet);
+  lanelets_index.getClosestLanelet(point, &closest_lanelet);
 
   const auto refined_center_line = lanelet::utils::generateFineCenterline(closest_lanelet, 1.0);
   closest_lanelet.setCenterline(refined_center_line);
@@ -184,6 +166,22 @@ void DefaultPlanner::map_callback(const HADMapBin::ConstSharedPtr msg)
   lanelet::ConstLanelets all_lanelets = lanelet::utils::query::laneletLayer(lanelet_map_ptr_);
   road_lanelets_ = lanelet::utils::query::roadLanelets(all_lanelets);
   shoulder_lanelets_ = lanelet::utils::query::shoulderLanelets(all_lanelets);
+
+  all_lanelets_index_.build(all_lanelets);
+  road_lanelets_index_.build(road_lanelets_);
+  shoulder_lanelets_index_.build(shoulder_lanelets_);
+  parking_space_polygons_.clear();
+  for (const auto & parking_space : lanelet::utils::query::getAllParkingSpaces(lanelet_map_ptr_)) {
+    lanelet::ConstPolygon3d parking_space_polygon;
+    if (lanelet::utils::lineStringWithWidthToPolygon(parking_space, &parking_space_polygon)) {
+      parking_space_polygons_.push_back(
+        lanelet::utils::to2D(parking_space_polygon).basicPolygon());
+    }
+  }
+  parking_lot_polygons_.clear();
+  for (const auto & parking_lot : lanelet::utils::query::getAllParkingLots(lanelet_map_ptr_)) {
+    parking_lot_polygons_.push_back(lanelet::utils::to2D(parking_lot).basicPolygon());
+  }
   is_graph_ready_ = true;
 }
 
@@ -319,9 +317,8 @@ bool DefaultPlanner::is_goal_valid(
   const auto goal_lanelet_pt = lanelet::utils::conversion::toLaneletPoint(goal.position);
 
   // check if goal is in shoulder lanelet
-  lanelet::Lanelet closest_shoulder_lanelet;
-  if (lanelet::utils::query::getClosestLanelet(
-        shoulder_lanelets_, goal, &closest_shoulder_lanelet)) {
+  lanelet::ConstLanelet closest_shoulder_lanelet;
+  if (shoulder_lanelets_index_.getClosestLanelet(goal, &closest_shoulder_lanelet)) {
     if (is_in_lane(closest_shoulder_lanelet, goal_lanelet_pt)) {
       const auto lane_yaw =
         lanelet::utils::getLaneletAngle(closest_shoulder_lanelet, goal.position);
@@ -334,8 +331,8 @@ bool DefaultPlanner::is_goal_valid(
     }
   }
 
-  lanelet::Lanelet closest_lanelet;
-  if (!lanelet::utils::query::getClosestLanelet(road_lanelets_, goal, &closest_lanelet)) {
+  lanelet::ConstLanelet closest_lanelet;
+  if (!road_lanelets_index_.getClosestLanelet(goal, &closest_lanelet)) {
     return false;
   }
 
@@ -354,9 +351,7 @@ bool DefaultPlanner::is_goal_valid(
     param_.check_footprint_inside_lanes &&
     !check_goal_footprint(
       closest_lanelet, combined_prev_lanelet, polygon_footprint, next_lane_length) &&
-    !is_in_parking_lot(
-      lanelet::utils::query::getAllParkingLots(lanelet_map_ptr_),
-      lanelet::utils::conversion::toLaneletPoint(goal.position))) {
+    !is_in_parking_area(parking_lot_polygons_, goal_lanelet_pt)) {
     RCLCPP_WARN(logger, "Goal's footprint exceeds lane!");
     return false;
   }
@@ -373,14 +368,12 @@ bool DefaultPlanner::is_goal_valid(
   }
 
   // check if goal is in parking space
-  const auto parking_spaces = lanelet::utils::query::getAllParkingSpaces(lanelet_map_ptr_);
-  if (is_in_parking_space(parking_spaces, goal_lanelet_pt)) {
+  if (is_in_parking_area(parking_space_polygons_, goal_lanelet_pt)) {
     return true;
   }
 
   // check if goal is in parking lot
-  const auto parking_lots = lanelet::utils::query::getAllParkingLots(lanelet_map_ptr_);
-  if (is_in_parking_lot(parking_lots, goal_lanelet_pt)) {
+  if (is_in_parking_area(parking_lot_polygons_, goal_lanelet_pt)) {
     return true;
   }
 
@@ -425,8 +418,7 @@ PlannerPlugin::LaneletRoute DefaultPlanner::plan(const RoutePoints & points)
 
   auto goal_pose = points.back();
   if (param_.enable_correct_goal_pose) {
-    goal_pose = get_closest_centerline_pose(
-      lanelet::utils::query::laneletLayer(lanelet_map_ptr_), goal_pose, vehicle_info_);
+    goal_pose = get_closest_centerline_pose(all_lanelets_index_, goal_pose, vehicle_info_);
   }
 
   if (!is_goal_valid(goal_pose, all_route_lanelets)) {
@@ -17,6 +17,7 @@
 
 #include <mission_planner/mission_planner_plugin.hpp>
 #include <rclcpp/rclcpp.hpp>
+#include <route_handler/lanelet_grid_index.hpp>
 #include <route_handler/route_handler.hpp>
 #include <vehicle_info_util/vehicle_info_util.hpp>
 
@@ -24,6 +25,7 @@
 #include <autoware_planning_msgs/msg/lanelet_route.hpp>
 #include <geometry_msgs/msg/pose_stamped.hpp>
 
+#include <lanelet2_core/primitives/Polygon.h>
 #include <lanelet2_routing/RoutingGraph.h>
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 
@@ -63,6 +65,13 @@ private:
   lanelet::ConstLanelets shoulder_lanelets_;
   route_handler::RouteHandler route_handler_;
 
+  // lookups for the goal validation, built when the map is received
+  route_handler::LaneletGridIndex all_lanelets_index_;
+  route_handler::LaneletGridIndex road_lanelets_index_;
+  route_handler::LaneletGridIndex shoulder_lanelets_index_;
+  std::vector<lanelet::BasicPolygon2d> parking_space_polygons_;
+  std::vector<lanelet::BasicPolygon2d> parking_lot_polygons_;
+
   DefaultPlannerParameters param_;
 
   rclcpp::Node * node_;
@@ -0,0 +1,299 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ament_index_cpp/get_package_share_directory.hpp"
+#include "motion_velocity_smoother/smoother/analytical_jerk_constrained_smoother/analytical_jerk_constrained_smoother.hpp"
+#include "motion_velocity_smoother/smoother/hybrid_smoother.hpp"
+#include "motion_velocity_smoother/smoother/jerk_filtered_smoother.hpp"
+#include "motion_velocity_smoother/smoother/l2_pseudo_jerk_smoother.hpp"
+#include "motion_velocity_smoother/smoother/linf_pseudo_jerk_smoother.hpp"
+#include "motion_velocity_smoother/trajectory_utils.hpp"
+#include "tier4_autoware_utils/geometry/geometry.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+using autoware_auto_planning_msgs::msg::TrajectoryPoint;
+using motion_velocity_smoother::SmootherBase;
+using motion_velocity_smoother::trajectory_utils::ConstraintViolation;
+using motion_velocity_smoother::trajectory_utils::TrajectoryPoints;
+
+struct Scenario
+{
+  std::string name;
+  TrajectoryPoints traj_points;
+  double initial_vel;
+};
+
+struct SmootherResult
+{
+  std::vector<double> times_us;
+  ConstraintViolation violation;
+  size_t failure_num{0};
+  size_t qp_num{0};
+};
+
+template <typename T>
+T calcPercentile(std::vector<T> values, const double ratio)
+{
+  if (values.empty()) {
+    return T{};
+  }
+  std::sort(values.begin(), values.end());
+  const size_t idx = std::min(
+    values.size() - 1, static_cast<size_t>(ratio * static_cast<double>(values.size() - 1) + 0.5));
+  return values.at(idx);
+}
+
+// trajectory going straight for straight_length, then along an arc with a constant curvature
+TrajectoryPoints createTrajectoryPoints(
+  const size_t point_num, const double interval, const double straight_length,
+  const double curvature, const double velocity)
+{
+  TrajectoryPoints traj_points;
+  double x = 0.0;
+  double y = 0.0;
+  double yaw = 0.0;
+  for (size_t i = 0; i < point_num; ++i) {
+    TrajectoryPoint point;
+    point.pose.position = tier4_autoware_utils::createPoint(x, y, 0.0);
+    point.pose.orientation = tier4_autoware_utils::createQuaternionFromYaw(yaw);
+    point.longitudinal_velocity_mps = velocity;
+    traj_points.push_back(point);
+
+    x += interval * std::cos(yaw);
+    y += interval * std::sin(yaw);
+    if (static_cast<double>(i) * interval >= straight_length) {
+      yaw += interval * curvature;
+    }
+  }
+  traj_points.back().longitudinal_velocity_mps = 0.0;
+  return traj_points;
+}
+
+void setVelocityFrom(TrajectoryPoints & traj_points, const size_t start_idx, const double velocity)
+{
+  for (size_t i = start_idx; i < traj_points.size(); ++i) {
+    traj_points.at(i).longitudinal_velocity_mps = velocity;
+  }
+}
+
+std::vector<Scenario> createScenarios()
+{
+  std::vector<Scenario> scenarios;
+  scenarios.push_back({"highway cruise", createTrajectoryPoints(300, 1.0, 300.0, 0.0, 25.0), 20.0});
+
+  auto stop_points = createTrajectoryPoints(300, 1.0, 300.0, 0.0, 15.0);
+  setVelocityFrom(stop_points, 80, 0.0);
+  scenarios.push_back({"stop ahead", stop_points, 15.0});
+
+  scenarios.push_back({"curve", createTrajectoryPoints(300, 1.0, 50.0, 0.05, 15.0), 12.0});
+
+  auto limit_points = createTrajectoryPoints(300, 1.0, 300.0, 0.0, 15.0);
+  setVelocityFrom(limit_points, 60, 8.0);
+  limit_points.back().longitudinal_velocity_mps = 0.0;
+  scenarios.push_back({"velocity limit drop", limit_points, 15.0});
+  return scenarios;
+}
+
+// recorded trajectory with a "x,y,yaw,velocity" line per point, the initial velocity is the first
+// velocity
+bool readScenario(const std::string & csv_path, Scenario & scenario)
+{
+  std::ifstream csv_file(csv_path);
+  if (!csv_file.is_open()) {
+    return false;
+  }
+
+  scenario.name = csv_path;
+  std::string line;
+  while (std::getline(csv_file, line)) {
+    std::replace(line.begin(), line.end(), ',', ' ');
+    std::istringstream line_stream(line);
+    double x, y, yaw, velocity;
+    if (!(line_stream >> x >> y >> yaw >> velocity)) {
+      continue;
+    }
+    TrajectoryPoint point;
+    point.pose.position = tier4_autoware_utils::createPoint(x, y, 0.0);
+    point.pose.orientation = tier4_autoware_utils::createQuaternionFromYaw(yaw);
+    point.longitudinal_velocity_mps = velocity;
+    scenario.traj_points.push_back(point);
+  }
+  if (scenario.traj_points.size() < 2) {
+    return false;
+  }
+  scenario.initial_vel = scenario.traj_points.front().longitudinal_velocity_mps;
+  return true;
+}
+
+std::shared_ptr<rclcpp::Node> createNode(const std::string & smoother_type)
+{
+  const auto motion_velocity_smoother_dir =
+    ament_index_cpp::get_package_share_directory("motion_velocity_smoother");
+  auto node_options = rclcpp::NodeOptions{};
+  node_options.arguments(
+    {"--ros-args", "--params-file",
+     motion_velocity_smoother_dir + "/config/default_motion_velocity_smoother.param.yaml",
+     "--params-file", motion_velocity_smoother_dir + "/config/default_common.param.yaml",
+     "--params-file", motion_velocity_smoother_dir + "/config/" + smoother_type + ".param.yaml"});
+  return std::make_shared<rclcpp::Node>(
+    "motion_velocity_smoother_benchmark_" + smoother_type, node_options);
+}
+
+std::shared_ptr<SmootherBase> createSmoother(const std::string & smoother_type, rclcpp::Node & node)
+{
+  using motion_velocity_smoother::AnalyticalJerkConstrainedSmoother;
+  using motion_velocity_smoother::HybridSmoother;
+  using motion_velocity_smoother::JerkFilteredSmoother;
+  using motion_velocity_smoother::L2PseudoJerkSmoother;
+  using motion_velocity_smoother::LinfPseudoJerkSmoother;
+
+  std::shared_ptr<SmootherBase> smoother;
+  if (smoother_type == "Analytical") {
+    smoother = std::make_shared<AnalyticalJerkConstrainedSmoother>(node);
+  } else if (smoother_type == "JerkFiltered") {
+    smoother = std::make_shared<JerkFilteredSmoother>(node);
+  } else if (smoother_type == "L2") {
+    smoother = std::make_shared<L2PseudoJerkSmoother>(node);
+  } else if (smoother_type == "Linf") {
+    smoother = std::make_shared<LinfPseudoJerkSmoother>(node);
+  } else {
+    smoother = std::make_shared<HybridSmoother>(node);
+  }
+  smoother->setWheelBase(2.79);
+  return smoother;
+}
+
+// same steps as MotionVelocitySmootherNode::smoothVelocity with the ego at the trajectory start
+SmootherResult benchmarkSmoother(
+  SmootherBase & smoother, const Scenario & scenario, const size_t iteration_num)
+{
+  constexpr double nearest_dist_threshold = 3.0;
+  constexpr double nearest_yaw_threshold = 1.046;
+  const auto & current_pose = scenario.traj_points.front().pose;
+  const auto hybrid_smoother = dynamic_cast<motion_velocity_smoother::HybridSmoother *>(&smoother);
+
+  SmootherResult result;
+  result.times_us.reserve(iteration_num);
+  for (size_t i = 0; i < iteration_num; ++i) {
+    TrajectoryPoints output;
+    std::vector<TrajectoryPoints> debug_trajectories;
+
+    const auto time_start = std::chrono::steady_clock::now();
+    const auto traj_lateral_acc_filtered = smoother.applyLateralAccelerationFilter(
+      scenario.traj_points, scenario.initial_vel, 0.0, true, true);
+    auto traj_resampled = smoother.resampleTrajectory(
+      traj_lateral_acc_filtered, scenario.initial_vel, current_pose, nearest_dist_threshold,
+      nearest_yaw_threshold);
+    if (!traj_resampled.empty()) {
+      traj_resampled.back().longitudinal_velocity_mps = 0.0;
+    }
+    const bool is_solved =
+      smoother.apply(scenario.initial_vel, 0.0, traj_resampled, output, debug_trajectories);
+    const auto time_end = std::chrono::steady_clock::now();
+
+    result.times_us.push_back(
+      std::chrono::duration<double, std::micro>(time_end - time_start).count());
+    if (!is_solved) {
+      ++result.failure_num;
+      continue;
+    }
+    if (hybrid_smoother && hybrid_smoother->isQPUsed()) {
+      ++result.qp_num;
+    }
+
+    // the violation against the input trajectory, not the lateral acceleration filtered one
+    const auto violation = motion_velocity_smoother::trajectory_utils::calcConstraintViolation(
+      traj_resampled, output, smoother.getMaxAccel(), smoother.getMinDecel(),
+      smoother.getMaxJerk(), smoother.getMinJerk());
+    result.violation.over_velocity =
+      std::max(result.violation.over_velocity, violation.over_velocity);
+    result.violation.over_acceleration =
+      std::max(result.violation.over_acceleration, violation.over_acceleration);
+    result.violation.over_jerk = std::max(result.violation.over_jerk, violation.over_jerk);
+  }
+  return result;
+}
+
+void printResult(
+  const std::string & smoother_type, const SmootherResult & result, const size_t iteration_num)
+{
+  std::printf(
+    "%-14s p50 %10.1f [us], p99 %10.1f [us], over vel %6.3f [m/s], over acc %6.3f [m/ss], "
+    "over jerk %6.3f [m/sss], failure %lu/%lu, QP %lu/%lu\n",
+    smoother_type.c_str(), calcPercentile(result.times_us, 0.5),
+    calcPercentile(result.times_us, 0.99), result.violation.over_velocity,
+    result.violation.over_acceleration, result.violation.over_jerk, result.failure_num,
+    iteration_num, result.qp_num, iteration_num);
+}
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+
+  const auto non_ros_args = rclcpp::remove_ros_arguments(argc, argv);
+  const size_t iteration_num = 2 <= non_ros_args.size() ? std::stoul(non_ros_args.at(1)) : 100;
+
+  // the recorded trajectories are used instead of the synthetic ones if any
+  std::vector<Scenario> scenarios;
+  for (size_t i = 2; i < non_ros_args.size(); ++i) {
+    Scenario scenario;
+    if (!readScenario(non_ros_args.at(i), scenario)) {
+      std::fprintf(stderr, "Could not read the trajectory in %s\n", non_ros_args.at(i).c_str());
+      rclcpp::shutdown();
+      return 1;
+    }
+    scenarios.push_back(scenario);
+  }
+  if (scenarios.empty()) {
+    scenarios = createScenarios();
+  }
+
+  const std::vector<std::string> smoother_types = {
+    "Analytical", "JerkFiltered", "L2", "Linf", "Hybrid"};
+  std::vector<std::shared_ptr<rclcpp::Node>> nodes;
+  std::vector<std::shared_ptr<SmootherBase>> smoothers;
+  for (const auto & smoother_type : smoother_types) {
+    nodes.push_back(createNode(smoother_type));
+    smoothers.push_back(createSmoother(smoother_type, *nodes.back()));
+  }
+
+  std::printf("iteration: %lu\n", iteration_num);
+  for (const auto & scenario : scenarios) {
+    std::printf(
+      "--- %s (%lu points, initial velocity %.1f [m/s]) ---\n", scenario.name.c_str(),
+      scenario.traj_points.size(), scenario.initial_vel);
+    for (size_t i = 0; i < smoother_types.size(); ++i) {
+      printResult(
+        smoother_types.at(i), benchmarkSmoother(*smoothers.at(i), scenario, iteration_num),
+        iteration_num);
+    }
+  }
+
+  rclcpp::shutdown();
+  return 0;
+}
@@ -15,10 +15,13 @@
 #ifndef MOTION_VELOCITY_SMOOTHER__MOTION_VELOCITY_SMOOTHER_NODE_HPP_
 #define MOTION_VELOCITY_SMOOTHER__MOTION_VELOCITY_SMOOTHER_NODE_HPP_
 
+#include "latency_aggregator/latency_hop_publisher.hpp"
 #include "motion_utils/trajectory/tmp_conversion.hpp"
 #include "motion_utils/trajectory/trajectory.hpp"
+#include "motion_velocity_smoother/replan_checker.hpp"
 #include "motion_velocity_smoother/resample.hpp"
 #include "motion_velocity_smoother/smoother/analytical_jerk_constrained_smoother/analytical_jerk_constrained_smoother.hpp"
+#include "motion_velocity_smoother/smoother/hybrid_smoother.hpp"
 #include "motion_velocity_smoother/smoother/jerk_filtered_smoother.hpp"
 #include "motion_velocity_smoother/smoother/l2_pseudo_jerk_smoother.hpp"
 #include "motion_velocity_smoother/smoother/linf_pseudo_jerk_smoother.hpp"
@@ -86,6 +89,7 @@ private:
   rclcpp::Subscription<Trajectory>::SharedPtr sub_current_trajectory_;
   rclcpp::Subscription<VelocityLimit>::SharedPtr sub_external_velocity_limit_;
   rclcpp::Subscription<OperationModeState>::SharedPtr sub_operation_mode_;
+  std::unique_ptr<latency_aggregator::LatencyHopPublisher> latency_hop_publisher_;
 
   Odometry::ConstSharedPtr current_odometry_ptr_;  // current odometry
   AccelWithCovarianceStamped::ConstSharedPtr current_acceleration_ptr_;
@@ -98,6 +102,9 @@ private:
 
   TrajectoryPoints prev_output_;  // previously published trajectory
 
+  // reuse the previous output while the input trajectory is unchanged
+  std::unique_ptr<ReplanChecker> replan_checker_;
+
   // previous trajectory point closest to ego vehicle
   boost::optional<TrajectoryPoint> prev_closest_point_{};
   boost::optional<TrajectoryPoint> current_closest_point_from_prev_output_{};
@@ -113,6 +120,7 @@ private:
     L2 = 2,
     LINF = 3,
     ANALYTICAL = 4,
+    HYBRID = 5,
   };
 
   enum class InitializeType {
@@ -144,7 +152,7 @@ private:
     double ego_nearest_yaw_threshold;     // for ego's closest index calculation
 
     resampling::ResampleParam post_resample_param;
-    AlgorithmType algorithm_type;  // Option : JerkFiltered, Linf, L2
+    AlgorithmType algorithm_type;  // Option : JerkFiltered, Linf, L2, Analytical, Hybrid
 
     bool plan_from_ego_speed_on_manual_mode = true;
   } node_param_{};
@@ -0,0 +1,74 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MOTION_VELOCITY_SMOOTHER__REPLAN_CHECKER_HPP_
+#define MOTION_VELOCITY_SMOOTHER__REPLAN_CHECKER_HPP_
+
+#include "rclcpp/rclcpp.hpp"
+
+#include "autoware_auto_planning_msgs/msg/trajectory_point.hpp"
+#include "geometry_msgs/msg/pose.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace motion_velocity_smoother
+{
+using autoware_auto_planning_msgs::msg::TrajectoryPoint;
+using geometry_msgs::msg::Pose;
+
+// Checks whether the input trajectory has changed from the one of the last optimization. While the
+// shape and the velocity of the input trajectory ahead of ego are unchanged, the previous output
+// can be reused instead of optimizing the velocity again.
+class ReplanChecker
+{
+public:
+  explicit ReplanChecker(rclcpp::Node * node);
+  void onParam(const std::vector<rclcpp::Parameter> & parameters);
+
+  bool isReplanRequired(
+    const std::vector<TrajectoryPoint> & traj_points, const Pose & ego_pose,
+    const rclcpp::Time & current_time, const double ego_nearest_dist_threshold,
+    const double ego_nearest_yaw_threshold) const;
+
+  void updateData(
+    const std::vector<TrajectoryPoint> & traj_points, const Pose & ego_pose,
+    const rclcpp::Time & current_time);
+
+  void reset();
+
+private:
+  rclcpp::Logger logger_;
+
+  // input of the last optimization
+  std::shared_ptr<std::vector<TrajectoryPoint>> prev_traj_points_ptr_{nullptr};
+  std::shared_ptr<Pose> prev_ego_pose_ptr_{nullptr};
+  std::shared_ptr<rclcpp::Time> prev_replanned_time_ptr_{nullptr};
+
+  // algorithm parameters
+  bool enable_;
+  double max_path_shape_lat_dist_;
+  double max_velocity_diff_;
+  double max_ego_moving_dist_;
+  double max_delta_time_sec_;
+
+  // whether a point of the target trajectory ahead of ego deviates from the base trajectory
+  bool isTrajectoryChanged(
+    const std::vector<TrajectoryPoint> & base_points,
+    const std::vector<TrajectoryPoint> & target_points, const Pose & ego_pose,
+    const double ego_nearest_dist_threshold, const double ego_nearest_yaw_threshold) const;
+};
+}  // namespace motion_velocity_smoother
+
+#endif  // MOTION_VELOCITY_SMOOTHER__REPLAN_CHECKER_HPP_
@@ -0,0 +1,63 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MOTION_VELOCITY_SMOOTHER__SMOOTHER__HYBRID_SMOOTHER_HPP_
+#define MOTION_VELOCITY_SMOOTHER__SMOOTHER__HYBRID_SMOOTHER_HPP_
+
+#include "motion_velocity_smoother/smoother/analytical_jerk_constrained_smoother/analytical_jerk_constrained_smoother.hpp"
+#include "motion_velocity_smoother/smoother/jerk_filtered_smoother.hpp"
+
+#include <vector>
+
+namespace motion_velocity_smoother
+{
+/**
+ * @brief smoother running the analytical jerk constrained smoother first, and the jerk filtered
+ * QP only when the analytical result violates the velocity, acceleration or jerk limits by more
+ * than the tolerances
+ */
+class HybridSmoother : public JerkFilteredSmoother
+{
+public:
+  struct Param
+  {
+    double velocity_tolerance;      // allowed velocity above the input velocity [m/s]
+    double acceleration_tolerance;  // allowed acceleration outside of the normal limits [m/ss]
+    double jerk_tolerance;          // allowed jerk outside of the normal limits [m/sss]
+  };
+
+  explicit HybridSmoother(rclcpp::Node & node);
+
+  bool apply(
+    const double initial_vel, const double initial_acc, const TrajectoryPoints & input,
+    TrajectoryPoints & output, std::vector<TrajectoryPoints> & debug_trajectories) override;
+
+  void setHybridParam(const Param & param);
+  Param getHybridParam() const;
+
+  void setAnalyticalParam(const AnalyticalJerkConstrainedSmoother::Param & param);
+  AnalyticalJerkConstrainedSmoother::Param getAnalyticalParam() const;
+
+  // true if the QP was solved in the last apply()
+  bool isQPUsed() const { return is_qp_used_; }
+
+private:
+  Param hybrid_param_;
+  AnalyticalJerkConstrainedSmoother analytical_smoother_;
+  bool is_qp_used_{false};
+  rclcpp::Logger logger_{rclcpp::get_logger("smoother").get_child("hybrid_smoother")};
+};
+}  // namespace motion_velocity_smoother
+
+#endif  // MOTION_VELOCITY_SMOOTHER__SMOOTHER__HYBRID_SMOOTHER_HPP_
@@ -38,6 +38,7 @@ public:
     double over_a_weight;
     double over_j_weight;
     double jerk_filter_ds;
+    bool enable_persistent_qp_workspace;
   };
 
   explicit JerkFilteredSmoother(rclcpp::Node & node);
@@ -57,6 +58,10 @@ public:
 private:
   Param smoother_param_;
   autoware::common::osqp::OSQPInterface qp_solver_;
+  // number of points of the problem in the solver workspace, 0 if it cannot be reused
+  size_t qp_workspace_size_{0};
+  TrajectoryPoints prev_opt_trajectory_;
+  std::vector<double> prev_optval_;
   rclcpp::Logger logger_{rclcpp::get_logger("smoother").get_child("jerk_filtered_smoother")};
 
   TrajectoryPoints forwardJerkFilter(
@@ -68,6 +73,8 @@ private:
   TrajectoryPoints mergeFilteredTrajectory(
     const double v0, const double a0, const double a_min, const double j_min,
     const TrajectoryPoints & forward_filtered, const TrajectoryPoints & backward_filtered) const;
+  std::vector<double> calcWarmStartPrimalVariables(
+    const TrajectoryPoints & opt_trajectory, const size_t N) const;
 };
 }  // namespace motion_velocity_smoother
 
@@ -82,6 +82,23 @@ std::vector<double> calcVelocityProfileWithConstantJerkAndAccelerationLimit(
 
 double calcStopDistance(const TrajectoryPoints & trajectory, const size_t closest);
 
+struct ConstraintViolation
+{
+  double over_velocity{0.0};      // max velocity above the reference velocity [m/s]
+  double over_acceleration{0.0};  // max acceleration outside of the limits [m/ss]
+  double over_jerk{0.0};          // max jerk outside of the limits [m/sss]
+};
+
+/**
+ * @brief calculate how much the trajectory violates the velocity of the reference trajectory and
+ * the acceleration and jerk limits
+ * @details both trajectories should start from the same point, the reference velocity of a point
+ * is the one of the reference segment containing it
+ */
+ConstraintViolation calcConstraintViolation(
+  const TrajectoryPoints & reference, const TrajectoryPoints & trajectory, const double max_acc,
+  const double min_acc, const double max_jerk, const double min_jerk);
+
 }  // namespace trajectory_utils
 }  // namespace motion_velocity_smoother
 
@@ -28,6 +28,7 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 // clang-format on
@@ -46,11 +47,17 @@ MotionVelocitySmootherNode::MotionVelocitySmootherNode(const rclcpp::NodeOptions
 
   // create smoother
   setupSmoother(wheelbase_);
+  replan_checker_ = std::make_unique<ReplanChecker>(this);
 
   // publishers, subscribers
   pub_trajectory_ = create_publisher<Trajectory>("~/output/trajectory", 1);
+  latency_hop_publisher_ = std::make_unique<latency_aggregator::LatencyHopPublisher>(
+    this, pub_trajectory_->get_topic_name());
+  // NOTE: The intra-process communication supports only volatile topics.
+  rclcpp::PublisherOptions durable_pub_options;
+  durable_pub_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
   pub_velocity_limit_ = create_publisher<VelocityLimit>(
-    "~/output/current_velocity_limit_mps", rclcpp::QoS{1}.transient_local());
+    "~/output/current_velocity_limit_mps", rclcpp::QoS{1}.transient_local(), durable_pub_options);
   pub_dist_to_stopline_ = create_publisher<Float32Stamped>("~/distance_to_stopline", 1);
   pub_over_stop_velocity_ = create_publisher<StopSpeedExceeded>("~/stop_speed_exceeded", 1);
   sub_current_trajectory_ = create_subscription<Trajectory>(
@@ -106,8 +113,13 @@ MotionVelocitySmootherNode::MotionVelocitySmootherNode(const rclcpp::NodeOptions
 void MotionVelocitySmootherNode::setupSmoother(const double wheelbase)
 {
   switch (node_param_.algorithm_type) {
-    case AlgorithmType::JERK_FILTERED: {
-      smoother_ = std::make_shared<JerkFilteredSmoother>(*this);
+    case AlgorithmType::JERK_FILTERED:
+    case AlgorithmType::HYBRID: {
+      if (node_param_.algorithm_type == AlgorithmType::HYBRID) {
+        smoother_ = std::make_shared<HybridSmoother>(*this);
+      } else {
+        smoother_ = std::make_shared<JerkFilteredSmoother>(*this);
+      }
 
       // Set Publisher for jerk filtered algorithm
       pub_forward_filtered_trajectory_ =
@@ -187,6 +199,10 @@ rcl_interfaces::msg::SetParametersResult MotionVelocitySmootherNode::onParameter
     update_param_bool("plan_from_ego_speed_on_manual_mode", p.plan_from_ego_speed_on_manual_mode);
   }
 
+  // the previous output may not satisfy the updated parameters
+  replan_checker_->onParam(parameters);
+  replan_checker_->reset();
+
   {
     auto p = smoother_->getBaseParam();
     update_param("normal.max_acc", p.max_accel);
@@ -212,15 +228,37 @@ rcl_interfaces::msg::SetParametersResult MotionVelocitySmootherNode::onParameter
     smoother_->setParam(p);
   }
 
+  const auto update_jerk_filtered_param = [&](JerkFilteredSmoother & smoother) {
+    auto p = smoother.getParam();
+    update_param("jerk_weight", p.jerk_weight);
+    update_param("over_v_weight", p.over_v_weight);
+    update_param("over_a_weight", p.over_a_weight);
+    update_param("over_j_weight", p.over_j_weight);
+    update_param("jerk_filter_ds", p.jerk_filter_ds);
+    update_param_bool("enable_persistent_qp_workspace", p.enable_persistent_qp_workspace);
+    smoother.setParam(p);
+  };
+
+  const auto update_analytical_param = [&](AnalyticalJerkConstrainedSmoother::Param & p) {
+    update_param("resample.delta_yaw_threshold", p.resample.delta_yaw_threshold);
+    update_param(
+      "latacc.constant_velocity_dist_threshold", p.latacc.constant_velocity_dist_threshold);
+    update_param("forward.max_acc", p.forward.max_acc);
+    update_param("forward.min_acc", p.forward.min_acc);
+    update_param("forward.max_jerk", p.forward.max_jerk);
+    update_param("forward.min_jerk", p.forward.min_jerk);
+    update_param("forward.kp", p.forward.kp);
+    update_param("backward.start_jerk", p.backward.start_jerk);
+    update_param("backward.min_jerk_mild_stop", p.backward.min_jerk_mild_stop);
+    update_param("backward.min_jerk", p.backward.min_jerk);
+    update_param("backward.min_acc_mild_stop", p.backward.min_acc_mild_stop);
+    update_param("backward.min_acc", p.backward.min_acc);
+    update_param("backward.span_jerk", p.backward.span_jerk);
+  };
+
   switch (node_param_.algorithm_type) {
     case AlgorithmType::JERK_FILTERED: {
-      auto p = std::dynamic_pointer_cast<JerkFilteredSmoother>(smoother_)->getParam();
-      update_param("jerk_weight", p.jerk_weight);
-      update_param("over_v_weight", p.over_v_weight);
-      update_param("over_a_weight", p.over_a_weight);
-      update_param("over_j_weight", p.over_j_weight);
-      update_param("jerk_filter_ds", p.jerk_filter_ds);
-      std::dynamic_pointer_cast<JerkFilteredSmoother>(smoother_)->setParam(p);
+      update_jerk_filtered_param(*std::dynamic_pointer_cast<JerkFilteredSmoother>(smoother_));
       break;
     }
     case AlgorithmType::L2: {
@@ -241,23 +279,23 @@ rcl_interfaces::msg::SetParametersResult MotionVelocitySmootherNode::onParameter
     }
     case AlgorithmType::ANALYTICAL: {
       auto p = std::dynamic_pointer_cast<AnalyticalJerkConstrainedSmoother>(smoother_)->getParam();
-      update_param("resample.delta_yaw_threshold", p.resample.delta_yaw_threshold);
-      update_param(
-        "latacc.constant_velocity_dist_threshold", p.latacc.constant_velocity_dist_threshold);
-      update_param("forward.max_acc", p.forward.max_acc);
-      update_param("forward.min_acc", p.forward.min_acc);
-      update_param("forward.max_jerk", p.forward.max_jerk);
-      update_param("forward.min_jerk", p.forward.min_jerk);
-      update_param("forward.kp", p.forward.kp);
-      update_param("backward.start_jerk", p.backward.start_jerk);
-      update_param("backward.min_jerk_mild_stop", p.backward.min_jerk_mild_stop);
-      update_param("backward.min_jerk", p.backward.min_jerk);
-      update_param("backward.min_acc_mild_stop", p.backward.min_acc_mild_stop);
-      update_param("backward.min_acc", p.backward.min_acc);
-      update_param("backward.span_jerk", p.backward.span_jerk);
+      update_analytical_param(p);
       std::dynamic_pointer_cast<AnalyticalJerkConstrainedSmoother>(smoother_)->setParam(p);
       break;
     }
+    case AlgorithmType::HYBRID: {
+      const auto hybrid_smoother = std::dynamic_pointer_cast<HybridSmoother>(smoother_);
+      update_jerk_filtered_param(*hybrid_smoother);
+      auto analytical_param = hybrid_smoother->getAnalyticalParam();
+      update_analytical_param(analytical_param);
+      hybrid_smoother->setAnalyticalParam(analytical_param);
+      auto p = hybrid_smoother->getHybridParam();
+      update_param("hybrid.velocity_tolerance", p.velocity_tolerance);
+      update_param("hybrid.acceleration_tolerance", p.acceleration_tolerance);
+      update_param("hybrid.jerk_tolerance", p.jerk_tolerance);
+      hybrid_smoother->setHybridParam(p);
+      break;
+    }
     default:
       throw std::domain_error("[MotionVelocitySmootherNode] invalid algorithm");
   }
@@ -308,9 +346,11 @@ void MotionVelocitySmootherNode::initCommonParam()
 
 void MotionVelocitySmootherNode::publishTrajectory(const TrajectoryPoints & trajectory) const
 {
-  Trajectory publishing_trajectory = motion_utils::convertToTrajectory(trajectory);
-  publishing_trajectory.header = base_traj_raw_ptr_->header;
-  pub_trajectory_->publish(publishing_trajectory);
+  // NOTE: UniquePtr is moved to the subscriber without copy with the intra-process communication.
+  auto publishing_trajectory =
+    std::make_unique<Trajectory>(motion_utils::convertToTrajectory(trajectory));
+  publishing_trajectory->header = base_traj_raw_ptr_->header;
+  pub_trajectory_->publish(std::move(publishing_trajectory));
 }
 
 void MotionVelocitySmootherNode::onCurrentOdometry(const Odometry::ConstSharedPtr msg)
@@ -429,6 +469,8 @@ void MotionVelocitySmootherNode::onCurrentTrajectory(const Trajectory::ConstShar
 {
   RCLCPP_DEBUG(get_logger(), "========================= run start =========================");
   stop_watch_.tic();
+  const auto hop_input = latency_hop_publisher_->createInput(
+    sub_current_trajectory_->get_topic_name(), msg->header.stamp);
 
   base_traj_raw_ptr_ = msg;
 
@@ -453,6 +495,7 @@ void MotionVelocitySmootherNode::onCurrentTrajectory(const Trajectory::ConstShar
   }
 
   // calculate distance to insert external velocity limit
+  const bool has_new_external_velocity_limit = external_velocity_limit_ptr_ != nullptr;
   calcExternalVelocityLimit();
   updateDataForExternalVelocityLimit();
 
@@ -466,7 +509,23 @@ void MotionVelocitySmootherNode::onCurrentTrajectory(const Trajectory::ConstShar
     flipVelocity(input_points);
   }
 
-  const auto output = calcTrajectoryVelocity(input_points);
+  // The previous output is reused while the input trajectory and the velocity limit are unchanged
+  // and the velocity is planned from the previous output. The post resampling below shifts it to
+  // the current ego pose.
+  const auto & ego_pose = current_odometry_ptr_->pose.pose;
+  const bool is_replan_required =
+    has_new_external_velocity_limit || prev_output_.empty() ||
+    calcInitialMotion(input_points, findNearestIndexFromEgo(input_points)).second !=
+      InitializeType::NORMAL ||
+    replan_checker_->isReplanRequired(
+      input_points, ego_pose, now(), node_param_.ego_nearest_dist_threshold,
+      node_param_.ego_nearest_yaw_threshold);
+  if (is_replan_required) {
+    replan_checker_->updateData(input_points, ego_pose, now());
+  } else {
+    RCLCPP_DEBUG(get_logger(), "input trajectory is unchanged. reuse the previous output.");
+  }
+  const auto output = is_replan_required ? calcTrajectoryVelocity(input_points) : prev_output_;
   if (output.empty()) {
     RCLCPP_WARN(get_logger(), "Output Point is empty");
     return;
@@ -494,6 +553,7 @@ void MotionVelocitySmootherNode::onCurrentTrajectory(const Trajectory::ConstShar
 
   // publish message
   publishTrajectory(output_resampled);
+  latency_hop_publisher_->publish(hop_input, base_traj_raw_ptr_->header.stamp);
 
   // publish debug message
   publishStopDistance(output);
@@ -916,7 +976,10 @@ void MotionVelocitySmootherNode::publishDebugTrajectories(
   const std::vector<TrajectoryPoints> & debug_trajectories) const
 {
   auto debug_trajectories_tmp = debug_trajectories;
-  if (node_param_.algorithm_type == AlgorithmType::JERK_FILTERED) {
+  if (
+    node_param_.algorithm_type == AlgorithmType::JERK_FILTERED ||
+    node_param_.algorithm_type == AlgorithmType::HYBRID) {
+    // the hybrid smoother has debug trajectories only when the QP is solved
     if (debug_trajectories_tmp.size() != 3) {
       RCLCPP_DEBUG(get_logger(), "Size of the debug trajectories is incorrect");
       return;
@@ -1002,6 +1065,9 @@ MotionVelocitySmootherNode::AlgorithmType MotionVelocitySmootherNode::getAlgorit
   if (algorithm_name == "Analytical") {
     return AlgorithmType::ANALYTICAL;
   }
+  if (algorithm_name == "Hybrid") {
+    return AlgorithmType::HYBRID;
+  }
 
   throw std::domain_error("[MotionVelocitySmootherNode] undesired algorithm is selected.");
   return AlgorithmType::INVALID;
@@ -0,0 +1,164 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "motion_velocity_smoother/replan_checker.hpp"
+
+#include "motion_utils/trajectory/trajectory.hpp"
+#include "tier4_autoware_utils/geometry/geometry.hpp"
+#include "tier4_autoware_utils/ros/update_param.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace motion_velocity_smoother
+{
+ReplanChecker::ReplanChecker(rclcpp::Node * node)
+: logger_(node->get_logger().get_child("replan_checker"))
+{
+  enable_ = node->declare_parameter<bool>("replan.enable", false);
+  max_path_shape_lat_dist_ = node->declare_parameter<double>("replan.max_path_shape_lat_dist", 0.1);
+  max_velocity_diff_ = node->declare_parameter<double>("replan.max_velocity_diff", 0.1);
+  max_ego_moving_dist_ = node->declare_parameter<double>("replan.max_ego_moving_dist", 10.0);
+  max_delta_time_sec_ = node->declare_parameter<double>("replan.max_delta_time_sec", 1.0);
+}
+
+void ReplanChecker::onParam(const std::vector<rclcpp::Parameter> & parameters)
+{
+  using tier4_autoware_utils::updateParam;
+
+  updateParam<bool>(parameters, "replan.enable", enable_);
+  updateParam<double>(parameters, "replan.max_path_shape_lat_dist", max_path_shape_lat_dist_);
+  updateParam<double>(parameters, "replan.max_velocity_diff", max_velocity_diff_);
+  updateParam<double>(parameters, "replan.max_ego_moving_dist", max_ego_moving_dist_);
+  updateParam<double>(parameters, "replan.max_delta_time_sec", max_delta_time_sec_);
+}
+
+bool ReplanChecker::isReplanRequired(
+  const std::vector<TrajectoryPoint> & traj_points, const Pose & ego_pose,
+  const rclcpp::Time & current_time, const double ego_nearest_dist_threshold,
+  const double ego_nearest_yaw_threshold) const
+{
+  if (!enable_) return true;
+
+  // guard for invalid variables
+  if (!prev_traj_points_ptr_ || !prev_ego_pose_ptr_ || !prev_replanned_time_ptr_) return true;
+  const auto & prev_traj_points = *prev_traj_points_ptr_;
+
+  // time elapses
+  const double delta_time_sec = (current_time - *prev_replanned_time_ptr_).seconds();
+  if (max_delta_time_sec_ < delta_time_sec) return true;
+
+  // ego moves, the previous output becomes short ahead of ego
+  const double delta_dist = tier4_autoware_utils::calcDistance2d(ego_pose, *prev_ego_pose_ptr_);
+  if (max_ego_moving_dist_ < delta_dist) return true;
+
+  // trajectory shape or velocity changes, checked from both trajectories to find the stop points
+  // and the extended part of either trajectory
+  if (
+    isTrajectoryChanged(
+      prev_traj_points, traj_points, ego_pose, ego_nearest_dist_threshold,
+      ego_nearest_yaw_threshold) ||
+    isTrajectoryChanged(
+      traj_points, prev_traj_points, ego_pose, ego_nearest_dist_threshold,
+      ego_nearest_yaw_threshold)) {
+    RCLCPP_DEBUG(logger_, "Replan since trajectory shape or velocity changed.");
+    return true;
+  }
+
+  return false;
+}
+
+void ReplanChecker::updateData(
+  const std::vector<TrajectoryPoint> & traj_points, const Pose & ego_pose,
+  const rclcpp::Time & current_time)
+{
+  prev_traj_points_ptr_ = std::make_shared<std::vector<TrajectoryPoint>>(traj_points);
+  prev_ego_pose_ptr_ = std::make_shared<Pose>(ego_pose);
+  prev_replanned_time_ptr_ = std::make_shared<rclcpp::Time>(current_time);
+}
+
+void ReplanChecker::reset()
+{
+  prev_traj_points_ptr_ = nullptr;
+  prev_ego_pose_ptr_ = nullptr;
+  prev_replanned_time_ptr_ = nullptr;
+}
+
+bool ReplanChecker::isTrajectoryChanged(
+  const std::vector<TrajectoryPoint> & base_points,
+  const std::vector<TrajectoryPoint> & target_points, const Pose & ego_pose,
+  const double ego_nearest_dist_threshold, const double ego_nearest_yaw_threshold) const
+{
+  if (base_points.size() < 2 || target_points.size() < 2) {
+    return true;
+  }
+
+  // The points of the target trajectory ahead of ego are projected to the base trajectory in
+  // order, so that the segment of the base trajectory is searched only forward.
+  const size_t target_ego_idx = motion_utils::findFirstNearestIndexWithSoftConstraints(
+    target_points, ego_pose, ego_nearest_dist_threshold, ego_nearest_yaw_threshold);
+  size_t base_seg_idx = motion_utils::findFirstNearestSegmentIndexWithSoftConstraints(
+    base_points, ego_pose, ego_nearest_dist_threshold, ego_nearest_yaw_threshold);
+
+  for (size_t i = target_ego_idx; i < target_points.size(); ++i) {
+    const auto & target_point = target_points.at(i);
+    const auto & p = target_point.pose.position;
+
+    // NOTE: motion_utils::calcLateralOffset() copies the trajectory to remove the overlapped
+    // points, which is done for the input trajectory in advance.
+    double seg_length{};
+    double lon_offset{};
+    double lat_offset{};
+    while (true) {
+      const auto & p_front = base_points.at(base_seg_idx).pose.position;
+      const auto & p_back = base_points.at(base_seg_idx + 1).pose.position;
+      const double seg_x = p_back.x - p_front.x;
+      const double seg_y = p_back.y - p_front.y;
+      seg_length = std::hypot(seg_x, seg_y);
+      if (seg_length < 1e-6) {
+        lon_offset = 0.0;
+        lat_offset = std::hypot(p.x - p_front.x, p.y - p_front.y);
+      } else {
+        lon_offset = (seg_x * (p.x - p_front.x) + seg_y * (p.y - p_front.y)) / seg_length;
+        lat_offset = (seg_x * (p.y - p_front.y) - seg_y * (p.x - p_front.x)) / seg_length;
+      }
+      if (lon_offset < seg_length || base_points.size() <= base_seg_idx + 2) {
+        break;
+      }
+      ++base_seg_idx;
+    }
+
+    // the target trajectory is extended beyond the end of the base trajectory
+    if (seg_length + max_path_shape_lat_dist_ < lon_offset) {
+      return true;
+    }
+
+    if (max_path_shape_lat_dist_ < std::abs(lat_offset)) {
+      return true;
+    }
+
+    const double ratio = seg_length < 1e-6 ? 0.0 : std::clamp(lon_offset / seg_length, 0.0, 1.0);
+    const double base_velocity =
+      base_points.at(base_seg_idx).longitudinal_velocity_mps * (1.0 - ratio) +
+      base_points.at(base_seg_idx + 1).longitudinal_velocity_mps * ratio;
+    if (max_velocity_diff_ < std::abs(base_velocity - target_point.longitudinal_velocity_mps)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+}  // namespace motion_velocity_smoother
@@ -0,0 +1,81 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "motion_velocity_smoother/smoother/hybrid_smoother.hpp"
+
+#include "motion_velocity_smoother/trajectory_utils.hpp"
+
+#include <vector>
+
+namespace motion_velocity_smoother
+{
+HybridSmoother::HybridSmoother(rclcpp::Node & node)
+: JerkFilteredSmoother(node), analytical_smoother_(node)
+{
+  auto & p = hybrid_param_;
+  p.velocity_tolerance = node.declare_parameter<double>("hybrid.velocity_tolerance");
+  p.acceleration_tolerance = node.declare_parameter<double>("hybrid.acceleration_tolerance");
+  p.jerk_tolerance = node.declare_parameter<double>("hybrid.jerk_tolerance");
+}
+
+void HybridSmoother::setHybridParam(const Param & param)
+{
+  hybrid_param_ = param;
+}
+
+HybridSmoother::Param HybridSmoother::getHybridParam() const
+{
+  return hybrid_param_;
+}
+
+void HybridSmoother::setAnalyticalParam(const AnalyticalJerkConstrainedSmoother::Param & param)
+{
+  analytical_smoother_.setParam(param);
+}
+
+AnalyticalJerkConstrainedSmoother::Param HybridSmoother::getAnalyticalParam() const
+{
+  return analytical_smoother_.getParam();
+}
+
+bool HybridSmoother::apply(
+  const double initial_vel, const double initial_acc, const TrajectoryPoints & input,
+  TrajectoryPoints & output, std::vector<TrajectoryPoints> & debug_trajectories)
+{
+  // the base parameters are only updated on this smoother
+  static_cast<SmootherBase &>(analytical_smoother_).setParam(getBaseParam());
+
+  std::vector<TrajectoryPoints> analytical_debug_trajectories;
+  if (analytical_smoother_.apply(
+        initial_vel, initial_acc, input, output, analytical_debug_trajectories)) {
+    const auto violation = trajectory_utils::calcConstraintViolation(
+      input, output, getMaxAccel(), getMinDecel(), getMaxJerk(), getMinJerk());
+    if (
+      violation.over_velocity <= hybrid_param_.velocity_tolerance &&
+      violation.over_acceleration <= hybrid_param_.acceleration_tolerance &&
+      violation.over_jerk <= hybrid_param_.jerk_tolerance) {
+      is_qp_used_ = false;
+      return true;
+    }
+    RCLCPP_DEBUG(
+      logger_,
+      "The analytical result violates the constraints (over velocity: %f, over acceleration: %f, "
+      "over jerk: %f), so solve the QP.",
+      violation.over_velocity, violation.over_acceleration, violation.over_jerk);
+  }
+
+  is_qp_used_ = true;
+  return JerkFilteredSmoother::apply(initial_vel, initial_acc, input, output, debug_trajectories);
+}
+}  // namespace motion_velocity_smoother
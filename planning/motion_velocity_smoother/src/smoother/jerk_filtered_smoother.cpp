@@ -17,6 +17,7 @@
 #include "motion_velocity_smoother/trajectory_utils.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <algorithm>
 #include <chrono>
@@ -37,6 +38,7 @@ JerkFilteredSmoother::JerkFilteredSmoother(rclcpp::Node & node) : SmootherBase(n
   p.over_a_weight = node.declare_parameter<double>("over_a_weight");
   p.over_j_weight = node.declare_parameter<double>("over_j_weight");
   p.jerk_filter_ds = node.declare_parameter<double>("jerk_filter_ds");
+  p.enable_persistent_qp_workspace = node.declare_parameter<bool>("enable_persistent_qp_workspace");
 
   qp_solver_.updateMaxIter(20000);
   qp_solver_.updateRhoInterval(0);  // 0 means automatic
@@ -55,6 +57,22 @@ JerkFilteredSmoother::Param JerkFilteredSmoother::getParam() const
   return smoother_param_;
 }
 
+std::vector<double> JerkFilteredSmoother::calcWarmStartPrimalVariables(
+  const TrajectoryPoints & opt_trajectory, const size_t N) const
+{
+  // shift the previous solution by the number of points ego passed since the previous cycle
+  const size_t shift = motion_utils::findNearestIndex(
+    prev_opt_trajectory_, opt_trajectory.front().pose.position);
+  std::vector<double> primal_variables(prev_optval_.size());
+  for (size_t block_idx = 0; block_idx < primal_variables.size() / N; ++block_idx) {
+    for (size_t i = 0; i < N; ++i) {
+      primal_variables.at(block_idx * N + i) =
+        prev_optval_.at(block_idx * N + std::min(i + shift, N - 1));
+    }
+  }
+  return primal_variables;
+}
+
 bool JerkFilteredSmoother::apply(
   const double v0, const double a0, const TrajectoryPoints & input, TrajectoryPoints & output,
   std::vector<TrajectoryPoints> & debug_trajectories)
@@ -175,13 +193,16 @@ bool JerkFilteredSmoother::apply(
   const uint32_t l_variables = 5 * N;
   const uint32_t l_constraints = 4 * N + 1;
 
-  // the matrix size depends on constraint numbers.
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(l_constraints, l_variables);
+  // the matrices are banded, so they are built from triplets instead of dense matrices.
+  // only the upper triangular part of P is given to OSQP.
+  std::vector<Eigen::Triplet<double>> A;
+  A.reserve(11 * N);
 
   std::vector<double> lower_bound(l_constraints, 0.0);
   std::vector<double> upper_bound(l_constraints, 0.0);
 
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(l_variables, l_variables);
+  std::vector<Eigen::Triplet<double>> P;
+  P.reserve(6 * N);
   std::vector<double> q(l_variables, 0.0);
 
   /**************************************************************/
@@ -196,10 +217,10 @@ bool JerkFilteredSmoother::apply(
     const double ref_vel = 0.5 * (v_max_arr.at(i) + v_max_arr.at(i + 1));
     const double interval_dist = std::max(interval_dist_arr.at(i), 0.0001);
     const double w_x_ds_inv = (1.0 / interval_dist) * ref_vel;
-    P(IDX_A0 + i, IDX_A0 + i) += smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
-    P(IDX_A0 + i, IDX_A0 + i + 1) -= smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
-    P(IDX_A0 + i + 1, IDX_A0 + i) -= smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
-    P(IDX_A0 + i + 1, IDX_A0 + i + 1) += smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
+    const double w = smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
+    P.emplace_back(IDX_A0 + i, IDX_A0 + i, w);
+    P.emplace_back(IDX_A0 + i, IDX_A0 + i + 1, -w);
+    P.emplace_back(IDX_A0 + i + 1, IDX_A0 + i + 1, w);
   }
 
   // |v_max_i^2 - b_i|/v_max^2 -> minimize (-bi) * ds / v_max^2
@@ -212,9 +233,9 @@ bool JerkFilteredSmoother::apply(
       }
       q.at(IDX_B0 + i) += v_weight_term;
     }
-    P(IDX_DELTA0 + i, IDX_DELTA0 + i) += over_v_weight;  // over velocity cost
-    P(IDX_SIGMA0 + i, IDX_SIGMA0 + i) += over_a_weight;  // over acceleration cost
-    P(IDX_GAMMA0 + i, IDX_GAMMA0 + i) += over_j_weight;  // over jerk cost
+    P.emplace_back(IDX_DELTA0 + i, IDX_DELTA0 + i, over_v_weight);  // over velocity cost
+    P.emplace_back(IDX_SIGMA0 + i, IDX_SIGMA0 + i, over_a_weight);  // over acceleration cost
+    P.emplace_back(IDX_GAMMA0 + i, IDX_GAMMA0 + i, over_j_weight);  // over jerk cost
   }
 
   /**************************************************************/
@@ -235,16 +256,16 @@ bool JerkFilteredSmoother::apply(
 
   // Soft Constraint Velocity Limit: 0 < b - delta < v_max^2
   for (size_t i = 0; i < N; ++i, ++constr_idx) {
-    A(constr_idx, IDX_B0 + i) = 1.0;       // b_i
-    A(constr_idx, IDX_DELTA0 + i) = -1.0;  // -delta_i
+    A.emplace_back(constr_idx, IDX_B0 + i, 1.0);       // b_i
+    A.emplace_back(constr_idx, IDX_DELTA0 + i, -1.0);  // -delta_i
     upper_bound[constr_idx] = v_max_arr.at(i) * v_max_arr.at(i);
     lower_bound[constr_idx] = 0.0;
   }
 
   // Soft Constraint Acceleration Limit: a_min < a - sigma < a_max
   for (size_t i = 0; i < N; ++i, ++constr_idx) {
-    A(constr_idx, IDX_A0 + i) = 1.0;       // a_i
-    A(constr_idx, IDX_SIGMA0 + i) = -1.0;  // -sigma_i
+    A.emplace_back(constr_idx, IDX_A0 + i, 1.0);       // a_i
+    A.emplace_back(constr_idx, IDX_SIGMA0 + i, -1.0);  // -sigma_i
 
     constexpr double stop_vel = 1e-3;
     if (v_max_arr.at(i) < stop_vel) {
@@ -262,39 +283,52 @@ bool JerkFilteredSmoother::apply(
   for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
     const double ref_vel = 0.5 * (v_max_arr.at(i) + v_max_arr.at(i + 1));
     const double ds = interval_dist_arr.at(i);
-    A(constr_idx, IDX_A0 + i) = -ref_vel;     // -a[i] * ref_vel
-    A(constr_idx, IDX_A0 + i + 1) = ref_vel;  //  a[i+1] * ref_vel
-    A(constr_idx, IDX_GAMMA0 + i) = -ds;      // -gamma[i] * ds
+    A.emplace_back(constr_idx, IDX_A0 + i, -ref_vel);     // -a[i] * ref_vel
+    A.emplace_back(constr_idx, IDX_A0 + i + 1, ref_vel);  //  a[i+1] * ref_vel
+    A.emplace_back(constr_idx, IDX_GAMMA0 + i, -ds);      // -gamma[i] * ds
     upper_bound[constr_idx] = j_max * ds;     //  jerk_max * ds
     lower_bound[constr_idx] = j_min * ds;     //  jerk_min * ds
   }
 
   // b' = 2a ... (b(i+1) - b(i)) / ds = 2a(i)
   for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
-    A(constr_idx, IDX_B0 + i) = -1.0;                            // b(i)
-    A(constr_idx, IDX_B0 + i + 1) = 1.0;                         // b(i+1)
-    A(constr_idx, IDX_A0 + i) = -2.0 * interval_dist_arr.at(i);  // a(i) * ds
+    A.emplace_back(constr_idx, IDX_B0 + i, -1.0);                            // b(i)
+    A.emplace_back(constr_idx, IDX_B0 + i + 1, 1.0);                         // b(i+1)
+    A.emplace_back(constr_idx, IDX_A0 + i, -2.0 * interval_dist_arr.at(i));  // a(i) * ds
     upper_bound[constr_idx] = 0.0;
     lower_bound[constr_idx] = 0.0;
   }
 
   // initial condition
   {
-    A(constr_idx, IDX_B0) = 1.0;  // b0
+    A.emplace_back(constr_idx, IDX_B0, 1.0);  // b0
     upper_bound[constr_idx] = v0 * v0;
     lower_bound[constr_idx] = v0 * v0;
     ++constr_idx;
 
-    A(constr_idx, IDX_A0) = 1.0;  // a0
+    A.emplace_back(constr_idx, IDX_A0, 1.0);  // a0
     upper_bound[constr_idx] = a0;
     lower_bound[constr_idx] = a0;
     ++constr_idx;
   }
 
   // execute optimization
-  const auto result = qp_solver_.optimize(P, A, q, lower_bound, upper_bound);
+  const auto P_csc = autoware::common::osqp::calCSCMatrix(l_variables, l_variables, P);
+  const auto A_csc = autoware::common::osqp::calCSCMatrix(l_constraints, l_variables, A);
+  if (
+    smoother_param_.enable_persistent_qp_workspace && qp_workspace_size_ == N &&
+    qp_solver_.updateCscP(P_csc) && qp_solver_.updateCscA(A_csc)) {
+    // same sparsity pattern as the previous problem, only the values are updated
+    qp_solver_.updateQ(q);
+    qp_solver_.updateBounds(lower_bound, upper_bound);
+    qp_solver_.setPrimalVariables(calcWarmStartPrimalVariables(opt_resampled_trajectory, N));
+  } else {
+    qp_solver_.initializeProblem(P_csc, A_csc, q, lower_bound, upper_bound);
+  }
+  const auto result = qp_solver_.optimize();
   const std::vector<double> optval = std::get<0>(result);
   const int status_val = std::get<3>(result);
+  qp_workspace_size_ = 0;
   if (status_val != 1) {
     RCLCPP_WARN(logger_, "optimization failed : %s", qp_solver_.getStatusMessage().c_str());
     return false;
@@ -305,6 +339,12 @@ bool JerkFilteredSmoother::apply(
     RCLCPP_WARN(logger_, "optimization failed: result contains NaN values");
     return false;
   }
+  if (smoother_param_.enable_persistent_qp_workspace) {
+    qp_workspace_size_ = N;
+    prev_optval_ = optval;
+    prev_opt_trajectory_.assign(
+      opt_resampled_trajectory.begin(), opt_resampled_trajectory.begin() + N);
+  }
 
   const auto tf1 = std::chrono::system_clock::now();
   const double dt_ms1 =
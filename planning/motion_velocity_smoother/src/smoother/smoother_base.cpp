@@ -21,6 +21,7 @@
 #include "motion_velocity_smoother/trajectory_utils.hpp"
 #include "tier4_autoware_utils/geometry/geometry.hpp"
 #include "tier4_autoware_utils/math/unit_conversion.hpp"
+#include "tier4_autoware_utils/ros/parameter.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -31,32 +32,37 @@ namespace motion_velocity_smoother
 
 SmootherBase::SmootherBase(rclcpp::Node & node)
 {
+  // the parameters are shared when several smoothers are combined
+  using tier4_autoware_utils::getOrDeclareParameter;
   auto & p = base_param_;
-  p.max_accel = node.declare_parameter<double>("normal.max_acc");
-  p.min_decel = node.declare_parameter<double>("normal.min_acc");
-  p.stop_decel = node.declare_parameter<double>("stop_decel");
-  p.max_jerk = node.declare_parameter<double>("normal.max_jerk");
-  p.min_jerk = node.declare_parameter<double>("normal.min_jerk");
-  p.max_lateral_accel = node.declare_parameter<double>("max_lateral_accel");
+  p.max_accel = getOrDeclareParameter<double>(node, "normal.max_acc");
+  p.min_decel = getOrDeclareParameter<double>(node, "normal.min_acc");
+  p.stop_decel = getOrDeclareParameter<double>(node, "stop_decel");
+  p.max_jerk = getOrDeclareParameter<double>(node, "normal.max_jerk");
+  p.min_jerk = getOrDeclareParameter<double>(node, "normal.min_jerk");
+  p.max_lateral_accel = getOrDeclareParameter<double>(node, "max_lateral_accel");
   p.min_decel_for_lateral_acc_lim_filter =
-    node.declare_parameter<double>("min_decel_for_lateral_acc_lim_filter");
-  p.sample_ds = node.declare_parameter<double>("resample_ds");
-  p.curvature_threshold = node.declare_parameter<double>("curvature_threshold");
-  p.max_steering_angle_rate = node.declare_parameter<double>("max_steering_angle_rate");
+    getOrDeclareParameter<double>(node, "min_decel_for_lateral_acc_lim_filter");
+  p.sample_ds = getOrDeclareParameter<double>(node, "resample_ds");
+  p.curvature_threshold = getOrDeclareParameter<double>(node, "curvature_threshold");
+  p.max_steering_angle_rate = getOrDeclareParameter<double>(node, "max_steering_angle_rate");
   p.curvature_calculation_distance =
-    node.declare_parameter<double>("curvature_calculation_distance");
-  p.decel_distance_before_curve = node.declare_parameter<double>("decel_distance_before_curve");
-  p.decel_distance_after_curve = node.declare_parameter<double>("decel_distance_after_curve");
-  p.min_curve_velocity = node.declare_parameter<double>("min_curve_velocity");
-  p.resample_param.max_trajectory_length = node.declare_parameter<double>("max_trajectory_length");
-  p.resample_param.min_trajectory_length = node.declare_parameter<double>("min_trajectory_length");
-  p.resample_param.resample_time = node.declare_parameter<double>("resample_time");
-  p.resample_param.dense_resample_dt = node.declare_parameter<double>("dense_resample_dt");
+    getOrDeclareParameter<double>(node, "curvature_calculation_distance");
+  p.decel_distance_before_curve =
+    getOrDeclareParameter<double>(node, "decel_distance_before_curve");
+  p.decel_distance_after_curve = getOrDeclareParameter<double>(node, "decel_distance_after_curve");
+  p.min_curve_velocity = getOrDeclareParameter<double>(node, "min_curve_velocity");
+  p.resample_param.max_trajectory_length =
+    getOrDeclareParameter<double>(node, "max_trajectory_length");
+  p.resample_param.min_trajectory_length =
+    getOrDeclareParameter<double>(node, "min_trajectory_length");
+  p.resample_param.resample_time = getOrDeclareParameter<double>(node, "resample_time");
+  p.resample_param.dense_resample_dt = getOrDeclareParameter<double>(node, "dense_resample_dt");
   p.resample_param.dense_min_interval_distance =
-    node.declare_parameter<double>("dense_min_interval_distance");
-  p.resample_param.sparse_resample_dt = node.declare_parameter<double>("sparse_resample_dt");
+    getOrDeclareParameter<double>(node, "dense_min_interval_distance");
+  p.resample_param.sparse_resample_dt = getOrDeclareParameter<double>(node, "sparse_resample_dt");
   p.resample_param.sparse_min_interval_distance =
-    node.declare_parameter<double>("sparse_min_interval_distance");
+    getOrDeclareParameter<double>(node, "sparse_min_interval_distance");
 }
 
 void SmootherBase::setWheelBase(const double wheel_base)
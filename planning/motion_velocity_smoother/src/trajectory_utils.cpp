@@ -20,6 +20,7 @@
 #include "tier4_autoware_utils/geometry/geometry.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <tuple>
@@ -611,5 +612,49 @@ double calcStopDistance(const TrajectoryPoints & trajectory, const size_t closes
   return stop_dist;
 }
 
+ConstraintViolation calcConstraintViolation(
+  const TrajectoryPoints & reference, const TrajectoryPoints & trajectory, const double max_acc,
+  const double min_acc, const double max_jerk, const double min_jerk)
+{
+  ConstraintViolation violation;
+  if (reference.empty() || trajectory.empty()) {
+    return violation;
+  }
+
+  // below this velocity, the time between points is too long for a meaningful jerk
+  constexpr double min_velocity_for_jerk = 1e-3;
+  constexpr double epsilon = 1e-6;
+
+  const auto reference_arclength = calcArclengthArray(reference);
+  size_t reference_idx = 0;
+  double arclength = 0.0;
+  for (size_t i = 0; i < trajectory.size(); ++i) {
+    const auto & p = trajectory.at(i);
+    if (i > 0) {
+      const auto & prev_p = trajectory.at(i - 1);
+      const double ds = tier4_autoware_utils::calcDistance2d(p, prev_p);
+      arclength += ds;
+
+      const double v_mean = 0.5 * (std::fabs(p.longitudinal_velocity_mps) +
+                                   std::fabs(prev_p.longitudinal_velocity_mps));
+      if (ds > epsilon && v_mean > min_velocity_for_jerk) {
+        const double jerk = (p.acceleration_mps2 - prev_p.acceleration_mps2) * v_mean / ds;
+        violation.over_jerk = std::max({violation.over_jerk, jerk - max_jerk, min_jerk - jerk});
+      }
+    }
+
+    while (reference_idx + 1 < reference.size() &&
+           reference_arclength.at(reference_idx + 1) <= arclength + epsilon) {
+      ++reference_idx;
+    }
+    violation.over_velocity = std::max(
+      violation.over_velocity,
+      p.longitudinal_velocity_mps - reference.at(reference_idx).longitudinal_velocity_mps);
+    violation.over_acceleration = std::max(
+      {violation.over_acceleration, p.acceleration_mps2 - max_acc, min_acc - p.acceleration_mps2});
+  }
+  return violation;
+}
+
 }  // namespace trajectory_utils
 }  // namespace motion_velocity_smoother
@@ -61,3 +61,55 @@ TEST(TestTrajectoryUtils, CalcTrajectoryCurvatureFrom3Points)
     }
   }
 }
+
+TEST(TestTrajectoryUtils, CalcConstraintViolation)
+{
+  using motion_velocity_smoother::trajectory_utils::calcConstraintViolation;
+
+  auto reference = genStraightTrajectory(10);
+  for (auto & p : reference) {
+    p.longitudinal_velocity_mps = 10.0;
+  }
+
+  // no violation within the limits
+  {
+    auto trajectory = reference;
+    for (size_t i = 0; i < trajectory.size(); ++i) {
+      trajectory.at(i).longitudinal_velocity_mps = 5.0;
+      trajectory.at(i).acceleration_mps2 = 0.1 * static_cast<double>(i);
+    }
+    const auto violation = calcConstraintViolation(reference, trajectory, 1.0, -1.0, 1.0, -1.0);
+    EXPECT_DOUBLE_EQ(violation.over_velocity, 0.0);
+    EXPECT_DOUBLE_EQ(violation.over_acceleration, 0.0);
+    EXPECT_DOUBLE_EQ(violation.over_jerk, 0.0);
+  }
+
+  // velocity above the reference, deceleration and jerk below the limits
+  {
+    auto trajectory = reference;
+    for (auto & p : trajectory) {
+      p.longitudinal_velocity_mps = 5.0;
+    }
+    trajectory.at(3).longitudinal_velocity_mps = 10.5;
+    trajectory.at(6).acceleration_mps2 = -1.3;
+    const auto violation = calcConstraintViolation(reference, trajectory, 1.0, -1.0, 5.0, -5.0);
+    EXPECT_NEAR(violation.over_velocity, 0.5, 1e-6);
+    EXPECT_NEAR(violation.over_acceleration, 0.3, 1e-6);
+    // -1.3 [m/ss] in 1 [m] at 5 [m/s]
+    EXPECT_NEAR(violation.over_jerk, 1.5, 1e-6);
+  }
+
+  // the reference velocity is taken from the segment containing the point
+  {
+    auto trajectory = genStraightTrajectory(19);
+    for (size_t i = 0; i < trajectory.size(); ++i) {
+      trajectory.at(i).pose.position.x = 0.5 * static_cast<double>(i);
+      trajectory.at(i).longitudinal_velocity_mps = 10.0;
+    }
+    reference.at(5).longitudinal_velocity_mps = 8.0;
+    const auto violation = calcConstraintViolation(reference, trajectory, 1.0, -1.0, 1.0, -1.0);
+    EXPECT_NEAR(violation.over_velocity, 2.0, 1e-6);
+  }
+
+  EXPECT_DOUBLE_EQ(calcConstraintViolation({}, reference, 1.0, -1.0, 1.0, -1.0).over_velocity, 0.0);
+}
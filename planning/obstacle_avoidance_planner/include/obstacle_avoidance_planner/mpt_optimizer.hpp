@@ -130,13 +130,13 @@ private:
 
   struct ObjectiveMatrix
   {
-    Eigen::MatrixXd hessian;
+    Eigen::SparseMatrix<double> hessian;
     Eigen::VectorXd gradient;
   };
 
   struct ConstraintMatrix
   {
-    Eigen::MatrixXd linear;
+    Eigen::SparseMatrix<double> linear;
     Eigen::VectorXd lower_bound;
     Eigen::VectorXd upper_bound;
   };
@@ -150,6 +150,7 @@ private:
     // option
     bool enable_warm_start;
     bool enable_manual_warm_start;
+    bool enable_fixed_horizon_warm_start;
     bool enable_optimization_validation;
     bool steer_limit_constraint;
     int mpt_visualize_sampling_num;  // for debug
@@ -230,6 +231,8 @@ private:
   std::unique_ptr<autoware::common::osqp::OSQPInterface> osqp_solver_ptr_;
 
   const double osqp_epsilon_ = 1.0e-3;
+  // the front point and the previous one can be fixed
+  const size_t max_num_fixed_points_ = 2;
 
   // vehicle circles
   std::vector<double> vehicle_circle_longitudinal_offsets_;  // from base_link
@@ -288,6 +291,9 @@ private:
   Eigen::VectorXd calcInitialSolutionForManualWarmStart(
     const std::vector<ReferencePoint> & ref_points,
     const std::vector<ReferencePoint> & prev_ref_points) const;
+  std::vector<double> calcShiftedPrevSolution(
+    const std::vector<ReferencePoint> & ref_points,
+    const std::vector<ReferencePoint> & prev_ref_points) const;
   std::pair<ObjectiveMatrix, ConstraintMatrix> updateMatrixForManualWarmStart(
     const ObjectiveMatrix & obj_mat, const ConstraintMatrix & const_mat,
     const std::optional<Eigen::VectorXd> & u0) const;
@@ -18,6 +18,7 @@
 #include "motion_utils/trajectory/trajectory.hpp"
 #include "obstacle_avoidance_planner/common_structs.hpp"
 #include "obstacle_avoidance_planner/mpt_optimizer.hpp"
+#include "obstacle_avoidance_planner/optimized_centerline_checker.hpp"
 #include "obstacle_avoidance_planner/replan_checker.hpp"
 #include "obstacle_avoidance_planner/type_alias.hpp"
 #include "rclcpp/rclcpp.hpp"
@@ -65,11 +66,13 @@ protected:  // for the static_centerline_optimizer package
   bool enable_debug_info_;
   bool enable_outside_drivable_area_stop_;
   bool enable_skip_optimization_;
+  bool enable_skip_optimization_on_optimized_centerline_;
   bool enable_reset_prev_optimization_;
   bool use_footprint_polygon_for_outside_drivable_area_check_;
 
   // core algorithms
   std::shared_ptr<ReplanChecker> replan_checker_ptr_{nullptr};
+  std::shared_ptr<OptimizedCenterlineChecker> optimized_centerline_checker_ptr_{nullptr};
   std::shared_ptr<MPTOptimizer> mpt_optimizer_ptr_{nullptr};
 
   // parameters
@@ -86,6 +89,7 @@ protected:  // for the static_centerline_optimizer package
   // interface subscriber
   rclcpp::Subscription<Path>::SharedPtr path_sub_;
   rclcpp::Subscription<Odometry>::SharedPtr odom_sub_;
+  rclcpp::Subscription<HADMapBin>::SharedPtr map_sub_;
 
   // debug publisher
   rclcpp::Publisher<Trajectory>::SharedPtr debug_extended_traj_pub_;
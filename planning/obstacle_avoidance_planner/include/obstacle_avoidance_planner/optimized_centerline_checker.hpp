@@ -0,0 +1,58 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OBSTACLE_AVOIDANCE_PLANNER__OPTIMIZED_CENTERLINE_CHECKER_HPP_
+#define OBSTACLE_AVOIDANCE_PLANNER__OPTIMIZED_CENTERLINE_CHECKER_HPP_
+
+#include "obstacle_avoidance_planner/type_alias.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+
+#include <optional>
+#include <vector>
+
+namespace obstacle_avoidance_planner
+{
+// attribute of the lanelets whose centerline is optimized by the static_centerline_optimizer
+constexpr char OPTIMIZED_CENTERLINE_ATTRIBUTE[] = "optimized_centerline";
+
+// Checks whether the trajectory follows the centerlines optimized offline, which are already
+// kinematically feasible and inside the drivable area.
+class OptimizedCenterlineChecker
+{
+public:
+  explicit OptimizedCenterlineChecker(rclcpp::Node * node);
+  void onParam(const std::vector<rclcpp::Parameter> & parameters);
+
+  void onMap(const HADMapBin & msg);
+
+  bool isOnOptimizedCenterline(const std::vector<TrajectoryPoint> & traj_points);
+
+private:
+  lanelet::LaneletMapPtr lanelet_map_ptr_{nullptr};
+
+  // the lanelet matched last, which is checked first for the following points
+  std::optional<lanelet::ConstLanelet> prev_lanelet_{};
+
+  // algorithm parameters
+  double max_lat_dist_;
+
+  bool isOnOptimizedCenterline(
+    const lanelet::ConstLanelet & lanelet, const lanelet::BasicPoint2d & point) const;
+};
+}  // namespace obstacle_avoidance_planner
+
+#endif  // OBSTACLE_AVOIDANCE_PLANNER__OPTIMIZED_CENTERLINE_CHECKER_HPP_
@@ -19,6 +19,8 @@
 #include "obstacle_avoidance_planner/vehicle_model/vehicle_model_bicycle_kinematics.hpp"
 #include "obstacle_avoidance_planner/vehicle_model/vehicle_model_interface.hpp"
 
+#include <Eigen/SparseCore>
+
 #include <memory>
 #include <vector>
 
@@ -31,8 +33,8 @@ class StateEquationGenerator
 public:
   struct Matrix
   {
-    Eigen::MatrixXd A;
-    Eigen::MatrixXd B;
+    Eigen::SparseMatrix<double> A;
+    Eigen::SparseMatrix<double> B;
     Eigen::VectorXd W;
   };
 
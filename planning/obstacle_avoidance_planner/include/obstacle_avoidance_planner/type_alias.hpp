@@ -15,6 +15,7 @@
 #ifndef OBSTACLE_AVOIDANCE_PLANNER__TYPE_ALIAS_HPP_
 #define OBSTACLE_AVOIDANCE_PLANNER__TYPE_ALIAS_HPP_
 
+#include "autoware_auto_mapping_msgs/msg/had_map_bin.hpp"
 #include "autoware_auto_planning_msgs/msg/path.hpp"
 #include "autoware_auto_planning_msgs/msg/path_point.hpp"
 #include "autoware_auto_planning_msgs/msg/trajectory.hpp"
@@ -32,6 +33,8 @@ namespace obstacle_avoidance_planner
 {
 // std_msgs
 using std_msgs::msg::Header;
+// mapping
+using autoware_auto_mapping_msgs::msg::HADMapBin;
 // planning
 using autoware_auto_planning_msgs::msg::Path;
 using autoware_auto_planning_msgs::msg::PathPoint;
@@ -165,6 +165,27 @@ double calcLateralDistToBounds(
 
   return closest_dist_to_bound;
 }
+
+void addBlockTriplets(
+  std::vector<Eigen::Triplet<double>> & triplet_vec, const Eigen::SparseMatrix<double> & mat,
+  const size_t row_offset, const size_t col_offset, const double scale = 1.0)
+{
+  for (int k = 0; k < mat.outerSize(); ++k) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(mat, k); it; ++it) {
+      triplet_vec.push_back(
+        Eigen::Triplet<double>(row_offset + it.row(), col_offset + it.col(), scale * it.value()));
+    }
+  }
+}
+
+void addIdentityTriplets(
+  std::vector<Eigen::Triplet<double>> & triplet_vec, const size_t row_offset,
+  const size_t col_offset, const size_t size)
+{
+  for (size_t i = 0; i < size; ++i) {
+    triplet_vec.push_back(Eigen::Triplet<double>(row_offset + i, col_offset + i, 1.0));
+  }
+}
 }  // namespace
 
 MPTOptimizer::MPTParam::MPTParam(
@@ -174,6 +195,8 @@ MPTOptimizer::MPTParam::MPTParam(
     steer_limit_constraint = node->declare_parameter<bool>("mpt.option.steer_limit_constraint");
     enable_warm_start = node->declare_parameter<bool>("mpt.option.enable_warm_start");
     enable_manual_warm_start = node->declare_parameter<bool>("mpt.option.enable_manual_warm_start");
+    enable_fixed_horizon_warm_start =
+      node->declare_parameter<bool>("mpt.option.enable_fixed_horizon_warm_start");
     enable_optimization_validation =
       node->declare_parameter<bool>("mpt.option.enable_optimization_validation");
     mpt_visualize_sampling_num = node->declare_parameter<int>("mpt.option.visualize_sampling_num");
@@ -288,6 +311,8 @@ void MPTOptimizer::MPTParam::onParam(const std::vector<rclcpp::Parameter> & para
     updateParam<bool>(parameters, "mpt.option.steer_limit_constraint", steer_limit_constraint);
     updateParam<bool>(parameters, "mpt.option.enable_warm_start", enable_warm_start);
     updateParam<bool>(parameters, "mpt.option.enable_manual_warm_start", enable_manual_warm_start);
+    updateParam<bool>(
+      parameters, "mpt.option.enable_fixed_horizon_warm_start", enable_fixed_horizon_warm_start);
     updateParam<bool>(
       parameters, "mpt.option.enable_optimization_validation", enable_optimization_validation);
     updateParam<int>(parameters, "mpt.option.visualize_sampling_num", mpt_visualize_sampling_num);
@@ -458,6 +483,11 @@ void MPTOptimizer::resetPreviousData()
 {
   prev_ref_points_ptr_ = nullptr;
   prev_optimized_traj_points_ptr_ = nullptr;
+
+  // the previous solution is far from the new one, so the solver is initialized again
+  if (mpt_param_.enable_fixed_horizon_warm_start) {
+    prev_solution_status_ = 0;
+  }
 }
 
 void MPTOptimizer::onParam(const std::vector<rclcpp::Parameter> & parameters)
@@ -1266,14 +1296,16 @@ MPTOptimizer::ObjectiveMatrix MPTOptimizer::calcObjectiveMatrix(
   sparse_T_mat.setFromTriplets(triplet_T_vec.begin(), triplet_T_vec.end());
 
   // NOTE: min J(v) = min (v'Hv + v'g)
-  Eigen::MatrixXd H_x = Eigen::MatrixXd::Zero(N_x, N_x);
-  H_x.triangularView<Eigen::Upper>() =
-    Eigen::MatrixXd(sparse_T_mat.transpose() * val_mat.Q * sparse_T_mat);
-  H_x.triangularView<Eigen::Lower>() = H_x.transpose();
+  const Eigen::SparseMatrix<double> H_x_upper =
+    Eigen::SparseMatrix<double>(sparse_T_mat.transpose() * val_mat.Q * sparse_T_mat)
+      .triangularView<Eigen::Upper>();
+  const Eigen::SparseMatrix<double> H_x = H_x_upper.selfadjointView<Eigen::Upper>();
 
-  Eigen::MatrixXd H = Eigen::MatrixXd::Zero(N_v, N_v);
-  H.block(0, 0, N_x, N_x) = H_x;
-  H.block(N_x, N_x, N_u, N_u) = val_mat.R;
+  std::vector<Eigen::Triplet<double>> H_triplet_vec;
+  addBlockTriplets(H_triplet_vec, H_x, 0, 0);
+  addBlockTriplets(H_triplet_vec, val_mat.R, N_x, N_x);
+  Eigen::SparseMatrix<double> H(N_v, N_v);
+  H.setFromTriplets(H_triplet_vec.begin(), H_triplet_vec.end());
 
   Eigen::VectorXd g = Eigen::VectorXd::Zero(N_v);
   g.segment(0, N_x) = T_vec.transpose() * val_mat.Q * sparse_T_mat;
@@ -1312,9 +1344,13 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
   const size_t N_collision_check = vehicle_circle_longitudinal_offsets_.size();
 
   // calculate indices of fixed points
+  // NOTE: With the fixed horizon warm start, the constraints of the front points which may be fixed
+  //       always exist so that the sparsity pattern does not depend on the fixed points.
   std::vector<size_t> fixed_points_indices;
   for (size_t i = 0; i < N_ref; ++i) {
-    if (ref_points.at(i).fixed_kinematic_state) {
+    const bool is_reserved =
+      mpt_param_.enable_fixed_horizon_warm_start && i < max_num_fixed_points_;
+    if (is_reserved || ref_points.at(i).fixed_kinematic_state) {
       fixed_points_indices.push_back(i);
     }
   }
@@ -1335,15 +1371,15 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     A_rows += N_u;
   }
 
-  // NOTE: The following takes 1 [ms]
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(A_rows, N_v);
+  std::vector<Eigen::Triplet<double>> A_triplet_vec;
   Eigen::VectorXd lb = Eigen::VectorXd::Constant(A_rows, -autoware::common::osqp::INF);
   Eigen::VectorXd ub = Eigen::VectorXd::Constant(A_rows, autoware::common::osqp::INF);
   size_t A_rows_end = 0;
 
   // 1. State equation
-  A.block(0, 0, N_x, N_x) = Eigen::MatrixXd::Identity(N_x, N_x) - mpt_mat.A;
-  A.block(0, N_x, N_x, N_u) = -mpt_mat.B;
+  addIdentityTriplets(A_triplet_vec, 0, 0, N_x);
+  addBlockTriplets(A_triplet_vec, mpt_mat.A, 0, 0, -1.0);
+  addBlockTriplets(A_triplet_vec, mpt_mat.B, 0, N_x, -1.0);
   lb.segment(0, N_x) = mpt_mat.W;
   ub.segment(0, N_x) = mpt_mat.W;
   A_rows_end += N_x;
@@ -1379,16 +1415,13 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
       // A := [C | O | ... | O | I | O | ...
       //      -C | O | ... | O | I | O | ...
       //          O    | O | ... | O | I | O | ... ]
-      Eigen::MatrixXd A_blk = Eigen::MatrixXd::Zero(A_blk_rows, N_v);
-      A_blk.block(0, 0, N_ref, N_x) = C_sparse_mat;
-      A_blk.block(N_ref, 0, N_ref, N_x) = -C_sparse_mat;
+      addBlockTriplets(A_triplet_vec, C_sparse_mat, A_rows_end, 0);
+      addBlockTriplets(A_triplet_vec, C_sparse_mat, A_rows_end + N_ref, 0, -1.0);
 
       const size_t local_A_offset_cols = N_x + N_u + (!mpt_param_.l_inf_norm ? N_ref * l_idx : 0);
-      A_blk.block(0, local_A_offset_cols, N_ref, N_ref) = Eigen::MatrixXd::Identity(N_ref, N_ref);
-      A_blk.block(N_ref, local_A_offset_cols, N_ref, N_ref) =
-        Eigen::MatrixXd::Identity(N_ref, N_ref);
-      A_blk.block(2 * N_ref, local_A_offset_cols, N_ref, N_ref) =
-        Eigen::MatrixXd::Identity(N_ref, N_ref);
+      addIdentityTriplets(A_triplet_vec, A_rows_end, local_A_offset_cols, N_ref);
+      addIdentityTriplets(A_triplet_vec, A_rows_end + N_ref, local_A_offset_cols, N_ref);
+      addIdentityTriplets(A_triplet_vec, A_rows_end + 2 * N_ref, local_A_offset_cols, N_ref);
 
       // lb := [lower_bound - C
       //        C - upper_bound
@@ -1397,7 +1430,6 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
       lb_blk.segment(0, N_ref) = -C_vec + part_lb;
       lb_blk.segment(N_ref, N_ref) = C_vec - part_ub;
 
-      A.block(A_rows_end, 0, A_blk_rows, N_v) = A_blk;
       lb.segment(A_rows_end, A_blk_rows) = lb_blk;
 
       A_rows_end += A_blk_rows;
@@ -1407,10 +1439,8 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     if (mpt_param_.hard_constraint) {
       const size_t A_blk_rows = N_ref;
 
-      Eigen::MatrixXd A_blk = Eigen::MatrixXd::Zero(A_blk_rows, N_v);
-      A_blk.block(0, 0, N_ref, N_ref) = C_sparse_mat;
+      addBlockTriplets(A_triplet_vec, C_sparse_mat, A_rows_end, 0);
 
-      A.block(A_rows_end, 0, A_blk_rows, N_v) = A_blk;
       lb.segment(A_rows_end, A_blk_rows) = part_lb - C_vec;
       ub.segment(A_rows_end, A_blk_rows) = part_ub - C_vec;
 
@@ -1421,17 +1451,20 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
   // 3. fixed points constraint
   // X = B v + w where point is fixed
   for (const size_t i : fixed_points_indices) {
-    A.block(A_rows_end, D_x * i, D_x, D_x) = Eigen::MatrixXd::Identity(D_x, D_x);
+    addIdentityTriplets(A_triplet_vec, A_rows_end, D_x * i, D_x);
 
-    lb.segment(A_rows_end, D_x) = ref_points.at(i).fixed_kinematic_state->toEigenVector();
-    ub.segment(A_rows_end, D_x) = ref_points.at(i).fixed_kinematic_state->toEigenVector();
+    // NOTE: The reserved constraints of the points which are not fixed have infinite bounds.
+    if (ref_points.at(i).fixed_kinematic_state) {
+      lb.segment(A_rows_end, D_x) = ref_points.at(i).fixed_kinematic_state->toEigenVector();
+      ub.segment(A_rows_end, D_x) = ref_points.at(i).fixed_kinematic_state->toEigenVector();
+    }
 
     A_rows_end += D_x;
   }
 
   // 4. steer angle limit
   if (mpt_param_.steer_limit_constraint) {
-    A.block(A_rows_end, N_x, N_u, N_u) = Eigen::MatrixXd::Identity(N_u, N_u);
+    addIdentityTriplets(A_triplet_vec, A_rows_end, N_x, N_u);
 
     // TODO(murooka) use curvature by stabling optimization
     // Currently, when using curvature, the optimization result is weird with sample_map.
@@ -1448,6 +1481,9 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     A_rows_end += N_u;
   }
 
+  Eigen::SparseMatrix<double> A(A_rows, N_v);
+  A.setFromTriplets(A_triplet_vec.begin(), A_triplet_vec.end());
+
   time_keeper_ptr_->toc(__func__, "        ");
   return ConstraintMatrix{A, lb, ub};
 }
@@ -1500,8 +1536,8 @@ std::optional<Eigen::VectorXd> MPTOptimizer::calcOptimizedSteerAngles(
     updateMatrixForManualWarmStart(obj_mat, const_mat, u0);
 
   // calculate matrices for qp
-  const Eigen::MatrixXd & H = updated_obj_mat.hessian;
-  const Eigen::MatrixXd & A = updated_const_mat.linear;
+  const Eigen::SparseMatrix<double> & H = updated_obj_mat.hessian;
+  const Eigen::SparseMatrix<double> & A = updated_const_mat.linear;
   const auto f = toStdVector(updated_obj_mat.gradient);
   const auto upper_bound = toStdVector(updated_const_mat.upper_bound);
   const auto lower_bound = toStdVector(updated_const_mat.lower_bound);
@@ -1512,15 +1548,20 @@ std::optional<Eigen::VectorXd> MPTOptimizer::calcOptimizedSteerAngles(
   const autoware::common::osqp::CSC_Matrix P_csc =
     autoware::common::osqp::calCSCMatrixTrapezoidal(H);
   const autoware::common::osqp::CSC_Matrix A_csc = autoware::common::osqp::calCSCMatrix(A);
+  // the matrices cannot be updated when their sparsity pattern is changed
   if (
     prev_solution_status_ == 1 && mpt_param_.enable_warm_start && prev_mat_n_ == H.rows() &&
-    prev_mat_m_ == A.rows()) {
+    prev_mat_m_ == A.rows() && osqp_solver_ptr_->updateCscP(P_csc) &&
+    osqp_solver_ptr_->updateCscA(A_csc)) {
     RCLCPP_INFO_EXPRESSION(logger_, enable_debug_info_, "warm start");
-    osqp_solver_ptr_->updateCscP(P_csc);
     osqp_solver_ptr_->updateQ(f);
-    osqp_solver_ptr_->updateCscA(A_csc);
-    osqp_solver_ptr_->updateL(lower_bound);
-    osqp_solver_ptr_->updateU(upper_bound);
+    osqp_solver_ptr_->updateBounds(lower_bound, upper_bound);
+
+    // NOTE: With the manual warm start, the variables are already relative to the previous ones.
+    if (mpt_param_.enable_fixed_horizon_warm_start && !u0 && prev_ref_points_ptr_) {
+      osqp_solver_ptr_->setPrimalVariables(
+        calcShiftedPrevSolution(ref_points, *prev_ref_points_ptr_));
+    }
   } else {
     RCLCPP_INFO_EXPRESSION(logger_, enable_debug_info_, "no warm start");
     osqp_solver_ptr_ = std::make_unique<autoware::common::osqp::OSQPInterface>(
@@ -1610,6 +1651,43 @@ Eigen::VectorXd MPTOptimizer::calcInitialSolutionForManualWarmStart(
   return u0;
 }
 
+std::vector<double> MPTOptimizer::calcShiftedPrevSolution(
+  const std::vector<ReferencePoint> & ref_points,
+  const std::vector<ReferencePoint> & prev_ref_points) const
+{
+  const size_t D_x = state_equation_generator_.getDimX();
+  const size_t D_u = state_equation_generator_.getDimU();
+  const size_t N_ref = ref_points.size();
+  const size_t N_x = N_ref * D_x;
+  const size_t N_u = (N_ref - 1) * D_u;
+  const size_t N_slack = getNumberOfSlackVariables();
+
+  std::vector<double> prev_solution(N_x + N_u + N_ref * N_slack, 0.0);
+
+  // shift the previous solution by the index offset of the reference points
+  const size_t nearest_idx = motion_utils::findFirstNearestIndexWithSoftConstraints(
+    prev_ref_points, ref_points.front().pose, ego_nearest_param_.dist_threshold,
+    ego_nearest_param_.yaw_threshold);
+  for (size_t i = 0; i < N_ref; ++i) {
+    const auto & prev_ref_point =
+      prev_ref_points.at(std::min(nearest_idx + i, prev_ref_points.size() - 1));
+
+    prev_solution.at(i * D_x) = prev_ref_point.optimized_kinematic_state.lat;
+    prev_solution.at(i * D_x + 1) = prev_ref_point.optimized_kinematic_state.yaw;
+    if (i < N_ref - 1) {
+      prev_solution.at(N_x + i * D_u) = prev_ref_point.optimized_input;
+    }
+    if (prev_ref_point.slack_variables) {
+      const auto & slack_variables = *prev_ref_point.slack_variables;
+      for (size_t j = 0; j < std::min(N_slack, slack_variables.size()); ++j) {
+        prev_solution.at(N_x + N_u + i * N_slack + j) = slack_variables.at(j);
+      }
+    }
+  }
+
+  return prev_solution;
+}
+
 std::pair<MPTOptimizer::ObjectiveMatrix, MPTOptimizer::ConstraintMatrix>
 MPTOptimizer::updateMatrixForManualWarmStart(
   const ObjectiveMatrix & obj_mat, const ConstraintMatrix & const_mat,
@@ -1620,8 +1698,8 @@ MPTOptimizer::updateMatrixForManualWarmStart(
     return {obj_mat, const_mat};
   }
 
-  const Eigen::MatrixXd & H = obj_mat.hessian;
-  const Eigen::MatrixXd & A = const_mat.linear;
+  const Eigen::SparseMatrix<double> & H = obj_mat.hessian;
+  const Eigen::SparseMatrix<double> & A = const_mat.linear;
 
   auto updated_obj_mat = obj_mat;
   auto updated_const_mat = const_mat;
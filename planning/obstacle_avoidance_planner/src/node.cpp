@@ -109,6 +109,8 @@ ObstacleAvoidancePlanner::ObstacleAvoidancePlanner(const rclcpp::NodeOptions & n
     enable_outside_drivable_area_stop_ =
       declare_parameter<bool>("option.enable_outside_drivable_area_stop");
     enable_skip_optimization_ = declare_parameter<bool>("option.enable_skip_optimization");
+    enable_skip_optimization_on_optimized_centerline_ =
+      declare_parameter<bool>("option.enable_skip_optimization_on_optimized_centerline", false);
     enable_reset_prev_optimization_ =
       declare_parameter<bool>("option.enable_reset_prev_optimization");
     use_footprint_polygon_for_outside_drivable_area_check_ =
@@ -136,10 +138,21 @@ ObstacleAvoidancePlanner::ObstacleAvoidancePlanner(const rclcpp::NodeOptions & n
 
   // create core algorithm pointers with parameter declaration
   replan_checker_ptr_ = std::make_shared<ReplanChecker>(this, ego_nearest_param_);
+  optimized_centerline_checker_ptr_ = std::make_shared<OptimizedCenterlineChecker>(this);
   mpt_optimizer_ptr_ = std::make_shared<MPTOptimizer>(
     this, enable_debug_info_, ego_nearest_param_, vehicle_info_, traj_param_, debug_data_ptr_,
     time_keeper_ptr_);
 
+  // NOTE: The map is subscribed only when the option is enabled on startup, since it is used only
+  //       to find the centerlines optimized offline.
+  if (enable_skip_optimization_on_optimized_centerline_) {
+    map_sub_ = create_subscription<HADMapBin>(
+      "~/input/vector_map", rclcpp::QoS{1}.transient_local(),
+      [this](const HADMapBin::ConstSharedPtr msg) {
+        optimized_centerline_checker_ptr_->onMap(*msg);
+      });
+  }
+
   // reset planners
   // NOTE: This function must be called after core algorithms (e.g. mpt_optimizer_) have been
   // initialized.
@@ -163,6 +176,9 @@ rcl_interfaces::msg::SetParametersResult ObstacleAvoidancePlanner::onParam(
   updateParam<bool>(
     parameters, "option.enable_outside_drivable_area_stop", enable_outside_drivable_area_stop_);
   updateParam<bool>(parameters, "option.enable_skip_optimization", enable_skip_optimization_);
+  updateParam<bool>(
+    parameters, "option.enable_skip_optimization_on_optimized_centerline",
+    enable_skip_optimization_on_optimized_centerline_);
   updateParam<bool>(
     parameters, "option.enable_reset_prev_optimization", enable_reset_prev_optimization_);
   updateParam<bool>(
@@ -192,6 +208,7 @@ rcl_interfaces::msg::SetParametersResult ObstacleAvoidancePlanner::onParam(
 
   // parameters for core algorithms
   replan_checker_ptr_->onParam(parameters);
+  optimized_centerline_checker_ptr_->onParam(parameters);
   mpt_optimizer_ptr_->onParam(parameters);
 
   // reset planners
@@ -361,6 +378,15 @@ std::vector<TrajectoryPoint> ObstacleAvoidancePlanner::optimizeTrajectory(
     return p.traj_points;
   }
 
+  // the centerline optimized offline is already kinematically-feasible and inside the drivable area
+  if (
+    enable_skip_optimization_on_optimized_centerline_ &&
+    optimized_centerline_checker_ptr_->isOnOptimizedCenterline(p.traj_points)) {
+    RCLCPP_INFO_EXPRESSION(
+      get_logger(), enable_debug_info_, "Skip optimization on the optimized centerline.");
+    return p.traj_points;
+  }
+
   // 2. make trajectory kinematically-feasible and collision-free (= inside the drivable area)
   //    with model predictive trajectory
   const auto mpt_traj = mpt_optimizer_ptr_->optimizeTrajectory(planner_data, p.traj_points);
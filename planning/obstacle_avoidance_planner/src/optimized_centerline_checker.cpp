@@ -0,0 +1,92 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "obstacle_avoidance_planner/optimized_centerline_checker.hpp"
+
+#include "tier4_autoware_utils/ros/update_param.hpp"
+
+#include <lanelet2_extension/utility/message_conversion.hpp>
+
+#include <lanelet2_core/geometry/Lanelet.h>
+#include <lanelet2_core/geometry/LineString.h>
+
+#include <memory>
+#include <vector>
+
+namespace obstacle_avoidance_planner
+{
+OptimizedCenterlineChecker::OptimizedCenterlineChecker(rclcpp::Node * node)
+{
+  max_lat_dist_ = node->declare_parameter<double>("optimized_centerline.max_lat_dist", 0.1);
+}
+
+void OptimizedCenterlineChecker::onParam(const std::vector<rclcpp::Parameter> & parameters)
+{
+  using tier4_autoware_utils::updateParam;
+
+  updateParam<double>(parameters, "optimized_centerline.max_lat_dist", max_lat_dist_);
+}
+
+void OptimizedCenterlineChecker::onMap(const HADMapBin & msg)
+{
+  lanelet_map_ptr_ = std::make_shared<lanelet::LaneletMap>();
+  lanelet::utils::conversion::fromBinMsg(msg, lanelet_map_ptr_);
+  prev_lanelet_ = std::nullopt;
+}
+
+bool OptimizedCenterlineChecker::isOnOptimizedCenterline(
+  const std::vector<TrajectoryPoint> & traj_points)
+{
+  if (!lanelet_map_ptr_ || traj_points.empty()) {
+    return false;
+  }
+
+  for (const auto & traj_point : traj_points) {
+    const lanelet::BasicPoint2d point(traj_point.pose.position.x, traj_point.pose.position.y);
+
+    // the consecutive points are on the same lanelet in most cases
+    if (prev_lanelet_ && isOnOptimizedCenterline(*prev_lanelet_, point)) {
+      continue;
+    }
+
+    // search the lanelets whose bounding box contains the point with the R-tree of the map
+    bool is_on_optimized_centerline = false;
+    for (const auto & lanelet :
+         lanelet_map_ptr_->laneletLayer.search(lanelet::BoundingBox2d(point, point))) {
+      if (isOnOptimizedCenterline(lanelet, point)) {
+        prev_lanelet_ = lanelet;
+        is_on_optimized_centerline = true;
+        break;
+      }
+    }
+    if (!is_on_optimized_centerline) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool OptimizedCenterlineChecker::isOnOptimizedCenterline(
+  const lanelet::ConstLanelet & lanelet, const lanelet::BasicPoint2d & point) const
+{
+  if (!lanelet.attributeOr(OPTIMIZED_CENTERLINE_ATTRIBUTE, false)) {
+    return false;
+  }
+  if (!lanelet::geometry::inside(lanelet, point)) {
+    return false;
+  }
+  return lanelet::geometry::distance2d(lanelet.centerline2d(), point) < max_lat_dist_;
+}
+}  // namespace obstacle_avoidance_planner
@@ -16,6 +16,8 @@
 
 #include "obstacle_avoidance_planner/mpt_optimizer.hpp"
 
+#include <vector>
+
 namespace obstacle_avoidance_planner
 {
 // state equation: x = B u + W (u includes x_0)
@@ -33,8 +35,10 @@ StateEquationGenerator::Matrix StateEquationGenerator::calcMatrix(
   const size_t N_u = (N_ref - 1) * D_u;
 
   // matrices for whole state equation
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(N_x, N_x);
-  Eigen::MatrixXd B = Eigen::MatrixXd::Zero(N_x, N_u);
+  // NOTE: The zero elements of the one-step matrices are stored as well so that the sparsity
+  //       pattern only depends on the number of reference points.
+  std::vector<Eigen::Triplet<double>> A_triplet_vec;
+  std::vector<Eigen::Triplet<double>> B_triplet_vec;
   Eigen::VectorXd W = Eigen::VectorXd::Zero(N_x);
 
   // matrices for one-step state equation
@@ -42,7 +46,9 @@ StateEquationGenerator::Matrix StateEquationGenerator::calcMatrix(
   Eigen::MatrixXd Bd(D_x, D_u);
   Eigen::MatrixXd Wd(D_x, 1);
 
-  A.block(0, 0, D_x, D_x) = Eigen::MatrixXd::Identity(D_x, D_x);
+  for (size_t i = 0; i < D_x; ++i) {
+    A_triplet_vec.push_back(Eigen::Triplet<double>(i, i, 1.0));
+  }
 
   // calculate one-step state equation considering kinematics N_ref times
   for (size_t i = 1; i < N_ref; ++i) {
@@ -55,11 +61,22 @@ StateEquationGenerator::Matrix StateEquationGenerator::calcMatrix(
     // p.delta_arc_length);
     vehicle_model_ptr_->calculateStateEquationMatrix(Ad, Bd, Wd, 0.0, p.delta_arc_length);
 
-    A.block(i * D_x, (i - 1) * D_x, D_x, D_x) = Ad;
-    B.block(i * D_x, (i - 1) * D_u, D_x, D_u) = Bd;
+    for (size_t r = 0; r < D_x; ++r) {
+      for (size_t c = 0; c < D_x; ++c) {
+        A_triplet_vec.push_back(Eigen::Triplet<double>(i * D_x + r, (i - 1) * D_x + c, Ad(r, c)));
+      }
+      for (size_t c = 0; c < D_u; ++c) {
+        B_triplet_vec.push_back(Eigen::Triplet<double>(i * D_x + r, (i - 1) * D_u + c, Bd(r, c)));
+      }
+    }
     W.segment(i * D_x, D_x) = Wd;
   }
 
+  Eigen::SparseMatrix<double> A(N_x, N_x);
+  A.setFromTriplets(A_triplet_vec.begin(), A_triplet_vec.end());
+  Eigen::SparseMatrix<double> B(N_x, N_u);
+  B.setFromTriplets(B_triplet_vec.begin(), B_triplet_vec.end());
+
   time_keeper_ptr_->toc(__func__, "        ");
   return Matrix{A, B, W};
 }
@@ -0,0 +1,440 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ament_index_cpp/get_package_share_directory.hpp"
+#include "obstacle_cruise_planner/node.hpp"
+#include "obstacle_cruise_planner/optimization_based_planner/velocity_optimizer.hpp"
+#include "obstacle_cruise_planner/polygon_utils.hpp"
+#include "obstacle_cruise_planner/utils.hpp"
+#include "tier4_autoware_utils/geometry/geometry.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+// NOTE: Allocations are counted by replacing the global operator new of this executable.
+namespace
+{
+std::atomic<size_t> g_allocation_count{0};
+}  // namespace
+
+void * operator new(std::size_t size)
+{
+  ++g_allocation_count;
+  if (void * ptr = std::malloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+void operator delete(void * ptr) noexcept { std::free(ptr); }
+void operator delete(void * ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace
+{
+using autoware_auto_perception_msgs::msg::ObjectClassification;
+using autoware_auto_perception_msgs::msg::PredictedObject;
+using autoware_auto_perception_msgs::msg::PredictedObjects;
+using autoware_auto_perception_msgs::msg::PredictedPath;
+using autoware_auto_perception_msgs::msg::Shape;
+using autoware_auto_planning_msgs::msg::Trajectory;
+using autoware_auto_planning_msgs::msg::TrajectoryPoint;
+using geometry_msgs::msg::AccelWithCovarianceStamped;
+using nav_msgs::msg::Odometry;
+using tier4_autoware_utils::Polygon2d;
+
+struct StageResult
+{
+  std::string name;
+  std::vector<double> times_us;
+  std::vector<size_t> allocations;
+};
+
+template <typename T>
+T calcPercentile(std::vector<T> values, const double ratio)
+{
+  if (values.empty()) {
+    return T{};
+  }
+  std::sort(values.begin(), values.end());
+  const size_t idx = std::min(
+    values.size() - 1, static_cast<size_t>(ratio * static_cast<double>(values.size() - 1) + 0.5));
+  return values.at(idx);
+}
+
+template <typename F>
+StageResult measure(const std::string & name, const size_t iteration_num, F && func)
+{
+  StageResult result{name, {}, {}};
+  result.times_us.reserve(iteration_num);
+  result.allocations.reserve(iteration_num);
+  for (size_t i = 0; i < iteration_num; ++i) {
+    const size_t allocation_start = g_allocation_count.load();
+    const auto time_start = std::chrono::steady_clock::now();
+    func();
+    const auto time_end = std::chrono::steady_clock::now();
+    const size_t allocation_end = g_allocation_count.load();
+
+    result.times_us.push_back(
+      std::chrono::duration<double, std::micro>(time_end - time_start).count());
+    result.allocations.push_back(allocation_end - allocation_start);
+  }
+  return result;
+}
+
+void printResult(const StageResult & result)
+{
+  std::printf(
+    "%-40s p50 %10.1f [us], p99 %10.1f [us], allocations p50 %8lu, p99 %8lu\n",
+    result.name.c_str(), calcPercentile(result.times_us, 0.5),
+    calcPercentile(result.times_us, 0.99), calcPercentile(result.allocations, 0.5),
+    calcPercentile(result.allocations, 0.99));
+}
+
+// trajectory along an arc with a constant curvature
+std::vector<TrajectoryPoint> createTrajectoryPoints(
+  const size_t point_num, const double interval, const double curvature, const double velocity)
+{
+  std::vector<TrajectoryPoint> traj_points;
+  double x = 0.0;
+  double y = 0.0;
+  double yaw = 0.0;
+  for (size_t i = 0; i < point_num; ++i) {
+    TrajectoryPoint point;
+    point.pose.position = tier4_autoware_utils::createPoint(x, y, 0.0);
+    point.pose.orientation = tier4_autoware_utils::createQuaternionFromYaw(yaw);
+    point.longitudinal_velocity_mps = velocity;
+    traj_points.push_back(point);
+
+    x += interval * std::cos(yaw);
+    y += interval * std::sin(yaw);
+    yaw += interval * curvature;
+  }
+  traj_points.back().longitudinal_velocity_mps = 0.0;
+  return traj_points;
+}
+
+// cars around the trajectory going straight with their own velocity
+PredictedObjects createPredictedObjects(
+  const std::vector<TrajectoryPoint> & traj_points, const size_t object_num,
+  const rclcpp::Time & stamp)
+{
+  std::mt19937 engine(0);
+  std::uniform_int_distribution<size_t> idx_dist(0, traj_points.size() - 1);
+  std::uniform_real_distribution<double> lat_dist(-6.0, 6.0);
+  std::uniform_real_distribution<double> vel_dist(0.0, 15.0);
+  std::uniform_int_distribution<int> uuid_dist(0, 255);
+
+  PredictedObjects objects;
+  objects.header.stamp = stamp;
+  objects.header.frame_id = "map";
+  for (size_t i = 0; i < object_num; ++i) {
+    const auto & base_pose = traj_points.at(idx_dist(engine)).pose;
+
+    PredictedObject object;
+    for (auto & uuid : object.object_id.uuid) {
+      uuid = static_cast<uint8_t>(uuid_dist(engine));
+    }
+    ObjectClassification classification;
+    classification.label = ObjectClassification::CAR;
+    classification.probability = 1.0;
+    object.classification.push_back(classification);
+    object.shape.type = Shape::BOUNDING_BOX;
+    object.shape.dimensions.x = 4.5;
+    object.shape.dimensions.y = 1.8;
+    object.shape.dimensions.z = 1.5;
+
+    const double velocity = vel_dist(engine);
+    auto & kinematics = object.kinematics;
+    kinematics.initial_pose_with_covariance.pose =
+      tier4_autoware_utils::calcOffsetPose(base_pose, 0.0, lat_dist(engine), 0.0);
+    kinematics.initial_twist_with_covariance.twist.linear.x = velocity;
+
+    PredictedPath predicted_path;
+    predicted_path.confidence = 1.0;
+    predicted_path.time_step = rclcpp::Duration::from_seconds(0.5);
+    for (size_t j = 0; j < 20; ++j) {
+      predicted_path.path.push_back(tier4_autoware_utils::calcOffsetPose(
+        kinematics.initial_pose_with_covariance.pose, velocity * 0.5 * static_cast<double>(j),
+        0.0, 0.0));
+    }
+    kinematics.predicted_paths.push_back(predicted_path);
+
+    objects.objects.push_back(object);
+  }
+  return objects;
+}
+
+std::vector<Polygon2d> createOneStepPolygons(
+  const std::vector<TrajectoryPoint> & traj_points,
+  const vehicle_info_util::VehicleInfo & vehicle_info)
+{
+  std::vector<Polygon2d> polygons;
+  std::vector<geometry_msgs::msg::Pose> last_poses = {traj_points.front().pose};
+  for (const auto & traj_point : traj_points) {
+    const std::vector<geometry_msgs::msg::Pose> current_poses = {traj_point.pose};
+    polygons.push_back(
+      polygon_utils::createOneStepPolygon(last_poses, current_poses, vehicle_info, 0.0));
+    last_poses = current_poses;
+  }
+  return polygons;
+}
+
+std::vector<StageResult> benchmarkPolygonUtils(
+  const std::vector<TrajectoryPoint> & traj_points, const PredictedObjects & objects,
+  const vehicle_info_util::VehicleInfo & vehicle_info, const size_t iteration_num)
+{
+  std::vector<StageResult> results;
+
+  results.push_back(measure("one step polygons", iteration_num, [&]() {
+    createOneStepPolygons(traj_points, vehicle_info);
+  }));
+  const auto traj_polygons = createOneStepPolygons(traj_points, vehicle_info);
+
+  results.push_back(measure("trajectory polygon rtree", iteration_num, [&]() {
+    polygon_utils::createTrajectoryPolygonRtree(traj_polygons);
+  }));
+  const auto traj_polygon_rtree = polygon_utils::createTrajectoryPolygonRtree(traj_polygons);
+
+  std::vector<Polygon2d> obstacle_polygons;
+  for (const auto & object : objects.objects) {
+    obstacle_polygons.push_back(tier4_autoware_utils::toPolygon2d(
+      object.kinematics.initial_pose_with_covariance.pose, object.shape));
+  }
+  results.push_back(measure("lateral distance (naive)", iteration_num, [&]() {
+    for (const auto & obstacle_polygon : obstacle_polygons) {
+      double min_dist = std::numeric_limits<double>::max();
+      for (const auto & traj_polygon : traj_polygons) {
+        min_dist = std::min(min_dist, boost::geometry::distance(traj_polygon, obstacle_polygon));
+      }
+    }
+  }));
+  results.push_back(measure("lateral distance (rtree)", iteration_num, [&]() {
+    polygon_utils::calcDistancesToTrajectoryPolygons(
+      traj_polygons, traj_polygon_rtree, obstacle_polygons);
+  }));
+
+  const auto stamp = rclcpp::Time(objects.header.stamp);
+  results.push_back(measure("collision points (naive)", iteration_num, [&]() {
+    for (const auto & object : objects.objects) {
+      std::vector<size_t> collision_index;
+      polygon_utils::getCollisionPoints(
+        traj_points, traj_polygons, stamp, object.kinematics.predicted_paths.front(), object.shape,
+        stamp, true, collision_index);
+    }
+  }));
+  results.push_back(measure("collision points (rtree)", iteration_num, [&]() {
+    for (const auto & object : objects.objects) {
+      std::vector<size_t> collision_index;
+      polygon_utils::getCollisionPoints(
+        traj_points, traj_polygons, traj_polygon_rtree, stamp,
+        object.kinematics.predicted_paths.front(), object.shape, stamp, true, collision_index);
+    }
+  }));
+
+  return results;
+}
+
+std::vector<StageResult> benchmarkVelocityOptimizer(const size_t iteration_num)
+{
+  std::vector<double> time_vec;
+  for (double t = 0.0; t < 5.0; t += 0.2) {
+    time_vec.push_back(t);
+  }
+  for (double t = 5.0; t <= 25.0; t += 2.0) {
+    time_vec.push_back(t);
+  }
+
+  // leader going ahead with 10 [m/s] at 20 [m]
+  VelocityOptimizer::OptimizationData data;
+  data.time_vec = time_vec;
+  data.s0 = 0.0;
+  data.v0 = 10.0;
+  data.a0 = 0.0;
+  data.v_max = 15.0;
+  data.a_max = 1.0;
+  data.a_min = -1.0;
+  data.j_max = 1.0;
+  data.j_min = -1.0;
+  data.limit_a_max = 1.0;
+  data.limit_a_min = -3.0;
+  data.limit_j_max = 1.5;
+  data.limit_j_min = -1.5;
+  data.t_dangerous = 0.5;
+  data.idling_time = 0.5;
+  for (const double t : time_vec) {
+    SBoundary s_boundary;
+    s_boundary.max_s = 20.0 + 10.0 * t - 3.0;
+    s_boundary.is_object = true;
+    data.s_boundary.push_back(s_boundary);
+  }
+
+  VelocityOptimizer velocity_optimizer(100.0, 1.0, 1000000.0, 50.0, 500000.0, 5000.0, 10000.0);
+
+  std::vector<StageResult> results;
+  results.push_back(measure("velocity optimizer (cold start)", iteration_num, [&]() {
+    velocity_optimizer.optimize(data, false);
+  }));
+  results.push_back(measure("velocity optimizer (warm start)", iteration_num, [&]() {
+    velocity_optimizer.optimize(data, true);
+  }));
+  return results;
+}
+
+StageResult benchmarkPlatoonController(const size_t iteration_num)
+{
+  PlatoonParam param;
+  param.standstill_distance = 3.0;
+  param.time_headway = 0.5;
+  param.kp_gap = 0.3;
+  param.kv_gap = 0.8;
+  param.max_accel = 1.0;
+  param.min_accel = -2.0;
+
+  volatile double target_acc = 0.0;
+  return measure("platoon gap controller", iteration_num, [&]() {
+    target_acc = obstacle_cruise_utils::calcPlatoonTargetAcceleration(20.0, 10.0, 9.0, param);
+  });
+}
+
+// end-to-end latency of onTrajectory measured from the trajectory input to the output
+std::vector<StageResult> benchmarkNode(
+  const std::vector<TrajectoryPoint> & traj_points, const size_t object_num,
+  const std::string & planning_algorithm, const size_t iteration_num)
+{
+  auto node_options = rclcpp::NodeOptions{};
+  const auto obstacle_cruise_planner_dir =
+    ament_index_cpp::get_package_share_directory("obstacle_cruise_planner");
+  const auto planning_test_utils_dir =
+    ament_index_cpp::get_package_share_directory("planning_test_utils");
+  node_options.arguments(
+    {"--ros-args", "--params-file", planning_test_utils_dir + "/config/test_common.param.yaml",
+     "--params-file", planning_test_utils_dir + "/config/test_nearest_search.param.yaml",
+     "--params-file", planning_test_utils_dir + "/config/test_vehicle_info.param.yaml",
+     "--params-file", obstacle_cruise_planner_dir + "/config/default_common.param.yaml",
+     "--params-file", obstacle_cruise_planner_dir + "/config/obstacle_cruise_planner.param.yaml",
+     "-p", "common.planning_algorithm:=" + planning_algorithm});
+  auto target_node = std::make_shared<motion_planning::ObstacleCruisePlannerNode>(node_options);
+  auto bench_node = std::make_shared<rclcpp::Node>("obstacle_cruise_planner_benchmark");
+
+  const std::string prefix = "obstacle_cruise_planner/";
+  auto traj_pub = bench_node->create_publisher<Trajectory>(prefix + "input/trajectory", 1);
+  auto objects_pub = bench_node->create_publisher<PredictedObjects>(prefix + "input/objects", 1);
+  auto odom_pub = bench_node->create_publisher<Odometry>(prefix + "input/odometry", 1);
+  auto acc_pub =
+    bench_node->create_publisher<AccelWithCovarianceStamped>(prefix + "input/acceleration", 1);
+  bool is_received = false;
+  auto traj_sub = bench_node->create_subscription<Trajectory>(
+    prefix + "output/trajectory", 1, [&](const Trajectory::ConstSharedPtr) { is_received = true; });
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(target_node);
+  executor.add_node(bench_node);
+
+  Odometry odom;
+  odom.header.frame_id = "map";
+  odom.pose.pose = traj_points.front().pose;
+  odom.twist.twist.linear.x = traj_points.front().longitudinal_velocity_mps;
+  AccelWithCovarianceStamped acc;
+  acc.header.frame_id = "map";
+  Trajectory traj;
+  traj.header.frame_id = "map";
+  traj.points = traj_points;
+
+  const auto publish_inputs = [&]() {
+    const auto stamp = bench_node->now();
+    odom.header.stamp = stamp;
+    acc.header.stamp = stamp;
+    traj.header.stamp = stamp;
+    odom_pub->publish(odom);
+    acc_pub->publish(acc);
+    objects_pub->publish(createPredictedObjects(traj_points, object_num, stamp));
+    for (size_t i = 0; i < 3; ++i) {
+      executor.spin_some();
+    }
+  };
+  const auto run_once = [&]() {
+    is_received = false;
+    traj_pub->publish(traj);
+    while (rclcpp::ok() && !is_received) {
+      executor.spin_some();
+    }
+  };
+
+  // warm up
+  publish_inputs();
+  run_once();
+
+  StageResult result{"node pipeline (" + planning_algorithm + ")", {}, {}};
+  for (size_t i = 0; i < iteration_num; ++i) {
+    publish_inputs();
+    const auto single_result = measure("", 1, run_once);
+    result.times_us.push_back(single_result.times_us.front());
+    result.allocations.push_back(single_result.allocations.front());
+  }
+  return {result};
+}
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+
+  const auto non_ros_args = rclcpp::remove_ros_arguments(argc, argv);
+  const size_t iteration_num = 2 <= non_ros_args.size() ? std::stoul(non_ros_args.at(1)) : 100;
+  const size_t object_num = 3 <= non_ros_args.size() ? std::stoul(non_ros_args.at(2)) : 150;
+  const size_t point_num = 4 <= non_ros_args.size() ? std::stoul(non_ros_args.at(3)) : 200;
+
+  auto vehicle_info = vehicle_info_util::createVehicleInfo(
+    0.383, 0.235, 2.79, 1.64, 1.0, 1.1, 0.128, 0.128, 2.5, 0.70);
+
+  std::printf(
+    "iteration: %lu, object: %lu, trajectory point: %lu\n", iteration_num, object_num, point_num);
+  for (const double curvature : {0.0, 0.02}) {
+    std::printf("--- trajectory curvature %.2f [1/m] ---\n", curvature);
+    const auto traj_points = createTrajectoryPoints(point_num, 1.0, curvature, 10.0);
+    const auto objects = createPredictedObjects(traj_points, object_num, rclcpp::Time(0));
+
+    for (const auto & result :
+         benchmarkPolygonUtils(traj_points, objects, vehicle_info, iteration_num)) {
+      printResult(result);
+    }
+  }
+
+  std::printf("--- planners ---\n");
+  for (const auto & result : benchmarkVelocityOptimizer(iteration_num)) {
+    printResult(result);
+  }
+  printResult(benchmarkPlatoonController(iteration_num));
+
+  const auto traj_points = createTrajectoryPoints(point_num, 1.0, 0.0, 10.0);
+  for (const auto & planning_algorithm : {"pid_base", "optimization_base", "platoon_base"}) {
+    for (const auto & result :
+         benchmarkNode(traj_points, object_num, planning_algorithm, iteration_num)) {
+      printResult(result);
+    }
+  }
+
+  rclcpp::shutdown();
+  return 0;
+}
@@ -0,0 +1,406 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ament_index_cpp/get_package_share_directory.hpp"
+#include "obstacle_cruise_planner/node.hpp"
+#include "obstacle_cruise_planner/utils.hpp"
+#include "tier4_autoware_utils/geometry/geometry.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace
+{
+using autoware_auto_perception_msgs::msg::ObjectClassification;
+using autoware_auto_perception_msgs::msg::PredictedObject;
+using autoware_auto_perception_msgs::msg::PredictedObjects;
+using autoware_auto_perception_msgs::msg::PredictedPath;
+using autoware_auto_perception_msgs::msg::Shape;
+using autoware_auto_planning_msgs::msg::Trajectory;
+using autoware_auto_planning_msgs::msg::TrajectoryPoint;
+using geometry_msgs::msg::AccelWithCovarianceStamped;
+using nav_msgs::msg::Odometry;
+using tier4_planning_msgs::msg::PlatoonInfo;
+
+constexpr double control_period = 0.1;     // same as the planning cycle [s]
+constexpr double sim_period = 0.01;        // [s]
+constexpr double vehicle_length = 4.5;     // [m]
+constexpr double initial_velocity = 15.0;  // [m/s]
+
+template <typename T>
+T calcPercentile(std::vector<T> values, const double ratio)
+{
+  if (values.empty()) {
+    return T{};
+  }
+  std::sort(values.begin(), values.end());
+  const size_t idx = std::min(
+    values.size() - 1, static_cast<size_t>(ratio * static_cast<double>(values.size() - 1) + 0.5));
+  return values.at(idx);
+}
+
+struct LeaderProfile
+{
+  std::string name;
+  std::function<double(double)> acc;  // leader's acceleration at the time [m/ss]
+};
+
+std::vector<LeaderProfile> createLeaderProfiles()
+{
+  return {
+    {"step", [](const double t) { return 5.0 <= t && t < 8.0 ? 1.0 : 0.0; }},
+    {"sine", [](const double t) { return 0.5 * std::sin(2.0 * M_PI * t / 10.0); }},
+    {"hard_brake", [](const double t) { return 10.0 <= t && t < 13.0 ? -3.0 : 0.0; }},
+  };
+}
+
+// longitudinal plant with the same acceleration model as DELAY_STEER_ACC of
+// simple_planning_simulator: dead time and 1st-order lag on the acceleration input
+struct Vehicle
+{
+  double s{0.0};
+  double v{0.0};
+  double a{0.0};
+  std::deque<double> acc_cmd_queue;
+
+  void update(const double acc_cmd, const double acc_time_constant)
+  {
+    acc_cmd_queue.push_back(acc_cmd);
+    const double delayed_acc_cmd = acc_cmd_queue.front();
+    acc_cmd_queue.pop_front();
+
+    a += (delayed_acc_cmd - a) * sim_period / acc_time_constant;
+    v = std::max(0.0, v + a * sim_period);
+    s += v * sim_period;
+  }
+};
+
+struct ConvoyResult
+{
+  std::vector<double> gap_error_rms;  // per follower [m]
+  std::vector<double> gap_error_max;  // per follower [m]
+  double max_amplification{0.0};      // max of the velocity deviation ratio to the predecessor
+  double min_gap{std::numeric_limits<double>::max()};
+  std::vector<double> cycle_times_us;
+};
+
+// closed loop of the leader and the followers, each of which keeps the gap to its predecessor
+ConvoyResult simulateConvoy(
+  const LeaderProfile & profile, const size_t follower_num, const PlatoonParam & param,
+  const double duration, const double acc_time_delay, const double acc_time_constant)
+{
+  const size_t delay_step_num = static_cast<size_t>(std::round(acc_time_delay / sim_period));
+  const size_t sim_step_num_per_cycle =
+    static_cast<size_t>(std::round(control_period / sim_period));
+
+  // start from the equilibrium
+  std::vector<Vehicle> vehicles(follower_num + 1);
+  const double desired_gap = param.standstill_distance + param.time_headway * initial_velocity;
+  for (size_t i = 0; i < vehicles.size(); ++i) {
+    vehicles.at(i).s = -static_cast<double>(i) * (desired_gap + vehicle_length);
+    vehicles.at(i).v = initial_velocity;
+    vehicles.at(i).acc_cmd_queue.assign(delay_step_num, 0.0);
+  }
+
+  ConvoyResult result;
+  std::vector<double> gap_error_square_sum(follower_num, 0.0);
+  result.gap_error_max.assign(follower_num, 0.0);
+  std::vector<double> max_velocity_deviation(follower_num + 1, 0.0);
+  std::vector<double> acc_cmds(follower_num + 1, 0.0);
+
+  const size_t cycle_num = static_cast<size_t>(duration / control_period);
+  for (size_t cycle = 0; cycle < cycle_num; ++cycle) {
+    const double t = static_cast<double>(cycle) * control_period;
+
+    // the leader without any predecessor does not go backward
+    acc_cmds.front() = vehicles.front().v <= 0.0 ? std::max(0.0, profile.acc(t)) : profile.acc(t);
+
+    const auto time_start = std::chrono::steady_clock::now();
+    for (size_t i = 1; i < vehicles.size(); ++i) {
+      const auto & predecessor = vehicles.at(i - 1);
+      const auto & follower = vehicles.at(i);
+      const double gap = predecessor.s - follower.s - vehicle_length;
+      acc_cmds.at(i) = obstacle_cruise_utils::calcPlatoonTargetAcceleration(
+        gap, follower.v, predecessor.v, param);
+    }
+    const auto time_end = std::chrono::steady_clock::now();
+    result.cycle_times_us.push_back(
+      std::chrono::duration<double, std::micro>(time_end - time_start).count());
+
+    for (size_t step = 0; step < sim_step_num_per_cycle; ++step) {
+      for (size_t i = 0; i < vehicles.size(); ++i) {
+        vehicles.at(i).update(acc_cmds.at(i), acc_time_constant);
+      }
+    }
+
+    for (size_t i = 0; i < vehicles.size(); ++i) {
+      max_velocity_deviation.at(i) =
+        std::max(max_velocity_deviation.at(i), std::abs(vehicles.at(i).v - initial_velocity));
+    }
+    for (size_t i = 1; i < vehicles.size(); ++i) {
+      const double gap = vehicles.at(i - 1).s - vehicles.at(i).s - vehicle_length;
+      const double gap_error =
+        gap - (param.standstill_distance + param.time_headway * vehicles.at(i).v);
+      gap_error_square_sum.at(i - 1) += gap_error * gap_error;
+      result.gap_error_max.at(i - 1) =
+        std::max(result.gap_error_max.at(i - 1), std::abs(gap_error));
+      result.min_gap = std::min(result.min_gap, gap);
+    }
+  }
+
+  for (size_t i = 0; i < follower_num; ++i) {
+    result.gap_error_rms.push_back(
+      std::sqrt(gap_error_square_sum.at(i) / static_cast<double>(std::max<size_t>(cycle_num, 1))));
+  }
+
+  // the convoy is string stable if the velocity deviation is not amplified along the followers
+  for (size_t i = 1; i < vehicles.size(); ++i) {
+    if (max_velocity_deviation.at(i - 1) < 1e-3) {
+      continue;
+    }
+    result.max_amplification = std::max(
+      result.max_amplification, max_velocity_deviation.at(i) / max_velocity_deviation.at(i - 1));
+  }
+  return result;
+}
+
+void benchmarkConvoy(
+  const std::vector<size_t> & follower_nums, const PlatoonParam & base_param,
+  const double duration, const double acc_time_delay, const double acc_time_constant)
+{
+  std::printf(
+    "%-10s %6s %4s %12s %12s %12s %10s %10s %10s\n", "profile", "h [s]", "N", "rms err [m]",
+    "max err [m]", "amplify", "min gap[m]", "p50 [us]", "p99 [us]");
+  for (const auto & profile : createLeaderProfiles()) {
+    for (const double time_headway : {0.5, 1.0, 1.5}) {
+      auto param = base_param;
+      param.time_headway = time_headway;
+      for (const size_t follower_num : follower_nums) {
+        const auto result = simulateConvoy(
+          profile, follower_num, param, duration, acc_time_delay, acc_time_constant);
+        std::printf(
+          "%-10s %6.1f %4lu %12.3f %12.3f %12.3f %10.2f %10.2f %10.2f\n", profile.name.c_str(),
+          time_headway, follower_num,
+          *std::max_element(result.gap_error_rms.begin(), result.gap_error_rms.end()),
+          *std::max_element(result.gap_error_max.begin(), result.gap_error_max.end()),
+          result.max_amplification, result.min_gap, calcPercentile(result.cycle_times_us, 0.5),
+          calcPercentile(result.cycle_times_us, 0.99));
+      }
+    }
+  }
+}
+
+// straight trajectory from the ego forward
+std::vector<TrajectoryPoint> createStraightTrajectoryPoints(
+  const size_t point_num, const double interval, const double velocity)
+{
+  std::vector<TrajectoryPoint> traj_points;
+  for (size_t i = 0; i < point_num; ++i) {
+    TrajectoryPoint point;
+    point.pose.position =
+      tier4_autoware_utils::createPoint(static_cast<double>(i) * interval, 0.0, 0.0);
+    point.pose.orientation = tier4_autoware_utils::createQuaternionFromYaw(0.0);
+    point.longitudinal_velocity_mps = velocity;
+    traj_points.push_back(point);
+  }
+  traj_points.back().longitudinal_velocity_mps = 0.0;
+  return traj_points;
+}
+
+// the vehicles of the convoy ahead of the ego going straight with the same velocity
+PredictedObjects createConvoyObjects(
+  const size_t vehicle_num, const double gap, const double velocity, const rclcpp::Time & stamp)
+{
+  PredictedObjects objects;
+  objects.header.stamp = stamp;
+  objects.header.frame_id = "map";
+  for (size_t i = 0; i < vehicle_num; ++i) {
+    PredictedObject object;
+    object.object_id.uuid.fill(0);
+    object.object_id.uuid.at(0) = static_cast<uint8_t>(i + 1);
+    object.object_id.uuid.at(1) = static_cast<uint8_t>((i + 1) >> 8);
+    ObjectClassification classification;
+    classification.label = ObjectClassification::CAR;
+    classification.probability = 1.0;
+    object.classification.push_back(classification);
+    object.shape.type = Shape::BOUNDING_BOX;
+    object.shape.dimensions.x = vehicle_length;
+    object.shape.dimensions.y = 1.8;
+    object.shape.dimensions.z = 1.5;
+
+    auto & kinematics = object.kinematics;
+    const double x = static_cast<double>(i + 1) * (gap + vehicle_length);
+    kinematics.initial_pose_with_covariance.pose.position =
+      tier4_autoware_utils::createPoint(x, 0.0, 0.0);
+    kinematics.initial_pose_with_covariance.pose.orientation =
+      tier4_autoware_utils::createQuaternionFromYaw(0.0);
+    kinematics.initial_twist_with_covariance.twist.linear.x = velocity;
+
+    PredictedPath predicted_path;
+    predicted_path.confidence = 1.0;
+    predicted_path.time_step = rclcpp::Duration::from_seconds(0.5);
+    for (size_t j = 0; j < 20; ++j) {
+      predicted_path.path.push_back(tier4_autoware_utils::calcOffsetPose(
+        kinematics.initial_pose_with_covariance.pose, velocity * 0.5 * static_cast<double>(j),
+        0.0, 0.0));
+    }
+    kinematics.predicted_paths.push_back(predicted_path);
+
+    objects.objects.push_back(object);
+  }
+  return objects;
+}
+
+// latency of onTrajectory of the last follower in the platooning mode with the convoy ahead
+void benchmarkNode(
+  const std::vector<size_t> & follower_nums, const size_t point_num, const size_t iteration_num)
+{
+  auto node_options = rclcpp::NodeOptions{};
+  const auto obstacle_cruise_planner_dir =
+    ament_index_cpp::get_package_share_directory("obstacle_cruise_planner");
+  const auto planning_test_utils_dir =
+    ament_index_cpp::get_package_share_directory("planning_test_utils");
+  node_options.arguments(
+    {"--ros-args", "--params-file", planning_test_utils_dir + "/config/test_common.param.yaml",
+     "--params-file", planning_test_utils_dir + "/config/test_nearest_search.param.yaml",
+     "--params-file", planning_test_utils_dir + "/config/test_vehicle_info.param.yaml",
+     "--params-file", obstacle_cruise_planner_dir + "/config/default_common.param.yaml",
+     "--params-file", obstacle_cruise_planner_dir + "/config/obstacle_cruise_planner.param.yaml"});
+  auto target_node = std::make_shared<motion_planning::ObstacleCruisePlannerNode>(node_options);
+  auto bench_node = std::make_shared<rclcpp::Node>("obstacle_cruise_planner_platoon_benchmark");
+
+  const std::string prefix = "obstacle_cruise_planner/";
+  auto traj_pub = bench_node->create_publisher<Trajectory>(prefix + "input/trajectory", 1);
+  auto objects_pub = bench_node->create_publisher<PredictedObjects>(prefix + "input/objects", 1);
+  auto odom_pub = bench_node->create_publisher<Odometry>(prefix + "input/odometry", 1);
+  auto acc_pub =
+    bench_node->create_publisher<AccelWithCovarianceStamped>(prefix + "input/acceleration", 1);
+  auto platoon_info_pub =
+    bench_node->create_publisher<PlatoonInfo>(prefix + "input/platoon_info", 1);
+  bool is_received = false;
+  auto traj_sub = bench_node->create_subscription<Trajectory>(
+    prefix + "output/trajectory", 1, [&](const Trajectory::ConstSharedPtr) { is_received = true; });
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(target_node);
+  executor.add_node(bench_node);
+
+  PlatoonInfo platoon_info;
+  platoon_info.platoon_info = "platooning";
+  platoon_info_pub->publish(platoon_info);
+  for (size_t i = 0; i < 3; ++i) {
+    executor.spin_some();
+  }
+
+  const auto traj_points = createStraightTrajectoryPoints(point_num, 1.0, initial_velocity);
+  Odometry odom;
+  odom.header.frame_id = "map";
+  odom.pose.pose = traj_points.front().pose;
+  odom.twist.twist.linear.x = initial_velocity;
+  AccelWithCovarianceStamped acc;
+  acc.header.frame_id = "map";
+  Trajectory traj;
+  traj.header.frame_id = "map";
+  traj.points = traj_points;
+
+  const double gap = 3.0 + 0.5 * initial_velocity;
+  for (const size_t follower_num : follower_nums) {
+    const auto publish_inputs = [&]() {
+      const auto stamp = bench_node->now();
+      odom.header.stamp = stamp;
+      acc.header.stamp = stamp;
+      traj.header.stamp = stamp;
+      odom_pub->publish(odom);
+      acc_pub->publish(acc);
+      // the leader and the other followers are ahead of the last follower
+      objects_pub->publish(createConvoyObjects(follower_num, gap, initial_velocity, stamp));
+      for (size_t i = 0; i < 3; ++i) {
+        executor.spin_some();
+      }
+    };
+    const auto run_once = [&]() {
+      is_received = false;
+      traj_pub->publish(traj);
+      while (rclcpp::ok() && !is_received) {
+        executor.spin_some();
+      }
+    };
+
+    // warm up
+    publish_inputs();
+    run_once();
+
+    std::vector<double> times_us;
+    for (size_t i = 0; i < iteration_num; ++i) {
+      publish_inputs();
+      const auto time_start = std::chrono::steady_clock::now();
+      run_once();
+      const auto time_end = std::chrono::steady_clock::now();
+      times_us.push_back(std::chrono::duration<double, std::micro>(time_end - time_start).count());
+    }
+    std::printf(
+      "node pipeline (platooning), N %4lu: p50 %10.1f [us], p99 %10.1f [us]\n", follower_num,
+      calcPercentile(times_us, 0.5), calcPercentile(times_us, 0.99));
+  }
+}
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+
+  const auto non_ros_args = rclcpp::remove_ros_arguments(argc, argv);
+  const size_t iteration_num = 2 <= non_ros_args.size() ? std::stoul(non_ros_args.at(1)) : 100;
+  const size_t max_follower_num = 3 <= non_ros_args.size() ? std::stoul(non_ros_args.at(2)) : 16;
+  const double duration = 4 <= non_ros_args.size() ? std::stod(non_ros_args.at(3)) : 40.0;
+
+  // same as the default of simple_planning_simulator
+  const double acc_time_delay = 0.1;
+  const double acc_time_constant = 0.1;
+
+  // same as the default of obstacle_cruise_planner.param.yaml
+  PlatoonParam param;
+  param.standstill_distance = 3.0;
+  param.time_headway = 0.5;
+  param.kp_gap = 0.3;
+  param.kv_gap = 0.8;
+  param.max_accel = 1.0;
+  param.min_accel = -2.0;
+
+  std::vector<size_t> follower_nums;
+  for (size_t follower_num = 1; follower_num <= max_follower_num; follower_num *= 2) {
+    follower_nums.push_back(follower_num);
+  }
+
+  std::printf(
+    "iteration: %lu, max follower: %lu, duration: %.1f [s]\n", iteration_num, max_follower_num,
+    duration);
+  std::printf("--- closed-loop convoy ---\n");
+  benchmarkConvoy(follower_nums, param, duration, acc_time_delay, acc_time_constant);
+
+  std::printf("--- node ---\n");
+  benchmarkNode(follower_nums, 200, iteration_num);
+
+  rclcpp::shutdown();
+  return 0;
+}
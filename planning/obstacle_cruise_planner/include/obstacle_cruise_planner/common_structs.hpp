@@ -233,6 +233,58 @@ struct LongitudinalInfo
   double hold_stop_distance_threshold;
 };
 
+struct PlatoonParam
+{
+  PlatoonParam() = default;
+  explicit PlatoonParam(rclcpp::Node & node)
+  {
+    standstill_distance = node.declare_parameter<double>("platooning.standstill_distance");
+    time_headway = node.declare_parameter<double>("platooning.time_headway");
+    kp_gap = node.declare_parameter<double>("platooning.kp_gap");
+    kv_gap = node.declare_parameter<double>("platooning.kv_gap");
+    max_accel = node.declare_parameter<double>("platooning.max_acc");
+    min_accel = node.declare_parameter<double>("platooning.min_acc");
+    max_distance_to_leader = node.declare_parameter<double>("platooning.max_distance_to_leader");
+    velocity_limit_time_horizon =
+      node.declare_parameter<double>("platooning.velocity_limit_time_horizon");
+    lat_lon_desired_distance =
+      node.declare_parameter<double>("platooning.lat_lon.desired_distance");
+  }
+
+  void onParam(const std::vector<rclcpp::Parameter> & parameters)
+  {
+    tier4_autoware_utils::updateParam<double>(
+      parameters, "platooning.standstill_distance", standstill_distance);
+    tier4_autoware_utils::updateParam<double>(parameters, "platooning.time_headway", time_headway);
+    tier4_autoware_utils::updateParam<double>(parameters, "platooning.kp_gap", kp_gap);
+    tier4_autoware_utils::updateParam<double>(parameters, "platooning.kv_gap", kv_gap);
+    tier4_autoware_utils::updateParam<double>(parameters, "platooning.max_acc", max_accel);
+    tier4_autoware_utils::updateParam<double>(parameters, "platooning.min_acc", min_accel);
+    tier4_autoware_utils::updateParam<double>(
+      parameters, "platooning.max_distance_to_leader", max_distance_to_leader);
+    tier4_autoware_utils::updateParam<double>(
+      parameters, "platooning.velocity_limit_time_horizon", velocity_limit_time_horizon);
+    tier4_autoware_utils::updateParam<double>(
+      parameters, "platooning.lat_lon.desired_distance", lat_lon_desired_distance);
+  }
+
+  // constant time headway spacing policy: desired_gap = standstill_distance + time_headway * v
+  double standstill_distance;
+  double time_headway;
+
+  // feedback gains on the gap error and the relative velocity
+  double kp_gap;
+  double kv_gap;
+
+  double max_accel;
+  double min_accel;
+
+  double max_distance_to_leader;
+  double velocity_limit_time_horizon;
+
+  double lat_lon_desired_distance;
+};
+
 struct DebugData
 {
   DebugData() = default;
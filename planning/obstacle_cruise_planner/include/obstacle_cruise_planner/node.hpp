@@ -18,22 +18,28 @@
 #include "obstacle_cruise_planner/common_structs.hpp"
 #include "obstacle_cruise_planner/optimization_based_planner/optimization_based_planner.hpp"
 #include "obstacle_cruise_planner/pid_based_planner/pid_based_planner.hpp"
+#include "obstacle_cruise_planner/platoon_based_planner/platoon_based_planner.hpp"
+#include "obstacle_cruise_planner/polygon_utils.hpp"
 #include "obstacle_cruise_planner/type_alias.hpp"
 #include "signal_processing/lowpass_filter_1d.hpp"
 #include "tier4_autoware_utils/ros/logger_level_configure.hpp"
+#include "tier4_autoware_utils/system/latest_mailbox.hpp"
 #include "tier4_autoware_utils/system/stop_watch.hpp"
 #include "tier4_planning_msgs/msg/platoon_info.hpp" // added
 #include "tier4_planning_msgs/msg/obstacle_info.hpp" // added
 
+#include <latency_aggregator/latency_hop_publisher.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace motion_planning
@@ -55,7 +61,8 @@ private:
     const std::vector<TrajectoryPoint> & traj_points,
     const vehicle_info_util::VehicleInfo & vehicle_info,
     const geometry_msgs::msg::Pose & current_ego_pose, const double lat_margin = 0.0) const;
-  std::vector<Obstacle> convertToObstacles(const std::vector<TrajectoryPoint> & traj_points) const;
+  std::vector<Obstacle> convertToObstacles(const std::vector<TrajectoryPoint> & traj_points);
+  void updateObstacleProjectionCache(const std::vector<TrajectoryPoint> & traj_points);
   std::tuple<std::vector<StopObstacle>, std::vector<CruiseObstacle>, std::vector<SlowDownObstacle>>
   determineEgoBehaviorAgainstObstacles(
     const std::vector<TrajectoryPoint> & traj_points, const std::vector<Obstacle> & obstacles);
@@ -63,6 +70,7 @@ private:
     const std::vector<TrajectoryPoint> & traj_points) const;
   std::optional<StopObstacle> createStopObstacle(
     const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
+    const polygon_utils::TrajectoryPolygonRtree & traj_polys_rtree,
     const Obstacle & obstacle, const double precise_lateral_dist) const;
   bool isStopObstacle(const uint8_t label) const;
   bool isInsideCruiseObstacle(const uint8_t label) const;
@@ -71,15 +79,19 @@ private:
   bool isSlowDownObstacle(const uint8_t label) const;
   std::optional<geometry_msgs::msg::Point> createCollisionPointForStopObstacle(
     const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
+    const polygon_utils::TrajectoryPolygonRtree & traj_polys_rtree,
     const Obstacle & obstacle) const;
   std::optional<CruiseObstacle> createCruiseObstacle(
     const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
+    const polygon_utils::TrajectoryPolygonRtree & traj_polys_rtree,
     const Obstacle & obstacle, const double precise_lat_dist);
   std::optional<std::vector<PointWithStamp>> createCollisionPointsForInsideCruiseObstacle(
     const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
+    const polygon_utils::TrajectoryPolygonRtree & traj_polys_rtree,
     const Obstacle & obstacle) const;
   std::optional<std::vector<PointWithStamp>> createCollisionPointsForOutsideCruiseObstacle(
     const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
+    const polygon_utils::TrajectoryPolygonRtree & traj_polys_rtree,
     const Obstacle & obstacle) const;
   bool isObstacleCrossing(
     const std::vector<TrajectoryPoint> & traj_points, const Obstacle & obstacle) const;
@@ -96,28 +108,22 @@ private:
     const std::vector<TrajectoryPoint> & traj_points, std::vector<StopObstacle> & stop_obstacles);
   void publishVelocityLimit(
     const std::optional<VelocityLimit> & vel_limit, const std::string & module_name);
+  MarkerArray createDebugMarkerArray() const;
   void publishDebugMarker() const;
   void publishDebugInfo() const;
   void publishCalculationTime(const double calculation_time) const;
 
   // added
   void handlePlatoonInfo(const tier4_planning_msgs::msg::PlatoonInfo::SharedPtr msg);
-  void activatePlatooningMethod(
-    const std::vector<TrajectoryPoint> & traj_points,
-    const std::vector<Obstacle> & target_obstacles,
+  std::optional<VelocityLimit> applyPlatooning(
+    const PlannerData & planner_data, const std::vector<CruiseObstacle> & cruise_obstacles,
     const std::optional<VelocityLimit> & cruise_vel_limit);
-  void adjustAcceleration(
-    double &acceleration, 
-    double current_distance_to_front_vehicle, 
-    double desired_distance);
-
-  // added
-
-  void adjustLateralLongitudinalPlatooning(
-    const std::vector<autoware_auto_planning_msgs::msg::TrajectoryPoint> &trajectory_points,
-    int vehicle_index,
-    double diagonal_distance);
-
+  std::optional<CruiseObstacle> findPlatoonLeader(
+    const PlannerData & planner_data, const std::vector<CruiseObstacle> & cruise_obstacles);
+  double calcDistanceToPlatoonLeader(
+    const PlannerData & planner_data, const CruiseObstacle & leader) const;
+  VelocityLimit createPlatoonVelocityLimit(
+    const double current_speed, const double target_acc) const;
   // end
 
   bool isFrontCollideObstacle(
@@ -131,7 +137,6 @@ private:
   double additional_safe_distance_margin_on_curve_;
   double min_safe_distance_margin_on_curve_;
   bool suppress_sudden_obstacle_stop_;
-  bool isPlatooningActive; // added
 
   std::vector<int> stop_obstacle_types_;
   std::vector<int> inside_cruise_obstacle_types_;
@@ -162,9 +167,18 @@ private:
   rclcpp::Subscription<Odometry>::SharedPtr odom_sub_;
   rclcpp::Subscription<AccelWithCovarianceStamped>::SharedPtr acc_sub_;
   rclcpp::Subscription<tier4_planning_msgs::msg::PlatoonInfo>::SharedPtr platoon_info_sub_;
+  rclcpp::Subscription<LeaderState>::SharedPtr leader_state_sub_;
+
+  // end-to-end latency
+  std::unique_ptr<latency_aggregator::LatencyHopPublisher> latency_hop_publisher_;
+
 
+  // latest data written by the subscription callbacks
+  tier4_autoware_utils::LatestMailbox<PredictedObjects> objects_mailbox_;
+  tier4_autoware_utils::LatestMailbox<Odometry> ego_odom_mailbox_;
+  tier4_autoware_utils::LatestMailbox<AccelWithCovarianceStamped> ego_accel_mailbox_;
 
-  // data for callback functions
+  // data used by the current planning cycle, only accessed from onTrajectory
   PredictedObjects::ConstSharedPtr objects_ptr_{nullptr};
   Odometry::ConstSharedPtr ego_odom_ptr_{nullptr};
   AccelWithCovarianceStamped::ConstSharedPtr ego_accel_ptr_{nullptr};
@@ -173,7 +187,7 @@ private:
   VehicleInfo vehicle_info_;
 
   // planning algorithm
-  enum class PlanningAlgorithm { OPTIMIZATION_BASE, PID_BASE, INVALID };
+  enum class PlanningAlgorithm { OPTIMIZATION_BASE, PID_BASE, PLATOON_BASE, INVALID };
   PlanningAlgorithm getPlanningAlgorithmType(const std::string & param) const;
   PlanningAlgorithm planning_algorithm_;
 
@@ -186,10 +200,53 @@ private:
   // planner
   std::unique_ptr<PlannerInterface> planner_ptr_{nullptr};
 
-  // previous obstacles
-  std::vector<StopObstacle> prev_stop_obstacles_;
-  std::vector<CruiseObstacle> prev_cruise_obstacles_;
-  std::vector<SlowDownObstacle> prev_slow_down_obstacles_;
+  // decisions of the previous cycle indexed by obstacle uuid, which are looked up once for each
+  // obstacle to apply the hysteresis of the stop, cruise and slow down decisions
+  struct ObstacleDecisionTable
+  {
+    enum Decision : uint8_t { STOP = 1U << 0U, CRUISE = 1U << 1U, SLOW_DOWN = 1U << 2U };
+
+    explicit ObstacleDecisionTable(const size_t capacity) { decisions_.reserve(capacity); }
+    // NOTE: clear() keeps the buckets, so the table is not rehashed every cycle.
+    void clear() { decisions_.clear(); }
+    template <typename T>
+    void add(const std::vector<T> & obstacles, const Decision decision)
+    {
+      for (const auto & obstacle : obstacles) {
+        decisions_[obstacle.uuid] |= decision;
+      }
+    }
+    bool has(const std::string & uuid, const Decision decision) const
+    {
+      const auto itr = decisions_.find(uuid);
+      return itr != decisions_.end() && (itr->second & decision) != 0U;
+    }
+
+    std::unordered_map<std::string, uint8_t> decisions_;
+  };
+  ObstacleDecisionTable prev_obstacle_decisions_{256};
+
+  // projection of each object onto the trajectory, which is reused while neither the object nor
+  // the trajectory part around the projection has moved since the last cycle
+  struct ObstacleProjection
+  {
+    geometry_msgs::msg::Point position;
+    size_t nearest_idx;
+    double lat_offset;
+  };
+  std::unordered_map<std::string, ObstacleProjection> obstacle_projection_cache_;
+  std::vector<TrajectoryPoint> prev_traj_points_for_projection_cache_;
+
+  // one step polygons for each lateral margin, which are reused in the same cycle, and partially
+  // reused in the next cycle for the points which do not depend on the ego pose
+  struct OneStepPolygonCache
+  {
+    std::vector<geometry_msgs::msg::Pose> traj_poses;
+    geometry_msgs::msg::Pose ego_pose;
+    std::vector<Polygon2d> polygons;
+    std::vector<bool> is_ego_pose_independent;
+  };
+  mutable std::map<double, OneStepPolygonCache> one_step_polygon_cache_;
 
   // behavior determination parameter
   struct BehaviorDeterminationParam
@@ -231,27 +288,29 @@ private:
   };
   BehaviorDeterminationParam behavior_determination_param_;
 
+  PlatoonParam platoon_param_;
+
+  // platooning state latched by the platoon info
+  enum class PlatoonMode { NONE, LONGITUDINAL, LAT_LON };
+  PlatoonMode platoon_mode_{PlatoonMode::NONE};
+  std::optional<std::string> platoon_leader_uuid_{std::nullopt};
+
   std::unordered_map<std::string, bool> need_to_clear_vel_limit_{
     {"cruise", false}, {"slow_down", false}};
 
   struct SlowDownConditionCounter
   {
     void resetCurrentUuids() { current_uuids_.clear(); }
-    void addCurrentUuid(const std::string & uuid) { current_uuids_.push_back(uuid); }
+    void addCurrentUuid(const std::string & uuid) { current_uuids_.insert(uuid); }
     void removeCounterUnlessUpdated()
     {
-      std::vector<std::string> obsolete_uuids;
-      for (const auto & key_and_value : counter_) {
-        if (
-          std::find(current_uuids_.begin(), current_uuids_.end(), key_and_value.first) ==
-          current_uuids_.end()) {
-          obsolete_uuids.push_back(key_and_value.first);
+      for (auto itr = counter_.begin(); itr != counter_.end();) {
+        if (current_uuids_.count(itr->first) == 0) {
+          itr = counter_.erase(itr);
+        } else {
+          ++itr;
         }
       }
-
-      for (const auto & obsolete_uuid : obsolete_uuids) {
-        counter_.erase(obsolete_uuid);
-      }
     }
 
     int increaseCounter(const std::string & uuid)
@@ -276,7 +335,7 @@ private:
 
     // NOTE: positive is for meeting entering condition, and negative is for exiting.
     std::unordered_map<std::string, int> counter_;
-    std::vector<std::string> current_uuids_;
+    std::unordered_set<std::string> current_uuids_;
   };
   SlowDownConditionCounter slow_down_condition_counter_;
 
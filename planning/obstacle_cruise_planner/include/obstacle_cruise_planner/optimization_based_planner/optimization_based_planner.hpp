@@ -57,17 +57,19 @@ private:
     const PlannerData & planner_data, const std::vector<TrajectoryPoint> & stop_traj_points,
     const std::vector<CruiseObstacle> & obstacles, const std::vector<double> & time_vec);
 
-  std::optional<SBoundaries> getSBoundaries(
+  // the s boundaries are lowered in place, so that no boundary is allocated per obstacle
+  void updateSBoundaries(
     const PlannerData & planner_data, const std::vector<TrajectoryPoint> & stop_traj_points,
-    const CruiseObstacle & object, const std::vector<double> & time_vec, const double traj_length);
+    const CruiseObstacle & object, const std::vector<double> & time_vec,
+    SBoundaries & s_boundaries);
 
-  std::optional<SBoundaries> getSBoundariesForOnTrajectoryObject(
+  void updateSBoundariesForOnTrajectoryObject(
     const PlannerData & planner_data, const std::vector<double> & time_vec,
-    const double safety_distance, const CruiseObstacle & object, const double traj_length);
+    const double safety_distance, const CruiseObstacle & object, SBoundaries & s_boundaries);
 
-  std::optional<SBoundaries> getSBoundariesForOffTrajectoryObject(
+  void updateSBoundariesForOffTrajectoryObject(
     const PlannerData & planner_data, const std::vector<double> & time_vec,
-    const double safety_distance, const CruiseObstacle & object, const double traj_length);
+    const double safety_distance, const CruiseObstacle & object, SBoundaries & s_boundaries);
 
   bool checkOnTrajectory(
     const PlannerData & planner_data, const std::vector<TrajectoryPoint> & stop_traj_points,
@@ -87,6 +89,8 @@ private:
     const SBoundaries & s_boundaries, const VelocityOptimizer::OptimizationResult & opt_result);
 
   std::vector<TrajectoryPoint> prev_output_;
+  std::optional<rclcpp::Time> prev_optimization_time_;
+  std::vector<double> time_vec_;
 
   // Velocity Optimizer
   std::shared_ptr<VelocityOptimizer> velocity_optimizer_ptr_;
@@ -116,6 +120,7 @@ private:
   double engage_acceleration_;
   double engage_exit_ratio_;
   double stop_dist_to_prohibit_engage_;
+  bool enable_warm_start_;
 };
 
 #endif  // OBSTACLE_CRUISE_PLANNER__OPTIMIZATION_BASED_PLANNER__OPTIMIZATION_BASED_PLANNER_HPP_
@@ -40,6 +40,9 @@ public:
     double t_dangerous;
     double idling_time;
     SBoundaries s_boundary;
+    // time elapsed since the previous optimization, used to shift the previous solution for warm
+    // start
+    double time_shift{0.0};
   };
 
   struct OptimizationResult
@@ -56,7 +59,13 @@ public:
     const double over_s_ideal_weight, const double over_v_weight, const double over_a_weight,
     const double over_j_weight);
 
-  OptimizationResult optimize(const OptimizationData & data);
+  // With warm start, the QP workspace is kept while the time vector does not change, so that only
+  // the values of the matrices and vectors are updated, and the previous solution shifted by
+  // data.time_shift is used as an initial guess.
+  OptimizationResult optimize(const OptimizationData & data, const bool enable_warm_start = false);
+
+  // discard the solution kept for warm start (e.g. when the target obstacle changes)
+  void resetWarmStart();
 
 private:
   // Parameter
@@ -70,6 +79,12 @@ private:
 
   // QPSolver
   autoware::common::osqp::OSQPInterface qp_solver_;
+
+  // previous solution used for warm start
+  std::vector<double> prev_primal_solution_;
+  std::vector<double> prev_dual_solution_;
+  // time vector of the problem kept in the QP workspace, empty if the workspace is not reusable
+  std::vector<double> prev_time_vec_;
 };
 
 #endif  // OBSTACLE_CRUISE_PLANNER__OPTIMIZATION_BASED_PLANNER__VELOCITY_OPTIMIZER_HPP_
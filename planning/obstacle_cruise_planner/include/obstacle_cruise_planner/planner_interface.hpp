@@ -157,6 +157,9 @@ protected:
   {
   }
 
+  // leader's state received via V2V, which is used only by the planner supporting platooning
+  virtual void setLeaderState([[maybe_unused]] const LeaderState & leader_state) {}
+
   size_t findEgoIndex(
     const std::vector<TrajectoryPoint> & traj_points,
     const geometry_msgs::msg::Pose & ego_pose) const
@@ -314,7 +317,10 @@ private:
   };
   SlowDownParam slow_down_param_;
 
-  std::vector<SlowDownOutput> prev_slow_down_output_;
+  // indexed by obstacle uuid, and swapped with the outputs of the current cycle so that both of
+  // the tables keep their buckets
+  std::unordered_map<std::string, SlowDownOutput> prev_slow_down_output_;
+  std::unordered_map<std::string, SlowDownOutput> new_prev_slow_down_output_;
   // previous trajectory and distance to stop
   // NOTE: Previous trajectory is memorized to deal with nearest index search for overlapping or
   // crossing lanes.
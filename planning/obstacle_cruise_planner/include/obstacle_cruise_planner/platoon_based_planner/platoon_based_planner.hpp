@@ -0,0 +1,103 @@
+// Copyright 2022 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OBSTACLE_CRUISE_PLANNER__PLATOON_BASED_PLANNER__PLATOON_BASED_PLANNER_HPP_
+#define OBSTACLE_CRUISE_PLANNER__PLATOON_BASED_PLANNER__PLATOON_BASED_PLANNER_HPP_
+
+#include "obstacle_cruise_planner/optimization_based_planner/s_boundary.hpp"
+#include "obstacle_cruise_planner/optimization_based_planner/velocity_optimizer.hpp"
+#include "obstacle_cruise_planner/planner_interface.hpp"
+#include "obstacle_cruise_planner/type_alias.hpp"
+#include "vehicle_info_util/vehicle_info_util.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+class PlatoonBasedPlanner : public PlannerInterface
+{
+public:
+  PlatoonBasedPlanner(
+    rclcpp::Node & node, const LongitudinalInfo & longitudinal_info,
+    const vehicle_info_util::VehicleInfo & vehicle_info, const EgoNearestParam & ego_nearest_param,
+    const std::shared_ptr<DebugData> debug_data_ptr);
+
+  std::vector<TrajectoryPoint> generateCruiseTrajectory(
+    const PlannerData & planner_data, const std::vector<TrajectoryPoint> & stop_traj_points,
+    const std::vector<CruiseObstacle> & obstacles,
+    std::optional<VelocityLimit> & vel_limit) override;
+
+  void updateCruiseParam(const std::vector<rclcpp::Parameter> & parameters) override;
+
+  // leader's state reported by itself, which is preferred to the estimated one
+  void setLeaderState(const LeaderState & leader_state) override;
+
+private:
+  struct LeaderInfo
+  {
+    double dist_to_leader;  // from ego's front to leader's back
+    double velocity;
+    // piecewise constant acceleration every acc_time_interval, the last one is kept afterwards
+    std::vector<double> planned_acc;
+    double acc_time_interval;
+  };
+
+  struct TrackedLeaderState
+  {
+    std::string uuid;
+    rclcpp::Time stamp;
+    double velocity;
+    double acceleration;
+  };
+
+  std::vector<double> createTimeVector() const;
+
+  std::optional<LeaderInfo> calcLeaderInfo(
+    const PlannerData & planner_data, const std::vector<CruiseObstacle> & obstacles);
+  double estimateLeaderAcceleration(const CruiseObstacle & leader);
+  bool isLeaderStateFresh(const rclcpp::Time & current_time) const;
+
+  SBoundaries calcSBoundaries(
+    const LeaderInfo & leader_info, const std::vector<double> & time_vec) const;
+
+  std::optional<VelocityLimit> createVelocityLimit(
+    const PlannerData & planner_data, const VelocityOptimizer::OptimizationResult & opt_result);
+
+  void reset();
+
+  // Velocity Optimizer
+  std::shared_ptr<VelocityOptimizer> velocity_optimizer_ptr_;
+
+  // leader state kept over the planning cycles
+  std::optional<TrackedLeaderState> prev_leader_state_;
+  std::optional<LeaderState> reported_leader_state_;
+  std::optional<rclcpp::Time> prev_optimization_time_;
+
+  // Parameter
+  double dense_resampling_time_interval_;
+  double sparse_resampling_time_interval_;
+  double dense_time_horizon_;
+  double max_time_horizon_;
+  double time_headway_;
+  double standstill_distance_;
+  double leader_acc_lpf_gain_;
+  double leader_state_timeout_;
+  double velocity_limit_time_horizon_;
+  bool enable_warm_start_;
+};
+
+#endif  // OBSTACLE_CRUISE_PLANNER__PLATOON_BASED_PLANNER__PLATOON_BASED_PLANNER_HPP_
@@ -21,6 +21,7 @@
 #include "vehicle_info_util/vehicle_info_util.hpp"
 
 #include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
 
 #include <limits>
 #include <optional>
@@ -30,14 +31,27 @@
 namespace polygon_utils
 {
 namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+using tier4_autoware_utils::Box2d;
 using tier4_autoware_utils::Point2d;
 using tier4_autoware_utils::Polygon2d;
 
+// bounding boxes of the trajectory polygons with their indices
+using TrajectoryPolygonRtree = bgi::rtree<std::pair<Box2d, size_t>, bgi::rstar<16>>;
+
 Polygon2d createOneStepPolygon(
   const std::vector<geometry_msgs::msg::Pose> & last_poses,
   const std::vector<geometry_msgs::msg::Pose> & current_poses,
   const vehicle_info_util::VehicleInfo & vehicle_info, const double lat_margin);
 
+// NOTE: The rtree is built with the packing algorithm, and should be built only once per cycle.
+TrajectoryPolygonRtree createTrajectoryPolygonRtree(const std::vector<Polygon2d> & traj_polygons);
+
+// minimum distance between each obstacle polygon and the trajectory polygons
+std::vector<double> calcDistancesToTrajectoryPolygons(
+  const std::vector<Polygon2d> & traj_polygons, const TrajectoryPolygonRtree & traj_polygon_rtree,
+  const std::vector<Polygon2d> & obstacle_polygons);
+
 std::optional<geometry_msgs::msg::Point> getCollisionPoint(
   const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons,
   const Obstacle & obstacle, const bool is_driving_forward);
@@ -50,6 +64,14 @@ std::vector<PointWithStamp> getCollisionPoints(
   const double max_lat_dist = std::numeric_limits<double>::max(),
   const double max_prediction_time_for_collision_check = std::numeric_limits<double>::max());
 
+std::vector<PointWithStamp> getCollisionPoints(
+  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons,
+  const TrajectoryPolygonRtree & traj_polygon_rtree, const rclcpp::Time & obstacle_stamp,
+  const PredictedPath & predicted_path, const Shape & shape, const rclcpp::Time & current_time,
+  const bool is_driving_forward, std::vector<size_t> & collision_index,
+  const double max_lat_dist = std::numeric_limits<double>::max(),
+  const double max_prediction_time_for_collision_check = std::numeric_limits<double>::max());
+
 }  // namespace polygon_utils
 
 #endif  // OBSTACLE_CRUISE_PLANNER__POLYGON_UTILS_HPP_
@@ -18,6 +18,7 @@
 #include "vehicle_info_util/vehicle_info_util.hpp"
 
 #include "autoware_adapi_v1_msgs/msg/velocity_factor_array.hpp"
+#include "obstacle_cruise_planner/msg/leader_state.hpp"
 #include "autoware_auto_perception_msgs/msg/predicted_object.hpp"
 #include "autoware_auto_perception_msgs/msg/predicted_objects.hpp"
 #include "autoware_auto_planning_msgs/msg/trajectory.hpp"
@@ -47,6 +48,7 @@ using geometry_msgs::msg::AccelStamped;
 using geometry_msgs::msg::AccelWithCovarianceStamped;
 using geometry_msgs::msg::Twist;
 using nav_msgs::msg::Odometry;
+using obstacle_cruise_planner::msg::LeaderState;
 using tier4_debug_msgs::msg::Float32Stamped;
 using tier4_planning_msgs::msg::StopFactor;
 using tier4_planning_msgs::msg::StopReason;
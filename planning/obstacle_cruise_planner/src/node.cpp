@@ -20,6 +20,7 @@
 #include "obstacle_cruise_planner/polygon_utils.hpp"
 #include "obstacle_cruise_planner/utils.hpp"
 #include "tier4_autoware_utils/geometry/boost_polygon_utils.hpp"
+#include "tier4_autoware_utils/ros/debug_publisher.hpp"
 #include "tier4_autoware_utils/ros/marker_helper.hpp"
 #include "tier4_autoware_utils/ros/update_param.hpp"
 
@@ -28,10 +29,8 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
-
-bool isPlatooningActive = false; // added
-bool isLLPlatooningActive = false; // added
-const double platooningDistance = 3.0; // added
+#include <memory>
+#include <utility>
 
 namespace
 {
@@ -61,10 +60,8 @@ std::optional<T> getObstacleFromUuid(
 
 bool isFrontObstacle(
   const std::vector<TrajectoryPoint> & traj_points, const size_t ego_idx,
-  const geometry_msgs::msg::Point & obstacle_pos)
+  const size_t obstacle_idx)
 {
-  const size_t obstacle_idx = motion_utils::findNearestIndex(traj_points, obstacle_pos);
-
   const double ego_to_obstacle_distance =
     motion_utils::calcSignedArcLength(traj_points, ego_idx, obstacle_idx);
 
@@ -89,6 +86,33 @@ PredictedPath resampleHighestConfidencePredictedPath(
     *reliable_path, time_interval, time_horizon);
 }
 
+// first index from which the trajectory differs from the previous one
+size_t findFirstChangedTrajectoryIndex(
+  const std::vector<TrajectoryPoint> & traj_points,
+  const std::vector<TrajectoryPoint> & prev_traj_points)
+{
+  constexpr double epsilon = 1e-3;
+  const size_t min_size = std::min(traj_points.size(), prev_traj_points.size());
+  for (size_t i = 0; i < min_size; ++i) {
+    const double dist =
+      tier4_autoware_utils::calcDistance2d(traj_points.at(i), prev_traj_points.at(i));
+    if (epsilon < dist) {
+      return i;
+    }
+  }
+  return min_size;
+}
+
+bool isSamePose(const geometry_msgs::msg::Pose & pose1, const geometry_msgs::msg::Pose & pose2)
+{
+  constexpr double epsilon = 1e-6;
+  const auto & q1 = pose1.orientation;
+  const auto & q2 = pose2.orientation;
+  return tier4_autoware_utils::calcDistance2d(pose1, pose2) < epsilon &&
+         std::abs(q1.x - q2.x) < epsilon && std::abs(q1.y - q2.y) < epsilon &&
+         std::abs(q1.z - q2.z) < epsilon && std::abs(q1.w - q2.w) < epsilon;
+}
+
 double calcDiffAngleAgainstTrajectory(
   const std::vector<TrajectoryPoint> & traj_points, const geometry_msgs::msg::Pose & target_pose)
 {
@@ -358,30 +382,41 @@ ObstacleCruisePlannerNode::ObstacleCruisePlannerNode(const rclcpp::NodeOptions &
   using std::placeholders::_1;
   
   // added
-  platoon_info_sub_ = this->create_subscription<tier4_planning_msgs::msg::PlatoonInfo>(
-    "~input/platoon_info", 10, [this](const tier4_planning_msgs::msg::PlatoonInfo::SharedPtr msg) {
-    this->handlePlatoonInfo(msg);
-  });
+  platoon_info_sub_ = create_subscription<tier4_planning_msgs::msg::PlatoonInfo>(
+    "~/input/platoon_info", rclcpp::QoS{1},
+    std::bind(&ObstacleCruisePlannerNode::handlePlatoonInfo, this, _1));
   traj_sub_ = create_subscription<Trajectory>(
     "~/input/trajectory", rclcpp::QoS{1},
     std::bind(&ObstacleCruisePlannerNode::onTrajectory, this, _1));
   objects_sub_ = create_subscription<PredictedObjects>(
     "~/input/objects", rclcpp::QoS{1},
-    [this](const PredictedObjects::ConstSharedPtr msg) { objects_ptr_ = msg; });
+    [this](const PredictedObjects::ConstSharedPtr msg) { objects_mailbox_.store(msg); });
   odom_sub_ = create_subscription<Odometry>(
     "~/input/odometry", rclcpp::QoS{1},
-    [this](const Odometry::ConstSharedPtr msg) { ego_odom_ptr_ = msg; });
+    [this](const Odometry::ConstSharedPtr msg) { ego_odom_mailbox_.store(msg); });
   acc_sub_ = create_subscription<AccelWithCovarianceStamped>(
     "~/input/acceleration", rclcpp::QoS{1},
-    [this](const AccelWithCovarianceStamped::ConstSharedPtr msg) { ego_accel_ptr_ = msg; });
+    [this](const AccelWithCovarianceStamped::ConstSharedPtr msg) {
+      ego_accel_mailbox_.store(msg);
+    });
+  // NOTE: The leader state is received with UniquePtr so that it is moved without copy with the
+  //       intra-process communication. Only the latest state matters, and a late one is useless.
+  leader_state_sub_ = create_subscription<LeaderState>(
+    "~/input/leader_state", rclcpp::QoS{1}.best_effort(),
+    [this](LeaderState::UniquePtr msg) { planner_ptr_->setLeaderState(*msg); });
 
   // publisher
   obstacle_info_pub_ = this->create_publisher<tier4_planning_msgs::msg::ObstacleInfo>("obstacle_info_topic", 10); // added
   trajectory_pub_ = create_publisher<Trajectory>("~/output/trajectory", 1);
-  vel_limit_pub_ =
-    create_publisher<VelocityLimit>("~/output/velocity_limit", rclcpp::QoS{1}.transient_local());
+  latency_hop_publisher_ = std::make_unique<latency_aggregator::LatencyHopPublisher>(
+    this, trajectory_pub_->get_topic_name());
+  // NOTE: The intra-process communication supports only volatile topics.
+  rclcpp::PublisherOptions durable_pub_options;
+  durable_pub_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  vel_limit_pub_ = create_publisher<VelocityLimit>(
+    "~/output/velocity_limit", rclcpp::QoS{1}.transient_local(), durable_pub_options);
   clear_vel_limit_pub_ = create_publisher<VelocityLimitClearCommand>(
-    "~/output/clear_velocity_limit", rclcpp::QoS{1}.transient_local());
+    "~/output/clear_velocity_limit", rclcpp::QoS{1}.transient_local(), durable_pub_options);
 
   // debug publisher
   debug_calculation_time_pub_ = create_publisher<Float32Stamped>("~/debug/processing_time_ms", 1);
@@ -406,6 +441,7 @@ ObstacleCruisePlannerNode::ObstacleCruisePlannerNode(const rclcpp::NodeOptions &
   enable_slow_down_planning_ = declare_parameter<bool>("common.enable_slow_down_planning");
 
   behavior_determination_param_ = BehaviorDeterminationParam(*this);
+  platoon_param_ = PlatoonParam(*this);
 
   {  // planning algorithm
     const std::string planning_algorithm_param =
@@ -418,6 +454,9 @@ ObstacleCruisePlannerNode::ObstacleCruisePlannerNode(const rclcpp::NodeOptions &
     } else if (planning_algorithm_ == PlanningAlgorithm::PID_BASE) {
       planner_ptr_ = std::make_unique<PIDBasedPlanner>(
         *this, longitudinal_info, vehicle_info_, ego_nearest_param_, debug_data_ptr_);
+    } else if (planning_algorithm_ == PlanningAlgorithm::PLATOON_BASE) {
+      planner_ptr_ = std::make_unique<PlatoonBasedPlanner>(
+        *this, longitudinal_info, vehicle_info_, ego_nearest_param_, debug_data_ptr_);
     } else {
       std::logic_error("Designated algorithm is not supported.");
     }
@@ -460,6 +499,8 @@ ObstacleCruisePlannerNode::PlanningAlgorithm ObstacleCruisePlannerNode::getPlann
     return PlanningAlgorithm::PID_BASE;
   } else if (param == "optimization_base") {
     return PlanningAlgorithm::OPTIMIZATION_BASE;
+  } else if (param == "platoon_base") {
+    return PlanningAlgorithm::PLATOON_BASE;
   }
   return PlanningAlgorithm::INVALID;
 }
@@ -492,6 +533,9 @@ rcl_interfaces::msg::SetParametersResult ObstacleCruisePlannerNode::onParam(
     parameters, "common.enable_slow_down_planning", enable_slow_down_planning_);
 
   behavior_determination_param_.onParam(parameters);
+  platoon_param_.onParam(parameters);
+  // NOTE: the polygons depend on the behavior determination parameters
+  one_step_polygon_cache_.clear();
 
   rcl_interfaces::msg::SetParametersResult result;
   result.successful = true;
@@ -503,265 +547,139 @@ rcl_interfaces::msg::SetParametersResult ObstacleCruisePlannerNode::onParam(
 void ObstacleCruisePlannerNode::handlePlatoonInfo(
   const tier4_planning_msgs::msg::PlatoonInfo::SharedPtr msg)
 {
-  // Assuming TrajectoryPoint, Obstacle, and VelocityLimit are the correct types
-    std::vector<autoware_auto_planning_msgs::msg::TrajectoryPoint_<std::allocator<void>>> slow_down_traj_points;
-    std::vector<Obstacle> target_obstacles;
-    std::optional<tier4_planning_msgs::msg::VelocityLimit_<std::allocator<void>>> cruise_vel_limit;
-    
-  // Extract information from the PlatoonInfo message and incorporate it into your logic
-  // For example:
-  if (msg->platoon_info == "platooning") {
-    // Activate platooning logic
-    RCLCPP_INFO(this->get_logger(), "Handling Platoon Info: Activate platooning logic");
-    isPlatooningActive = true;
-    activatePlatooningMethod(slow_down_traj_points, target_obstacles, cruise_vel_limit);
-  } else if (msg->platoon_info == "ll_platooning") {
-    RCLCPP_INFO(this->get_logger(), "Handling Platoon Info: Activate ll platooning logic");
-    isLLPlatooningActive = true;
-    adjustLateralLongitudinalPlatooning(slow_down_traj_points, 2, platooningDistance);
-  } else {
-    RCLCPP_INFO(this->get_logger(), "Handling Platoon Info: skip platooning logic");
-    isPlatooningActive = false;
-    activatePlatooningMethod(slow_down_traj_points, target_obstacles, cruise_vel_limit);
+  // NOTE: Only the platooning mode is latched here. The gap keeping itself is calculated in
+  //       onTrajectory with the current trajectory and cruise obstacles.
+  const auto platoon_mode = [&]() {
+    if (msg->platoon_info == "platooning") {
+      return PlatoonMode::LONGITUDINAL;
+    } else if (msg->platoon_info == "ll_platooning") {
+      return PlatoonMode::LAT_LON;
+    }
+    return PlatoonMode::NONE;
+  }();
+
+  if (platoon_mode != platoon_mode_) {
+    RCLCPP_INFO(
+      get_logger(), "Handling Platoon Info: switch platooning mode to %s",
+      msg->platoon_info.c_str());
+    platoon_leader_uuid_ = std::nullopt;
   }
+  platoon_mode_ = platoon_mode;
 }
 
 // added
-void ObstacleCruisePlannerNode::activatePlatooningMethod(
-  const std::vector<TrajectoryPoint> & traj_points,
-  const std::vector<Obstacle> & target_obstacles,
-  const std::optional<VelocityLimit> & cruise_vel_limit)
+std::optional<CruiseObstacle> ObstacleCruisePlannerNode::findPlatoonLeader(
+  const PlannerData & planner_data, const std::vector<CruiseObstacle> & cruise_obstacles)
 {
-  // 1. Check if platooning is active
-  if (!isPlatooningActive) {
-    return; 
+  if (cruise_obstacles.empty()) {
+    platoon_leader_uuid_ = std::nullopt;
+    return std::nullopt;
   }
 
-  // 2. Check if there are any obstacles
-  if (target_obstacles.empty()) {
-    return; // do nothing
+  // keep following the latched leader while it is a cruise obstacle
+  if (platoon_leader_uuid_) {
+    const auto latched_leader = getObstacleFromUuid(cruise_obstacles, *platoon_leader_uuid_);
+    if (latched_leader) {
+      return latched_leader;
+    }
   }
 
-  // 3. Get the position of the ego vehicle
-  const auto ego_pose = traj_points.back().pose.position;
-
-  // 4. Find the closest obstacle in front of the ego
-  const auto front_obstacle_itr = std::min_element(
-    target_obstacles.begin(), target_obstacles.end(),
-    [&](const Obstacle & a, const Obstacle & b) {
-      return a.pose.position.x < b.pose.position.x;
+  // latch the closest cruise obstacle along the trajectory as a new leader
+  const auto leader_itr = std::min_element(
+    cruise_obstacles.begin(), cruise_obstacles.end(), [&](const auto & a, const auto & b) {
+      return calcDistanceToPlatoonLeader(planner_data, a) <
+             calcDistanceToPlatoonLeader(planner_data, b);
     });
-
-  if (front_obstacle_itr == target_obstacles.end()) {
-    return; // do nothing
-  }
-
-  const auto & front_obstacle = *front_obstacle_itr;
-
-  // Calculate the desired distance to maintain from the front vehicle
-  const double desired_distance = platooningDistance;
-
-  // Check if odometry data is available
-  if (!ego_odom_ptr_) {
-    RCLCPP_WARN(get_logger(), "Odometry data is not available.");
-    return;
-  }
-
-  // Calculate current speed from odometry data
-  double current_speed = std::hypot(
-    ego_odom_ptr_->twist.twist.linear.x,
-    ego_odom_ptr_->twist.twist.linear.y);
-
-  // Calculate the distance to the front vehicle
-  double distance_to_front_obstacle = std::hypot(
-    front_obstacle.pose.position.x - ego_pose.x,
-    front_obstacle.pose.position.y - ego_pose.y);
-
-  if (distance_to_front_obstacle >= 100.0) {
-    // Distance is too great; skip platooning or take other actions
-    return;
-    RCLCPP_INFO(this->get_logger(), "Distance is too great");
-  }
-
-  // Calculate the current distance to the front vehicle
-  const double current_distance_to_front_vehicle = std::hypot(
-    front_obstacle.pose.position.x - ego_pose.x,
-    front_obstacle.pose.position.y - ego_pose.y);
-
-
-  // Calculate the speed difference between the ego vehicle and the front vehicle
-  const double speed_difference = current_speed - front_obstacle.twist.linear.x;
-
-  const double delta_time = 0.1;  // Time step in seconds
-  
-  double diff = distance_to_front_obstacle - desired_distance;
-  // 6. Control Adjust acceleration based on the distance and speed difference
-  while(diff > 0.0 || diff < 0.0){
-      double acceleration = 0.0;
-      if (distance_to_front_obstacle < desired_distance) {
-        // Too close, decelerate to increase distance
-        acceleration = -0.5;  // Adjust as needed
-      } else if (distance_to_front_obstacle > desired_distance) {
-        // Too far, accelerate to decrease distance
-        acceleration = 0.5;  // Adjust as needed
-      }
-      // Adjust acceleration based on speed difference
-      adjustAcceleration(acceleration, current_distance_to_front_vehicle, desired_distance);
-      // Calculate speed change
-      current_speed += acceleration * delta_time;
-      // Calculate position change
-      double delta_position = current_speed * delta_time + 0.5 * acceleration * delta_time * delta_time;
-      // Update distance to front vehicle
-      // This assumes the front vehicle is either static or moving at a constant speed
-      distance_to_front_obstacle -= delta_position;
-  }
-
-  // Pub obs info at the end of activatePlatooningMethod
-  auto obstacle_info_msg = tier4_planning_msgs::msg::ObstacleInfo();
-  obstacle_info_msg.current_speed = current_speed; // Already calculated in this function
-  obstacle_info_msg.distance_to_front_obstacle = distance_to_front_obstacle; // Already calculated
-  obstacle_info_msg.diff = 0.0; // Not applicable in this context, set to 0 or a default value
-
-  obstacle_info_pub_->publish(obstacle_info_msg);
-
+  platoon_leader_uuid_ = leader_itr->uuid;
+  return *leader_itr;
 }
 
 // added
-void ObstacleCruisePlannerNode::adjustAcceleration(double &acceleration, double current_distance_to_front_vehicle, double desired_distance) {
-  // Constants
-  const double max_acceleration = 4.0; // Maximum allowed acceleration (m/s^2)
-  const double max_deceleration = -2.0; // Maximum allowed deceleration (m/s^2)
-  const double reaction_time = 1.0; // Reaction time in seconds
-  double current_speed = std::hypot(
-    ego_odom_ptr_->twist.twist.linear.x,
-    ego_odom_ptr_->twist.twist.linear.y);
-  const double time_interval = 0.1; // Time step in seconds
-
-  // Compute the distance difference
-  double distance_diff = current_distance_to_front_vehicle - desired_distance;
-
-    // Calculate desired acceleration or deceleration
-    if (distance_diff < 0) {
-        // Too close, need to decelerate
-        RCLCPP_INFO(this->get_logger(), "Too close, need to decelerate: distance_to_front_obstacle %f: ", current_distance_to_front_vehicle);
-        acceleration = max_deceleration * distance_diff / desired_distance;
-    } else if (distance_diff > 0) {
-        // Too far, can accelerate
-        RCLCPP_INFO(this->get_logger(), "Too far, need to decelerate: distance_to_front_obstacle %f: ", current_distance_to_front_vehicle);
-        acceleration = max_acceleration * distance_diff / desired_distance;
-    } else {
-        // Distance is ideal, maintain current speed
-        RCLCPP_INFO(this->get_logger(), "distance_to_front_obstacle %f: ", current_distance_to_front_vehicle);
-        acceleration = 0.0;
-    }
-
-    // Adjust for reaction time (if needed)
-    acceleration *= reaction_time;
-
-    // Ensure acceleration is within bounds
-    acceleration = std::min(max_acceleration, std::max(max_deceleration, acceleration));
-
-    // Calculate new speed based on acceleration
-    double new_speed = current_speed + acceleration * time_interval;
-
-    // Create a VelocityLimit object with the new speed
-    VelocityLimit new_velocity_limit;
-    new_velocity_limit.max_velocity = new_speed;
-
-    // Publish the new velocity limit
-    publishVelocityLimit(std::optional<VelocityLimit>(new_velocity_limit), "cruise");
+double ObstacleCruisePlannerNode::calcDistanceToPlatoonLeader(
+  const PlannerData & planner_data, const CruiseObstacle & leader) const
+{
+  const double dist_to_collision_point = motion_utils::calcSignedArcLength(
+    planner_data.traj_points, planner_data.ego_pose.position,
+    leader.collision_points.front().point);
+  return dist_to_collision_point - std::abs(vehicle_info_.max_longitudinal_offset_m);
 }
 
 // added
+std::optional<VelocityLimit> ObstacleCruisePlannerNode::applyPlatooning(
+  const PlannerData & planner_data, const std::vector<CruiseObstacle> & cruise_obstacles,
+  const std::optional<VelocityLimit> & cruise_vel_limit)
+{
+  // 1. Check if platooning is active
+  if (platoon_mode_ == PlatoonMode::NONE) {
+    return cruise_vel_limit;
+  }
 
-void ObstacleCruisePlannerNode::adjustLateralLongitudinalPlatooning(
-    const std::vector<autoware_auto_planning_msgs::msg::TrajectoryPoint> &trajectory_points,
-    int vehicle_index,
-    double diagonal_distance) {
-    
-    // Constants for lateral and longitudinal spacing
-    const double lateral_spacing = platooningDistance;  // meters
-    const double longitudinal_spacing = 3.0;  // meters
-
-    // 1. Check if lateral-longitudinal (LL) platooning is active
-    if (!isLLPlatooningActive) {
-      return;
-    }
-
-    // Ensure there is at least one vehicle ahead in the platoon
-    if (trajectory_points.size() < 2) {
-        RCLCPP_INFO(this->get_logger(), "Not enough vehicles for platooning.");
-        return;
-    }
-
-    // 2. Get the position of the ego vehicle
-    const auto ego_pose = trajectory_points.back().pose.position;
-
-    // 3. Get the position of the next vehicle ahead of the ego vehicle
-    const auto next_vehicle_pose = trajectory_points[trajectory_points.size() - 2].pose.position;
-
-    // 4. Calculate the lateral and longitudinal distances between ego and the next vehicle
-    double lateral_distance = next_vehicle_pose.y - ego_pose.y;
-    double longitudinal_distance = next_vehicle_pose.x - ego_pose.x;
-
-    // 5. Calculate the diagonal distance (hypotenuse) using the Pythagorean theorem
-    double calculated_diagonal_distance = std::sqrt(std::pow(lateral_distance, 2) + std::pow(longitudinal_distance, 2));
-
-    // Calculate current speed from odometry data
-    double current_speed = std::hypot(
-        ego_odom_ptr_->twist.twist.linear.x,
-        ego_odom_ptr_->twist.twist.linear.y);
+  // 2. Find the leader among the cruise obstacles
+  const auto leader = findPlatoonLeader(planner_data, cruise_obstacles);
+  if (!leader) {
+    return cruise_vel_limit;
+  }
 
-    if (calculated_diagonal_distance >= 100.0) {
-      RCLCPP_INFO(this->get_logger(), "Distance is too great");
-      // Distance is too great; skip platooning or take other actions
-      return;
+  // 3. Calculate the gap to the leader
+  const auto & p = platoon_param_;
+  const double gap = [&]() {
+    if (platoon_mode_ == PlatoonMode::LAT_LON) {
+      return tier4_autoware_utils::calcDistance2d(planner_data.ego_pose, leader->pose);
     }
-
-  // Calculate the speed difference between the ego vehicle and the front vehicle
-  // const double speed_difference = current_speed - next_vehicle_pose.twist.linear.x;    
-  const double delta_time = 0.1;  // Time step in seconds
-  double ll_desired_distance = 5.0;
-
-  double diff = calculated_diagonal_distance - ll_desired_distance;
-
-  // Assuming the goal here is to adjust the vehicle's speed based on the distance
-  // to the vehicle in front, to maintain a desired separation distance (ll_desired_distance)
-  while(fabs(diff) > 0.1){ // Use a tolerance to avoid infinite loop
-      double acceleration = 0.0;
-      if (diff < 0) { // Too close, decelerate to increase distance
-        acceleration = -0.5;  // Adjust as needed
-      } else if (diff > 0) { // Too far, accelerate to decrease distance
-        acceleration = 0.5;  // Adjust as needed
-      }
-      
-      // Adjust speed
-      current_speed += acceleration * delta_time;
-      
-      // Assuming the vehicle moves towards or away from the next vehicle based on acceleration
-      // Recalculate diff for the next iteration
-      diff = (calculated_diagonal_distance - delta_time * current_speed) - ll_desired_distance;
+    return calcDistanceToPlatoonLeader(planner_data, *leader);
+  }();
+  if (p.max_distance_to_leader <= gap) {
+    RCLCPP_INFO_EXPRESSION(get_logger(), enable_debug_info_, "Distance is too great");
+    return cruise_vel_limit;
   }
 
-    // Log the calculated diagonal distance for debugging
-    RCLCPP_INFO(this->get_logger(), "Ego Vehicle to Next Vehicle Diagonal Distance: %f", calculated_diagonal_distance);
-
-    // Pub obs info at the end of adjustLateralLongitudinalPlatooning
-    auto obstacle_info_msg = tier4_planning_msgs::msg::ObstacleInfo();
-    obstacle_info_msg.current_speed = current_speed; // current_speed calculation context is assumed to be similar
-    obstacle_info_msg.distance_to_front_obstacle = 0.0; // Use the diagonal distance here
-    obstacle_info_msg.diff = calculated_diagonal_distance; // The 'diff'
+  // 4. Calculate the target acceleration with the constant time headway law
+  auto platoon_param = p;
+  if (platoon_mode_ == PlatoonMode::LAT_LON) {
+    platoon_param.standstill_distance = p.lat_lon_desired_distance;
+    platoon_param.time_headway = 0.0;
+  }
+  const double ego_vel = planner_data.ego_vel;
+  const double target_acc = obstacle_cruise_utils::calcPlatoonTargetAcceleration(
+    gap, ego_vel, leader->velocity, platoon_param);
+  const auto platoon_vel_limit = createPlatoonVelocityLimit(ego_vel, target_acc);
 
-    obstacle_info_pub_->publish(obstacle_info_msg);
+  // Pub obs info
+  auto obstacle_info_msg = tier4_planning_msgs::msg::ObstacleInfo();
+  obstacle_info_msg.current_speed = ego_vel;
+  obstacle_info_msg.distance_to_front_obstacle = gap;
+  obstacle_info_msg.diff =
+    gap - (platoon_param.standstill_distance + platoon_param.time_headway * ego_vel);
+  obstacle_info_pub_->publish(obstacle_info_msg);
 
+  // 5. Merge with the cruise velocity limit so that only one limit is published per cycle
+  if (cruise_vel_limit && cruise_vel_limit->max_velocity < platoon_vel_limit.max_velocity) {
+    return cruise_vel_limit;
+  }
+  return platoon_vel_limit;
 }
 
-
+// added
+VelocityLimit ObstacleCruisePlannerNode::createPlatoonVelocityLimit(
+  const double current_speed, const double target_acc) const
+{
+  // NOTE: The target acceleration is held for a fixed time horizon to get the velocity limit.
+  VelocityLimit vel_limit;
+  vel_limit.stamp = now();
+  vel_limit.sender = "obstacle_cruise_planner.cruise";
+  vel_limit.max_velocity =
+    std::max(0.0, current_speed + target_acc * platoon_param_.velocity_limit_time_horizon);
+  return vel_limit;
+}
 
 void ObstacleCruisePlannerNode::onTrajectory(const Trajectory::ConstSharedPtr msg)
 {
   const auto traj_points = motion_utils::convertToTrajectoryPointArray(*msg);
 
+  objects_ptr_ = objects_mailbox_.load();
+  ego_odom_ptr_ = ego_odom_mailbox_.load();
+  ego_accel_ptr_ = ego_accel_mailbox_.load();
+
   // check if subscribed variables are ready
   if (traj_points.empty() || !ego_odom_ptr_ || !ego_accel_ptr_ || !objects_ptr_) {
     return;
@@ -769,6 +687,10 @@ void ObstacleCruisePlannerNode::onTrajectory(const Trajectory::ConstSharedPtr ms
 
   stop_watch_.tic(__func__);
   *debug_data_ptr_ = DebugData();
+  const std::vector<latency_aggregator::LatencyHopInput> hop_inputs{
+    latency_hop_publisher_->createInput(traj_sub_->get_topic_name(), msg->header.stamp),
+    latency_hop_publisher_->createInput(
+      objects_sub_->get_topic_name(), objects_ptr_->header.stamp)};
 
   const auto is_driving_forward = motion_utils::isDrivingForwardWithTwist(traj_points);
   is_driving_forward_ = is_driving_forward ? is_driving_forward.get() : is_driving_forward_;
@@ -793,6 +715,7 @@ void ObstacleCruisePlannerNode::onTrajectory(const Trajectory::ConstSharedPtr ms
   std::optional<VelocityLimit> cruise_vel_limit;
   const auto cruise_traj_points = planner_ptr_->generateCruiseTrajectory(
     planner_data, stop_traj_points, cruise_obstacles, cruise_vel_limit);
+  cruise_vel_limit = applyPlatooning(planner_data, cruise_obstacles, cruise_vel_limit);
   publishVelocityLimit(cruise_vel_limit, "cruise");
 
   // 6. Slow down planning
@@ -802,8 +725,12 @@ void ObstacleCruisePlannerNode::onTrajectory(const Trajectory::ConstSharedPtr ms
   publishVelocityLimit(slow_down_vel_limit, "slow_down");
 
   // 7. Publish trajectory
-  const auto output_traj = createTrajectory(slow_down_traj_points, msg->header);
-  trajectory_pub_->publish(output_traj);
+  // NOTE: UniquePtr is moved to the subscriber without copy with the intra-process communication.
+  auto output_traj =
+    std::make_unique<Trajectory>(createTrajectory(slow_down_traj_points, msg->header));
+  const auto output_stamp = output_traj->header.stamp;
+  trajectory_pub_->publish(std::move(output_traj));
+  latency_hop_publisher_->publish(hop_inputs, output_stamp);
 
   // 8. Publish debug data
   publishDebugMarker();
@@ -826,7 +753,21 @@ std::vector<Polygon2d> ObstacleCruisePlannerNode::createOneStepPolygons(
   const double step_length = p.decimate_trajectory_step_length;
   const double time_to_convergence = p.time_to_convergence;
 
-  std::vector<Polygon2d> polygons;
+  std::vector<geometry_msgs::msg::Pose> traj_poses;
+  traj_poses.reserve(traj_points.size());
+  for (const auto & traj_point : traj_points) {
+    traj_poses.push_back(traj_point.pose);
+  }
+
+  // reuse the polygons as they are when nothing has changed. (e.g. called for another obstacle)
+  auto & cache = one_step_polygon_cache_[lat_margin];
+  const bool is_same_traj =
+    cache.traj_poses.size() == traj_poses.size() &&
+    std::equal(traj_poses.begin(), traj_poses.end(), cache.traj_poses.begin(), isSamePose);
+  if (is_same_traj && isSamePose(cache.ego_pose, current_ego_pose)) {
+    return cache.polygons;
+  }
+
   const double current_ego_lat_error =
     motion_utils::calcLateralOffset(traj_points, current_ego_pose.position);
   const double current_ego_yaw_error =
@@ -837,13 +778,21 @@ std::vector<Polygon2d> ObstacleCruisePlannerNode::createOneStepPolygons(
   if (is_enable_current_pose_consideration) {
     last_poses.push_back(current_ego_pose);
   }
+  bool is_last_ego_pose_independent = !is_enable_current_pose_consideration;
 
+  std::vector<Polygon2d> polygons;
+  std::vector<bool> is_ego_pose_independent;
+  polygons.reserve(traj_points.size());
+  is_ego_pose_independent.reserve(traj_points.size());
+  size_t prev_idx = 0;  // index of the previous cache to search the same pose from
   for (size_t i = 0; i < traj_points.size(); ++i) {
     std::vector<geometry_msgs::msg::Pose> current_poses = {traj_points.at(i).pose};
 
     // estimate the future ego pose with assuming that the pose error against the reference path
     // will decrease to zero by the time_to_convergence
-    if (is_enable_current_pose_consideration && time_elapsed < time_to_convergence) {
+    const bool is_current_ego_pose_independent =
+      !is_enable_current_pose_consideration || time_to_convergence <= time_elapsed;
+    if (!is_current_ego_pose_independent) {
       const double rem_ratio = (time_to_convergence - time_elapsed) / time_to_convergence;
       geometry_msgs::msg::Pose indexed_pose_err;
       indexed_pose_err.set__orientation(
@@ -860,24 +809,65 @@ std::vector<Polygon2d> ObstacleCruisePlannerNode::createOneStepPolygons(
         time_elapsed = std::numeric_limits<double>::max();
       }
     }
+
+    // NOTE: The polygon only depends on the last and current trajectory poses when neither of
+    //       them considers the ego pose. Such a polygon is reused from the previous cycle.
+    const bool is_polygon_ego_pose_independent =
+      is_last_ego_pose_independent && is_current_ego_pose_independent;
+    const auto reused_polygon = [&]() -> std::optional<Polygon2d> {
+      if (!is_polygon_ego_pose_independent || i == 0) {
+        return std::nullopt;
+      }
+      for (; prev_idx < cache.traj_poses.size(); ++prev_idx) {
+        if (isSamePose(cache.traj_poses.at(prev_idx), traj_poses.at(i))) {
+          break;
+        }
+      }
+      if (
+        prev_idx == 0 || cache.traj_poses.size() <= prev_idx ||
+        !cache.is_ego_pose_independent.at(prev_idx) ||
+        !isSamePose(cache.traj_poses.at(prev_idx - 1), traj_poses.at(i - 1))) {
+        // NOTE: search from the beginning again for the next point since the poses may be shifted
+        prev_idx = 0;
+        return std::nullopt;
+      }
+      return cache.polygons.at(prev_idx);
+    }();
+
     polygons.push_back(
-      polygon_utils::createOneStepPolygon(last_poses, current_poses, vehicle_info, lat_margin));
+      reused_polygon ? *reused_polygon
+                     : polygon_utils::createOneStepPolygon(
+                         last_poses, current_poses, vehicle_info, lat_margin));
+    is_ego_pose_independent.push_back(is_polygon_ego_pose_independent);
     last_poses = current_poses;
+    is_last_ego_pose_independent = is_current_ego_pose_independent;
   }
+
+  cache.traj_poses = traj_poses;
+  cache.ego_pose = current_ego_pose;
+  cache.polygons = polygons;
+  cache.is_ego_pose_independent = is_ego_pose_independent;
+
   return polygons;
 }
 
 std::vector<Obstacle> ObstacleCruisePlannerNode::convertToObstacles(
-  const std::vector<TrajectoryPoint> & traj_points) const
+  const std::vector<TrajectoryPoint> & traj_points)
 {
   stop_watch_.tic(__func__);
 
+  constexpr double projection_cache_position_threshold = 0.05;
+
   const auto obj_stamp = rclcpp::Time(objects_ptr_->header.stamp);
+  const size_t ego_idx = ego_nearest_param_.findIndex(traj_points, ego_odom_ptr_->pose.pose);
+
+  updateObstacleProjectionCache(traj_points);
+  std::unordered_map<std::string, ObstacleProjection> current_projection_cache;
 
   std::vector<Obstacle> target_obstacles;
   for (const auto & predicted_object : objects_ptr_->objects) {
-    const auto & object_id =
-      tier4_autoware_utils::toHexString(predicted_object.object_id).substr(0, 4);
+    const auto uuid = tier4_autoware_utils::toHexString(predicted_object.object_id);
+    const auto & object_id = uuid.substr(0, 4);
     const auto & current_obstacle_pose =
       obstacle_cruise_utils::getCurrentObjectPose(predicted_object, obj_stamp, now(), true);
 
@@ -892,10 +882,24 @@ std::vector<Obstacle> ObstacleCruisePlannerNode::convertToObstacles(
       continue;
     }
 
+    // project the obstacle onto the trajectory, or reuse the previous projection
+    const auto & obstacle_pos = current_obstacle_pose.pose.position;
+    const auto projection = [&]() {
+      const auto cached_itr = obstacle_projection_cache_.find(uuid);
+      if (
+        cached_itr != obstacle_projection_cache_.end() &&
+        tier4_autoware_utils::calcDistance2d(cached_itr->second.position, obstacle_pos) <
+          projection_cache_position_threshold) {
+        return cached_itr->second;
+      }
+      return ObstacleProjection{
+        obstacle_pos, motion_utils::findNearestIndex(traj_points, obstacle_pos),
+        motion_utils::calcLateralOffset(traj_points, obstacle_pos)};
+    }();
+    current_projection_cache.emplace(uuid, projection);
+
     // 2. Check if the obstacle is in front of the ego.
-    const size_t ego_idx = ego_nearest_param_.findIndex(traj_points, ego_odom_ptr_->pose.pose);
-    const bool is_front_obstacle =
-      isFrontObstacle(traj_points, ego_idx, current_obstacle_pose.pose.position);
+    const bool is_front_obstacle = isFrontObstacle(traj_points, ego_idx, projection.nearest_idx);
     if (!is_front_obstacle) {
       RCLCPP_INFO_EXPRESSION(
         get_logger(), enable_debug_info_, "Ignore obstacle (%s) since it is not front obstacle.",
@@ -905,8 +909,7 @@ std::vector<Obstacle> ObstacleCruisePlannerNode::convertToObstacles(
 
     // 3. Check if rough lateral distance is smaller than the threshold
     const double min_lat_dist_to_traj_poly = [&]() {
-      const double lat_dist_from_obstacle_to_traj =
-        motion_utils::calcLateralOffset(traj_points, current_obstacle_pose.pose.position);
+      const double lat_dist_from_obstacle_to_traj = projection.lat_offset;
       const double obstacle_max_length = calcObstacleMaxLength(predicted_object.shape);
       return std::abs(lat_dist_from_obstacle_to_traj) - vehicle_info_.vehicle_width_m -
              obstacle_max_length;
@@ -925,6 +928,8 @@ std::vector<Obstacle> ObstacleCruisePlannerNode::convertToObstacles(
     const auto target_obstacle = Obstacle(obj_stamp, predicted_object, current_obstacle_pose.pose);
     target_obstacles.push_back(target_obstacle);
   }
+  // NOTE: objects which disappeared are removed from the cache here.
+  obstacle_projection_cache_ = std::move(current_projection_cache);
 
   const double calculation_time = stop_watch_.toc(__func__);
   RCLCPP_INFO_EXPRESSION(
@@ -988,31 +993,38 @@ ObstacleCruisePlannerNode::determineEgoBehaviorAgainstObstacles(
   const auto decimated_traj_polys =
     createOneStepPolygons(decimated_traj_points, vehicle_info_, ego_odom_ptr_->pose.pose);
   debug_data_ptr_->detection_polygons = decimated_traj_polys;
+  const auto decimated_traj_polys_rtree =
+    polygon_utils::createTrajectoryPolygonRtree(decimated_traj_polys);
+
+  // Calculate distance between trajectory and obstacles first
+  std::vector<Polygon2d> obstacle_polys;
+  obstacle_polys.reserve(obstacles.size());
+  for (const auto & obstacle : obstacles) {
+    obstacle_polys.push_back(obstacle.toPolygon());
+  }
+  const auto precise_lat_dists = polygon_utils::calcDistancesToTrajectoryPolygons(
+    decimated_traj_polys, decimated_traj_polys_rtree, obstacle_polys);
 
   // determine ego's behavior from stop, cruise and slow down
   std::vector<StopObstacle> stop_obstacles;
   std::vector<CruiseObstacle> cruise_obstacles;
   std::vector<SlowDownObstacle> slow_down_obstacles;
   slow_down_condition_counter_.resetCurrentUuids();
-  for (const auto & obstacle : obstacles) {
-    const auto obstacle_poly = obstacle.toPolygon();
-
-    // Calculate distance between trajectory and obstacle first
-    double precise_lat_dist = std::numeric_limits<double>::max();
-    for (const auto & traj_poly : decimated_traj_polys) {
-      const double current_precise_lat_dist = bg::distance(traj_poly, obstacle_poly);
-      precise_lat_dist = std::min(precise_lat_dist, current_precise_lat_dist);
-    }
+  for (size_t o_idx = 0; o_idx < obstacles.size(); ++o_idx) {
+    const auto & obstacle = obstacles.at(o_idx);
+    const double precise_lat_dist = precise_lat_dists.at(o_idx);
 
     // Filter obstacles for cruise, stop and slow down
-    const auto cruise_obstacle =
-      createCruiseObstacle(decimated_traj_points, decimated_traj_polys, obstacle, precise_lat_dist);
+    const auto cruise_obstacle = createCruiseObstacle(
+      decimated_traj_points, decimated_traj_polys, decimated_traj_polys_rtree, obstacle,
+      precise_lat_dist);
     if (cruise_obstacle) {
       cruise_obstacles.push_back(*cruise_obstacle);
       continue;
     }
-    const auto stop_obstacle =
-      createStopObstacle(decimated_traj_points, decimated_traj_polys, obstacle, precise_lat_dist);
+    const auto stop_obstacle = createStopObstacle(
+      decimated_traj_points, decimated_traj_polys, decimated_traj_polys_rtree, obstacle,
+      precise_lat_dist);
     if (stop_obstacle) {
       stop_obstacles.push_back(*stop_obstacle);
       continue;
@@ -1030,9 +1042,10 @@ ObstacleCruisePlannerNode::determineEgoBehaviorAgainstObstacles(
   checkConsistency(objects_ptr_->header.stamp, *objects_ptr_, traj_points, stop_obstacles);
 
   // update previous obstacles
-  prev_stop_obstacles_ = stop_obstacles;
-  prev_cruise_obstacles_ = cruise_obstacles;
-  prev_slow_down_obstacles_ = slow_down_obstacles;
+  prev_obstacle_decisions_.clear();
+  prev_obstacle_decisions_.add(stop_obstacles, ObstacleDecisionTable::STOP);
+  prev_obstacle_decisions_.add(cruise_obstacles, ObstacleDecisionTable::CRUISE);
+  prev_obstacle_decisions_.add(slow_down_obstacles, ObstacleDecisionTable::SLOW_DOWN);
 
   const double calculation_time = stop_watch_.toc(__func__);
   RCLCPP_INFO_EXPRESSION(
@@ -1069,6 +1082,7 @@ std::vector<TrajectoryPoint> ObstacleCruisePlannerNode::decimateTrajectoryPoints
 
 std::optional<CruiseObstacle> ObstacleCruisePlannerNode::createCruiseObstacle(
   const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
+  const polygon_utils::TrajectoryPolygonRtree & traj_polys_rtree,
   const Obstacle & obstacle, const double precise_lat_dist)
 {
   const auto & object_id = obstacle.uuid.substr(0, 4);
@@ -1097,10 +1111,12 @@ std::optional<CruiseObstacle> ObstacleCruisePlannerNode::createCruiseObstacle(
     constexpr double epsilon = 1e-6;
     if (precise_lat_dist < epsilon) {
       // obstacle is inside the trajectory
-      return createCollisionPointsForInsideCruiseObstacle(traj_points, traj_polys, obstacle);
+      return createCollisionPointsForInsideCruiseObstacle(
+        traj_points, traj_polys, traj_polys_rtree, obstacle);
     }
     // obstacle is outside the trajectory
-    return createCollisionPointsForOutsideCruiseObstacle(traj_points, traj_polys, obstacle);
+    return createCollisionPointsForOutsideCruiseObstacle(
+      traj_points, traj_polys, traj_polys_rtree, obstacle);
   }();
   if (!collision_points) {
     return std::nullopt;
@@ -1114,6 +1130,7 @@ std::optional<CruiseObstacle> ObstacleCruisePlannerNode::createCruiseObstacle(
 std::optional<std::vector<PointWithStamp>>
 ObstacleCruisePlannerNode::createCollisionPointsForInsideCruiseObstacle(
   const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
+  const polygon_utils::TrajectoryPolygonRtree & traj_polys_rtree,
   const Obstacle & obstacle) const
 {
   const auto & object_id = obstacle.uuid.substr(0, 4);
@@ -1130,10 +1147,10 @@ ObstacleCruisePlannerNode::createCollisionPointsForInsideCruiseObstacle(
   {  // consider hysteresis
     const auto [obstacle_tangent_vel, obstacle_normal_vel] =
       projectObstacleVelocityToTrajectory(traj_points, obstacle);
-    // const bool is_prev_obstacle_stop = getObstacleFromUuid(prev_stop_obstacles_,
-    // obstacle.uuid).has_value();
+    // const bool is_prev_obstacle_stop =
+    //   prev_obstacle_decisions_.has(obstacle.uuid, ObstacleDecisionTable::STOP);
     const bool is_prev_obstacle_cruise =
-      getObstacleFromUuid(prev_cruise_obstacles_, obstacle.uuid).has_value();
+      prev_obstacle_decisions_.has(obstacle.uuid, ObstacleDecisionTable::CRUISE);
 
     if (is_prev_obstacle_cruise) {
       if (obstacle_tangent_vel < p.obstacle_velocity_threshold_from_cruise_to_stop) {
@@ -1158,14 +1175,15 @@ ObstacleCruisePlannerNode::createCollisionPointsForInsideCruiseObstacle(
   // calculate nearest collision point
   std::vector<size_t> collision_index;
   const auto collision_points = polygon_utils::getCollisionPoints(
-    traj_points, traj_polys, obstacle.stamp, resampled_predicted_path, obstacle.shape, now(),
-    is_driving_forward_, collision_index);
+    traj_points, traj_polys, traj_polys_rtree, obstacle.stamp, resampled_predicted_path,
+    obstacle.shape, now(), is_driving_forward_, collision_index);
   return collision_points;
 }
 
 std::optional<std::vector<PointWithStamp>>
 ObstacleCruisePlannerNode::createCollisionPointsForOutsideCruiseObstacle(
   const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
+  const polygon_utils::TrajectoryPolygonRtree & traj_polys_rtree,
   const Obstacle & obstacle) const
 {
   const auto & p = behavior_determination_param_;
@@ -1197,8 +1215,8 @@ ObstacleCruisePlannerNode::createCollisionPointsForOutsideCruiseObstacle(
   // calculate collision condition for cruise
   std::vector<size_t> collision_index;
   const auto collision_points = polygon_utils::getCollisionPoints(
-    traj_points, traj_polys, obstacle.stamp, resampled_predicted_path, obstacle.shape, now(),
-    is_driving_forward_, collision_index,
+    traj_points, traj_polys, traj_polys_rtree, obstacle.stamp, resampled_predicted_path,
+    obstacle.shape, now(), is_driving_forward_, collision_index,
     vehicle_info_.vehicle_width_m + p.max_lat_margin_for_cruise,
     p.max_prediction_time_for_collision_check);
   if (collision_points.empty()) {
@@ -1237,6 +1255,7 @@ ObstacleCruisePlannerNode::createCollisionPointsForOutsideCruiseObstacle(
 
 std::optional<StopObstacle> ObstacleCruisePlannerNode::createStopObstacle(
   const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
+  const polygon_utils::TrajectoryPolygonRtree & traj_polys_rtree,
   const Obstacle & obstacle, const double precise_lat_dist) const
 {
   const auto & p = behavior_determination_param_;
@@ -1261,7 +1280,7 @@ std::optional<StopObstacle> ObstacleCruisePlannerNode::createStopObstacle(
   }
 
   const auto collision_point =
-    createCollisionPointForStopObstacle(traj_points, traj_polys, obstacle);
+    createCollisionPointForStopObstacle(traj_points, traj_polys, traj_polys_rtree, obstacle);
   if (!collision_point) {
     return std::nullopt;
   }
@@ -1274,6 +1293,7 @@ std::optional<StopObstacle> ObstacleCruisePlannerNode::createStopObstacle(
 std::optional<geometry_msgs::msg::Point>
 ObstacleCruisePlannerNode::createCollisionPointForStopObstacle(
   const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
+  const polygon_utils::TrajectoryPolygonRtree & traj_polys_rtree,
   const Obstacle & obstacle) const
 {
   const auto & p = behavior_determination_param_;
@@ -1292,8 +1312,8 @@ ObstacleCruisePlannerNode::createCollisionPointForStopObstacle(
 
     std::vector<size_t> collision_index;
     const auto collision_points = polygon_utils::getCollisionPoints(
-      traj_points, traj_polys, obstacle.stamp, resampled_predicted_path, obstacle.shape, now(),
-      is_driving_forward_, collision_index);
+      traj_points, traj_polys, traj_polys_rtree, obstacle.stamp, resampled_predicted_path,
+      obstacle.shape, now(), is_driving_forward_, collision_index);
     if (collision_points.empty()) {
       RCLCPP_INFO_EXPRESSION(
         get_logger(), enable_debug_info_,
@@ -1334,7 +1354,7 @@ std::optional<SlowDownObstacle> ObstacleCruisePlannerNode::createSlowDownObstacl
   slow_down_condition_counter_.addCurrentUuid(obstacle.uuid);
 
   const bool is_prev_obstacle_slow_down =
-    getObstacleFromUuid(prev_slow_down_obstacles_, obstacle.uuid).has_value();
+    prev_obstacle_decisions_.has(obstacle.uuid, ObstacleDecisionTable::SLOW_DOWN);
 
   if (!enable_slow_down_planning_ || !isSlowDownObstacle(obstacle.classification.label)) {
     return std::nullopt;
@@ -1603,11 +1623,8 @@ void ObstacleCruisePlannerNode::publishVelocityLimit(
   need_to_clear_vel_limit_.at(module_name) = false;
 }
 
-void ObstacleCruisePlannerNode::publishDebugMarker() const
+MarkerArray ObstacleCruisePlannerNode::createDebugMarkerArray() const
 {
-  stop_watch_.tic(__func__);
-
-  // 1. publish debug marker
   MarkerArray debug_marker;
 
   // obstacles to cruise
@@ -1709,7 +1726,17 @@ void ObstacleCruisePlannerNode::publishDebugMarker() const
   tier4_autoware_utils::appendMarkerArray(
     debug_data_ptr_->slow_down_debug_wall_marker, &debug_marker);
 
-  debug_marker_pub_->publish(debug_marker);
+  return debug_marker;
+}
+
+void ObstacleCruisePlannerNode::publishDebugMarker() const
+{
+  stop_watch_.tic(__func__);
+
+  // 1. publish debug marker only when someone looks at it
+  if (tier4_autoware_utils::hasSubscription(*debug_marker_pub_)) {
+    debug_marker_pub_->publish(createDebugMarkerArray());
+  }
 
   // 2. publish virtual wall for cruise and stop
   debug_cruise_wall_marker_pub_->publish(debug_data_ptr_->cruise_wall_marker);
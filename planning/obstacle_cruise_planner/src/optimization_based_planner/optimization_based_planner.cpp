@@ -70,6 +70,8 @@ OptimizationBasedPlanner::OptimizationBasedPlanner(
     node.declare_parameter<double>("cruise.optimization_based_planner.engage_exit_ratio");
   stop_dist_to_prohibit_engage_ = node.declare_parameter<double>(
     "cruise.optimization_based_planner.stop_dist_to_prohibit_engage");
+  enable_warm_start_ =
+    node.declare_parameter<bool>("cruise.optimization_based_planner.enable_warm_start");
 
   const double max_s_weight =
     node.declare_parameter<double>("cruise.optimization_based_planner.max_s_weight");
@@ -91,6 +93,9 @@ OptimizationBasedPlanner::OptimizationBasedPlanner(
     max_s_weight, max_v_weight, over_s_safety_weight, over_s_ideal_weight, over_v_weight,
     over_a_weight, over_j_weight);
 
+  // the time vector is fixed so that the QP workspace can be reused
+  time_vec_ = createTimeVector();
+
   // publisher
   optimized_sv_pub_ = node.create_publisher<Trajectory>("~/optimized_sv_trajectory", 1);
   optimized_st_graph_pub_ = node.create_publisher<Trajectory>("~/optimized_st_graph", 1);
@@ -103,8 +108,8 @@ std::vector<TrajectoryPoint> OptimizationBasedPlanner::generateCruiseTrajectory(
   const std::vector<CruiseObstacle> & obstacles,
   [[maybe_unused]] std::optional<VelocityLimit> & vel_limit)
 {
-  // Create Time Vector defined by resampling time interval
-  const std::vector<double> time_vec = createTimeVector();
+  // Time Vector defined by resampling time interval
+  const std::vector<double> & time_vec = time_vec_;
   if (time_vec.size() < 2) {
     RCLCPP_ERROR(
       rclcpp::get_logger("ObstacleCruisePlanner::OptimizationBasedPlanner"),
@@ -168,9 +173,13 @@ std::vector<TrajectoryPoint> OptimizationBasedPlanner::generateCruiseTrajectory(
   data.idling_time = longitudinal_info_.idling_time;
   data.s_boundary = *s_boundaries;
   data.v0 = v0;
+  data.time_shift = prev_optimization_time_
+                      ? (planner_data.current_time - *prev_optimization_time_).seconds()
+                      : 0.0;
   RCLCPP_DEBUG(rclcpp::get_logger("ObstacleCruisePlanner::OptimizationBasedPlanner"), "v0 %f", v0);
 
-  const auto optimized_result = velocity_optimizer_ptr_->optimize(data);
+  const auto optimized_result = velocity_optimizer_ptr_->optimize(data, enable_warm_start_);
+  prev_optimization_time_ = planner_data.current_time;
 
   // Publish Debug trajectories
   const double traj_front_to_vehicle_offset =
@@ -409,21 +418,10 @@ std::optional<SBoundaries> OptimizationBasedPlanner::getSBoundaries(
       continue;
     }
 
-    // Step1 Get S boundary from the obstacle
-    const auto obj_s_boundaries =
-      getSBoundaries(planner_data, stop_traj_points, obj, time_vec, *traj_length);
-    if (!obj_s_boundaries) {
-      continue;
-    }
-
-    // Step2 update s boundaries
-    for (size_t i = 0; i < obj_s_boundaries->size(); ++i) {
-      if (obj_s_boundaries->at(i).max_s < s_boundaries.at(i).max_s) {
-        s_boundaries.at(i) = obj_s_boundaries->at(i);
-      }
-    }
+    // Step1 update s boundaries with the obstacle's ones in place
+    updateSBoundaries(planner_data, stop_traj_points, obj, time_vec, s_boundaries);
 
-    // Step3 search nearest obstacle to follow for rviz marker
+    // Step2 search nearest obstacle to follow for rviz marker
     const double obj_vel = std::abs(obj.velocity);
     const double rss_dist = calcRSSDistance(planner_data.ego_vel, obj_vel);
 
@@ -460,12 +458,12 @@ std::optional<SBoundaries> OptimizationBasedPlanner::getSBoundaries(
   return s_boundaries;
 }
 
-std::optional<SBoundaries> OptimizationBasedPlanner::getSBoundaries(
+void OptimizationBasedPlanner::updateSBoundaries(
   const PlannerData & planner_data, const std::vector<TrajectoryPoint> & stop_traj_points,
-  const CruiseObstacle & object, const std::vector<double> & time_vec, const double traj_length)
+  const CruiseObstacle & object, const std::vector<double> & time_vec, SBoundaries & s_boundaries)
 {
   if (object.collision_points.empty()) {
-    return {};
+    return;
   }
 
   const bool onEgoTrajectory =
@@ -479,64 +477,55 @@ std::optional<SBoundaries> OptimizationBasedPlanner::getSBoundaries(
       rclcpp::get_logger("ObstacleCruisePlanner::OptimizationBasedPlanner"),
       "On Trajectory Object");
 
-    return getSBoundariesForOnTrajectoryObject(
-      planner_data, time_vec, safe_distance_margin, object, traj_length);
+    updateSBoundariesForOnTrajectoryObject(
+      planner_data, time_vec, safe_distance_margin, object, s_boundaries);
+    return;
   }
 
   // Ignore low velocity objects that are not on the trajectory
-  return getSBoundariesForOffTrajectoryObject(
-    planner_data, time_vec, safe_distance_margin, object, traj_length);
+  updateSBoundariesForOffTrajectoryObject(
+    planner_data, time_vec, safe_distance_margin, object, s_boundaries);
 }
 
-std::optional<SBoundaries> OptimizationBasedPlanner::getSBoundariesForOnTrajectoryObject(
+void OptimizationBasedPlanner::updateSBoundariesForOnTrajectoryObject(
   const PlannerData & planner_data, const std::vector<double> & time_vec,
-  const double safety_distance, const CruiseObstacle & object, const double traj_length)
+  const double safety_distance, const CruiseObstacle & object, SBoundaries & s_boundaries)
 {
   const double & min_object_accel_for_rss = longitudinal_info_.min_object_accel_for_rss;
 
-  SBoundaries s_boundaries(time_vec.size());
-  for (size_t i = 0; i < s_boundaries.size(); ++i) {
-    s_boundaries.at(i).max_s = traj_length;
-  }
-
   const double v_obj = std::abs(object.velocity);
 
   const double dist_to_collision_point =
     calcDistanceToCollisionPoint(planner_data, object.collision_points.front().point);
 
+  // the boundaries are lowered where the object's boundary is smaller than the current one
   double current_s_obj = std::max(dist_to_collision_point - safety_distance, 0.0);
   const double current_v_obj = v_obj;
-  const double initial_s_upper_bound =
-    current_s_obj + (current_v_obj * current_v_obj) / (2 * std::fabs(min_object_accel_for_rss));
-  s_boundaries.front().max_s = std::clamp(initial_s_upper_bound, 0.0, s_boundaries.front().max_s);
-  s_boundaries.front().is_object = true;
-  for (size_t i = 1; i < time_vec.size(); ++i) {
-    const double dt = time_vec.at(i) - time_vec.at(i - 1);
-    current_s_obj = current_s_obj + current_v_obj * dt;
+  for (size_t i = 0; i < time_vec.size(); ++i) {
+    if (i > 0) {
+      const double dt = time_vec.at(i) - time_vec.at(i - 1);
+      current_s_obj = current_s_obj + current_v_obj * dt;
+    }
 
     const double s_upper_bound =
       current_s_obj + (current_v_obj * current_v_obj) / (2 * std::fabs(min_object_accel_for_rss));
-    s_boundaries.at(i).max_s = std::clamp(s_upper_bound, 0.0, s_boundaries.at(i).max_s);
-    s_boundaries.at(i).is_object = true;
+    const double max_s = std::max(s_upper_bound, 0.0);
+    if (max_s < s_boundaries.at(i).max_s) {
+      s_boundaries.at(i).max_s = max_s;
+      s_boundaries.at(i).is_object = true;
+    }
   }
-
-  return s_boundaries;
 }
 
-std::optional<SBoundaries> OptimizationBasedPlanner::getSBoundariesForOffTrajectoryObject(
+void OptimizationBasedPlanner::updateSBoundariesForOffTrajectoryObject(
   const PlannerData & planner_data, const std::vector<double> & time_vec,
-  const double safety_distance, const CruiseObstacle & object, const double traj_length)
+  const double safety_distance, const CruiseObstacle & object, SBoundaries & s_boundaries)
 {
   const auto & current_time = planner_data.current_time;
   const double & min_object_accel_for_rss = longitudinal_info_.min_object_accel_for_rss;
 
   const double v_obj = std::abs(object.velocity);
 
-  SBoundaries s_boundaries(time_vec.size());
-  for (size_t i = 0; i < s_boundaries.size(); ++i) {
-    s_boundaries.at(i).max_s = traj_length;
-  }
-
   for (const auto & collision_point : object.collision_points) {
     const double object_time = (rclcpp::Time(collision_point.stamp) - current_time).seconds();
     if (object_time < 0) {
@@ -553,6 +542,7 @@ std::optional<SBoundaries> OptimizationBasedPlanner::getSBoundariesForOffTraject
     const double current_s_obj = std::max(dist_to_collision_point - safety_distance, 0.0);
     const double s_upper_bound =
       current_s_obj + (v_obj * v_obj) / (2 * std::fabs(min_object_accel_for_rss));
+    const double max_s = std::max(0.0, s_upper_bound);
 
     size_t object_time_segment_idx = 0;
     for (size_t i = 0; i < time_vec.size() - 1; ++i) {
@@ -563,14 +553,12 @@ std::optional<SBoundaries> OptimizationBasedPlanner::getSBoundariesForOffTraject
     }
 
     for (size_t i = 0; i <= object_time_segment_idx + 1; ++i) {
-      if (time_vec.at(i) < object_time && s_upper_bound < s_boundaries.at(i).max_s) {
-        s_boundaries.at(i).max_s = std::max(0.0, s_upper_bound);
+      if (time_vec.at(i) < object_time && max_s < s_boundaries.at(i).max_s) {
+        s_boundaries.at(i).max_s = max_s;
         s_boundaries.at(i).is_object = true;
       }
     }
   }
-
-  return s_boundaries;
 }
 
 bool OptimizationBasedPlanner::checkOnTrajectory(
@@ -15,9 +15,49 @@
 #include "obstacle_cruise_planner/optimization_based_planner/velocity_optimizer.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
+#include <algorithm>
 #include <iostream>
 
+namespace
+{
+// interpolate each block of N variables at the times shifted by time_shift, the positions of the
+// first block are measured from the position at the shifted start
+std::vector<double> shiftSolution(
+  const std::vector<double> & solution, const std::vector<double> & time_vec,
+  const double time_shift)
+{
+  if (time_shift <= 0.0) {
+    return solution;
+  }
+
+  const size_t N = time_vec.size();
+  const size_t block_num = solution.size() / N;
+  std::vector<double> shifted_solution(solution.size());
+  size_t seg_idx = 0;
+  for (size_t i = 0; i < N; ++i) {
+    const double t = std::min(time_vec.at(i) + time_shift, time_vec.back());
+    while (seg_idx + 2 < N && time_vec.at(seg_idx + 1) < t) {
+      ++seg_idx;
+    }
+    const double seg_dt = time_vec.at(seg_idx + 1) - time_vec.at(seg_idx);
+    const double ratio = seg_dt > 0.0 ? (t - time_vec.at(seg_idx)) / seg_dt : 0.0;
+    for (size_t block_idx = 0; block_idx < block_num; ++block_idx) {
+      const double prev_val = solution.at(block_idx * N + seg_idx);
+      const double next_val = solution.at(block_idx * N + seg_idx + 1);
+      shifted_solution.at(block_idx * N + i) = prev_val + ratio * (next_val - prev_val);
+    }
+  }
+
+  const double s_offset = shifted_solution.front();
+  for (size_t i = 0; i < N; ++i) {
+    shifted_solution.at(i) -= s_offset;
+  }
+  return shifted_solution;
+}
+}  // namespace
+
 VelocityOptimizer::VelocityOptimizer(
   const double max_s_weight, const double max_v_weight, const double over_s_safety_weight,
   const double over_s_ideal_weight, const double over_v_weight, const double over_a_weight,
@@ -37,9 +77,17 @@ VelocityOptimizer::VelocityOptimizer(
   qp_solver_.updateVerbose(false);
 }
 
-VelocityOptimizer::OptimizationResult VelocityOptimizer::optimize(const OptimizationData & data)
+void VelocityOptimizer::resetWarmStart()
+{
+  prev_primal_solution_.clear();
+  prev_dual_solution_.clear();
+  prev_time_vec_.clear();
+}
+
+VelocityOptimizer::OptimizationResult VelocityOptimizer::optimize(
+  const OptimizationData & data, const bool enable_warm_start)
 {
-  const std::vector<double> time_vec = data.time_vec;
+  const std::vector<double> & time_vec = data.time_vec;
   const size_t N = time_vec.size();
   const double s0 = data.s0;
   const double v0 = data.v0;
@@ -57,7 +105,7 @@ VelocityOptimizer::OptimizationResult VelocityOptimizer::optimize(const Optimiza
   const double j_range = std::max(j_max - j_min, 0.1);
   const double t_dangerous = data.t_dangerous;
   const double t_idling = data.idling_time;
-  const auto s_boundary = data.s_boundary;
+  const auto & s_boundary = data.s_boundary;
 
   // Variables: s_i, v_i, a_i, j_i, over_s_safety_i, over_s_ideal_i, over_v_i, over_a_i, over_j_i
   const int IDX_S0 = 0;
@@ -72,13 +120,17 @@ VelocityOptimizer::OptimizationResult VelocityOptimizer::optimize(const Optimiza
   const int l_variables = 9 * N;
   const int l_constraints = 7 * N + 3 * (N - 1) + 3;
 
-  // the matrix size depends on constraint numbers.
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(l_constraints, l_variables);
+  // the matrices are sparse, so they are built from triplets instead of dense matrices.
+  // only the upper triangular part of P is given to OSQP. The elements depending on is_object are
+  // always added, with zero if it is false, so that the sparsity pattern only depends on N.
+  std::vector<Eigen::Triplet<double>> A;
+  A.reserve(14 * N + 12 * (N - 1) + 3);
   std::vector<double> lower_bound(l_constraints, 0.0);
   std::vector<double> upper_bound(l_constraints, 0.0);
 
   // Object Variables
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(l_variables, l_variables);
+  std::vector<Eigen::Triplet<double>> P;
+  P.reserve(9 * N);
   std::vector<double> q(l_variables, 0.0);
 
   // Object Function
@@ -105,24 +157,22 @@ VelocityOptimizer::OptimizationResult VelocityOptimizer::optimize(const Optimiza
     const double dt =
       i < N - 1 ? time_vec.at(i + 1) - time_vec.at(i) : time_vec.at(N - 1) - time_vec.at(N - 2);
     const double max_s = std::max(s_boundary.at(i).max_s, MINIMUM_MAX_S_BOUND);
-    P(IDX_OVER_S_SAFETY0 + i, IDX_OVER_S_SAFETY0 + i) +=
-      over_s_safety_weight_ / (max_s * max_s) * dt;
-    P(IDX_OVER_S_IDEAL0 + i, IDX_OVER_S_IDEAL0 + i) += over_s_ideal_weight_ / (max_s * max_s) * dt;
-    P(IDX_OVER_V0 + i, IDX_OVER_V0 + i) += over_v_weight_ / (v_max * v_max) * dt;
-    P(IDX_OVER_A0 + i, IDX_OVER_A0 + i) += over_a_weight_ / a_range * dt;
-    P(IDX_OVER_J0 + i, IDX_OVER_J0 + i) += over_j_weight_ / j_range * dt;
-
-    if (s_boundary.at(i).is_object) {
-      const double v_coeff = v0 / (2 * std::fabs(a_min)) + t_idling;
-      P(IDX_S0 + i, IDX_S0 + i) += max_s_weight_ / (max_s * max_s) * dt;
-      P(IDX_V0 + i, IDX_V0 + i) += max_s_weight_ / (max_s * max_s) * v_coeff * v_coeff * dt;
-      P(IDX_S0 + i, IDX_V0 + i) += max_s_weight_ / (max_s * max_s) * v_coeff * dt;
-      P(IDX_V0 + i, IDX_S0 + i) += max_s_weight_ / (max_s * max_s) * v_coeff * dt;
-    } else {
-      P(IDX_S0 + i, IDX_S0 + i) += max_s_weight_ / (max_s * max_s) * dt;
-    }
-
-    P(IDX_V0 + i, IDX_V0 + i) += max_v_weight_ / (v_max * v_max) * dt;
+    P.emplace_back(
+      IDX_OVER_S_SAFETY0 + i, IDX_OVER_S_SAFETY0 + i, over_s_safety_weight_ / (max_s * max_s) * dt);
+    P.emplace_back(
+      IDX_OVER_S_IDEAL0 + i, IDX_OVER_S_IDEAL0 + i, over_s_ideal_weight_ / (max_s * max_s) * dt);
+    P.emplace_back(IDX_OVER_V0 + i, IDX_OVER_V0 + i, over_v_weight_ / (v_max * v_max) * dt);
+    P.emplace_back(IDX_OVER_A0 + i, IDX_OVER_A0 + i, over_a_weight_ / a_range * dt);
+    P.emplace_back(IDX_OVER_J0 + i, IDX_OVER_J0 + i, over_j_weight_ / j_range * dt);
+
+    const double v_coeff =
+      s_boundary.at(i).is_object ? v0 / (2 * std::fabs(a_min)) + t_idling : 0.0;
+    P.emplace_back(IDX_S0 + i, IDX_S0 + i, max_s_weight_ / (max_s * max_s) * dt);
+    P.emplace_back(
+      IDX_V0 + i, IDX_V0 + i, max_s_weight_ / (max_s * max_s) * v_coeff * v_coeff * dt);
+    P.emplace_back(IDX_S0 + i, IDX_V0 + i, max_s_weight_ / (max_s * max_s) * v_coeff * dt);
+
+    P.emplace_back(IDX_V0 + i, IDX_V0 + i, max_v_weight_ / (v_max * v_max) * dt);
   }
 
   // Constraint
@@ -131,12 +181,11 @@ VelocityOptimizer::OptimizationResult VelocityOptimizer::optimize(const Optimiza
   // Safety Position Constraint: s_boundary_min < s_i + v_i*t_dangerous + v0*v_i/(2*|a_min|) -
   // over_s_safety_i < s_boundary_max
   for (size_t i = 0; i < N; ++i, ++constr_idx) {
-    const double v_coeff = v0 / (2 * std::fabs(a_min)) + t_dangerous;
-    A(constr_idx, IDX_S0 + i) = 1.0;  // s_i
-    if (s_boundary.at(i).is_object) {
-      A(constr_idx, IDX_V0 + i) = v_coeff;  // v_i * (t_dangerous + v0/(2*|a_min|))
-    }
-    A(constr_idx, IDX_OVER_S_SAFETY0 + i) = -1.0;  // over_s_safety_i
+    const double v_coeff =
+      s_boundary.at(i).is_object ? v0 / (2 * std::fabs(a_min)) + t_dangerous : 0.0;
+    A.emplace_back(constr_idx, IDX_S0 + i, 1.0);               // s_i
+    A.emplace_back(constr_idx, IDX_V0 + i, v_coeff);           // v_i * (t_dangerous + v0/(2*|a_min|))
+    A.emplace_back(constr_idx, IDX_OVER_S_SAFETY0 + i, -1.0);  // over_s_safety_i
     upper_bound.at(constr_idx) = s_boundary.at(i).max_s;
     lower_bound.at(constr_idx) = 0.0;
   }
@@ -144,50 +193,49 @@ VelocityOptimizer::OptimizationResult VelocityOptimizer::optimize(const Optimiza
   // Ideal Position Constraint: s_boundary_min < s_i  + v_i * t_idling + v0*v_i/(2*|a_min|) -
   // over_s_ideal_i < s_boundary_max
   for (size_t i = 0; i < N; ++i, ++constr_idx) {
-    const double v_coeff = v0 / (2 * std::fabs(a_min)) + t_idling;
-    A(constr_idx, IDX_S0 + i) = 1.0;  // s_i
-    if (s_boundary.at(i).is_object) {
-      A(constr_idx, IDX_V0 + i) = v_coeff;  // v_i * (t_idling + v0/(2*|a_min|))
-    }
-    A(constr_idx, IDX_OVER_S_IDEAL0 + i) = -1.0;  // over_s_ideal_i
+    const double v_coeff =
+      s_boundary.at(i).is_object ? v0 / (2 * std::fabs(a_min)) + t_idling : 0.0;
+    A.emplace_back(constr_idx, IDX_S0 + i, 1.0);              // s_i
+    A.emplace_back(constr_idx, IDX_V0 + i, v_coeff);          // v_i * (t_idling + v0/(2*|a_min|))
+    A.emplace_back(constr_idx, IDX_OVER_S_IDEAL0 + i, -1.0);  // over_s_ideal_i
     upper_bound.at(constr_idx) = s_boundary.at(i).max_s;
     lower_bound.at(constr_idx) = 0.0;
   }
 
   // Soft Velocity Constraint: 0 < v_i - over_v_i < v_max
   for (size_t i = 0; i < N; ++i, ++constr_idx) {
-    A(constr_idx, IDX_V0 + i) = 1.0;        // v_i
-    A(constr_idx, IDX_OVER_V0 + i) = -1.0;  // over_v_i
+    A.emplace_back(constr_idx, IDX_V0 + i, 1.0);        // v_i
+    A.emplace_back(constr_idx, IDX_OVER_V0 + i, -1.0);  // over_v_i
     upper_bound.at(constr_idx) = i == N - 1 ? 0.0 : v_max;
     lower_bound.at(constr_idx) = 0.0;
   }
 
   // Soft Acceleration Constraint: a_min < a_i - over_a_i < a_max
   for (size_t i = 0; i < N; ++i, ++constr_idx) {
-    A(constr_idx, IDX_A0 + i) = 1.0;        // a_i
-    A(constr_idx, IDX_OVER_A0 + i) = -1.0;  // over_a_i
+    A.emplace_back(constr_idx, IDX_A0 + i, 1.0);        // a_i
+    A.emplace_back(constr_idx, IDX_OVER_A0 + i, -1.0);  // over_a_i
     upper_bound.at(constr_idx) = i == N - 1 ? 0.0 : a_max;
     lower_bound.at(constr_idx) = i == N - 1 ? 0.0 : a_min;
   }
 
   // Hard Acceleration Constraint: limit_a_min < a_i < a_max
   for (size_t i = 0; i < N; ++i, ++constr_idx) {
-    A(constr_idx, IDX_A0 + i) = 1.0;  // a_i
+    A.emplace_back(constr_idx, IDX_A0 + i, 1.0);  // a_i
     upper_bound.at(constr_idx) = limit_a_max;
     lower_bound.at(constr_idx) = limit_a_min;
   }
 
   // Soft Jerk Constraint: j_min < j_i - over_j_i < j_max
   for (size_t i = 0; i < N; ++i, ++constr_idx) {
-    A(constr_idx, IDX_J0 + i) = 1.0;        // j_i
-    A(constr_idx, IDX_OVER_J0 + i) = -1.0;  // over_j_i
+    A.emplace_back(constr_idx, IDX_J0 + i, 1.0);        // j_i
+    A.emplace_back(constr_idx, IDX_OVER_J0 + i, -1.0);  // over_j_i
     upper_bound.at(constr_idx) = i == N - 1 ? 0.0 : j_max;
     lower_bound.at(constr_idx) = i == N - 1 ? 0.0 : j_min;
   }
 
   // Hard Jerk Constraint: limit_j_min < j_i < limit_j_max
   for (size_t i = 0; i < N; ++i, ++constr_idx) {
-    A(constr_idx, IDX_J0 + i) = 1.0;  // j_i
+    A.emplace_back(constr_idx, IDX_J0 + i, 1.0);  // j_i
     upper_bound.at(constr_idx) = limit_j_max;
     lower_bound.at(constr_idx) = limit_j_min;
   }
@@ -196,11 +244,11 @@ VelocityOptimizer::OptimizationResult VelocityOptimizer::optimize(const Optimiza
   // s_i+1 = s_i + v_i * dt + 0.5 * a_i * dt^2 + 1/6 * j_i * dt^3
   for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
     const double dt = time_vec.at(i + 1) - time_vec.at(i);
-    A(constr_idx, IDX_S0 + i + 1) = 1.0;                    // s_i+1
-    A(constr_idx, IDX_S0 + i) = -1.0;                       // -s_i
-    A(constr_idx, IDX_V0 + i) = -dt;                        // -v_i*dt
-    A(constr_idx, IDX_A0 + i) = -0.5 * dt * dt;             // -0.5 * a_i * dt^2
-    A(constr_idx, IDX_J0 + i) = -1.0 / 6.0 * dt * dt * dt;  // -1.0/6.0 * j_i * dt^3
+    A.emplace_back(constr_idx, IDX_S0 + i + 1, 1.0);                    // s_i+1
+    A.emplace_back(constr_idx, IDX_S0 + i, -1.0);                       // -s_i
+    A.emplace_back(constr_idx, IDX_V0 + i, -dt);                        // -v_i*dt
+    A.emplace_back(constr_idx, IDX_A0 + i, -0.5 * dt * dt);             // -0.5 * a_i * dt^2
+    A.emplace_back(constr_idx, IDX_J0 + i, -1.0 / 6.0 * dt * dt * dt);  // -1.0/6.0 * j_i * dt^3
     upper_bound.at(constr_idx) = 0.0;
     lower_bound.at(constr_idx) = 0.0;
   }
@@ -208,10 +256,10 @@ VelocityOptimizer::OptimizationResult VelocityOptimizer::optimize(const Optimiza
   // v_i+1 = v_i + a_i * dt + 0.5 * j_i * dt^2
   for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
     const double dt = time_vec.at(i + 1) - time_vec.at(i);
-    A(constr_idx, IDX_V0 + i + 1) = 1.0;         // v_i+1
-    A(constr_idx, IDX_V0 + i) = -1.0;            // -v_i
-    A(constr_idx, IDX_A0 + i) = -dt;             // -a_i * dt
-    A(constr_idx, IDX_J0 + i) = -0.5 * dt * dt;  // -0.5 * j_i * dt^2
+    A.emplace_back(constr_idx, IDX_V0 + i + 1, 1.0);         // v_i+1
+    A.emplace_back(constr_idx, IDX_V0 + i, -1.0);            // -v_i
+    A.emplace_back(constr_idx, IDX_A0 + i, -dt);             // -a_i * dt
+    A.emplace_back(constr_idx, IDX_J0 + i, -0.5 * dt * dt);  // -0.5 * j_i * dt^2
     upper_bound.at(constr_idx) = 0.0;
     lower_bound.at(constr_idx) = 0.0;
   }
@@ -219,32 +267,56 @@ VelocityOptimizer::OptimizationResult VelocityOptimizer::optimize(const Optimiza
   // a_i+1 = a_i + j_i * dt
   for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
     const double dt = time_vec.at(i + 1) - time_vec.at(i);
-    A(constr_idx, IDX_A0 + i + 1) = 1.0;  // a_i+1
-    A(constr_idx, IDX_A0 + i) = -1.0;     // -a_i
-    A(constr_idx, IDX_J0 + i) = -dt;      // -j_i * dt
+    A.emplace_back(constr_idx, IDX_A0 + i + 1, 1.0);  // a_i+1
+    A.emplace_back(constr_idx, IDX_A0 + i, -1.0);     // -a_i
+    A.emplace_back(constr_idx, IDX_J0 + i, -dt);      // -j_i * dt
     upper_bound.at(constr_idx) = 0.0;
     lower_bound.at(constr_idx) = 0.0;
   }
 
   // initial condition
   {
-    A(constr_idx, IDX_S0) = 1.0;  // s0
+    A.emplace_back(constr_idx, IDX_S0, 1.0);  // s0
     upper_bound[constr_idx] = s0;
     lower_bound[constr_idx] = s0;
     ++constr_idx;
 
-    A(constr_idx, IDX_V0) = 1.0;  // v0
+    A.emplace_back(constr_idx, IDX_V0, 1.0);  // v0
     upper_bound[constr_idx] = v0;
     lower_bound[constr_idx] = v0;
     ++constr_idx;
 
-    A(constr_idx, IDX_A0) = 1.0;  // a0
+    A.emplace_back(constr_idx, IDX_A0, 1.0);  // a0
     upper_bound[constr_idx] = a0;
     lower_bound[constr_idx] = a0;
   }
 
   // execute optimization
-  const auto result = qp_solver_.optimize(P, A, q, lower_bound, upper_bound);
+  const auto P_csc = autoware::common::osqp::calCSCMatrix(l_variables, l_variables, P);
+  const auto A_csc = autoware::common::osqp::calCSCMatrix(l_constraints, l_variables, A);
+  const bool has_prev_solution =
+    prev_primal_solution_.size() == static_cast<size_t>(l_variables) &&
+    prev_dual_solution_.size() == static_cast<size_t>(l_constraints) &&
+    data.time_shift < time_vec.back();
+  if (!enable_warm_start) {
+    qp_solver_.initializeProblem(P_csc, A_csc, q, lower_bound, upper_bound);
+  } else if (
+    has_prev_solution && prev_time_vec_ == time_vec && qp_solver_.updateCscP(P_csc) &&
+    qp_solver_.updateCscA(A_csc)) {
+    // NOTE: the sparsity pattern only depends on the time vector, so the workspace of the previous
+    //       problem is kept and only the values are updated. The dual variables of the previous
+    //       solution are also kept in the workspace.
+    qp_solver_.updateQ(q);
+    qp_solver_.updateBounds(lower_bound, upper_bound);
+    qp_solver_.setPrimalVariables(shiftSolution(prev_primal_solution_, time_vec, data.time_shift));
+  } else {
+    qp_solver_.initializeProblem(P_csc, A_csc, q, lower_bound, upper_bound);
+    if (has_prev_solution) {
+      qp_solver_.setWarmStart(
+        shiftSolution(prev_primal_solution_, time_vec, data.time_shift), prev_dual_solution_);
+    }
+  }
+  const auto result = qp_solver_.optimize();
   const std::vector<double> optval = std::get<0>(result);
 
   const int status_val = std::get<3>(result);
@@ -257,6 +329,15 @@ VelocityOptimizer::OptimizationResult VelocityOptimizer::optimize(const Optimiza
 
   OptimizationResult optimized_result;
   const auto is_optimization_failed = status_val != 1 || has_nan;
+  if (enable_warm_start) {
+    if (is_optimization_failed) {
+      resetWarmStart();
+    } else {
+      prev_primal_solution_ = optval;
+      prev_dual_solution_ = std::get<1>(result);
+      prev_time_vec_ = time_vec;
+    }
+  }
   if (!is_optimization_failed) {
     std::vector<double> opt_time = time_vec;
     std::vector<double> opt_pos(N);
@@ -112,16 +112,14 @@ double calcMinimumDistanceToStop(
 }
 
 template <typename T>
-std::optional<T> getObjectFromUuid(const std::vector<T> & objects, const std::string & target_uuid)
+std::optional<T> getObjectFromUuid(
+  const std::unordered_map<std::string, T> & objects, const std::string & target_uuid)
 {
-  const auto itr = std::find_if(objects.begin(), objects.end(), [&](const auto & object) {
-    return object.uuid == target_uuid;
-  });
-
+  const auto itr = objects.find(target_uuid);
   if (itr == objects.end()) {
     return std::nullopt;
   }
-  return *itr;
+  return itr->second;
 }
 
 // TODO(murooka) following two functions are copied from behavior_velocity_planner.
@@ -556,7 +554,7 @@ std::vector<TrajectoryPoint> PlannerInterface::generateSlowDownTrajectory(
     return std::nullopt;
   };
 
-  std::vector<SlowDownOutput> new_prev_slow_down_output;
+  new_prev_slow_down_output_.clear();
   for (size_t i = 0; i < obstacles.size(); ++i) {
     const auto & obstacle = obstacles.at(i);
     const auto prev_output = getObjectFromUuid(prev_slow_down_output_, obstacle.uuid);
@@ -646,13 +644,15 @@ std::vector<TrajectoryPoint> PlannerInterface::generateSlowDownTrajectory(
     debug_data_ptr_->obstacles_to_slow_down.push_back(obstacle);
 
     // update prev_slow_down_output_
-    new_prev_slow_down_output.push_back(SlowDownOutput{
-      obstacle.uuid, slow_down_traj_points, slow_down_start_idx, slow_down_end_idx,
-      stable_slow_down_vel, feasible_slow_down_vel, obstacle.precise_lat_dist});
+    new_prev_slow_down_output_.emplace(
+      obstacle.uuid, SlowDownOutput{
+                       obstacle.uuid, slow_down_traj_points, slow_down_start_idx,
+                       slow_down_end_idx, stable_slow_down_vel, feasible_slow_down_vel,
+                       obstacle.precise_lat_dist});
   }
 
   // update prev_slow_down_output_
-  prev_slow_down_output_ = new_prev_slow_down_output;
+  prev_slow_down_output_.swap(new_prev_slow_down_output_);
 
   const double calculation_time = stop_watch_.toc(__func__);
   RCLCPP_INFO_EXPRESSION(
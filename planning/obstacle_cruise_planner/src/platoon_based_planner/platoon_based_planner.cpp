@@ -0,0 +1,351 @@
+// Copyright 2022 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "obstacle_cruise_planner/platoon_based_planner/platoon_based_planner.hpp"
+
+#include "interpolation/linear_interpolation.hpp"
+#include "signal_processing/lowpass_filter_1d.hpp"
+#include "tier4_autoware_utils/ros/update_param.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+constexpr double ZERO_VEL_THRESHOLD = 0.01;
+
+namespace
+{
+// travel distance with a constant acceleration, which stops at zero velocity
+double calcTravelDistance(const double v, const double a, const double t)
+{
+  if (a < 0.0 && v + a * t < 0.0) {
+    return v * v / (2.0 * std::abs(a));
+  }
+  return v * t + 0.5 * a * t * t;
+}
+
+// leader's travel distance with the piecewise constant planned acceleration
+double calcLeaderTravelDistance(
+  const double v0, const std::vector<double> & planned_acc, const double acc_time_interval,
+  const double t)
+{
+  double v = v0;
+  double s = 0.0;
+  double elapsed_t = 0.0;
+  for (size_t i = 0; i < planned_acc.size(); ++i) {
+    const bool is_last = i == planned_acc.size() - 1;
+    const double dt = is_last ? t - elapsed_t : std::min(acc_time_interval, t - elapsed_t);
+    if (dt <= 0.0) {
+      break;
+    }
+    s += calcTravelDistance(v, planned_acc.at(i), dt);
+    v = std::max(v + planned_acc.at(i) * dt, 0.0);
+    elapsed_t += dt;
+  }
+  return s;
+}
+}  // namespace
+
+PlatoonBasedPlanner::PlatoonBasedPlanner(
+  rclcpp::Node & node, const LongitudinalInfo & longitudinal_info,
+  const vehicle_info_util::VehicleInfo & vehicle_info, const EgoNearestParam & ego_nearest_param,
+  const std::shared_ptr<DebugData> debug_data_ptr)
+: PlannerInterface(node, longitudinal_info, vehicle_info, ego_nearest_param, debug_data_ptr)
+{
+  // parameter
+  dense_resampling_time_interval_ = node.declare_parameter<double>(
+    "cruise.platoon_based_planner.dense_resampling_time_interval");
+  sparse_resampling_time_interval_ = node.declare_parameter<double>(
+    "cruise.platoon_based_planner.sparse_resampling_time_interval");
+  dense_time_horizon_ =
+    node.declare_parameter<double>("cruise.platoon_based_planner.dense_time_horizon");
+  max_time_horizon_ =
+    node.declare_parameter<double>("cruise.platoon_based_planner.max_time_horizon");
+
+  time_headway_ = node.declare_parameter<double>("cruise.platoon_based_planner.time_headway");
+  standstill_distance_ =
+    node.declare_parameter<double>("cruise.platoon_based_planner.standstill_distance");
+  leader_acc_lpf_gain_ =
+    node.declare_parameter<double>("cruise.platoon_based_planner.leader_acc_lpf_gain");
+  leader_state_timeout_ =
+    node.declare_parameter<double>("cruise.platoon_based_planner.leader_state_timeout");
+  velocity_limit_time_horizon_ =
+    node.declare_parameter<double>("cruise.platoon_based_planner.velocity_limit_time_horizon");
+  enable_warm_start_ =
+    node.declare_parameter<bool>("cruise.platoon_based_planner.enable_warm_start");
+
+  const double max_s_weight =
+    node.declare_parameter<double>("cruise.platoon_based_planner.max_s_weight");
+  const double max_v_weight =
+    node.declare_parameter<double>("cruise.platoon_based_planner.max_v_weight");
+  const double over_s_safety_weight =
+    node.declare_parameter<double>("cruise.platoon_based_planner.over_s_safety_weight");
+  const double over_s_ideal_weight =
+    node.declare_parameter<double>("cruise.platoon_based_planner.over_s_ideal_weight");
+  const double over_v_weight =
+    node.declare_parameter<double>("cruise.platoon_based_planner.over_v_weight");
+  const double over_a_weight =
+    node.declare_parameter<double>("cruise.platoon_based_planner.over_a_weight");
+  const double over_j_weight =
+    node.declare_parameter<double>("cruise.platoon_based_planner.over_j_weight");
+
+  // velocity optimizer
+  velocity_optimizer_ptr_ = std::make_shared<VelocityOptimizer>(
+    max_s_weight, max_v_weight, over_s_safety_weight, over_s_ideal_weight, over_v_weight,
+    over_a_weight, over_j_weight);
+}
+
+std::vector<TrajectoryPoint> PlatoonBasedPlanner::generateCruiseTrajectory(
+  const PlannerData & planner_data, const std::vector<TrajectoryPoint> & stop_traj_points,
+  const std::vector<CruiseObstacle> & obstacles, std::optional<VelocityLimit> & vel_limit)
+{
+  stop_watch_.tic(__func__);
+
+  const auto leader_info = calcLeaderInfo(planner_data, obstacles);
+  if (!leader_info) {
+    reset();
+    return stop_traj_points;
+  }
+
+  const std::vector<double> time_vec = createTimeVector();
+  if (time_vec.size() < 2) {
+    RCLCPP_ERROR(
+      rclcpp::get_logger("ObstacleCruisePlanner::PlatoonBasedPlanner"),
+      "Resolution size is not enough");
+    return stop_traj_points;
+  }
+
+  double v_max = 0.0;
+  for (const auto & point : stop_traj_points) {
+    v_max = std::max(v_max, static_cast<double>(point.longitudinal_velocity_mps));
+  }
+  if (v_max < ZERO_VEL_THRESHOLD) {
+    return stop_traj_points;
+  }
+
+  // Optimization
+  // NOTE: The leader's predicted position includes the leader's acceleration as a feed-forward
+  //       term, and the headway is used as the dangerous/idling time so that the optimized gap
+  //       follows the constant time headway spacing.
+  VelocityOptimizer::OptimizationData data;
+  data.time_vec = time_vec;
+  data.s0 = 0.0;
+  data.v0 = std::max(planner_data.ego_vel, 0.0);
+  data.a0 = std::clamp(
+    planner_data.ego_acc, longitudinal_info_.min_accel, longitudinal_info_.max_accel);
+  data.v_max = v_max;
+  data.a_max = longitudinal_info_.max_accel;
+  data.a_min = longitudinal_info_.min_accel;
+  data.j_max = longitudinal_info_.max_jerk;
+  data.j_min = longitudinal_info_.min_jerk;
+  data.limit_a_max = longitudinal_info_.limit_max_accel;
+  data.limit_a_min = longitudinal_info_.limit_min_accel;
+  data.limit_j_max = longitudinal_info_.limit_max_jerk;
+  data.limit_j_min = longitudinal_info_.limit_min_jerk;
+  data.t_dangerous = time_headway_;
+  data.idling_time = time_headway_;
+  data.s_boundary = calcSBoundaries(*leader_info, time_vec);
+  data.time_shift = prev_optimization_time_
+                      ? (planner_data.current_time - *prev_optimization_time_).seconds()
+                      : 0.0;
+
+  const auto optimized_result = velocity_optimizer_ptr_->optimize(data, enable_warm_start_);
+  prev_optimization_time_ = planner_data.current_time;
+  vel_limit = createVelocityLimit(planner_data, optimized_result);
+
+  const double calculation_time = stop_watch_.toc(__func__);
+  RCLCPP_INFO_EXPRESSION(
+    rclcpp::get_logger("ObstacleCruisePlanner::PlatoonBasedPlanner"),
+    enable_calculation_time_info_, "  %s := %f [ms]", __func__, calculation_time);
+
+  return stop_traj_points;
+}
+
+void PlatoonBasedPlanner::updateCruiseParam(const std::vector<rclcpp::Parameter> & parameters)
+{
+  tier4_autoware_utils::updateParam<double>(
+    parameters, "cruise.platoon_based_planner.time_headway", time_headway_);
+  tier4_autoware_utils::updateParam<double>(
+    parameters, "cruise.platoon_based_planner.standstill_distance", standstill_distance_);
+  tier4_autoware_utils::updateParam<double>(
+    parameters, "cruise.platoon_based_planner.leader_acc_lpf_gain", leader_acc_lpf_gain_);
+  tier4_autoware_utils::updateParam<double>(
+    parameters, "cruise.platoon_based_planner.leader_state_timeout", leader_state_timeout_);
+  tier4_autoware_utils::updateParam<double>(
+    parameters, "cruise.platoon_based_planner.velocity_limit_time_horizon",
+    velocity_limit_time_horizon_);
+  tier4_autoware_utils::updateParam<bool>(
+    parameters, "cruise.platoon_based_planner.enable_warm_start", enable_warm_start_);
+}
+
+void PlatoonBasedPlanner::setLeaderState(const LeaderState & leader_state)
+{
+  reported_leader_state_ = leader_state;
+}
+
+std::vector<double> PlatoonBasedPlanner::createTimeVector() const
+{
+  std::vector<double> time_vec;
+  for (double t = 0.0; t < dense_time_horizon_; t += dense_resampling_time_interval_) {
+    time_vec.push_back(t);
+  }
+  if (dense_time_horizon_ - time_vec.back() < 1e-3) {
+    time_vec.back() = dense_time_horizon_;
+  } else {
+    time_vec.push_back(dense_time_horizon_);
+  }
+
+  for (double t = dense_time_horizon_ + sparse_resampling_time_interval_; t < max_time_horizon_;
+       t += sparse_resampling_time_interval_) {
+    time_vec.push_back(t);
+  }
+  if (max_time_horizon_ - time_vec.back() < 1e-3) {
+    time_vec.back() = max_time_horizon_;
+  } else {
+    time_vec.push_back(max_time_horizon_);
+  }
+
+  return time_vec;
+}
+
+std::optional<PlatoonBasedPlanner::LeaderInfo> PlatoonBasedPlanner::calcLeaderInfo(
+  const PlannerData & planner_data, const std::vector<CruiseObstacle> & obstacles)
+{
+  // the nearest cruise obstacle along the trajectory is the leader
+  std::optional<size_t> leader_idx;
+  double min_dist_to_leader = std::numeric_limits<double>::max();
+  for (size_t o_idx = 0; o_idx < obstacles.size(); ++o_idx) {
+    const auto & obstacle = obstacles.at(o_idx);
+    if (obstacle.collision_points.empty()) {
+      continue;
+    }
+
+    const double dist_to_obstacle =
+      calcDistanceToCollisionPoint(planner_data, obstacle.collision_points.front().point);
+    if (dist_to_obstacle < min_dist_to_leader) {
+      min_dist_to_leader = dist_to_obstacle;
+      leader_idx = o_idx;
+    }
+  }
+  if (!leader_idx) {
+    return std::nullopt;
+  }
+
+  const auto & leader = obstacles.at(*leader_idx);
+  if (!prev_leader_state_ || prev_leader_state_->uuid != leader.uuid) {
+    // the leader changed, so the previous solution is not a good initial guess anymore
+    velocity_optimizer_ptr_->resetWarmStart();
+  }
+  const double estimated_acc = estimateLeaderAcceleration(leader);
+
+  // NOTE: The V2V leader state does not have the object's uuid, and is regarded as the state of
+  //       the nearest cruise obstacle. The gap is still measured by the perception.
+  if (isLeaderStateFresh(planner_data.current_time)) {
+    const auto & reported = *reported_leader_state_;
+    std::vector<double> planned_acc(
+      reported.planned_acceleration.begin(), reported.planned_acceleration.end());
+    for (auto & acc : planned_acc) {
+      acc = std::clamp(acc, longitudinal_info_.limit_min_accel, longitudinal_info_.limit_max_accel);
+    }
+    return LeaderInfo{
+      min_dist_to_leader, std::max(reported.velocity, 0.0), planned_acc,
+      LeaderState::PLANNED_ACCELERATION_TIME_INTERVAL};
+  }
+
+  const double leader_acc = std::clamp(
+    estimated_acc, longitudinal_info_.limit_min_accel, longitudinal_info_.limit_max_accel);
+  return LeaderInfo{
+    min_dist_to_leader, std::max(leader.velocity, 0.0), std::vector<double>{leader_acc},
+    LeaderState::PLANNED_ACCELERATION_TIME_INTERVAL};
+}
+
+double PlatoonBasedPlanner::estimateLeaderAcceleration(const CruiseObstacle & leader)
+{
+  const double estimated_acc = [&]() {
+    if (!prev_leader_state_ || prev_leader_state_->uuid != leader.uuid) {
+      return 0.0;
+    }
+    const double dt = (leader.stamp - prev_leader_state_->stamp).seconds();
+    if (dt < 1e-3) {
+      return prev_leader_state_->acceleration;
+    }
+    const double raw_acc = (leader.velocity - prev_leader_state_->velocity) / dt;
+    return signal_processing::lowpassFilter(
+      raw_acc, prev_leader_state_->acceleration, leader_acc_lpf_gain_);
+  }();
+  prev_leader_state_ =
+    TrackedLeaderState{leader.uuid, leader.stamp, leader.velocity, estimated_acc};
+
+  return estimated_acc;
+}
+
+bool PlatoonBasedPlanner::isLeaderStateFresh(const rclcpp::Time & current_time) const
+{
+  if (!reported_leader_state_) {
+    return false;
+  }
+  const double elapsed_time =
+    (current_time - rclcpp::Time(reported_leader_state_->stamp)).seconds();
+  return std::abs(elapsed_time) < leader_state_timeout_;
+}
+
+SBoundaries PlatoonBasedPlanner::calcSBoundaries(
+  const LeaderInfo & leader_info, const std::vector<double> & time_vec) const
+{
+  SBoundaries s_boundaries(time_vec.size());
+  for (size_t i = 0; i < time_vec.size(); ++i) {
+    const double leader_travel_dist = calcLeaderTravelDistance(
+      leader_info.velocity, leader_info.planned_acc, leader_info.acc_time_interval,
+      time_vec.at(i));
+    const double leader_s = leader_info.dist_to_leader + leader_travel_dist;
+    s_boundaries.at(i).max_s = std::max(leader_s - standstill_distance_, 0.0);
+    s_boundaries.at(i).is_object = true;
+  }
+  return s_boundaries;
+}
+
+std::optional<VelocityLimit> PlatoonBasedPlanner::createVelocityLimit(
+  const PlannerData & planner_data, const VelocityOptimizer::OptimizationResult & opt_result)
+{
+  if (opt_result.t.empty()) {
+    RCLCPP_DEBUG(
+      rclcpp::get_logger("ObstacleCruisePlanner::PlatoonBasedPlanner"), "Optimization failed");
+    return std::nullopt;
+  }
+
+  const double query_t = std::min(velocity_limit_time_horizon_, opt_result.t.back());
+  const double target_vel = std::max(interpolation::lerp(opt_result.t, opt_result.v, query_t), 0.0);
+  const double target_acc = interpolation::lerp(opt_result.t, opt_result.a, query_t);
+
+  VelocityLimit msg;
+  msg.stamp = planner_data.current_time;
+  msg.sender = "obstacle_cruise_planner.cruise";
+  msg.use_constraints = true;
+
+  msg.max_velocity = target_vel;
+  if (target_acc < 0) {
+    msg.constraints.min_acceleration = target_acc;
+  }
+  msg.constraints.max_jerk = longitudinal_info_.max_jerk;
+  msg.constraints.min_jerk = longitudinal_info_.min_jerk;
+
+  return msg;
+}
+
+void PlatoonBasedPlanner::reset()
+{
+  prev_leader_state_ = std::nullopt;
+  prev_optimization_time_ = std::nullopt;
+  velocity_optimizer_ptr_->resetWarmStart();
+}
@@ -17,6 +17,10 @@
 #include "motion_utils/trajectory/trajectory.hpp"
 #include "tier4_autoware_utils/geometry/boost_polygon_utils.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+
 namespace
 {
 void appendPointToPolygon(Polygon2d & polygon, const geometry_msgs::msg::Point & geom_point)
@@ -55,15 +59,13 @@ PointWithStamp calcNearestCollisionPoint(
   return collision_points.at(min_idx);
 }
 
-// NOTE: max_lat_dist is used for efficient calculation to suppress boost::geometry's polygon
-// calculation.
-std::optional<std::pair<size_t, std::vector<PointWithStamp>>> getCollisionIndex(
+std::optional<std::pair<size_t, std::vector<PointWithStamp>>> getCollisionIndexFromCandidates(
   const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons,
+  const std::vector<size_t> & candidate_indices, const Polygon2d & obj_polygon,
   const geometry_msgs::msg::Pose & object_pose, const rclcpp::Time & object_time,
-  const Shape & object_shape, const double max_lat_dist = std::numeric_limits<double>::max())
+  const double max_lat_dist)
 {
-  const auto obj_polygon = tier4_autoware_utils::toPolygon2d(object_pose, object_shape);
-  for (size_t i = 0; i < traj_polygons.size(); ++i) {
+  for (const size_t i : candidate_indices) {
     const double approximated_dist =
       tier4_autoware_utils::calcDistance2d(traj_points.at(i).pose, object_pose);
     if (approximated_dist > max_lat_dist) {
@@ -98,6 +100,51 @@ std::optional<std::pair<size_t, std::vector<PointWithStamp>>> getCollisionIndex(
 
   return std::nullopt;
 }
+
+// NOTE: max_lat_dist is used for efficient calculation to suppress boost::geometry's polygon
+// calculation.
+std::optional<std::pair<size_t, std::vector<PointWithStamp>>> getCollisionIndex(
+  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons,
+  const geometry_msgs::msg::Pose & object_pose, const rclcpp::Time & object_time,
+  const Shape & object_shape, const double max_lat_dist = std::numeric_limits<double>::max())
+{
+  const auto obj_polygon = tier4_autoware_utils::toPolygon2d(object_pose, object_shape);
+
+  std::vector<size_t> candidate_indices(traj_polygons.size());
+  std::iota(candidate_indices.begin(), candidate_indices.end(), 0);
+  return getCollisionIndexFromCandidates(
+    traj_points, traj_polygons, candidate_indices, obj_polygon, object_pose, object_time,
+    max_lat_dist);
+}
+
+// NOTE: Only the trajectory polygons whose bounding box intersects with the object's one are
+//       checked precisely. The first collision index is same as the one without the rtree.
+std::optional<std::pair<size_t, std::vector<PointWithStamp>>> getCollisionIndex(
+  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons,
+  const polygon_utils::TrajectoryPolygonRtree & traj_polygon_rtree,
+  const geometry_msgs::msg::Pose & object_pose, const rclcpp::Time & object_time,
+  const Shape & object_shape, const double max_lat_dist)
+{
+  const auto obj_polygon = tier4_autoware_utils::toPolygon2d(object_pose, object_shape);
+  const auto obj_box = bg::return_envelope<Box2d>(obj_polygon);
+
+  std::vector<std::pair<Box2d, size_t>> candidates;
+  traj_polygon_rtree.query(bgi::intersects(obj_box), std::back_inserter(candidates));
+  if (candidates.empty()) {
+    return std::nullopt;
+  }
+
+  std::vector<size_t> candidate_indices;
+  candidate_indices.reserve(candidates.size());
+  for (const auto & candidate : candidates) {
+    candidate_indices.push_back(candidate.second);
+  }
+  std::sort(candidate_indices.begin(), candidate_indices.end());
+
+  return getCollisionIndexFromCandidates(
+    traj_points, traj_polygons, candidate_indices, obj_polygon, object_pose, object_time,
+    max_lat_dist);
+}
 }  // namespace
 
 namespace polygon_utils
@@ -134,6 +181,41 @@ Polygon2d createOneStepPolygon(
   return hull_polygon;
 }
 
+TrajectoryPolygonRtree createTrajectoryPolygonRtree(const std::vector<Polygon2d> & traj_polygons)
+{
+  std::vector<std::pair<Box2d, size_t>> boxes;
+  boxes.reserve(traj_polygons.size());
+  for (size_t i = 0; i < traj_polygons.size(); ++i) {
+    boxes.emplace_back(bg::return_envelope<Box2d>(traj_polygons.at(i)), i);
+  }
+  return TrajectoryPolygonRtree(boxes.begin(), boxes.end());
+}
+
+std::vector<double> calcDistancesToTrajectoryPolygons(
+  const std::vector<Polygon2d> & traj_polygons, const TrajectoryPolygonRtree & traj_polygon_rtree,
+  const std::vector<Polygon2d> & obstacle_polygons)
+{
+  std::vector<double> distances;
+  distances.reserve(obstacle_polygons.size());
+  for (const auto & obstacle_polygon : obstacle_polygons) {
+    const auto obstacle_box = bg::return_envelope<Box2d>(obstacle_polygon);
+
+    // NOTE: The boxes are visited in order of the distance to the obstacle's box, which is the
+    //       lower bound of the distance between polygons.
+    double min_dist = std::numeric_limits<double>::max();
+    const auto nearest_query = bgi::nearest(obstacle_box, traj_polygon_rtree.size());
+    for (auto itr = traj_polygon_rtree.qbegin(nearest_query); itr != traj_polygon_rtree.qend();
+         ++itr) {
+      if (min_dist <= bg::distance(itr->first, obstacle_box)) {
+        break;
+      }
+      min_dist = std::min(min_dist, bg::distance(traj_polygons.at(itr->second), obstacle_polygon));
+    }
+    distances.push_back(min_dist);
+  }
+  return distances;
+}
+
 std::optional<geometry_msgs::msg::Point> getCollisionPoint(
   const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons,
   const Obstacle & obstacle, const bool is_driving_forward)
@@ -186,4 +268,40 @@ std::vector<PointWithStamp> getCollisionPoints(
   return collision_points;
 }
 
+std::vector<PointWithStamp> getCollisionPoints(
+  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons,
+  const TrajectoryPolygonRtree & traj_polygon_rtree, const rclcpp::Time & obstacle_stamp,
+  const PredictedPath & predicted_path, const Shape & shape, const rclcpp::Time & current_time,
+  const bool is_driving_forward, std::vector<size_t> & collision_index, const double max_lat_dist,
+  const double max_prediction_time_for_collision_check)
+{
+  std::vector<PointWithStamp> collision_points;
+  for (size_t i = 0; i < predicted_path.path.size(); ++i) {
+    if (
+      max_prediction_time_for_collision_check <
+      rclcpp::Duration(predicted_path.time_step).seconds() * static_cast<double>(i)) {
+      break;
+    }
+
+    const auto object_time =
+      rclcpp::Time(obstacle_stamp) + rclcpp::Duration(predicted_path.time_step) * i;
+    // Ignore past position
+    if ((object_time - current_time).seconds() < 0.0) {
+      continue;
+    }
+
+    const auto collision_info = getCollisionIndex(
+      traj_points, traj_polygons, traj_polygon_rtree, predicted_path.path.at(i), object_time, shape,
+      max_lat_dist);
+    if (collision_info) {
+      const auto nearest_collision_point = calcNearestCollisionPoint(
+        collision_info->first, collision_info->second, traj_points, is_driving_forward);
+      collision_points.push_back(nearest_collision_point);
+      collision_index.push_back(collision_info->first);
+    }
+  }
+
+  return collision_points;
+}
+
 }  // namespace polygon_utils
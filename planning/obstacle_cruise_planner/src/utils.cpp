@@ -17,6 +17,8 @@
 #include "object_recognition_utils/predicted_path_utils.hpp"
 #include "tier4_autoware_utils/ros/marker_helper.hpp"
 
+#include <algorithm>
+
 namespace obstacle_cruise_utils
 {
 namespace
@@ -115,4 +117,17 @@ std::optional<StopObstacle> getClosestStopObstacle(
   }
   return closest_stop_obstacle;
 }
+
+double calcPlatoonTargetAcceleration(
+  const double gap, const double ego_vel, const double leader_vel, const PlatoonParam & param)
+{
+  // NOTE: This is a closed-form constant time headway law, so that its cost is fixed per call.
+  const double desired_gap =
+    param.standstill_distance + param.time_headway * std::max(0.0, ego_vel);
+  const double gap_error = gap - desired_gap;
+  const double relative_vel = leader_vel - ego_vel;
+
+  const double target_acc = param.kp_gap * gap_error + param.kv_gap * relative_vel;
+  return std::clamp(target_acc, param.min_accel, param.max_accel);
+}
 }  // namespace obstacle_cruise_utils
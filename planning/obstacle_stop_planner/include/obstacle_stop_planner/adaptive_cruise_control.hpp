@@ -15,6 +15,9 @@
 #ifndef OBSTACLE_STOP_PLANNER__ADAPTIVE_CRUISE_CONTROL_HPP_
 #define OBSTACLE_STOP_PLANNER__ADAPTIVE_CRUISE_CONTROL_HPP_
 
+#include "obstacle_stop_planner/object_rtree.hpp"
+#include "obstacle_stop_planner/sliding_window_median.hpp"
+
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_auto_perception_msgs/msg/predicted_objects.hpp>
@@ -26,6 +29,7 @@
 #include <pcl_conversions/pcl_conversions.h>
 #include <tf2/utils.h>
 
+#include <memory>
 #include <vector>
 
 namespace motion_planning
@@ -45,6 +49,7 @@ public:
     const geometry_msgs::msg::Pose self_pose, const pcl::PointXYZ & nearest_collision_point,
     const rclcpp::Time nearest_collision_point_time,
     const autoware_auto_perception_msgs::msg::PredictedObjects::ConstSharedPtr object_ptr,
+    const std::shared_ptr<const ObjectRtree> object_rtree_ptr,
     const nav_msgs::msg::Odometry::ConstSharedPtr current_velocity_ptr, bool * need_to_stop,
     TrajectoryPoints * output_trajectory, const std_msgs::msg::Header trajectory_header);
 
@@ -74,7 +79,10 @@ private:
   double prev_target_velocity_ = 0.0;
   bool prev_collision_point_valid_ = false;
   bool prev_obstacle_velocity_judge_to_start_acc_ = false;
-  std::vector<nav_msgs::msg::Odometry> est_vel_que_;
+  // velocities estimated from pointcloud, the oldest one is dropped when the que is full
+  static constexpr size_t max_vel_que_size = 64;
+  using VelocityQue = SlidingWindowMedian<max_vel_que_size>;
+  VelocityQue est_vel_que_;
   double prev_upper_velocity_ = 0.0;
 
   struct Param
@@ -182,7 +190,7 @@ private:
   };
   Param param_;
 
-  double getMedianVel(const std::vector<nav_msgs::msg::Odometry> vel_que);
+  double getMedianVel(const VelocityQue & vel_que);
   double lowpass_filter(const double current_value, const double prev_value, const double gain);
   void calcDistanceToNearestPointOnPath(
     const TrajectoryPoints & trajectory, const int nearest_point_idx,
@@ -192,7 +200,8 @@ private:
   double calcTrajYaw(const TrajectoryPoints & trajectory, const int collision_point_idx);
   bool estimatePointVelocityFromObject(
     const autoware_auto_perception_msgs::msg::PredictedObjects::ConstSharedPtr object_ptr,
-    const double traj_yaw, const pcl::PointXYZ & nearest_collision_point, double * velocity);
+    const std::shared_ptr<const ObjectRtree> object_rtree_ptr, const double traj_yaw,
+    const pcl::PointXYZ & nearest_collision_point, double * velocity);
   bool estimatePointVelocityFromPcl(
     const double traj_yaw, const pcl::PointXYZ & nearest_collision_point,
     const rclcpp::Time & nearest_collision_point_time, double * velocity);
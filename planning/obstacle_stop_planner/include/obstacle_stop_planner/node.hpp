@@ -17,8 +17,11 @@
 
 #include "obstacle_stop_planner/adaptive_cruise_control.hpp"
 #include "obstacle_stop_planner/debug_marker.hpp"
+#include "obstacle_stop_planner/object_rtree.hpp"
 #include "obstacle_stop_planner/planner_data.hpp"
+#include "obstacle_stop_planner/planner_utils.hpp"
 #include "tier4_autoware_utils/ros/logger_level_configure.hpp"
+#include "tier4_autoware_utils/system/latest_mailbox.hpp"
 #include "tier4_autoware_utils/system/stop_watch.hpp"
 
 #include <motion_utils/trajectory/tmp_conversion.hpp>
@@ -78,6 +81,7 @@ using std_msgs::msg::Header;
 using autoware_auto_perception_msgs::msg::PredictedObjects;
 using autoware_auto_planning_msgs::msg::Trajectory;
 using autoware_auto_planning_msgs::msg::TrajectoryPoint;
+using tier4_autoware_utils::LatestMailbox;
 using tier4_autoware_utils::Point2d;
 using tier4_autoware_utils::Polygon2d;
 using tier4_autoware_utils::StopWatch;
@@ -117,6 +121,14 @@ struct PredictedObjectWithDetectionTime
   PredictedObject object;
 };
 
+// objects message and the data built from it, shared by the stop/slow down search and the ACC
+struct ObjectData
+{
+  PredictedObjects::ConstSharedPtr objects;
+  std::shared_ptr<const ObjectRtree> rtree;
+  std::shared_ptr<const std::vector<ObjectFootprint>> footprints;
+};
+
 class ObstacleStopPlannerNode : public rclcpp::Node
 {
 public:
@@ -156,11 +168,13 @@ private:
   std::vector<PredictedObjectWithDetectionTime> predicted_object_history_{};
   tf2_ros::Buffer tf_buffer_{get_clock()};
   tf2_ros::TransformListener tf_listener_{tf_buffer_};
-  PointCloud2::SharedPtr obstacle_ros_pointcloud_ptr_{nullptr};
-  PredictedObjects::ConstSharedPtr object_ptr_{nullptr};
-
-  Odometry::ConstSharedPtr current_odometry_ptr_{nullptr};
-  AccelWithCovarianceStamped::ConstSharedPtr current_acceleration_ptr_{nullptr};
+  // latest values of the input topics, written by the subscription callbacks without locking
+  LatestMailbox<PointCloud2> obstacle_pointcloud_mailbox_;
+  // only used in onPointCloud
+  VoxelGridDownsampler voxel_grid_downsampler_;
+  LatestMailbox<ObjectData> object_mailbox_;
+  LatestMailbox<Odometry> current_odometry_mailbox_;
+  LatestMailbox<AccelWithCovarianceStamped> current_acceleration_mailbox_;
   bool is_driving_forward_{true};
 
   bool set_velocity_limit_{false};
@@ -174,15 +188,13 @@ private:
 
   StopWatch<std::chrono::milliseconds> stop_watch_;
 
-  // mutex for vehicle_info_, stop_param_, current_acc_, obstacle_ros_pointcloud_ptr_
-  // NOTE: shared_ptr itself is thread safe so we do not have to care if *ptr is not used
-  //   (current_velocity_ptr_)
+  // mutex for vehicle_info_, stop_param_
   std::mutex mutex_;
 
   void searchObstacle(
     const TrajectoryPoints & decimate_trajectory, TrajectoryPoints & output,
     PlannerData & planner_data, const Header & trajectory_header, const VehicleInfo & vehicle_info,
-    const StopParam & stop_param, const PointCloud2::SharedPtr obstacle_ros_pointcloud_ptr);
+    const StopParam & stop_param, const PointCloud2::ConstSharedPtr obstacle_ros_pointcloud_ptr);
 
   void searchPredictedObject(
     const TrajectoryPoints & decimate_trajectory, TrajectoryPoints & output,
@@ -230,7 +242,8 @@ private:
 
   void filterObstacles(
     const PredictedObjects & input_objects, const Pose & ego_pose, const TrajectoryPoints & traj,
-    const double dist_threshold, PredictedObjects & filtered_objects);
+    const double dist_threshold, PredictedObjects & filtered_objects,
+    std::vector<size_t> & filtered_object_indices);
 
   // Callback
   void onTrigger(const Trajectory::ConstSharedPtr input_msg);
@@ -0,0 +1,60 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OBSTACLE_STOP_PLANNER__OBJECT_RTREE_HPP_
+#define OBSTACLE_STOP_PLANNER__OBJECT_RTREE_HPP_
+
+#include <tier4_autoware_utils/geometry/boost_geometry.hpp>
+
+#include <autoware_auto_perception_msgs/msg/predicted_objects.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <utility>
+#include <vector>
+
+namespace motion_planning
+{
+using ObjectBox = boost::geometry::model::box<tier4_autoware_utils::Point2d>;
+// value is the index of the object in PredictedObjects::objects
+using ObjectRtree =
+  boost::geometry::index::rtree<std::pair<ObjectBox, size_t>, boost::geometry::index::rstar<16>>;
+
+// footprint of an object, which is created once per message and shared by the planning steps
+struct ObjectFootprint
+{
+  tier4_autoware_utils::Polygon2d polygon;  // empty if the shape is not supported
+  tier4_autoware_utils::Point2d center;
+  double radius;  // radius of the circle around the center which covers the polygon
+};
+
+// footprints in the same order as PredictedObjects::objects
+std::vector<ObjectFootprint> createObjectFootprints(
+  const autoware_auto_perception_msgs::msg::PredictedObjects & objects);
+
+/**
+ * @brief create rtree of the objects' boxes, each of which covers both the object's footprint
+ *        and the circumscribed circle of its dimensions.
+ */
+ObjectRtree createObjectRtree(
+  const autoware_auto_perception_msgs::msg::PredictedObjects & objects,
+  const std::vector<ObjectFootprint> & footprints);
+
+// return indices of the objects whose box intersects with the query box in ascending order
+std::vector<size_t> searchObjectIndices(const ObjectRtree & rtree, const ObjectBox & query_box);
+
+ObjectBox createBoxAroundPoint(const tier4_autoware_utils::Point2d & point, const double radius);
+}  // namespace motion_planning
+
+#endif  // OBSTACLE_STOP_PLANNER__OBJECT_RTREE_HPP_
@@ -27,12 +27,18 @@
 #include <geometry_msgs/msg/point.hpp>
 #include <geometry_msgs/msg/pose.hpp>
 #include <geometry_msgs/msg/pose_array.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
 
 #include <boost/optional.hpp>
 #include <boost/variant.hpp>
 
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <limits>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -58,6 +64,7 @@ using PointCloud = pcl::PointCloud<pcl::PointXYZ>;
 using autoware_auto_perception_msgs::msg::PredictedObject;
 using autoware_auto_perception_msgs::msg::PredictedObjects;
 using PointVariant = boost::variant<float, double>;
+using sensor_msgs::msg::PointCloud2;
 
 boost::optional<std::pair<double, double>> calcFeasibleMarginAndVelocity(
   const SlowDownParam & slow_down_param, const double dist_baselink_to_obstacle,
@@ -95,6 +102,33 @@ void createOneStepPolygon(
   const Pose & base_step_pose, const Pose & next_step_pose, Polygon2d & hull_polygon,
   const VehicleInfo & vehicle_info, const double expand_width = 0.0);
 
+// return false only if the circle never intersects with the one step polygon, which is
+// within the swept circumscribed circle of the vehicle footprint
+bool mayIntersectOneStepPolygon(
+  const Pose & base_step_pose, const Pose & next_step_pose, const VehicleInfo & vehicle_info,
+  const double expand_width, const Point2d & center, const double radius);
+
+/**
+ * @brief one step polygons of a trajectory step, each of which is created on first use of its
+ *        expand width and reused afterwards.
+ */
+class OneStepPolygons
+{
+public:
+  OneStepPolygons(
+    const Pose & base_step_pose, const Pose & next_step_pose, const VehicleInfo & vehicle_info);
+
+  const Polygon2d & get(const double expand_width);
+
+private:
+  Pose base_step_pose_;
+  Pose next_step_pose_;
+  VehicleInfo vehicle_info_;
+
+  // deque keeps the references to the created polygons valid
+  std::deque<std::pair<double, Polygon2d>> polygons_;
+};
+
 void getNearestPoint(
   const PointCloud & pointcloud, const Pose & base_pose, pcl::PointXYZ * nearest_collision_point,
   rclcpp::Time * nearest_collision_point_time);
@@ -150,8 +184,101 @@ bool isFrontObstacle(const Pose & ego_pose, const geometry_msgs::msg::Point & ob
 
 double calcObstacleMaxLength(const autoware_auto_perception_msgs::msg::Shape & shape);
 
+// lateral margin for the shape type, or none if the type is not supported
+boost::optional<double> getLateralMargin(
+  const autoware_auto_perception_msgs::msg::Shape & shape, const double pedestrian_margin,
+  const double vehicle_margin, const double unknown_margin);
+
 rclcpp::SubscriptionOptions createSubscriptionOptions(rclcpp::Node * node_ptr);
 
+/**
+ * @brief candidate points bucketed by the trajectory step whose end is close to them.
+ * @details each bucket holds its points in SoA float arrays relative to the first center point,
+ *          so that the vectorized point-in-convex-polygon test runs over contiguous memory.
+ */
+class StepPointBuckets
+{
+public:
+  /**
+   * @param points candidate points
+   * @param center_points vehicle center points on the trajectory, the i-th step is between the
+   *        i-th and (i+1)-th ones
+   * @param radius points closer than this to either end of the step are put in its bucket
+   */
+  StepPointBuckets(
+    const PointCloud & points, const std::vector<Point> & center_points, const double radius);
+
+  /**
+   * @brief search points in the bucket of the step which are within the convex polygon, closer
+   *        than the radius (<= the one of the constructor) to either end of the step, and between
+   *        z_min and z_max. The same as withinPolygon / withinPolyhedron up to float precision.
+   * @return true if any point is found
+   */
+  bool searchPointsWithinPolygon(
+    const size_t step_idx, const Polygon2d & convex_polygon, const double radius,
+    std::vector<size_t> & within_indices,
+    const double z_min = -std::numeric_limits<double>::infinity(),
+    const double z_max = std::numeric_limits<double>::infinity()) const;
+
+  const pcl::PointXYZ & getPoint(const size_t point_idx) const { return points_.at(point_idx); }
+
+private:
+  const PointCloud & points_;
+  std::vector<Point> center_points_;
+  Point origin_;
+
+  // buckets in CSR format: the bucket of the i-th step is [offsets_[i], offsets_[i + 1])
+  std::vector<size_t> offsets_;
+  std::vector<size_t> point_indices_;
+  std::vector<float> xs_;
+  std::vector<float> ys_;
+  std::vector<float> zs_;
+
+  mutable std::vector<uint8_t> is_within_;
+  mutable std::vector<uint8_t> is_inside_polygon_;
+};
+
+/**
+ * @brief voxel grid filter working directly on PointCloud2, which outputs the centroid of the
+ *        points in each voxel as the same as pcl::VoxelGrid.
+ * @details the buffers are kept over calls to avoid reallocation. Not thread safe.
+ */
+class VoxelGridDownsampler
+{
+public:
+  void filter(
+    const PointCloud2 & input, const double leaf_x, const double leaf_y, const double leaf_z,
+    PointCloud2 & output);
+
+private:
+  struct VoxelIndex
+  {
+    int64_t x;
+    int64_t y;
+    int64_t z;
+    bool operator==(const VoxelIndex & other) const
+    {
+      return x == other.x && y == other.y && z == other.z;
+    }
+  };
+
+  struct VoxelIndexHash
+  {
+    size_t operator()(const VoxelIndex & index) const;
+  };
+
+  struct Voxel
+  {
+    double sum_x;
+    double sum_y;
+    double sum_z;
+    size_t num_points;
+  };
+
+  std::unordered_map<VoxelIndex, size_t, VoxelIndexHash> voxel_idx_map_;
+  std::vector<Voxel> voxels_;
+};
+
 }  // namespace motion_planning
 
 #endif  // OBSTACLE_STOP_PLANNER__PLANNER_UTILS_HPP_
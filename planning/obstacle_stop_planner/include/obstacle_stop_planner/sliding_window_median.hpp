@@ -0,0 +1,201 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OBSTACLE_STOP_PLANNER__SLIDING_WINDOW_MEDIAN_HPP_
+#define OBSTACLE_STOP_PLANNER__SLIDING_WINDOW_MEDIAN_HPP_
+
+#include <array>
+#include <cstddef>
+
+namespace motion_planning
+{
+/**
+ * @brief time-stamped values in a fixed-capacity ring buffer with O(log n) median.
+ * @details values are split into a max-heap (lower half) and a min-heap (upper half) whose
+ *          heap positions are tracked per entry, so that the oldest value can be removed in
+ *          O(log n). No memory is allocated after construction. When the buffer is full, the
+ *          oldest value is dropped to make room for the new one.
+ */
+template <size_t Capacity>
+class SlidingWindowMedian
+{
+  static_assert(Capacity > 0, "Capacity must be positive.");
+
+public:
+  bool empty() const { return size_ == 0; }
+  size_t size() const { return size_; }
+  static constexpr size_t capacity() { return Capacity; }
+
+  void clear()
+  {
+    head_ = 0;
+    size_ = 0;
+    low_.size = 0;
+    high_.size = 0;
+  }
+
+  void push(const double stamp, const double value)
+  {
+    if (size_ == Capacity) {
+      popOldest();
+    }
+
+    const size_t slot = (head_ + size_) % Capacity;
+    entries_[slot].stamp = stamp;
+    entries_[slot].value = value;
+    ++size_;
+
+    if (low_.size == 0 || value <= entries_[low_.slots[0]].value) {
+      heapPush(low_, slot);
+    } else {
+      heapPush(high_, slot);
+    }
+    rebalance();
+  }
+
+  // remove values whose stamp is older than the given one, assuming stamps are pushed in order
+  void removeOlderThan(const double stamp)
+  {
+    while (size_ > 0 && entries_[head_].stamp < stamp) {
+      popOldest();
+    }
+  }
+
+  // NOTE: must not be called when empty
+  double median() const
+  {
+    if (high_.size < low_.size) {
+      return entries_[low_.slots[0]].value;
+    }
+    return (entries_[low_.slots[0]].value + entries_[high_.slots[0]].value) / 2.0;
+  }
+
+private:
+  struct Entry
+  {
+    double stamp;
+    double value;
+    bool is_in_low;
+    size_t heap_pos;
+  };
+
+  struct Heap
+  {
+    explicit Heap(const bool is_max_heap) : is_max(is_max_heap) {}
+    std::array<size_t, Capacity> slots;
+    size_t size = 0;
+    bool is_max;
+  };
+
+  void popOldest()
+  {
+    const auto & entry = entries_[head_];
+    heapErase(entry.is_in_low ? low_ : high_, entry.heap_pos);
+    head_ = (head_ + 1) % Capacity;
+    --size_;
+    rebalance();
+  }
+
+  // keep low_.size == high_.size or low_.size == high_.size + 1
+  void rebalance()
+  {
+    if (high_.size + 1 < low_.size) {
+      const size_t slot = low_.slots[0];
+      heapErase(low_, 0);
+      heapPush(high_, slot);
+    } else if (low_.size < high_.size) {
+      const size_t slot = high_.slots[0];
+      heapErase(high_, 0);
+      heapPush(low_, slot);
+    }
+  }
+
+  bool hasHigherPriority(const Heap & heap, const size_t lhs_slot, const size_t rhs_slot) const
+  {
+    const double lhs = entries_[lhs_slot].value;
+    const double rhs = entries_[rhs_slot].value;
+    return heap.is_max ? rhs < lhs : lhs < rhs;
+  }
+
+  void place(Heap & heap, const size_t pos, const size_t slot)
+  {
+    heap.slots[pos] = slot;
+    entries_[slot].heap_pos = pos;
+  }
+
+  void siftUp(Heap & heap, size_t pos)
+  {
+    const size_t slot = heap.slots[pos];
+    while (0 < pos) {
+      const size_t parent = (pos - 1) / 2;
+      if (!hasHigherPriority(heap, slot, heap.slots[parent])) {
+        break;
+      }
+      place(heap, pos, heap.slots[parent]);
+      pos = parent;
+    }
+    place(heap, pos, slot);
+  }
+
+  void siftDown(Heap & heap, size_t pos)
+  {
+    const size_t slot = heap.slots[pos];
+    while (true) {
+      size_t child = 2 * pos + 1;
+      if (heap.size <= child) {
+        break;
+      }
+      const size_t right = child + 1;
+      if (right < heap.size && hasHigherPriority(heap, heap.slots[right], heap.slots[child])) {
+        child = right;
+      }
+      if (!hasHigherPriority(heap, heap.slots[child], slot)) {
+        break;
+      }
+      place(heap, pos, heap.slots[child]);
+      pos = child;
+    }
+    place(heap, pos, slot);
+  }
+
+  void heapPush(Heap & heap, const size_t slot)
+  {
+    entries_[slot].is_in_low = &heap == &low_;
+    const size_t pos = heap.size++;
+    place(heap, pos, slot);
+    siftUp(heap, pos);
+  }
+
+  void heapErase(Heap & heap, const size_t pos)
+  {
+    --heap.size;
+    if (pos == heap.size) {
+      return;
+    }
+    const size_t moved_slot = heap.slots[heap.size];
+    place(heap, pos, moved_slot);
+    siftUp(heap, pos);
+    siftDown(heap, entries_[moved_slot].heap_pos);
+  }
+
+  std::array<Entry, Capacity> entries_;
+  size_t head_ = 0;
+  size_t size_ = 0;
+
+  Heap low_{true};    // max-heap of the lower half
+  Heap high_{false};  // min-heap of the upper half
+};
+}  // namespace motion_planning
+
+#endif  // OBSTACLE_STOP_PLANNER__SLIDING_WINDOW_MEDIAN_HPP_
@@ -199,6 +199,7 @@ void AdaptiveCruiseController::insertAdaptiveCruiseVelocity(
   const geometry_msgs::msg::Pose self_pose, const pcl::PointXYZ & nearest_collision_point,
   const rclcpp::Time nearest_collision_point_time,
   const autoware_auto_perception_msgs::msg::PredictedObjects::ConstSharedPtr object_ptr,
+  const std::shared_ptr<const ObjectRtree> object_rtree_ptr,
   const nav_msgs::msg::Odometry::ConstSharedPtr current_odometry_ptr, bool * need_to_stop,
   TrajectoryPoints * output_trajectory, const std_msgs::msg::Header trajectory_header)
 {
@@ -233,7 +234,7 @@ void AdaptiveCruiseController::insertAdaptiveCruiseVelocity(
 
   if (param_.use_object_to_est_vel) {
     if (estimatePointVelocityFromObject(
-          object_ptr, traj_yaw, nearest_collision_point, &point_velocity)) {
+          object_ptr, object_rtree_ptr, traj_yaw, nearest_collision_point, &point_velocity)) {
       success_estimate_vel = true;
     }
   }
@@ -407,7 +408,8 @@ double AdaptiveCruiseController::calcTrajYaw(
 
 bool AdaptiveCruiseController::estimatePointVelocityFromObject(
   const autoware_auto_perception_msgs::msg::PredictedObjects::ConstSharedPtr object_ptr,
-  const double traj_yaw, const pcl::PointXYZ & nearest_collision_point, double * velocity)
+  const std::shared_ptr<const ObjectRtree> object_rtree_ptr, const double traj_yaw,
+  const pcl::PointXYZ & nearest_collision_point, double * velocity)
 {
   geometry_msgs::msg::Point nearest_collision_p_ros;
   nearest_collision_p_ros.x = nearest_collision_point.x;
@@ -419,7 +421,18 @@ bool AdaptiveCruiseController::estimatePointVelocityFromObject(
   double obj_vel_norm;
   double obj_vel_yaw;
   const Point collision_point_2d = convertPointRosToBoost(nearest_collision_p_ros);
-  for (const auto & obj : object_ptr->objects) {
+
+  // only the objects near the collision point can contain it. The margins expand the object
+  // polygon by at most the half of their hypotenuse.
+  const double search_radius =
+    std::hypot(param_.object_polygon_length_margin, param_.object_polygon_width_margin) / 2.0;
+  const auto candidate_indices = searchObjectIndices(
+    *object_rtree_ptr, createBoxAroundPoint(
+                    tier4_autoware_utils::Point2d{collision_point_2d.x(), collision_point_2d.y()},
+                    search_radius));
+
+  for (const size_t idx : candidate_indices) {
+    const auto & obj = object_ptr->objects.at(idx);
     const Polygon obj_poly = getPolygon(
       obj.kinematics.initial_pose_with_covariance.pose, obj.shape.dimensions, 0.0,
       param_.object_polygon_length_margin, param_.object_polygon_width_margin);
@@ -730,51 +743,20 @@ void AdaptiveCruiseController::registerQueToVelocity(
   const double vel, const rclcpp::Time & vel_time)
 {
   // remove old msg from que
-  std::vector<int> delete_idxs;
-  for (size_t i = 0; i < est_vel_que_.size(); i++) {
-    if (node_->now().seconds() - est_vel_que_.at(i).header.stamp.sec > param_.valid_vel_que_time) {
-      delete_idxs.push_back(i);
-    }
-  }
-  for (int delete_idx = delete_idxs.size() - 1; 0 <= delete_idx; --delete_idx) {
-    est_vel_que_.erase(est_vel_que_.begin() + delete_idxs.at(delete_idx));
-  }
+  est_vel_que_.removeOlderThan(node_->now().seconds() - param_.valid_vel_que_time);
 
   // append new que
-  nav_msgs::msg::Odometry new_vel;
-  new_vel.header.stamp = vel_time;
-  new_vel.twist.twist.linear.x = vel;
-  est_vel_que_.emplace_back(new_vel);
+  est_vel_que_.push(vel_time.seconds(), vel);
 }
 
-double AdaptiveCruiseController::getMedianVel(const std::vector<nav_msgs::msg::Odometry> vel_que)
+double AdaptiveCruiseController::getMedianVel(const VelocityQue & vel_que)
 {
-  if (vel_que.size() == 0) {
+  if (vel_que.empty()) {
     RCLCPP_WARN_STREAM(node_->get_logger(), "size of vel que is 0. Something has wrong.");
     return 0.0;
   }
 
-  std::vector<double> raw_vel_que;
-  for (const auto & vel : vel_que) {
-    raw_vel_que.emplace_back(vel.twist.twist.linear.x);
-  }
-
-  double med_vel;
-  if (raw_vel_que.size() % 2 == 0) {
-    size_t med1 = (raw_vel_que.size()) / 2 - 1;
-    size_t med2 = (raw_vel_que.size()) / 2;
-    std::nth_element(raw_vel_que.begin(), raw_vel_que.begin() + med1, raw_vel_que.end());
-    const double vel1 = raw_vel_que[med1];
-    std::nth_element(raw_vel_que.begin(), raw_vel_que.begin() + med2, raw_vel_que.end());
-    const double vel2 = raw_vel_que[med2];
-    med_vel = (vel1 + vel2) / 2;
-  } else {
-    size_t med = (raw_vel_que.size() - 1) / 2;
-    std::nth_element(raw_vel_que.begin(), raw_vel_que.begin() + med, raw_vel_que.end());
-    med_vel = raw_vel_que[med];
-  }
-
-  return med_vel;
+  return vel_que.median();
 }
 
 double AdaptiveCruiseController::lowpass_filter(
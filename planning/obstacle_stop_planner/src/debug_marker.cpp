@@ -16,6 +16,7 @@
 
 #include <motion_utils/marker/marker_helper.hpp>
 #include <tier4_autoware_utils/geometry/geometry.hpp>
+#include <tier4_autoware_utils/ros/debug_publisher.hpp>
 #include <tier4_autoware_utils/ros/marker_helper.hpp>
 
 #ifdef ROS_DISTRO_GALACTIC
@@ -182,9 +183,11 @@ void ObstacleStopPlannerDebugNode::publish()
   const auto virtual_wall_msg = makeVirtualWallMarker();
   virtual_wall_pub_->publish(virtual_wall_msg);
 
-  /* publish debug marker for rviz */
-  const auto visualization_msg = makeVisualizationMarker();
-  debug_viz_pub_->publish(visualization_msg);
+  /* publish debug marker for rviz only when someone looks at it */
+  if (tier4_autoware_utils::hasSubscription(*debug_viz_pub_)) {
+    const auto visualization_msg = makeVisualizationMarker();
+    debug_viz_pub_->publish(visualization_msg);
+  }
 
   /* publish stop reason for autoware api */
   const auto stop_reason_msg = makeStopReasonArray();
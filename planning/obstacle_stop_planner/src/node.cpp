@@ -23,10 +23,12 @@
 #include "obstacle_stop_planner/node.hpp"
 #include "obstacle_stop_planner/planner_utils.hpp"
 
+#include <geometry/flat_spatial_hash.hpp>
+
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 
-#include <pcl/filters/voxel_grid.h>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
 #include <tf2/utils.h>
 
 #ifdef ROS_DISTRO_GALACTIC
@@ -40,6 +42,7 @@
 
 namespace motion_planning
 {
+using autoware::common::geometry::spatial_hash::FlatSpatialHash2d;
 using autoware_auto_perception_msgs::msg::PredictedObject;
 using motion_utils::calcLongitudinalOffsetPose;
 using motion_utils::calcLongitudinalOffsetToSegment;
@@ -250,28 +253,19 @@ ObstacleStopPlannerNode::ObstacleStopPlannerNode(const rclcpp::NodeOptions & nod
 
 void ObstacleStopPlannerNode::onPointCloud(const PointCloud2::ConstSharedPtr input_msg)
 {
-  // mutex for obstacle_ros_pointcloud_ptr_
-  // NOTE: *obstacle_ros_pointcloud_ptr_ is used
-  std::lock_guard<std::mutex> lock(mutex_);
-
-  obstacle_ros_pointcloud_ptr_ = std::make_shared<PointCloud2>();
-  pcl::VoxelGrid<pcl::PointXYZ> filter;
-  PointCloud::Ptr pointcloud_ptr(new PointCloud);
-  PointCloud::Ptr no_height_filtered_pointcloud_ptr(new PointCloud);
-
-  pcl::fromROSMsg(*input_msg, *pointcloud_ptr);
+  // NOTE: this callback is not called concurrently since the subscription has its own mutually
+  //   exclusive callback group.
+  PointCloud2::ConstSharedPtr obstacle_ros_pointcloud_ptr = input_msg;
   if (!node_param_.enable_z_axis_obstacle_filtering) {
-    filter.setInputCloud(pointcloud_ptr);
-    filter.setLeafSize(
-      node_param_.voxel_grid_x, node_param_.voxel_grid_y, node_param_.voxel_grid_z);
-    filter.filter(*no_height_filtered_pointcloud_ptr);
-    pcl::toROSMsg(*no_height_filtered_pointcloud_ptr, *obstacle_ros_pointcloud_ptr_);
-  } else {
-    pcl::toROSMsg(*pointcloud_ptr, *obstacle_ros_pointcloud_ptr_);
+    auto filtered_pointcloud_ptr = std::make_shared<PointCloud2>();
+    voxel_grid_downsampler_.filter(
+      *input_msg, node_param_.voxel_grid_x, node_param_.voxel_grid_y, node_param_.voxel_grid_z,
+      *filtered_pointcloud_ptr);
+    obstacle_ros_pointcloud_ptr = filtered_pointcloud_ptr;
   }
+  pub_obstacle_pointcloud_->publish(*obstacle_ros_pointcloud_ptr);
 
-  obstacle_ros_pointcloud_ptr_->header = input_msg->header;
-  pub_obstacle_pointcloud_->publish(*obstacle_ros_pointcloud_ptr_);
+  obstacle_pointcloud_mailbox_.store(obstacle_ros_pointcloud_ptr);
 }
 
 void ObstacleStopPlannerNode::onTrigger(const Trajectory::ConstSharedPtr input_msg)
@@ -282,11 +276,11 @@ void ObstacleStopPlannerNode::onTrigger(const Trajectory::ConstSharedPtr input_m
   // NOTE: these variables must not be referenced for multithreading
   const auto vehicle_info = vehicle_info_;
   const auto stop_param = stop_param_;
-  const auto obstacle_ros_pointcloud_ptr = obstacle_ros_pointcloud_ptr_;
-  const auto object_ptr = object_ptr_;
-  const auto current_odometry_ptr = current_odometry_ptr_;
-  const auto current_acceleration_ptr = current_acceleration_ptr_;
   mutex_.unlock();
+  const auto obstacle_ros_pointcloud_ptr = obstacle_pointcloud_mailbox_.load();
+  const auto object_data_ptr = object_mailbox_.load();
+  const auto current_odometry_ptr = current_odometry_mailbox_.load();
+  const auto current_acceleration_ptr = current_acceleration_mailbox_.load();
 
   {
     const auto waiting = [this](const auto & str) {
@@ -295,7 +289,7 @@ void ObstacleStopPlannerNode::onTrigger(const Trajectory::ConstSharedPtr input_m
         str);
     };
 
-    if (!object_ptr && node_param_.use_predicted_objects) {
+    if (!object_data_ptr && node_param_.use_predicted_objects) {
       waiting("perception object");
       return;
     }
@@ -335,7 +329,7 @@ void ObstacleStopPlannerNode::onTrigger(const Trajectory::ConstSharedPtr input_m
 
   PlannerData planner_data{};
 
-  planner_data.current_pose = current_odometry_ptr_->pose.pose;
+  planner_data.current_pose = current_odometry_ptr->pose.pose;
 
   Trajectory output_trajectory = *input_msg;
   TrajectoryPoints output_trajectory_points =
@@ -390,10 +384,9 @@ void ObstacleStopPlannerNode::onTrigger(const Trajectory::ConstSharedPtr input_m
 void ObstacleStopPlannerNode::searchObstacle(
   const TrajectoryPoints & decimate_trajectory, TrajectoryPoints & output,
   PlannerData & planner_data, const Header & trajectory_header, const VehicleInfo & vehicle_info,
-  const StopParam & stop_param, const PointCloud2::SharedPtr obstacle_ros_pointcloud_ptr)
+  const StopParam & stop_param, const PointCloud2::ConstSharedPtr obstacle_ros_pointcloud_ptr)
 {
   // search candidate obstacle pointcloud
-  PointCloud::Ptr slow_down_pointcloud_ptr(new PointCloud);
   PointCloud::Ptr obstacle_candidate_pointcloud_ptr(new PointCloud);
   if (!searchPointcloudNearTrajectory(
         decimate_trajectory, obstacle_ros_pointcloud_ptr, obstacle_candidate_pointcloud_ptr,
@@ -405,17 +398,46 @@ void ObstacleStopPlannerNode::searchObstacle(
 
   updateObstacleHistory(now);
 
+  // assign candidate points to the trajectory steps once, so that each step polygon is tested only
+  // against the points near the step
+  std::vector<geometry_msgs::msg::Point> center_points;
+  center_points.reserve(decimate_trajectory.size());
+  for (const auto & trajectory_point : decimate_trajectory) {
+    center_points.push_back(getVehicleCenterFromBase(trajectory_point.pose, vehicle_info).position);
+  }
+  const double bucket_radius =
+    node_param_.enable_slow_down
+      ? std::max(slow_down_param_.slow_down_search_radius, stop_param.stop_search_radius)
+      : stop_param.stop_search_radius;
+  const StepPointBuckets candidate_buckets(
+    *obstacle_candidate_pointcloud_ptr, center_points, bucket_radius);
+
+  const double z_min_inf = -std::numeric_limits<double>::infinity();
+  const double z_max_inf = std::numeric_limits<double>::infinity();
+  const auto to_pointcloud = [&](const std::vector<size_t> & indices) {
+    PointCloud::Ptr pointcloud_ptr(new PointCloud);
+    pointcloud_ptr->header = obstacle_candidate_pointcloud_ptr->header;
+    pointcloud_ptr->points.reserve(indices.size());
+    for (const size_t idx : indices) {
+      pointcloud_ptr->points.push_back(candidate_buckets.getPoint(idx));
+    }
+    return pointcloud_ptr;
+  };
+
+  // candidate points found in any slow down range so far, which are checked for collision
+  std::vector<uint8_t> is_slow_down_point(obstacle_candidate_pointcloud_ptr->size(), 0);
+  std::vector<size_t> within_indices;
+
   for (size_t i = 0; i < decimate_trajectory.size() - 1; ++i) {
     // create one step circle center for vehicle
     const auto & p_front = decimate_trajectory.at(i).pose;
     const auto & p_back = decimate_trajectory.at(i + 1).pose;
-    const auto z_axis_min = p_front.position.z;
+    const auto z_axis_min =
+      node_param_.enable_z_axis_obstacle_filtering ? p_front.position.z : z_min_inf;
     const auto z_axis_max =
-      p_front.position.z + vehicle_info.vehicle_height_m + node_param_.z_axis_filtering_buffer;
-    const auto prev_center_pose = getVehicleCenterFromBase(p_front, vehicle_info);
-    const Point2d prev_center_point(prev_center_pose.position.x, prev_center_pose.position.y);
-    const auto next_center_pose = getVehicleCenterFromBase(p_back, vehicle_info);
-    const Point2d next_center_point(next_center_pose.position.x, next_center_pose.position.y);
+      node_param_.enable_z_axis_obstacle_filtering
+        ? p_front.position.z + vehicle_info.vehicle_height_m + node_param_.z_axis_filtering_buffer
+        : z_max_inf;
 
     if (node_param_.enable_slow_down) {
       Polygon2d one_step_move_slow_down_range_polygon;
@@ -426,22 +448,20 @@ void ObstacleStopPlannerNode::searchObstacle(
       debug_ptr_->pushPolygon(
         one_step_move_slow_down_range_polygon, p_front.position.z, PolygonType::SlowDownRange);
 
-      if (node_param_.enable_z_axis_obstacle_filtering) {
-        planner_data.found_slow_down_points = withinPolyhedron(
-          one_step_move_slow_down_range_polygon, slow_down_param_.slow_down_search_radius,
-          prev_center_point, next_center_point, obstacle_candidate_pointcloud_ptr,
-          slow_down_pointcloud_ptr, z_axis_min, z_axis_max);
-      } else {
-        planner_data.found_slow_down_points = withinPolygon(
-          one_step_move_slow_down_range_polygon, slow_down_param_.slow_down_search_radius,
-          prev_center_point, next_center_point, obstacle_candidate_pointcloud_ptr,
-          slow_down_pointcloud_ptr);
+      within_indices.clear();
+      planner_data.found_slow_down_points = candidate_buckets.searchPointsWithinPolygon(
+        i, one_step_move_slow_down_range_polygon, slow_down_param_.slow_down_search_radius,
+        within_indices, z_axis_min, z_axis_max);
+      for (const size_t idx : within_indices) {
+        is_slow_down_point.at(idx) = 1;
       }
+
       const auto found_first_slow_down_points =
         planner_data.found_slow_down_points && !planner_data.slow_down_require;
 
       if (found_first_slow_down_points) {
         // found nearest slow down obstacle
+        const auto slow_down_pointcloud_ptr = to_pointcloud(within_indices);
         planner_data.decimate_trajectory_slow_down_index = i;
         planner_data.slow_down_require = true;
         getNearestPoint(
@@ -455,9 +475,6 @@ void ObstacleStopPlannerNode::searchObstacle(
         debug_ptr_->pushPolygon(
           one_step_move_slow_down_range_polygon, p_front.position.z, PolygonType::SlowDown);
       }
-
-    } else {
-      slow_down_pointcloud_ptr = obstacle_candidate_pointcloud_ptr;
     }
 
     {
@@ -473,20 +490,21 @@ void ObstacleStopPlannerNode::searchObstacle(
           one_step_move_vehicle_polygon, p_front.position.z, PolygonType::Vehicle);
       }
 
-      PointCloud::Ptr collision_pointcloud_ptr(new PointCloud);
-      collision_pointcloud_ptr->header = obstacle_candidate_pointcloud_ptr->header;
-
-      const auto found_collision_points =
-        node_param_.enable_z_axis_obstacle_filtering
-          ? withinPolyhedron(
-              one_step_move_vehicle_polygon, stop_param.stop_search_radius, prev_center_point,
-              next_center_point, slow_down_pointcloud_ptr, collision_pointcloud_ptr, z_axis_min,
-              z_axis_max)
-          : withinPolygon(
-              one_step_move_vehicle_polygon, stop_param.stop_search_radius, prev_center_point,
-              next_center_point, slow_down_pointcloud_ptr, collision_pointcloud_ptr);
+      within_indices.clear();
+      candidate_buckets.searchPointsWithinPolygon(
+        i, one_step_move_vehicle_polygon, stop_param.stop_search_radius, within_indices,
+        z_axis_min, z_axis_max);
+      if (node_param_.enable_slow_down) {
+        // only the points in the slow down range are checked
+        within_indices.erase(
+          std::remove_if(
+            within_indices.begin(), within_indices.end(),
+            [&](const size_t idx) { return !is_slow_down_point.at(idx); }),
+          within_indices.end());
+      }
 
-      if (found_collision_points) {
+      if (!within_indices.empty()) {
+        const auto collision_pointcloud_ptr = to_pointcloud(within_indices);
         pcl::PointXYZ nearest_collision_point;
         rclcpp::Time nearest_collision_point_time;
 
@@ -563,16 +581,16 @@ void ObstacleStopPlannerNode::searchObstacle(
 
       planner_data.stop_require = planner_data.found_collision_points;
 
-      mutex_.lock();
-      const auto current_odometry_ptr = current_odometry_ptr_;
-      const auto object_ptr = object_ptr_;
-      mutex_.unlock();
+      const auto current_odometry_ptr = current_odometry_mailbox_.load();
+      const auto object_data_ptr = object_mailbox_.load();
+      const auto object_ptr = object_data_ptr ? object_data_ptr->objects : nullptr;
+      const auto object_rtree_ptr = object_data_ptr ? object_data_ptr->rtree : nullptr;
 
       acc_controller_->insertAdaptiveCruiseVelocity(
         decimate_trajectory, planner_data.decimate_trajectory_collision_index,
         planner_data.current_pose, planner_data.nearest_collision_point,
-        planner_data.nearest_collision_point_time, object_ptr, current_odometry_ptr,
-        &planner_data.stop_require, &output, trajectory_header);
+        planner_data.nearest_collision_point_time, object_ptr, object_rtree_ptr,
+        current_odometry_ptr, &planner_data.stop_require, &output, trajectory_header);
 
       if (!planner_data.stop_require) {
         obstacle_history_.clear();
@@ -587,15 +605,46 @@ void ObstacleStopPlannerNode::searchPredictedObject(
   PlannerData & planner_data, const Header & trajectory_header, const VehicleInfo & vehicle_info,
   const StopParam & stop_param)
 {
-  mutex_.lock();
-  const auto object_ptr = object_ptr_;
-  const auto current_odometry_pointer = current_odometry_ptr_;
-  mutex_.unlock();
+  const auto object_data_ptr = object_mailbox_.load();
+  const auto & object_ptr = object_data_ptr->objects;
+  const auto & object_rtree_ptr = object_data_ptr->rtree;
+  const auto & object_footprints_ptr = object_data_ptr->footprints;
+  const auto current_odometry_pointer = current_odometry_mailbox_.load();
 
   const auto ego_pose = current_odometry_pointer->pose.pose;
   PredictedObjects filtered_objects;
+  std::vector<size_t> filtered_object_indices;
   filterObstacles(
-    *object_ptr.get(), ego_pose, decimate_trajectory, object_filtering_margin_, filtered_objects);
+    *object_ptr.get(), ego_pose, decimate_trajectory, object_filtering_margin_, filtered_objects,
+    filtered_object_indices);
+
+  // index in filtered_objects for each object in the message, or -1 if filtered out
+  std::vector<int> object_idx_to_filtered_idx(object_ptr->objects.size(), -1);
+  for (size_t i = 0; i < filtered_object_indices.size(); ++i) {
+    object_idx_to_filtered_idx.at(filtered_object_indices.at(i)) = static_cast<int>(i);
+  }
+  // broad phase: filtered objects whose box intersects with the box of the one step polygon of
+  // the given margin
+  const auto search_candidates = [&](const Pose & front, const Pose & back, const double margin) {
+    Polygon2d one_step_polygon;
+    createOneStepPolygon(front, back, one_step_polygon, vehicle_info, margin);
+    std::vector<size_t> candidates;
+    for (const size_t idx : searchObjectIndices(
+           *object_rtree_ptr, bg::return_envelope<ObjectBox>(one_step_polygon))) {
+      if (0 <= object_idx_to_filtered_idx.at(idx)) {
+        candidates.push_back(static_cast<size_t>(object_idx_to_filtered_idx.at(idx)));
+      }
+    }
+    return candidates;
+  };
+  // narrow phase: the polygons are tested only if the bounding circle of the object overlaps the
+  // vehicle footprint swept along the step
+  const auto overlaps_bounding_circle =
+    [&](const Pose & front, const Pose & back, const size_t filtered_idx, const double margin) {
+      const auto & footprint = object_footprints_ptr->at(filtered_object_indices.at(filtered_idx));
+      return mayIntersectOneStepPolygon(
+        front, back, vehicle_info, margin, footprint.center, footprint.radius);
+    };
 
   const auto now = this->now();
 
@@ -607,6 +656,7 @@ void ObstacleStopPlannerNode::searchPredictedObject(
     const auto z_axis_min = p_front.position.z;
     const auto z_axis_max =
       p_front.position.z + vehicle_info.vehicle_height_m + node_param_.z_axis_filtering_buffer;
+    OneStepPolygons one_step_polygons(p_front, p_back, vehicle_info);
 
     if (node_param_.enable_slow_down) {
       double min_slow_down_norm = 0.0;
@@ -615,82 +665,65 @@ void ObstacleStopPlannerNode::searchPredictedObject(
       geometry_msgs::msg::Point nearest_slow_down_point;
       geometry_msgs::msg::PoseArray slow_down_points;
 
-      for (size_t j = 0; j < filtered_objects.objects.size(); ++j) {
+      const double max_slow_down_margin = std::max(
+        {slow_down_param_.pedestrian_lateral_margin, slow_down_param_.vehicle_lateral_margin,
+         slow_down_param_.unknown_lateral_margin});
+      for (const size_t j : search_candidates(p_front, p_back, max_slow_down_margin)) {
         const auto & obj = filtered_objects.objects.at(j);
         if (node_param_.enable_z_axis_obstacle_filtering) {
           if (!intersectsInZAxis(obj, z_axis_min, z_axis_max)) {
             continue;
           }
         }
-        Polygon2d one_step_move_slow_down_range;
-        bool found_slow_down_object = false;
-        Polygon2d object_polygon{};
-        if (obj.shape.type == autoware_auto_perception_msgs::msg::Shape::CYLINDER) {
-          object_polygon = convertCylindricalObjectToGeometryPolygon(
-            obj.kinematics.initial_pose_with_covariance.pose, obj.shape);
-          createOneStepPolygon(
-            p_front, p_back, one_step_move_slow_down_range, vehicle_info,
-            slow_down_param_.pedestrian_lateral_margin);
-          found_slow_down_object = bg::intersects(one_step_move_slow_down_range, object_polygon);
-
-        } else if (obj.shape.type == autoware_auto_perception_msgs::msg::Shape::BOUNDING_BOX) {
-          createOneStepPolygon(
-            p_front, p_back, one_step_move_slow_down_range, vehicle_info,
-            slow_down_param_.vehicle_lateral_margin);
-          const double & length_m = obj.shape.dimensions.x / 2;
-          const double & width_m = obj.shape.dimensions.y / 2;
-          object_polygon = convertBoundingBoxObjectToGeometryPolygon(
-            obj.kinematics.initial_pose_with_covariance.pose, length_m, length_m, width_m);
-
-          found_slow_down_object = bg::intersects(one_step_move_slow_down_range, object_polygon);
-
-        } else if (obj.shape.type == autoware_auto_perception_msgs::msg::Shape::POLYGON) {
-          createOneStepPolygon(
-            p_front, p_back, one_step_move_slow_down_range, vehicle_info,
-            slow_down_param_.unknown_lateral_margin);
-
-          object_polygon = convertPolygonObjectToGeometryPolygon(
-            obj.kinematics.initial_pose_with_covariance.pose, obj.shape);
-
-          found_slow_down_object = bg::intersects(one_step_move_slow_down_range, object_polygon);
-
-        } else {
+        const auto lateral_margin = getLateralMargin(
+          obj.shape, slow_down_param_.pedestrian_lateral_margin,
+          slow_down_param_.vehicle_lateral_margin, slow_down_param_.unknown_lateral_margin);
+        if (!lateral_margin) {
           RCLCPP_WARN_THROTTLE(
             get_logger(), *get_clock(), 3000, "Object type is not supported. type: %d",
             obj.shape.type);
           continue;
         }
-        if (found_slow_down_object) {
-          geometry_msgs::msg::PoseArray slow_down_points_tmp;
+        if (!overlaps_bounding_circle(p_front, p_back, j, *lateral_margin)) {
+          continue;
+        }
+
+        const auto & one_step_move_slow_down_range = one_step_polygons.get(*lateral_margin);
+        const auto & object_polygon =
+          object_footprints_ptr->at(filtered_object_indices.at(j)).polygon;
+        if (!bg::intersects(one_step_move_slow_down_range, object_polygon)) {
+          continue;
+        }
+
+        geometry_msgs::msg::PoseArray slow_down_points_tmp;
 
-          std::vector<Point2d> slow_down_point;
-          bg::intersection(one_step_move_slow_down_range, object_polygon, slow_down_point);
-          for (const auto & point : slow_down_point) {
+        std::vector<Point2d> slow_down_point;
+        bg::intersection(one_step_move_slow_down_range, object_polygon, slow_down_point);
+        for (const auto & point : slow_down_point) {
+          geometry_msgs::msg::Pose pose;
+          pose.position.x = point.x();
+          pose.position.y = point.y();
+          slow_down_points_tmp.poses.push_back(pose);
+        }
+
+        // Also check the corner points
+        for (const auto & point : object_polygon.outer()) {
+          if (bg::within(point, one_step_move_slow_down_range)) {
             geometry_msgs::msg::Pose pose;
             pose.position.x = point.x();
             pose.position.y = point.y();
             slow_down_points_tmp.poses.push_back(pose);
           }
-
-          // Also check the corner points
-          for (const auto & point : object_polygon.outer()) {
-            if (bg::within(point, one_step_move_slow_down_range)) {
-              geometry_msgs::msg::Pose pose;
-              pose.position.x = point.x();
-              pose.position.y = point.y();
-              slow_down_points_tmp.poses.push_back(pose);
-            }
-          }
-          geometry_msgs::msg::Point nearest_slow_down_point_tmp;
-          const double norm = getNearestPointAndDistanceForPredictedObject(
-            slow_down_points_tmp, p_front, &nearest_slow_down_point_tmp);
-          if (norm < min_slow_down_norm || !is_init) {
-            min_slow_down_norm = norm;
-            nearest_slow_down_point = nearest_slow_down_point_tmp;
-            is_init = true;
-            nearest_slow_down_object_index = j;
-            slow_down_points = slow_down_points_tmp;
-          }
+        }
+        geometry_msgs::msg::Point nearest_slow_down_point_tmp;
+        const double norm = getNearestPointAndDistanceForPredictedObject(
+          slow_down_points_tmp, p_front, &nearest_slow_down_point_tmp);
+        if (norm < min_slow_down_norm || !is_init) {
+          min_slow_down_norm = norm;
+          nearest_slow_down_point = nearest_slow_down_point_tmp;
+          is_init = true;
+          nearest_slow_down_object_index = j;
+          slow_down_points = slow_down_points_tmp;
         }
       }
 
@@ -716,35 +749,19 @@ void ObstacleStopPlannerNode::searchPredictedObject(
           &planner_data.lateral_deviation);
 
         // Push slow down debugging points
-        Polygon2d one_step_move_slow_down_vehicle_polygon;
-
-        const auto & obj = filtered_objects.objects.at(nearest_slow_down_object_index);
-        if (obj.shape.type == autoware_auto_perception_msgs::msg::Shape::CYLINDER) {
-          createOneStepPolygon(
-            p_front, p_back, one_step_move_slow_down_vehicle_polygon, vehicle_info,
-            slow_down_param_.pedestrian_lateral_margin);
-        } else if (obj.shape.type == autoware_auto_perception_msgs::msg::Shape::BOUNDING_BOX) {
-          createOneStepPolygon(
-            p_front, p_back, one_step_move_slow_down_vehicle_polygon, vehicle_info,
-            slow_down_param_.vehicle_lateral_margin);
-        } else if (obj.shape.type == autoware_auto_perception_msgs::msg::Shape::POLYGON) {
-          createOneStepPolygon(
-            p_front, p_back, one_step_move_slow_down_vehicle_polygon, vehicle_info,
-            slow_down_param_.unknown_lateral_margin);
-        }
+        const auto lateral_margin = getLateralMargin(
+          filtered_objects.objects.at(nearest_slow_down_object_index).shape,
+          slow_down_param_.pedestrian_lateral_margin, slow_down_param_.vehicle_lateral_margin,
+          slow_down_param_.unknown_lateral_margin);
         debug_ptr_->pushObstaclePoint(planner_data.nearest_slow_down_point, PointType::SlowDown);
 
         debug_ptr_->pushPolygon(
-          one_step_move_slow_down_vehicle_polygon, p_front.position.z, PolygonType::SlowDown);
+          one_step_polygons.get(*lateral_margin), p_front.position.z, PolygonType::SlowDown);
       } else {
         // only used for pedestrian and debugging
-        Polygon2d one_step_move_slow_down_range_dbg;
-        createOneStepPolygon(
-          p_front, p_back, one_step_move_slow_down_range_dbg, vehicle_info,
-          slow_down_param_.pedestrian_lateral_margin);
-
         debug_ptr_->pushPolygon(
-          one_step_move_slow_down_range_dbg, p_front.position.z, PolygonType::SlowDownRange);
+          one_step_polygons.get(slow_down_param_.pedestrian_lateral_margin), p_front.position.z,
+          PolygonType::SlowDownRange);
       }
     }
 
@@ -754,79 +771,64 @@ void ObstacleStopPlannerNode::searchPredictedObject(
       size_t nearest_collision_object_index = 0;
       geometry_msgs::msg::Point nearest_collision_point;
 
-      for (size_t j = 0; j < filtered_objects.objects.size(); ++j) {
+      const double max_collision_margin = std::max(
+        {stop_param.pedestrian_lateral_margin, stop_param.vehicle_lateral_margin,
+         stop_param.unknown_lateral_margin});
+      for (const size_t j : search_candidates(p_front, p_back, max_collision_margin)) {
         const auto & obj = filtered_objects.objects.at(j);
         if (node_param_.enable_z_axis_obstacle_filtering) {
           if (!intersectsInZAxis(obj, z_axis_min, z_axis_max)) {
             continue;
           }
         }
-        Polygon2d one_step_move_collision_polygon;
-        bool found_collision_object = false;
-        Polygon2d object_polygon{};
-        if (obj.shape.type == autoware_auto_perception_msgs::msg::Shape::CYLINDER) {
-          object_polygon = convertCylindricalObjectToGeometryPolygon(
-            obj.kinematics.initial_pose_with_covariance.pose, obj.shape);
-
-          createOneStepPolygon(
-            p_front, p_back, one_step_move_collision_polygon, vehicle_info,
-            stop_param.pedestrian_lateral_margin);
-
-          found_collision_object = bg::intersects(one_step_move_collision_polygon, object_polygon);
-        } else if (obj.shape.type == autoware_auto_perception_msgs::msg::Shape::BOUNDING_BOX) {
-          const double & length_m = obj.shape.dimensions.x / 2;
-          const double & width_m = obj.shape.dimensions.y / 2;
-          object_polygon = convertBoundingBoxObjectToGeometryPolygon(
-            obj.kinematics.initial_pose_with_covariance.pose, length_m, length_m, width_m);
-          createOneStepPolygon(
-            p_front, p_back, one_step_move_collision_polygon, vehicle_info,
-            stop_param.vehicle_lateral_margin);
-
-          found_collision_object = bg::intersects(one_step_move_collision_polygon, object_polygon);
-        } else if (obj.shape.type == autoware_auto_perception_msgs::msg::Shape::POLYGON) {
-          object_polygon = convertPolygonObjectToGeometryPolygon(
-            obj.kinematics.initial_pose_with_covariance.pose, obj.shape);
-          createOneStepPolygon(
-            p_front, p_back, one_step_move_collision_polygon, vehicle_info,
-            stop_param.unknown_lateral_margin);
-
-          found_collision_object = bg::intersects(one_step_move_collision_polygon, object_polygon);
-        } else {
+        const auto lateral_margin = getLateralMargin(
+          obj.shape, stop_param.pedestrian_lateral_margin, stop_param.vehicle_lateral_margin,
+          stop_param.unknown_lateral_margin);
+        if (!lateral_margin) {
           RCLCPP_WARN_THROTTLE(
             get_logger(), *get_clock(), 3000, "Object type is not supported. type: %d",
             obj.shape.type);
           continue;
         }
-        if (found_collision_object) {
-          geometry_msgs::msg::PoseArray collision_points_tmp;
+        if (!overlaps_bounding_circle(p_front, p_back, j, *lateral_margin)) {
+          continue;
+        }
 
-          std::vector<Point2d> collision_point;
-          bg::intersection(one_step_move_collision_polygon, object_polygon, collision_point);
-          for (const auto & point : collision_point) {
+        const auto & one_step_move_collision_polygon = one_step_polygons.get(*lateral_margin);
+        const auto & object_polygon =
+          object_footprints_ptr->at(filtered_object_indices.at(j)).polygon;
+        if (!bg::intersects(one_step_move_collision_polygon, object_polygon)) {
+          continue;
+        }
+
+        geometry_msgs::msg::PoseArray collision_points_tmp;
+
+        std::vector<Point2d> collision_point;
+        bg::intersection(one_step_move_collision_polygon, object_polygon, collision_point);
+        for (const auto & point : collision_point) {
+          geometry_msgs::msg::Pose pose;
+          pose.position.x = point.x();
+          pose.position.y = point.y();
+          collision_points_tmp.poses.push_back(pose);
+        }
+
+        // Also check the corner points
+        for (const auto & point : object_polygon.outer()) {
+          if (bg::within(point, one_step_move_collision_polygon)) {
             geometry_msgs::msg::Pose pose;
             pose.position.x = point.x();
             pose.position.y = point.y();
             collision_points_tmp.poses.push_back(pose);
           }
-
-          // Also check the corner points
-          for (const auto & point : object_polygon.outer()) {
-            if (bg::within(point, one_step_move_collision_polygon)) {
-              geometry_msgs::msg::Pose pose;
-              pose.position.x = point.x();
-              pose.position.y = point.y();
-              collision_points_tmp.poses.push_back(pose);
-            }
-          }
-          geometry_msgs::msg::Point nearest_collision_point_tmp;
-          const double norm = getNearestPointAndDistanceForPredictedObject(
-            collision_points_tmp, p_front, &nearest_collision_point_tmp);
-          if (norm < min_collision_norm || !is_init) {
-            min_collision_norm = norm;
-            nearest_collision_point = nearest_collision_point_tmp;
-            is_init = true;
-            nearest_collision_object_index = j;
-          }
+        }
+        geometry_msgs::msg::Point nearest_collision_point_tmp;
+        const double norm = getNearestPointAndDistanceForPredictedObject(
+          collision_points_tmp, p_front, &nearest_collision_point_tmp);
+        if (norm < min_collision_norm || !is_init) {
+          min_collision_norm = norm;
+          nearest_collision_point = nearest_collision_point_tmp;
+          is_init = true;
+          nearest_collision_object_index = j;
         }
       }
       if (is_init) {
@@ -837,10 +839,8 @@ void ObstacleStopPlannerNode::searchPredictedObject(
       }
 
       // only used for pedestrian
-      Polygon2d one_step_move_collision_dbg;
-      createOneStepPolygon(
-        p_front, p_back, one_step_move_collision_dbg, vehicle_info,
-        stop_param.pedestrian_lateral_margin);
+      const auto & one_step_move_collision_dbg =
+        one_step_polygons.get(stop_param.pedestrian_lateral_margin);
       if (node_param_.enable_z_axis_obstacle_filtering) {
         debug_ptr_->pushPolyhedron(
           one_step_move_collision_dbg, z_axis_min, z_axis_max, PolygonType::Vehicle);
@@ -862,6 +862,7 @@ void ObstacleStopPlannerNode::searchPredictedObject(
     const auto z_axis_min = p_front.position.z;
     const auto z_axis_max =
       p_front.position.z + vehicle_info.vehicle_height_m + node_param_.z_axis_filtering_buffer;
+    OneStepPolygons one_step_polygons(p_front, p_back, vehicle_info);
 
     double min_collision_norm = 0.0;
     bool is_init = false;
@@ -878,30 +879,17 @@ void ObstacleStopPlannerNode::searchPredictedObject(
       Point2d collision_point;
       collision_point.x() = predicted_object_history_.at(j).point.x;
       collision_point.y() = predicted_object_history_.at(j).point.y;
-      Polygon2d one_step_move_vehicle_polygon;
       // create one step polygon for vehicle
-      if (obj.shape.type == autoware_auto_perception_msgs::msg::Shape::CYLINDER) {
-        createOneStepPolygon(
-          p_front, p_back, one_step_move_vehicle_polygon, vehicle_info,
-          stop_param.pedestrian_lateral_margin);
-
-      } else if (obj.shape.type == autoware_auto_perception_msgs::msg::Shape::BOUNDING_BOX) {
-        createOneStepPolygon(
-          p_front, p_back, one_step_move_vehicle_polygon, vehicle_info,
-          stop_param.vehicle_lateral_margin);
-
-      } else if (obj.shape.type == autoware_auto_perception_msgs::msg::Shape::POLYGON) {
-        createOneStepPolygon(
-          p_front, p_back, one_step_move_vehicle_polygon, vehicle_info,
-          stop_param.unknown_lateral_margin);
-
-      } else {
+      const auto lateral_margin = getLateralMargin(
+        obj.shape, stop_param.pedestrian_lateral_margin, stop_param.vehicle_lateral_margin,
+        stop_param.unknown_lateral_margin);
+      if (!lateral_margin) {
         RCLCPP_WARN_THROTTLE(
           get_logger(), *get_clock(), 3000, "Object type is not supported. type: %d",
           obj.shape.type);
         continue;
       }
-      if (bg::within(collision_point, one_step_move_vehicle_polygon)) {
+      if (bg::within(collision_point, one_step_polygons.get(*lateral_margin))) {
         const double norm = calcDistance2d(predicted_object_history_.at(j).point, p_front.position);
         if (norm < min_collision_norm || !is_init) {
           min_collision_norm = norm;
@@ -924,29 +912,22 @@ void ObstacleStopPlannerNode::searchPredictedObject(
         predicted_object_history_.at(nearest_collision_object_index).detection_time;
 
       // create one step polygon for vehicle collision debug
-      Polygon2d one_step_move_vehicle_polygon;
       Polygon2d object_polygon{};
 
       const auto & obj = predicted_object_history_.at(nearest_collision_object_index).object;
+      const auto & one_step_move_vehicle_polygon = one_step_polygons.get(*getLateralMargin(
+        obj.shape, stop_param.pedestrian_lateral_margin, stop_param.vehicle_lateral_margin,
+        stop_param.unknown_lateral_margin));
       if (obj.shape.type == autoware_auto_perception_msgs::msg::Shape::CYLINDER) {
-        createOneStepPolygon(
-          p_front, p_back, one_step_move_vehicle_polygon, vehicle_info,
-          stop_param.pedestrian_lateral_margin);
         object_polygon = convertCylindricalObjectToGeometryPolygon(
           obj.kinematics.initial_pose_with_covariance.pose, obj.shape);
       } else if (obj.shape.type == autoware_auto_perception_msgs::msg::Shape::BOUNDING_BOX) {
-        createOneStepPolygon(
-          p_front, p_back, one_step_move_vehicle_polygon, vehicle_info,
-          stop_param.vehicle_lateral_margin);
         const double & length_m = obj.shape.dimensions.x / 2;
         const double & width_m = obj.shape.dimensions.y / 2;
         object_polygon = convertBoundingBoxObjectToGeometryPolygon(
           obj.kinematics.initial_pose_with_covariance.pose, length_m, length_m, width_m);
 
       } else if (obj.shape.type == autoware_auto_perception_msgs::msg::Shape::POLYGON) {
-        createOneStepPolygon(
-          p_front, p_back, one_step_move_vehicle_polygon, vehicle_info,
-          stop_param.unknown_lateral_margin);
         object_polygon = convertPolygonObjectToGeometryPolygon(
           obj.kinematics.initial_pose_with_covariance.pose, obj.shape);
       }
@@ -965,10 +946,8 @@ void ObstacleStopPlannerNode::searchPredictedObject(
       }
 
       planner_data.stop_require = planner_data.found_collision_points;
-      mutex_.lock();
-      const auto current_odometry_ptr = current_odometry_ptr_;
-      const auto latest_object_ptr = object_ptr_;
-      mutex_.unlock();
+      const auto current_odometry_ptr = current_odometry_mailbox_.load();
+      const auto latest_object_ptr = object_mailbox_.load()->objects;
       // find latest state of predicted object to get latest velocity and acceleration values
       auto obj_latest_state = getObstacleFromUuid(*latest_object_ptr, obj.object_id);
       if (!obj_latest_state) {
@@ -1412,23 +1391,24 @@ void ObstacleStopPlannerNode::insertSlowDownSection(
 
 void ObstacleStopPlannerNode::onDynamicObjects(const PredictedObjects::ConstSharedPtr input_msg)
 {
-  std::lock_guard<std::mutex> lock(mutex_);
+  auto object_footprints_ptr =
+    std::make_shared<const std::vector<ObjectFootprint>>(createObjectFootprints(*input_msg));
+  auto object_rtree_ptr =
+    std::make_shared<const ObjectRtree>(createObjectRtree(*input_msg, *object_footprints_ptr));
 
-  object_ptr_ = input_msg;
+  object_mailbox_.store(std::make_shared<const ObjectData>(
+    ObjectData{input_msg, std::move(object_rtree_ptr), std::move(object_footprints_ptr)}));
 }
 
 void ObstacleStopPlannerNode::onOdometry(const Odometry::ConstSharedPtr input_msg)
 {
-  // mutex for current_acc_, lpf_acc_
-  std::lock_guard<std::mutex> lock(mutex_);
-  current_odometry_ptr_ = input_msg;
+  current_odometry_mailbox_.store(input_msg);
 }
 
 void ObstacleStopPlannerNode::onAcceleration(
   const AccelWithCovarianceStamped::ConstSharedPtr input_msg)
 {
-  std::lock_guard<std::mutex> lock(mutex_);
-  current_acceleration_ptr_ = input_msg;
+  current_acceleration_mailbox_.store(input_msg);
 }
 
 TrajectoryPoints ObstacleStopPlannerNode::trimTrajectoryWithIndexFromSelfPose(
@@ -1466,36 +1446,39 @@ bool ObstacleStopPlannerNode::searchPointcloudNearTrajectory(
     return false;
   }
 
-  PointCloud2 transformed_points{};
   const Eigen::Matrix4f affine_matrix =
     tf2::transformToEigen(transform_stamped.transform).matrix().cast<float>();
-  pcl_ros::transformPointCloud(affine_matrix, *input_points_ptr, transformed_points);
-  PointCloud::Ptr transformed_points_ptr(new PointCloud);
-  pcl::fromROSMsg(transformed_points, *transformed_points_ptr);
 
-  output_points_ptr->header = transformed_points_ptr->header;
+  // NOTE: the header is kept as it is, the same as pcl_ros::transformPointCloud
+  pcl_conversions::toPCL(input_points_ptr->header, output_points_ptr->header);
 
   // search obstacle candidate pointcloud to reduce calculation cost
   const double search_radius = node_param_.enable_slow_down
                                  ? slow_down_param_.slow_down_search_radius
                                  : stop_param.stop_search_radius;
-  const double squared_radius = search_radius * search_radius;
   std::vector<geometry_msgs::msg::Point> center_points;
   center_points.reserve(trajectory.size());
   for (const auto & trajectory_point : trajectory) {
     center_points.push_back(getVehicleCenterFromBase(trajectory_point.pose, vehicle_info).position);
   }
-  for (const auto & point : transformed_points_ptr->points) {
-    for (const auto & center_point : center_points) {
-      const double x = center_point.x - point.x;
-      const double y = center_point.y - point.y;
-      const double squared_distance = x * x + y * y;
-      if (squared_distance < squared_radius) {
-        output_points_ptr->points.push_back(point);
-        break;
-      }
+  FlatSpatialHash2d center_point_hash(
+    std::max(std::abs(search_radius), std::numeric_limits<double>::epsilon()));
+  center_point_hash.build(center_points.begin(), center_points.end());
+
+  // transform and check each point directly on the message buffer
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(*input_points_ptr, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(*input_points_ptr, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(*input_points_ptr, "z");
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    const Eigen::Vector4f point =
+      affine_matrix * Eigen::Vector4f(*iter_x, *iter_y, *iter_z, 1.0f);
+    if (center_point_hash.visit_within_radius(
+          point.x(), point.y(), std::abs(search_radius), [](const size_t) { return true; })) {
+      output_points_ptr->points.emplace_back(point.x(), point.y(), point.z());
     }
   }
+  output_points_ptr->width = output_points_ptr->points.size();
+  output_points_ptr->height = 1;
   return true;
 }
 
@@ -1546,11 +1529,13 @@ void ObstacleStopPlannerNode::resetExternalVelocityLimit(
 
 void ObstacleStopPlannerNode::filterObstacles(
   const PredictedObjects & input_objects, const Pose & ego_pose, const TrajectoryPoints & traj,
-  const double dist_threshold, PredictedObjects & filtered_objects)
+  const double dist_threshold, PredictedObjects & filtered_objects,
+  std::vector<size_t> & filtered_object_indices)
 {
   filtered_objects.header = input_objects.header;
 
-  for (auto & object : input_objects.objects) {
+  for (size_t i = 0; i < input_objects.objects.size(); ++i) {
+    const auto & object = input_objects.objects.at(i);
     // Check is it in front of ego vehicle
     if (!isFrontObstacle(ego_pose, object.kinematics.initial_pose_with_covariance.pose.position)) {
       continue;
@@ -1581,6 +1566,7 @@ void ObstacleStopPlannerNode::filterObstacles(
     }
     PredictedObject filtered_object = object;
     filtered_objects.objects.push_back(filtered_object);
+    filtered_object_indices.push_back(i);
   }
 }
 
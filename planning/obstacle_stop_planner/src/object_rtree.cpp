@@ -0,0 +1,108 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "obstacle_stop_planner/object_rtree.hpp"
+
+#include "obstacle_stop_planner/planner_utils.hpp"
+
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <utility>
+
+namespace motion_planning
+{
+using autoware_auto_perception_msgs::msg::Shape;
+
+std::vector<ObjectFootprint> createObjectFootprints(const PredictedObjects & objects)
+{
+  std::vector<ObjectFootprint> footprints;
+  footprints.reserve(objects.objects.size());
+
+  for (const auto & obj : objects.objects) {
+    const auto & pose = obj.kinematics.initial_pose_with_covariance.pose;
+
+    ObjectFootprint footprint{};
+    footprint.center = Point2d{pose.position.x, pose.position.y};
+    if (obj.shape.type == Shape::CYLINDER) {
+      footprint.polygon = convertCylindricalObjectToGeometryPolygon(pose, obj.shape);
+    } else if (obj.shape.type == Shape::BOUNDING_BOX) {
+      const double & length_m = obj.shape.dimensions.x / 2;
+      const double & width_m = obj.shape.dimensions.y / 2;
+      footprint.polygon =
+        convertBoundingBoxObjectToGeometryPolygon(pose, length_m, length_m, width_m);
+    } else if (obj.shape.type == Shape::POLYGON && !obj.shape.footprint.points.empty()) {
+      footprint.polygon = convertPolygonObjectToGeometryPolygon(pose, obj.shape);
+    }
+
+    footprint.radius = 0.0;
+    for (const auto & point : footprint.polygon.outer()) {
+      footprint.radius = std::max(
+        footprint.radius,
+        std::hypot(point.x() - footprint.center.x(), point.y() - footprint.center.y()));
+    }
+
+    footprints.push_back(std::move(footprint));
+  }
+
+  return footprints;
+}
+
+ObjectRtree createObjectRtree(
+  const PredictedObjects & objects, const std::vector<ObjectFootprint> & footprints)
+{
+  std::vector<std::pair<ObjectBox, size_t>> boxes;
+  boxes.reserve(objects.objects.size());
+
+  for (size_t i = 0; i < objects.objects.size(); ++i) {
+    const auto & obj = objects.objects.at(i);
+    const auto & footprint = footprints.at(i);
+
+    // the adaptive cruise controller checks the box of the dimensions regardless of the shape type
+    const double radius = std::hypot(obj.shape.dimensions.x, obj.shape.dimensions.y) / 2.0;
+    auto box = createBoxAroundPoint(footprint.center, radius);
+    if (!footprint.polygon.outer().empty()) {
+      bg::expand(box, bg::return_envelope<ObjectBox>(footprint.polygon));
+    }
+
+    boxes.emplace_back(box, i);
+  }
+
+  // packing algorithm is used when constructed with a range
+  return ObjectRtree(boxes.begin(), boxes.end());
+}
+
+std::vector<size_t> searchObjectIndices(const ObjectRtree & rtree, const ObjectBox & query_box)
+{
+  std::vector<std::pair<ObjectBox, size_t>> result;
+  rtree.query(boost::geometry::index::intersects(query_box), std::back_inserter(result));
+
+  std::vector<size_t> indices;
+  indices.reserve(result.size());
+  for (const auto & value : result) {
+    indices.push_back(value.second);
+  }
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+
+ObjectBox createBoxAroundPoint(const Point2d & point, const double radius)
+{
+  const double r = std::abs(radius);
+  return ObjectBox{Point2d{point.x() - r, point.y() - r}, Point2d{point.x() + r, point.y() + r}};
+}
+}  // namespace motion_planning
@@ -14,12 +14,15 @@
 
 #include "obstacle_stop_planner/planner_utils.hpp"
 
+#include <geometry/flat_spatial_hash.hpp>
 #include <motion_utils/distance/distance.hpp>
 #include <motion_utils/trajectory/tmp_conversion.hpp>
 #include <motion_utils/trajectory/trajectory.hpp>
 #include <tier4_autoware_utils/geometry/boost_polygon_utils.hpp>
+#include <tier4_autoware_utils/geometry/convex_polygon_utils.hpp>
 
 #include <diagnostic_msgs/msg/key_value.hpp>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
 
 #include <boost/format.hpp>
 #include <boost/geometry/algorithms/convex_hull.hpp>
@@ -29,9 +32,14 @@
 
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace motion_planning
 {
 
+using autoware::common::geometry::spatial_hash::FlatSpatialHash2d;
 using autoware_auto_perception_msgs::msg::PredictedObject;
 using autoware_auto_perception_msgs::msg::PredictedObjects;
 using motion_utils::calcDecelDistWithJerkAndAccConstraints;
@@ -362,6 +370,48 @@ void createOneStepPolygon(
   boost::geometry::convex_hull(polygon, hull_polygon);
 }
 
+bool mayIntersectOneStepPolygon(
+  const Pose & base_step_pose, const Pose & next_step_pose, const VehicleInfo & vehicle_info,
+  const double expand_width, const Point2d & center, const double radius)
+{
+  const double footprint_radius = std::hypot(
+    std::max(vehicle_info.max_longitudinal_offset_m, vehicle_info.rear_overhang_m),
+    vehicle_info.vehicle_width_m / 2.0 + expand_width);
+
+  // distance from the center to the segment between the base_link positions
+  const double seg_x = next_step_pose.position.x - base_step_pose.position.x;
+  const double seg_y = next_step_pose.position.y - base_step_pose.position.y;
+  const double diff_x = center.x() - base_step_pose.position.x;
+  const double diff_y = center.y() - base_step_pose.position.y;
+  const double seg_length_sq = seg_x * seg_x + seg_y * seg_y;
+  const double ratio =
+    0.0 < seg_length_sq ? std::clamp((diff_x * seg_x + diff_y * seg_y) / seg_length_sq, 0.0, 1.0)
+                        : 0.0;
+  const double dist = std::hypot(diff_x - ratio * seg_x, diff_y - ratio * seg_y);
+
+  return dist <= footprint_radius + radius;
+}
+
+OneStepPolygons::OneStepPolygons(
+  const Pose & base_step_pose, const Pose & next_step_pose, const VehicleInfo & vehicle_info)
+: base_step_pose_(base_step_pose), next_step_pose_(next_step_pose), vehicle_info_(vehicle_info)
+{
+}
+
+const Polygon2d & OneStepPolygons::get(const double expand_width)
+{
+  for (const auto & [width, polygon] : polygons_) {
+    if (width == expand_width) {
+      return polygon;
+    }
+  }
+
+  polygons_.emplace_back(expand_width, Polygon2d{});
+  createOneStepPolygon(
+    base_step_pose_, next_step_pose_, polygons_.back().second, vehicle_info_, expand_width);
+  return polygons_.back().second;
+}
+
 void insertStopPoint(
   const StopPoint & stop_point, TrajectoryPoints & output, DiagnosticStatus & stop_reason_diag)
 {
@@ -716,4 +766,194 @@ double calcObstacleMaxLength(const autoware_auto_perception_msgs::msg::Shape & s
   throw std::logic_error("The shape type is not supported in obstacle_cruise_planner.");
 }
 
+boost::optional<double> getLateralMargin(
+  const autoware_auto_perception_msgs::msg::Shape & shape, const double pedestrian_margin,
+  const double vehicle_margin, const double unknown_margin)
+{
+  if (shape.type == autoware_auto_perception_msgs::msg::Shape::CYLINDER) {
+    return pedestrian_margin;
+  } else if (shape.type == autoware_auto_perception_msgs::msg::Shape::BOUNDING_BOX) {
+    return vehicle_margin;
+  } else if (shape.type == autoware_auto_perception_msgs::msg::Shape::POLYGON) {
+    return unknown_margin;
+  }
+  return boost::none;
+}
+
+StepPointBuckets::StepPointBuckets(
+  const PointCloud & points, const std::vector<Point> & center_points, const double radius)
+: points_(points), center_points_(center_points)
+{
+  origin_ = center_points_.empty() ? Point{} : center_points_.front();
+  const size_t step_num = center_points_.empty() ? 0 : center_points_.size() - 1;
+
+  // steps of each point
+  const double search_radius = std::abs(radius);
+  FlatSpatialHash2d center_point_hash(
+    std::max(search_radius, std::numeric_limits<double>::epsilon()));
+  center_point_hash.build(center_points_.begin(), center_points_.end());
+  std::vector<std::vector<size_t>> buckets(step_num);
+  std::vector<size_t> near_center_indices;
+  for (size_t point_idx = 0; point_idx < points_.size(); ++point_idx) {
+    const auto & point = points_.at(point_idx);
+    center_point_hash.radius_search(point.x, point.y, search_radius, near_center_indices);
+    for (const size_t center_idx : near_center_indices) {
+      // the center is the end of the previous step and the start of the next step
+      if (0 < center_idx && center_idx - 1 < step_num) {
+        auto & bucket = buckets.at(center_idx - 1);
+        if (bucket.empty() || bucket.back() != point_idx) {
+          bucket.push_back(point_idx);
+        }
+      }
+      if (center_idx < step_num) {
+        auto & bucket = buckets.at(center_idx);
+        if (bucket.empty() || bucket.back() != point_idx) {
+          bucket.push_back(point_idx);
+        }
+      }
+    }
+  }
+
+  offsets_.reserve(step_num + 1);
+  offsets_.push_back(0);
+  for (const auto & bucket : buckets) {
+    offsets_.push_back(offsets_.back() + bucket.size());
+  }
+  point_indices_.reserve(offsets_.back());
+  xs_.reserve(offsets_.back());
+  ys_.reserve(offsets_.back());
+  zs_.reserve(offsets_.back());
+  for (const auto & bucket : buckets) {
+    for (const size_t point_idx : bucket) {
+      const auto & point = points_.at(point_idx);
+      point_indices_.push_back(point_idx);
+      xs_.push_back(static_cast<float>(point.x - origin_.x));
+      ys_.push_back(static_cast<float>(point.y - origin_.y));
+      zs_.push_back(point.z);
+    }
+  }
+}
+
+bool StepPointBuckets::searchPointsWithinPolygon(
+  const size_t step_idx, const Polygon2d & convex_polygon, const double radius,
+  std::vector<size_t> & within_indices, const double z_min, const double z_max) const
+{
+  if (offsets_.size() <= step_idx + 1) {
+    return false;
+  }
+  const size_t begin = offsets_.at(step_idx);
+  const size_t size = offsets_.at(step_idx + 1) - begin;
+  const float * xs = xs_.data() + begin;
+  const float * ys = ys_.data() + begin;
+  const float * zs = zs_.data() + begin;
+
+  is_within_.assign(size, 1);
+  uint8_t * is_within = is_within_.data();
+
+  // strictly closer than the radius to either end of the step
+  const float squared_radius = static_cast<float>(radius * radius);
+  const float prev_x = static_cast<float>(center_points_.at(step_idx).x - origin_.x);
+  const float prev_y = static_cast<float>(center_points_.at(step_idx).y - origin_.y);
+  const float next_x = static_cast<float>(center_points_.at(step_idx + 1).x - origin_.x);
+  const float next_y = static_cast<float>(center_points_.at(step_idx + 1).y - origin_.y);
+  for (size_t i = 0; i < size; ++i) {
+    const float prev_dx = xs[i] - prev_x;
+    const float prev_dy = ys[i] - prev_y;
+    const float next_dx = xs[i] - next_x;
+    const float next_dy = ys[i] - next_y;
+    is_within[i] &= static_cast<uint8_t>(
+      (prev_dx * prev_dx + prev_dy * prev_dy < squared_radius) |
+      (next_dx * next_dx + next_dy * next_dy < squared_radius));
+  }
+
+  // strictly inside of the polygon, which is translated to the origin of the buckets
+  Polygon2d translated_polygon;
+  translated_polygon.outer().reserve(convex_polygon.outer().size());
+  for (const auto & p : convex_polygon.outer()) {
+    translated_polygon.outer().emplace_back(p.x() - origin_.x, p.y() - origin_.y);
+  }
+  is_inside_polygon_.resize(size);
+  tier4_autoware_utils::ConvexPolygonHalfPlanes(translated_polygon)
+    .within(xs, ys, size, is_inside_polygon_.data());
+  for (size_t i = 0; i < size; ++i) {
+    is_within[i] &= is_inside_polygon_[i];
+  }
+
+  const float z_min_f = static_cast<float>(z_min);
+  const float z_max_f = static_cast<float>(z_max);
+  for (size_t i = 0; i < size; ++i) {
+    is_within[i] &= static_cast<uint8_t>((z_min_f < zs[i]) & (zs[i] < z_max_f));
+  }
+
+  bool find_within_points = false;
+  for (size_t i = 0; i < size; ++i) {
+    if (is_within[i]) {
+      within_indices.push_back(point_indices_.at(begin + i));
+      find_within_points = true;
+    }
+  }
+  return find_within_points;
+}
+
+void VoxelGridDownsampler::filter(
+  const PointCloud2 & input, const double leaf_x, const double leaf_y, const double leaf_z,
+  PointCloud2 & output)
+{
+  voxel_idx_map_.clear();
+  voxels_.clear();
+
+  // accumulate points in each voxel
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(input, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(input, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(input, "z");
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    const float x = *iter_x;
+    const float y = *iter_y;
+    const float z = *iter_z;
+    if (!std::isfinite(x) || !std::isfinite(y) || !std::isfinite(z)) {
+      continue;
+    }
+
+    const VoxelIndex voxel_idx{
+      static_cast<int64_t>(std::floor(x / leaf_x)), static_cast<int64_t>(std::floor(y / leaf_y)),
+      static_cast<int64_t>(std::floor(z / leaf_z))};
+    const auto result = voxel_idx_map_.emplace(voxel_idx, voxels_.size());
+    if (result.second) {
+      voxels_.push_back(Voxel{0.0, 0.0, 0.0, 0});
+    }
+    auto & voxel = voxels_.at(result.first->second);
+    voxel.sum_x += x;
+    voxel.sum_y += y;
+    voxel.sum_z += z;
+    ++voxel.num_points;
+  }
+
+  // write centroids
+  output.header = input.header;
+  sensor_msgs::PointCloud2Modifier modifier(output);
+  modifier.setPointCloud2FieldsByString(1, "xyz");
+  modifier.resize(voxels_.size());
+  output.is_dense = true;
+
+  sensor_msgs::PointCloud2Iterator<float> out_x(output, "x");
+  sensor_msgs::PointCloud2Iterator<float> out_y(output, "y");
+  sensor_msgs::PointCloud2Iterator<float> out_z(output, "z");
+  for (const auto & voxel : voxels_) {
+    const double num_points = static_cast<double>(voxel.num_points);
+    *out_x = static_cast<float>(voxel.sum_x / num_points);
+    *out_y = static_cast<float>(voxel.sum_y / num_points);
+    *out_z = static_cast<float>(voxel.sum_z / num_points);
+    ++out_x;
+    ++out_y;
+    ++out_z;
+  }
+}
+
+size_t VoxelGridDownsampler::VoxelIndexHash::operator()(const VoxelIndex & index) const
+{
+  // large primes used in spatial hashing
+  return static_cast<size_t>(
+    (static_cast<uint64_t>(index.x) * 73856093) ^ (static_cast<uint64_t>(index.y) * 19349663) ^
+    (static_cast<uint64_t>(index.z) * 83492791));
+}
 }  // namespace motion_planning
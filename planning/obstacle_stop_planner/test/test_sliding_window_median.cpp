@@ -0,0 +1,68 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "obstacle_stop_planner/sliding_window_median.hpp"
+
+#include <gtest/gtest.h>
+
+using motion_planning::SlidingWindowMedian;
+
+TEST(SlidingWindowMedian, Median)
+{
+  SlidingWindowMedian<8> que;
+  EXPECT_TRUE(que.empty());
+
+  que.push(0.0, 3.0);
+  EXPECT_DOUBLE_EQ(que.median(), 3.0);
+  que.push(0.1, 1.0);
+  EXPECT_DOUBLE_EQ(que.median(), 2.0);
+  que.push(0.2, 5.0);
+  EXPECT_DOUBLE_EQ(que.median(), 3.0);
+  que.push(0.3, -1.0);
+  EXPECT_DOUBLE_EQ(que.median(), 2.0);
+  EXPECT_EQ(que.size(), 4u);
+
+  que.clear();
+  EXPECT_TRUE(que.empty());
+}
+
+TEST(SlidingWindowMedian, RemoveOlderThan)
+{
+  SlidingWindowMedian<8> que;
+  que.push(0.0, 10.0);
+  que.push(0.1, 10.0);
+  que.push(0.2, 1.0);
+  que.push(0.3, 2.0);
+  que.push(0.4, 3.0);
+  EXPECT_DOUBLE_EQ(que.median(), 3.0);
+
+  que.removeOlderThan(0.15);
+  EXPECT_EQ(que.size(), 3u);
+  EXPECT_DOUBLE_EQ(que.median(), 2.0);
+
+  que.removeOlderThan(1.0);
+  EXPECT_TRUE(que.empty());
+}
+
+TEST(SlidingWindowMedian, DropOldestWhenFull)
+{
+  SlidingWindowMedian<3> que;
+  que.push(0.0, 100.0);
+  que.push(0.1, 100.0);
+  que.push(0.2, 1.0);
+  que.push(0.3, 2.0);
+  que.push(0.4, 3.0);
+  EXPECT_EQ(que.size(), 3u);
+  EXPECT_DOUBLE_EQ(que.median(), 2.0);
+}
@@ -16,6 +16,8 @@
 #include "obstacle_velocity_limiter/types.hpp"
 
 #include <chrono>
+#include <cstdio>
+#include <limits>
 #include <random>
 
 using obstacle_velocity_limiter::CollisionChecker;
@@ -54,43 +56,53 @@ polygon_t random_polygon()
 
 int main()
 {
-  Obstacles obstacles;
   std::vector<polygon_t> polygons;
   polygons.reserve(100);
   for (auto i = 0; i < 100; ++i) {
     polygons.push_back(random_polygon());
   }
-  for (auto nb_lines = 1lu; nb_lines < 1000lu; nb_lines += 10) {
-    obstacles.lines.push_back(random_line());
-    obstacles.points.clear();
-    for (auto nb_points = 1lu; nb_points < 1000lu; nb_points += 10) {
+  const auto elapsed_ns = [](const auto & start, const auto & end) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  };
+  // construction and check times of each collision checker backend [ns]
+  std::printf(
+    "nb_obstacles, rtree_constr, rtree_check, naive_constr, naive_check, segment_list_constr, "
+    "segment_list_check\n");
+  for (const auto nb_obstacles : {10lu, 100lu, 1000lu, 10000lu, 100000lu}) {
+    Obstacles obstacles;
+    for (auto i = 0lu; i < nb_obstacles; ++i) {
+      obstacles.lines.push_back(random_line());
       obstacles.points.push_back(random_point());
-      const auto rtt_constr_start = std::chrono::system_clock::now();
-      CollisionChecker rtree_collision_checker(obstacles, 0, 0);
-      const auto rtt_constr_end = std::chrono::system_clock::now();
-      const auto naive_constr_start = std::chrono::system_clock::now();
-      CollisionChecker naive_collision_checker(obstacles, nb_points + 1, nb_lines * 100);
-      const auto naive_constr_end = std::chrono::system_clock::now();
-      const auto rtt_check_start = std::chrono::system_clock::now();
-      for (const auto & polygon : polygons)
-        const auto rtree_result = rtree_collision_checker.intersections(polygon);
-      const auto rtt_check_end = std::chrono::system_clock::now();
-      const auto naive_check_start = std::chrono::system_clock::now();
-      for (const auto & polygon : polygons)
-        const auto naive_result = naive_collision_checker.intersections(polygon);
-      const auto naive_check_end = std::chrono::system_clock::now();
-      const auto rtt_constr_time =
-        std::chrono::duration_cast<std::chrono::nanoseconds>(rtt_constr_end - rtt_constr_start);
-      const auto naive_constr_time =
-        std::chrono::duration_cast<std::chrono::nanoseconds>(naive_constr_end - naive_constr_start);
-      const auto rtt_check_time =
-        std::chrono::duration_cast<std::chrono::nanoseconds>(rtt_check_end - rtt_check_start);
-      const auto naive_check_time =
-        std::chrono::duration_cast<std::chrono::nanoseconds>(naive_check_end - naive_check_start);
-      std::printf(
-        "%lu, %lu, %ld, %ld, %ld, %ld\n", nb_lines, nb_points, rtt_constr_time.count(),
-        rtt_check_time.count(), naive_constr_time.count(), naive_check_time.count());
     }
+    const auto rtt_constr_start = std::chrono::system_clock::now();
+    CollisionChecker rtree_collision_checker(obstacles, 0, 0);
+    const auto rtt_constr_end = std::chrono::system_clock::now();
+    const auto naive_constr_start = std::chrono::system_clock::now();
+    CollisionChecker naive_collision_checker(
+      obstacles, std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max());
+    const auto naive_constr_end = std::chrono::system_clock::now();
+    const auto list_constr_start = std::chrono::system_clock::now();
+    CollisionChecker list_collision_checker(obstacles, 0, 0, true);
+    const auto list_constr_end = std::chrono::system_clock::now();
+    const auto rtt_check_start = std::chrono::system_clock::now();
+    for (const auto & polygon : polygons)
+      const auto rtree_result = rtree_collision_checker.intersections(polygon);
+    const auto rtt_check_end = std::chrono::system_clock::now();
+    const auto naive_check_start = std::chrono::system_clock::now();
+    for (const auto & polygon : polygons)
+      const auto naive_result = naive_collision_checker.intersections(polygon);
+    const auto naive_check_end = std::chrono::system_clock::now();
+    const auto list_check_start = std::chrono::system_clock::now();
+    for (const auto & polygon : polygons)
+      const auto list_result = list_collision_checker.intersections(polygon);
+    const auto list_check_end = std::chrono::system_clock::now();
+    std::printf(
+      "%lu, %ld, %ld, %ld, %ld, %ld, %ld\n", nb_obstacles,
+      elapsed_ns(rtt_constr_start, rtt_constr_end), elapsed_ns(rtt_check_start, rtt_check_end),
+      elapsed_ns(naive_constr_start, naive_constr_end),
+      elapsed_ns(naive_check_start, naive_check_end),
+      elapsed_ns(list_constr_start, list_constr_end),
+      elapsed_ns(list_check_start, list_check_end));
   }
   return 0;
 }
@@ -17,6 +17,7 @@
 
 #include "obstacle_velocity_limiter/obstacles.hpp"
 #include "obstacle_velocity_limiter/parameters.hpp"
+#include "obstacle_velocity_limiter/thread_pool.hpp"
 #include "obstacle_velocity_limiter/types.hpp"
 
 #include <autoware_auto_perception_msgs/msg/predicted_objects.hpp>
@@ -71,9 +72,11 @@ multi_polygon_t createPolygonMasks(
 /// some points such that their footprint is a single connected polygon.
 /// @param[in] projections the projection lines
 /// @param[in] lateral_offset offset to create polygons around the lines
+/// @param[in] thread_pool threads used to create the footprints in parallel
 /// @return polygon footprint of each projection lines
 std::vector<polygon_t> createFootprintPolygons(
-  const std::vector<multi_linestring_t> & projected_linestrings, const Float lateral_offset);
+  const std::vector<multi_linestring_t> & projected_linestrings, const Float lateral_offset,
+  ThreadPool & thread_pool);
 
 /// @brief create the footprint polygon from a trajectory
 /// @param[in] trajectory the trajectory for which to create a footprint
@@ -102,9 +105,10 @@ polygon_t createEnvelopePolygon(const std::vector<polygon_t> & footprints);
 /// @details depending on the method used, multiple lines can be created for a same trajectory point
 /// @param[in] trajectory input trajectory
 /// @param[in] params projection parameters
+/// @param[in] thread_pool threads used to project the trajectory points in parallel
 /// @return projection lines for each trajectory point
 std::vector<multi_linestring_t> createProjectedLines(
-  const Trajectory & trajectory, ProjectionParameters & params);
+  const Trajectory & trajectory, ProjectionParameters & params, ThreadPool & thread_pool);
 
 /// @brief limit the velocity of the given trajectory
 /// @param[in] trajectory input trajectory
@@ -113,10 +117,12 @@ std::vector<multi_linestring_t> createProjectedLines(
 /// @param[in] footprints footprint of the forward projection at each trajectory point
 /// @param[in] projection_params projection parameters
 /// @param[in] velocity_params velocity parameters
+/// @param[in] thread_pool threads used to calculate the distances to collision in parallel
 void limitVelocity(
   Trajectory & trajectory, const CollisionChecker & collision_checker,
   const std::vector<multi_linestring_t> & projections, const std::vector<polygon_t> & footprints,
-  ProjectionParameters & projection_params, const VelocityParameters & velocity_params);
+  ProjectionParameters & projection_params, const VelocityParameters & velocity_params,
+  ThreadPool & thread_pool);
 
 /// @brief copy the velocity profile of a downsampled trajectory to the original trajectory
 /// @param[in] downsampled_trajectory downsampled trajectory
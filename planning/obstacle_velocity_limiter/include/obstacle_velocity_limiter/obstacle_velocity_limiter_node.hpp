@@ -16,7 +16,9 @@
 #define OBSTACLE_VELOCITY_LIMITER__OBSTACLE_VELOCITY_LIMITER_NODE_HPP_
 
 #include "obstacle_velocity_limiter/obstacles.hpp"
+#include "obstacle_velocity_limiter/occupancy_grid_utils.hpp"
 #include "obstacle_velocity_limiter/parameters.hpp"
+#include "obstacle_velocity_limiter/thread_pool.hpp"
 #include "obstacle_velocity_limiter/types.hpp"
 #include "tier4_autoware_utils/ros/logger_level_configure.hpp"
 
@@ -36,6 +38,7 @@
 
 #include <lanelet2_core/LaneletMap.h>
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <set>
@@ -76,6 +79,7 @@ private:
   PointCloud::ConstSharedPtr pointcloud_ptr_;
   lanelet::LaneletMapPtr lanelet_map_ptr_{new lanelet::LaneletMap};
   multi_linestring_t static_map_obstacles_;
+  IncrementalObstacleExtractor occupancy_grid_extractor_;
   nav_msgs::msg::Odometry::ConstSharedPtr current_odometry_ptr_;
 
   // parameters
@@ -86,6 +90,9 @@ private:
   Float distance_buffer_ = static_cast<Float>(declare_parameter<Float>("distance_buffer"));
   Float vehicle_lateral_offset_;
   Float vehicle_front_offset_;
+  // persistent threads for the calculations at each trajectory point
+  ThreadPool thread_pool_{
+    static_cast<size_t>(std::max<int64_t>(1, declare_parameter<int64_t>("nb_threads")))};
 
   OnSetParametersCallbackHandle::SharedPtr set_param_res_;
 
@@ -16,6 +16,7 @@
 #define OBSTACLE_VELOCITY_LIMITER__OBSTACLES_HPP_
 
 #include "obstacle_velocity_limiter/parameters.hpp"
+#include "obstacle_velocity_limiter/segment_list.hpp"
 #include "obstacle_velocity_limiter/types.hpp"
 
 #include <tier4_autoware_utils/ros/transform_listener.hpp>
@@ -37,6 +38,8 @@
 
 namespace obstacle_velocity_limiter
 {
+class IncrementalObstacleExtractor;
+
 
 struct Obstacles
 {
@@ -115,11 +118,23 @@ struct CollisionChecker
   const Obstacles obstacles;
   std::unique_ptr<ObstacleTree<multipoint_t>> point_obstacle_tree_ptr;
   std::unique_ptr<ObstacleTree<multi_linestring_t>> line_obstacle_tree_ptr;
-
+  std::unique_ptr<SegmentList> segment_list_ptr;
+
+  /// @brief constructor
+  /// @param [in] obs obstacles
+  /// @param [in] rtree_min_points from this number of points, a rtree is used
+  /// @param [in] rtree_min_segments from this number of segments, a rtree is used
+  /// @param [in] use_segment_list if true, flat arrays of the obstacles are scanned instead of
+  /// using rtrees and the min numbers are ignored
   explicit CollisionChecker(
-    Obstacles obs, const size_t rtree_min_points, const size_t rtree_min_segments)
+    Obstacles obs, const size_t rtree_min_points, const size_t rtree_min_segments,
+    const bool use_segment_list = false)
   : obstacles(std::move(obs))
   {
+    if (use_segment_list) {
+      segment_list_ptr = std::make_unique<SegmentList>(obstacles.lines, obstacles.points);
+      return;
+    }
     auto segment_count = 0lu;
     for (const auto & line : obstacles.lines)
       if (!line.empty()) segment_count += line.size() - 1;
@@ -131,6 +146,7 @@ struct CollisionChecker
 
   [[nodiscard]] std::vector<point_t> intersections(const polygon_t & polygon) const
   {
+    if (segment_list_ptr) return segment_list_ptr->intersections(polygon);
     std::vector<point_t> result;
     if (line_obstacle_tree_ptr) {
       result = line_obstacle_tree_ptr->intersections(polygon);
@@ -174,10 +190,12 @@ multi_polygon_t createObjectPolygons(
 /// @param[in] transform_listener object used to retrieve the latest transform
 /// @param[in] target_frame frame of the returned obstacles
 /// @param[in] obstacle_params obstacle parameters
+/// @param[in, out] occupancy_grid_extractor extractor reusing the obstacles of the previous grid
 void addSensorObstacles(
   Obstacles & obstacles, const OccupancyGrid & occupancy_grid, const PointCloud & pointcloud,
   const ObstacleMasks & masks, tier4_autoware_utils::TransformListener & transform_listener,
-  const std::string & target_frame, const ObstacleParameters & obstacle_params);
+  const std::string & target_frame, const ObstacleParameters & obstacle_params,
+  IncrementalObstacleExtractor & occupancy_grid_extractor);
 
 /// @brief filter obstacles with the given negative and positive masks
 /// @param[in] obstacles obstacles to filter
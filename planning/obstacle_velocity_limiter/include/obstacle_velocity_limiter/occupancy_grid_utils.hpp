@@ -19,9 +19,12 @@
 #include "obstacle_velocity_limiter/types.hpp"
 
 #include <grid_map_core/GridMap.hpp>
+#include <opencv2/core.hpp>
 
 #include <nav_msgs/msg/occupancy_grid.hpp>
 
+#include <vector>
+
 namespace obstacle_velocity_limiter
 {
 
@@ -43,6 +46,34 @@ grid_map::GridMap convertToGridMap(const OccupancyGrid & occupancy_grid);
 /// @return extracted obstacle linestrings
 multi_linestring_t extractObstacles(
   const grid_map::GridMap & grid_map, const OccupancyGrid & occupancy_grid);
+
+/// @brief obstacle extraction that only processes the parts of the grid that changed
+/// @details the grid is divided in square tiles. The obstacles of a tile are extracted again only
+/// if its cells (or the nearby cells impacting the dilate/erode operations) changed since the
+/// previous grid. Otherwise the obstacles of the previous grid are reused. The obstacles are the
+/// same as the ones of extractObstacles but are split at the tile borders.
+class IncrementalObstacleExtractor
+{
+public:
+  /// @brief extract obstacles from a thresholded and masked grid map
+  /// @details all tiles are extracted again if the size, resolution, or origin of the grid changed
+  /// @param[in] grid_map thresholded and masked grid map
+  /// @param[in] occupancy_grid occupancy grid used to create the grid map
+  /// @param[in] tile_size [cells] size of the side of a tile
+  /// @return extracted obstacle linestrings
+  multi_linestring_t extract(
+    const grid_map::GridMap & grid_map, const OccupancyGrid & occupancy_grid, const int tile_size);
+
+  /// @brief number of tiles whose obstacles were extracted during the last call to extract
+  [[nodiscard]] size_t lastDirtyTileCount() const { return dirty_tile_count_; }
+
+private:
+  int tile_size_ = 0;
+  cv::Mat previous_image_;
+  nav_msgs::msg::MapMetaData previous_info_;
+  std::vector<multi_linestring_t> tile_obstacles_;
+  size_t dirty_tile_count_ = 0;
+};
 }  // namespace obstacle_velocity_limiter
 
 #endif  // OBSTACLE_VELOCITY_LIMITER__OCCUPANCY_GRID_UTILS_HPP_
@@ -30,6 +30,7 @@ struct ObstacleParameters
 {
   static constexpr auto DYN_SOURCE_PARAM = "obstacles.dynamic_source";
   static constexpr auto OCC_GRID_THRESH_PARAM = "obstacles.occupancy_grid_threshold";
+  static constexpr auto OCC_GRID_TILE_SIZE_PARAM = "obstacles.occupancy_grid_tile_size";
   static constexpr auto BUFFER_PARAM = "obstacles.dynamic_obstacles_buffer";
   static constexpr auto MIN_VEL_PARAM = "obstacles.dynamic_obstacles_min_vel";
   static constexpr auto MAP_TAGS_PARAM = "obstacles.static_map_tags";
@@ -38,9 +39,11 @@ struct ObstacleParameters
   static constexpr auto IGNORE_DIST_PARAM = "obstacles.ignore_extra_distance";
   static constexpr auto RTREE_SEGMENTS_PARAM = "obstacles.rtree_min_segments";
   static constexpr auto RTREE_POINTS_PARAM = "obstacles.rtree_min_points";
+  static constexpr auto COLLISION_CHECKER_PARAM = "obstacles.collision_checker";
 
   enum { POINTCLOUD, OCCUPANCY_GRID, STATIC_ONLY } dynamic_source = OCCUPANCY_GRID;
   int8_t occupancy_grid_threshold{};
+  int occupancy_grid_tile_size{};
   Float dynamic_obstacles_buffer{};
   Float dynamic_obstacles_min_vel{};
   std::vector<std::string> static_map_tags{};
@@ -49,6 +52,7 @@ struct ObstacleParameters
   Float ignore_extra_distance;
   size_t rtree_min_points{};
   size_t rtree_min_segments{};
+  enum { RTREE, SEGMENT_LIST } collision_checker = RTREE;
 
   ObstacleParameters() = default;
   explicit ObstacleParameters(rclcpp::Node & node)
@@ -56,6 +60,8 @@ struct ObstacleParameters
     updateType(node, node.declare_parameter<std::string>(DYN_SOURCE_PARAM));
     occupancy_grid_threshold =
       static_cast<int8_t>(node.declare_parameter<int>(OCC_GRID_THRESH_PARAM));
+    updateOccupancyGridTileSize(
+      node, static_cast<int>(node.declare_parameter<int>(OCC_GRID_TILE_SIZE_PARAM)));
     dynamic_obstacles_buffer = static_cast<Float>(node.declare_parameter<Float>(BUFFER_PARAM));
     dynamic_obstacles_min_vel = static_cast<Float>(node.declare_parameter<Float>(MIN_VEL_PARAM));
     static_map_tags = node.declare_parameter<std::vector<std::string>>(MAP_TAGS_PARAM);
@@ -65,6 +71,7 @@ struct ObstacleParameters
     updateRtreeMinPoints(node, static_cast<int>(node.declare_parameter<int>(RTREE_POINTS_PARAM)));
     updateRtreeMinSegments(
       node, static_cast<int>(node.declare_parameter<int>(RTREE_SEGMENTS_PARAM)));
+    updateCollisionChecker(node, node.declare_parameter<std::string>(COLLISION_CHECKER_PARAM));
   }
 
   bool updateType(rclcpp::Node & node, const std::string & type)
@@ -85,6 +92,33 @@ struct ObstacleParameters
     return true;
   }
 
+  bool updateCollisionChecker(rclcpp::Node & node, const std::string & type)
+  {
+    if (type == "rtree") {
+      collision_checker = RTREE;
+    } else if (type == "segment_list") {
+      collision_checker = SEGMENT_LIST;
+    } else {
+      collision_checker = RTREE;
+      RCLCPP_WARN(
+        node.get_logger(), "Unknown '%s' value: '%s'. Using default 'rtree'.",
+        COLLISION_CHECKER_PARAM, type.c_str());
+      return false;
+    }
+    return true;
+  }
+
+  bool updateOccupancyGridTileSize(rclcpp::Node & node, const int & size)
+  {
+    if (size < 0) {
+      RCLCPP_WARN(
+        node.get_logger(), "Occupancy grid tile size must be positive. %d was given.", size);
+      return false;
+    }
+    occupancy_grid_tile_size = size;
+    return true;
+  }
+
   bool updateRtreeMinPoints(rclcpp::Node & node, const int & size)
   {
     if (size < 0) {
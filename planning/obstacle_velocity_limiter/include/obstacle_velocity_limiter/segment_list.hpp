@@ -0,0 +1,56 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OBSTACLE_VELOCITY_LIMITER__SEGMENT_LIST_HPP_
+#define OBSTACLE_VELOCITY_LIMITER__SEGMENT_LIST_HPP_
+
+#include "obstacle_velocity_limiter/types.hpp"
+
+#include <vector>
+
+namespace obstacle_velocity_limiter
+{
+/// @brief obstacle segments and points stored as flat arrays of coordinates (structure of arrays)
+/// @details no spatial index is built: each query scans all obstacles with a vectorized bounding
+/// box test and only the remaining candidates are checked against the polygon edges.
+/// Compared to the rtree, construction is a simple copy which is cheaper for the dense obstacles
+/// extracted from an occupancy grid.
+class SegmentList
+{
+public:
+  SegmentList(const multi_linestring_t & lines, const multipoint_t & points);
+
+  /// @brief calculate the intersections with the given polygon
+  /// @details same as the rtree: for a segment crossing the polygon boundary, the crossing points
+  /// are returned and for a segment inside the polygon, its two end points are returned. Points
+  /// inside the polygon are returned. Only the outer ring of the polygon is used.
+  /// @param [in] polygon query polygon
+  /// @return obstacle points intersecting with the polygon
+  [[nodiscard]] std::vector<point_t> intersections(const polygon_t & polygon) const;
+
+  [[nodiscard]] size_t segmentCount() const { return seg_ax_.size(); }
+  [[nodiscard]] size_t pointCount() const { return point_x_.size(); }
+
+private:
+  // segments from (ax, ay) to (bx, by)
+  std::vector<double> seg_ax_;
+  std::vector<double> seg_ay_;
+  std::vector<double> seg_bx_;
+  std::vector<double> seg_by_;
+  std::vector<double> point_x_;
+  std::vector<double> point_y_;
+};
+}  // namespace obstacle_velocity_limiter
+
+#endif  // OBSTACLE_VELOCITY_LIMITER__SEGMENT_LIST_HPP_
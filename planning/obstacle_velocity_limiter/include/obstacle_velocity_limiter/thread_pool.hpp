@@ -0,0 +1,66 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OBSTACLE_VELOCITY_LIMITER__THREAD_POOL_HPP_
+#define OBSTACLE_VELOCITY_LIMITER__THREAD_POOL_HPP_
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace obstacle_velocity_limiter
+{
+/// @brief persistent threads running parallel loops over indices
+class ThreadPool
+{
+public:
+  /// @brief constructor
+  /// @param [in] nb_threads number of threads running the loops, including the calling thread.
+  /// With 0 or 1, the loops run sequentially in the calling thread.
+  explicit ThreadPool(const size_t nb_threads);
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool & operator=(const ThreadPool &) = delete;
+  ~ThreadPool();
+
+  [[nodiscard]] size_t size() const { return workers_.size() + 1; }
+
+  /// @brief call func(i) for each i in [0, size) and wait until all calls are done
+  /// @details each thread is given a fixed contiguous range of indices. func must only write to
+  /// outputs specific to its index so that the results do not depend on the number of threads.
+  /// The first exception thrown by func is rethrown. Must not be called concurrently.
+  /// @param [in] size number of indices
+  /// @param [in] func function called with each index
+  void parallelFor(const size_t size, const std::function<void(const size_t)> & func);
+
+private:
+  void workerLoop(const size_t chunk_idx);
+  void runChunk(const size_t chunk_idx);
+
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable task_cv_;
+  std::condition_variable done_cv_;
+  const std::function<void(const size_t)> * func_ = nullptr;
+  size_t task_size_ = 0;
+  size_t task_id_ = 0;
+  size_t nb_running_workers_ = 0;
+  std::exception_ptr exception_ptr_;
+  bool stop_ = false;
+};
+}  // namespace obstacle_velocity_limiter
+
+#endif  // OBSTACLE_VELOCITY_LIMITER__THREAD_POOL_HPP_
@@ -22,6 +22,9 @@
 #include <boost/geometry.hpp>
 #include <boost/geometry/algorithms/correct.hpp>
 
+#include <optional>
+#include <vector>
+
 namespace obstacle_velocity_limiter
 {
 
@@ -42,13 +45,13 @@ multi_polygon_t createPolygonMasks(
 }
 
 std::vector<polygon_t> createFootprintPolygons(
-  const std::vector<multi_linestring_t> & projected_linestrings, const Float lateral_offset)
+  const std::vector<multi_linestring_t> & projected_linestrings, const Float lateral_offset,
+  ThreadPool & thread_pool)
 {
-  std::vector<polygon_t> footprints;
-  footprints.reserve(projected_linestrings.size());
-  for (const auto & linestrings : projected_linestrings) {
-    footprints.push_back(generateFootprint(linestrings, lateral_offset));
-  }
+  std::vector<polygon_t> footprints(projected_linestrings.size());
+  thread_pool.parallelFor(projected_linestrings.size(), [&](const size_t i) {
+    footprints[i] = generateFootprint(projected_linestrings[i], lateral_offset);
+  });
   return footprints;
 }
 
@@ -96,27 +99,41 @@ polygon_t createEnvelopePolygon(const std::vector<polygon_t> & footprints)
 }
 
 std::vector<multi_linestring_t> createProjectedLines(
-  const Trajectory & trajectory, ProjectionParameters & params)
+  const Trajectory & trajectory, ProjectionParameters & params, ThreadPool & thread_pool)
 {
-  std::vector<multi_linestring_t> projections;
-  projections.reserve(trajectory.points.size());
-  for (const auto & point : trajectory.points) {
-    params.update(point);
-    if (params.model == ProjectionParameters::PARTICLE) {
-      const auto projection = forwardSimulatedSegment(point.pose.position, params);
-      projections.push_back({{projection.first, projection.second}});
+  std::vector<multi_linestring_t> projections(trajectory.points.size());
+  thread_pool.parallelFor(trajectory.points.size(), [&](const size_t i) {
+    const auto & point = trajectory.points[i];
+    auto point_params = params;
+    point_params.update(point);
+    if (point_params.model == ProjectionParameters::PARTICLE) {
+      const auto projection = forwardSimulatedSegment(point.pose.position, point_params);
+      projections[i] = {{projection.first, projection.second}};
     } else {
-      projections.push_back(bicycleProjectionLines(point.pose.position, params));
+      projections[i] = bicycleProjectionLines(point.pose.position, point_params);
     }
-  }
+  });
+  if (!trajectory.points.empty()) params.update(trajectory.points.back());
   return projections;
 }
 
 void limitVelocity(
   Trajectory & trajectory, const CollisionChecker & collision_checker,
   const std::vector<multi_linestring_t> & projections, const std::vector<polygon_t> & footprints,
-  ProjectionParameters & projection_params, const VelocityParameters & velocity_params)
+  ProjectionParameters & projection_params, const VelocityParameters & velocity_params,
+  ThreadPool & thread_pool)
 {
+  // the distances do not depend on each other, only the velocity limits are applied in order
+  std::vector<std::optional<double>> dists_to_collision(trajectory.points.size());
+  thread_pool.parallelFor(trajectory.points.size(), [&](const size_t i) {
+    // First linestring is used to calculate distance
+    if (projections[i].empty()) return;
+    auto point_params = projection_params;
+    point_params.update(trajectory.points[i]);
+    dists_to_collision[i] = distanceToClosestCollision(
+      projections[i][0], footprints[i], collision_checker, point_params);
+  });
+
   Float time = 0.0;
   for (size_t i = 0; i < trajectory.points.size(); ++i) {
     auto & trajectory_point = trajectory.points[i];
@@ -126,11 +143,9 @@ void limitVelocity(
         tier4_autoware_utils::calcDistance2d(prev_point, trajectory_point) /
         prev_point.longitudinal_velocity_mps);
     }
-    // First linestring is used to calculate distance
     if (projections[i].empty()) continue;
     projection_params.update(trajectory_point);
-    const auto dist_to_collision = distanceToClosestCollision(
-      projections[i][0], footprints[i], collision_checker, projection_params);
+    const auto & dist_to_collision = dists_to_collision[i];
     if (dist_to_collision) {
       const auto min_feasible_velocity =
         velocity_params.current_ego_velocity - velocity_params.max_deceleration * time;
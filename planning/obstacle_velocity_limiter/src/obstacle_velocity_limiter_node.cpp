@@ -93,6 +93,9 @@ rcl_interfaces::msg::SetParametersResult ObstacleVelocityLimiterNode::onParamete
     if (parameter.get_name() == "distance_buffer") {
       distance_buffer_ = static_cast<Float>(parameter.as_double());
       projection_params_.extra_length = vehicle_front_offset_ + distance_buffer_;
+    } else if (parameter.get_name() == "nb_threads") {
+      result.successful = false;
+      result.reason = "nb_threads can only be set at startup";
       // Preprocessing parameters
     } else if (parameter.get_name() == PreprocessingParameters::START_DIST_PARAM) {
       preprocessing_params_.start_distance = static_cast<Float>(parameter.as_double());
@@ -128,6 +131,12 @@ rcl_interfaces::msg::SetParametersResult ObstacleVelocityLimiterNode::onParamete
       }
     } else if (parameter.get_name() == ObstacleParameters::OCC_GRID_THRESH_PARAM) {
       obstacle_params_.occupancy_grid_threshold = static_cast<int8_t>(parameter.as_int());
+    } else if (parameter.get_name() == ObstacleParameters::OCC_GRID_TILE_SIZE_PARAM) {
+      if (!obstacle_params_.updateOccupancyGridTileSize(
+            *this, static_cast<int>(parameter.as_int()))) {
+        result.successful = false;
+        result.reason = "occupancy_grid_tile_size must be positive or 0";
+      }
     } else if (parameter.get_name() == ObstacleParameters::BUFFER_PARAM) {
       obstacle_params_.dynamic_obstacles_buffer = static_cast<Float>(parameter.as_double());
     } else if (parameter.get_name() == ObstacleParameters::MIN_VEL_PARAM) {
@@ -147,6 +156,11 @@ rcl_interfaces::msg::SetParametersResult ObstacleVelocityLimiterNode::onParamete
       obstacle_params_.updateRtreeMinPoints(*this, static_cast<int>(parameter.as_int()));
     } else if (parameter.get_name() == ObstacleParameters::RTREE_SEGMENTS_PARAM) {
       obstacle_params_.updateRtreeMinSegments(*this, static_cast<int>(parameter.as_int()));
+    } else if (parameter.get_name() == ObstacleParameters::COLLISION_CHECKER_PARAM) {
+      if (!obstacle_params_.updateCollisionChecker(*this, parameter.as_string())) {
+        result.successful = false;
+        result.reason = "collision_checker value must be 'rtree' or 'segment_list'";
+      }
       // Projection parameters
     } else if (parameter.get_name() == ProjectionParameters::MODEL_PARAM) {
       if (!projection_params_.updateModel(*this, parameter.as_string())) {
@@ -199,9 +213,10 @@ void ObstacleVelocityLimiterNode::onTrajectory(const Trajectory::ConstSharedPtr
   if (obstacle_params_.ignore_on_path)
     obstacle_masks.negative_masks.push_back(createTrajectoryFootprint(
       *msg, vehicle_lateral_offset_ + obstacle_params_.ignore_extra_distance));
-  const auto projected_linestrings = createProjectedLines(downsampled_traj, projection_params_);
+  const auto projected_linestrings =
+    createProjectedLines(downsampled_traj, projection_params_, thread_pool_);
   const auto footprint_polygons =
-    createFootprintPolygons(projected_linestrings, vehicle_lateral_offset_);
+    createFootprintPolygons(projected_linestrings, vehicle_lateral_offset_, thread_pool_);
   Obstacles obstacles;
   obstacles.lines = static_map_obstacles_;
   if (obstacle_params_.dynamic_source != ObstacleParameters::STATIC_ONLY) {
@@ -209,13 +224,15 @@ void ObstacleVelocityLimiterNode::onTrajectory(const Trajectory::ConstSharedPtr
       obstacle_masks.positive_mask = createEnvelopePolygon(footprint_polygons);
     addSensorObstacles(
       obstacles, *occupancy_grid_ptr_, *pointcloud_ptr_, obstacle_masks, transform_listener_,
-      original_traj.header.frame_id, obstacle_params_);
+      original_traj.header.frame_id, obstacle_params_, occupancy_grid_extractor_);
   }
   limitVelocity(
     downsampled_traj,
     CollisionChecker(
-      obstacles, obstacle_params_.rtree_min_points, obstacle_params_.rtree_min_segments),
-    projected_linestrings, footprint_polygons, projection_params_, velocity_params_);
+      obstacles, obstacle_params_.rtree_min_points, obstacle_params_.rtree_min_segments,
+      obstacle_params_.collision_checker == ObstacleParameters::SEGMENT_LIST),
+    projected_linestrings, footprint_polygons, projection_params_, velocity_params_,
+    thread_pool_);
   auto safe_trajectory = copyDownsampledVelocity(
     downsampled_traj, original_traj, start_idx, preprocessing_params_.downsample_factor);
   safe_trajectory.header.stamp = now();
@@ -229,9 +246,9 @@ void ObstacleVelocityLimiterNode::onTrajectory(const Trajectory::ConstSharedPtr
 
   if (pub_debug_markers_->get_subscription_count() > 0) {
     const auto safe_projected_linestrings =
-      createProjectedLines(downsampled_traj, projection_params_);
+      createProjectedLines(downsampled_traj, projection_params_, thread_pool_);
     const auto safe_footprint_polygons =
-      createFootprintPolygons(safe_projected_linestrings, vehicle_lateral_offset_);
+      createFootprintPolygons(safe_projected_linestrings, vehicle_lateral_offset_, thread_pool_);
     pub_debug_markers_->publish(makeDebugMarkers(
       obstacles, projected_linestrings, safe_projected_linestrings, footprint_polygons,
       safe_footprint_polygons, obstacle_masks, occupancy_grid_ptr_->info.origin.position.z));
@@ -78,13 +78,18 @@ multi_polygon_t createObjectPolygons(
 void addSensorObstacles(
   Obstacles & obstacles, const OccupancyGrid & occupancy_grid, const PointCloud & pointcloud,
   const ObstacleMasks & masks, tier4_autoware_utils::TransformListener & transform_listener,
-  const std::string & target_frame, const ObstacleParameters & obstacle_params)
+  const std::string & target_frame, const ObstacleParameters & obstacle_params,
+  IncrementalObstacleExtractor & occupancy_grid_extractor)
 {
   if (obstacle_params.dynamic_source == ObstacleParameters::OCCUPANCY_GRID) {
     auto grid_map = convertToGridMap(occupancy_grid);
     threshold(grid_map, obstacle_params.occupancy_grid_threshold);
     maskPolygons(grid_map, masks);
-    const auto obstacle_lines = extractObstacles(grid_map, occupancy_grid);
+    const auto obstacle_lines =
+      obstacle_params.occupancy_grid_tile_size > 0
+        ? occupancy_grid_extractor.extract(
+            grid_map, occupancy_grid, obstacle_params.occupancy_grid_tile_size)
+        : extractObstacles(grid_map, occupancy_grid);
     obstacles.lines.insert(obstacles.lines.end(), obstacle_lines.begin(), obstacle_lines.end());
   } else if (obstacle_params.dynamic_source == ObstacleParameters::POINTCLOUD) {
     auto pcd = transformPointCloud(pointcloud, transform_listener, target_frame);
@@ -24,6 +24,11 @@
 #include <opencv2/imgproc.hpp>
 #include <opencv2/opencv.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
 namespace obstacle_velocity_limiter
 {
 void maskPolygons(grid_map::GridMap & grid_map, const ObstacleMasks & obstacle_masks)
@@ -69,26 +74,172 @@ grid_map::GridMap convertToGridMap(const OccupancyGrid & occupancy_grid)
   return grid_map;
 }
 
-multi_linestring_t extractObstacles(
-  const grid_map::GridMap & grid_map, const OccupancyGrid & occupancy_grid)
+namespace
+{
+// margin of cells around a tile impacting its dilate/erode results and the contours traced in it
+constexpr int tile_margin = 8;
+
+cv::Mat toImage(const grid_map::GridMap & grid_map)
 {
   cv::Mat cv_image;
   grid_map::GridMapCvConverter::toImage<unsigned char, 1>(grid_map, "layer", CV_8UC1, cv_image);
+  return cv_image;
+}
+
+void closeImage(cv::Mat & cv_image)
+{
   cv::dilate(cv_image, cv_image, cv::Mat(), cv::Point(-1, -1), 2);
   cv::erode(cv_image, cv_image, cv::Mat(), cv::Point(-1, -1), 2);
+}
+
+point_t toMapPoint(const double x, const double y, const nav_msgs::msg::MapMetaData & info)
+{
+  return point_t(
+    (info.width - 1.0 - y) * info.resolution + info.origin.position.x,
+    (info.height - 1.0 - x) * info.resolution + info.origin.position.y);
+}
+
+bool isEqual(const cv::Mat & a, const cv::Mat & b)
+{
+  for (auto row = 0; row < a.rows; ++row)
+    if (std::memcmp(a.ptr(row), b.ptr(row), a.cols * a.elemSize()) != 0) return false;
+  return true;
+}
+
+/// @brief clip segment p-q to the given box (Liang-Barsky)
+/// @param[out] t0 ratio along the segment where the clipped segment starts
+/// @param[out] t1 ratio along the segment where the clipped segment ends
+/// @return false if the segment is outside of the box
+bool clipSegment(
+  const cv::Point2d & p, const cv::Point2d & q, const cv::Rect2d & box, double & t0, double & t1)
+{
+  t0 = 0.0;
+  t1 = 1.0;
+  const auto dx = q.x - p.x;
+  const auto dy = q.y - p.y;
+  for (const auto & [d, dist] :
+       {std::make_pair(-dx, p.x - box.x), std::make_pair(dx, box.x + box.width - p.x),
+        std::make_pair(-dy, p.y - box.y), std::make_pair(dy, box.y + box.height - p.y)}) {
+    if (d == 0.0) {
+      if (dist < 0.0) return false;
+      continue;
+    }
+    const auto t = dist / d;
+    if (d < 0.0)
+      t0 = std::max(t0, t);
+    else
+      t1 = std::min(t1, t);
+    if (t0 > t1) return false;
+  }
+  return true;
+}
+
+/// @brief extract the obstacles of a tile
+/// @param[in] image thresholded and masked image of the whole grid
+/// @param[in] tile cells of the tile
+/// @param[in] roi cells of the tile and of its margin
+/// @param[in] info information of the occupancy grid
+/// @return obstacle linestrings clipped to the tile
+multi_linestring_t extractTileObstacles(
+  const cv::Mat & image, const cv::Rect & tile, const cv::Rect & roi,
+  const nav_msgs::msg::MapMetaData & info)
+{
+  cv::Mat roi_image = image(roi).clone();
+  closeImage(roi_image);
+  std::vector<std::vector<cv::Point>> contours;
+  cv::findContours(roi_image, contours, CV_RETR_LIST, CV_CHAIN_APPROX_SIMPLE);
+  // tiles share their borders, located half a cell away from their outermost cells
+  const cv::Rect2d box(tile.x - 0.5, tile.y - 0.5, tile.width, tile.height);
+  const cv::Point2d offset(roi.x, roi.y);
+  const auto to_map = [&](const cv::Point2d & p) { return toMapPoint(p.x, p.y, info); };
+  multi_linestring_t obstacles;
+  for (const auto & contour : contours) {
+    if (contour.size() == 1) {
+      const auto p = cv::Point2d(contour.front()) + offset;
+      if (box.contains(p)) obstacles.push_back({to_map(p)});
+      continue;
+    }
+    // contours are closed except the ones of lines which are traced back and forth
+    const auto nb_segments = contour.size() > 2 ? contour.size() : 1;
+    linestring_t line;
+    auto line_is_open = false;
+    for (size_t i = 0; i < nb_segments; ++i) {
+      const auto p = cv::Point2d(contour[i]) + offset;
+      const auto q = cv::Point2d(contour[(i + 1) % contour.size()]) + offset;
+      double t0{};
+      double t1{};
+      if (!clipSegment(p, q, box, t0, t1)) {
+        line_is_open = false;
+        continue;
+      }
+      if (!line_is_open || t0 > 0.0) {
+        if (line.size() > 1) obstacles.push_back(line);
+        line = {to_map(p + t0 * (q - p))};
+      }
+      line.push_back(to_map(p + t1 * (q - p)));
+      line_is_open = t1 == 1.0;
+    }
+    if (line.size() > 1) obstacles.push_back(line);
+  }
+  return obstacles;
+}
+}  // namespace
+
+multi_linestring_t extractObstacles(
+  const grid_map::GridMap & grid_map, const OccupancyGrid & occupancy_grid)
+{
+  auto cv_image = toImage(grid_map);
+  closeImage(cv_image);
   std::vector<std::vector<cv::Point>> contours;
   cv::findContours(cv_image, contours, CV_RETR_LIST, CV_CHAIN_APPROX_SIMPLE);
   multi_linestring_t obstacles;
   const auto & info = occupancy_grid.info;
   for (const auto & contour : contours) {
     linestring_t line;
-    for (const auto & point : contour) {
-      line.emplace_back(
-        (info.width - 1.0 - point.y) * info.resolution + info.origin.position.x,
-        (info.height - 1.0 - point.x) * info.resolution + info.origin.position.y);
-    }
+    for (const auto & point : contour) line.push_back(toMapPoint(point.x, point.y, info));
     obstacles.emplace_back(line);
   }
   return obstacles;
 }
+
+multi_linestring_t IncrementalObstacleExtractor::extract(
+  const grid_map::GridMap & grid_map, const OccupancyGrid & occupancy_grid, const int tile_size)
+{
+  const auto image = toImage(grid_map);
+  const auto & info = occupancy_grid.info;
+  const auto nb_tile_rows = (image.rows + tile_size - 1) / tile_size;
+  const auto nb_tile_cols = (image.cols + tile_size - 1) / tile_size;
+  const auto reset = tile_size != tile_size_ || image.size() != previous_image_.size() ||
+                     info.resolution != previous_info_.resolution ||
+                     info.origin.position.x != previous_info_.origin.position.x ||
+                     info.origin.position.y != previous_info_.origin.position.y;
+  if (reset) {
+    tile_size_ = tile_size;
+    tile_obstacles_.assign(static_cast<size_t>(nb_tile_rows * nb_tile_cols), {});
+  }
+
+  const cv::Rect image_rect(0, 0, image.cols, image.rows);
+  dirty_tile_count_ = 0;
+  multi_linestring_t obstacles;
+  for (auto tile_row = 0; tile_row < nb_tile_rows; ++tile_row) {
+    for (auto tile_col = 0; tile_col < nb_tile_cols; ++tile_col) {
+      const auto tile =
+        cv::Rect(tile_col * tile_size, tile_row * tile_size, tile_size, tile_size) & image_rect;
+      const auto roi = cv::Rect(
+                         tile.x - tile_margin, tile.y - tile_margin, tile.width + 2 * tile_margin,
+                         tile.height + 2 * tile_margin) &
+                       image_rect;
+      const auto tile_idx = static_cast<size_t>(tile_row * nb_tile_cols + tile_col);
+      auto & tile_obstacles = tile_obstacles_[tile_idx];
+      if (reset || !isEqual(image(roi), previous_image_(roi))) {
+        tile_obstacles = extractTileObstacles(image, tile, roi, info);
+        ++dirty_tile_count_;
+      }
+      obstacles.insert(obstacles.end(), tile_obstacles.begin(), tile_obstacles.end());
+    }
+  }
+  previous_image_ = image;
+  previous_info_ = info;
+  return obstacles;
+}
 }  // namespace obstacle_velocity_limiter
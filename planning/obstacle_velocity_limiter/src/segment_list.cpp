@@ -0,0 +1,242 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "obstacle_velocity_limiter/segment_list.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace obstacle_velocity_limiter
+{
+namespace
+{
+struct Box
+{
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+};
+
+// edges of a polygon ring without the zero-length ones (e.g., the closing edge)
+struct Edges
+{
+  std::vector<double> px, py, qx, qy;
+};
+
+Edges createEdges(const polygon_t & polygon, Box & box)
+{
+  Edges edges;
+  const auto & ring = polygon.outer();
+  for (size_t i = 0; i < ring.size(); ++i) {
+    const auto & p = ring[i];
+    const auto & q = ring[(i + 1) % ring.size()];
+    box.min_x = std::min(box.min_x, p.x());
+    box.min_y = std::min(box.min_y, p.y());
+    box.max_x = std::max(box.max_x, p.x());
+    box.max_y = std::max(box.max_y, p.y());
+    if (p.x() == q.x() && p.y() == q.y()) continue;
+    edges.px.push_back(p.x());
+    edges.py.push_back(p.y());
+    edges.qx.push_back(q.x());
+    edges.qy.push_back(q.y());
+  }
+  return edges;
+}
+
+/// @brief indices of the segments whose bounding box overlaps the given box
+/// @details points can be checked by giving the same coordinates for both ends
+void searchBoxCandidates(
+  const double * ax, const double * ay, const double * bx, const double * by, const size_t size,
+  const Box & box, std::vector<size_t> & candidates)
+{
+  size_t i = 0;
+#if defined(__AVX2__)
+  constexpr size_t lanes = 4;
+  const __m256d box_min_x = _mm256_set1_pd(box.min_x);
+  const __m256d box_min_y = _mm256_set1_pd(box.min_y);
+  const __m256d box_max_x = _mm256_set1_pd(box.max_x);
+  const __m256d box_max_y = _mm256_set1_pd(box.max_y);
+  for (; i + lanes <= size; i += lanes) {
+    const __m256d x0 = _mm256_loadu_pd(ax + i);
+    const __m256d y0 = _mm256_loadu_pd(ay + i);
+    const __m256d x1 = _mm256_loadu_pd(bx + i);
+    const __m256d y1 = _mm256_loadu_pd(by + i);
+    const __m256d overlap_x = _mm256_and_pd(
+      _mm256_cmp_pd(_mm256_min_pd(x0, x1), box_max_x, _CMP_LE_OQ),
+      _mm256_cmp_pd(box_min_x, _mm256_max_pd(x0, x1), _CMP_LE_OQ));
+    const __m256d overlap_y = _mm256_and_pd(
+      _mm256_cmp_pd(_mm256_min_pd(y0, y1), box_max_y, _CMP_LE_OQ),
+      _mm256_cmp_pd(box_min_y, _mm256_max_pd(y0, y1), _CMP_LE_OQ));
+    auto mask = static_cast<uint32_t>(_mm256_movemask_pd(_mm256_and_pd(overlap_x, overlap_y)));
+    for (; mask != 0; mask &= mask - 1) {
+      candidates.push_back(i + static_cast<size_t>(__builtin_ctz(mask)));
+    }
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  constexpr size_t lanes = 2;
+  const float64x2_t box_min_x = vdupq_n_f64(box.min_x);
+  const float64x2_t box_min_y = vdupq_n_f64(box.min_y);
+  const float64x2_t box_max_x = vdupq_n_f64(box.max_x);
+  const float64x2_t box_max_y = vdupq_n_f64(box.max_y);
+  for (; i + lanes <= size; i += lanes) {
+    const float64x2_t x0 = vld1q_f64(ax + i);
+    const float64x2_t y0 = vld1q_f64(ay + i);
+    const float64x2_t x1 = vld1q_f64(bx + i);
+    const float64x2_t y1 = vld1q_f64(by + i);
+    const uint64x2_t overlap_x =
+      vandq_u64(vcleq_f64(vminq_f64(x0, x1), box_max_x), vcleq_f64(box_min_x, vmaxq_f64(x0, x1)));
+    const uint64x2_t overlap_y =
+      vandq_u64(vcleq_f64(vminq_f64(y0, y1), box_max_y), vcleq_f64(box_min_y, vmaxq_f64(y0, y1)));
+    const uint64x2_t overlap = vandq_u64(overlap_x, overlap_y);
+    if (vgetq_lane_u64(overlap, 0) != 0) candidates.push_back(i);
+    if (vgetq_lane_u64(overlap, 1) != 0) candidates.push_back(i + 1);
+  }
+#endif
+  for (; i < size; ++i) {
+    if (
+      std::min(ax[i], bx[i]) <= box.max_x && box.min_x <= std::max(ax[i], bx[i]) &&
+      std::min(ay[i], by[i]) <= box.max_y && box.min_y <= std::max(ay[i], by[i])) {
+      candidates.push_back(i);
+    }
+  }
+}
+
+bool isOnSegment(const point_t & p, const point_t & q, const point_t & r)
+{
+  return std::min(p.x(), q.x()) <= r.x() && r.x() <= std::max(p.x(), q.x()) &&
+         std::min(p.y(), q.y()) <= r.y() && r.y() <= std::max(p.y(), q.y());
+}
+
+// crossing number test, points on the boundary are inside
+bool isInside(const Edges & edges, const double x, const double y)
+{
+  bool inside = false;
+  for (size_t i = 0; i < edges.px.size(); ++i) {
+    const double cross = (edges.qx[i] - edges.px[i]) * (y - edges.py[i]) -
+                         (edges.qy[i] - edges.py[i]) * (x - edges.px[i]);
+    if (
+      cross == 0.0 && isOnSegment(
+                        point_t(edges.px[i], edges.py[i]), point_t(edges.qx[i], edges.qy[i]),
+                        point_t(x, y))) {
+      return true;
+    }
+    if ((y < edges.py[i]) != (y < edges.qy[i])) {
+      const double x_cross = edges.px[i] + (y - edges.py[i]) * (edges.qx[i] - edges.px[i]) /
+                                             (edges.qy[i] - edges.py[i]);
+      if (x < x_cross) inside = !inside;
+    }
+  }
+  return inside;
+}
+
+// add the points where segment a-b touches the edges, return false if it does not touch any edge
+bool addCrossingPoints(
+  const Edges & edges, const point_t & a, const point_t & b, std::vector<point_t> & result)
+{
+  const double sx = b.x() - a.x();
+  const double sy = b.y() - a.y();
+  bool found = false;
+  for (size_t i = 0; i < edges.px.size(); ++i) {
+    const point_t p(edges.px[i], edges.py[i]);
+    const point_t q(edges.qx[i], edges.qy[i]);
+    const double ex = q.x() - p.x();
+    const double ey = q.y() - p.y();
+    const double d_a = ex * (a.y() - p.y()) - ey * (a.x() - p.x());
+    const double d_b = ex * (b.y() - p.y()) - ey * (b.x() - p.x());
+    const double d_p = sx * (p.y() - a.y()) - sy * (p.x() - a.x());
+    const double d_q = sx * (q.y() - a.y()) - sy * (q.x() - a.x());
+    if (0.0 < d_a * d_b || 0.0 < d_p * d_q) continue;
+    if (d_a == 0.0 && d_b == 0.0) {
+      // collinear: add the end points of the overlap if any
+      for (const auto & [s0, s1, r] : {std::make_tuple(p, q, a), std::make_tuple(p, q, b),
+                                       std::make_tuple(a, b, p), std::make_tuple(a, b, q)}) {
+        if (isOnSegment(s0, s1, r)) {
+          result.push_back(r);
+          found = true;
+        }
+      }
+      continue;
+    }
+    const double ratio = d_a / (d_a - d_b);
+    result.emplace_back(a.x() + ratio * sx, a.y() + ratio * sy);
+    found = true;
+  }
+  return found;
+}
+}  // namespace
+
+SegmentList::SegmentList(const multi_linestring_t & lines, const multipoint_t & points)
+{
+  auto segment_count = 0lu;
+  for (const auto & line : lines)
+    if (!line.empty()) segment_count += line.size() - 1;
+  seg_ax_.reserve(segment_count);
+  seg_ay_.reserve(segment_count);
+  seg_bx_.reserve(segment_count);
+  seg_by_.reserve(segment_count);
+  for (const auto & line : lines) {
+    for (size_t i = 0; i + 1 < line.size(); ++i) {
+      seg_ax_.push_back(line[i].x());
+      seg_ay_.push_back(line[i].y());
+      seg_bx_.push_back(line[i + 1].x());
+      seg_by_.push_back(line[i + 1].y());
+    }
+  }
+  point_x_.reserve(points.size());
+  point_y_.reserve(points.size());
+  for (const auto & point : points) {
+    point_x_.push_back(point.x());
+    point_y_.push_back(point.y());
+  }
+}
+
+std::vector<point_t> SegmentList::intersections(const polygon_t & polygon) const
+{
+  std::vector<point_t> result;
+  Box box;
+  const auto edges = createEdges(polygon, box);
+  if (edges.px.empty()) return result;
+
+  std::vector<size_t> candidates;
+  searchBoxCandidates(
+    seg_ax_.data(), seg_ay_.data(), seg_bx_.data(), seg_by_.data(), seg_ax_.size(), box,
+    candidates);
+  for (const auto i : candidates) {
+    const point_t a(seg_ax_[i], seg_ay_[i]);
+    const point_t b(seg_bx_[i], seg_by_[i]);
+    // a segment not touching the boundary is either fully inside or fully outside
+    if (!addCrossingPoints(edges, a, b, result) && isInside(edges, a.x(), a.y())) {
+      result.push_back(a);
+      result.push_back(b);
+    }
+  }
+
+  candidates.clear();
+  searchBoxCandidates(
+    point_x_.data(), point_y_.data(), point_x_.data(), point_y_.data(), point_x_.size(), box,
+    candidates);
+  for (const auto i : candidates) {
+    if (isInside(edges, point_x_[i], point_y_[i])) result.emplace_back(point_x_[i], point_y_[i]);
+  }
+  return result;
+}
+}  // namespace obstacle_velocity_limiter
@@ -0,0 +1,92 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "obstacle_velocity_limiter/thread_pool.hpp"
+
+#include <utility>
+
+namespace obstacle_velocity_limiter
+{
+ThreadPool::ThreadPool(const size_t nb_threads)
+{
+  // the calling thread runs the first chunk
+  for (size_t chunk_idx = 1; chunk_idx < nb_threads; ++chunk_idx)
+    workers_.emplace_back([this, chunk_idx]() { workerLoop(chunk_idx); });
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  task_cv_.notify_all();
+  for (auto & worker : workers_) worker.join();
+}
+
+void ThreadPool::parallelFor(const size_t size, const std::function<void(const size_t)> & func)
+{
+  if (workers_.empty() || size < 2) {
+    for (size_t i = 0; i < size; ++i) func(i);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    func_ = &func;
+    task_size_ = size;
+    exception_ptr_ = nullptr;
+    nb_running_workers_ = workers_.size();
+    ++task_id_;
+  }
+  task_cv_.notify_all();
+  runChunk(0);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_cv_.wait(lock, [this]() { return nb_running_workers_ == 0; });
+  func_ = nullptr;
+  if (exception_ptr_) std::rethrow_exception(std::exchange(exception_ptr_, nullptr));
+}
+
+void ThreadPool::workerLoop(const size_t chunk_idx)
+{
+  size_t last_task_id = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      task_cv_.wait(lock, [&]() { return stop_ || task_id_ != last_task_id; });
+      if (stop_) return;
+      last_task_id = task_id_;
+    }
+    runChunk(chunk_idx);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --nb_running_workers_;
+    }
+    done_cv_.notify_one();
+  }
+}
+
+void ThreadPool::runChunk(const size_t chunk_idx)
+{
+  const auto begin = task_size_ * chunk_idx / size();
+  const auto end = task_size_ * (chunk_idx + 1) / size();
+  try {
+    for (auto i = begin; i < end; ++i) (*func_)(i);
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!exception_ptr_) exception_ptr_ = std::current_exception();
+  }
+}
+}  // namespace obstacle_velocity_limiter
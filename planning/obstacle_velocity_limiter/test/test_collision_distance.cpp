@@ -27,6 +27,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <random>
 
 const auto point_in_polygon = [](const auto x, const auto y, const auto & polygon) {
   return std::find_if(polygon.outer().begin(), polygon.outer().end(), [=](const auto & pt) {
@@ -151,6 +152,66 @@ TEST(TestCollisionDistance, distanceToClosestCollision)
   EXPECT_NEAR(*result, 2.121, 1e-3);
 }
 
+TEST(TestCollisionDistance, distanceToClosestCollisionSegmentList)
+{
+  using obstacle_velocity_limiter::CollisionChecker;
+  using obstacle_velocity_limiter::distanceToClosestCollision;
+  using obstacle_velocity_limiter::linestring_t;
+  using obstacle_velocity_limiter::point_t;
+  using obstacle_velocity_limiter::polygon_t;
+
+  obstacle_velocity_limiter::ProjectionParameters params;
+  params.model = obstacle_velocity_limiter::ProjectionParameters::PARTICLE;
+  params.heading = M_PI_4;
+  const linestring_t vector = {{0.0, 0.0}, {5.0, 5.0}};
+  polygon_t footprint;
+  footprint.outer() = {{-1.0, 1.0}, {4.0, 6.0}, {6.0, 4.0}, {1.0, -1.0}};
+  boost::geometry::correct(footprint);
+
+  obstacle_velocity_limiter::Obstacles obstacles;
+  const auto distance = [&](const bool use_segment_list) {
+    return distanceToClosestCollision(
+      vector, footprint, CollisionChecker(obstacles, 0lu, 0lu, use_segment_list), params);
+  };
+
+  EXPECT_FALSE(distance(true).has_value());
+
+  // segment crossing the footprint
+  obstacles.lines.push_back(linestring_t{{-2.0, 2.0}, {3.0, -1.0}});
+  ASSERT_TRUE(distance(true).has_value());
+  EXPECT_NEAR(*distance(true), 0.354, 1e-3);
+
+  // segment inside the footprint
+  obstacles.lines.push_back(linestring_t{{0.0, 0.5}, {-0.5, 1.0}});
+  ASSERT_TRUE(distance(true).has_value());
+  EXPECT_NEAR(*distance(true), 0.354, 1e-3);
+
+  // point on the boundary
+  obstacles.points.emplace_back(0.0, 0.0);
+  ASSERT_TRUE(distance(true).has_value());
+  EXPECT_NEAR(*distance(true), 0.0, 1e-3);
+
+  // same distances as the rtree for random obstacles
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> coordinate(-2.0, 7.0);
+  std::uniform_real_distribution<double> offset(-1.0, 1.0);
+  for (auto i = 0; i < 100; ++i) {
+    obstacles.points.clear();
+    obstacles.lines.clear();
+    for (auto j = 0; j < 20; ++j) {
+      const point_t point(coordinate(gen), coordinate(gen));
+      obstacles.points.push_back(point);
+      obstacles.lines.push_back(linestring_t{
+        point, point_t(point.x() + offset(gen), point.y() + offset(gen)),
+        point_t(point.x() + offset(gen), point.y() + offset(gen))});
+    }
+    const auto rtree_result = distance(false);
+    const auto segment_list_result = distance(true);
+    ASSERT_EQ(rtree_result.has_value(), segment_list_result.has_value());
+    if (rtree_result) EXPECT_NEAR(*rtree_result, *segment_list_result, 1e-6);
+  }
+}
+
 TEST(TestCollisionDistance, arcDistance)
 {
   using obstacle_velocity_limiter::arcDistance;
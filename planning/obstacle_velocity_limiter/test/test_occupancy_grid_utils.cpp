@@ -16,9 +16,13 @@
 #include "obstacle_velocity_limiter/types.hpp"
 
 #include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <random>
+
 TEST(TestOccupancyGridUtils, extractObstacleLines)
 {
   using obstacle_velocity_limiter::multi_polygon_t;
@@ -61,3 +65,77 @@ TEST(TestOccupancyGridUtils, extractObstacleLines)
   obstacles = extractObstacles(occupancy_grid, {full_mask}, full_mask, occupied_thr);
   EXPECT_EQ(obstacles.size(), 0ul);
 }
+
+TEST(TestOccupancyGridUtils, incrementalExtractObstacles)
+{
+  using obstacle_velocity_limiter::linestring_t;
+  using obstacle_velocity_limiter::multi_linestring_t;
+  constexpr int8_t occupied_thr = 10;
+  nav_msgs::msg::OccupancyGrid occupancy_grid;
+  occupancy_grid.info.height = 60;
+  occupancy_grid.info.width = 50;
+  occupancy_grid.info.resolution = 0.5;
+  occupancy_grid.info.origin.position.x = -10.0;
+  occupancy_grid.info.origin.position.y = 5.0;
+  occupancy_grid.data =
+    std::vector<signed char>(occupancy_grid.info.height * occupancy_grid.info.width);
+
+  std::mt19937 gen(0);
+  const auto add_random_rectangle = [&](const signed char value) {
+    std::uniform_int_distribution<uint32_t> x_dist(0, occupancy_grid.info.width - 4);
+    std::uniform_int_distribution<uint32_t> y_dist(0, occupancy_grid.info.height - 4);
+    std::uniform_int_distribution<uint32_t> size_dist(2, 12);
+    const auto x = x_dist(gen);
+    const auto y = y_dist(gen);
+    const auto w = std::min(size_dist(gen), occupancy_grid.info.width - x);
+    const auto h = std::min(size_dist(gen), occupancy_grid.info.height - y);
+    for (auto i = y; i < y + h; ++i)
+      for (auto j = x; j < x + w; ++j)
+        occupancy_grid.data[j + i * occupancy_grid.info.width] = value;
+  };
+  // every point of the lines must be close to one of the other lines
+  const auto expect_covered = [&](const multi_linestring_t & lines, const multi_linestring_t & by) {
+    for (const auto & line : lines)
+      for (const auto & point : line)
+        EXPECT_LT(boost::geometry::distance(point, by), occupancy_grid.info.resolution);
+  };
+  const auto extract = [&](obstacle_velocity_limiter::IncrementalObstacleExtractor & extractor) {
+    auto grid_map = obstacle_velocity_limiter::convertToGridMap(occupancy_grid);
+    obstacle_velocity_limiter::threshold(grid_map, occupied_thr);
+    auto full_obstacles = obstacle_velocity_limiter::extractObstacles(grid_map, occupancy_grid);
+    // the contours extracted from the whole grid are not closed
+    for (auto & line : full_obstacles)
+      if (line.size() > 2) line.push_back(line.front());
+    const auto obstacles = extractor.extract(grid_map, occupancy_grid, 16);
+    expect_covered(obstacles, full_obstacles);
+    expect_covered(full_obstacles, obstacles);
+    return obstacles;
+  };
+
+  obstacle_velocity_limiter::IncrementalObstacleExtractor extractor;
+  for (auto i = 0; i < 10; ++i) add_random_rectangle(100);
+  extract(extractor);
+  // 4x4 tiles
+  EXPECT_EQ(extractor.lastDirtyTileCount(), 16ul);
+
+  // unchanged grid: obstacles are reused
+  extract(extractor);
+  EXPECT_EQ(extractor.lastDirtyTileCount(), 0ul);
+
+  // small change in a corner: only the tiles around it are extracted again
+  auto & corner_cell = occupancy_grid.data[1 + 1 * occupancy_grid.info.width];
+  corner_cell = corner_cell == 0 ? 100 : 0;
+  extract(extractor);
+  EXPECT_GE(extractor.lastDirtyTileCount(), 1ul);
+  EXPECT_LE(extractor.lastDirtyTileCount(), 4ul);
+
+  for (auto i = 0; i < 10; ++i) {
+    add_random_rectangle(i % 2 == 0 ? 0 : 100);
+    extract(extractor);
+  }
+
+  // moving the grid invalidates all tiles
+  occupancy_grid.info.origin.position.x += occupancy_grid.info.resolution;
+  extract(extractor);
+  EXPECT_EQ(extractor.lastDirtyTileCount(), 16ul);
+}
@@ -0,0 +1,55 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "obstacle_velocity_limiter/thread_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+TEST(TestThreadPool, parallelFor)
+{
+  using obstacle_velocity_limiter::ThreadPool;
+
+  for (const auto nb_threads : {0lu, 1lu, 2lu, 3lu, 8lu}) {
+    ThreadPool thread_pool(nb_threads);
+    EXPECT_EQ(thread_pool.size(), std::max(nb_threads, 1lu));
+    // the pool is reused for loops of different sizes
+    for (auto size = 0lu; size < 50lu; ++size) {
+      std::vector<size_t> calls(size, 0lu);
+      thread_pool.parallelFor(size, [&](const size_t i) { calls[i] += i + 1; });
+      for (auto i = 0lu; i < size; ++i) EXPECT_EQ(calls[i], i + 1);
+    }
+  }
+}
+
+TEST(TestThreadPool, exception)
+{
+  using obstacle_velocity_limiter::ThreadPool;
+
+  ThreadPool thread_pool(4);
+  EXPECT_THROW(
+    thread_pool.parallelFor(
+      100,
+      [](const size_t i) {
+        if (i == 80) throw std::runtime_error("error");
+      }),
+    std::runtime_error);
+  // still usable after an exception
+  std::vector<int> calls(100, 0);
+  thread_pool.parallelFor(100, [&](const size_t i) { calls[i] = 1; });
+  for (const auto call : calls) EXPECT_EQ(call, 1);
+}
@@ -20,6 +20,7 @@
 #include "path_smoother/type_alias.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <memory>
 #include <optional>
@@ -60,6 +61,7 @@ private:
 
     // option
     bool enable_warm_start;
+    bool enable_shifted_warm_start;
     bool enable_optimization_validation;
 
     // common
@@ -111,6 +113,9 @@ private:
 
   std::unique_ptr<autoware::common::osqp::OSQPInterface> osqp_solver_ptr_;
   std::shared_ptr<std::vector<TrajectoryPoint>> prev_eb_traj_points_ptr_{nullptr};
+  // previous optimization result for the shifted warm start
+  std::vector<TrajectoryPoint> prev_padded_traj_points_;
+  std::vector<double> prev_optimized_points_;
 
   std::vector<TrajectoryPoint> insertFixedPoint(
     const std::vector<TrajectoryPoint> & traj_point) const;
@@ -122,6 +127,9 @@ private:
     const std::vector<TrajectoryPoint> & traj_points, const bool is_goal_contained,
     const int pad_start_idx);
 
+  std::optional<std::vector<double>> calcShiftedPrevOptimizedPoints(
+    const std::vector<TrajectoryPoint> & traj_points) const;
+
   std::optional<std::vector<double>> calcSmoothedTrajectory();
 
   std::optional<std::vector<TrajectoryPoint>> convertOptimizedPointsToTrajectory(
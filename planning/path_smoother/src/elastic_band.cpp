@@ -26,44 +26,50 @@
 
 namespace
 {
-Eigen::MatrixXd makePMatrix(const int num_points)
+Eigen::SparseMatrix<double> makePMatrix(const int num_points)
 {
-  // create P block matrix
-  Eigen::MatrixXd P_quarter = Eigen::MatrixXd::Zero(num_points, num_points);
+  // create P block matrix, which is a band matrix with a bandwidth of 2
+  std::vector<Eigen::Triplet<double>> P_quarter_triplet_vec;
   for (int r = 0; r < num_points; ++r) {
-    for (int c = 0; c < num_points; ++c) {
-      if (r == c) {
-        if (r == 0 || r == num_points - 1) {
-          P_quarter(r, c) = 1.0;
-        } else if (r == 1 || r == num_points - 2) {
-          P_quarter(r, c) = 5.0;
-        } else {
-          P_quarter(r, c) = 6.0;
+    for (int c = std::max(0, r - 2); c <= std::min(num_points - 1, r + 2); ++c) {
+      const double val = [&]() {
+        if (r == c) {
+          if (r == 0 || r == num_points - 1) {
+            return 1.0;
+          } else if (r == 1 || r == num_points - 2) {
+            return 5.0;
+          }
+          return 6.0;
+        } else if (std::abs(c - r) == 1) {
+          if (r == 0 || r == num_points - 1) {
+            return -2.0;
+          } else if (c == 0 || c == num_points - 1) {
+            return -2.0;
+          }
+          return -4.0;
         }
-      } else if (std::abs(c - r) == 1) {
-        if (r == 0 || r == num_points - 1) {
-          P_quarter(r, c) = -2.0;
-        } else if (c == 0 || c == num_points - 1) {
-          P_quarter(r, c) = -2.0;
-        } else {
-          P_quarter(r, c) = -4.0;
-        }
-      } else if (std::abs(c - r) == 2) {
-        P_quarter(r, c) = 1.0;
-      } else {
-        P_quarter(r, c) = 0.0;
-      }
+        return 1.0;
+      }();
+      P_quarter_triplet_vec.push_back(Eigen::Triplet<double>(r, c, val));
+      P_quarter_triplet_vec.push_back(
+        Eigen::Triplet<double>(r + num_points, c + num_points, val));
     }
   }
 
   // create P matrix
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(num_points * 2, num_points * 2);
-  P.block(0, 0, num_points, num_points) = P_quarter;
-  P.block(num_points, num_points, num_points, num_points) = P_quarter;
+  Eigen::SparseMatrix<double> P(num_points * 2, num_points * 2);
+  P.setFromTriplets(P_quarter_triplet_vec.begin(), P_quarter_triplet_vec.end());
 
   return P;
 }
 
+Eigen::SparseMatrix<double> makeIdentityMatrix(const int size)
+{
+  Eigen::SparseMatrix<double> identity(size, size);
+  identity.setIdentity();
+  return identity;
+}
+
 std::vector<double> toStdVector(const Eigen::VectorXd & eigen_vec)
 {
   return {eigen_vec.data(), eigen_vec.data() + eigen_vec.rows()};
@@ -84,6 +90,8 @@ EBPathSmoother::EBParam::EBParam(rclcpp::Node * node)
 {
   {  // option
     enable_warm_start = node->declare_parameter<bool>("elastic_band.option.enable_warm_start");
+    enable_shifted_warm_start =
+      node->declare_parameter<bool>("elastic_band.option.enable_shifted_warm_start");
     enable_optimization_validation =
       node->declare_parameter<bool>("elastic_band.option.enable_optimization_validation");
   }
@@ -123,6 +131,8 @@ void EBPathSmoother::EBParam::onParam(const std::vector<rclcpp::Parameter> & par
 
   {  // option
     updateParam<bool>(parameters, "elastic_band.option.enable_warm_start", enable_warm_start);
+    updateParam<bool>(
+      parameters, "elastic_band.option.enable_shifted_warm_start", enable_shifted_warm_start);
     updateParam<bool>(
       parameters, "elastic_band.option.enable_optimization_validation",
       enable_optimization_validation);
@@ -186,6 +196,8 @@ void EBPathSmoother::initialize(const bool enable_debug_info, const CommonParam
 void EBPathSmoother::resetPreviousData()
 {
   prev_eb_traj_points_ptr_ = nullptr;
+  prev_padded_traj_points_.clear();
+  prev_optimized_points_.clear();
 }
 
 std::vector<TrajectoryPoint> EBPathSmoother::smoothTrajectory(
@@ -254,6 +266,9 @@ std::vector<TrajectoryPoint> EBPathSmoother::smoothTrajectory(
   }
 
   prev_eb_traj_points_ptr_ = std::make_shared<std::vector<TrajectoryPoint>>(*eb_traj_points);
+  prev_padded_traj_points_.assign(
+    padded_traj_points.begin(), padded_traj_points.begin() + pad_start_idx);
+  prev_optimized_points_ = *optimized_points;
 
   // 8. publish eb trajectory
   const auto eb_traj =
@@ -311,7 +326,7 @@ void EBPathSmoother::updateConstraint(
 
   std::vector<TrajectoryPoint> debug_fixed_traj_points;  // for debug
 
-  const Eigen::MatrixXd A = Eigen::MatrixXd::Identity(p.num_points, p.num_points);
+  const Eigen::SparseMatrix<double> A = makeIdentityMatrix(p.num_points);
   std::vector<double> upper_bound(p.num_points, 0.0);
   std::vector<double> lower_bound(p.num_points, 0.0);
   for (size_t i = 0; i < static_cast<size_t>(p.num_points); ++i) {
@@ -343,34 +358,47 @@ void EBPathSmoother::updateConstraint(
     }
   }
 
+  // NOTE: The matrices are built as sparse ones, and their zero elements are stored as well so
+  //       that the sparsity pattern does not change and the solver can be warm started.
   Eigen::VectorXd x_mat(2 * p.num_points);
-  Eigen::MatrixXd theta_mat = Eigen::MatrixXd::Zero(p.num_points, 2 * p.num_points);
+  std::vector<Eigen::Triplet<double>> theta_triplet_vec;
   for (size_t i = 0; i < static_cast<size_t>(p.num_points); ++i) {
     x_mat(i) = traj_points.at(i).pose.position.x;
     x_mat(i + p.num_points) = traj_points.at(i).pose.position.y;
 
     const double yaw = tf2::getYaw(traj_points.at(i).pose.orientation);
-    theta_mat(i, i) = -std::sin(yaw);
-    theta_mat(i, i + p.num_points) = std::cos(yaw);
+    theta_triplet_vec.push_back(Eigen::Triplet<double>(i, i, -std::sin(yaw)));
+    theta_triplet_vec.push_back(Eigen::Triplet<double>(i, i + p.num_points, std::cos(yaw)));
   }
+  Eigen::SparseMatrix<double> theta_mat(p.num_points, 2 * p.num_points);
+  theta_mat.setFromTriplets(theta_triplet_vec.begin(), theta_triplet_vec.end());
 
   // calculate P
-  const Eigen::MatrixXd raw_P_for_smooth = p.smooth_weight * makePMatrix(p.num_points);
-  const Eigen::MatrixXd P_for_smooth = theta_mat * raw_P_for_smooth * theta_mat.transpose();
-  const Eigen::MatrixXd P_for_lat_error =
-    p.lat_error_weight * Eigen::MatrixXd::Identity(p.num_points, p.num_points);
-  const Eigen::MatrixXd P = P_for_smooth + P_for_lat_error;
+  const Eigen::SparseMatrix<double> raw_P_for_smooth = p.smooth_weight * makePMatrix(p.num_points);
+  const Eigen::SparseMatrix<double> P_for_smooth =
+    theta_mat * raw_P_for_smooth * Eigen::SparseMatrix<double>(theta_mat.transpose());
+  const Eigen::SparseMatrix<double> P_for_lat_error =
+    p.lat_error_weight * makeIdentityMatrix(p.num_points);
+  const Eigen::SparseMatrix<double> P = P_for_smooth + P_for_lat_error;
 
   // calculate q
   const Eigen::VectorXd raw_q_for_smooth = theta_mat * raw_P_for_smooth * x_mat;
   const auto q = toStdVector(raw_q_for_smooth);
 
-  if (p.enable_warm_start && osqp_solver_ptr_) {
-    osqp_solver_ptr_->updateP(P);
+  // the matrices cannot be updated when their sparsity pattern is changed
+  if (
+    p.enable_warm_start && osqp_solver_ptr_ && osqp_solver_ptr_->updateP(P) &&
+    osqp_solver_ptr_->updateA(A)) {
     osqp_solver_ptr_->updateQ(q);
-    osqp_solver_ptr_->updateA(A);
     osqp_solver_ptr_->updateBounds(lower_bound, upper_bound);
     osqp_solver_ptr_->updateEpsRel(p.qp_param.eps_rel);
+
+    if (p.enable_shifted_warm_start) {
+      const auto shifted_prev_optimized_points = calcShiftedPrevOptimizedPoints(traj_points);
+      if (shifted_prev_optimized_points) {
+        osqp_solver_ptr_->setPrimalVariables(*shifted_prev_optimized_points);
+      }
+    }
   } else {
     osqp_solver_ptr_ = std::make_unique<autoware::common::osqp::OSQPInterface>(
       P, A, q, lower_bound, upper_bound, p.qp_param.eps_abs);
@@ -387,6 +415,24 @@ void EBPathSmoother::updateConstraint(
   time_keeper_ptr_->toc(__func__, "        ");
 }
 
+std::optional<std::vector<double>> EBPathSmoother::calcShiftedPrevOptimizedPoints(
+  const std::vector<TrajectoryPoint> & traj_points) const
+{
+  if (prev_padded_traj_points_.empty() || prev_optimized_points_.size() != traj_points.size()) {
+    return std::nullopt;
+  }
+
+  // shift the previous lateral offsets by the number of points ego has passed
+  const size_t shift_idx = motion_utils::findNearestIndex(
+    prev_padded_traj_points_, traj_points.front().pose.position);
+  std::vector<double> shifted_optimized_points(traj_points.size());
+  for (size_t i = 0; i < shifted_optimized_points.size(); ++i) {
+    shifted_optimized_points.at(i) =
+      prev_optimized_points_.at(std::min(i + shift_idx, prev_padded_traj_points_.size() - 1));
+  }
+  return shifted_optimized_points;
+}
+
 std::optional<std::vector<double>> EBPathSmoother::calcSmoothedTrajectory()
 {
   time_keeper_ptr_->tic(__func__);
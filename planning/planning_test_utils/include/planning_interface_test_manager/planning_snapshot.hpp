@@ -0,0 +1,190 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PLANNING_INTERFACE_TEST_MANAGER__PLANNING_SNAPSHOT_HPP_
+#define PLANNING_INTERFACE_TEST_MANAGER__PLANNING_SNAPSHOT_HPP_
+
+#include <rclcpp/rclcpp.hpp>
+#include <rclcpp/serialization.hpp>
+#include <rclcpp/serialized_message.hpp>
+#include <rosidl_runtime_cpp/traits.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace planning_test_utils
+{
+
+/**
+ * @brief header of a record in the snapshot file
+ * @details A snapshot file is the magic followed by the records. Each record is this header, the
+ * topic name, the type name and the CDR serialized message, each of which is padded to 8 bytes so
+ * that the mapped file can be read without copying the header.
+ */
+struct SnapshotRecordHeader
+{
+  uint32_t frame;       //!< @brief index of the input bundle the message belongs to
+  uint32_t topic_size;  //!< @brief size of the topic name without the padding
+  uint32_t type_size;   //!< @brief size of the type name without the padding
+  uint32_t reserved;    //!< @brief always zero
+  int64_t stamp;        //!< @brief recorded time in nanoseconds
+  uint64_t data_size;   //!< @brief size of the serialized message without the padding
+};
+
+/**
+ * @brief record in the mapped snapshot file, which points to the memory of the file
+ */
+struct SnapshotRecord
+{
+  uint32_t frame;
+  int64_t stamp;
+  std::string topic;
+  std::string type;
+  const uint8_t * data;
+  size_t data_size;
+};
+
+/**
+ * @brief writer of the input bundles of the planning nodes
+ * @details The messages written between the calls of nextFrame() compose one frame, which is
+ * published to the target node at once by SnapshotPlayer.
+ */
+class SnapshotWriter
+{
+public:
+  explicit SnapshotWriter(const std::string & file_path);
+
+  template <typename T>
+  void write(const std::string & topic, const rclcpp::Time & stamp, const T & msg)
+  {
+    rclcpp::SerializedMessage serialized_msg;
+    rclcpp::Serialization<T>().serialize_message(&msg, &serialized_msg);
+    const auto & rcl_msg = serialized_msg.get_rcl_serialized_message();
+    writeRecord(
+      topic, rosidl_generator_traits::name<T>(), stamp, rcl_msg.buffer, rcl_msg.buffer_length);
+  }
+
+  void nextFrame() { ++frame_; }
+
+private:
+  void writeRecord(
+    const std::string & topic, const std::string & type, const rclcpp::Time & stamp,
+    const uint8_t * data, const size_t data_size);
+
+  std::ofstream ofs_;
+  uint32_t frame_{0};
+};
+
+/**
+ * @brief reader of the snapshot file, which maps the file and indexes the records
+ */
+class SnapshotReader
+{
+public:
+  explicit SnapshotReader(const std::string & file_path);
+  ~SnapshotReader();
+  SnapshotReader(const SnapshotReader &) = delete;
+  SnapshotReader & operator=(const SnapshotReader &) = delete;
+
+  const std::vector<SnapshotRecord> & records() const { return records_; }
+  size_t getFrameNum() const { return records_.empty() ? 0 : records_.back().frame + 1; }
+
+  template <typename T>
+  static T deserialize(const SnapshotRecord & record)
+  {
+    if (record.type != rosidl_generator_traits::name<T>()) {
+      throw std::runtime_error(
+        "Type of " + record.topic + " is " + record.type + ", not " +
+        rosidl_generator_traits::name<T>());
+    }
+    rclcpp::SerializedMessage serialized_msg(record.data_size);
+    auto & rcl_msg = serialized_msg.get_rcl_serialized_message();
+    std::memcpy(rcl_msg.buffer, record.data, record.data_size);
+    rcl_msg.buffer_length = record.data_size;
+
+    T msg;
+    rclcpp::Serialization<T>().deserialize_message(&serialized_msg, &msg);
+    return msg;
+  }
+
+private:
+  void * address_{nullptr};
+  size_t file_size_{0};
+  std::vector<SnapshotRecord> records_;
+};
+
+/**
+ * @brief player of the snapshot file, which drives the target node frame by frame
+ * @details For each frame, the messages are published from the test node and both nodes are spun
+ * until the output of the target node is received, without waiting for the wall clock. When both
+ * nodes are created with NodeOptions::use_intra_process_comms(true), the messages are not
+ * delivered through DDS.
+ */
+class SnapshotPlayer
+{
+public:
+  SnapshotPlayer(rclcpp::Node::SharedPtr test_node, rclcpp::Node::SharedPtr target_node);
+
+  /**
+   * @brief register the input topic in the snapshot, which is published to the target node
+   */
+  template <typename T>
+  void addInputTopic(const std::string & topic, const rclcpp::QoS & qos = rclcpp::QoS{1})
+  {
+    const auto publisher = test_node_->create_publisher<T>(topic, qos);
+    publishers_[topic] = [publisher](const SnapshotRecord & record) {
+      publisher->publish(SnapshotReader::deserialize<T>(record));
+    };
+  }
+
+  /**
+   * @brief register the output topic of the target node, which ends the frame
+   */
+  template <typename T>
+  void setOutputTopic(const std::string & topic)
+  {
+    output_sub_ = test_node_->create_subscription<T>(
+      topic, rclcpp::QoS{1}, [this](const typename T::ConstSharedPtr) { ++output_count_; });
+  }
+
+  /**
+   * @brief publish the frames of the snapshot in order
+   * @param [in] reader snapshot to play
+   * @param [in] timeout maximum time to wait for the output of each frame
+   * @return latency from the publication of the frame to the output in milliseconds, or a negative
+   * value if the output is not received within the timeout
+   */
+  std::vector<double> play(
+    const SnapshotReader & reader,
+    const std::chrono::nanoseconds timeout = std::chrono::milliseconds(1000));
+
+private:
+  rclcpp::Node::SharedPtr test_node_;
+  rclcpp::Node::SharedPtr target_node_;
+  std::unordered_map<std::string, std::function<void(const SnapshotRecord &)>> publishers_;
+  rclcpp::SubscriptionBase::SharedPtr output_sub_;
+  size_t output_count_{0};
+};
+
+}  // namespace planning_test_utils
+
+#endif  // PLANNING_INTERFACE_TEST_MANAGER__PLANNING_SNAPSHOT_HPP_
@@ -0,0 +1,179 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <planning_interface_test_manager/planning_snapshot.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace planning_test_utils
+{
+namespace
+{
+constexpr char snapshot_magic[8] = {'P', 'L', 'N', 'S', 'N', 'P', '0', '1'};
+constexpr size_t alignment = 8;
+
+size_t getPaddedSize(const size_t size)
+{
+  return (size + alignment - 1) / alignment * alignment;
+}
+
+void writePadded(std::ofstream & ofs, const void * data, const size_t size)
+{
+  static const char padding[alignment] = {};
+  ofs.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(size));
+  ofs.write(padding, static_cast<std::streamsize>(getPaddedSize(size) - size));
+}
+}  // namespace
+
+SnapshotWriter::SnapshotWriter(const std::string & file_path)
+: ofs_(file_path, std::ios::binary | std::ios::trunc)
+{
+  if (!ofs_) {
+    throw std::runtime_error("Failed to open " + file_path);
+  }
+  ofs_.write(snapshot_magic, sizeof(snapshot_magic));
+}
+
+void SnapshotWriter::writeRecord(
+  const std::string & topic, const std::string & type, const rclcpp::Time & stamp,
+  const uint8_t * data, const size_t data_size)
+{
+  SnapshotRecordHeader header{};
+  header.frame = frame_;
+  header.topic_size = static_cast<uint32_t>(topic.size());
+  header.type_size = static_cast<uint32_t>(type.size());
+  header.stamp = stamp.nanoseconds();
+  header.data_size = data_size;
+
+  ofs_.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  writePadded(ofs_, topic.data(), topic.size());
+  writePadded(ofs_, type.data(), type.size());
+  writePadded(ofs_, data, data_size);
+  ofs_.flush();
+}
+
+SnapshotReader::SnapshotReader(const std::string & file_path)
+{
+  const int fd = open(file_path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Failed to open " + file_path + ": " + strerror(errno));
+  }
+  struct stat file_stat;
+  if (
+    fstat(fd, &file_stat) != 0 ||
+    static_cast<size_t>(file_stat.st_size) < sizeof(snapshot_magic)) {
+    close(fd);
+    throw std::runtime_error(file_path + " is not a snapshot file");
+  }
+  file_size_ = static_cast<size_t>(file_stat.st_size);
+  address_ = mmap(nullptr, file_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (address_ == MAP_FAILED) {
+    address_ = nullptr;
+    throw std::runtime_error("Failed to map " + file_path + ": " + strerror(errno));
+  }
+
+  const auto * begin = static_cast<const uint8_t *>(address_);
+  if (std::memcmp(begin, snapshot_magic, sizeof(snapshot_magic)) != 0) {
+    munmap(address_, file_size_);
+    throw std::runtime_error(file_path + " is not a snapshot file");
+  }
+
+  // index the records, the messages are deserialized when they are played
+  size_t offset = sizeof(snapshot_magic);
+  while (offset + sizeof(SnapshotRecordHeader) <= file_size_) {
+    const auto * header = reinterpret_cast<const SnapshotRecordHeader *>(begin + offset);
+    const size_t topic_offset = offset + sizeof(SnapshotRecordHeader);
+    const size_t type_offset = topic_offset + getPaddedSize(header->topic_size);
+    const size_t data_offset = type_offset + getPaddedSize(header->type_size);
+    const size_t next_offset = data_offset + getPaddedSize(header->data_size);
+    if (next_offset > file_size_) {
+      break;  // the last record is truncated
+    }
+
+    SnapshotRecord record;
+    record.frame = header->frame;
+    record.stamp = header->stamp;
+    record.topic.assign(reinterpret_cast<const char *>(begin + topic_offset), header->topic_size);
+    record.type.assign(reinterpret_cast<const char *>(begin + type_offset), header->type_size);
+    record.data = begin + data_offset;
+    record.data_size = header->data_size;
+    records_.push_back(std::move(record));
+    offset = next_offset;
+  }
+}
+
+SnapshotReader::~SnapshotReader()
+{
+  if (address_ != nullptr) {
+    munmap(address_, file_size_);
+  }
+}
+
+SnapshotPlayer::SnapshotPlayer(
+  rclcpp::Node::SharedPtr test_node, rclcpp::Node::SharedPtr target_node)
+: test_node_(test_node), target_node_(target_node)
+{
+}
+
+std::vector<double> SnapshotPlayer::play(
+  const SnapshotReader & reader, const std::chrono::nanoseconds timeout)
+{
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(test_node_);
+  executor.add_node(target_node_);
+
+  std::vector<double> latencies;
+  latencies.reserve(reader.getFrameNum());
+
+  const auto & records = reader.records();
+  auto itr = records.begin();
+  while (itr != records.end()) {
+    const auto frame = itr->frame;
+    const auto start_count = output_count_;
+    const auto start_time = std::chrono::steady_clock::now();
+    for (; itr != records.end() && itr->frame == frame; ++itr) {
+      const auto publisher = publishers_.find(itr->topic);
+      if (publisher != publishers_.end()) {
+        publisher->second(*itr);
+      }
+    }
+
+    // spin without sleeping until the target node publishes the output
+    double latency = -1.0;
+    while (std::chrono::steady_clock::now() - start_time < timeout && rclcpp::ok()) {
+      executor.spin_some();
+      if (output_count_ != start_count) {
+        latency = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - start_time)
+                    .count();
+        break;
+      }
+    }
+    latencies.push_back(latency);
+  }
+
+  return latencies;
+}
+
+}  // namespace planning_test_utils
@@ -0,0 +1,113 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PLANNING_VALIDATOR__INCREMENTAL_METRICS_HPP_
+#define PLANNING_VALIDATOR__INCREMENTAL_METRICS_HPP_
+
+#include <autoware_auto_planning_msgs/msg/trajectory.hpp>
+
+#include <utility>
+#include <vector>
+
+namespace planning_validator
+{
+using autoware_auto_planning_msgs::msg::Trajectory;
+
+/**
+ * @brief validation metrics of the trajectory updated only for the points changed from the
+ * previous trajectory
+ * @details The points which are the same as the previous trajectory from the front are shared, and
+ * the metrics of the elements depending only on the shared points are reused. The results are the
+ * same as the functions in utils.hpp. The metrics on the resampled trajectory are calculated on the
+ * same resampled trajectory as resampleTrajectory().
+ */
+class IncrementalMetrics
+{
+public:
+  using Result = std::pair<double, size_t>;
+
+  explicit IncrementalMetrics(const double resample_interval, const double curvature_distance = 1.0)
+  : resample_interval_(resample_interval), curvature_distance_(curvature_distance)
+  {
+  }
+
+  void update(const Trajectory::ConstSharedPtr & trajectory, const double wheelbase);
+
+  size_t getSharedSize() const { return shared_size_; }
+  const Trajectory & getResampledTrajectory() const { return resampled_; }
+
+  bool isFinite() const { return first_non_finite_index_ == points_num_; }
+  const Result & getMaxIntervalDistance() const { return max_interval_distance_; }
+  const Result & getMaxLateralAcceleration() const { return max_lateral_acc_; }
+  const Result & getMaxLongitudinalAcc() const { return max_longitudinal_acc_; }
+  const Result & getMinLongitudinalAcc() const { return min_longitudinal_acc_; }
+  const Result & getMaxRelativeAngle() const { return max_relative_angle_; }
+  const Result & getMaxCurvature() const { return max_curvature_; }
+  const Result & getMaxSteeringAngle() const { return max_steering_; }
+  const Result & getMaxSteeringRate() const { return max_steering_rate_; }
+
+private:
+  // curvatures of calcCurvature() and the intermediate values to reuse them
+  struct CurvatureHistory
+  {
+    std::vector<double> arc_lengths;
+    std::vector<double> curvatures;
+    std::vector<size_t> next_indices;  // the size if the next point is not found
+    size_t first_distant_index{0};
+    size_t reusable_size{0};
+  };
+
+  void updateCurvature(
+    const Trajectory & trajectory, const size_t shared_size, CurvatureHistory & history) const;
+  void updateResampledTrajectory(const Trajectory & trajectory);
+
+  double resample_interval_;
+  double curvature_distance_;
+  double wheelbase_{0.0};
+
+  Trajectory::ConstSharedPtr previous_trajectory_;
+  size_t points_num_{0};
+  size_t shared_size_{0};
+  size_t first_non_finite_index_{0};
+
+  Trajectory resampled_;
+  std::vector<size_t> resampled_indices_;
+  size_t resampled_shared_size_{0};
+
+  CurvatureHistory curvature_history_;
+  CurvatureHistory resampled_curvature_history_;
+  std::vector<double> resampled_steering_angles_;
+
+  // extremum of the elements up to each index
+  std::vector<Result> interval_folds_;
+  std::vector<Result> lateral_acc_folds_;
+  std::vector<Result> max_acc_folds_;
+  std::vector<Result> min_acc_folds_;
+  std::vector<Result> relative_angle_folds_;
+  std::vector<Result> curvature_folds_;
+  std::vector<Result> steering_folds_;
+  std::vector<Result> steering_rate_folds_;
+
+  Result max_interval_distance_{0.0, 0};
+  Result max_lateral_acc_{0.0, 0};
+  Result max_longitudinal_acc_{0.0, 0};
+  Result min_longitudinal_acc_{0.0, 0};
+  Result max_relative_angle_{0.0, 0};
+  Result max_curvature_{0.0, 0};
+  Result max_steering_{0.0, 0};
+  Result max_steering_rate_{0.0, 0};
+};
+}  // namespace planning_validator
+
+#endif  // PLANNING_VALIDATOR__INCREMENTAL_METRICS_HPP_
@@ -15,7 +15,9 @@
 #ifndef PLANNING_VALIDATOR__PLANNING_VALIDATOR_HPP_
 #define PLANNING_VALIDATOR__PLANNING_VALIDATOR_HPP_
 
+#include "latency_aggregator/latency_hop_publisher.hpp"
 #include "planning_validator/debug_marker.hpp"
+#include "planning_validator/incremental_metrics.hpp"
 #include "planning_validator/msg/planning_validator_status.hpp"
 #include "tier4_autoware_utils/ros/logger_level_configure.hpp"
 #include "tier4_autoware_utils/system/stop_watch.hpp"
@@ -31,6 +33,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 
 namespace planning_validator
 {
@@ -84,6 +87,20 @@ private:
   bool isDataReady();
 
   void validate(const Trajectory & trajectory);
+  void validateIncrementally(const Trajectory::ConstSharedPtr & trajectory);
+
+  // threshold checks of the metrics calculated by utils.hpp or IncrementalMetrics
+  using MetricResult = std::pair<double, size_t>;
+  bool checkValidInterval(const Trajectory & trajectory, const MetricResult & result);
+  bool checkValidRelativeAngle(const Trajectory & trajectory, const MetricResult & result);
+  bool checkValidCurvature(const Trajectory & trajectory, const MetricResult & result);
+  bool checkValidLateralAcceleration(const Trajectory & trajectory, const MetricResult & result);
+  bool checkValidMaxLongitudinalAcceleration(
+    const Trajectory & trajectory, const MetricResult & result);
+  bool checkValidMinLongitudinalAcceleration(
+    const Trajectory & trajectory, const MetricResult & result);
+  bool checkValidSteering(const Trajectory & trajectory, const MetricResult & result);
+  bool checkValidSteeringRate(const Trajectory & trajectory, const MetricResult & result);
 
   void publishProcessingTime(const double processing_time_ms);
   void publishTrajectory();
@@ -98,6 +115,8 @@ private:
   rclcpp::Publisher<PlanningValidatorStatus>::SharedPtr pub_status_;
   rclcpp::Publisher<Float64Stamped>::SharedPtr pub_processing_time_ms_;
   rclcpp::Publisher<visualization_msgs::msg::MarkerArray>::SharedPtr pub_markers_;
+  std::unique_ptr<latency_aggregator::LatencyHopPublisher> latency_hop_publisher_;
+  latency_aggregator::LatencyHopInput current_hop_input_;
 
   // system parameters
   enum class InvalidTrajectoryHandlingType {
@@ -108,6 +127,7 @@ private:
   bool publish_diag_ = true;
   int diag_error_count_threshold_ = 0;
   bool display_on_terminal_ = true;
+  bool use_incremental_validation_ = false;
 
   Updater diag_updater_{this};
 
@@ -123,6 +143,9 @@ private:
 
   Odometry::ConstSharedPtr current_kinematics_;
 
+  // metrics reused for the points shared with the previous trajectory
+  std::unique_ptr<IncrementalMetrics> incremental_metrics_;
+
   std::shared_ptr<PlanningValidatorDebugMarkerPublisher> debug_pose_publisher_;
 
   std::unique_ptr<tier4_autoware_utils::LoggerLevelConfigure> logger_configure_;
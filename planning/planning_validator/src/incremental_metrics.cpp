@@ -0,0 +1,313 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "planning_validator/incremental_metrics.hpp"
+
+#include "planning_validator/utils.hpp"
+
+#include <tier4_autoware_utils/geometry/geometry.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace planning_validator
+{
+using tier4_autoware_utils::calcDistance2d;
+using tier4_autoware_utils::getPoint;
+
+namespace
+{
+using Result = IncrementalMetrics::Result;
+
+// fold the values of the elements in [begin, end) into the extremum, starting from the folds of
+// the first reusable_size elements which are kept from the previous trajectory
+template <class CalcT, class IsBetterT>
+Result foldElements(
+  std::vector<Result> & folds, const size_t begin, const size_t reusable_size, const size_t end,
+  const Result & init, const CalcT & calc, const IsBetterT & is_better)
+{
+  folds.resize(std::max(begin, end));
+
+  Result result = init;
+  size_t i = begin;
+  const size_t reusable_end = std::min(reusable_size, end);
+  if (begin < reusable_end) {
+    result = folds.at(reusable_end - 1);
+    i = reusable_end;
+  }
+  for (; i < end; ++i) {
+    const double value = calc(i);
+    if (is_better(value, result.first)) {
+      result = {value, i};
+    }
+    folds.at(i) = result;
+  }
+  return result;
+}
+
+bool isGreater(const double a, const double b)
+{
+  return a > b;
+}
+
+bool isSmaller(const double a, const double b)
+{
+  return a < b;
+}
+}  // namespace
+
+void IncrementalMetrics::update(
+  const Trajectory::ConstSharedPtr & trajectory, const double wheelbase)
+{
+  const auto & points = trajectory->points;
+  const size_t points_num = points.size();
+  if (points.empty()) {
+    *this = IncrementalMetrics(resample_interval_, curvature_distance_);
+    return;
+  }
+
+  // the leading points which are the same as the previous trajectory
+  shared_size_ = 0;
+  if (previous_trajectory_ && wheelbase == wheelbase_) {
+    const auto & previous_points = previous_trajectory_->points;
+    const size_t max_shared_size = std::min(previous_points.size(), points_num);
+    while (shared_size_ < max_shared_size &&
+           points.at(shared_size_) == previous_points.at(shared_size_)) {
+      ++shared_size_;
+    }
+  }
+  previous_trajectory_ = trajectory;
+  points_num_ = points_num;
+  wheelbase_ = wheelbase;
+  const size_t shared_size = shared_size_;
+
+  // finite value
+  if (first_non_finite_index_ >= shared_size) {
+    first_non_finite_index_ = shared_size;
+    while (first_non_finite_index_ < points_num &&
+           checkFinite(points.at(first_non_finite_index_))) {
+      ++first_non_finite_index_;
+    }
+  }
+
+  // metrics on the original trajectory
+  max_interval_distance_ = foldElements(
+    interval_folds_, 1, shared_size, points_num, {0.0, 0},
+    [&](const size_t i) { return std::abs(calcDistance2d(points.at(i), points.at(i - 1))); },
+    isGreater);
+  max_longitudinal_acc_ = foldElements(
+    max_acc_folds_, 0, shared_size, points_num, {0.0, 0},
+    [&](const size_t i) { return static_cast<double>(points.at(i).acceleration_mps2); }, isGreater);
+  min_longitudinal_acc_ = foldElements(
+    min_acc_folds_, 0, shared_size, points_num, {0.0, 0},
+    [&](const size_t i) { return static_cast<double>(points.at(i).acceleration_mps2); }, isSmaller);
+
+  updateCurvature(*trajectory, shared_size, curvature_history_);
+  const auto & curvatures = curvature_history_.curvatures;
+  max_lateral_acc_ = foldElements(
+    lateral_acc_folds_, 0, curvature_history_.reusable_size, points_num, {0.0, 0},
+    [&](const size_t i) {
+      const auto v = points.at(i).longitudinal_velocity_mps;
+      return std::abs(v * v * curvatures.at(i));
+    },
+    isGreater);
+
+  // metrics on the resampled trajectory
+  updateResampledTrajectory(*trajectory);
+  const auto & resampled_points = resampled_.points;
+  const size_t resampled_num = resampled_points.size();
+  const size_t resampled_shared_size = resampled_shared_size_;
+
+  // the relative angle of the element i uses the points i, i + 1 and i + 2
+  if (resampled_num < 3) {
+    relative_angle_folds_.clear();
+    max_relative_angle_ = {0.0, 0};
+  } else {
+    max_relative_angle_ = foldElements(
+      relative_angle_folds_, 0, std::max<size_t>(resampled_shared_size, 2) - 2,
+      resampled_num - 2, {0.0, 0},
+      [&](const size_t i) {
+        const auto & p1 = resampled_points.at(i).pose.position;
+        const auto & p2 = resampled_points.at(i + 1).pose.position;
+        const auto & p3 = resampled_points.at(i + 2).pose.position;
+        const auto angle_a = tier4_autoware_utils::calcAzimuthAngle(p1, p2);
+        const auto angle_b = tier4_autoware_utils::calcAzimuthAngle(p2, p3);
+        return std::abs(tier4_autoware_utils::normalizeRadian(angle_b - angle_a));
+      },
+      isGreater);
+  }
+
+  updateCurvature(resampled_, resampled_shared_size, resampled_curvature_history_);
+  const auto & resampled_curvatures = resampled_curvature_history_.curvatures;
+  const size_t curvature_reusable_size = resampled_curvature_history_.reusable_size;
+  if (resampled_num < 3) {
+    curvature_folds_.clear();
+    max_curvature_ = {0.0, 0};
+  } else {
+    max_curvature_ = foldElements(
+      curvature_folds_, 1, curvature_reusable_size, resampled_num,
+      {resampled_curvatures.front(), 0},
+      [&](const size_t i) { return resampled_curvatures.at(i); }, isGreater);
+  }
+
+  resampled_steering_angles_.resize(resampled_num);
+  for (size_t i = curvature_reusable_size; i < resampled_num; ++i) {
+    resampled_steering_angles_.at(i) = std::atan(resampled_curvatures.at(i) * wheelbase);
+  }
+  const auto & steering_angles = resampled_steering_angles_;
+  max_steering_ = foldElements(
+    steering_folds_, 1, curvature_reusable_size, resampled_num,
+    {std::abs(steering_angles.front()), 0},
+    [&](const size_t i) { return std::abs(steering_angles.at(i)); }, isGreater);
+
+  // the steering rate of the element i uses the points and the steering angles of i and i + 1
+  const size_t steering_rate_reusable_size =
+    std::max<size_t>(std::min(resampled_shared_size, curvature_reusable_size), 1) - 1;
+  max_steering_rate_ = foldElements(
+    steering_rate_folds_, 0, steering_rate_reusable_size, resampled_num - 1, {0.0, 0},
+    [&](const size_t i) {
+      const auto & p_prev = resampled_points.at(i);
+      const auto & p_next = resampled_points.at(i + 1);
+      const auto delta_s = calcDistance2d(p_prev, p_next);
+      const auto v = 0.5 * (p_next.longitudinal_velocity_mps + p_prev.longitudinal_velocity_mps);
+      const auto dt = delta_s / std::max(v, 1.0e-5);
+      return (steering_angles.at(i + 1) - steering_angles.at(i)) / dt;
+    },
+    isGreater);
+}
+
+void IncrementalMetrics::updateCurvature(
+  const Trajectory & trajectory, const size_t shared_size, CurvatureHistory & history) const
+{
+  const auto & points = trajectory.points;
+  const size_t points_num = points.size();
+  if (points_num < 3) {
+    history = CurvatureHistory{};
+    history.curvatures.assign(points_num, 0.0);
+    return;
+  }
+
+  // The curvature of the element i is kept if its previous and next points are shared. The
+  // leading elements are filled with the first distant one, so it also has to be kept.
+  const size_t arc_length_reusable_size = std::min(shared_size, history.arc_lengths.size());
+  size_t reusable_size = 0;
+  if (history.first_distant_index > 0) {
+    size_t i = 1;
+    while (i < shared_size && i < history.next_indices.size() &&
+           history.next_indices.at(i) < shared_size) {
+      ++i;
+    }
+    if (history.first_distant_index < i) {
+      reusable_size = i;
+    }
+  }
+  history.reusable_size = reusable_size;
+  if (reusable_size == 0) {
+    history.first_distant_index = 0;
+  }
+
+  auto & arc_lengths = history.arc_lengths;
+  arc_lengths.resize(points_num);
+  arc_lengths.front() = 0.0;
+  for (size_t i = std::max<size_t>(arc_length_reusable_size, 1); i < points_num; ++i) {
+    arc_lengths.at(i) = arc_lengths.at(i - 1) + calcDistance2d(points.at(i - 1), points.at(i));
+  }
+
+  auto & curvatures = history.curvatures;
+  auto & next_indices = history.next_indices;
+  curvatures.resize(points_num);
+  next_indices.resize(points_num);
+  next_indices.front() = points_num;
+  next_indices.back() = points_num;
+  curvatures.back() = 0.0;
+
+  // the same as calcCurvature() from the first element which is not kept
+  size_t last_distant_index = reusable_size > 0 ? reusable_size - 1 : points_num - 1;
+  for (size_t i = std::max<size_t>(reusable_size, 1); i < points_num - 1; ++i) {
+    size_t prev_idx = 0;
+    for (size_t j = i - 1; j > 0; --j) {
+      if (arc_lengths.at(i) - arc_lengths.at(j) > curvature_distance_) {
+        if (history.first_distant_index == 0) {
+          history.first_distant_index = i;
+        }
+        prev_idx = j;
+        break;
+      }
+    }
+
+    size_t next_idx = points_num - 1;
+    next_indices.at(i) = points_num;
+    for (size_t j = i + 1; j < points_num; ++j) {
+      if (arc_lengths.at(j) - arc_lengths.at(i) > curvature_distance_) {
+        last_distant_index = i;
+        next_idx = j;
+        next_indices.at(i) = j;
+        break;
+      }
+    }
+
+    const auto p1 = getPoint(points.at(prev_idx));
+    const auto p2 = getPoint(points.at(i));
+    const auto p3 = getPoint(points.at(next_idx));
+    try {
+      curvatures.at(i) = tier4_autoware_utils::calcCurvature(p1, p2, p3);
+    } catch (...) {
+      curvatures.at(i) = 0.0;  // maybe distance is too close
+    }
+  }
+
+  if (reusable_size == 0) {
+    curvatures.front() = 0.0;
+    for (size_t i = history.first_distant_index; i > 0; --i) {
+      curvatures.at(i - 1) = curvatures.at(i);
+    }
+  }
+  for (size_t i = last_distant_index; i < points_num - 1; ++i) {
+    curvatures.at(i + 1) = curvatures.at(i);
+  }
+}
+
+void IncrementalMetrics::updateResampledTrajectory(const Trajectory & trajectory)
+{
+  const auto & points = trajectory.points;
+  resampled_.header = trajectory.header;
+
+  // The resampled points selected from the shared points are kept. The other shared points were
+  // not selected because they are close to the last kept point.
+  size_t kept_size = 0;
+  while (kept_size < resampled_indices_.size() &&
+         resampled_indices_.at(kept_size) < shared_size_) {
+    ++kept_size;
+  }
+  resampled_.points.resize(kept_size);
+  resampled_indices_.resize(kept_size);
+  resampled_shared_size_ = kept_size;
+
+  if (points.empty()) {
+    return;
+  }
+  if (kept_size == 0) {
+    resampled_.points.push_back(points.front());
+    resampled_indices_.push_back(0);
+  }
+  for (size_t i = std::max<size_t>(shared_size_, 1); i < points.size(); ++i) {
+    if (calcDistance2d(resampled_.points.back(), points.at(i)) > resample_interval_) {
+      resampled_.points.push_back(points.at(i));
+      resampled_indices_.push_back(i);
+    }
+  }
+}
+
+}  // namespace planning_validator
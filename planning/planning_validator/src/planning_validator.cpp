@@ -27,6 +27,13 @@ namespace planning_validator
 {
 using diagnostic_msgs::msg::DiagnosticStatus;
 
+namespace
+{
+// use resampled trajectory because some metrics can not be evaluated for closed points.
+// Note: do not interpolate to keep original trajectory shape.
+constexpr double resample_min_interval = 1.0;
+}  // namespace
+
 PlanningValidator::PlanningValidator(const rclcpp::NodeOptions & options)
 : Node("planning_validator", options)
 {
@@ -39,6 +46,8 @@ PlanningValidator::PlanningValidator(const rclcpp::NodeOptions & options)
     "~/input/trajectory", 1, std::bind(&PlanningValidator::onTrajectory, this, _1));
 
   pub_traj_ = create_publisher<Trajectory>("~/output/trajectory", 1);
+  latency_hop_publisher_ =
+    std::make_unique<latency_aggregator::LatencyHopPublisher>(this, pub_traj_->get_topic_name());
   pub_status_ = create_publisher<PlanningValidatorStatus>("~/output/validation_status", 1);
   pub_markers_ = create_publisher<visualization_msgs::msg::MarkerArray>("~/output/markers", 1);
   pub_processing_time_ms_ = create_publisher<Float64Stamped>("~/debug/processing_time_ms", 1);
@@ -70,6 +79,10 @@ void PlanningValidator::setupParameters()
   publish_diag_ = declare_parameter<bool>("publish_diag");
   diag_error_count_threshold_ = declare_parameter<int>("diag_error_count_threshold");
   display_on_terminal_ = declare_parameter<bool>("display_on_terminal");
+  use_incremental_validation_ = declare_parameter<bool>("use_incremental_validation");
+  if (use_incremental_validation_) {
+    incremental_metrics_ = std::make_unique<IncrementalMetrics>(resample_min_interval);
+  }
 
   {
     auto & p = validation_params_;
@@ -171,12 +184,18 @@ void PlanningValidator::onTrajectory(const Trajectory::ConstSharedPtr msg)
   stop_watch_.tic(__func__);
 
   current_trajectory_ = msg;
+  current_hop_input_ =
+    latency_hop_publisher_->createInput(sub_traj_->get_topic_name(), msg->header.stamp);
 
   if (!isDataReady()) return;
 
   debug_pose_publisher_->clearMarkers();
 
-  validate(*current_trajectory_);
+  if (use_incremental_validation_) {
+    validateIncrementally(current_trajectory_);
+  } else {
+    validate(*current_trajectory_);
+  }
 
   diag_updater_.force_update();
 
@@ -193,6 +212,7 @@ void PlanningValidator::publishTrajectory()
   // Validation check is all green. Publish the trajectory.
   if (isAllValid(validation_status_)) {
     pub_traj_->publish(*current_trajectory_);
+    latency_hop_publisher_->publish(current_hop_input_, current_trajectory_->header.stamp);
     previous_published_trajectory_ = current_trajectory_;
     return;
   }
@@ -201,6 +221,7 @@ void PlanningValidator::publishTrajectory()
 
   if (invalid_trajectory_handling_type_ == InvalidTrajectoryHandlingType::PUBLISH_AS_IT_IS) {
     pub_traj_->publish(*current_trajectory_);
+    latency_hop_publisher_->publish(current_hop_input_, current_trajectory_->header.stamp);
     RCLCPP_ERROR(get_logger(), "Caution! Invalid Trajectory published.");
     return;
   }
@@ -213,6 +234,10 @@ void PlanningValidator::publishTrajectory()
   if (invalid_trajectory_handling_type_ == InvalidTrajectoryHandlingType::USE_PREVIOUS_RESULT) {
     if (previous_published_trajectory_) {
       pub_traj_->publish(*previous_published_trajectory_);
+      latency_hop_publisher_->publish(
+        latency_hop_publisher_->createInput(
+          sub_traj_->get_topic_name(), previous_published_trajectory_->header.stamp),
+        previous_published_trajectory_->header.stamp);
       RCLCPP_ERROR(get_logger(), "Invalid Trajectory detected. Use previous trajectory.");
       return;
     }
@@ -265,10 +290,7 @@ void PlanningValidator::validate(const Trajectory & trajectory)
   s.is_valid_velocity_deviation = checkValidVelocityDeviation(trajectory);
   s.is_valid_distance_deviation = checkValidDistanceDeviation(trajectory);
 
-  // use resampled trajectory because the following metrics can not be evaluated for closed points.
-  // Note: do not interpolate to keep original trajectory shape.
-  constexpr auto min_interval = 1.0;
-  const auto resampled = resampleTrajectory(trajectory, min_interval);
+  const auto resampled = resampleTrajectory(trajectory, resample_min_interval);
 
   s.is_valid_relative_angle = checkValidRelativeAngle(resampled);
   s.is_valid_curvature = checkValidCurvature(resampled);
@@ -278,6 +300,43 @@ void PlanningValidator::validate(const Trajectory & trajectory)
   s.invalid_count = isAllValid(s) ? 0 : s.invalid_count + 1;
 }
 
+void PlanningValidator::validateIncrementally(const Trajectory::ConstSharedPtr & trajectory)
+{
+  if (trajectory->points.size() < 2) {
+    RCLCPP_ERROR(get_logger(), "trajectory size is less than 2. Cannot validate.");
+    return;
+  }
+
+  // only the points changed from the previous trajectory are evaluated
+  auto & m = *incremental_metrics_;
+  m.update(trajectory, vehicle_info_.wheel_base_m);
+  RCLCPP_DEBUG(
+    get_logger(), "%lu / %lu points are shared with the previous trajectory", m.getSharedSize(),
+    trajectory->points.size());
+
+  auto & s = validation_status_;
+
+  s.is_valid_finite_value = m.isFinite();
+  s.is_valid_interval = checkValidInterval(*trajectory, m.getMaxIntervalDistance());
+  s.is_valid_lateral_acc =
+    checkValidLateralAcceleration(*trajectory, m.getMaxLateralAcceleration());
+  s.is_valid_longitudinal_max_acc =
+    checkValidMaxLongitudinalAcceleration(*trajectory, m.getMaxLongitudinalAcc());
+  s.is_valid_longitudinal_min_acc =
+    checkValidMinLongitudinalAcceleration(*trajectory, m.getMinLongitudinalAcc());
+  s.is_valid_velocity_deviation = checkValidVelocityDeviation(*trajectory);
+  s.is_valid_distance_deviation = checkValidDistanceDeviation(*trajectory);
+
+  const auto & resampled = m.getResampledTrajectory();
+
+  s.is_valid_relative_angle = checkValidRelativeAngle(resampled, m.getMaxRelativeAngle());
+  s.is_valid_curvature = checkValidCurvature(resampled, m.getMaxCurvature());
+  s.is_valid_steering = checkValidSteering(resampled, m.getMaxSteeringAngle());
+  s.is_valid_steering_rate = checkValidSteeringRate(resampled, m.getMaxSteeringRate());
+
+  s.invalid_count = isAllValid(s) ? 0 : s.invalid_count + 1;
+}
+
 bool PlanningValidator::checkValidFiniteValue(const Trajectory & trajectory)
 {
   for (const auto & p : trajectory.points) {
@@ -288,7 +347,13 @@ bool PlanningValidator::checkValidFiniteValue(const Trajectory & trajectory)
 
 bool PlanningValidator::checkValidInterval(const Trajectory & trajectory)
 {
-  const auto [max_interval_distance, i] = calcMaxIntervalDistance(trajectory);
+  return checkValidInterval(trajectory, calcMaxIntervalDistance(trajectory));
+}
+
+bool PlanningValidator::checkValidInterval(
+  const Trajectory & trajectory, const MetricResult & result)
+{
+  const auto [max_interval_distance, i] = result;
   validation_status_.max_interval_distance = max_interval_distance;
 
   if (max_interval_distance > validation_params_.interval_threshold) {
@@ -305,7 +370,13 @@ bool PlanningValidator::checkValidInterval(const Trajectory & trajectory)
 
 bool PlanningValidator::checkValidRelativeAngle(const Trajectory & trajectory)
 {
-  const auto [max_relative_angle, i] = calcMaxRelativeAngles(trajectory);
+  return checkValidRelativeAngle(trajectory, calcMaxRelativeAngles(trajectory));
+}
+
+bool PlanningValidator::checkValidRelativeAngle(
+  const Trajectory & trajectory, const MetricResult & result)
+{
+  const auto [max_relative_angle, i] = result;
   validation_status_.max_relative_angle = max_relative_angle;
 
   if (max_relative_angle > validation_params_.relative_angle_threshold) {
@@ -322,7 +393,13 @@ bool PlanningValidator::checkValidRelativeAngle(const Trajectory & trajectory)
 
 bool PlanningValidator::checkValidCurvature(const Trajectory & trajectory)
 {
-  const auto [max_curvature, i] = calcMaxCurvature(trajectory);
+  return checkValidCurvature(trajectory, calcMaxCurvature(trajectory));
+}
+
+bool PlanningValidator::checkValidCurvature(
+  const Trajectory & trajectory, const MetricResult & result)
+{
+  const auto [max_curvature, i] = result;
   validation_status_.max_curvature = max_curvature;
   if (max_curvature > validation_params_.curvature_threshold) {
     const auto & p = trajectory.points;
@@ -338,7 +415,13 @@ bool PlanningValidator::checkValidCurvature(const Trajectory & trajectory)
 
 bool PlanningValidator::checkValidLateralAcceleration(const Trajectory & trajectory)
 {
-  const auto [max_lateral_acc, i] = calcMaxLateralAcceleration(trajectory);
+  return checkValidLateralAcceleration(trajectory, calcMaxLateralAcceleration(trajectory));
+}
+
+bool PlanningValidator::checkValidLateralAcceleration(
+  const Trajectory & trajectory, const MetricResult & result)
+{
+  const auto [max_lateral_acc, i] = result;
   validation_status_.max_lateral_acc = max_lateral_acc;
   if (max_lateral_acc > validation_params_.lateral_acc_threshold) {
     debug_pose_publisher_->pushPoseMarker(trajectory.points.at(i), "lateral_acceleration");
@@ -349,7 +432,13 @@ bool PlanningValidator::checkValidLateralAcceleration(const Trajectory & traject
 
 bool PlanningValidator::checkValidMinLongitudinalAcceleration(const Trajectory & trajectory)
 {
-  const auto [min_longitudinal_acc, i] = getMinLongitudinalAcc(trajectory);
+  return checkValidMinLongitudinalAcceleration(trajectory, getMinLongitudinalAcc(trajectory));
+}
+
+bool PlanningValidator::checkValidMinLongitudinalAcceleration(
+  const Trajectory & trajectory, const MetricResult & result)
+{
+  const auto [min_longitudinal_acc, i] = result;
   validation_status_.min_longitudinal_acc = min_longitudinal_acc;
 
   if (min_longitudinal_acc < validation_params_.longitudinal_min_acc_threshold) {
@@ -361,7 +450,13 @@ bool PlanningValidator::checkValidMinLongitudinalAcceleration(const Trajectory &
 
 bool PlanningValidator::checkValidMaxLongitudinalAcceleration(const Trajectory & trajectory)
 {
-  const auto [max_longitudinal_acc, i] = getMaxLongitudinalAcc(trajectory);
+  return checkValidMaxLongitudinalAcceleration(trajectory, getMaxLongitudinalAcc(trajectory));
+}
+
+bool PlanningValidator::checkValidMaxLongitudinalAcceleration(
+  const Trajectory & trajectory, const MetricResult & result)
+{
+  const auto [max_longitudinal_acc, i] = result;
   validation_status_.max_longitudinal_acc = max_longitudinal_acc;
 
   if (max_longitudinal_acc > validation_params_.longitudinal_max_acc_threshold) {
@@ -373,7 +468,14 @@ bool PlanningValidator::checkValidMaxLongitudinalAcceleration(const Trajectory &
 
 bool PlanningValidator::checkValidSteering(const Trajectory & trajectory)
 {
-  const auto [max_steering, i] = calcMaxSteeringAngles(trajectory, vehicle_info_.wheel_base_m);
+  return checkValidSteering(
+    trajectory, calcMaxSteeringAngles(trajectory, vehicle_info_.wheel_base_m));
+}
+
+bool PlanningValidator::checkValidSteering(
+  const Trajectory & trajectory, const MetricResult & result)
+{
+  const auto [max_steering, i] = result;
   validation_status_.max_steering = max_steering;
 
   if (max_steering > validation_params_.steering_threshold) {
@@ -385,7 +487,14 @@ bool PlanningValidator::checkValidSteering(const Trajectory & trajectory)
 
 bool PlanningValidator::checkValidSteeringRate(const Trajectory & trajectory)
 {
-  const auto [max_steering_rate, i] = calcMaxSteeringRates(trajectory, vehicle_info_.wheel_base_m);
+  return checkValidSteeringRate(
+    trajectory, calcMaxSteeringRates(trajectory, vehicle_info_.wheel_base_m));
+}
+
+bool PlanningValidator::checkValidSteeringRate(
+  const Trajectory & trajectory, const MetricResult & result)
+{
+  const auto [max_steering_rate, i] = result;
   validation_status_.max_steering_rate = max_steering_rate;
 
   if (max_steering_rate > validation_params_.steering_rate_threshold) {
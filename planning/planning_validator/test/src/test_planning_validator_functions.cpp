@@ -13,11 +13,15 @@
 // limitations under the License.
 
 #include "planning_validator/debug_marker.hpp"
+#include "planning_validator/incremental_metrics.hpp"
 #include "planning_validator/planning_validator.hpp"
+#include "planning_validator/utils.hpp"
 #include "test_planning_validator_helper.hpp"
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <memory>
 #include <string>
 
 using autoware_auto_planning_msgs::msg::Trajectory;
@@ -159,3 +163,68 @@ TEST(PlanningValidatorTestSuite, checkValidRelativeAngleFunction)
     ASSERT_FALSE(validator->checkValidRelativeAngle(invalid_traj));
   }
 }
+
+TEST(PlanningValidatorTestSuite, incrementalMetricsFunction)
+{
+  using planning_validator::IncrementalMetrics;
+  constexpr double wheelbase = 3.0;
+  constexpr double min_interval = 1.0;
+
+  const auto expect_same_metrics = [&](const IncrementalMetrics & m, const Trajectory & traj) {
+    namespace pv = planning_validator;
+    const auto resampled = pv::resampleTrajectory(traj, min_interval);
+    EXPECT_EQ(m.getResampledTrajectory().points, resampled.points);
+    EXPECT_EQ(m.getMaxIntervalDistance(), pv::calcMaxIntervalDistance(traj));
+    EXPECT_EQ(m.getMaxLateralAcceleration(), pv::calcMaxLateralAcceleration(traj));
+    EXPECT_EQ(m.getMaxLongitudinalAcc(), pv::getMaxLongitudinalAcc(traj));
+    EXPECT_EQ(m.getMinLongitudinalAcc(), pv::getMinLongitudinalAcc(traj));
+    EXPECT_EQ(m.getMaxRelativeAngle(), pv::calcMaxRelativeAngles(resampled));
+    EXPECT_EQ(m.getMaxCurvature(), pv::calcMaxCurvature(resampled));
+    EXPECT_EQ(m.getMaxSteeringAngle(), pv::calcMaxSteeringAngles(resampled, wheelbase));
+    EXPECT_EQ(m.getMaxSteeringRate(), pv::calcMaxSteeringRates(resampled, wheelbase));
+  };
+
+  IncrementalMetrics metrics(min_interval);
+
+  // first trajectory: all points are evaluated
+  Trajectory traj = generateBadCurvatureTrajectory();
+  for (size_t i = 0; i < traj.points.size(); ++i) {
+    traj.points.at(i).acceleration_mps2 = 0.1 * static_cast<double>(i) - 0.5;
+  }
+  metrics.update(std::make_shared<const Trajectory>(traj), wheelbase);
+  EXPECT_EQ(metrics.getSharedSize(), 0u);
+  expect_same_metrics(metrics, traj);
+
+  // same trajectory: all points are shared
+  metrics.update(std::make_shared<const Trajectory>(traj), wheelbase);
+  EXPECT_EQ(metrics.getSharedSize(), traj.points.size());
+  expect_same_metrics(metrics, traj);
+
+  // changed suffix
+  traj.points.at(7).pose.position.y = 0.0;
+  traj.points.at(8).longitudinal_velocity_mps = 3.0;
+  metrics.update(std::make_shared<const Trajectory>(traj), wheelbase);
+  EXPECT_EQ(metrics.getSharedSize(), 7u);
+  expect_same_metrics(metrics, traj);
+
+  // shortened and extended trajectory
+  traj.points.resize(5);
+  metrics.update(std::make_shared<const Trajectory>(traj), wheelbase);
+  EXPECT_EQ(metrics.getSharedSize(), 5u);
+  expect_same_metrics(metrics, traj);
+
+  const auto extension = generateTrajectory(NOMINAL_INTERVAL);
+  for (const auto & p : extension.points) {
+    traj.points.push_back(p);
+    traj.points.back().pose.position.x += 5.0;
+  }
+  metrics.update(std::make_shared<const Trajectory>(traj), wheelbase);
+  EXPECT_EQ(metrics.getSharedSize(), 5u);
+  expect_same_metrics(metrics, traj);
+
+  // non-finite value in the changed points
+  EXPECT_TRUE(metrics.isFinite());
+  traj.points.back().pose.position.x = NAN;
+  metrics.update(std::make_shared<const Trajectory>(traj), wheelbase);
+  EXPECT_FALSE(metrics.isFinite());
+}
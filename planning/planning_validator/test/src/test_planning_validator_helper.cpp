@@ -80,6 +80,7 @@ rclcpp::NodeOptions getNodeOptionsWithDefaultParams()
   node_options.append_parameter_override("invalid_trajectory_handling_type", 0);
   node_options.append_parameter_override("diag_error_count_threshold", 0);
   node_options.append_parameter_override("display_on_terminal", false);
+  node_options.append_parameter_override("use_incremental_validation", false);
   node_options.append_parameter_override("thresholds.interval", ERROR_INTERVAL);
   node_options.append_parameter_override("thresholds.relative_angle", 1.0);
   node_options.append_parameter_override("thresholds.curvature", ERROR_CURVATURE);
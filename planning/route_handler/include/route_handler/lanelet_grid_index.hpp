@@ -0,0 +1,54 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROUTE_HANDLER__LANELET_GRID_INDEX_HPP_
+#define ROUTE_HANDLER__LANELET_GRID_INDEX_HPP_
+
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <lanelet2_core/primitives/Lanelet.h>
+
+#include <cstdint>
+#include <unordered_map>
+
+namespace route_handler
+{
+/**
+ * @brief grid of the lanelets overlapping each cell for closest lanelet lookups
+ * @details A pose inside at least one of the lanelets only needs to check the lanelets of its cell.
+ * Other poses fall back to checking all the lanelets, so the result is always the same as
+ * lanelet::utils::query::getClosestLanelet() over the indexed lanelets.
+ */
+class LaneletGridIndex
+{
+public:
+  void build(const lanelet::ConstLanelets & lanelets, const double cell_size = 10.0);
+
+  void clear();
+
+  bool getClosestLanelet(
+    const geometry_msgs::msg::Pose & search_pose, lanelet::ConstLanelet * closest_lanelet) const;
+
+private:
+  int64_t toCellIndex(const double coordinate) const;
+
+  lanelet::ConstLanelets lanelets_;
+  double inverse_cell_size_{0.1};
+  // the lanelets of each cell keep their order in lanelets_ so that ties are broken as in the
+  // linear search
+  std::unordered_map<int64_t, lanelet::ConstLanelets> cells_;
+};
+}  // namespace route_handler
+
+#endif  // ROUTE_HANDLER__LANELET_GRID_INDEX_HPP_
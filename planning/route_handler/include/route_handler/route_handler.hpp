@@ -15,6 +15,8 @@
 #ifndef ROUTE_HANDLER__ROUTE_HANDLER_HPP_
 #define ROUTE_HANDLER__ROUTE_HANDLER_HPP_
 
+#include "route_handler/lanelet_grid_index.hpp"
+
 #include <rclcpp/logger.hpp>
 
 #include <autoware_auto_mapping_msgs/msg/had_map_bin.hpp>
@@ -27,10 +29,16 @@
 #include <lanelet2_core/Forward.h>
 #include <lanelet2_core/primitives/Lanelet.h>
 #include <lanelet2_routing/Forward.h>
+#include <lanelet2_routing/LaneletPath.h>
 #include <lanelet2_traffic_rules/TrafficRules.h>
 
 #include <limits>
+#include <map>
 #include <memory>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace route_handler
@@ -71,6 +79,7 @@ public:
   bool isAllowedGoalModification() const;
 
   // for routing graph
+  // the map and the graphs are shared by the route handlers with the same map in the process
   bool isMapMsgReady() const;
   lanelet::routing::RoutingGraphPtr getRoutingGraphPtr() const;
   lanelet::traffic_rules::TrafficRulesPtr getTrafficRulesPtr() const;
@@ -366,6 +375,31 @@ private:
   lanelet::ConstLanelets goal_lanelets_;
   lanelet::ConstLanelets shoulder_lanelets_;
   std::shared_ptr<LaneletRoute> route_ptr_{nullptr};
+  std::shared_ptr<const std::unordered_map<const lanelet::LaneletData *, double>>
+    centerline_lengths_ptr_;
+
+  // lookups of the route lanelets, rebuilt by updateRouteCache() whenever they change
+  std::unordered_set<lanelet::Id> route_lanelet_ids_;
+  std::unordered_set<lanelet::Id> preferred_lanelet_ids_;
+  std::unordered_set<lanelet::Id> start_lanelet_ids_;
+  std::unordered_set<lanelet::Id> goal_lanelet_ids_;
+  std::optional<lanelet::Id> route_start_lanelet_id_;
+  LaneletGridIndex route_lanelets_index_;
+  LaneletGridIndex preferred_lanelets_index_;
+  std::shared_ptr<const LaneletGridIndex> road_lanelets_index_ptr_{
+    std::make_shared<LaneletGridIndex>()};
+
+  // results of the path searches between lanelets, which depend only on the routing graph. They
+  // are cleared when the map is set.
+  struct LaneletPathCache
+  {
+    bool is_found{false};
+    lanelet::routing::LaneletPath path;
+    double length2d{0.0};
+  };
+  using LaneletPathKey = std::pair<lanelet::Id, lanelet::Id>;
+  mutable std::map<LaneletPathKey, LaneletPathCache> shortest_path_cache_;
+  mutable std::map<LaneletPathKey, LaneletPathCache> drivable_path_cache_;
 
   rclcpp::Logger logger_{rclcpp::get_logger("route_handler")};
 
@@ -378,12 +412,14 @@ private:
 
   // non-const methods
   void setLaneletsFromRouteMsg();
+  void updateRouteCache();
 
   // const methods
   // for routing
   lanelet::ConstLanelets getMainLanelets(const lanelet::ConstLanelets & path_lanelets) const;
 
   // for lanelet
+  double getCenterlineLength(const lanelet::ConstLanelet & lanelet) const;
   bool isInTargetLane(const PoseStamped & pose, const lanelet::ConstLanelets & target) const;
   bool isInPreferredLane(const PoseStamped & pose) const;
   bool isBijectiveConnection(
@@ -449,6 +485,12 @@ private:
   bool findDrivableLanePath(
     const lanelet::ConstLanelet & start_lanelet, const lanelet::ConstLanelet & goal_lanelet,
     lanelet::routing::LaneletPath & drivable_lane_path) const;
+  /**
+   * @brief Returns the shortest path of routing_graph_ptr_->getRoute(), which is cached for each
+   * pair of the start and goal lanelets.
+   */
+  const LaneletPathCache & getShortestPath(
+    const lanelet::ConstLanelet & start_lanelet, const lanelet::ConstLanelet & goal_lanelet) const;
 };
 }  // namespace route_handler
 #endif  // ROUTE_HANDLER__ROUTE_HANDLER_HPP_
@@ -0,0 +1,94 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "route_handler/lanelet_grid_index.hpp"
+
+#include <lanelet2_extension/utility/query.hpp>
+
+#include <lanelet2_core/geometry/Lanelet.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace route_handler
+{
+namespace
+{
+// lanelets are also registered to the cells slightly outside of their bounding box, so that the
+// lanelets within the tie tolerance of the linear search are never missed
+constexpr double bounding_box_margin = 1e-3;
+
+int64_t toCellKey(const int64_t cell_x, const int64_t cell_y)
+{
+  return static_cast<int64_t>(
+    (static_cast<uint64_t>(cell_x) << 32) ^ (static_cast<uint64_t>(cell_y) & 0xffffffff));
+}
+}  // namespace
+
+void LaneletGridIndex::build(const lanelet::ConstLanelets & lanelets, const double cell_size)
+{
+  if (cell_size <= 0.0) {
+    throw std::invalid_argument("The cell size of the lanelet grid index should be positive.");
+  }
+  clear();
+  lanelets_ = lanelets;
+  inverse_cell_size_ = 1.0 / cell_size;
+
+  for (const auto & lanelet : lanelets_) {
+    const auto bounding_box = lanelet::geometry::boundingBox2d(lanelet);
+    const auto min_x = toCellIndex(bounding_box.min().x() - bounding_box_margin);
+    const auto min_y = toCellIndex(bounding_box.min().y() - bounding_box_margin);
+    const auto max_x = toCellIndex(bounding_box.max().x() + bounding_box_margin);
+    const auto max_y = toCellIndex(bounding_box.max().y() + bounding_box_margin);
+    for (auto x = min_x; x <= max_x; ++x) {
+      for (auto y = min_y; y <= max_y; ++y) {
+        cells_[toCellKey(x, y)].push_back(lanelet);
+      }
+    }
+  }
+}
+
+void LaneletGridIndex::clear()
+{
+  lanelets_.clear();
+  cells_.clear();
+}
+
+bool LaneletGridIndex::getClosestLanelet(
+  const geometry_msgs::msg::Pose & search_pose, lanelet::ConstLanelet * closest_lanelet) const
+{
+  const lanelet::BasicPoint2d search_point(search_pose.position.x, search_pose.position.y);
+  const auto cell =
+    cells_.find(toCellKey(toCellIndex(search_point.x()), toCellIndex(search_point.y())));
+  if (cell != cells_.end()) {
+    // the lanelets containing the pose are the candidates of the linear search, and they are all
+    // in the cell of the pose
+    const bool is_inside = std::any_of(
+      cell->second.begin(), cell->second.end(), [&search_point](const auto & lanelet) {
+        return boost::geometry::comparable_distance(
+                 lanelet.polygon2d().basicPolygon(), search_point) <= 0.0;
+      });
+    if (is_inside) {
+      return lanelet::utils::query::getClosestLanelet(cell->second, search_pose, closest_lanelet);
+    }
+  }
+  return lanelet::utils::query::getClosestLanelet(lanelets_, search_pose, closest_lanelet);
+}
+
+int64_t LaneletGridIndex::toCellIndex(const double coordinate) const
+{
+  return static_cast<int64_t>(std::floor(coordinate * inverse_cell_size_));
+}
+}  // namespace route_handler
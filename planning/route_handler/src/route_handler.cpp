@@ -25,6 +25,7 @@
 #include <autoware_auto_planning_msgs/msg/path_point_with_lane_id.hpp>
 #include <autoware_planning_msgs/msg/lanelet_primitive.hpp>
 
+#include <lanelet2_core/LaneletMap.h>
 #include <lanelet2_core/geometry/Lanelet.h>
 #include <lanelet2_core/primitives/LaneletSequence.h>
 #include <lanelet2_routing/Route.h>
@@ -34,9 +35,15 @@
 
 #include <algorithm>
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace
@@ -69,6 +76,20 @@ bool exists(const std::vector<T> & vectors, const T & item)
   return false;
 }
 
+bool exists(const std::unordered_set<lanelet::Id> & ids, const lanelet::ConstLanelet & lanelet)
+{
+  return ids.count(lanelet.id()) > 0;
+}
+
+std::unordered_set<lanelet::Id> getIds(const lanelet::ConstLanelets & lanelets)
+{
+  std::unordered_set<lanelet::Id> ids;
+  for (const auto & lanelet : lanelets) {
+    ids.insert(lanelet.id());
+  }
+  return ids;
+}
+
 lanelet::ConstPoint3d get3DPointFrom2DArcLength(
   const lanelet::ConstLanelets & lanelet_sequence, const double s)
 {
@@ -127,6 +148,74 @@ std::string toString(const geometry_msgs::msg::Pose & pose)
   return ss.str();
 }
 
+struct SharedLaneletMap
+{
+  lanelet::LaneletMapPtr lanelet_map;
+  lanelet::traffic_rules::TrafficRulesPtr traffic_rules;
+  lanelet::routing::RoutingGraphPtr routing_graph;
+  std::shared_ptr<const lanelet::routing::RoutingGraphContainer> overall_graphs;
+  std::unordered_map<const lanelet::LaneletData *, double> centerline_lengths;
+  lanelet::ConstLanelets road_lanelets;
+  route_handler::LaneletGridIndex road_lanelets_index;
+};
+
+std::shared_ptr<SharedLaneletMap> createSharedLaneletMap(
+  const autoware_auto_mapping_msgs::msg::HADMapBin & map_msg)
+{
+  auto shared_map = std::make_shared<SharedLaneletMap>();
+  shared_map->lanelet_map = std::make_shared<lanelet::LaneletMap>();
+  lanelet::utils::conversion::fromBinMsg(
+    map_msg, shared_map->lanelet_map, &shared_map->traffic_rules, &shared_map->routing_graph);
+
+  // the routing graph of fromBinMsg is already built with the vehicle rules
+  const auto pedestrian_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
+    lanelet::Locations::Germany, lanelet::Participants::Pedestrian);
+  const lanelet::routing::RoutingGraphConstPtr pedestrian_graph =
+    lanelet::routing::RoutingGraph::build(*shared_map->lanelet_map, *pedestrian_rules);
+  shared_map->overall_graphs = std::make_shared<const lanelet::routing::RoutingGraphContainer>(
+    std::vector<lanelet::routing::RoutingGraphConstPtr>{
+      shared_map->routing_graph, pedestrian_graph});
+
+  // centerlines are computed and cached on their first access, which must not happen
+  // concurrently once the map is shared
+  for (const auto & lanelet : shared_map->lanelet_map->laneletLayer) {
+    shared_map->centerline_lengths[lanelet.constData().get()] =
+      static_cast<double>(boost::geometry::length(lanelet.centerline().basicLineString()));
+  }
+
+  const auto all_lanelets = lanelet::utils::query::laneletLayer(shared_map->lanelet_map);
+  shared_map->road_lanelets = lanelet::utils::query::roadLanelets(all_lanelets);
+  shared_map->road_lanelets_index.build(shared_map->road_lanelets);
+  return shared_map;
+}
+
+// the number of the cached path searches, which are all dropped when it is exceeded
+constexpr size_t max_path_cache_size = 1000;
+
+// the route handlers of the nodes composed in a process receive the same map message, so it is
+// deserialized only once and shared as long as any of them holds it
+std::shared_ptr<SharedLaneletMap> getSharedLaneletMap(
+  const autoware_auto_mapping_msgs::msg::HADMapBin & map_msg)
+{
+  static std::mutex mutex;
+  static std::map<std::pair<size_t, size_t>, std::weak_ptr<SharedLaneletMap>> shared_maps;
+
+  const std::pair<size_t, size_t> key{
+    map_msg.data.size(),
+    std::hash<std::string_view>{}(std::string_view(
+      reinterpret_cast<const char *>(map_msg.data.data()), map_msg.data.size()))};
+
+  std::lock_guard<std::mutex> lock(mutex);
+  for (auto itr = shared_maps.begin(); itr != shared_maps.end();) {
+    itr = itr->second.expired() ? shared_maps.erase(itr) : std::next(itr);
+  }
+  if (const auto shared_map = shared_maps[key].lock()) {
+    return shared_map;
+  }
+  const auto shared_map = createSharedLaneletMap(map_msg);
+  shared_maps[key] = shared_map;
+  return shared_map;
+}
 }  // namespace
 
 namespace route_handler
@@ -139,23 +228,26 @@ RouteHandler::RouteHandler(const HADMapBin & map_msg)
 
 void RouteHandler::setMap(const HADMapBin & map_msg)
 {
-  lanelet_map_ptr_ = std::make_shared<lanelet::LaneletMap>();
-  lanelet::utils::conversion::fromBinMsg(
-    map_msg, lanelet_map_ptr_, &traffic_rules_ptr_, &routing_graph_ptr_);
+  // the pointers share the ownership of the whole map so that it stays in the registry while used
+  const auto shared_map = getSharedLaneletMap(map_msg);
+  lanelet_map_ptr_ = lanelet::LaneletMapPtr(shared_map, shared_map->lanelet_map.get());
+  traffic_rules_ptr_ =
+    lanelet::traffic_rules::TrafficRulesPtr(shared_map, shared_map->traffic_rules.get());
+  routing_graph_ptr_ =
+    lanelet::routing::RoutingGraphPtr(shared_map, shared_map->routing_graph.get());
+  overall_graphs_ptr_ = std::shared_ptr<const lanelet::routing::RoutingGraphContainer>(
+    shared_map, shared_map->overall_graphs.get());
+  centerline_lengths_ptr_ =
+    std::shared_ptr<const std::unordered_map<const lanelet::LaneletData *, double>>(
+      shared_map, &shared_map->centerline_lengths);
+
+  road_lanelets_index_ptr_ =
+    std::shared_ptr<const LaneletGridIndex>(shared_map, &shared_map->road_lanelets_index);
+  shortest_path_cache_.clear();
+  drivable_path_cache_.clear();
 
-  const auto traffic_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
-    lanelet::Locations::Germany, lanelet::Participants::Vehicle);
-  const auto pedestrian_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
-    lanelet::Locations::Germany, lanelet::Participants::Pedestrian);
-  const lanelet::routing::RoutingGraphConstPtr vehicle_graph =
-    lanelet::routing::RoutingGraph::build(*lanelet_map_ptr_, *traffic_rules);
-  const lanelet::routing::RoutingGraphConstPtr pedestrian_graph =
-    lanelet::routing::RoutingGraph::build(*lanelet_map_ptr_, *pedestrian_rules);
-  const lanelet::routing::RoutingGraphContainer overall_graphs({vehicle_graph, pedestrian_graph});
-  overall_graphs_ptr_ =
-    std::make_shared<const lanelet::routing::RoutingGraphContainer>(overall_graphs);
   lanelet::ConstLanelets all_lanelets = lanelet::utils::query::laneletLayer(lanelet_map_ptr_);
-  road_lanelets_ = lanelet::utils::query::roadLanelets(all_lanelets);
+  road_lanelets_ = shared_map->road_lanelets;
   shoulder_lanelets_ = lanelet::utils::query::shoulderLanelets(all_lanelets);
 
   is_map_msg_ready_ = true;
@@ -298,6 +390,7 @@ void RouteHandler::setRouteLanelets(const lanelet::ConstLanelets & path_lanelets
   for (const auto & id : route_lanelets_id) {
     route_lanelets_.push_back(lanelet_map_ptr_->laneletLayer.get(id));
   }
+  updateRouteCache();
   is_handler_ready_ = true;
 }
 
@@ -308,6 +401,7 @@ void RouteHandler::clearRoute()
   start_lanelets_.clear();
   goal_lanelets_.clear();
   route_ptr_ = nullptr;
+  updateRouteCache();
   is_handler_ready_ = false;
 }
 
@@ -320,6 +414,7 @@ void RouteHandler::setLaneletsFromRouteMsg()
   preferred_lanelets_.clear();
   const bool is_route_valid = lanelet::utils::route::isRouteValid(*route_ptr_, lanelet_map_ptr_);
   if (!is_route_valid) {
+    updateRouteCache();
     return;
   }
 
@@ -355,9 +450,39 @@ void RouteHandler::setLaneletsFromRouteMsg()
       start_lanelets_.push_back(llt);
     }
   }
+  updateRouteCache();
   is_handler_ready_ = true;
 }
 
+void RouteHandler::updateRouteCache()
+{
+  route_lanelet_ids_ = getIds(route_lanelets_);
+  preferred_lanelet_ids_ = getIds(preferred_lanelets_);
+  start_lanelet_ids_ = getIds(start_lanelets_);
+  goal_lanelet_ids_ = getIds(goal_lanelets_);
+  route_lanelets_index_.build(route_lanelets_);
+  preferred_lanelets_index_.build(preferred_lanelets_);
+
+  // the lanelet of the start pose does not change until the route does
+  lanelet::ConstLanelet start_lanelet;
+  if (route_ptr_ && getClosestLaneletWithinRoute(route_ptr_->start_pose, &start_lanelet)) {
+    route_start_lanelet_id_ = start_lanelet.id();
+  } else {
+    route_start_lanelet_id_ = std::nullopt;
+  }
+}
+
+double RouteHandler::getCenterlineLength(const lanelet::ConstLanelet & lanelet) const
+{
+  if (centerline_lengths_ptr_) {
+    const auto itr = centerline_lengths_ptr_->find(lanelet.constData().get());
+    if (itr != centerline_lengths_ptr_->end()) {
+      return itr->second;
+    }
+  }
+  return static_cast<double>(boost::geometry::length(lanelet.centerline().basicLineString()));
+}
+
 lanelet::ConstPolygon3d RouteHandler::getIntersectionAreaById(const lanelet::Id id) const
 {
   return lanelet_map_ptr_->polygonLayer.get(id);
@@ -527,7 +652,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequenceAfter(
   const lanelet::ConstLanelet & lanelet, const double min_length, const bool only_route_lanes) const
 {
   lanelet::ConstLanelets lanelet_sequence_forward;
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
+  if (only_route_lanes && !exists(route_lanelet_ids_, lanelet)) {
     return lanelet_sequence_forward;
   }
 
@@ -551,8 +676,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequenceAfter(
     }
     lanelet_sequence_forward.push_back(next_lanelet);
     current_lanelet = next_lanelet;
-    length +=
-      static_cast<double>(boost::geometry::length(next_lanelet.centerline().basicLineString()));
+    length += getCenterlineLength(next_lanelet);
   }
 
   return lanelet_sequence_forward;
@@ -562,7 +686,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequenceUpTo(
   const lanelet::ConstLanelet & lanelet, const double min_length, const bool only_route_lanes) const
 {
   lanelet::ConstLanelets lanelet_sequence_backward;
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
+  if (only_route_lanes && !exists(route_lanelet_ids_, lanelet)) {
     return lanelet_sequence_backward;
   }
 
@@ -610,8 +734,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequenceUpTo(
         continue;
       }
       lanelet_sequence_backward.push_back(prev_lanelet);
-      length +=
-        static_cast<double>(boost::geometry::length(prev_lanelet.centerline().basicLineString()));
+      length += getCenterlineLength(prev_lanelet);
       current_lanelet = prev_lanelet;
       break;
     }
@@ -632,7 +755,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequence(
   }
 
   lanelet::ConstLanelets lanelet_sequence;
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
+  if (only_route_lanes && !exists(route_lanelet_ids_, lanelet)) {
     return lanelet_sequence;
   }
 
@@ -666,7 +789,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequence(
   const double forward_distance, const bool only_route_lanes) const
 {
   lanelet::ConstLanelets lanelet_sequence;
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
+  if (only_route_lanes && !exists(route_lanelet_ids_, lanelet)) {
     return lanelet_sequence;
   }
 
@@ -748,8 +871,7 @@ lanelet::ConstLanelets RouteHandler::getShoulderLaneletSequenceAfter(
     }
     lanelet_sequence_forward.push_back(next_lanelet);
     current_lanelet = next_lanelet;
-    length +=
-      static_cast<double>(boost::geometry::length(next_lanelet.centerline().basicLineString()));
+    length += getCenterlineLength(next_lanelet);
   }
 
   return lanelet_sequence_forward;
@@ -785,8 +907,7 @@ lanelet::ConstLanelets RouteHandler::getShoulderLaneletSequenceUpTo(
 
     lanelet_sequence_backward.insert(lanelet_sequence_backward.begin(), prev_lanelet);
     current_lanelet = prev_lanelet;
-    length +=
-      static_cast<double>(boost::geometry::length(prev_lanelet.centerline().basicLineString()));
+    length += getCenterlineLength(prev_lanelet);
   }
 
   return lanelet_sequence_backward;
@@ -830,14 +951,13 @@ lanelet::ConstLanelets RouteHandler::getShoulderLaneletSequence(
 bool RouteHandler::getClosestLaneletWithinRoute(
   const Pose & search_pose, lanelet::ConstLanelet * closest_lanelet) const
 {
-  return lanelet::utils::query::getClosestLanelet(route_lanelets_, search_pose, closest_lanelet);
+  return route_lanelets_index_.getClosestLanelet(search_pose, closest_lanelet);
 }
 
 bool RouteHandler::getClosestPreferredLaneletWithinRoute(
   const Pose & search_pose, lanelet::ConstLanelet * closest_lanelet) const
 {
-  return lanelet::utils::query::getClosestLanelet(
-    preferred_lanelets_, search_pose, closest_lanelet);
+  return preferred_lanelets_index_.getClosestLanelet(search_pose, closest_lanelet);
 }
 
 bool RouteHandler::getClosestLaneletWithConstrainsWithinRoute(
@@ -851,16 +971,13 @@ bool RouteHandler::getClosestLaneletWithConstrainsWithinRoute(
 bool RouteHandler::getNextLaneletWithinRoute(
   const lanelet::ConstLanelet & lanelet, lanelet::ConstLanelet * next_lanelet) const
 {
-  if (exists(goal_lanelets_, lanelet)) {
+  if (exists(goal_lanelet_ids_, lanelet)) {
     return false;
   }
 
-  lanelet::ConstLanelet start_lanelet;
-  const bool flag_check = getClosestLaneletWithinRoute(route_ptr_->start_pose, &start_lanelet);
-
   const auto following_lanelets = routing_graph_ptr_->following(lanelet);
   for (const auto & llt : following_lanelets) {
-    if (!(flag_check && start_lanelet.id() == llt.id()) && exists(route_lanelets_, llt)) {
+    if (route_start_lanelet_id_ != llt.id() && exists(route_lanelet_ids_, llt)) {
       *next_lanelet = llt;
       return true;
     }
@@ -876,13 +993,13 @@ lanelet::ConstLanelets RouteHandler::getNextLanelets(const lanelet::ConstLanelet
 bool RouteHandler::getPreviousLaneletsWithinRoute(
   const lanelet::ConstLanelet & lanelet, lanelet::ConstLanelets * prev_lanelets) const
 {
-  if (exists(start_lanelets_, lanelet)) {
+  if (exists(start_lanelet_ids_, lanelet)) {
     return false;
   }
   const auto candidate_lanelets = routing_graph_ptr_->previous(lanelet);
   prev_lanelets->clear();
   for (const auto & llt : candidate_lanelets) {
-    if (exists(route_lanelets_, llt)) {
+    if (exists(route_lanelet_ids_, llt)) {
       prev_lanelets->push_back(llt);
     }
   }
@@ -906,7 +1023,7 @@ bool RouteHandler::getRightLaneletWithinRoute(
   const auto opt_right_lanelet = routing_graph_ptr_->right(lanelet);
   if (!!opt_right_lanelet) {
     *right_lanelet = opt_right_lanelet.get();
-    return exists(route_lanelets_, *right_lanelet);
+    return exists(route_lanelet_ids_, *right_lanelet);
   }
   return false;
 }
@@ -914,12 +1031,12 @@ bool RouteHandler::getRightLaneletWithinRoute(
 bool RouteHandler::getNextLaneletWithinRouteExceptStart(
   const lanelet::ConstLanelet & lanelet, lanelet::ConstLanelet * next_lanelet) const
 {
-  if (exists(goal_lanelets_, lanelet)) {
+  if (exists(goal_lanelet_ids_, lanelet)) {
     return false;
   }
   const lanelet::ConstLanelets following_lanelets = routing_graph_ptr_->following(lanelet);
   for (const auto & llt : following_lanelets) {
-    if (exists(route_lanelets_, llt) && !exists(start_lanelets_, llt)) {
+    if (exists(route_lanelet_ids_, llt) && !exists(start_lanelet_ids_, llt)) {
       *next_lanelet = llt;
       return true;
     }
@@ -930,12 +1047,12 @@ bool RouteHandler::getNextLaneletWithinRouteExceptStart(
 bool RouteHandler::getPreviousLaneletWithinRouteExceptGoal(
   const lanelet::ConstLanelet & lanelet, lanelet::ConstLanelet * prev_lanelet) const
 {
-  if (exists(start_lanelets_, lanelet)) {
+  if (exists(start_lanelet_ids_, lanelet)) {
     return false;
   }
   const lanelet::ConstLanelets previous_lanelets = routing_graph_ptr_->previous(lanelet);
   for (const auto & llt : previous_lanelets) {
-    if (exists(route_lanelets_, llt) && !(exists(goal_lanelets_, llt))) {
+    if (exists(route_lanelet_ids_, llt) && !(exists(goal_lanelet_ids_, llt))) {
       *prev_lanelet = llt;
       return true;
     }
@@ -1051,7 +1168,7 @@ bool RouteHandler::getLeftLaneletWithinRoute(
   const auto opt_left_lanelet = routing_graph_ptr_->left(lanelet);
   if (!!opt_left_lanelet) {
     *left_lanelet = opt_left_lanelet.get();
-    return exists(route_lanelets_, *left_lanelet);
+    return exists(route_lanelet_ids_, *left_lanelet);
   }
   return false;
 }
@@ -1516,7 +1633,7 @@ lanelet::ConstLanelets RouteHandler::getClosestLaneletSequence(const Pose & pose
 int RouteHandler::getNumLaneToPreferredLane(
   const lanelet::ConstLanelet & lanelet, const Direction direction) const
 {
-  if (exists(preferred_lanelets_, lanelet)) {
+  if (exists(preferred_lanelet_ids_, lanelet)) {
     return 0;
   }
 
@@ -1526,7 +1643,7 @@ int RouteHandler::getNumLaneToPreferredLane(
       lanelet::utils::query::getAllNeighborsRight(routing_graph_ptr_, lanelet);
     for (const auto & right : right_lanes) {
       num--;
-      if (exists(preferred_lanelets_, right)) {
+      if (exists(preferred_lanelet_ids_, right)) {
         return num;
       }
     }
@@ -1538,7 +1655,7 @@ int RouteHandler::getNumLaneToPreferredLane(
     int num = 0;
     for (const auto & left : left_lanes) {
       num++;
-      if (exists(preferred_lanelets_, left)) {
+      if (exists(preferred_lanelet_ids_, left)) {
         return num;
       }
     }
@@ -1557,7 +1674,7 @@ double RouteHandler::getTotalLateralDistanceToPreferredLane(
 std::vector<double> RouteHandler::getLateralIntervalsToPreferredLane(
   const lanelet::ConstLanelet & lanelet, const Direction direction) const
 {
-  if (exists(preferred_lanelets_, lanelet)) {
+  if (exists(preferred_lanelet_ids_, lanelet)) {
     return {};
   }
 
@@ -1576,7 +1693,7 @@ std::vector<double> RouteHandler::getLateralIntervalsToPreferredLane(
       const auto & next_pt = next_centerline.front();
       intervals.push_back(-lanelet::geometry::distance2d(to2D(curr_pt), to2D(next_pt)));
 
-      if (exists(preferred_lanelets_, right)) {
+      if (exists(preferred_lanelet_ids_, right)) {
         return intervals;
       }
       current_lanelet = right;
@@ -1598,7 +1715,7 @@ std::vector<double> RouteHandler::getLateralIntervalsToPreferredLane(
       const auto & next_pt = next_centerline.front();
       intervals.push_back(lanelet::geometry::distance2d(to2D(curr_pt), to2D(next_pt)));
 
-      if (exists(preferred_lanelets_, left)) {
+      if (exists(preferred_lanelet_ids_, left)) {
         return intervals;
       }
       current_lanelet = left;
@@ -1610,7 +1727,7 @@ std::vector<double> RouteHandler::getLateralIntervalsToPreferredLane(
 
 bool RouteHandler::isPreferredLane(const lanelet::ConstLanelet & lanelet) const
 {
-  return exists(preferred_lanelets_, lanelet);
+  return exists(preferred_lanelet_ids_, lanelet);
 }
 
 bool RouteHandler::isInPreferredLane(const PoseStamped & pose) const
@@ -1619,7 +1736,7 @@ bool RouteHandler::isInPreferredLane(const PoseStamped & pose) const
   if (!getClosestLaneletWithinRoute(pose.pose, &lanelet)) {
     return false;
   }
-  return exists(preferred_lanelets_, lanelet);
+  return exists(preferred_lanelet_ids_, lanelet);
 }
 
 bool RouteHandler::isInTargetLane(
@@ -1925,7 +2042,7 @@ lanelet::ConstLanelets RouteHandler::getPreviousLaneletSequence(
   }
 
   const auto & first_lane = lanelet_sequence.front();
-  if (exists(start_lanelets_, first_lane)) {
+  if (exists(start_lanelet_ids_, first_lane)) {
     return previous_lanelet_sequence;
   }
 
@@ -1963,7 +2080,7 @@ lanelet::ConstLanelets RouteHandler::getLaneSequenceUpTo(
   const lanelet::ConstLanelet & lanelet) const
 {
   lanelet::ConstLanelets lanelet_sequence_backward;
-  if (!exists(route_lanelets_, lanelet)) {
+  if (!exists(route_lanelet_ids_, lanelet)) {
     return lanelet_sequence_backward;
   }
 
@@ -2018,7 +2135,7 @@ lanelet::ConstLanelets RouteHandler::getLaneSequenceAfter(
   const lanelet::ConstLanelet & lanelet) const
 {
   lanelet::ConstLanelets lane_sequence_forward;
-  if (!exists(route_lanelets_, lanelet)) {
+  if (!exists(route_lanelet_ids_, lanelet)) {
     return lane_sequence_forward;
   }
   lane_sequence_forward.push_back(lanelet);
@@ -2049,7 +2166,7 @@ lanelet::ConstLanelets RouteHandler::getNeighborsWithinRoute(
     lanelet::utils::query::getAllNeighbors(routing_graph_ptr_, lanelet);
   lanelet::ConstLanelets neighbors_within_route;
   for (const auto & llt : neighbor_lanelets) {
-    if (exists(route_lanelets_, llt)) {
+    if (exists(route_lanelet_ids_, llt)) {
       neighbors_within_route.push_back(llt);
     }
   }
@@ -2095,8 +2212,7 @@ bool RouteHandler::planPathLaneletsBetweenCheckpoints(
   lanelet::ConstLanelets start_lanelets;
   if (!lanelet::utils::query::getCurrentLanelets(
         road_lanelets_, start_checkpoint, &start_lanelets)) {
-    if (!lanelet::utils::query::getClosestLanelet(
-          road_lanelets_, start_checkpoint, &start_lanelet)) {
+    if (!road_lanelets_index_ptr_->getClosestLanelet(start_checkpoint, &start_lanelet)) {
       RCLCPP_WARN_STREAM(
         logger_, "Failed to find current lanelet."
                    << std::endl
@@ -2109,7 +2225,7 @@ bool RouteHandler::planPathLaneletsBetweenCheckpoints(
 
   // Find lanelets for goal point.
   lanelet::ConstLanelet goal_lanelet;
-  if (!lanelet::utils::query::getClosestLanelet(road_lanelets_, goal_checkpoint, &goal_lanelet)) {
+  if (!road_lanelets_index_ptr_->getClosestLanelet(goal_checkpoint, &goal_lanelet)) {
     RCLCPP_WARN_STREAM(
       logger_, "Failed to find closest lanelet."
                  << std::endl
@@ -2118,7 +2234,6 @@ bool RouteHandler::planPathLaneletsBetweenCheckpoints(
     return false;
   }
 
-  lanelet::Optional<lanelet::routing::Route> optional_route;
   std::vector<lanelet::ConstLanelets> candidate_paths;
   lanelet::routing::LaneletPath shortest_path;
   bool is_route_found = false;
@@ -2128,8 +2243,8 @@ bool RouteHandler::planPathLaneletsBetweenCheckpoints(
   double shortest_path_length2d = std::numeric_limits<double>::max();
 
   for (const auto & st_llt : start_lanelets) {
-    optional_route = routing_graph_ptr_->getRoute(st_llt, goal_lanelet, 0);
-    if (!optional_route) {
+    const auto & route_path = getShortestPath(st_llt, goal_lanelet);
+    if (!route_path.is_found) {
       RCLCPP_ERROR_STREAM(
         logger_, "Failed to find a proper path!"
                    << std::endl
@@ -2140,9 +2255,9 @@ bool RouteHandler::planPathLaneletsBetweenCheckpoints(
     } else {
       is_route_found = true;
 
-      if (optional_route->length2d() < shortest_path_length2d) {
-        shortest_path_length2d = optional_route->length2d();
-        shortest_path = optional_route->shortestPath();
+      if (route_path.length2d < shortest_path_length2d) {
+        shortest_path_length2d = route_path.length2d;
+        shortest_path = route_path.path;
         start_lanelet = st_llt;
       }
     }
@@ -2231,6 +2346,14 @@ bool RouteHandler::findDrivableLanePath(
   const lanelet::ConstLanelet & start_lanelet, const lanelet::ConstLanelet & goal_lanelet,
   lanelet::routing::LaneletPath & drivable_lane_path) const
 {
+  const LaneletPathKey key{start_lanelet.id(), goal_lanelet.id()};
+  if (const auto itr = drivable_path_cache_.find(key); itr != drivable_path_cache_.end()) {
+    if (itr->second.is_found) {
+      drivable_lane_path = itr->second.path;
+    }
+    return itr->second.is_found;
+  }
+
   double drivable_lane_path_length2d = std::numeric_limits<double>::max();
   bool drivable_lane_path_found = false;
 
@@ -2250,7 +2373,37 @@ bool RouteHandler::findDrivableLanePath(
     via_lanelet.clear();
   }
 
+  if (drivable_path_cache_.size() >= max_path_cache_size) {
+    drivable_path_cache_.clear();
+  }
+  auto & cache = drivable_path_cache_[key];
+  cache.is_found = drivable_lane_path_found;
+  if (drivable_lane_path_found) {
+    cache.path = drivable_lane_path;
+    cache.length2d = drivable_lane_path_length2d;
+  }
   return drivable_lane_path_found;
 }
 
+const RouteHandler::LaneletPathCache & RouteHandler::getShortestPath(
+  const lanelet::ConstLanelet & start_lanelet, const lanelet::ConstLanelet & goal_lanelet) const
+{
+  const LaneletPathKey key{start_lanelet.id(), goal_lanelet.id()};
+  if (const auto itr = shortest_path_cache_.find(key); itr != shortest_path_cache_.end()) {
+    return itr->second;
+  }
+
+  if (shortest_path_cache_.size() >= max_path_cache_size) {
+    shortest_path_cache_.clear();
+  }
+  auto & cache = shortest_path_cache_[key];
+  const auto optional_route = routing_graph_ptr_->getRoute(start_lanelet, goal_lanelet, 0);
+  if (optional_route) {
+    cache.is_found = true;
+    cache.path = optional_route->shortestPath();
+    cache.length2d = optional_route->length2d();
+  }
+  return cache;
+}
+
 }  // namespace route_handler
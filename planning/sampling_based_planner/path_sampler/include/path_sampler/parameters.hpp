@@ -32,6 +32,7 @@ struct Parameters
     std::vector<double> target_lengths{};
     std::vector<double> target_lateral_positions{};
     int nb_target_lateral_positions{};
+    int nb_threads{};
     struct
     {
       std::vector<double> target_lateral_velocities{};
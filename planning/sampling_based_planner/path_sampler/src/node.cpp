@@ -26,8 +26,12 @@
 
 #include <boost/geometry/algorithms/distance.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <limits>
+#include <thread>
+#include <vector>
 
 namespace path_sampler
 {
@@ -100,6 +104,7 @@ PathSampler::PathSampler(const rclcpp::NodeOptions & node_options)
       declare_parameter<std::vector<double>>("sampling.target_lateral_positions");
     params_.sampling.nb_target_lateral_positions =
       declare_parameter<int>("sampling.nb_target_lateral_positions");
+    params_.sampling.nb_threads = declare_parameter<int>("sampling.nb_threads", 1);
     params_.sampling.frenet.target_lateral_velocities =
       declare_parameter<std::vector<double>>("sampling.frenet.target_lateral_velocities");
     params_.sampling.frenet.target_lateral_accelerations =
@@ -161,6 +166,7 @@ rcl_interfaces::msg::SetParametersResult PathSampler::onParam(
   updateParam(
     parameters, "sampling.nb_target_lateral_positions",
     params_.sampling.nb_target_lateral_positions);
+  updateParam(parameters, "sampling.nb_threads", params_.sampling.nb_threads);
   updateParam(
     parameters, "sampling.frenet.target_lateral_velocities",
     params_.sampling.frenet.target_lateral_velocities);
@@ -435,12 +441,26 @@ std::vector<TrajectoryPoint> PathSampler::generatePath(const PlannerData & plann
       resetPreviousData();
     }
   }
-  debug_data_.footprints.clear();
-  for (auto & path : candidate_paths) {
-    const auto footprint =
-      sampler_common::constraints::checkHardConstraints(path, params_.constraints);
-    debug_data_.footprints.push_back(footprint);
-    sampler_common::constraints::calculateCost(path, params_.constraints, path_spline);
+  // each candidate only writes to its own path and footprint so they can be evaluated in parallel
+  debug_data_.footprints.assign(candidate_paths.size(), {});
+  std::atomic<size_t> next_path_idx{0};
+  const auto evaluate_paths = [&]() {
+    for (auto idx = next_path_idx++; idx < candidate_paths.size(); idx = next_path_idx++) {
+      auto & path = candidate_paths[idx];
+      debug_data_.footprints[idx] =
+        sampler_common::constraints::checkHardConstraints(path, params_.constraints);
+      sampler_common::constraints::calculateCost(path, params_.constraints, path_spline);
+    }
+  };
+  const auto nb_workers = std::min(
+    static_cast<size_t>(std::max(params_.sampling.nb_threads, 1)), candidate_paths.size());
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < nb_workers; ++i) {
+    workers.emplace_back(evaluate_paths);
+  }
+  evaluate_paths();
+  for (auto & worker : workers) {
+    worker.join();
   }
   const auto best_path_idx = [](const auto & paths) {
     auto min_cost = std::numeric_limits<double>::max();
@@ -20,6 +20,8 @@
 namespace sampler_common::constraints
 {
 /// @brief Check if the path satisfies the hard constraints
+/// @details the checks stop at the first unsatisfied constraint, so only that constraint is marked
+/// as unsatisfied in the constraint results of the path
 MultiPoint2d checkHardConstraints(Path & path, const Constraints & constraints);
 }  // namespace sampler_common::constraints
 
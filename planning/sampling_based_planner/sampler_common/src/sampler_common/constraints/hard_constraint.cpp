@@ -40,17 +40,23 @@ bool has_collision(const MultiPoint2d & footprint, const MultiPolygon2d & obstac
 
 MultiPoint2d checkHardConstraints(Path & path, const Constraints & constraints)
 {
+  // the footprint is always built as it is used for debugging
   const auto footprint = buildFootprintPoints(path, constraints);
+  // checks from the cheapest to the most expensive, stopping at the first failure
+  if (!satisfyMinMax(
+        path.curvatures, constraints.hard.min_curvature, constraints.hard.max_curvature)) {
+    path.constraint_results.curvature = false;
+    return footprint;
+  }
+  if (has_collision(footprint, constraints.obstacle_polygons)) {
+    path.constraint_results.collision = false;
+    return footprint;
+  }
   if (!footprint.empty()) {
     if (!boost::geometry::within(footprint, constraints.drivable_polygons)) {
       path.constraint_results.drivable_area = false;
     }
   }
-  path.constraint_results.collision = !has_collision(footprint, constraints.obstacle_polygons);
-  if (!satisfyMinMax(
-        path.curvatures, constraints.hard.min_curvature, constraints.hard.max_curvature)) {
-    path.constraint_results.curvature = false;
-  }
   return footprint;
 }
 }  // namespace sampler_common::constraints
@@ -15,11 +15,13 @@
 #ifndef SCENARIO_SELECTOR__SCENARIO_SELECTOR_NODE_HPP_
 #define SCENARIO_SELECTOR__SCENARIO_SELECTOR_NODE_HPP_
 
+#include <latency_aggregator/latency_hop_publisher.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_auto_mapping_msgs/msg/had_map_bin.hpp>
 #include <autoware_auto_planning_msgs/msg/trajectory.hpp>
 #include <autoware_planning_msgs/msg/lanelet_route.hpp>
+#include <geometry_msgs/msg/point.hpp>
 #include <geometry_msgs/msg/twist_stamped.hpp>
 #include <nav_msgs/msg/odometry.hpp>
 #include <std_msgs/msg/bool.hpp>
@@ -40,6 +42,7 @@
 
 #include <deque>
 #include <memory>
+#include <optional>
 #include <string>
 
 class ScenarioSelectorNode : public rclcpp::Node
@@ -54,15 +57,14 @@ public:
 
   bool isDataReady();
   void onTimer();
-  void onLaneDrivingTrajectory(
-    const autoware_auto_planning_msgs::msg::Trajectory::ConstSharedPtr msg);
-  void onParkingTrajectory(const autoware_auto_planning_msgs::msg::Trajectory::ConstSharedPtr msg);
-  void publishTrajectory(const autoware_auto_planning_msgs::msg::Trajectory::ConstSharedPtr msg);
+  void onLaneDrivingTrajectory(autoware_auto_planning_msgs::msg::Trajectory::UniquePtr msg);
+  void onParkingTrajectory(autoware_auto_planning_msgs::msg::Trajectory::UniquePtr msg);
+  void publishTrajectory(
+    autoware_auto_planning_msgs::msg::Trajectory::UniquePtr msg, const std::string & input_topic);
 
   void updateCurrentScenario();
   std::string selectScenarioByPosition();
-  autoware_auto_planning_msgs::msg::Trajectory::ConstSharedPtr getScenarioTrajectory(
-    const std::string & scenario);
+  std::optional<geometry_msgs::msg::Point> getScenarioTrajectoryEnd(const std::string & scenario);
 
 private:
   rclcpp::TimerBase::SharedPtr timer_;
@@ -77,9 +79,11 @@ private:
   rclcpp::Subscription<std_msgs::msg::Bool>::SharedPtr sub_parking_state_;
   rclcpp::Publisher<autoware_auto_planning_msgs::msg::Trajectory>::SharedPtr pub_trajectory_;
   rclcpp::Publisher<tier4_planning_msgs::msg::Scenario>::SharedPtr pub_scenario_;
+  std::unique_ptr<latency_aggregator::LatencyHopPublisher> latency_hop_publisher_;
 
-  autoware_auto_planning_msgs::msg::Trajectory::ConstSharedPtr lane_driving_trajectory_;
-  autoware_auto_planning_msgs::msg::Trajectory::ConstSharedPtr parking_trajectory_;
+  // end point of the latest trajectory of each scenario, empty if the trajectory has no point
+  std::optional<geometry_msgs::msg::Point> lane_driving_trajectory_end_;
+  std::optional<geometry_msgs::msg::Point> parking_trajectory_end_;
   autoware_planning_msgs::msg::LaneletRoute::ConstSharedPtr route_;
   nav_msgs::msg::Odometry::ConstSharedPtr current_pose_;
   geometry_msgs::msg::TwistStamped::ConstSharedPtr twist_;
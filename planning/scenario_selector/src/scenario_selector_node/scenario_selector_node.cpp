@@ -25,6 +25,7 @@
 
 #include <deque>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -91,21 +92,30 @@ bool isInParkingLot(
 }
 
 bool isNearTrajectoryEnd(
-  const autoware_auto_planning_msgs::msg::Trajectory::ConstSharedPtr trajectory,
+  const std::optional<geometry_msgs::msg::Point> & trajectory_end,
   const geometry_msgs::msg::Pose & current_pose, const double th_dist)
 {
-  if (!trajectory || trajectory->points.empty()) {
+  if (!trajectory_end) {
     return false;
   }
 
   const auto & p1 = current_pose.position;
-  const auto & p2 = trajectory->points.back().pose.position;
+  const auto & p2 = *trajectory_end;
 
   const auto dist = std::hypot(p1.x - p2.x, p1.y - p2.y);
 
   return dist < th_dist;
 }
 
+std::optional<geometry_msgs::msg::Point> getTrajectoryEnd(
+  const autoware_auto_planning_msgs::msg::Trajectory & trajectory)
+{
+  if (trajectory.points.empty()) {
+    return {};
+  }
+  return trajectory.points.back().pose.position;
+}
+
 bool isStopped(
   const std::deque<geometry_msgs::msg::TwistStamped::ConstSharedPtr> & twist_buffer,
   const double th_stopped_velocity_mps)
@@ -120,17 +130,17 @@ bool isStopped(
 
 }  // namespace
 
-autoware_auto_planning_msgs::msg::Trajectory::ConstSharedPtr
-ScenarioSelectorNode::getScenarioTrajectory(const std::string & scenario)
+std::optional<geometry_msgs::msg::Point> ScenarioSelectorNode::getScenarioTrajectoryEnd(
+  const std::string & scenario)
 {
   if (scenario == tier4_planning_msgs::msg::Scenario::LANEDRIVING) {
-    return lane_driving_trajectory_;
+    return lane_driving_trajectory_end_;
   }
   if (scenario == tier4_planning_msgs::msg::Scenario::PARKING) {
-    return parking_trajectory_;
+    return parking_trajectory_end_;
   }
   RCLCPP_ERROR_STREAM(this->get_logger(), "invalid scenario argument: " << scenario);
-  return lane_driving_trajectory_;
+  return lane_driving_trajectory_end_;
 }
 
 std::string ScenarioSelectorNode::selectScenarioByPosition()
@@ -169,9 +179,9 @@ void ScenarioSelectorNode::updateCurrentScenario()
 {
   const auto prev_scenario = current_scenario_;
 
-  const auto scenario_trajectory = getScenarioTrajectory(current_scenario_);
+  const auto scenario_trajectory_end = getScenarioTrajectoryEnd(current_scenario_);
   const auto is_near_trajectory_end =
-    isNearTrajectoryEnd(scenario_trajectory, current_pose_->pose.pose, th_arrived_distance_m_);
+    isNearTrajectoryEnd(scenario_trajectory_end, current_pose_->pose.pose, th_arrived_distance_m_);
 
   const auto is_stopped = isStopped(twist_buffer_, th_stopped_velocity_mps_);
 
@@ -290,36 +300,41 @@ void ScenarioSelectorNode::onTimer()
 }
 
 void ScenarioSelectorNode::onLaneDrivingTrajectory(
-  const autoware_auto_planning_msgs::msg::Trajectory::ConstSharedPtr msg)
+  autoware_auto_planning_msgs::msg::Trajectory::UniquePtr msg)
 {
-  lane_driving_trajectory_ = msg;
+  // only the end of the trajectory is kept for the scenario transition, so that the trajectory
+  // itself can be handed over to the publisher without a copy
+  lane_driving_trajectory_end_ = getTrajectoryEnd(*msg);
 
   if (current_scenario_ != tier4_planning_msgs::msg::Scenario::LANEDRIVING) {
     return;
   }
 
-  publishTrajectory(msg);
+  publishTrajectory(std::move(msg), sub_lane_driving_trajectory_->get_topic_name());
 }
 
 void ScenarioSelectorNode::onParkingTrajectory(
-  const autoware_auto_planning_msgs::msg::Trajectory::ConstSharedPtr msg)
+  autoware_auto_planning_msgs::msg::Trajectory::UniquePtr msg)
 {
-  parking_trajectory_ = msg;
+  parking_trajectory_end_ = getTrajectoryEnd(*msg);
 
   if (current_scenario_ != tier4_planning_msgs::msg::Scenario::PARKING) {
     return;
   }
 
-  publishTrajectory(msg);
+  publishTrajectory(std::move(msg), sub_parking_trajectory_->get_topic_name());
 }
 
 void ScenarioSelectorNode::publishTrajectory(
-  const autoware_auto_planning_msgs::msg::Trajectory::ConstSharedPtr msg)
+  autoware_auto_planning_msgs::msg::Trajectory::UniquePtr msg, const std::string & input_topic)
 {
   const auto now = this->now();
-  const auto delay_sec = (now - msg->header.stamp).seconds();
+  const auto stamp = msg->header.stamp;
+  const auto delay_sec = (now - stamp).seconds();
   if (delay_sec <= th_max_message_delay_sec_) {
-    pub_trajectory_->publish(*msg);
+    const auto hop_input = latency_hop_publisher_->createInput(input_topic, stamp);
+    pub_trajectory_->publish(std::move(msg));
+    latency_hop_publisher_->publish(hop_input, stamp);
   } else {
     RCLCPP_WARN_THROTTLE(
       this->get_logger(), *this->get_clock(), std::chrono::milliseconds(1000).count(),
@@ -348,12 +363,15 @@ ScenarioSelectorNode::ScenarioSelectorNode(const rclcpp::NodeOptions & node_opti
     "input/parking/trajectory", rclcpp::QoS{1},
     std::bind(&ScenarioSelectorNode::onParkingTrajectory, this, std::placeholders::_1));
 
+  // NOTE: The intra-process communication supports only volatile topics.
+  rclcpp::SubscriptionOptions durable_sub_options;
+  durable_sub_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
   sub_lanelet_map_ = this->create_subscription<autoware_auto_mapping_msgs::msg::HADMapBin>(
     "input/lanelet_map", rclcpp::QoS{1}.transient_local(),
-    std::bind(&ScenarioSelectorNode::onMap, this, std::placeholders::_1));
+    std::bind(&ScenarioSelectorNode::onMap, this, std::placeholders::_1), durable_sub_options);
   sub_route_ = this->create_subscription<autoware_planning_msgs::msg::LaneletRoute>(
     "input/route", rclcpp::QoS{1}.transient_local(),
-    std::bind(&ScenarioSelectorNode::onRoute, this, std::placeholders::_1));
+    std::bind(&ScenarioSelectorNode::onRoute, this, std::placeholders::_1), durable_sub_options);
   sub_odom_ = this->create_subscription<nav_msgs::msg::Odometry>(
     "input/odometry", rclcpp::QoS{100},
     std::bind(&ScenarioSelectorNode::onOdom, this, std::placeholders::_1));
@@ -366,6 +384,8 @@ ScenarioSelectorNode::ScenarioSelectorNode(const rclcpp::NodeOptions & node_opti
     this->create_publisher<tier4_planning_msgs::msg::Scenario>("output/scenario", rclcpp::QoS{1});
   pub_trajectory_ = this->create_publisher<autoware_auto_planning_msgs::msg::Trajectory>(
     "output/trajectory", rclcpp::QoS{1});
+  latency_hop_publisher_ = std::make_unique<latency_aggregator::LatencyHopPublisher>(
+    this, pub_trajectory_->get_topic_name());
 
   // Timer Callback
   const auto period_ns = rclcpp::Rate(static_cast<double>(update_rate_)).period();
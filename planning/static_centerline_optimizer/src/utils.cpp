@@ -16,6 +16,7 @@
 
 #include "behavior_path_planner/data_manager.hpp"
 #include "behavior_path_planner/utils/utils.hpp"
+#include "obstacle_avoidance_planner/optimized_centerline_checker.hpp"
 #include "tier4_autoware_utils/geometry/geometry.hpp"
 #include "tier4_autoware_utils/ros/marker_helper.hpp"
 
@@ -137,6 +138,8 @@ void update_centerline(
         // set centerline
         route_handler.getLaneletMapPtr()->add(centerline);
         lanelet_ref.setCenterline(centerline);
+        lanelet_ref.setAttribute(
+          obstacle_avoidance_planner::OPTIMIZED_CENTERLINE_ATTRIBUTE, lanelet::Attribute(true));
 
         // prepare new centerline
         centerline = lanelet::LineString3d(lanelet::utils::getId());
@@ -149,6 +152,8 @@ void update_centerline(
       // set centerline
       route_handler.getLaneletMapPtr()->add(centerline);
       lanelet_ref.setCenterline(centerline);
+      lanelet_ref.setAttribute(
+        obstacle_avoidance_planner::OPTIMIZED_CENTERLINE_ATTRIBUTE, lanelet::Attribute(true));
     }
   }
 }
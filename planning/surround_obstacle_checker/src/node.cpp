@@ -17,7 +17,6 @@
 #include <autoware_auto_tf2/tf2_autoware_auto_msgs.hpp>
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 #include <tier4_autoware_utils/ros/update_param.hpp>
-#include <tier4_autoware_utils/transform/transforms.hpp>
 
 #include <boost/assert.hpp>
 #include <boost/assign/list_of.hpp>
@@ -26,9 +25,8 @@
 #include <boost/geometry/geometries/linestring.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 
-#include <pcl/common/transforms.h>
-#include <pcl/point_cloud.h>
-#include <pcl_conversions/pcl_conversions.h>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
 #ifdef ROS_DISTRO_GALACTIC
 #include <tf2_eigen/tf2_eigen.h>
 #else
@@ -36,10 +34,12 @@
 #endif
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 #define EIGEN_MPL2_ONLY
 #include <Eigen/Core>
@@ -124,21 +124,62 @@ Polygon2d createObjPolygon(
   return createObjPolygon(pose, polygon);
 }
 
+// radius of the circle around the pose which contains the object polygon
+double calcObjRadius(const Shape & shape)
+{
+  if (shape.type != Shape::POLYGON) {
+    return std::hypot(shape.dimensions.x / 2.0, shape.dimensions.y / 2.0);
+  }
+  double radius = 0.0;
+  for (const auto & p : shape.footprint.points) {
+    radius = std::max(radius, std::hypot(p.x, p.y));
+  }
+  return radius;
+}
+
+/**
+ * @brief axis aligned rectangle of the ego vehicle with the margins in base_link
+ */
+struct SelfRectangle
+{
+  double front_m;
+  double rear_m;
+  double width_left_m;
+  double width_right_m;
+};
+
+SelfRectangle createSelfRectangle(
+  const VehicleInfo & vehicle_info, const double front_margin, const double side_margin,
+  const double rear_margin)
+{
+  SelfRectangle rectangle;
+  rectangle.front_m = vehicle_info.max_longitudinal_offset_m + front_margin;
+  rectangle.width_left_m = vehicle_info.max_lateral_offset_m + side_margin;
+  rectangle.width_right_m = vehicle_info.min_lateral_offset_m - side_margin;
+  rectangle.rear_m = vehicle_info.min_longitudinal_offset_m - rear_margin;
+  return rectangle;
+}
+
+// closed form of bg::distance between the rectangle and the point, which is zero inside
+double calcDistanceToSelfRectangle(const SelfRectangle & rectangle, const double x, const double y)
+{
+  const double dist_x = std::max({rectangle.rear_m - x, 0.0, x - rectangle.front_m});
+  const double dist_y = std::max({rectangle.width_right_m - y, 0.0, y - rectangle.width_left_m});
+  return std::hypot(dist_x, dist_y);
+}
+
 Polygon2d createSelfPolygon(
   const VehicleInfo & vehicle_info, const double front_margin, const double side_margin,
   const double rear_margin)
 {
-  const double & front_m = vehicle_info.max_longitudinal_offset_m + front_margin;
-  const double & width_left_m = vehicle_info.max_lateral_offset_m + side_margin;
-  const double & width_right_m = vehicle_info.min_lateral_offset_m - side_margin;
-  const double & rear_m = vehicle_info.min_longitudinal_offset_m - rear_margin;
+  const auto rectangle = createSelfRectangle(vehicle_info, front_margin, side_margin, rear_margin);
 
   Polygon2d ego_polygon;
 
-  ego_polygon.outer().push_back(Point2d(front_m, width_left_m));
-  ego_polygon.outer().push_back(Point2d(front_m, width_right_m));
-  ego_polygon.outer().push_back(Point2d(rear_m, width_right_m));
-  ego_polygon.outer().push_back(Point2d(rear_m, width_left_m));
+  ego_polygon.outer().push_back(Point2d(rectangle.front_m, rectangle.width_left_m));
+  ego_polygon.outer().push_back(Point2d(rectangle.front_m, rectangle.width_right_m));
+  ego_polygon.outer().push_back(Point2d(rectangle.rear_m, rectangle.width_right_m));
+  ego_polygon.outer().push_back(Point2d(rectangle.rear_m, rectangle.width_left_m));
 
   bg::correct(ego_polygon);
 
@@ -425,29 +466,33 @@ boost::optional<Obstacle> SurroundObstacleCheckerNode::getNearestObstacleByPoint
     return {};
   }
 
-  Eigen::Affine3f isometry = tf2::transformToEigen(transform_stamped.get().transform).cast<float>();
-  pcl::PointCloud<pcl::PointXYZ> transformed_pointcloud;
-  pcl::fromROSMsg(*pointcloud_ptr_, transformed_pointcloud);
-  tier4_autoware_utils::transformPointCloud(
-    transformed_pointcloud, transformed_pointcloud, isometry);
+  const Eigen::Affine3f isometry =
+    tf2::transformToEigen(transform_stamped.get().transform).cast<float>();
 
   const double front_margin = node_param_.pointcloud_surround_check_front_distance;
   const double side_margin = node_param_.pointcloud_surround_check_side_distance;
   const double back_margin = node_param_.pointcloud_surround_check_back_distance;
-  const auto ego_polygon = createSelfPolygon(vehicle_info_, front_margin, side_margin, back_margin);
+  const auto ego_rectangle =
+    createSelfRectangle(vehicle_info_, front_margin, side_margin, back_margin);
 
+  // transform the points one by one without copying the cloud, and stop at a point on the ego
   geometry_msgs::msg::Point nearest_point;
   double minimum_distance = std::numeric_limits<double>::max();
   bool was_minimum_distance_updated = false;
-  for (const auto & p : transformed_pointcloud) {
-    Point2d boost_point(p.x, p.y);
+  for (sensor_msgs::PointCloud2ConstIterator<float> x(*pointcloud_ptr_, "x"),
+       y(*pointcloud_ptr_, "y"), z(*pointcloud_ptr_, "z");
+       x != x.end(); ++x, ++y, ++z) {
+    const Eigen::Vector3f p = isometry * Eigen::Vector3f(*x, *y, *z);
 
-    const auto distance_to_object = bg::distance(ego_polygon, boost_point);
+    const auto distance_to_object = calcDistanceToSelfRectangle(ego_rectangle, p.x(), p.y());
 
     if (distance_to_object < minimum_distance) {
-      nearest_point = createPoint(p.x, p.y, p.z);
+      nearest_point = createPoint(p.x(), p.y(), p.z());
       minimum_distance = distance_to_object;
       was_minimum_distance_updated = true;
+      if (minimum_distance <= 0.0) {
+        break;
+      }
     }
   }
 
@@ -469,30 +514,65 @@ boost::optional<Obstacle> SurroundObstacleCheckerNode::getNearestObstacleByDynam
   tf2::Transform tf_src2target;
   tf2::fromMsg(transform_stamped.get().transform, tf_src2target);
 
-  // TODO(murooka) check computation cost
-  geometry_msgs::msg::Point nearest_point;
-  double minimum_distance = std::numeric_limits<double>::max();
-  bool was_minimum_distance_updated = false;
-  for (const auto & object : object_ptr_->objects) {
-    const auto & object_pose = object.kinematics.initial_pose_with_covariance.pose;
+  // lower bound of the distance from the bounding circle, to run bg::distance from the nearest
+  struct Candidate
+  {
+    double min_distance;
+    size_t object_idx;
+    geometry_msgs::msg::Pose transformed_object_pose;
+  };
+  std::vector<Candidate> candidates;
+  candidates.reserve(object_ptr_->objects.size());
+  const tf2::Transform tf_target2src = tf_src2target.inverse();
+  for (size_t object_idx = 0; object_idx < object_ptr_->objects.size(); ++object_idx) {
+    const auto & object = object_ptr_->objects.at(object_idx);
     const int label = object.classification.front().label;
 
     if (!node_param_.enable_check_map.at(label)) {
       continue;
     }
 
+    tf2::Transform tf_src2object;
+    tf2::fromMsg(object.kinematics.initial_pose_with_covariance.pose, tf_src2object);
+
+    Candidate candidate;
+    candidate.object_idx = object_idx;
+    tf2::toMsg(tf_target2src * tf_src2object, candidate.transformed_object_pose);
+
+    const auto ego_rectangle = createSelfRectangle(
+      vehicle_info_, node_param_.surround_check_front_distance_map.at(label),
+      node_param_.surround_check_side_distance_map.at(label),
+      node_param_.surround_check_back_distance_map.at(label));
+    const auto & position = candidate.transformed_object_pose.position;
+    candidate.min_distance =
+      calcDistanceToSelfRectangle(ego_rectangle, position.x, position.y) -
+      calcObjRadius(object.shape);
+    candidates.push_back(candidate);
+  }
+  std::sort(candidates.begin(), candidates.end(), [](const auto & a, const auto & b) {
+    return a.min_distance < b.min_distance;
+  });
+
+  geometry_msgs::msg::Point nearest_point;
+  double minimum_distance = std::numeric_limits<double>::max();
+  bool was_minimum_distance_updated = false;
+  for (const auto & candidate : candidates) {
+    // the remaining objects can not be nearer than the nearest one
+    if (minimum_distance <= candidate.min_distance) {
+      break;
+    }
+
+    const auto & object = object_ptr_->objects.at(candidate.object_idx);
+    const auto & object_pose = object.kinematics.initial_pose_with_covariance.pose;
+    const int label = object.classification.front().label;
+
     const double front_margin = node_param_.surround_check_front_distance_map.at(label);
     const double side_margin = node_param_.surround_check_side_distance_map.at(label);
     const double back_margin = node_param_.surround_check_back_distance_map.at(label);
     const auto ego_polygon =
       createSelfPolygon(vehicle_info_, front_margin, side_margin, back_margin);
 
-    tf2::Transform tf_src2object;
-    tf2::fromMsg(object_pose, tf_src2object);
-
-    geometry_msgs::msg::Pose transformed_object_pose;
-    tf2::toMsg(tf_src2target.inverse() * tf_src2object, transformed_object_pose);
-
+    const auto & transformed_object_pose = candidate.transformed_object_pose;
     const auto object_polygon =
       object.shape.type == Shape::POLYGON
         ? createObjPolygon(transformed_object_pose, object.shape.footprint)
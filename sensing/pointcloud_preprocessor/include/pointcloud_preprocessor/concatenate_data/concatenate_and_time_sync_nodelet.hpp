@@ -52,12 +52,13 @@
 #ifndef POINTCLOUD_PREPROCESSOR__CONCATENATE_DATA__CONCATENATE_AND_TIME_SYNC_NODELET_HPP_
 #define POINTCLOUD_PREPROCESSOR__CONCATENATE_DATA__CONCATENATE_AND_TIME_SYNC_NODELET_HPP_
 
-#include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 // ROS includes
@@ -85,6 +86,8 @@
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <boost/circular_buffer.hpp>
+
 namespace pointcloud_preprocessor
 {
 using autoware_point_types::PointXYZI;
@@ -127,6 +130,15 @@ private:
 
   bool publish_synchronized_pointcloud_;
 
+  /** \brief Whether the clouds are transformed and concatenated as soon as they arrive. */
+  bool streaming_concatenation_;
+  /** \brief Clouds of the current cycle concatenated so far in streaming mode. */
+  sensor_msgs::msg::PointCloud2::SharedPtr streaming_concat_cloud_ptr_;
+  /** \brief Stamp the clouds are compensated to in streaming mode, set by the first cloud. */
+  std::optional<rclcpp::Time> streaming_reference_stamp_;
+  /** \brief Offset and number of points of each cloud in the streaming concatenated cloud. */
+  std::map<std::string, std::pair<size_t, size_t>> streaming_point_ranges_;
+
   std::set<std::string> not_subscribed_topic_names_;
 
   /** \brief A vector of subscriber. */
@@ -151,20 +163,32 @@ private:
   std::shared_ptr<tf2_ros::Buffer> tf2_buffer_;
   std::shared_ptr<tf2_ros::TransformListener> tf2_listener_;
 
-  std::deque<geometry_msgs::msg::TwistStamped::ConstSharedPtr> twist_ptr_queue_;
+  // sorted by stamp and holds the last second of twist, allocated once for up to 1 kHz twist
+  static constexpr size_t twist_queue_capacity_ = 1000;
+  boost::circular_buffer<geometry_msgs::msg::TwistStamped> twist_queue_;
 
   std::map<std::string, sensor_msgs::msg::PointCloud2::ConstSharedPtr> cloud_stdmap_;
   std::map<std::string, sensor_msgs::msg::PointCloud2::ConstSharedPtr> cloud_stdmap_tmp_;
+  std::map<std::string, std::optional<rclcpp::Time>> arrival_time_stdmap_;
+  std::map<std::string, std::optional<rclcpp::Time>> arrival_time_stdmap_tmp_;
   std::mutex mutex_;
 
   std::vector<double> input_offset_;
   std::map<std::string, double> offset_map_;
 
-  void transformPointCloud(const PointCloud2::ConstSharedPtr & in, PointCloud2::SharedPtr & out);
+  bool computeTransformToOutputFrame(const PointCloud2 & in, Eigen::Matrix4f & transform);
   Eigen::Matrix4f computeTransformToAdjustForOldTimestamp(
     const rclcpp::Time & old_stamp, const rclcpp::Time & new_stamp);
+  Eigen::Matrix4f computeTransformBetweenStamps(
+    const rclcpp::Time & stamp, const rclcpp::Time & target_stamp);
   std::map<std::string, sensor_msgs::msg::PointCloud2::SharedPtr> combineClouds(
     sensor_msgs::msg::PointCloud2::SharedPtr & concat_cloud_ptr);
+  void addToStreamingConcat(
+    const std::string & topic_name, const PointCloud2::ConstSharedPtr & cloud);
+  void resetStreamingConcat();
+  std::map<std::string, sensor_msgs::msg::PointCloud2::SharedPtr> takeStreamingConcat(
+    sensor_msgs::msg::PointCloud2::SharedPtr & concat_cloud_ptr);
+  void publishArrivalLatencies();
   void publish();
 
   void convertToXYZICloud(
@@ -0,0 +1,42 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_PREPROCESSOR__CROP_BOX_FILTER__CROP_BOX_FILTER_HPP_
+#define POINTCLOUD_PREPROCESSOR__CROP_BOX_FILTER__CROP_BOX_FILTER_HPP_
+
+#include <Eigen/Core>
+
+namespace pointcloud_preprocessor
+{
+struct CropBoxParam
+{
+  float min_x;
+  float max_x;
+  float min_y;
+  float max_y;
+  float min_z;
+  float max_z;
+  bool negative{false};
+
+  /// @brief true if the point passes the filter (inside the box, or outside if negative)
+  bool isKept(const Eigen::Vector4f & point) const
+  {
+    const bool point_is_inside = point[2] > min_z && point[2] < max_z && point[1] > min_y &&
+                                 point[1] < max_y && point[0] > min_x && point[0] < max_x;
+    return (!negative && point_is_inside) || (negative && !point_is_inside);
+  }
+};
+}  // namespace pointcloud_preprocessor
+
+#endif  // POINTCLOUD_PREPROCESSOR__CROP_BOX_FILTER__CROP_BOX_FILTER_HPP_
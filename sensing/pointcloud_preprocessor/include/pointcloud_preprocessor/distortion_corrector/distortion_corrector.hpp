@@ -37,6 +37,7 @@
 
 // Include tier4 autoware utils
 #include <tier4_autoware_utils/ros/debug_publisher.hpp>
+#include <tier4_autoware_utils/ros/static_transform_cache.hpp>
 #include <tier4_autoware_utils/system/stop_watch.hpp>
 
 #include <deque>
@@ -63,6 +64,8 @@ private:
     tf2::Transform * tf2_transform_ptr);
 
   bool undistortPointCloud(const tf2::Transform & tf2_base_link_to_sensor, PointCloud2 & points);
+  void undistortPointCloudByTimeBucket(
+    const tf2::Transform & tf2_base_link_to_sensor, PointCloud2 & points);
 
   rclcpp::Subscription<PointCloud2>::SharedPtr input_points_sub_;
   rclcpp::Subscription<sensor_msgs::msg::Imu>::SharedPtr imu_sub_;
@@ -74,6 +77,8 @@ private:
 
   tf2_ros::Buffer tf2_buffer_{get_clock()};
   tf2_ros::TransformListener tf2_listener_{tf2_buffer_};
+  // the sensor extrinsics are looked up for every message
+  tier4_autoware_utils::StaticTransformCache transform_cache_{this, tf2_buffer_};
 
   std::deque<geometry_msgs::msg::TwistStamped> twist_queue_;
   std::deque<geometry_msgs::msg::Vector3Stamped> angular_velocity_queue_;
@@ -81,6 +86,7 @@ private:
   std::string base_link_frame_ = "base_link";
   std::string time_stamp_field_name_;
   bool use_imu_;
+  double time_bucket_sec_;
 };
 
 }  // namespace pointcloud_preprocessor
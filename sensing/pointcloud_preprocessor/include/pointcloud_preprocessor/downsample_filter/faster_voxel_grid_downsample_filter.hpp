@@ -20,7 +20,9 @@
 #include <pcl_conversions/pcl_conversions.h>
 #include <sensor_msgs/msg/point_cloud2.h>
 
-#include <unordered_map>
+#include <cstdint>
+#include <limits>
+#include <utility>
 #include <vector>
 
 namespace pointcloud_preprocessor
@@ -35,9 +37,18 @@ public:
   FasterVoxelGridDownsampleFilter();
   void set_voxel_size(float voxel_size_x, float voxel_size_y, float voxel_size_z);
   void set_field_offsets(const PointCloud2ConstPtr & input);
+  void set_field_offsets(int x_offset, int y_offset, int z_offset, int intensity_offset);
+  void set_num_threads(size_t num_threads);
   void filter(
     const PointCloud2ConstPtr & input, PointCloud2 & output, const TransformInfo & transform_info,
     const rclcpp::Logger & logger);
+  /// @brief downsample points given by their coordinates, e.g., the result of previous filters
+  /// @details the centroids are written with the field offsets given to set_field_offsets(), the
+  /// point_step, header and is_bigendian of the output must be set by the caller
+  /// @return false if the voxel size is too small for the points, the output is then unchanged
+  bool filter_points(
+    const std::vector<Eigen::Vector3f> & points, PointCloud2 & output,
+    const TransformInfo & transform_info, const rclcpp::Logger & logger);
 
 private:
   struct Centroid
@@ -47,7 +58,7 @@ private:
     float z;
     uint32_t point_count_;
 
-    Centroid() : x(0), y(0), z(0) {}
+    Centroid() : x(0), y(0), z(0), point_count_(0) {}
     Centroid(float _x, float _y, float _z) : x(_x), y(_y), z(_z) { this->point_count_ = 1; }
 
     void add_point(float _x, float _y, float _z)
@@ -58,6 +69,14 @@ private:
       this->point_count_++;
     }
 
+    void add_centroid(const Centroid & other)
+    {
+      this->x += other.x;
+      this->y += other.y;
+      this->z += other.z;
+      this->point_count_ += other.point_count_;
+    }
+
     Eigen::Vector4f calc_centroid() const
     {
       Eigen::Vector4f centroid(
@@ -67,6 +86,33 @@ private:
     }
   };
 
+  /// @brief flat open-addressing hash table from voxel index to centroid
+  /// @details the storage is kept when cleared so that it is not reallocated at every filter() call
+  class VoxelCentroidTable
+  {
+  public:
+    void clear();
+    Centroid & find_or_insert(uint32_t voxel_id);
+    void merge(const VoxelCentroidTable & other);
+    size_t size() const { return entries_.size(); }
+    const std::vector<std::pair<uint32_t, Centroid>> & entries() const { return entries_; }
+
+  private:
+    static constexpr uint32_t empty_slot = std::numeric_limits<uint32_t>::max();
+    struct Slot
+    {
+      uint32_t voxel_id = empty_slot;
+      uint32_t entry_index = 0;
+    };
+
+    void rehash(size_t nb_slots);
+    size_t slot_index(uint32_t voxel_id) const;
+
+    std::vector<Slot> slots_;
+    std::vector<std::pair<uint32_t, Centroid>> entries_;
+    int slot_index_shift_ = 32;
+  };
+
   Eigen::Vector3f inverse_voxel_size_;
   std::vector<pcl::PCLPointField> xyz_fields_;
   int x_offset_;
@@ -74,19 +120,30 @@ private:
   int z_offset_;
   int intensity_offset_;
   bool offset_initialized_;
+  size_t num_threads_;
+  std::vector<VoxelCentroidTable> voxel_centroid_tables_;
 
   Eigen::Vector3f get_point_from_global_offset(
     const PointCloud2ConstPtr & input, size_t global_offset);
 
+  template <class GetPoint>
   bool get_min_max_voxel(
-    const PointCloud2ConstPtr & input, Eigen::Vector3i & min_voxel, Eigen::Vector3i & max_voxel);
+    size_t nb_points, const GetPoint & get_point, Eigen::Vector3i & min_voxel,
+    Eigen::Vector3i & max_voxel);
 
-  std::unordered_map<uint32_t, Centroid> calc_centroids_each_voxel(
-    const PointCloud2ConstPtr & input, const Eigen::Vector3i & max_voxel,
+  template <class GetPoint>
+  const VoxelCentroidTable & calc_centroids_each_voxel(
+    size_t nb_points, const GetPoint & get_point, const Eigen::Vector3i & max_voxel,
     const Eigen::Vector3i & min_voxel);
 
+  template <class GetPoint>
+  void calc_centroids_in_range(
+    const GetPoint & get_point, const Eigen::Vector3i & max_voxel,
+    const Eigen::Vector3i & min_voxel, size_t begin, size_t end,
+    VoxelCentroidTable & voxel_centroid_table);
+
   void copy_centroids_to_output(
-    std::unordered_map<uint32_t, Centroid> & voxel_centroid_map, PointCloud2 & output,
+    const VoxelCentroidTable & voxel_centroid_table, PointCloud2 & output,
     const TransformInfo & transform_info);
 };
 
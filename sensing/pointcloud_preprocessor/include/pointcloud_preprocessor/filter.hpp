@@ -80,6 +80,7 @@
 #include <tf2_ros/transform_listener.h>
 
 // Include tier4 autoware utils
+#include <latency_aggregator/latency_hop_publisher.hpp>
 #include <tier4_autoware_utils/ros/debug_publisher.hpp>
 #include <tier4_autoware_utils/system/stop_watch.hpp>
 
@@ -179,6 +180,10 @@ protected:
   std::unique_ptr<tier4_autoware_utils::StopWatch<std::chrono::milliseconds>> stop_watch_ptr_;
   std::unique_ptr<tier4_autoware_utils::DebugPublisher> debug_publisher_;
 
+  /** \brief end-to-end latency publisher. **/
+  std::string input_topic_name_;
+  std::unique_ptr<latency_aggregator::LatencyHopPublisher> latency_hop_publisher_;
+
   /** \brief Virtual abstract filter method. To be implemented by every child.
    * \param input the input point cloud dataset.
    * \param indices a pointer to the vector of point indices to use.
@@ -204,8 +209,11 @@ protected:
   /** \brief Call the child filter () method, optionally transform the result, and publish it.
    * \param input the input point cloud dataset.
    * \param indices a pointer to the vector of point indices to use.
+   * \param hop_input the input of the end-to-end latency.
    */
-  void computePublish(const PointCloud2ConstPtr & input, const IndicesPtr & indices);
+  void computePublish(
+    const PointCloud2ConstPtr & input, const IndicesPtr & indices,
+    const latency_aggregator::LatencyHopInput & hop_input);
 
   //////////////////////
   // from PCLNodelet //
@@ -293,6 +301,13 @@ private:
 
   bool convert_output_costly(std::unique_ptr<PointCloud2> & output);
 
+  /** \brief Returns true if convert_output_costly() has to transform the output. */
+  bool is_output_conversion_required(const PointCloud2 & output) const;
+
+  /** \brief Output message reused at each callback when the output is published by reference,
+   * so that its data is not reallocated. */
+  PointCloud2 output_buffer_;
+
   // TODO(sykwer): Temporary Implementation: Remove this interface when all the filter nodes conform
   // to new API.
   void faster_input_indices_callback(
@@ -0,0 +1,76 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_PREPROCESSOR__FUSED_FILTER__FUSED_FILTER_NODELET_HPP_
+#define POINTCLOUD_PREPROCESSOR__FUSED_FILTER__FUSED_FILTER_NODELET_HPP_
+
+#include "pointcloud_preprocessor/crop_box_filter/crop_box_filter.hpp"
+#include "pointcloud_preprocessor/downsample_filter/faster_voxel_grid_downsample_filter.hpp"
+#include "pointcloud_preprocessor/filter.hpp"
+#include "pointcloud_preprocessor/outlier_filter/ring_outlier_filter.hpp"
+#include "pointcloud_preprocessor/transform_info.hpp"
+
+#include <Eigen/Core>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace pointcloud_preprocessor
+{
+/// @brief runs a chain of crop box, ring outlier and voxel grid filters on a single input buffer
+/// @details each stage only keeps the indices and coordinates of the remaining points, so no
+/// intermediate PointCloud2 is created and the output is allocated once. The results are the same
+/// as the corresponding chain of filter nodes.
+class FusedFilterComponent : public pointcloud_preprocessor::Filter
+{
+protected:
+  void filter(
+    const PointCloud2ConstPtr & input, const IndicesPtr & indices, PointCloud2 & output) override;
+
+  void faster_filter(
+    const PointCloud2ConstPtr & input, const IndicesPtr & indices, PointCloud2 & output,
+    const TransformInfo & transform_info) override;
+
+private:
+  enum class StageType { CropBox, RingOutlier, VoxelGrid };
+
+  struct Stage
+  {
+    std::string name;
+    StageType type;
+    CropBoxParam crop_box_param;
+    RingOutlierFilterParam ring_outlier_param;
+  };
+
+  std::vector<Stage> stages_;
+  // the voxel grid stage, if any, is the last one
+  std::unique_ptr<FasterVoxelGridDownsampleFilter> voxel_filter_;
+
+  // state of the remaining points, kept across calls to reuse the storage
+  std::vector<uint32_t> point_indices_;      // index of each remaining point in the input
+  std::vector<Eigen::Vector3f> point_xyzs_;  // coordinates of each remaining point
+  std::vector<bool> is_kept_;
+
+  Stage declareStage(const std::string & name);
+  int cropBox(const CropBoxParam & param);
+  void keepClassifiedPoints();
+
+public:
+  PCL_MAKE_ALIGNED_OPERATOR_NEW
+  explicit FusedFilterComponent(const rclcpp::NodeOptions & options);
+};
+}  // namespace pointcloud_preprocessor
+
+#endif  // POINTCLOUD_PREPROCESSOR__FUSED_FILTER__FUSED_FILTER_NODELET_HPP_
@@ -0,0 +1,54 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_PREPROCESSOR__OUTLIER_FILTER__RING_OUTLIER_FILTER_HPP_
+#define POINTCLOUD_PREPROCESSOR__OUTLIER_FILTER__RING_OUTLIER_FILTER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace pointcloud_preprocessor
+{
+struct RingOutlierFilterParam
+{
+  double distance_ratio;
+  double object_length_threshold;
+  int num_points_threshold;
+  uint16_t max_rings_num;
+};
+
+/// @brief offsets of the attributes used by the ring outlier filter inside a point
+struct RingOutlierFieldOffsets
+{
+  size_t ring;      // UINT16
+  size_t azimuth;   // FLOAT32
+  size_t distance;  // FLOAT32
+};
+
+/// @brief classify the points of a scan, is_kept[i] is false for the outliers
+/// @param data raw point data of the scan, points are expected in chronological order
+/// @return number of points ignored because their ring index was over max_rings_num
+int classifyRingOutliers(
+  const RingOutlierFilterParam & param, const RingOutlierFieldOffsets & offsets,
+  const uint8_t * data, size_t point_step, size_t nb_points, std::vector<bool> & is_kept);
+
+/// @brief same as above but only the points at the given indices form the scan
+int classifyRingOutliers(
+  const RingOutlierFilterParam & param, const RingOutlierFieldOffsets & offsets,
+  const uint8_t * data, size_t point_step, const std::vector<uint32_t> & point_indices,
+  std::vector<bool> & is_kept);
+}  // namespace pointcloud_preprocessor
+
+#endif  // POINTCLOUD_PREPROCESSOR__OUTLIER_FILTER__RING_OUTLIER_FILTER_HPP_
@@ -19,6 +19,7 @@
 
 #include <boost/circular_buffer.hpp>
 
+#include <cstdint>
 #include <vector>
 
 namespace pointcloud_preprocessor
@@ -36,9 +37,24 @@ protected:
   rcl_interfaces::msg::SetParametersResult paramCallback(const std::vector<rclcpp::Parameter> & p);
 
 private:
+  /** \brief The points of an input cloud, converted once to the layout of the output */
+  struct PointSlab
+  {
+    rclcpp::Time stamp;
+    bool is_dense;
+    std::vector<uint8_t> data;
+  };
+
+  void filterIncrementally(const PointCloud2ConstPtr & input, PointCloud2 & output);
+
   double accumulation_time_sec_;
   boost::circular_buffer<PointCloud2ConstPtr> pointcloud_buffer_;
 
+  /** \brief If true, the output is copied from the slabs instead of converting all the clouds */
+  bool incremental_accumulation_;
+  /** \brief The slabs from the newest, the memory of the oldest one is reused when full */
+  boost::circular_buffer<PointSlab> point_slabs_;
+
 public:
   PCL_MAKE_ALIGNED_OPERATOR_NEW
   explicit PointcloudAccumulatorComponent(const rclcpp::NodeOptions & options);
@@ -16,6 +16,7 @@
 #define POINTCLOUD_PREPROCESSOR__POLYGON_REMOVER__POLYGON_REMOVER_HPP_
 
 #include "pointcloud_preprocessor/filter.hpp"
+#include "pointcloud_preprocessor/utility/polygon_mask.hpp"
 #include "pointcloud_preprocessor/utility/utilities.hpp"
 
 #include <geometry_msgs/msg/polygon_stamped.hpp>
@@ -51,7 +52,9 @@ private:
 
   bool polygon_is_initialized_;
   bool will_visualize_;
+  double mask_resolution_;
   PolygonCgal polygon_cgal_;
+  utils::PolygonMask polygon_mask_;
   visualization_msgs::msg::Marker marker_;
 
   rclcpp::Publisher<visualization_msgs::msg::Marker>::SharedPtr pub_marker_ptr_;
@@ -52,7 +52,6 @@
 #ifndef POINTCLOUD_PREPROCESSOR__TIME_SYNCHRONIZER__TIME_SYNCHRONIZER_NODELET_HPP_
 #define POINTCLOUD_PREPROCESSOR__TIME_SYNCHRONIZER__TIME_SYNCHRONIZER_NODELET_HPP_
 
-#include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -85,6 +84,8 @@
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <boost/circular_buffer.hpp>
+
 namespace pointcloud_preprocessor
 {
 using autoware_point_types::PointXYZI;
@@ -147,7 +148,9 @@ private:
   std::shared_ptr<tf2_ros::Buffer> tf2_buffer_;
   std::shared_ptr<tf2_ros::TransformListener> tf2_listener_;
 
-  std::deque<geometry_msgs::msg::TwistStamped::ConstSharedPtr> twist_ptr_queue_;
+  // sorted by stamp and holds the last second of twist, allocated once for up to 1 kHz twist
+  static constexpr size_t twist_queue_capacity_ = 1000;
+  boost::circular_buffer<geometry_msgs::msg::TwistStamped> twist_queue_;
 
   std::map<std::string, sensor_msgs::msg::PointCloud2::ConstSharedPtr> cloud_stdmap_;
   std::map<std::string, sensor_msgs::msg::PointCloud2::ConstSharedPtr> cloud_stdmap_tmp_;
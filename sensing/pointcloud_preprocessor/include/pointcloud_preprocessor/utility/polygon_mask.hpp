@@ -0,0 +1,88 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_PREPROCESSOR__UTILITY__POLYGON_MASK_HPP_
+#define POINTCLOUD_PREPROCESSOR__UTILITY__POLYGON_MASK_HPP_
+
+#include "pointcloud_preprocessor/utility/utilities.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace pointcloud_preprocessor::utils
+{
+/**
+ * @brief rasterized polygons for O(1) point-in-polygon lookups
+ * @details Each cell of a grid covering a rectangular window is classified as outside of all
+ * polygons, inside of at least one polygon, or crossed by polygon edges. Only points falling in
+ * crossed cells, or outside of the window when some polygon is not fully covered by it, need an
+ * exact test so the result is the same as point_within_cgal_polys().
+ */
+class PolygonMask
+{
+public:
+  /**
+   * @brief rasterize the polygons over the window [min_x, max_x) x [min_y, max_y)
+   */
+  void build(
+    const std::vector<PolygonCgal> & polygons, const double min_x, const double min_y,
+    const double max_x, const double max_y, const double resolution);
+
+  void clear();
+
+  bool is_built() const { return !cells_.empty(); }
+
+  /**
+   * @brief return true if the given point is inside the at least one of the polygons
+   */
+  bool is_within(const float x, const float y) const;
+
+private:
+  static constexpr uint32_t outside_cell = 0;
+  static constexpr uint32_t inside_cell = 1;
+  // values above inside_cell index boundary_polygon_indices_ with an offset of 2
+  static constexpr uint32_t first_boundary_cell = 2;
+
+  bool is_within_polygons(
+    const float x, const float y, const std::vector<uint32_t> & polygon_indices) const;
+  bool is_within_polygons(const float x, const float y) const;
+
+  std::vector<PolygonCgal> polygons_;
+  bool covers_all_polygons_{true};
+  double origin_x_{0.0};
+  double origin_y_{0.0};
+  double inverse_resolution_{1.0};
+  int64_t nb_cells_x_{0};
+  int64_t nb_cells_y_{0};
+  std::vector<uint32_t> cells_;
+  std::vector<std::vector<uint32_t>> boundary_polygon_indices_;
+};
+
+/**
+ * @brief remove points in the polygons of the given mask
+ */
+void remove_polygon_mask_from_cloud(
+  const sensor_msgs::msg::PointCloud2 & cloud_in, const PolygonMask & polygon_mask,
+  sensor_msgs::msg::PointCloud2 & cloud_out);
+
+/**
+ * @brief remove points in the polygons of the given mask
+ */
+void remove_polygon_mask_from_cloud(
+  const pcl::PointCloud<pcl::PointXYZ> & cloud_in, const PolygonMask & polygon_mask,
+  pcl::PointCloud<pcl::PointXYZ> & cloud_out);
+
+}  // namespace pointcloud_preprocessor::utils
+
+#endif  // POINTCLOUD_PREPROCESSOR__UTILITY__POLYGON_MASK_HPP_
@@ -16,6 +16,7 @@
 #define POINTCLOUD_PREPROCESSOR__VECTOR_MAP_FILTER__VECTOR_MAP_INSIDE_AREA_FILTER_HPP_
 
 #include "pointcloud_preprocessor/filter.hpp"
+#include "pointcloud_preprocessor/utility/polygon_mask.hpp"
 #include "pointcloud_preprocessor/utility/utilities.hpp"
 
 #include <lanelet2_extension/utility/message_conversion.hpp>
@@ -25,6 +26,7 @@
 #include <lanelet2_core/geometry/Polygon.h>
 
 #include <string>
+#include <vector>
 
 using tier4_autoware_utils::MultiPoint2d;
 
@@ -38,11 +40,18 @@ private:
 
   rclcpp::Subscription<autoware_auto_mapping_msgs::msg::HADMapBin>::SharedPtr map_sub_;
   lanelet::ConstPolygons3d polygon_lanelets_;
+  std::vector<PolygonCgal> polygons_cgal_;
+  utils::PolygonMask polygon_mask_;
+  int64_t mask_tile_x_{0};
+  int64_t mask_tile_y_{0};
 
   void mapCallback(const autoware_auto_mapping_msgs::msg::HADMapBin::ConstSharedPtr msg);
+  void updatePolygonMask(const tier4_autoware_utils::Box2d & bounding_box);
 
   // parameter
   std::string polygon_type_;
+  double mask_resolution_;
+  double mask_size_;
 
 public:
   PCL_MAKE_ALIGNED_OPERATOR_NEW
@@ -14,11 +14,13 @@
 
 #include "pointcloud_preprocessor/blockage_diag/blockage_diag_nodelet.hpp"
 
+#include "autoware_point_types/point_cloud2_view.hpp"
 #include "autoware_point_types/types.hpp"
 
 #include <boost/circular_buffer.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <numeric>
 
 namespace pointcloud_preprocessor
@@ -161,8 +163,15 @@ void BlockageDiagComponent::filter(
   }
   ideal_horizontal_bins =
     static_cast<uint>((angle_range_deg_[1] - angle_range_deg_[0]) / horizontal_resolution_);
+  // Read the points in place if the input has the PointXYZIRADRT layout, else convert it
   pcl::PointCloud<PointXYZIRADRT>::Ptr pcl_input(new pcl::PointCloud<PointXYZIRADRT>);
-  pcl::fromROSMsg(*input, *pcl_input);
+  const auto input_view = autoware_point_types::makePointCloud2View<PointXYZIRADRT>(*input);
+  if (!input_view) {
+    pcl::fromROSMsg(*input, *pcl_input);
+  }
+  using PointView = autoware_point_types::PointCloud2View<const PointXYZIRADRT>;
+  const PointView input_points =
+    input_view ? *input_view : PointView(pcl_input->points.data(), pcl_input->points.size());
   std::vector<float> horizontal_bin_reference(ideal_horizontal_bins);
   std::vector<pcl::PointCloud<PointXYZIRADRT>> each_ring_pointcloud(vertical_bins);
   cv::Mat full_size_depth_map(
@@ -170,7 +179,7 @@ void BlockageDiagComponent::filter(
   cv::Mat lidar_depth_map(cv::Size(ideal_horizontal_bins, vertical_bins), CV_16UC1, cv::Scalar(0));
   cv::Mat lidar_depth_map_8u(
     cv::Size(ideal_horizontal_bins, vertical_bins), CV_8UC1, cv::Scalar(0));
-  if (pcl_input->points.empty()) {
+  if (input_points.empty()) {
     ground_blockage_ratio_ = 1.0f;
     sky_blockage_ratio_ = 1.0f;
     if (ground_blockage_count_ <= 2 * blockage_count_threshold_) {
@@ -187,14 +196,23 @@ void BlockageDiagComponent::filter(
     for (int i = 0; i < ideal_horizontal_bins; ++i) {
       horizontal_bin_reference.at(i) = angle_range_deg_[0] + i * horizontal_resolution_;
     }
-    for (const auto p : pcl_input->points) {
-      for (int horizontal_bin = 0;
-           horizontal_bin < static_cast<int>(horizontal_bin_reference.size()); horizontal_bin++) {
+    const float half_resolution = horizontal_resolution_ / 2;
+    for (const auto & p : input_points) {
+      // the bins are evenly spaced, so only the nearest bin and its neighbors can contain the point
+      const float azimuth_deg = p.azimuth / 100;
+      const double nearest_bin =
+        std::round((azimuth_deg - angle_range_deg_[0]) / horizontal_resolution_);
+      if (!std::isfinite(nearest_bin) || ideal_horizontal_bins <= 0) {
+        continue;
+      }
+      const int first_bin =
+        static_cast<int>(std::clamp(nearest_bin - 1.0, 0.0, ideal_horizontal_bins - 1.0));
+      const int last_bin =
+        static_cast<int>(std::clamp(nearest_bin + 1.0, 0.0, ideal_horizontal_bins - 1.0));
+      for (int horizontal_bin = first_bin; horizontal_bin <= last_bin; horizontal_bin++) {
         if (
-          (p.azimuth / 100 >
-           (horizontal_bin_reference.at(horizontal_bin) - horizontal_resolution_ / 2)) &&
-          (p.azimuth / 100 <=
-           (horizontal_bin_reference.at(horizontal_bin) + horizontal_resolution_ / 2))) {
+          (azimuth_deg > (horizontal_bin_reference[horizontal_bin] - half_resolution)) &&
+          (azimuth_deg <= (horizontal_bin_reference[horizontal_bin] + half_resolution))) {
           if (lidar_model_ == "Pandar40P") {
             full_size_depth_map.at<uint16_t>(p.ring, horizontal_bin) =
               UINT16_MAX - distance_coefficient * p.distance;
@@ -382,7 +400,11 @@ void BlockageDiagComponent::filter(
   ground_dust_ratio_msg.data = ground_dust_ratio_;
   ground_dust_ratio_msg.stamp = now();
   ground_dust_ratio_pub_->publish(ground_dust_ratio_msg);
-  pcl::toROSMsg(*pcl_input, output);
+  if (input_view) {
+    output = *input;
+  } else {
+    pcl::toROSMsg(*pcl_input, output);
+  }
   output.header = input->header;
 }
 rcl_interfaces::msg::SetParametersResult BlockageDiagComponent::paramCallback(
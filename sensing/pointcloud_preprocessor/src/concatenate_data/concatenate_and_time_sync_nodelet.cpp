@@ -56,8 +56,12 @@
 #include <pcl_conversions/pcl_conversions.h>
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <memory>
+#include <optional>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -67,6 +71,85 @@
 
 namespace pointcloud_preprocessor
 {
+namespace
+{
+size_t numberOfPoints(const sensor_msgs::msg::PointCloud2 & cloud)
+{
+  return static_cast<size_t>(cloud.width) * cloud.height;
+}
+
+bool hasSameLayout(const sensor_msgs::msg::PointCloud2 & a, const sensor_msgs::msg::PointCloud2 & b)
+{
+  return a.fields == b.fields && a.point_step == b.point_step && a.is_bigendian == b.is_bigendian;
+}
+
+/// @brief initialize an empty cloud with the point layout of the given cloud
+void initializeConcatCloud(
+  const sensor_msgs::msg::PointCloud2 & layout_cloud, const std::string & frame_id,
+  sensor_msgs::msg::PointCloud2 & concat_cloud)
+{
+  concat_cloud.header.frame_id = frame_id;
+  concat_cloud.fields = layout_cloud.fields;
+  concat_cloud.is_bigendian = layout_cloud.is_bigendian;
+  concat_cloud.point_step = layout_cloud.point_step;
+  concat_cloud.height = 1;
+  concat_cloud.width = 0;
+  concat_cloud.row_step = 0;
+  concat_cloud.is_dense = true;
+  concat_cloud.data.clear();
+}
+
+/// @brief copy the points of the cloud to the output buffer and transform their coordinates
+/// @details the input clouds are all converted to PointXYZI on reception so there is no padding
+void copyTransformedPoints(
+  const sensor_msgs::msg::PointCloud2 & cloud, const Eigen::Matrix4f & transform, uint8_t * out)
+{
+  const auto field_offset = [&](const std::string & name) {
+    const auto it = std::find_if(
+      cloud.fields.begin(), cloud.fields.end(),
+      [&](const auto & field) { return field.name == name; });
+    return it->offset;
+  };
+  const auto x_offset = field_offset("x");
+  const auto y_offset = field_offset("y");
+  const auto z_offset = field_offset("z");
+  const auto point_step = cloud.point_step;
+  const auto nb_points = numberOfPoints(cloud);
+  std::memcpy(out, cloud.data.data(), nb_points * point_step);
+  const Eigen::Matrix3f rotation = transform.topLeftCorner<3, 3>();
+  const Eigen::Vector3f translation = transform.topRightCorner<3, 1>();
+  for (size_t i = 0; i < nb_points; ++i, out += point_step) {
+    Eigen::Vector3f p;
+    std::memcpy(&p.x(), out + x_offset, sizeof(float));
+    std::memcpy(&p.y(), out + y_offset, sizeof(float));
+    std::memcpy(&p.z(), out + z_offset, sizeof(float));
+    // keep invalid points as they are
+    if (!std::isfinite(p.x()) || !std::isfinite(p.y()) || !std::isfinite(p.z())) {
+      continue;
+    }
+    const Eigen::Vector3f q = rotation * p + translation;
+    std::memcpy(out + x_offset, &q.x(), sizeof(float));
+    std::memcpy(out + y_offset, &q.y(), sizeof(float));
+    std::memcpy(out + z_offset, &q.z(), sizeof(float));
+  }
+}
+
+/// @brief copy a range of points of a cloud into a new cloud
+sensor_msgs::msg::PointCloud2::SharedPtr extractPoints(
+  const sensor_msgs::msg::PointCloud2 & cloud, const size_t point_offset, const size_t nb_points)
+{
+  auto extracted_cloud_ptr = std::make_shared<sensor_msgs::msg::PointCloud2>();
+  initializeConcatCloud(cloud, cloud.header.frame_id, *extracted_cloud_ptr);
+  extracted_cloud_ptr->header.stamp = cloud.header.stamp;
+  extracted_cloud_ptr->width = static_cast<uint32_t>(nb_points);
+  extracted_cloud_ptr->row_step = extracted_cloud_ptr->width * cloud.point_step;
+  extracted_cloud_ptr->is_dense = cloud.is_dense;
+  const auto begin = cloud.data.begin() + point_offset * cloud.point_step;
+  extracted_cloud_ptr->data.assign(begin, begin + nb_points * cloud.point_step);
+  return extracted_cloud_ptr;
+}
+}  // namespace
+
 PointCloudConcatenateDataSynchronizerComponent::PointCloudConcatenateDataSynchronizerComponent(
   const rclcpp::NodeOptions & node_options)
 : Node("point_cloud_concatenator_component", node_options),
@@ -112,6 +195,10 @@ PointCloudConcatenateDataSynchronizerComponent::PointCloudConcatenateDataSynchro
 
     // Check if publish synchronized pointcloud
     publish_synchronized_pointcloud_ = declare_parameter("publish_synchronized_pointcloud", false);
+
+    // Check if the clouds are concatenated as they arrive
+    streaming_concatenation_ = declare_parameter("streaming_concatenation", false);
+    streaming_concat_cloud_ptr_ = std::make_shared<PointCloud2>();
   }
 
   // Initialize not_subscribed_topic_names_
@@ -155,6 +242,8 @@ PointCloudConcatenateDataSynchronizerComponent::PointCloudConcatenateDataSynchro
     for (size_t d = 0; d < input_topics_.size(); ++d) {
       cloud_stdmap_.insert(std::make_pair(input_topics_[d], nullptr));
       cloud_stdmap_tmp_ = cloud_stdmap_;
+      arrival_time_stdmap_.insert(std::make_pair(input_topics_[d], std::nullopt));
+      arrival_time_stdmap_tmp_ = arrival_time_stdmap_;
 
       // CAN'T use auto type here.
       std::function<void(const sensor_msgs::msg::PointCloud2::ConstSharedPtr msg)> cb = std::bind(
@@ -166,6 +255,7 @@ PointCloudConcatenateDataSynchronizerComponent::PointCloudConcatenateDataSynchro
         input_topics_[d], rclcpp::SensorDataQoS().keep_last(maximum_queue_size_), cb);
     }
 
+    twist_queue_.set_capacity(twist_queue_capacity_);
     if (input_twist_topic_type_ == "twist") {
       auto twist_cb = std::bind(
         &PointCloudConcatenateDataSynchronizerComponent::twist_callback, this,
@@ -213,22 +303,25 @@ PointCloudConcatenateDataSynchronizerComponent::PointCloudConcatenateDataSynchro
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////
-void PointCloudConcatenateDataSynchronizerComponent::transformPointCloud(
-  const PointCloud2::ConstSharedPtr & in, PointCloud2::SharedPtr & out)
+bool PointCloudConcatenateDataSynchronizerComponent::computeTransformToOutputFrame(
+  const PointCloud2 & in, Eigen::Matrix4f & transform)
 {
-  // Transform the point clouds into the specified output frame
-  if (output_frame_ != in->header.frame_id) {
-    // TODO(YamatoAndo): use TF2
-    if (!pcl_ros::transformPointCloud(output_frame_, *in, *out, *tf2_buffer_)) {
-      RCLCPP_ERROR(
-        this->get_logger(),
-        "[transformPointCloud] Error converting first input dataset from %s to %s.",
-        in->header.frame_id.c_str(), output_frame_.c_str());
-      return;
-    }
-  } else {
-    out = std::make_shared<PointCloud2>(*in);
-  }
+  transform = Eigen::Matrix4f::Identity();
+  if (output_frame_ == in.header.frame_id) {
+    return true;
+  }
+  try {
+    const auto transform_stamped = tf2_buffer_->lookupTransform(
+      output_frame_, in.header.frame_id, tf2_ros::fromMsg(in.header.stamp));
+    pcl_ros::transformAsMatrix(transform_stamped, transform);
+  } catch (tf2::TransformException & ex) {
+    RCLCPP_ERROR(
+      this->get_logger(),
+      "[computeTransformToOutputFrame] Error converting input dataset from %s to %s: %s",
+      in.header.frame_id.c_str(), output_frame_.c_str(), ex.what());
+    return false;
+  }
+  return true;
 }
 
 /**
@@ -243,7 +336,7 @@ PointCloudConcatenateDataSynchronizerComponent::computeTransformToAdjustForOldTi
   const rclcpp::Time & old_stamp, const rclcpp::Time & new_stamp)
 {
   // return identity if no twist is available
-  if (twist_ptr_queue_.empty()) {
+  if (twist_queue_.empty()) {
     RCLCPP_WARN_STREAM_THROTTLE(
       get_logger(), *get_clock(), std::chrono::milliseconds(10000).count(),
       "No twist is available. Please confirm twist topic and timestamp");
@@ -258,30 +351,28 @@ PointCloudConcatenateDataSynchronizerComponent::computeTransformToAdjustForOldTi
     return Eigen::Matrix4f::Identity();
   }
 
-  auto old_twist_ptr_it = std::lower_bound(
-    std::begin(twist_ptr_queue_), std::end(twist_ptr_queue_), old_stamp,
-    [](const geometry_msgs::msg::TwistStamped::ConstSharedPtr & x_ptr, const rclcpp::Time & t) {
-      return rclcpp::Time(x_ptr->header.stamp) < t;
+  auto old_twist_it = std::lower_bound(
+    std::begin(twist_queue_), std::end(twist_queue_), old_stamp,
+    [](const geometry_msgs::msg::TwistStamped & x, const rclcpp::Time & t) {
+      return rclcpp::Time(x.header.stamp) < t;
     });
-  old_twist_ptr_it =
-    old_twist_ptr_it == twist_ptr_queue_.end() ? (twist_ptr_queue_.end() - 1) : old_twist_ptr_it;
+  old_twist_it = old_twist_it == twist_queue_.end() ? (twist_queue_.end() - 1) : old_twist_it;
 
-  auto new_twist_ptr_it = std::lower_bound(
-    std::begin(twist_ptr_queue_), std::end(twist_ptr_queue_), new_stamp,
-    [](const geometry_msgs::msg::TwistStamped::ConstSharedPtr & x_ptr, const rclcpp::Time & t) {
-      return rclcpp::Time(x_ptr->header.stamp) < t;
+  auto new_twist_it = std::lower_bound(
+    std::begin(twist_queue_), std::end(twist_queue_), new_stamp,
+    [](const geometry_msgs::msg::TwistStamped & x, const rclcpp::Time & t) {
+      return rclcpp::Time(x.header.stamp) < t;
     });
-  new_twist_ptr_it =
-    new_twist_ptr_it == twist_ptr_queue_.end() ? (twist_ptr_queue_.end() - 1) : new_twist_ptr_it;
+  new_twist_it = new_twist_it == twist_queue_.end() ? (twist_queue_.end() - 1) : new_twist_it;
 
   auto prev_time = old_stamp;
   double x = 0.0;
   double y = 0.0;
   double yaw = 0.0;
-  for (auto twist_ptr_it = old_twist_ptr_it; twist_ptr_it != new_twist_ptr_it + 1; ++twist_ptr_it) {
+  for (auto twist_it = old_twist_it; twist_it != new_twist_it + 1; ++twist_it) {
     const double dt =
-      (twist_ptr_it != new_twist_ptr_it)
-        ? (rclcpp::Time((*twist_ptr_it)->header.stamp) - rclcpp::Time(prev_time)).seconds()
+      (twist_it != new_twist_it)
+        ? (rclcpp::Time(twist_it->header.stamp) - rclcpp::Time(prev_time)).seconds()
         : (rclcpp::Time(new_stamp) - rclcpp::Time(prev_time)).seconds();
 
     if (std::fabs(dt) > 0.1) {
@@ -292,11 +383,11 @@ PointCloudConcatenateDataSynchronizerComponent::computeTransformToAdjustForOldTi
       break;
     }
 
-    const double dis = (*twist_ptr_it)->twist.linear.x * dt;
-    yaw += (*twist_ptr_it)->twist.angular.z * dt;
+    const double dis = twist_it->twist.linear.x * dt;
+    yaw += twist_it->twist.angular.z * dt;
     x += dis * std::cos(yaw);
     y += dis * std::sin(yaw);
-    prev_time = (*twist_ptr_it)->header.stamp;
+    prev_time = twist_it->header.stamp;
   }
   Eigen::AngleAxisf rotation_x(0, Eigen::Vector3f::UnitX());
   Eigen::AngleAxisf rotation_y(0, Eigen::Vector3f::UnitY());
@@ -306,6 +397,15 @@ PointCloudConcatenateDataSynchronizerComponent::computeTransformToAdjustForOldTi
   return rotation_matrix;
 }
 
+Eigen::Matrix4f PointCloudConcatenateDataSynchronizerComponent::computeTransformBetweenStamps(
+  const rclcpp::Time & stamp, const rclcpp::Time & target_stamp)
+{
+  if (target_stamp <= stamp) {
+    return computeTransformToAdjustForOldTimestamp(target_stamp, stamp);
+  }
+  return computeTransformToAdjustForOldTimestamp(stamp, target_stamp).inverse();
+}
+
 std::map<std::string, sensor_msgs::msg::PointCloud2::SharedPtr>
 PointCloudConcatenateDataSynchronizerComponent::combineClouds(
   sensor_msgs::msg::PointCloud2::SharedPtr & concat_cloud_ptr)
@@ -329,48 +429,183 @@ PointCloudConcatenateDataSynchronizerComponent::combineClouds(
   std::reverse(pc_stamps.begin(), pc_stamps.end());
   const auto oldest_stamp = pc_stamps.back();
 
-  // Step2. Calculate compensation transform and concatenate with the oldest stamp
+  // Step2. Calculate a single transform per cloud, to the output frame and compensated to the
+  // oldest stamp, and the position of its points in the concatenated cloud.
+  struct CloudToConcat
+  {
+    std::string topic_name;
+    PointCloud2::ConstSharedPtr cloud;
+    Eigen::Matrix4f transform;
+    size_t point_offset;
+  };
+  std::vector<CloudToConcat> clouds_to_concat;
+  size_t nb_points = 0;
   for (const auto & e : cloud_stdmap_) {
-    if (e.second != nullptr) {
-      sensor_msgs::msg::PointCloud2::SharedPtr transformed_cloud_ptr(
-        new sensor_msgs::msg::PointCloud2());
-      transformPointCloud(e.second, transformed_cloud_ptr);
-
-      // calculate transforms to oldest stamp
-      Eigen::Matrix4f adjust_to_old_data_transform = Eigen::Matrix4f::Identity();
-      rclcpp::Time transformed_stamp = rclcpp::Time(e.second->header.stamp);
-      for (const auto & stamp : pc_stamps) {
-        const auto new_to_old_transform =
-          computeTransformToAdjustForOldTimestamp(stamp, transformed_stamp);
-        adjust_to_old_data_transform = new_to_old_transform * adjust_to_old_data_transform;
-        transformed_stamp = std::min(transformed_stamp, stamp);
-      }
-      sensor_msgs::msg::PointCloud2::SharedPtr transformed_delay_compensated_cloud_ptr(
-        new sensor_msgs::msg::PointCloud2());
-      pcl_ros::transformPointCloud(
-        adjust_to_old_data_transform, *transformed_cloud_ptr,
-        *transformed_delay_compensated_cloud_ptr);
-
-      // concatenate
-      if (concat_cloud_ptr == nullptr) {
-        concat_cloud_ptr =
-          std::make_shared<sensor_msgs::msg::PointCloud2>(*transformed_delay_compensated_cloud_ptr);
-      } else {
-        pcl::concatenatePointCloud(
-          *concat_cloud_ptr, *transformed_delay_compensated_cloud_ptr, *concat_cloud_ptr);
-      }
-      // gather transformed clouds
-      transformed_delay_compensated_cloud_ptr->header.stamp = oldest_stamp;
-      transformed_delay_compensated_cloud_ptr->header.frame_id = output_frame_;
-      transformed_clouds[e.first] = transformed_delay_compensated_cloud_ptr;
-    } else {
+    if (e.second == nullptr) {
       not_subscribed_topic_names_.insert(e.first);
+      continue;
+    }
+    Eigen::Matrix4f to_output_frame_transform;
+    if (!computeTransformToOutputFrame(*e.second, to_output_frame_transform)) {
+      continue;
     }
+    if (!clouds_to_concat.empty() && !hasSameLayout(*clouds_to_concat.front().cloud, *e.second)) {
+      RCLCPP_ERROR(
+        this->get_logger(), "[combineClouds] The fields of %s do not match the other inputs.",
+        e.first.c_str());
+      continue;
+    }
+
+    // calculate transforms to oldest stamp
+    Eigen::Matrix4f adjust_to_old_data_transform = Eigen::Matrix4f::Identity();
+    rclcpp::Time transformed_stamp = rclcpp::Time(e.second->header.stamp);
+    for (const auto & stamp : pc_stamps) {
+      const auto new_to_old_transform =
+        computeTransformToAdjustForOldTimestamp(stamp, transformed_stamp);
+      adjust_to_old_data_transform = new_to_old_transform * adjust_to_old_data_transform;
+      transformed_stamp = std::min(transformed_stamp, stamp);
+    }
+    clouds_to_concat.push_back(
+      {e.first, e.second, adjust_to_old_data_transform * to_output_frame_transform, nb_points});
+    nb_points += numberOfPoints(*e.second);
+  }
+  if (clouds_to_concat.empty()) {
+    return transformed_clouds;
   }
+
+  // Step3. Transform the points of each cloud directly into the preallocated concatenated cloud
+  concat_cloud_ptr = std::make_shared<sensor_msgs::msg::PointCloud2>();
+  initializeConcatCloud(*clouds_to_concat.front().cloud, output_frame_, *concat_cloud_ptr);
   concat_cloud_ptr->header.stamp = oldest_stamp;
+  concat_cloud_ptr->width = static_cast<uint32_t>(nb_points);
+  concat_cloud_ptr->row_step = concat_cloud_ptr->width * concat_cloud_ptr->point_step;
+  concat_cloud_ptr->is_dense = std::all_of(
+    clouds_to_concat.begin(), clouds_to_concat.end(),
+    [](const auto & c) { return static_cast<bool>(c.cloud->is_dense); });
+  concat_cloud_ptr->data.resize(nb_points * concat_cloud_ptr->point_step);
+
+  const auto transform_cloud = [&](const CloudToConcat & c) {
+    copyTransformedPoints(
+      *c.cloud, c.transform,
+      concat_cloud_ptr->data.data() + c.point_offset * concat_cloud_ptr->point_step);
+  };
+  // each cloud writes to its own range of the concatenated cloud
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < clouds_to_concat.size(); ++i) {
+    threads.emplace_back(transform_cloud, std::cref(clouds_to_concat[i]));
+  }
+  transform_cloud(clouds_to_concat.front());
+  for (auto & thread : threads) {
+    thread.join();
+  }
+
+  // gather transformed clouds
+  if (publish_synchronized_pointcloud_) {
+    for (const auto & c : clouds_to_concat) {
+      transformed_clouds[c.topic_name] =
+        extractPoints(*concat_cloud_ptr, c.point_offset, numberOfPoints(*c.cloud));
+    }
+  }
+  return transformed_clouds;
+}
+
+void PointCloudConcatenateDataSynchronizerComponent::addToStreamingConcat(
+  const std::string & topic_name, const PointCloud2::ConstSharedPtr & cloud)
+{
+  Eigen::Matrix4f to_output_frame_transform;
+  if (!computeTransformToOutputFrame(*cloud, to_output_frame_transform)) {
+    return;
+  }
+  const rclcpp::Time stamp(cloud->header.stamp);
+  auto & concat_cloud = *streaming_concat_cloud_ptr_;
+  if (!streaming_reference_stamp_) {
+    // the first cloud of the cycle sets the layout and the stamp of the concatenated cloud
+    initializeConcatCloud(*cloud, output_frame_, concat_cloud);
+    concat_cloud.header.stamp = stamp;
+    streaming_reference_stamp_ = stamp;
+  } else if (!hasSameLayout(concat_cloud, *cloud)) {
+    RCLCPP_ERROR(
+      this->get_logger(), "[addToStreamingConcat] The fields of %s do not match the other inputs.",
+      topic_name.c_str());
+    return;
+  }
+
+  const auto transform =
+    computeTransformBetweenStamps(stamp, *streaming_reference_stamp_) * to_output_frame_transform;
+  const size_t point_offset = concat_cloud.width;
+  const size_t nb_points = numberOfPoints(*cloud);
+  // the capacity of the data is kept from the previous cycles
+  concat_cloud.data.resize((point_offset + nb_points) * concat_cloud.point_step);
+  copyTransformedPoints(
+    *cloud, transform, concat_cloud.data.data() + point_offset * concat_cloud.point_step);
+  concat_cloud.width = static_cast<uint32_t>(point_offset + nb_points);
+  concat_cloud.row_step = concat_cloud.width * concat_cloud.point_step;
+  concat_cloud.is_dense = concat_cloud.is_dense && cloud->is_dense;
+  streaming_point_ranges_[topic_name] = std::make_pair(point_offset, nb_points);
+}
+
+void PointCloudConcatenateDataSynchronizerComponent::resetStreamingConcat()
+{
+  streaming_reference_stamp_.reset();
+  streaming_point_ranges_.clear();
+  streaming_concat_cloud_ptr_->width = 0;
+  streaming_concat_cloud_ptr_->row_step = 0;
+  streaming_concat_cloud_ptr_->data.clear();
+  for (const auto & e : cloud_stdmap_) {
+    if (e.second != nullptr) {
+      addToStreamingConcat(e.first, e.second);
+    }
+  }
+}
+
+std::map<std::string, sensor_msgs::msg::PointCloud2::SharedPtr>
+PointCloudConcatenateDataSynchronizerComponent::takeStreamingConcat(
+  sensor_msgs::msg::PointCloud2::SharedPtr & concat_cloud_ptr)
+{
+  std::map<std::string, sensor_msgs::msg::PointCloud2::SharedPtr> transformed_clouds;
+  for (const auto & e : cloud_stdmap_) {
+    transformed_clouds[e.first] = nullptr;
+    if (e.second == nullptr) {
+      not_subscribed_topic_names_.insert(e.first);
+    }
+  }
+  if (!streaming_reference_stamp_) {
+    return transformed_clouds;
+  }
+  concat_cloud_ptr = streaming_concat_cloud_ptr_;
+  if (publish_synchronized_pointcloud_) {
+    for (const auto & [topic_name, range] : streaming_point_ranges_) {
+      transformed_clouds[topic_name] =
+        extractPoints(*concat_cloud_ptr, range.first, range.second);
+    }
+  }
   return transformed_clouds;
 }
 
+void PointCloudConcatenateDataSynchronizerComponent::publishArrivalLatencies()
+{
+  std::optional<rclcpp::Time> first_arrival_time;
+  for (const auto & e : arrival_time_stdmap_) {
+    if (e.second && (!first_arrival_time || *e.second < *first_arrival_time)) {
+      first_arrival_time = e.second;
+    }
+  }
+  for (const auto & e : arrival_time_stdmap_) {
+    if (!e.second) {
+      continue;
+    }
+    // delay from the sensor stamp, and wait caused by this sensor in the current cycle
+    const auto & cloud = cloud_stdmap_.at(e.first);
+    const auto topic_suffix = e.first.front() == '/' ? e.first : "/" + e.first;
+    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/arrival_latency_ms" + topic_suffix,
+      (*e.second - rclcpp::Time(cloud->header.stamp)).seconds() * 1e3);
+    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/arrival_delay_from_first_ms" + topic_suffix,
+      (*e.second - *first_arrival_time).seconds() * 1e3);
+  }
+}
+
 void PointCloudConcatenateDataSynchronizerComponent::publish()
 {
   stop_watch_ptr_->toc("processing_time", true);
@@ -378,7 +613,9 @@ void PointCloudConcatenateDataSynchronizerComponent::publish()
   not_subscribed_topic_names_.clear();
 
   const auto & transformed_raw_points =
-    PointCloudConcatenateDataSynchronizerComponent::combineClouds(concat_cloud_ptr);
+    streaming_concatenation_
+      ? PointCloudConcatenateDataSynchronizerComponent::takeStreamingConcat(concat_cloud_ptr)
+      : PointCloudConcatenateDataSynchronizerComponent::combineClouds(concat_cloud_ptr);
 
   // publish concatenated pointcloud
   if (concat_cloud_ptr) {
@@ -404,10 +641,22 @@ void PointCloudConcatenateDataSynchronizerComponent::publish()
 
   updater_.force_update();
 
+  if (debug_publisher_) {
+    publishArrivalLatencies();
+  }
+
   cloud_stdmap_ = cloud_stdmap_tmp_;
   std::for_each(std::begin(cloud_stdmap_tmp_), std::end(cloud_stdmap_tmp_), [](auto & e) {
     e.second = nullptr;
   });
+  arrival_time_stdmap_ = arrival_time_stdmap_tmp_;
+  std::for_each(
+    std::begin(arrival_time_stdmap_tmp_), std::end(arrival_time_stdmap_tmp_),
+    [](auto & e) { e.second.reset(); });
+  // the clouds received early for the next cycle are added after the publication
+  if (streaming_concatenation_) {
+    resetStreamingConcat();
+  }
   // add processing time for debug
   if (debug_publisher_) {
     const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
@@ -496,6 +745,7 @@ void PointCloudConcatenateDataSynchronizerComponent::cloud_callback(
 
   if (is_already_subscribed_this) {
     cloud_stdmap_tmp_[topic_name] = xyzi_input_ptr;
+    arrival_time_stdmap_tmp_[topic_name] = this->now();
 
     if (!is_already_subscribed_tmp) {
       auto period = std::chrono::duration_cast<std::chrono::nanoseconds>(
@@ -509,20 +759,34 @@ void PointCloudConcatenateDataSynchronizerComponent::cloud_callback(
     }
   } else {
     cloud_stdmap_[topic_name] = xyzi_input_ptr;
+    arrival_time_stdmap_[topic_name] = this->now();
+    if (streaming_concatenation_) {
+      addToStreamingConcat(topic_name, xyzi_input_ptr);
+    }
 
     const bool is_subscribed_all = std::all_of(
       std::begin(cloud_stdmap_), std::end(cloud_stdmap_),
       [](const auto & e) { return e.second != nullptr; });
 
     if (is_subscribed_all) {
+      bool replaced_cloud = false;
       for (const auto & e : cloud_stdmap_tmp_) {
         if (e.second != nullptr) {
           cloud_stdmap_[e.first] = e.second;
+          arrival_time_stdmap_[e.first] = arrival_time_stdmap_tmp_[e.first];
+          replaced_cloud = true;
         }
       }
       std::for_each(std::begin(cloud_stdmap_tmp_), std::end(cloud_stdmap_tmp_), [](auto & e) {
         e.second = nullptr;
       });
+      std::for_each(
+        std::begin(arrival_time_stdmap_tmp_), std::end(arrival_time_stdmap_tmp_),
+        [](auto & e) { e.second.reset(); });
+      // the newer clouds replace the ones already concatenated
+      if (streaming_concatenation_ && replaced_cloud) {
+        resetStreamingConcat();
+      }
 
       timer_->cancel();
       publish();
@@ -562,52 +826,52 @@ void PointCloudConcatenateDataSynchronizerComponent::twist_callback(
   const geometry_msgs::msg::TwistWithCovarianceStamped::ConstSharedPtr input)
 {
   // if rosbag restart, clear buffer
-  if (!twist_ptr_queue_.empty()) {
-    if (rclcpp::Time(twist_ptr_queue_.front()->header.stamp) > rclcpp::Time(input->header.stamp)) {
-      twist_ptr_queue_.clear();
+  if (!twist_queue_.empty()) {
+    if (rclcpp::Time(twist_queue_.front().header.stamp) > rclcpp::Time(input->header.stamp)) {
+      twist_queue_.clear();
     }
   }
 
   // pop old data
-  while (!twist_ptr_queue_.empty()) {
+  while (!twist_queue_.empty()) {
     if (
-      rclcpp::Time(twist_ptr_queue_.front()->header.stamp) + rclcpp::Duration::from_seconds(1.0) >
+      rclcpp::Time(twist_queue_.front().header.stamp) + rclcpp::Duration::from_seconds(1.0) >
       rclcpp::Time(input->header.stamp)) {
       break;
     }
-    twist_ptr_queue_.pop_front();
+    twist_queue_.pop_front();
   }
 
-  auto twist_ptr = std::make_shared<geometry_msgs::msg::TwistStamped>();
-  twist_ptr->header = input->header;
-  twist_ptr->twist = input->twist.twist;
-  twist_ptr_queue_.push_back(twist_ptr);
+  geometry_msgs::msg::TwistStamped twist;
+  twist.header = input->header;
+  twist.twist = input->twist.twist;
+  twist_queue_.push_back(twist);
 }
 
 void PointCloudConcatenateDataSynchronizerComponent::odom_callback(
   const nav_msgs::msg::Odometry::ConstSharedPtr input)
 {
   // if rosbag restart, clear buffer
-  if (!twist_ptr_queue_.empty()) {
-    if (rclcpp::Time(twist_ptr_queue_.front()->header.stamp) > rclcpp::Time(input->header.stamp)) {
-      twist_ptr_queue_.clear();
+  if (!twist_queue_.empty()) {
+    if (rclcpp::Time(twist_queue_.front().header.stamp) > rclcpp::Time(input->header.stamp)) {
+      twist_queue_.clear();
     }
   }
 
   // pop old data
-  while (!twist_ptr_queue_.empty()) {
+  while (!twist_queue_.empty()) {
     if (
-      rclcpp::Time(twist_ptr_queue_.front()->header.stamp) + rclcpp::Duration::from_seconds(1.0) >
+      rclcpp::Time(twist_queue_.front().header.stamp) + rclcpp::Duration::from_seconds(1.0) >
       rclcpp::Time(input->header.stamp)) {
       break;
     }
-    twist_ptr_queue_.pop_front();
+    twist_queue_.pop_front();
   }
 
-  auto twist_ptr = std::make_shared<geometry_msgs::msg::TwistStamped>();
-  twist_ptr->header = input->header;
-  twist_ptr->twist = input->twist.twist;
-  twist_ptr_queue_.push_back(twist_ptr);
+  geometry_msgs::msg::TwistStamped twist;
+  twist.header = input->header;
+  twist.twist = input->twist.twist;
+  twist_queue_.push_back(twist);
 }
 
 void PointCloudConcatenateDataSynchronizerComponent::checkConcatStatus(
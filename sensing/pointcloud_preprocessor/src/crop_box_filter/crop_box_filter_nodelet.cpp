@@ -149,10 +149,7 @@ void CropBoxFilterComponent::faster_filter(
       point = transform_info.eigen_transform * point;
     }
 
-    bool point_is_inside = point[2] > param_.min_z && point[2] < param_.max_z &&
-                           point[1] > param_.min_y && point[1] < param_.max_y &&
-                           point[0] > param_.min_x && point[0] < param_.max_x;
-    if ((!param_.negative && point_is_inside) || (param_.negative && !point_is_inside)) {
+    if (param_.isKept(point)) {
       memcpy(&output.data[output_size], &input->data[global_offset], input->point_step);
 
       if (transform_info.need_transform) {
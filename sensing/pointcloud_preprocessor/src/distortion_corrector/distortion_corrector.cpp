@@ -16,9 +16,16 @@
 
 #include "tier4_autoware_utils/math/trigonometry.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <deque>
+#include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace pointcloud_preprocessor
 {
@@ -39,6 +46,7 @@ DistortionCorrectorComponent::DistortionCorrectorComponent(const rclcpp::NodeOpt
   // Parameter
   time_stamp_field_name_ = declare_parameter("time_stamp_field_name", "time_stamp");
   use_imu_ = declare_parameter("use_imu", true);
+  time_bucket_sec_ = declare_parameter("time_bucket_sec", 0.0);
 
   // Publisher
   undistorted_points_pub_ =
@@ -153,7 +161,7 @@ bool DistortionCorrectorComponent::getTransform(
 
   try {
     const auto transform_msg =
-      tf2_buffer_.lookupTransform(target_frame, source_frame, tf2::TimePointZero);
+      transform_cache_.lookupTransform(target_frame, source_frame, tf2::TimePointZero);
     tf2::convert(transform_msg.transform, *tf2_transform_ptr);
   } catch (const tf2::TransformException & ex) {
     RCLCPP_WARN(get_logger(), "%s", ex.what());
@@ -189,6 +197,11 @@ bool DistortionCorrectorComponent::undistortPointCloud(
     return false;
   }
 
+  if (time_bucket_sec_ > 0.0) {
+    undistortPointCloudByTimeBucket(tf2_base_link_to_sensor, points);
+    return true;
+  }
+
   sensor_msgs::PointCloud2Iterator<float> it_x(points, "x");
   sensor_msgs::PointCloud2Iterator<float> it_y(points, "y");
   sensor_msgs::PointCloud2Iterator<float> it_z(points, "z");
@@ -307,6 +320,149 @@ bool DistortionCorrectorComponent::undistortPointCloud(
   return true;
 }
 
+void DistortionCorrectorComponent::undistortPointCloudByTimeBucket(
+  const tf2::Transform & tf2_base_link_to_sensor, PointCloud2 & points)
+{
+  const auto field_offset = [&](const std::string & name) {
+    const auto it = std::find_if(
+      std::cbegin(points.fields), std::cend(points.fields),
+      [&](const sensor_msgs::msg::PointField & field) { return field.name == name; });
+    if (it == points.fields.cend()) {
+      throw std::runtime_error("Field " + name + " does not exist");
+    }
+    return it->offset;
+  };
+  const auto x_offset = field_offset("x");
+  const auto y_offset = field_offset("y");
+  const auto z_offset = field_offset("z");
+  const auto time_stamp_offset = field_offset(time_stamp_field_name_);
+  const size_t nb_points = static_cast<size_t>(points.width) * points.height;
+  const auto point_step = points.point_step;
+
+  const auto time_stamp_at = [&](const size_t i) {
+    double time_stamp;
+    std::memcpy(&time_stamp, &points.data[i * point_step + time_stamp_offset], sizeof(double));
+    return time_stamp;
+  };
+  // the poses are integrated from the first point, as in the per-point undistortion
+  const double first_point_time_stamp_sec = time_stamp_at(0);
+  double last_point_time_stamp_sec = first_point_time_stamp_sec;
+  for (size_t i = 1; i < nb_points; ++i)
+    last_point_time_stamp_sec = std::max(last_point_time_stamp_sec, time_stamp_at(i));
+  const double scan_duration = last_point_time_stamp_sec - first_point_time_stamp_sec;
+  const auto nb_buckets =
+    std::min(static_cast<size_t>(std::ceil(scan_duration / time_bucket_sec_)) + 1, nb_points);
+  const double bucket_duration =
+    nb_buckets > 1 ? scan_duration / static_cast<double>(nb_buckets - 1) : 0.0;
+
+  // one combined sensor -> base_link -> odom -> sensor transform (row-major 3x4) per bucket
+  std::vector<std::array<float, 12>> bucket_transforms(nb_buckets);
+  {
+    auto twist_it = std::lower_bound(
+      std::begin(twist_queue_), std::end(twist_queue_), first_point_time_stamp_sec,
+      [](const geometry_msgs::msg::TwistStamped & x, const double t) {
+        return rclcpp::Time(x.header.stamp).seconds() < t;
+      });
+    twist_it = twist_it == std::end(twist_queue_) ? std::end(twist_queue_) - 1 : twist_it;
+    double twist_stamp = rclcpp::Time(twist_it->header.stamp).seconds();
+
+    const bool use_imu = use_imu_ && !angular_velocity_queue_.empty();
+    auto imu_it = std::begin(angular_velocity_queue_);
+    double imu_stamp{0.0};
+    if (use_imu) {
+      imu_it = std::lower_bound(
+        std::begin(angular_velocity_queue_), std::end(angular_velocity_queue_),
+        first_point_time_stamp_sec,
+        [](const geometry_msgs::msg::Vector3Stamped & x, const double t) {
+          return rclcpp::Time(x.header.stamp).seconds() < t;
+        });
+      imu_it = imu_it == std::end(angular_velocity_queue_) ? std::end(angular_velocity_queue_) - 1
+                                                           : imu_it;
+      imu_stamp = rclcpp::Time(imu_it->header.stamp).seconds();
+    }
+
+    const tf2::Transform tf2_base_link_to_sensor_inv{tf2_base_link_to_sensor.inverse()};
+    float theta{0.0f};
+    float x{0.0f};
+    float y{0.0f};
+    tf2::Transform baselink_tf_odom{};
+    for (size_t bucket_idx = 0; bucket_idx < nb_buckets; ++bucket_idx) {
+      const double bucket_time_stamp_sec =
+        first_point_time_stamp_sec + static_cast<double>(bucket_idx) * bucket_duration;
+      while (twist_it != std::end(twist_queue_) - 1 && bucket_time_stamp_sec > twist_stamp) {
+        ++twist_it;
+        twist_stamp = rclcpp::Time(twist_it->header.stamp).seconds();
+      }
+
+      float v{static_cast<float>(twist_it->twist.linear.x)};
+      float w{static_cast<float>(twist_it->twist.angular.z)};
+      if (std::abs(bucket_time_stamp_sec - twist_stamp) > 0.1) {
+        RCLCPP_WARN_STREAM_THROTTLE(
+          get_logger(), *get_clock(), 10000 /* ms */,
+          "twist time_stamp is too late. Could not interpolate.");
+        v = 0.0f;
+        w = 0.0f;
+      }
+
+      if (use_imu) {
+        while (imu_it != std::end(angular_velocity_queue_) - 1 &&
+               bucket_time_stamp_sec > imu_stamp) {
+          ++imu_it;
+          imu_stamp = rclcpp::Time(imu_it->header.stamp).seconds();
+        }
+        if (std::abs(bucket_time_stamp_sec - imu_stamp) > 0.1) {
+          RCLCPP_WARN_STREAM_THROTTLE(
+            get_logger(), *get_clock(), 10000 /* ms */,
+            "imu time_stamp is too late. Could not interpolate.");
+        } else {
+          w = static_cast<float>(imu_it->vector.z);
+        }
+      }
+
+      const auto time_offset = bucket_idx == 0 ? 0.0f : static_cast<float>(bucket_duration);
+      theta += w * time_offset;
+      const float dis = v * time_offset;
+      x += dis * tier4_autoware_utils::cos(theta);
+      y += dis * tier4_autoware_utils::sin(theta);
+      baselink_tf_odom.setOrigin(tf2::Vector3(x, y, 0.0));
+      baselink_tf_odom.setRotation(tf2::Quaternion(
+        0, 0, tier4_autoware_utils::sin(theta * 0.5f), tier4_autoware_utils::cos(theta * 0.5f)));
+
+      const tf2::Transform transform =
+        tf2_base_link_to_sensor * baselink_tf_odom * tf2_base_link_to_sensor_inv;
+      auto & bucket_transform = bucket_transforms[bucket_idx];
+      for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col)
+          bucket_transform[row * 4 + col] = static_cast<float>(transform.getBasis()[row][col]);
+        bucket_transform[row * 4 + 3] = static_cast<float>(transform.getOrigin()[row]);
+      }
+    }
+  }
+
+  // each point uses the transform of its nearest bucket
+  const double inv_bucket_duration = bucket_duration > 0.0 ? 1.0 / bucket_duration : 0.0;
+  const auto last_bucket_idx = static_cast<int64_t>(nb_buckets) - 1;
+  auto * data = points.data.data();
+  for (size_t i = 0; i < nb_points; ++i, data += point_step) {
+    double time_stamp;
+    std::memcpy(&time_stamp, data + time_stamp_offset, sizeof(double));
+    const auto bucket_idx = std::clamp<int64_t>(
+      std::llround((time_stamp - first_point_time_stamp_sec) * inv_bucket_duration), 0,
+      last_bucket_idx);
+    const auto & t = bucket_transforms[bucket_idx];
+    float p[3];
+    std::memcpy(&p[0], data + x_offset, sizeof(float));
+    std::memcpy(&p[1], data + y_offset, sizeof(float));
+    std::memcpy(&p[2], data + z_offset, sizeof(float));
+    const float undistorted_x = t[0] * p[0] + t[1] * p[1] + t[2] * p[2] + t[3];
+    const float undistorted_y = t[4] * p[0] + t[5] * p[1] + t[6] * p[2] + t[7];
+    const float undistorted_z = t[8] * p[0] + t[9] * p[1] + t[10] * p[2] + t[11];
+    std::memcpy(data + x_offset, &undistorted_x, sizeof(float));
+    std::memcpy(data + y_offset, &undistorted_y, sizeof(float));
+    std::memcpy(data + z_offset, &undistorted_z, sizeof(float));
+  }
+}
+
 }  // namespace pointcloud_preprocessor
 
 #include <rclcpp_components/register_node_macro.hpp>
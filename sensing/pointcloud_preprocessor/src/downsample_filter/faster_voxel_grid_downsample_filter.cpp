@@ -14,14 +14,79 @@
 
 #include "pointcloud_preprocessor/downsample_filter/faster_voxel_grid_downsample_filter.hpp"
 
+#include <algorithm>
+#include <thread>
+
 namespace pointcloud_preprocessor
 {
+namespace
+{
+// below this number of points per thread, the thread creation is not worth it
+constexpr size_t min_points_per_thread = 10000;
+constexpr size_t min_table_slots = 1024;
+}  // namespace
+
+void FasterVoxelGridDownsampleFilter::VoxelCentroidTable::clear()
+{
+  std::fill(slots_.begin(), slots_.end(), Slot{});
+  entries_.clear();
+}
+
+size_t FasterVoxelGridDownsampleFilter::VoxelCentroidTable::slot_index(uint32_t voxel_id) const
+{
+  // Fibonacci hashing, the number of slots is a power of two
+  return static_cast<size_t>((voxel_id * 2654435769u) >> slot_index_shift_);
+}
+
+void FasterVoxelGridDownsampleFilter::VoxelCentroidTable::rehash(size_t nb_slots)
+{
+  slot_index_shift_ = 32;
+  for (size_t n = 1; n < nb_slots; n <<= 1) --slot_index_shift_;
+  slots_.assign(size_t{1} << (32 - slot_index_shift_), Slot{});
+  const auto slot_mask = slots_.size() - 1;
+  for (uint32_t entry_index = 0; entry_index < entries_.size(); ++entry_index) {
+    auto index = slot_index(entries_[entry_index].first);
+    while (slots_[index].voxel_id != empty_slot) index = (index + 1) & slot_mask;
+    slots_[index] = Slot{entries_[entry_index].first, entry_index};
+  }
+}
+
+FasterVoxelGridDownsampleFilter::Centroid &
+FasterVoxelGridDownsampleFilter::VoxelCentroidTable::find_or_insert(uint32_t voxel_id)
+{
+  // keep the load factor below 0.5
+  if (2 * (entries_.size() + 1) > slots_.size()) {
+    rehash(std::max(min_table_slots, 2 * slots_.size()));
+  }
+  const auto slot_mask = slots_.size() - 1;
+  auto index = slot_index(voxel_id);
+  while (true) {
+    auto & slot = slots_[index];
+    if (slot.voxel_id == voxel_id) {
+      return entries_[slot.entry_index].second;
+    }
+    if (slot.voxel_id == empty_slot) {
+      slot = Slot{voxel_id, static_cast<uint32_t>(entries_.size())};
+      entries_.emplace_back(voxel_id, Centroid());
+      return entries_.back().second;
+    }
+    index = (index + 1) & slot_mask;
+  }
+}
+
+void FasterVoxelGridDownsampleFilter::VoxelCentroidTable::merge(const VoxelCentroidTable & other)
+{
+  for (const auto & [voxel_id, centroid] : other.entries_) {
+    find_or_insert(voxel_id).add_centroid(centroid);
+  }
+}
 
 FasterVoxelGridDownsampleFilter::FasterVoxelGridDownsampleFilter()
 {
   pcl::for_each_type<typename pcl::traits::fieldList<pcl::PointXYZ>::type>(
     pcl::detail::FieldAdder<pcl::PointXYZ>(xyz_fields_));
   offset_initialized_ = false;
+  set_num_threads(1);
 }
 
 void FasterVoxelGridDownsampleFilter::set_voxel_size(
@@ -45,6 +110,22 @@ void FasterVoxelGridDownsampleFilter::set_field_offsets(const PointCloud2ConstPt
   offset_initialized_ = true;
 }
 
+void FasterVoxelGridDownsampleFilter::set_field_offsets(
+  int x_offset, int y_offset, int z_offset, int intensity_offset)
+{
+  x_offset_ = x_offset;
+  y_offset_ = y_offset;
+  z_offset_ = z_offset;
+  intensity_offset_ = intensity_offset;
+  offset_initialized_ = true;
+}
+
+void FasterVoxelGridDownsampleFilter::set_num_threads(size_t num_threads)
+{
+  num_threads_ = std::max<size_t>(num_threads, 1);
+  voxel_centroid_tables_.resize(num_threads_);
+}
+
 void FasterVoxelGridDownsampleFilter::filter(
   const PointCloud2ConstPtr & input, PointCloud2 & output, const TransformInfo & transform_info,
   const rclcpp::Logger & logger)
@@ -54,9 +135,14 @@ void FasterVoxelGridDownsampleFilter::filter(
     set_field_offsets(input);
   }
 
+  const size_t nb_points = input->data.size() / input->point_step;
+  const auto get_point = [&](const size_t i) {
+    return get_point_from_global_offset(input, i * input->point_step);
+  };
+
   // Compute the minimum and maximum voxel coordinates
   Eigen::Vector3i min_voxel, max_voxel;
-  if (!get_min_max_voxel(input, min_voxel, max_voxel)) {
+  if (!get_min_max_voxel(nb_points, get_point, min_voxel, max_voxel)) {
     RCLCPP_ERROR(
       logger,
       "Voxel size is too small for the input dataset. "
@@ -66,12 +152,13 @@ void FasterVoxelGridDownsampleFilter::filter(
   }
 
   // Storage for mapping voxel coordinates to centroids
-  auto voxel_centroid_map = calc_centroids_each_voxel(input, max_voxel, min_voxel);
+  const auto & voxel_centroid_table =
+    calc_centroids_each_voxel(nb_points, get_point, max_voxel, min_voxel);
 
   // Initialize the output
-  output.row_step = voxel_centroid_map.size() * input->point_step;
+  output.row_step = voxel_centroid_table.size() * input->point_step;
   output.data.resize(output.row_step);
-  output.width = voxel_centroid_map.size();
+  output.width = voxel_centroid_table.size();
   pcl_conversions::fromPCL(xyz_fields_, output.fields);
   output.is_dense = true;  // we filter out invalid points
   output.height = input->height;
@@ -80,7 +167,40 @@ void FasterVoxelGridDownsampleFilter::filter(
   output.header = input->header;
 
   // Copy the centroids to the output
-  copy_centroids_to_output(voxel_centroid_map, output, transform_info);
+  copy_centroids_to_output(voxel_centroid_table, output, transform_info);
+}
+
+bool FasterVoxelGridDownsampleFilter::filter_points(
+  const std::vector<Eigen::Vector3f> & points, PointCloud2 & output,
+  const TransformInfo & transform_info, const rclcpp::Logger & logger)
+{
+  const auto get_point = [&](const size_t i) { return points[i]; };
+
+  // Compute the minimum and maximum voxel coordinates
+  Eigen::Vector3i min_voxel, max_voxel;
+  if (!get_min_max_voxel(points.size(), get_point, min_voxel, max_voxel)) {
+    RCLCPP_ERROR(
+      logger,
+      "Voxel size is too small for the input dataset. "
+      "Integer indices would overflow.");
+    return false;
+  }
+
+  // Storage for mapping voxel coordinates to centroids
+  const auto & voxel_centroid_table =
+    calc_centroids_each_voxel(points.size(), get_point, max_voxel, min_voxel);
+
+  // Initialize the output
+  output.row_step = voxel_centroid_table.size() * output.point_step;
+  output.data.resize(output.row_step);
+  output.width = voxel_centroid_table.size();
+  pcl_conversions::fromPCL(xyz_fields_, output.fields);
+  output.is_dense = true;  // we filter out invalid points
+  output.height = 1;
+
+  // Copy the centroids to the output
+  copy_centroids_to_output(voxel_centroid_table, output, transform_info);
+  return true;
 }
 
 Eigen::Vector3f FasterVoxelGridDownsampleFilter::get_point_from_global_offset(
@@ -93,17 +213,18 @@ Eigen::Vector3f FasterVoxelGridDownsampleFilter::get_point_from_global_offset(
   return point;
 }
 
+template <class GetPoint>
 bool FasterVoxelGridDownsampleFilter::get_min_max_voxel(
-  const PointCloud2ConstPtr & input, Eigen::Vector3i & min_voxel, Eigen::Vector3i & max_voxel)
+  const size_t nb_points, const GetPoint & get_point, Eigen::Vector3i & min_voxel,
+  Eigen::Vector3i & max_voxel)
 {
   // Compute the minimum and maximum point coordinates
   Eigen::Vector3f min_point, max_point;
   min_point.setConstant(FLT_MAX);
   max_point.setConstant(-FLT_MAX);
-  for (size_t global_offset = 0; global_offset + input->point_step <= input->data.size();
-       global_offset += input->point_step) {
-    Eigen::Vector3f point = get_point_from_global_offset(input, global_offset);
-    if (std::isfinite(point[0]) && std::isfinite(point[1]), std::isfinite(point[2])) {
+  for (size_t i = 0; i < nb_points; ++i) {
+    Eigen::Vector3f point = get_point(i);
+    if (std::isfinite(point[0]) && std::isfinite(point[1]) && std::isfinite(point[2])) {
       min_point = min_point.cwiseMin(point);
       max_point = max_point.cwiseMax(point);
     }
@@ -129,21 +250,54 @@ bool FasterVoxelGridDownsampleFilter::get_min_max_voxel(
   return true;
 }
 
-std::unordered_map<uint32_t, FasterVoxelGridDownsampleFilter::Centroid>
+template <class GetPoint>
+const FasterVoxelGridDownsampleFilter::VoxelCentroidTable &
 FasterVoxelGridDownsampleFilter::calc_centroids_each_voxel(
-  const PointCloud2ConstPtr & input, const Eigen::Vector3i & max_voxel,
+  const size_t nb_points, const GetPoint & get_point, const Eigen::Vector3i & max_voxel,
   const Eigen::Vector3i & min_voxel)
 {
-  std::unordered_map<uint32_t, Centroid> voxel_centroid_map;
+  // Each thread accumulates the centroids of a range of points in its own table
+  const size_t nb_threads =
+    std::clamp<size_t>(nb_points / min_points_per_thread, 1, voxel_centroid_tables_.size());
+  const auto range_begin = [&](const size_t thread_idx) {
+    return nb_points * thread_idx / nb_threads;
+  };
+  std::vector<std::thread> threads;
+  for (size_t thread_idx = 1; thread_idx < nb_threads; ++thread_idx) {
+    threads.emplace_back([&, thread_idx]() {
+      calc_centroids_in_range(
+        get_point, max_voxel, min_voxel, range_begin(thread_idx), range_begin(thread_idx + 1),
+        voxel_centroid_tables_[thread_idx]);
+    });
+  }
+  calc_centroids_in_range(
+    get_point, max_voxel, min_voxel, range_begin(0), range_begin(1), voxel_centroid_tables_[0]);
+  for (auto & thread : threads) {
+    thread.join();
+  }
+
+  // Merge the tables by voxel index
+  for (size_t thread_idx = 1; thread_idx < nb_threads; ++thread_idx) {
+    voxel_centroid_tables_[0].merge(voxel_centroid_tables_[thread_idx]);
+  }
+  return voxel_centroid_tables_[0];
+}
+
+template <class GetPoint>
+void FasterVoxelGridDownsampleFilter::calc_centroids_in_range(
+  const GetPoint & get_point, const Eigen::Vector3i & max_voxel,
+  const Eigen::Vector3i & min_voxel, size_t begin, size_t end,
+  VoxelCentroidTable & voxel_centroid_table)
+{
+  voxel_centroid_table.clear();
   // Compute the number of divisions needed along all axis
   Eigen::Vector3i div_b = max_voxel - min_voxel + Eigen::Vector3i::Ones();
   // Set up the division multiplier
   Eigen::Vector3i div_b_mul(1, div_b[0], div_b[0] * div_b[1]);
 
-  for (size_t global_offset = 0; global_offset + input->point_step <= input->data.size();
-       global_offset += input->point_step) {
-    Eigen::Vector3f point = get_point_from_global_offset(input, global_offset);
-    if (std::isfinite(point[0]) && std::isfinite(point[1]), std::isfinite(point[2])) {
+  for (size_t i = begin; i < end; ++i) {
+    Eigen::Vector3f point = get_point(i);
+    if (std::isfinite(point[0]) && std::isfinite(point[1]) && std::isfinite(point[2])) {
       // Calculate the voxel index to which the point belongs
       int ijk0 = static_cast<int>(std::floor(point[0] * inverse_voxel_size_[0]) - min_voxel[0]);
       int ijk1 = static_cast<int>(std::floor(point[1] * inverse_voxel_size_[1]) - min_voxel[1]);
@@ -151,23 +305,17 @@ FasterVoxelGridDownsampleFilter::calc_centroids_each_voxel(
       uint32_t voxel_id = ijk0 * div_b_mul[0] + ijk1 * div_b_mul[1] + ijk2 * div_b_mul[2];
 
       // Add the point to the corresponding centroid
-      if (voxel_centroid_map.find(voxel_id) == voxel_centroid_map.end()) {
-        voxel_centroid_map[voxel_id] = Centroid(point[0], point[1], point[2]);
-      } else {
-        voxel_centroid_map[voxel_id].add_point(point[0], point[1], point[2]);
-      }
+      voxel_centroid_table.find_or_insert(voxel_id).add_point(point[0], point[1], point[2]);
     }
   }
-
-  return voxel_centroid_map;
 }
 
 void FasterVoxelGridDownsampleFilter::copy_centroids_to_output(
-  std::unordered_map<uint32_t, Centroid> & voxel_centroid_map, PointCloud2 & output,
+  const VoxelCentroidTable & voxel_centroid_table, PointCloud2 & output,
   const TransformInfo & transform_info)
 {
   size_t output_data_size = 0;
-  for (const auto & pair : voxel_centroid_map) {
+  for (const auto & pair : voxel_centroid_table.entries()) {
     Eigen::Vector4f centroid = pair.second.calc_centroid();
     if (transform_info.need_transform) {
       centroid = transform_info.eigen_transform * centroid;
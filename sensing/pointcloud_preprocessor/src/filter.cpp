@@ -91,6 +91,9 @@ pointcloud_preprocessor::Filter::Filter(
   {
     pub_output_ = this->create_publisher<PointCloud2>(
       "output", rclcpp::SensorDataQoS().keep_last(max_queue_size_));
+    input_topic_name_ = get_node_topics_interface()->resolve_topic_name("input");
+    latency_hop_publisher_ = std::make_unique<latency_aggregator::LatencyHopPublisher>(
+      this, pub_output_->get_topic_name());
   }
 
   subscribe(filter_name);
@@ -125,7 +128,7 @@ void pointcloud_preprocessor::Filter::subscribe(const std::string & filter_name)
   // each time a child class supports the faster version.
   // When all the child classes support the faster version, this workaround is deleted.
   std::set<std::string> supported_nodes = {
-    "CropBoxFilter", "RingOutlierFilter", "VoxelGridDownsampleFilter"};
+    "CropBoxFilter", "RingOutlierFilter", "VoxelGridDownsampleFilter", "FusedFilter"};
   auto callback = supported_nodes.find(filter_name) != supported_nodes.end()
                     ? &Filter::faster_input_indices_callback
                     : &Filter::input_indices_callback;
@@ -178,7 +181,8 @@ void pointcloud_preprocessor::Filter::unsubscribe()
 // TODO(sykwer): Temporary Implementation: Delete this function definition when all the filter nodes
 // conform to new API.
 void pointcloud_preprocessor::Filter::computePublish(
-  const PointCloud2ConstPtr & input, const IndicesPtr & indices)
+  const PointCloud2ConstPtr & input, const IndicesPtr & indices,
+  const latency_aggregator::LatencyHopInput & hop_input)
 {
   auto output = std::make_unique<PointCloud2>();
 
@@ -192,6 +196,7 @@ void pointcloud_preprocessor::Filter::computePublish(
 
   // Publish a boost shared ptr
   pub_output_->publish(std::move(output));
+  latency_hop_publisher_->publish(hop_input, input->header.stamp);
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////
@@ -220,6 +225,9 @@ rcl_interfaces::msg::SetParametersResult pointcloud_preprocessor::Filter::filter
 void pointcloud_preprocessor::Filter::input_indices_callback(
   const PointCloud2ConstPtr cloud, const PointIndicesConstPtr indices)
 {
+  const auto hop_input =
+    latency_hop_publisher_->createInput(input_topic_name_, cloud->header.stamp);
+
   // If cloud is given, check if it's valid
   if (!isValid(cloud)) {
     RCLCPP_ERROR(this->get_logger(), "[input_indices_callback] Invalid input!");
@@ -288,7 +296,7 @@ void pointcloud_preprocessor::Filter::input_indices_callback(
     vindices.reset(new std::vector<int>(indices->indices));
   }
 
-  computePublish(cloud_tf, vindices);
+  computePublish(cloud_tf, vindices, hop_input);
 }
 
 // For performance reason, we get only a transformation matrix here.
@@ -354,6 +362,16 @@ bool pointcloud_preprocessor::Filter::calculate_transform_matrix(
   return true;
 }
 
+bool pointcloud_preprocessor::Filter::is_output_conversion_required(
+  const PointCloud2 & output) const
+{
+  // Same conditions as in convert_output_costly()
+  if (!tf_output_frame_.empty()) {
+    return output.header.frame_id != tf_output_frame_;
+  }
+  return output.header.frame_id != tf_input_orig_frame_;
+}
+
 // Returns false in error cases
 bool pointcloud_preprocessor::Filter::convert_output_costly(std::unique_ptr<PointCloud2> & output)
 {
@@ -406,6 +424,9 @@ bool pointcloud_preprocessor::Filter::convert_output_costly(std::unique_ptr<Poin
 void pointcloud_preprocessor::Filter::faster_input_indices_callback(
   const PointCloud2ConstPtr cloud, const PointIndicesConstPtr indices)
 {
+  const auto hop_input =
+    latency_hop_publisher_->createInput(input_topic_name_, cloud->header.stamp);
+
   if (!isValid(cloud)) {
     RCLCPP_ERROR(this->get_logger(), "[input_indices_callback] Invalid input!");
     return;
@@ -447,15 +468,49 @@ void pointcloud_preprocessor::Filter::faster_input_indices_callback(
     vindices.reset(new std::vector<int>(indices->indices));
   }
 
-  auto output = std::make_unique<PointCloud2>();
-
-  // TODO(sykwer): Change to `filter()` call after when the filter nodes conform to new API.
-  faster_filter(cloud, vindices, *output, transform_info);
+  std::unique_ptr<PointCloud2> output;
+
+  // TODO(sykwer): Change to `filter()` calls after when the filter nodes conform to new API.
+  if (pub_output_->can_loan_messages()) {
+    // The middleware provides the output memory, the output is published without copy
+    auto loaned_output = pub_output_->borrow_loaned_message();
+    faster_filter(cloud, vindices, loaned_output.get(), transform_info);
+    if (!is_output_conversion_required(loaned_output.get())) {
+      loaned_output.get().header.stamp = cloud->header.stamp;
+      pub_output_->publish(std::move(loaned_output));
+      latency_hop_publisher_->publish(hop_input, cloud->header.stamp);
+      return;
+    }
+    output = std::make_unique<PointCloud2>(std::move(loaned_output.get()));
+  } else if (!get_node_options().use_intra_process_comms()) {
+    // Without intra-process communication, the output is serialized by publish() so it can be
+    // written in the same buffer at each callback. Its metadata is reset but the data capacity is
+    // kept.
+    auto data = std::move(output_buffer_.data);
+    data.clear();
+    output_buffer_ = PointCloud2();
+    output_buffer_.data = std::move(data);
+    output_buffer_.data.reserve(cloud->data.size());
+
+    faster_filter(cloud, vindices, output_buffer_, transform_info);
+    if (!is_output_conversion_required(output_buffer_)) {
+      output_buffer_.header.stamp = cloud->header.stamp;
+      pub_output_->publish(output_buffer_);
+      latency_hop_publisher_->publish(hop_input, cloud->header.stamp);
+      return;
+    }
+    output = std::make_unique<PointCloud2>(std::move(output_buffer_));
+  } else {
+    // The ownership of the output is given to the intra-process subscriptions
+    output = std::make_unique<PointCloud2>();
+    faster_filter(cloud, vindices, *output, transform_info);
+  }
 
   if (!convert_output_costly(output)) return;
 
   output->header.stamp = cloud->header.stamp;
   pub_output_->publish(std::move(output));
+  latency_hop_publisher_->publish(hop_input, cloud->header.stamp);
 }
 
 // TODO(sykwer): Temporary Implementation: Remove this interface when all the filter nodes conform
@@ -0,0 +1,328 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pointcloud_preprocessor/fused_filter/fused_filter_nodelet.hpp"
+
+#include <autoware_point_types/types.hpp>
+
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace pointcloud_preprocessor
+{
+using autoware_point_types::PointXYZI;
+
+FusedFilterComponent::FusedFilterComponent(const rclcpp::NodeOptions & options)
+: Filter("FusedFilter", options)
+{
+  // initialize debug tool
+  {
+    using tier4_autoware_utils::DebugPublisher;
+    using tier4_autoware_utils::StopWatch;
+    stop_watch_ptr_ = std::make_unique<StopWatch<std::chrono::milliseconds>>();
+    debug_publisher_ = std::make_unique<DebugPublisher>(this, "fused_filter");
+    stop_watch_ptr_->tic("cyclic_time");
+    stop_watch_ptr_->tic("processing_time");
+  }
+
+  // set initial parameters
+  {
+    const auto stage_names = declare_parameter(
+      "stages", std::vector<std::string>{"crop_box", "ring_outlier", "voxel_grid"});
+    for (const auto & stage_name : stage_names) {
+      if (!stages_.empty() && stages_.back().type == StageType::VoxelGrid) {
+        throw std::invalid_argument("The voxel_grid stage must be the last stage");
+      }
+      stages_.push_back(declareStage(stage_name));
+    }
+  }
+}
+
+FusedFilterComponent::Stage FusedFilterComponent::declareStage(const std::string & name)
+{
+  // the parameters of a stage are the ones of the corresponding filter node, prefixed by its name
+  const auto param = [&](const std::string & param_name, const auto default_value) {
+    return declare_parameter(name + "." + param_name, default_value);
+  };
+
+  Stage stage;
+  stage.name = name;
+  const auto type = param("type", name);
+  if (type == "crop_box") {
+    stage.type = StageType::CropBox;
+    auto & p = stage.crop_box_param;
+    p.min_x = static_cast<float>(param("min_x", -1.0));
+    p.min_y = static_cast<float>(param("min_y", -1.0));
+    p.min_z = static_cast<float>(param("min_z", -1.0));
+    p.max_x = static_cast<float>(param("max_x", 1.0));
+    p.max_y = static_cast<float>(param("max_y", 1.0));
+    p.max_z = static_cast<float>(param("max_z", 1.0));
+    p.negative = static_cast<bool>(param("negative", false));
+  } else if (type == "ring_outlier") {
+    stage.type = StageType::RingOutlier;
+    auto & p = stage.ring_outlier_param;
+    p.distance_ratio = static_cast<double>(param("distance_ratio", 1.03));
+    p.object_length_threshold = static_cast<double>(param("object_length_threshold", 0.1));
+    p.num_points_threshold = static_cast<int>(param("num_points_threshold", 4));
+    p.max_rings_num = static_cast<uint16_t>(param("max_rings_num", 128));
+  } else if (type == "voxel_grid") {
+    stage.type = StageType::VoxelGrid;
+    voxel_filter_ = std::make_unique<FasterVoxelGridDownsampleFilter>();
+    voxel_filter_->set_voxel_size(
+      static_cast<float>(param("voxel_size_x", 0.3)),
+      static_cast<float>(param("voxel_size_y", 0.3)),
+      static_cast<float>(param("voxel_size_z", 0.1)));
+    voxel_filter_->set_num_threads(static_cast<size_t>(std::max(param("num_threads", 1), 1)));
+  } else {
+    throw std::invalid_argument("Unknown type " + type + " of the stage " + name);
+  }
+  return stage;
+}
+
+void FusedFilterComponent::filter(
+  const PointCloud2ConstPtr & input, [[maybe_unused]] const IndicesPtr & indices,
+  PointCloud2 & output)
+{
+  (void)input;
+  (void)indices;
+  (void)output;
+}
+
+int FusedFilterComponent::cropBox(const CropBoxParam & param)
+{
+  int skipped_count = 0;
+  size_t nb_kept = 0;
+  for (size_t i = 0; i < point_indices_.size(); ++i) {
+    const auto & xyz = point_xyzs_[i];
+    if (!std::isfinite(xyz[0]) || !std::isfinite(xyz[1]) || !std::isfinite(xyz[2])) {
+      skipped_count++;
+      continue;
+    }
+    if (param.isKept(Eigen::Vector4f(xyz[0], xyz[1], xyz[2], 1))) {
+      point_indices_[nb_kept] = point_indices_[i];
+      point_xyzs_[nb_kept] = xyz;
+      ++nb_kept;
+    }
+  }
+  point_indices_.resize(nb_kept);
+  point_xyzs_.resize(nb_kept);
+  return skipped_count;
+}
+
+void FusedFilterComponent::keepClassifiedPoints()
+{
+  size_t nb_kept = 0;
+  for (size_t i = 0; i < point_indices_.size(); ++i) {
+    if (is_kept_[i]) {
+      point_indices_[nb_kept] = point_indices_[i];
+      point_xyzs_[nb_kept] = point_xyzs_[i];
+      ++nb_kept;
+    }
+  }
+  point_indices_.resize(nb_kept);
+  point_xyzs_.resize(nb_kept);
+}
+
+void FusedFilterComponent::faster_filter(
+  const PointCloud2ConstPtr & input, const IndicesPtr & indices, PointCloud2 & output,
+  const TransformInfo & transform_info)
+{
+  std::scoped_lock lock(mutex_);
+  stop_watch_ptr_->toc("processing_time", true);
+
+  if (indices) {
+    RCLCPP_WARN_THROTTLE(
+      get_logger(), *get_clock(), 1000, "Indices are not supported and will be ignored");
+  }
+
+  const size_t x_offset = input->fields[pcl::getFieldIndex(*input, "x")].offset;
+  const size_t y_offset = input->fields[pcl::getFieldIndex(*input, "y")].offset;
+  const size_t z_offset = input->fields[pcl::getFieldIndex(*input, "z")].offset;
+  const auto point_data = [&](const uint32_t point_index) {
+    return &input->data[static_cast<size_t>(point_index) * input->point_step];
+  };
+
+  // The attributes used by the ring outlier filter must be present in the input
+  const bool has_ring_outlier_stage =
+    std::any_of(stages_.begin(), stages_.end(), [](const Stage & stage) {
+      return stage.type == StageType::RingOutlier;
+    });
+  RingOutlierFieldOffsets ring_outlier_offsets{};
+  size_t intensity_offset{};
+  if (has_ring_outlier_stage) {
+    auto getFieldOffsetSafely = [&](
+                                  const std::string & field_name,
+                                  const pcl::PCLPointField::PointFieldTypes expected_type,
+                                  size_t & offset) {
+      const auto field_index = pcl::getFieldIndex(*input, field_name);
+      if (field_index == -1) {
+        RCLCPP_ERROR(get_logger(), "Field %s not found in input point cloud", field_name.c_str());
+        return false;
+      }
+      const auto & field = input->fields.at(field_index);
+      if (field.datatype != expected_type) {
+        RCLCPP_ERROR(
+          get_logger(), "Field %s has unexpected type %d (expected %d)", field_name.c_str(),
+          field.datatype, expected_type);
+        return false;
+      }
+      offset = field.offset;
+      return true;
+    };
+    if (
+      !getFieldOffsetSafely("ring", pcl::PCLPointField::UINT16, ring_outlier_offsets.ring) ||
+      !getFieldOffsetSafely("azimuth", pcl::PCLPointField::FLOAT32, ring_outlier_offsets.azimuth) ||
+      !getFieldOffsetSafely(
+        "distance", pcl::PCLPointField::FLOAT32, ring_outlier_offsets.distance) ||
+      !getFieldOffsetSafely("intensity", pcl::PCLPointField::FLOAT32, intensity_offset)) {
+      RCLCPP_ERROR(get_logger(), "One or more required fields are missing in input point cloud");
+      return;
+    }
+  }
+
+  // Points are transformed once to the input frame, like the first filter of the chain does
+  const size_t nb_points = input->width * input->height;
+  point_indices_.resize(nb_points);
+  point_xyzs_.resize(nb_points);
+  for (uint32_t i = 0; i < nb_points; ++i) {
+    const auto * raw_p = point_data(i);
+    Eigen::Vector4f point;
+    std::memcpy(&point[0], &raw_p[x_offset], sizeof(float));
+    std::memcpy(&point[1], &raw_p[y_offset], sizeof(float));
+    std::memcpy(&point[2], &raw_p[z_offset], sizeof(float));
+    point[3] = 1;
+    if (transform_info.need_transform) {
+      point = transform_info.eigen_transform * point;
+    }
+    point_indices_[i] = i;
+    point_xyzs_[i] = point.head<3>();
+  }
+
+  // The ring outlier filter outputs PointXYZI points, and so are the next stages
+  bool has_xyzi_layout = false;
+  bool is_downsampled = false;
+  for (const auto & stage : stages_) {
+    switch (stage.type) {
+      case StageType::CropBox: {
+        const int skipped_count = cropBox(stage.crop_box_param);
+        if (skipped_count > 0) {
+          RCLCPP_WARN_THROTTLE(
+            get_logger(), *get_clock(), 1000,
+            "%d points contained NaN values and have been ignored by %s", skipped_count,
+            stage.name.c_str());
+        }
+        break;
+      }
+      case StageType::RingOutlier: {
+        const int invalid_ring_count = classifyRingOutliers(
+          stage.ring_outlier_param, ring_outlier_offsets, input->data.data(), input->point_step,
+          point_indices_, is_kept_);
+        keepClassifiedPoints();
+        has_xyzi_layout = true;
+        if (invalid_ring_count > 0) {
+          RCLCPP_WARN(
+            get_logger(), "%d points had ring index over max_rings_num (%d) and have been ignored.",
+            invalid_ring_count, stage.ring_outlier_param.max_rings_num);
+        }
+        break;
+      }
+      case StageType::VoxelGrid: {
+        if (has_xyzi_layout) {
+          voxel_filter_->set_field_offsets(
+            offsetof(PointXYZI, x), offsetof(PointXYZI, y), offsetof(PointXYZI, z),
+            offsetof(PointXYZI, intensity));
+          output.point_step = sizeof(PointXYZI);
+        } else {
+          voxel_filter_->set_field_offsets(input);
+          output.point_step = input->point_step;
+        }
+        output.is_bigendian = input->is_bigendian;
+        // the points are already in the input frame
+        is_downsampled =
+          voxel_filter_->filter_points(point_xyzs_, output, TransformInfo{}, get_logger());
+        break;
+      }
+    }
+  }
+
+  // Write the remaining points with the layout of the last stage
+  if (!is_downsampled && has_xyzi_layout) {
+    output.point_step = sizeof(PointXYZI);
+    output.data.resize(point_indices_.size() * output.point_step);
+    for (size_t i = 0; i < point_indices_.size(); ++i) {
+      PointXYZI out_point;
+      out_point.x = point_xyzs_[i][0];
+      out_point.y = point_xyzs_[i][1];
+      out_point.z = point_xyzs_[i][2];
+      std::memcpy(
+        &out_point.intensity, &point_data(point_indices_[i])[intensity_offset],
+        sizeof(out_point.intensity));
+      std::memcpy(&output.data[i * output.point_step], &out_point, sizeof(PointXYZI));
+    }
+    output.height = 1;
+    output.width = static_cast<uint32_t>(point_indices_.size());
+    output.is_bigendian = input->is_bigendian;
+    output.is_dense = input->is_dense;
+
+    sensor_msgs::PointCloud2Modifier pcd_modifier(output);
+    constexpr int num_fields = 4;
+    pcd_modifier.setPointCloud2Fields(
+      num_fields, "x", 1, sensor_msgs::msg::PointField::FLOAT32, "y", 1,
+      sensor_msgs::msg::PointField::FLOAT32, "z", 1, sensor_msgs::msg::PointField::FLOAT32,
+      "intensity", 1, sensor_msgs::msg::PointField::FLOAT32);
+  } else if (!is_downsampled) {
+    output.point_step = input->point_step;
+    output.data.resize(point_indices_.size() * output.point_step);
+    for (size_t i = 0; i < point_indices_.size(); ++i) {
+      auto * out_p = &output.data[i * output.point_step];
+      std::memcpy(out_p, point_data(point_indices_[i]), input->point_step);
+      if (transform_info.need_transform) {
+        std::memcpy(&out_p[x_offset], &point_xyzs_[i][0], sizeof(float));
+        std::memcpy(&out_p[y_offset], &point_xyzs_[i][1], sizeof(float));
+        std::memcpy(&out_p[z_offset], &point_xyzs_[i][2], sizeof(float));
+      }
+    }
+    output.height = 1;
+    output.width = static_cast<uint32_t>(point_indices_.size());
+    output.row_step = static_cast<uint32_t>(output.data.size());
+    output.fields = input->fields;
+    output.is_bigendian = input->is_bigendian;
+    output.is_dense = input->is_dense;
+  }
+
+  // Note that `input->header.frame_id` is data before converted when `transform_info.need_transform
+  // == true`
+  output.header.frame_id = !tf_input_frame_.empty() ? tf_input_frame_ : tf_input_orig_frame_;
+
+  // add processing time for debug
+  if (debug_publisher_) {
+    const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
+    const double processing_time_ms = stop_watch_ptr_->toc("processing_time", true);
+    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/cyclic_time_ms", cyclic_time_ms);
+    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/processing_time_ms", processing_time_ms);
+  }
+}
+}  // namespace pointcloud_preprocessor
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(pointcloud_preprocessor::FusedFilterComponent)
@@ -14,6 +14,7 @@
 
 #include "pointcloud_preprocessor/outlier_filter/ring_outlier_filter_nodelet.hpp"
 
+#include "pointcloud_preprocessor/outlier_filter/ring_outlier_filter.hpp"
 #include "pointcloud_preprocessor/utility/utilities.hpp"
 
 #include <range/v3/view/chunk.hpp>
@@ -102,179 +103,22 @@ void RingOutlierFilterComponent::faster_filter(
     return;
   }
 
-  // The initial implementation of ring outlier filter looked like this:
-  //   1. Iterate over the input cloud and group point indices by ring
-  //   2. For each ring:
-  //   2.1. iterate over the ring points, and group points belonging to the same "walk"
-  //   2.2. when a walk is closed, copy indexed points to the output cloud if the walk is long
-  //   enough.
-  //
-  // Because LIDAR data is naturally "azimuth-major order" and not "ring-major order", such
-  // implementation is not cache friendly at all, and has negative impact on all the other nodes.
-  //
-  // To tackle this issue, the algorithm has been rewritten so that points would be accessed in
-  // order. To do so, all rings are being processing simultaneously instead of separately. The
-  // overall logic is still the same.
-
-  // ad-hoc struct to store finished walks information (for isCluster())
-  struct WalkInfo
-  {
-    size_t id;
-    int num_points;
-    float first_point_distance;
-    float first_point_azimuth;
-    float last_point_distance;
-    float last_point_azimuth;
-  };
-
-  // ad-hoc struct to keep track of each ring current walk
-  struct RingWalkInfo
-  {
-    WalkInfo first_walk;
-    WalkInfo current_walk;
-  };
-
-  // helper functions
-
-  // check if walk is a valid cluster
-  const float object_length_threshold2 = object_length_threshold_ * object_length_threshold_;
-  auto isCluster = [=](const WalkInfo & walk_info) {
-    // A cluster is a walk which has many points or is long enough
-    if (walk_info.num_points > num_points_threshold_) return true;
-
-    // Using the law of cosines, the distance between 2 points can be written as:
-    //   |p2-p1|^2 = d1^2 + d2^2 - 2*d1*d2*cos(a)
-    // where d1 and d2 are the distance attribute of p1 and p2, and 'a' the azimuth diff between
-    // the 2 points.
-    const float dist2 =
-      walk_info.first_point_distance * walk_info.first_point_distance +
-      walk_info.last_point_distance * walk_info.last_point_distance -
-      2 * walk_info.first_point_distance * walk_info.last_point_distance *
-        std::cos((walk_info.last_point_azimuth - walk_info.first_point_azimuth) * (M_PI / 18000.0));
-    return dist2 > object_length_threshold2;
-  };
-
-  // check if 2 points belong to the same walk
-  auto isSameWalk =
-    [=](float curr_distance, float curr_azimuth, float prev_distance, float prev_azimuth) {
-      float azimuth_diff = curr_azimuth - prev_azimuth;
-      azimuth_diff = azimuth_diff < 0.f ? azimuth_diff + 36000.f : azimuth_diff;
-      return std::max(curr_distance, prev_distance) <
-               std::min(curr_distance, prev_distance) * distance_ratio_ &&
-             azimuth_diff < 100.f;
-    };
-
-  // tmp vectors to keep track of walk/ring state while processing points in order (cache efficient)
-  std::vector<RingWalkInfo> rings;     // info for each LiDAR ring
-  std::vector<size_t> points_walk_id;  // for each input point, the walk index associated with it
-  std::vector<bool>
-    walks_cluster_status;  // for each generated walk, stores whether it is a cluster
-
-  size_t latest_walk_id = -1UL;  // ID given to the latest walk created
-
-  // initialize each ring with two empty walks (first and current walk)
-  rings.resize(max_rings_num_, RingWalkInfo{{-1UL, 0, 0, 0, 0, 0}, {-1UL, 0, 0, 0, 0, 0}});
-  // points are initially associated to no walk (-1UL)
-  points_walk_id.resize(input->width * input->height, -1UL);
-  walks_cluster_status.reserve(
-    max_rings_num_ * 2);  // In the worst case, this could grow to the number of input points
-
-  int invalid_ring_count = 0;
-
-  // Build walks and classify points
-  for (const auto & [raw_p, point_walk_id] :
-       ranges::views::zip(input->data | ranges::views::chunk(input->point_step), points_walk_id)) {
-    uint16_t ring_idx{};
-    float curr_azimuth{};
-    float curr_distance{};
-    std::memcpy(&ring_idx, &raw_p.data()[ring_offset], sizeof(ring_idx));
-    std::memcpy(&curr_azimuth, &raw_p.data()[azimuth_offset], sizeof(curr_azimuth));
-    std::memcpy(&curr_distance, &raw_p.data()[distance_offset], sizeof(curr_distance));
-
-    if (ring_idx >= max_rings_num_) {
-      // Either the data is corrupted or max_rings_num_ is not set correctly
-      // Note: point_walk_id == -1 so the point will be filtered out
-      ++invalid_ring_count;
-      continue;
-    }
-
-    auto & ring = rings[ring_idx];
-    if (ring.current_walk.id == -1UL) {
-      // first walk ever for this ring. It is both the first and current walk of the ring.
-      ring.first_walk =
-        WalkInfo{++latest_walk_id, 1, curr_distance, curr_azimuth, curr_distance, curr_azimuth};
-      ring.current_walk = ring.first_walk;
-      point_walk_id = latest_walk_id;
-      continue;
-    }
-
-    auto & walk = ring.current_walk;
-    if (isSameWalk(
-          curr_distance, curr_azimuth, walk.last_point_distance, walk.last_point_azimuth)) {
-      // current point is part of previous walk
-      walk.num_points += 1;
-      walk.last_point_distance = curr_distance;
-      walk.last_point_azimuth = curr_azimuth;
-      point_walk_id = walk.id;
-    } else {
-      // previous walk is finished, start a new one
-
-      // check and store whether the previous walks is a cluster
-      if (walk.id >= walks_cluster_status.size()) walks_cluster_status.resize(walk.id + 1, false);
-      walks_cluster_status.at(walk.id) = isCluster(walk);
-
-      ring.current_walk =
-        WalkInfo{++latest_walk_id, 1, curr_distance, curr_azimuth, curr_distance, curr_azimuth};
-      point_walk_id = latest_walk_id;
-    }
-  }
-
-  // So far, we have processed ring points as if rings were not circular. Of course, the last and
-  // first points of a ring could totally be part of the same walk. When such thing happens, we need
-  // to merge the two walks
-  for (auto & ring : rings) {
-    if (ring.current_walk.id == -1UL) {
-      continue;
-    }
-
-    const auto & walk = ring.current_walk;
-    if (walk.id >= walks_cluster_status.size()) walks_cluster_status.resize(walk.id + 1, false);
-    walks_cluster_status.at(walk.id) = isCluster(walk);
-
-    if (ring.first_walk.id == ring.current_walk.id) {
-      continue;
-    }
-
-    auto & first_walk = ring.first_walk;
-    auto & last_walk = ring.current_walk;
-
-    // check if the two walks are connected
-    if (isSameWalk(
-          first_walk.first_point_distance, first_walk.first_point_azimuth,
-          last_walk.last_point_distance, last_walk.last_point_azimuth)) {
-      // merge
-      auto combined_num_points = first_walk.num_points + last_walk.num_points;
-      first_walk.first_point_distance = last_walk.first_point_distance;
-      first_walk.first_point_azimuth = last_walk.first_point_azimuth;
-      first_walk.num_points = combined_num_points;
-      last_walk.last_point_distance = first_walk.last_point_distance;
-      last_walk.last_point_azimuth = first_walk.last_point_azimuth;
-      last_walk.num_points = combined_num_points;
-
-      walks_cluster_status.at(first_walk.id) = isCluster(first_walk);
-      walks_cluster_status.at(last_walk.id) = isCluster(last_walk);
-    }
-  }
+  std::vector<bool> is_kept;
+  const int invalid_ring_count = classifyRingOutliers(
+    RingOutlierFilterParam{
+      distance_ratio_, object_length_threshold_, num_points_threshold_, max_rings_num_},
+    RingOutlierFieldOffsets{ring_offset, azimuth_offset, distance_offset}, input->data.data(),
+    input->point_step, input->width * input->height, is_kept);
 
   // finally copy points
   output.point_step = sizeof(PointXYZI);
   output.data.resize(output.point_step * input->width * input->height);
   size_t output_size = 0;
   if (transform_info.need_transform) {
-    for (const auto & [raw_p, point_walk_id] : ranges::views::zip(
-           input->data | ranges::views::chunk(input->point_step), points_walk_id)) {
+    for (const auto & [raw_p, point_is_kept] : ranges::views::zip(
+           input->data | ranges::views::chunk(input->point_step), is_kept)) {
       // Filter out points on invalid rings and points not in a cluster
-      if (point_walk_id == -1UL || !walks_cluster_status.at(point_walk_id)) {
+      if (!point_is_kept) {
         continue;
       }
 
@@ -295,10 +139,10 @@ void RingOutlierFilterComponent::faster_filter(
       output_size += sizeof(PointXYZI);
     }
   } else {
-    for (const auto & [raw_p, point_walk_id] : ranges::views::zip(
-           input->data | ranges::views::chunk(input->point_step), points_walk_id)) {
+    for (const auto & [raw_p, point_is_kept] : ranges::views::zip(
+           input->data | ranges::views::chunk(input->point_step), is_kept)) {
       // Filter out points on invalid rings and points not in a cluster
-      if (point_walk_id == -1UL || !walks_cluster_status.at(point_walk_id)) {
+      if (!point_is_kept) {
         continue;
       }
 
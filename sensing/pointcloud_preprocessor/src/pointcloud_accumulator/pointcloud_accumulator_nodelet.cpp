@@ -14,6 +14,10 @@
 
 #include "pointcloud_preprocessor/pointcloud_accumulator/pointcloud_accumulator_nodelet.hpp"
 
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <cstring>
+#include <utility>
 #include <vector>
 
 namespace pointcloud_preprocessor
@@ -26,6 +30,9 @@ PointcloudAccumulatorComponent::PointcloudAccumulatorComponent(const rclcpp::Nod
     accumulation_time_sec_ = static_cast<double>(declare_parameter("accumulation_time_sec", 2.0));
     pointcloud_buffer_.set_capacity(
       static_cast<size_t>(declare_parameter("pointcloud_buffer_size", 50)));
+    incremental_accumulation_ =
+      static_cast<bool>(declare_parameter("incremental_accumulation", false));
+    point_slabs_.set_capacity(pointcloud_buffer_.capacity());
   }
 
   using std::placeholders::_1;
@@ -40,6 +47,10 @@ void PointcloudAccumulatorComponent::filter(
   if (indices) {
     RCLCPP_WARN(get_logger(), "Indices are not supported and will be ignored");
   }
+  if (incremental_accumulation_) {
+    filterIncrementally(input, output);
+    return;
+  }
   pointcloud_buffer_.push_front(input);
   rclcpp::Time last_time = input->header.stamp;
   pcl::PointCloud<pcl::PointXYZ> pcl_input;
@@ -55,6 +66,63 @@ void PointcloudAccumulatorComponent::filter(
   output.header = input->header;
 }
 
+void PointcloudAccumulatorComponent::filterIncrementally(
+  const PointCloud2ConstPtr & input, PointCloud2 & output)
+{
+  // convert only the new cloud, reusing the memory of the oldest slab
+  PointSlab slab;
+  if (point_slabs_.full() && !point_slabs_.empty()) {
+    slab = std::move(point_slabs_.back());
+    point_slabs_.pop_back();
+  }
+  const size_t num_points = static_cast<size_t>(input->width) * input->height;
+  slab.stamp = input->header.stamp;
+  slab.is_dense = input->is_dense;
+  slab.data.resize(num_points * sizeof(pcl::PointXYZ));
+  if (num_points > 0) {
+    auto * points = reinterpret_cast<pcl::PointXYZ *>(slab.data.data());
+    sensor_msgs::PointCloud2ConstIterator<float> iter_x(*input, "x");
+    sensor_msgs::PointCloud2ConstIterator<float> iter_y(*input, "y");
+    sensor_msgs::PointCloud2ConstIterator<float> iter_z(*input, "z");
+    for (size_t i = 0; i < num_points; ++i, ++iter_x, ++iter_y, ++iter_z) {
+      points[i] = pcl::PointXYZ(*iter_x, *iter_y, *iter_z);
+    }
+  }
+  point_slabs_.push_front(std::move(slab));
+
+  // the same layout as pcl::toROSMsg() of pcl::PointCloud<pcl::PointXYZ>
+  const rclcpp::Time last_time = input->header.stamp;
+  size_t num_slabs = 0;
+  size_t data_size = 0;
+  bool is_dense = true;
+  for (const auto & point_slab : point_slabs_) {
+    if (accumulation_time_sec_ < (last_time - point_slab.stamp).seconds()) {
+      break;
+    }
+    ++num_slabs;
+    data_size += point_slab.data.size();
+    is_dense = is_dense && point_slab.is_dense;
+  }
+
+  sensor_msgs::PointCloud2Modifier modifier(output);
+  modifier.setPointCloud2FieldsByString(1, "xyz");
+  output.header = input->header;
+  output.height = 1;
+  output.width = static_cast<uint32_t>(data_size / output.point_step);
+  output.row_step = output.width * output.point_step;
+  output.is_bigendian = false;
+  output.is_dense = is_dense;
+  output.data.resize(data_size);
+  size_t offset = 0;
+  for (size_t i = 0; i < num_slabs; ++i) {
+    const auto & data = point_slabs_[i].data;
+    if (!data.empty()) {
+      std::memcpy(output.data.data() + offset, data.data(), data.size());
+    }
+    offset += data.size();
+  }
+}
+
 rcl_interfaces::msg::SetParametersResult PointcloudAccumulatorComponent::paramCallback(
   const std::vector<rclcpp::Parameter> & p)
 {
@@ -66,6 +134,7 @@ rcl_interfaces::msg::SetParametersResult PointcloudAccumulatorComponent::paramCa
   int pointcloud_buffer_size;
   if (get_param(p, "pointcloud_buffer_size", pointcloud_buffer_size)) {
     pointcloud_buffer_.set_capacity((size_t)pointcloud_buffer_size);
+    point_slabs_.set_capacity((size_t)pointcloud_buffer_size);
     RCLCPP_DEBUG(get_logger(), "Setting new buffer size to: %d.", pointcloud_buffer_size);
   }
 
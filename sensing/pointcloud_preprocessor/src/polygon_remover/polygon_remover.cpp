@@ -14,6 +14,8 @@
 
 #include "pointcloud_preprocessor/polygon_remover/polygon_remover.hpp"
 
+#include <algorithm>
+
 namespace pointcloud_preprocessor
 {
 PolygonRemoverComponent::PolygonRemoverComponent(const rclcpp::NodeOptions & options)
@@ -25,6 +27,7 @@ PolygonRemoverComponent::PolygonRemoverComponent(const rclcpp::NodeOptions & opt
   this->get_parameter("polygon_vertices", param);
   this->declare_parameter<bool>("will_visualize");
   this->get_parameter("will_visualize", will_visualize_);
+  mask_resolution_ = this->declare_parameter<double>("mask_resolution", 0.0);
   polygon_vertices_ = param.as_double_array();
   if (polygon_vertices_.size() % 2 != 0) {
     throw std::length_error(
@@ -71,6 +74,19 @@ void PolygonRemoverComponent::update_polygon(
   const geometry_msgs::msg::Polygon::ConstSharedPtr & polygon_in)
 {
   pointcloud_preprocessor::utils::to_cgal_polygon(*polygon_in, polygon_cgal_);
+  if (mask_resolution_ > 0.0) {
+    // the polygon is fixed in the cloud frame, so the mask only has to cover its bounding box
+    const auto [min_x, max_x] = std::minmax_element(
+      polygon_cgal_.cbegin(), polygon_cgal_.cend(),
+      [](const PointCgal & a, const PointCgal & b) { return a.x() < b.x(); });
+    const auto [min_y, max_y] = std::minmax_element(
+      polygon_cgal_.cbegin(), polygon_cgal_.cend(),
+      [](const PointCgal & a, const PointCgal & b) { return a.y() < b.y(); });
+    polygon_mask_.build(
+      {polygon_cgal_}, CGAL::to_double(min_x->x()), CGAL::to_double(min_y->y()),
+      CGAL::to_double(max_x->x()) + mask_resolution_,
+      CGAL::to_double(max_y->y()) + mask_resolution_, mask_resolution_);
+  }
   if (will_visualize_) {
     marker_.ns = "";
     marker_.id = 0;
@@ -132,6 +148,11 @@ sensor_msgs::msg::PointCloud2 PolygonRemoverComponent::remove_updated_polygon_fr
   }
 
   PointCloud2 cloud_out;
+  if (polygon_mask_.is_built()) {
+    pointcloud_preprocessor::utils::remove_polygon_mask_from_cloud(
+      *cloud_in, polygon_mask_, cloud_out);
+    return cloud_out;
+  }
   pointcloud_preprocessor::utils::remove_polygon_cgal_from_cloud(
     *cloud_in, polygon_cgal_, cloud_out);
   return cloud_out;
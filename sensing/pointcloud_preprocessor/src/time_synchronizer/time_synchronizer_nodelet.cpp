@@ -130,6 +130,7 @@ PointCloudDataSynchronizerComponent::PointCloudDataSynchronizerComponent(
     }
 
     // Subscribe to the twist
+    twist_queue_.set_capacity(twist_queue_capacity_);
     if (input_twist_topic_type_ == "twist") {
       auto twist_cb = std::bind(
         &PointCloudDataSynchronizerComponent::twist_callback, this, std::placeholders::_1);
@@ -211,34 +212,32 @@ Eigen::Matrix4f PointCloudDataSynchronizerComponent::computeTransformToAdjustFor
   const rclcpp::Time & old_stamp, const rclcpp::Time & new_stamp)
 {
   // return identity if no twist is available or old_stamp is newer than new_stamp
-  if (twist_ptr_queue_.empty() || old_stamp > new_stamp) {
+  if (twist_queue_.empty() || old_stamp > new_stamp) {
     return Eigen::Matrix4f::Identity();
   }
 
-  auto old_twist_ptr_it = std::lower_bound(
-    std::begin(twist_ptr_queue_), std::end(twist_ptr_queue_), old_stamp,
-    [](const geometry_msgs::msg::TwistStamped::ConstSharedPtr & x_ptr, const rclcpp::Time & t) {
-      return rclcpp::Time(x_ptr->header.stamp) < t;
+  auto old_twist_it = std::lower_bound(
+    std::begin(twist_queue_), std::end(twist_queue_), old_stamp,
+    [](const geometry_msgs::msg::TwistStamped & x, const rclcpp::Time & t) {
+      return rclcpp::Time(x.header.stamp) < t;
     });
-  old_twist_ptr_it =
-    old_twist_ptr_it == twist_ptr_queue_.end() ? (twist_ptr_queue_.end() - 1) : old_twist_ptr_it;
+  old_twist_it = old_twist_it == twist_queue_.end() ? (twist_queue_.end() - 1) : old_twist_it;
 
-  auto new_twist_ptr_it = std::lower_bound(
-    std::begin(twist_ptr_queue_), std::end(twist_ptr_queue_), new_stamp,
-    [](const geometry_msgs::msg::TwistStamped::ConstSharedPtr & x_ptr, const rclcpp::Time & t) {
-      return rclcpp::Time(x_ptr->header.stamp) < t;
+  auto new_twist_it = std::lower_bound(
+    std::begin(twist_queue_), std::end(twist_queue_), new_stamp,
+    [](const geometry_msgs::msg::TwistStamped & x, const rclcpp::Time & t) {
+      return rclcpp::Time(x.header.stamp) < t;
     });
-  new_twist_ptr_it =
-    new_twist_ptr_it == twist_ptr_queue_.end() ? (twist_ptr_queue_.end() - 1) : new_twist_ptr_it;
+  new_twist_it = new_twist_it == twist_queue_.end() ? (twist_queue_.end() - 1) : new_twist_it;
 
   auto prev_time = old_stamp;
   double x = 0.0;
   double y = 0.0;
   double yaw = 0.0;
-  for (auto twist_ptr_it = old_twist_ptr_it; twist_ptr_it != new_twist_ptr_it + 1; ++twist_ptr_it) {
+  for (auto twist_it = old_twist_it; twist_it != new_twist_it + 1; ++twist_it) {
     const double dt =
-      (twist_ptr_it != new_twist_ptr_it)
-        ? (rclcpp::Time((*twist_ptr_it)->header.stamp) - rclcpp::Time(prev_time)).seconds()
+      (twist_it != new_twist_it)
+        ? (rclcpp::Time(twist_it->header.stamp) - rclcpp::Time(prev_time)).seconds()
         : (rclcpp::Time(new_stamp) - rclcpp::Time(prev_time)).seconds();
 
     if (std::fabs(dt) > 0.1) {
@@ -249,11 +248,11 @@ Eigen::Matrix4f PointCloudDataSynchronizerComponent::computeTransformToAdjustFor
       break;
     }
 
-    const double dis = (*twist_ptr_it)->twist.linear.x * dt;
-    yaw += (*twist_ptr_it)->twist.angular.z * dt;
+    const double dis = twist_it->twist.linear.x * dt;
+    yaw += twist_it->twist.angular.z * dt;
     x += dis * std::cos(yaw);
     y += dis * std::sin(yaw);
-    prev_time = (*twist_ptr_it)->header.stamp;
+    prev_time = twist_it->header.stamp;
   }
   Eigen::AngleAxisf rotation_x(0, Eigen::Vector3f::UnitX());
   Eigen::AngleAxisf rotation_y(0, Eigen::Vector3f::UnitY());
@@ -489,52 +488,52 @@ void PointCloudDataSynchronizerComponent::twist_callback(
   const geometry_msgs::msg::TwistWithCovarianceStamped::ConstSharedPtr input)
 {
   // if rosbag restart, clear buffer
-  if (!twist_ptr_queue_.empty()) {
-    if (rclcpp::Time(twist_ptr_queue_.front()->header.stamp) > rclcpp::Time(input->header.stamp)) {
-      twist_ptr_queue_.clear();
+  if (!twist_queue_.empty()) {
+    if (rclcpp::Time(twist_queue_.front().header.stamp) > rclcpp::Time(input->header.stamp)) {
+      twist_queue_.clear();
     }
   }
 
   // pop old data
-  while (!twist_ptr_queue_.empty()) {
+  while (!twist_queue_.empty()) {
     if (
-      rclcpp::Time(twist_ptr_queue_.front()->header.stamp) + rclcpp::Duration::from_seconds(1.0) >
+      rclcpp::Time(twist_queue_.front().header.stamp) + rclcpp::Duration::from_seconds(1.0) >
       rclcpp::Time(input->header.stamp)) {
       break;
     }
-    twist_ptr_queue_.pop_front();
+    twist_queue_.pop_front();
   }
 
-  auto twist_ptr = std::make_shared<geometry_msgs::msg::TwistStamped>();
-  twist_ptr->header.stamp = input->header.stamp;
-  twist_ptr->twist = input->twist.twist;
-  twist_ptr_queue_.push_back(twist_ptr);
+  geometry_msgs::msg::TwistStamped twist;
+  twist.header.stamp = input->header.stamp;
+  twist.twist = input->twist.twist;
+  twist_queue_.push_back(twist);
 }
 
 void PointCloudDataSynchronizerComponent::odom_callback(
   const nav_msgs::msg::Odometry::ConstSharedPtr input)
 {
   // if rosbag restart, clear buffer
-  if (!twist_ptr_queue_.empty()) {
-    if (rclcpp::Time(twist_ptr_queue_.front()->header.stamp) > rclcpp::Time(input->header.stamp)) {
-      twist_ptr_queue_.clear();
+  if (!twist_queue_.empty()) {
+    if (rclcpp::Time(twist_queue_.front().header.stamp) > rclcpp::Time(input->header.stamp)) {
+      twist_queue_.clear();
     }
   }
 
   // pop old data
-  while (!twist_ptr_queue_.empty()) {
+  while (!twist_queue_.empty()) {
     if (
-      rclcpp::Time(twist_ptr_queue_.front()->header.stamp) + rclcpp::Duration::from_seconds(1.0) >
+      rclcpp::Time(twist_queue_.front().header.stamp) + rclcpp::Duration::from_seconds(1.0) >
       rclcpp::Time(input->header.stamp)) {
       break;
     }
-    twist_ptr_queue_.pop_front();
+    twist_queue_.pop_front();
   }
 
-  auto twist_ptr = std::make_shared<geometry_msgs::msg::TwistStamped>();
-  twist_ptr->header.stamp = input->header.stamp;
-  twist_ptr->twist = input->twist.twist;
-  twist_ptr_queue_.push_back(twist_ptr);
+  geometry_msgs::msg::TwistStamped twist;
+  twist.header.stamp = input->header.stamp;
+  twist.twist = input->twist.twist;
+  twist_queue_.push_back(twist);
 }
 
 void PointCloudDataSynchronizerComponent::checkSyncStatus(
@@ -0,0 +1,245 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pointcloud_preprocessor/utility/polygon_mask.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace pointcloud_preprocessor::utils
+{
+namespace
+{
+enum class LocalCell : uint8_t { OUTSIDE, INSIDE, BOUNDARY };
+
+// margin in cell units so that rounding errors never hide an edge from a cell it touches
+constexpr double cell_margin = 1e-6;
+
+int64_t clamp_cell(const double cell, const int64_t min_cell, const int64_t max_cell)
+{
+  return std::clamp(static_cast<int64_t>(std::floor(cell)), min_cell, max_cell);
+}
+
+int64_t floor_cell(const double cell)
+{
+  return static_cast<int64_t>(std::floor(cell));
+}
+}  // namespace
+
+void PolygonMask::build(
+  const std::vector<PolygonCgal> & polygons, const double min_x, const double min_y,
+  const double max_x, const double max_y, const double resolution)
+{
+  if (resolution <= 0.0) {
+    throw std::invalid_argument("Mask resolution should be positive.");
+  }
+  clear();
+  polygons_ = polygons;
+  origin_x_ = min_x;
+  origin_y_ = min_y;
+  inverse_resolution_ = 1.0 / resolution;
+  nb_cells_x_ = std::max<int64_t>(1, std::ceil((max_x - min_x) * inverse_resolution_));
+  nb_cells_y_ = std::max<int64_t>(1, std::ceil((max_y - min_y) * inverse_resolution_));
+  cells_.assign(nb_cells_x_ * nb_cells_y_, outside_cell);
+
+  std::vector<std::pair<double, double>> vertices;
+  std::vector<LocalCell> local_cells;
+  std::vector<double> crossings;
+  for (uint32_t polygon_idx = 0; polygon_idx < polygons_.size(); ++polygon_idx) {
+    const auto & polygon = polygons_[polygon_idx];
+    if (polygon.size() < 3) {
+      continue;
+    }
+
+    // vertices in cell coordinates
+    vertices.clear();
+    double min_cx = std::numeric_limits<double>::max();
+    double min_cy = std::numeric_limits<double>::max();
+    double max_cx = std::numeric_limits<double>::lowest();
+    double max_cy = std::numeric_limits<double>::lowest();
+    for (const auto & p : polygon) {
+      const double cx = (CGAL::to_double(p.x()) - origin_x_) * inverse_resolution_;
+      const double cy = (CGAL::to_double(p.y()) - origin_y_) * inverse_resolution_;
+      vertices.emplace_back(cx, cy);
+      min_cx = std::min(min_cx, cx);
+      min_cy = std::min(min_cy, cy);
+      max_cx = std::max(max_cx, cx);
+      max_cy = std::max(max_cy, cy);
+    }
+    if (min_cx < 0.0 || min_cy < 0.0 || max_cx > nb_cells_x_ || max_cy > nb_cells_y_) {
+      covers_all_polygons_ = false;
+    }
+
+    // cells overlapped by the bounding box of the polygon
+    const auto begin_x = clamp_cell(min_cx - cell_margin, 0, nb_cells_x_);
+    const auto begin_y = clamp_cell(min_cy - cell_margin, 0, nb_cells_y_);
+    const auto end_x = clamp_cell(max_cx + cell_margin + 1.0, 0, nb_cells_x_);
+    const auto end_y = clamp_cell(max_cy + cell_margin + 1.0, 0, nb_cells_y_);
+    if (begin_x >= end_x || begin_y >= end_y) {
+      continue;
+    }
+    const auto width = end_x - begin_x;
+    local_cells.assign(width * (end_y - begin_y), LocalCell::OUTSIDE);
+
+    // mark every cell touched by an edge
+    for (size_t i = 0; i < vertices.size(); ++i) {
+      auto [ax, ay] = vertices[i];
+      auto [bx, by] = vertices[(i + 1) % vertices.size()];
+      if (ax > bx) {
+        std::swap(ax, bx);
+        std::swap(ay, by);
+      }
+      const auto col_begin = std::max(begin_x, floor_cell(ax - cell_margin));
+      const auto col_end = std::min(end_x - 1, floor_cell(bx + cell_margin));
+      for (auto col = col_begin; col <= col_end; ++col) {
+        double y0 = ay;
+        double y1 = by;
+        if (bx - ax > cell_margin) {
+          const double slope = (by - ay) / (bx - ax);
+          y0 = ay + (std::clamp<double>(col, ax, bx) - ax) * slope;
+          y1 = ay + (std::clamp<double>(col + 1, ax, bx) - ax) * slope;
+        }
+        const auto row_begin = std::max(begin_y, floor_cell(std::min(y0, y1) - cell_margin));
+        const auto row_end = std::min(end_y - 1, floor_cell(std::max(y0, y1) + cell_margin));
+        for (auto row = row_begin; row <= row_end; ++row) {
+          local_cells[(row - begin_y) * width + col - begin_x] = LocalCell::BOUNDARY;
+        }
+      }
+    }
+
+    // the remaining cells are entirely on one side, so their center decides (even-odd rule)
+    for (auto row = begin_y; row < end_y; ++row) {
+      const double cy = row + 0.5;
+      crossings.clear();
+      for (size_t i = 0; i < vertices.size(); ++i) {
+        const auto & [ax, ay] = vertices[i];
+        const auto & [bx, by] = vertices[(i + 1) % vertices.size()];
+        if ((ay <= cy) != (by <= cy)) {
+          crossings.push_back(ax + (cy - ay) * (bx - ax) / (by - ay));
+        }
+      }
+      std::sort(crossings.begin(), crossings.end());
+      for (size_t i = 0; i + 1 < crossings.size(); i += 2) {
+        const auto col_begin = std::max(begin_x, -floor_cell(0.5 - crossings[i]));
+        const auto col_end = std::min(end_x - 1, floor_cell(crossings[i + 1] - 0.5));
+        for (auto col = col_begin; col <= col_end; ++col) {
+          auto & local_cell = local_cells[(row - begin_y) * width + col - begin_x];
+          if (local_cell == LocalCell::OUTSIDE) {
+            local_cell = LocalCell::INSIDE;
+          }
+        }
+      }
+    }
+
+    // merge into the mask of all polygons
+    for (auto row = begin_y; row < end_y; ++row) {
+      for (auto col = begin_x; col < end_x; ++col) {
+        const auto local_cell = local_cells[(row - begin_y) * width + col - begin_x];
+        auto & cell = cells_[row * nb_cells_x_ + col];
+        if (local_cell == LocalCell::INSIDE) {
+          cell = inside_cell;
+        } else if (local_cell == LocalCell::BOUNDARY && cell != inside_cell) {
+          if (cell == outside_cell) {
+            cell = first_boundary_cell + boundary_polygon_indices_.size();
+            boundary_polygon_indices_.emplace_back();
+          }
+          boundary_polygon_indices_[cell - first_boundary_cell].push_back(polygon_idx);
+        }
+      }
+    }
+  }
+}
+
+void PolygonMask::clear()
+{
+  polygons_.clear();
+  covers_all_polygons_ = true;
+  nb_cells_x_ = 0;
+  nb_cells_y_ = 0;
+  cells_.clear();
+  boundary_polygon_indices_.clear();
+}
+
+bool PolygonMask::is_within(const float x, const float y) const
+{
+  const double cx = (x - origin_x_) * inverse_resolution_;
+  const double cy = (y - origin_y_) * inverse_resolution_;
+  if (!(cx >= 0.0 && cx < nb_cells_x_ && cy >= 0.0 && cy < nb_cells_y_)) {
+    return !covers_all_polygons_ && is_within_polygons(x, y);
+  }
+
+  const auto cell = cells_[static_cast<int64_t>(cy) * nb_cells_x_ + static_cast<int64_t>(cx)];
+  if (cell == outside_cell) {
+    return false;
+  }
+  if (cell == inside_cell) {
+    return true;
+  }
+  return is_within_polygons(x, y, boundary_polygon_indices_[cell - first_boundary_cell]);
+}
+
+bool PolygonMask::is_within_polygons(
+  const float x, const float y, const std::vector<uint32_t> & polygon_indices) const
+{
+  for (const auto polygon_idx : polygon_indices) {
+    const auto & polygon = polygons_[polygon_idx];
+    if (
+      CGAL::bounded_side_2(polygon.cbegin(), polygon.cend(), PointCgal(x, y), K()) ==
+      CGAL::ON_BOUNDED_SIDE) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool PolygonMask::is_within_polygons(const float x, const float y) const
+{
+  return point_within_cgal_polys(pcl::PointXYZ(x, y, 0.0F), polygons_);
+}
+
+void remove_polygon_mask_from_cloud(
+  const sensor_msgs::msg::PointCloud2 & cloud_in, const PolygonMask & polygon_mask,
+  sensor_msgs::msg::PointCloud2 & cloud_out)
+{
+  pcl::PointCloud<pcl::PointXYZ> filtered_cloud;
+  for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(cloud_in, "x"), iter_y(cloud_in, "y"),
+       iter_z(cloud_in, "z");
+       iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    if (!polygon_mask.is_within(*iter_x, *iter_y)) {
+      filtered_cloud.emplace_back(*iter_x, *iter_y, *iter_z);
+    }
+  }
+
+  pcl::toROSMsg(filtered_cloud, cloud_out);
+  cloud_out.header = cloud_in.header;
+}
+
+void remove_polygon_mask_from_cloud(
+  const pcl::PointCloud<pcl::PointXYZ> & cloud_in, const PolygonMask & polygon_mask,
+  pcl::PointCloud<pcl::PointXYZ> & cloud_out)
+{
+  cloud_out.clear();
+  cloud_out.header = cloud_in.header;
+  cloud_out.reserve(cloud_in.size());
+
+  for (const auto & p : cloud_in) {
+    if (!polygon_mask.is_within(p.x, p.y)) {
+      cloud_out.emplace_back(p);
+    }
+  }
+}
+}  // namespace pointcloud_preprocessor::utils
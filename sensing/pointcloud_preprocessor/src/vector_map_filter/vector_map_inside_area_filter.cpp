@@ -68,6 +68,8 @@ VectorMapInsideAreaFilterComponent::VectorMapInsideAreaFilterComponent(
 {
   polygon_type_ =
     static_cast<std::string>(declare_parameter("polygon_type", "no_obstacle_segmentation_area"));
+  mask_resolution_ = declare_parameter("mask_resolution", 0.0);
+  mask_size_ = declare_parameter("mask_size", 200.0);
 
   using std::placeholders::_1;
   // Set subscriber
@@ -95,6 +97,17 @@ void VectorMapInsideAreaFilterComponent::filter(
   // calculate bounding box of points
   const auto bounding_box = calcBoundingBox(pc_input);
 
+  if (mask_resolution_ > 0.0) {
+    updatePolygonMask(bounding_box);
+
+    pcl::PointCloud<pcl::PointXYZ> filtered_pc;
+    utils::remove_polygon_mask_from_cloud(*pc_input, polygon_mask_, filtered_pc);
+
+    pcl::toROSMsg(filtered_pc, output);
+    output.header = input->header;
+    return;
+  }
+
   // use only intersected lanelets to reduce calculation cost
   const auto intersected_lanelets = calcIntersectedPolygons(bounding_box, polygon_lanelets_);
 
@@ -114,6 +127,37 @@ void VectorMapInsideAreaFilterComponent::mapCallback(
   const auto lanelet_map_ptr = std::make_shared<lanelet::LaneletMap>();
   lanelet::utils::conversion::fromBinMsg(*map_msg, lanelet_map_ptr);
   polygon_lanelets_ = lanelet::utils::query::getAllPolygonsByType(lanelet_map_ptr, polygon_type_);
+
+  polygons_cgal_.clear();
+  for (const auto & polygon : polygon_lanelets_) {
+    PolygonCgal cgal_poly;
+    utils::to_cgal_polygon(lanelet::utils::to2D(polygon).basicPolygon(), cgal_poly);
+    polygons_cgal_.push_back(cgal_poly);
+  }
+  polygon_mask_.clear();
+}
+
+void VectorMapInsideAreaFilterComponent::updatePolygonMask(
+  const tier4_autoware_utils::Box2d & bounding_box)
+{
+  // the mask is centered on a tile of a quarter of its size containing the center of the points,
+  // so it is rasterized again only after the sensor has moved by about that distance
+  const double tile_size = mask_size_ / 4.0;
+  const auto tile_x = static_cast<int64_t>(std::floor(
+    (bounding_box.min_corner().x() + bounding_box.max_corner().x()) / 2.0 / tile_size));
+  const auto tile_y = static_cast<int64_t>(std::floor(
+    (bounding_box.min_corner().y() + bounding_box.max_corner().y()) / 2.0 / tile_size));
+  if (polygon_mask_.is_built() && tile_x == mask_tile_x_ && tile_y == mask_tile_y_) {
+    return;
+  }
+
+  const double center_x = (tile_x + 0.5) * tile_size;
+  const double center_y = (tile_y + 0.5) * tile_size;
+  polygon_mask_.build(
+    polygons_cgal_, center_x - mask_size_ / 2.0, center_y - mask_size_ / 2.0,
+    center_x + mask_size_ / 2.0, center_y + mask_size_ / 2.0, mask_resolution_);
+  mask_tile_x_ = tile_x;
+  mask_tile_y_ = tile_y;
 }
 
 }  // namespace pointcloud_preprocessor
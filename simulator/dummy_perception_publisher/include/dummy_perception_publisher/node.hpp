@@ -38,6 +38,7 @@
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <cmath>
 #include <memory>
 #include <random>
 #include <vector>
@@ -98,7 +99,14 @@ private:
 class EgoCentricPointCloudCreator : public PointCloudCreator
 {
 public:
-  explicit EgoCentricPointCloudCreator(double visible_range) : visible_range_(visible_range) {}
+  explicit EgoCentricPointCloudCreator(
+    double visible_range, double horizontal_theta_step = 0.1 * M_PI / 180.0,
+    double vertical_theta_step = 1.0 * M_PI / 180.0)
+  : visible_range_(visible_range),
+    horizontal_theta_step_(horizontal_theta_step),
+    vertical_theta_step_(vertical_theta_step)
+  {
+  }
   std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> create_pointclouds(
     const std::vector<ObjectInfo> & obj_infos, const tf2::Transform & tf_base_link2map,
     std::mt19937 & random_generator,
@@ -106,6 +114,24 @@ public:
 
 private:
   double visible_range_;
+  double horizontal_theta_step_;
+  double vertical_theta_step_;
+};
+
+// synthetic objects kept around the ego vehicle to benchmark the downstream nodes
+struct LoadGenerationParam
+{
+  bool enable;
+  int num_objects;
+  int seed;
+  double min_spawn_distance;
+  double max_spawn_distance;
+  double pedestrian_ratio;
+  double min_vehicle_speed;
+  double max_vehicle_speed;
+  double min_pedestrian_speed;
+  double max_pedestrian_speed;
+  double max_acceleration;
 };
 
 class DummyPerceptionPublisherNode : public rclcpp::Node
@@ -132,8 +158,15 @@ private:
 
   double angle_increment_;
 
+  LoadGenerationParam load_generation_param_;
+  // separated from random_generator_ so that the spawned objects do not depend on the noise
+  std::mt19937 load_random_generator_;
+
   std::mt19937 random_generator_;
   void timerCallback();
+  void spawnLoadObjects(const tf2::Transform & tf_map2base_link, const rclcpp::Time & stamp);
+  dummy_perception_publisher::msg::Object createLoadObject(
+    const tf2::Transform & tf_map2base_link, const rclcpp::Time & stamp);
   void objectCallback(const dummy_perception_publisher::msg::Object::ConstSharedPtr msg);
 
 public:
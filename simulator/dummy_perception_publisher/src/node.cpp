@@ -26,6 +26,8 @@
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 #endif
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -137,12 +139,38 @@ DummyPerceptionPublisherNode::DummyPerceptionPublisherNode()
     static_cast<unsigned int>(this->declare_parameter("random_seed", 0));
   const bool use_fixed_random_seed = this->declare_parameter("use_fixed_random_seed", false);
 
+  const double publish_rate = this->declare_parameter("publish_rate", 10.0);
+  const double horizontal_resolution =
+    this->declare_parameter("horizontal_resolution", 0.1) * M_PI / 180.0;
+  const double vertical_resolution =
+    this->declare_parameter("vertical_resolution", 1.0) * M_PI / 180.0;
+
   if (object_centric_pointcloud) {
     pointcloud_creator_ =
       std::unique_ptr<PointCloudCreator>(new ObjectCentricPointCloudCreator(enable_ray_tracing_));
   } else {
-    pointcloud_creator_ =
-      std::unique_ptr<PointCloudCreator>(new EgoCentricPointCloudCreator(visible_range_));
+    pointcloud_creator_ = std::unique_ptr<PointCloudCreator>(
+      new EgoCentricPointCloudCreator(visible_range_, horizontal_resolution, vertical_resolution));
+  }
+
+  // parameters for load generation
+  {
+    auto & p = load_generation_param_;
+    p.enable = this->declare_parameter("load_generation.enable", false);
+    p.num_objects = this->declare_parameter("load_generation.num_objects", 100);
+    p.seed = this->declare_parameter("load_generation.seed", 0);
+    p.min_spawn_distance = this->declare_parameter("load_generation.min_spawn_distance", 10.0);
+    p.max_spawn_distance = this->declare_parameter("load_generation.max_spawn_distance", 80.0);
+    p.pedestrian_ratio = this->declare_parameter("load_generation.pedestrian_ratio", 0.3);
+    p.min_vehicle_speed = this->declare_parameter("load_generation.min_vehicle_speed", 0.0);
+    p.max_vehicle_speed = this->declare_parameter("load_generation.max_vehicle_speed", 15.0);
+    p.min_pedestrian_speed = this->declare_parameter("load_generation.min_pedestrian_speed", 0.0);
+    p.max_pedestrian_speed = this->declare_parameter("load_generation.max_pedestrian_speed", 2.0);
+    p.max_acceleration = this->declare_parameter("load_generation.max_acceleration", 1.0);
+    // the objects must be spawned inside the visible range, otherwise they are deleted at once
+    p.max_spawn_distance = std::min(p.max_spawn_distance, visible_range_);
+    p.min_spawn_distance = std::min(p.min_spawn_distance, p.max_spawn_distance);
+    load_random_generator_.seed(static_cast<unsigned int>(p.seed));
   }
 
   // parameters for vehicle centric point cloud generation
@@ -173,9 +201,9 @@ DummyPerceptionPublisherNode::DummyPerceptionPublisherNode()
         "~/output/debug/ground_truth_objects", qos);
   }
 
-  using std::chrono_literals::operator""ms;
+  const auto period_ns = rclcpp::Rate(publish_rate).period();
   timer_ = rclcpp::create_timer(
-    this, get_clock(), 100ms, std::bind(&DummyPerceptionPublisherNode::timerCallback, this));
+    this, get_clock(), period_ns, std::bind(&DummyPerceptionPublisherNode::timerCallback, this));
 }
 
 void DummyPerceptionPublisherNode::timerCallback()
@@ -212,23 +240,28 @@ void DummyPerceptionPublisherNode::timerCallback()
     return;
   }
 
+  // keep the number of the synthetic objects, the ones out of the visible range are deleted below
+  if (load_generation_param_.enable) {
+    spawnLoadObjects(tf_base_link2map.inverse(), current_time);
+  }
+
   std::vector<size_t> selected_indices{};
   std::vector<ObjectInfo> obj_infos;
+  obj_infos.reserve(objects_.size());
   static std::uniform_real_distribution<> detection_successful_random(0.0, 1.0);
   for (size_t i = 0; i < objects_.size(); ++i) {
     if (detection_successful_rate_ >= detection_successful_random(random_generator_)) {
       selected_indices.push_back(i);
     }
-    const auto obj_info = ObjectInfo(objects_.at(i), current_time);
-    obj_infos.push_back(obj_info);
+    obj_infos.emplace_back(objects_.at(i), current_time);
   }
 
   // publish ground truth
   // add Tracked Object
   if (publish_ground_truth_objects_) {
-    for (auto object : objects_) {
-      const auto object_info = ObjectInfo(object, current_time);
-      TrackedObject gt_tracked_object = object_info.toTrackedObject(object);
+    output_ground_truth_objects_msg.objects.reserve(objects_.size());
+    for (size_t i = 0; i < objects_.size(); ++i) {
+      TrackedObject gt_tracked_object = obj_infos.at(i).toTrackedObject(objects_.at(i));
       gt_tracked_object.existence_probability = 1.0;
       output_ground_truth_objects_msg.objects.push_back(gt_tracked_object);
     }
@@ -248,8 +281,9 @@ void DummyPerceptionPublisherNode::timerCallback()
   }
   if (!selected_indices.empty()) {
     std::vector<ObjectInfo> detected_obj_infos;
+    detected_obj_infos.reserve(selected_indices.size());
     for (const auto selected_idx : selected_indices) {
-      const auto detected_obj_info = ObjectInfo(objects_.at(selected_idx), current_time);
+      const auto & detected_obj_info = obj_infos.at(selected_idx);
       tf2::toMsg(detected_obj_info.tf_map2moved_object, output_moved_object_pose.pose);
       detected_obj_infos.push_back(detected_obj_info);
     }
@@ -262,7 +296,7 @@ void DummyPerceptionPublisherNode::timerCallback()
       const auto pointcloud = pointclouds[i];
       const size_t selected_idx = selected_indices[i];
       const auto & object = objects_.at(selected_idx);
-      const auto object_info = ObjectInfo(object, current_time);
+      const auto & object_info = obj_infos.at(selected_idx);
       // dynamic object
       std::normal_distribution<> x_random(0.0, object_info.std_dev_x);
       std::normal_distribution<> y_random(0.0, object_info.std_dev_y);
@@ -424,3 +458,83 @@ void DummyPerceptionPublisherNode::objectCallback(
     }
   }
 }
+
+void DummyPerceptionPublisherNode::spawnLoadObjects(
+  const tf2::Transform & tf_map2base_link, const rclcpp::Time & stamp)
+{
+  const size_t num_objects = static_cast<size_t>(std::max(load_generation_param_.num_objects, 0));
+  objects_.reserve(num_objects);
+  while (objects_.size() < num_objects) {
+    objects_.push_back(createLoadObject(tf_map2base_link, stamp));
+  }
+}
+
+dummy_perception_publisher::msg::Object DummyPerceptionPublisherNode::createLoadObject(
+  const tf2::Transform & tf_map2base_link, const rclcpp::Time & stamp)
+{
+  using autoware_auto_perception_msgs::msg::ObjectClassification;
+  using autoware_auto_perception_msgs::msg::Shape;
+  const auto & p = load_generation_param_;
+  auto & gen = load_random_generator_;
+  std::uniform_real_distribution<> unit_random(0.0, 1.0);
+
+  dummy_perception_publisher::msg::Object object;
+  object.header.frame_id = "map";
+  object.header.stamp = stamp;
+  object.action = dummy_perception_publisher::msg::Object::ADD;
+  std::uniform_int_distribution<int> byte_random(0, 255);
+  for (auto & byte : object.id.uuid) {
+    byte = static_cast<uint8_t>(byte_random(gen));
+  }
+
+  const bool is_pedestrian = unit_random(gen) < p.pedestrian_ratio;
+  double min_speed;
+  double max_speed;
+  object.classification.probability = 1.0;
+  if (is_pedestrian) {
+    object.classification.label = ObjectClassification::PEDESTRIAN;
+    object.shape.type = Shape::CYLINDER;
+    object.shape.dimensions.x = 0.6;
+    object.shape.dimensions.y = 0.6;
+    object.shape.dimensions.z = 2.0;
+    min_speed = p.min_pedestrian_speed;
+    max_speed = p.max_pedestrian_speed;
+  } else {
+    object.classification.label = ObjectClassification::CAR;
+    object.shape.type = Shape::BOUNDING_BOX;
+    object.shape.dimensions.x = 4.0;
+    object.shape.dimensions.y = 1.8;
+    object.shape.dimensions.z = 2.0;
+    min_speed = p.min_vehicle_speed;
+    max_speed = p.max_vehicle_speed;
+  }
+  max_speed = std::max(max_speed, min_speed);
+
+  // uniformly distributed in the annulus around the ego vehicle
+  const double min_r2 = p.min_spawn_distance * p.min_spawn_distance;
+  const double max_r2 = p.max_spawn_distance * p.max_spawn_distance;
+  const double r = std::sqrt(min_r2 + (max_r2 - min_r2) * unit_random(gen));
+  const double theta = 2.0 * M_PI * unit_random(gen);
+  const double yaw = 2.0 * M_PI * unit_random(gen) - M_PI;
+  const double z = use_base_link_z_ ? 0.5 * object.shape.dimensions.z : 0.0;
+  tf2::Quaternion quat;
+  quat.setRPY(0.0, 0.0, yaw);
+  const tf2::Transform tf_base_link2object(
+    quat, tf2::Vector3(r * std::cos(theta), r * std::sin(theta), z));
+  tf2::toMsg(tf_map2base_link * tf_base_link2object, object.initial_state.pose_covariance.pose);
+
+  auto & pose_covariance = object.initial_state.pose_covariance.covariance;
+  pose_covariance[0] = 0.03 * 0.03;
+  pose_covariance[7] = 0.03 * 0.03;
+  pose_covariance[14] = 0.03 * 0.03;
+  pose_covariance[35] = std::pow(5.0 * M_PI / 180.0, 2);
+
+  // constant acceleration motion, bounded by the speed range of the class
+  object.min_velocity = static_cast<float>(min_speed);
+  object.max_velocity = static_cast<float>(max_speed);
+  object.initial_state.twist_covariance.twist.linear.x =
+    min_speed + (max_speed - min_speed) * unit_random(gen);
+  object.initial_state.accel_covariance.accel.linear.x =
+    p.max_acceleration * (2.0 * unit_random(gen) - 1.0);
+  return object;
+}
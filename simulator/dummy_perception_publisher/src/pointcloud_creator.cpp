@@ -225,9 +225,9 @@ std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> EgoCentricPointCloudCreator::cr
   }
 
   double angle = 0.0;
-  const auto n_scan = static_cast<size_t>(std::floor(2 * M_PI / horizontal_theta_step));
+  const auto n_scan = static_cast<size_t>(std::floor(2 * M_PI / horizontal_theta_step_));
   for (size_t i = 0; i < n_scan; ++i) {
-    angle += horizontal_theta_step;
+    angle += horizontal_theta_step_;
     const auto dist = composite_sdf.getSphereTracingDist(0.0, 0.0, angle, visible_range_);
 
     if (std::isfinite(dist)) {
@@ -242,7 +242,7 @@ std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> EgoCentricPointCloudCreator::cr
       std::normal_distribution<> z_random(0.0, obj_info_here.std_dev_z);
 
       for (double vertical_theta = vertical_min_theta;
-           vertical_theta <= vertical_max_theta + epsilon; vertical_theta += vertical_theta_step) {
+           vertical_theta <= vertical_max_theta + epsilon; vertical_theta += vertical_theta_step_) {
         const double z = dist * std::tan(vertical_theta);
         if (min_z_here <= z && z <= max_z_here + epsilon) {
           pointclouds.at(idx_hit)->push_back(pcl::PointXYZ(
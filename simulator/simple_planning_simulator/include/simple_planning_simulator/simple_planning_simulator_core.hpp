@@ -45,6 +45,7 @@
 #include "geometry_msgs/msg/twist.hpp"
 #include "geometry_msgs/msg/twist_stamped.hpp"
 #include "nav_msgs/msg/odometry.hpp"
+#include "rosgraph_msgs/msg/clock.hpp"
 #include "sensor_msgs/msg/imu.hpp"
 #include "tier4_external_api_msgs/srv/initialize_pose.hpp"
 
@@ -52,6 +53,8 @@
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <chrono>
+#include <map>
 #include <memory>
 #include <random>
 #include <string>
@@ -138,6 +141,7 @@ private:
   rclcpp::Publisher<HazardLightsReport>::SharedPtr pub_hazard_lights_report_;
   rclcpp::Publisher<tf2_msgs::msg::TFMessage>::SharedPtr pub_tf_;
   rclcpp::Publisher<PoseStamped>::SharedPtr pub_current_pose_;
+  rclcpp::Publisher<rosgraph_msgs::msg::Clock>::SharedPtr pub_clock_;
 
   rclcpp::Subscription<GearCommand>::SharedPtr sub_gear_cmd_;
   rclcpp::Subscription<GearCommand>::SharedPtr sub_manual_gear_cmd_;
@@ -160,6 +164,13 @@ private:
   uint32_t timer_sampling_time_ms_;        //!< @brief timer sampling time
   rclcpp::TimerBase::SharedPtr on_timer_;  //!< @brief timer for simulation
 
+  /* lockstep */
+  bool enable_lockstep_;  //!< @brief flag to step when the awaited inputs of the step arrive
+  double lockstep_timeout_;  //!< @brief [s] wall time to wait for the awaited inputs
+  std::map<std::string, bool> lockstep_received_;  //!< @brief arrival of the awaited inputs
+  rclcpp::Time sim_time_;  //!< @brief simulation time published to /clock in lockstep mode
+  std::chrono::steady_clock::time_point lockstep_step_time_;  //!< @brief wall time of last step
+
   OnSetParametersCallbackHandle::SharedPtr set_param_res_;
   rcl_interfaces::msg::SetParametersResult on_parameter(
     const std::vector<rclcpp::Parameter> & parameters);
@@ -299,6 +310,28 @@ private:
    */
   void on_timer();
 
+  /**
+   * @brief get the stamp of the current step
+   * @return simulation time in lockstep mode, otherwise the time of the node clock
+   */
+  rclcpp::Time get_current_time();
+
+  /**
+   * @brief record the arrival of an input, and step the simulation if all awaited inputs arrived
+   * @param [in] name name of the input topic without the "input/" prefix
+   */
+  void on_lockstep_input(const std::string & name);
+
+  /**
+   * @brief wall timer callback to step the simulation before the initialization or at timeout
+   */
+  void on_lockstep_timer();
+
+  /**
+   * @brief advance the simulation time, publish /clock and simulate one step
+   */
+  void step_lockstep();
+
   /**
    * @brief initialize vehicle_model_ptr
    */
@@ -0,0 +1,172 @@
+// Copyright 2023 The Autoware Foundation.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SIMPLE_PLANNING_SIMULATOR__SIMPLE_PLANNING_SIMULATOR_FLEET_HPP_
+#define SIMPLE_PLANNING_SIMULATOR__SIMPLE_PLANNING_SIMULATOR_FLEET_HPP_
+
+#include "rclcpp/rclcpp.hpp"
+#include "simple_planning_simulator/simple_planning_simulator_core.hpp"
+#include "simple_planning_simulator/vehicle_model/sim_model_batch_delay_steer_acc.hpp"
+#include "simple_planning_simulator/vehicle_model/sim_model_interface.hpp"
+#include "simple_planning_simulator/visibility_control.hpp"
+
+#include "tf2_msgs/msg/tf_message.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace simulation
+{
+namespace simple_planning_simulator
+{
+
+/**
+ * @brief state, commands and ros interfaces of a vehicle in the fleet
+ */
+struct FleetVehicle
+{
+  std::string name;  //!< @brief namespace of the topics and prefix of the frame id
+  size_t index;      //!< @brief index of the vehicle in the fleet and the batch model
+  std::shared_ptr<SimModelInterface> vehicle_model_ptr;  //!< @brief null with the batch model
+
+  /* received topics */
+  AckermannControlCommand current_ackermann_cmd;
+  GearCommand current_gear_cmd;
+  bool simulate_motion;  //!< stop vehicle motion simulation if false
+  bool is_initialized;   //!< flag to check the initial position is set
+
+  /* simulated results written by the step of the vehicle */
+  Odometry current_odometry;
+  VelocityReport current_velocity;
+  SteeringReport current_steer;
+  AccelWithCovarianceStamped current_acc;
+  GearReport current_gear;
+
+  rclcpp::Subscription<AckermannControlCommand>::SharedPtr sub_ackermann_cmd;
+  rclcpp::Subscription<GearCommand>::SharedPtr sub_gear_cmd;
+  rclcpp::Subscription<PoseWithCovarianceStamped>::SharedPtr sub_init_pose;
+  rclcpp::Subscription<Engage>::SharedPtr sub_engage;
+
+  rclcpp::Publisher<VelocityReport>::SharedPtr pub_velocity;
+  rclcpp::Publisher<Odometry>::SharedPtr pub_odom;
+  rclcpp::Publisher<SteeringReport>::SharedPtr pub_steer;
+  rclcpp::Publisher<AccelWithCovarianceStamped>::SharedPtr pub_acc;
+  rclcpp::Publisher<GearReport>::SharedPtr pub_gear_report;
+};
+
+/**
+ * @brief simulator of multiple vehicles in one node
+ * @details All vehicles share the vehicle model parameters and are stepped in one timer, which
+ * distributes the vehicles to the worker threads if num_threads is more than one. The topics of
+ * each vehicle are in the namespace of its name, and the transforms are published in one message.
+ */
+class PLANNING_SIMULATOR_PUBLIC SimplePlanningSimulatorFleet : public rclcpp::Node
+{
+public:
+  explicit SimplePlanningSimulatorFleet(const rclcpp::NodeOptions & options);
+  ~SimplePlanningSimulatorFleet() override;
+
+private:
+  rclcpp::Publisher<tf2_msgs::msg::TFMessage>::SharedPtr pub_tf_;
+
+  uint32_t timer_sampling_time_ms_;        //!< @brief timer sampling time
+  rclcpp::TimerBase::SharedPtr on_timer_;  //!< @brief timer for simulation
+
+  /* frame_id */
+  std::string simulated_frame_id_;  //!< @brief simulated vehicle frame id without vehicle name
+  std::string origin_frame_id_;     //!< @brief map frame_id
+
+  bool use_velocity_input_;  //!< @brief flag if the vehicle model receives the velocity command
+  std::vector<FleetVehicle> vehicles_;
+
+  //!< @brief model of all vehicles stepped at once, which is used instead of vehicle_model_ptr
+  std::unique_ptr<SimModelBatchDelaySteerAcc> batch_model_;
+
+  DeltaTime delta_time_;  //!< @brief to calculate delta time
+
+  /* worker threads to step the vehicles */
+  size_t num_threads_;  //!< @brief number of threads including the timer thread
+  std::vector<std::thread> workers_;
+  std::mutex worker_mutex_;
+  std::condition_variable worker_start_cv_;
+  std::condition_variable worker_done_cv_;
+  uint64_t worker_generation_{0};
+  size_t running_workers_{0};
+  double worker_dt_{0.0};
+  bool stop_workers_{false};
+
+  /**
+   * @brief create the subscribers and the publishers in the namespace of the vehicle
+   */
+  void create_vehicle_interfaces(FleetVehicle & vehicle);
+
+  /**
+   * @brief set initial state of simulated vehicle
+   * @param [in] vehicle vehicle to initialize
+   * @param [in] x initial x-position
+   * @param [in] y initial y-position
+   * @param [in] yaw initial yaw angle
+   * @param [in] vx initial velocity
+   */
+  void set_initial_state(
+    FleetVehicle & vehicle, const double x, const double y, const double yaw, const double vx);
+
+  /**
+   * @brief timer callback for simulation with loop_rate
+   */
+  void on_timer();
+
+  /**
+   * @brief step the vehicles whose index modulo the number of threads is thread_index
+   */
+  void step_vehicles(const size_t thread_index, const double dt);
+
+  /**
+   * @brief set the input, update the dynamics, and store the results of the vehicle
+   */
+  void step_vehicle(FleetVehicle & vehicle, const double dt);
+
+  /**
+   * @brief set the inputs, update the dynamics, and store the results of all vehicles with the
+   * batch model
+   */
+  void step_batch(const double dt);
+
+  /**
+   * @brief store the simulated results of the vehicle
+   */
+  void set_current_state(
+    FleetVehicle & vehicle, const double x, const double y, const double yaw, const double vx,
+    const double wz, const double steer, const double ax, const uint8_t gear);
+
+  /**
+   * @brief loop of the worker thread, which steps the vehicles for each generation
+   */
+  void worker_loop(const size_t thread_index);
+
+  /**
+   * @brief publish the simulated results of the vehicle
+   */
+  void publish_vehicle(const FleetVehicle & vehicle, const rclcpp::Time & stamp);
+};
+}  // namespace simple_planning_simulator
+}  // namespace simulation
+
+#endif  // SIMPLE_PLANNING_SIMULATOR__SIMPLE_PLANNING_SIMULATOR_FLEET_HPP_
@@ -0,0 +1,192 @@
+// Copyright 2023 The Autoware Foundation.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_BATCH_DELAY_STEER_ACC_HPP_
+#define SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_BATCH_DELAY_STEER_ACC_HPP_
+
+#include <Eigen/Core>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class SimModelBatchDelaySteerAcc
+ * @brief DELAY_STEER_ACC and DELAY_STEER_ACC_GEARED models of multiple vehicles
+ * @details The states, the inputs and the delay buffers of the vehicles are stored as a structure
+ * of arrays, so that a step of the Runge-Kutta integration is vectorized over the vehicles. The
+ * dynamics of each vehicle is the same as SimModelDelaySteerAcc or SimModelDelaySteerAccGeared.
+ */
+class SimModelBatchDelaySteerAcc
+{
+public:
+  enum IDX {
+    X = 0,
+    Y,
+    YAW,
+    VX,
+    STEER,
+    ACCX,
+  };
+  static constexpr int DIM_X = 6;  //!< @brief dimension of state x
+
+  using State = Eigen::Matrix<double, DIM_X, 1>;  //!< @brief state of a vehicle
+
+  /**
+   * @brief constructor
+   * @param [in] num_vehicles number of vehicles
+   * @param [in] vx_lim velocity limit [m/s]
+   * @param [in] steer_lim steering limit [rad]
+   * @param [in] vx_rate_lim acceleration limit [m/ss]
+   * @param [in] steer_rate_lim steering angular velocity limit [rad/ss]
+   * @param [in] wheelbase vehicle wheelbase length [m]
+   * @param [in] dt delta time information to set input buffer for delay
+   * @param [in] acc_delay time delay for accel command [s]
+   * @param [in] acc_time_constant time constant for 1D model of accel dynamics
+   * @param [in] steer_delay time delay for steering command [s]
+   * @param [in] steer_time_constant time constant for 1D model of steering dynamics
+   * @param [in] geared if true, the velocity is limited by the gear as SimModelDelaySteerAccGeared
+   */
+  SimModelBatchDelaySteerAcc(
+    size_t num_vehicles, double vx_lim, double steer_lim, double vx_rate_lim,
+    double steer_rate_lim, double wheelbase, double dt, double acc_delay, double acc_time_constant,
+    double steer_delay, double steer_time_constant, bool geared);
+
+  /**
+   * @brief get number of vehicles
+   */
+  size_t size() const { return num_vehicles_; }
+
+  /**
+   * @brief get state of the vehicle
+   * @param [in] i index of the vehicle
+   */
+  State getState(const size_t i) const;
+
+  /**
+   * @brief set state of the vehicle
+   * @param [in] i index of the vehicle
+   * @param [in] state state of the vehicle
+   */
+  void setState(const size_t i, const State & state);
+
+  /**
+   * @brief set input of the vehicle
+   * @param [in] i index of the vehicle
+   * @param [in] acc_des desired acceleration [m/ss]
+   * @param [in] steer_des desired steering angle [rad]
+   */
+  void setInput(const size_t i, const double acc_des, const double steer_des);
+
+  /**
+   * @brief set gear of the vehicle
+   * @param [in] i index of the vehicle
+   * @param [in] gear gear command defined in autoware_auto_msgs/GearCommand
+   */
+  void setGear(const size_t i, const uint8_t gear);
+
+  /**
+   * @brief get gear of the vehicle
+   * @param [in] i index of the vehicle
+   */
+  uint8_t getGear(const size_t i) const { return gears_.at(i); }
+
+  /**
+   * @brief set if the motion of the vehicle is simulated
+   * @param [in] i index of the vehicle
+   * @param [in] active if false, the state of the vehicle is kept in update
+   */
+  void setActive(const size_t i, const bool active);
+
+  /**
+   * @brief update states of the active vehicles
+   * @param [in] dt delta time [s]
+   * @note The delay buffers of the inactive vehicles also advance.
+   */
+  void update(const double dt);
+
+  double getX(const size_t i) const { return state_(i, IDX::X); }
+  double getY(const size_t i) const { return state_(i, IDX::Y); }
+  double getYaw(const size_t i) const { return state_(i, IDX::YAW); }
+  double getVx(const size_t i) const { return state_(i, IDX::VX); }
+  double getAx(const size_t i) const { return state_(i, IDX::ACCX); }
+  double getSteer(const size_t i) const { return state_(i, IDX::STEER); }
+  double getWz(const size_t i) const
+  {
+    return state_(i, IDX::VX) * std::tan(state_(i, IDX::STEER)) / wheelbase_;
+  }
+
+private:
+  // each column is a state variable of all vehicles
+  using StateArray = Eigen::Array<double, Eigen::Dynamic, DIM_X>;
+  // each row is the inputs of all vehicles at a step
+  using InputBuffer = Eigen::Array<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  const double MIN_TIME_CONSTANT;  //!< @brief minimum time constant
+
+  const size_t num_vehicles_;         //!< @brief number of vehicles
+  const double vx_lim_;               //!< @brief velocity limit [m/s]
+  const double vx_rate_lim_;          //!< @brief acceleration limit [m/ss]
+  const double steer_lim_;            //!< @brief steering limit [rad]
+  const double steer_rate_lim_;       //!< @brief steering angular velocity limit [rad/s]
+  const double wheelbase_;            //!< @brief vehicle wheelbase length [m]
+  const double acc_time_constant_;    //!< @brief time constant for accel dynamics
+  const double steer_time_constant_;  //!< @brief time constant for steering dynamics
+  const bool geared_;                 //!< @brief flag to limit the velocity by the gear
+
+  std::vector<uint8_t> gears_;      //!< @brief gear commands of the vehicles
+  Eigen::ArrayXd gear_directions_;  //!< @brief 1 for drive, -1 for reverse, 0 for the others
+
+  Eigen::Array<bool, Eigen::Dynamic, 1> active_;  //!< @brief flags to simulate the motion
+
+  StateArray state_;                  //!< @brief states of the vehicles
+  Eigen::ArrayXd acc_input_;          //!< @brief accel commands of the vehicles
+  Eigen::ArrayXd steer_input_;        //!< @brief steering commands of the vehicles
+  InputBuffer acc_input_queue_;       //!< @brief buffer for accel command
+  InputBuffer steer_input_queue_;     //!< @brief buffer for steering command
+  Eigen::Index acc_queue_head_{0};    //!< @brief index of the oldest accel command
+  Eigen::Index steer_queue_head_{0};  //!< @brief index of the oldest steering command
+
+  /* buffers for the integration, which are allocated in the constructor */
+  Eigen::ArrayXd acc_des_;
+  Eigen::ArrayXd steer_des_;
+  Eigen::ArrayXd vel_;
+  Eigen::ArrayXd acc_;
+  StateArray prev_state_;
+  StateArray tmp_state_;
+  StateArray k1_;
+  StateArray k2_;
+  StateArray k3_;
+  StateArray k4_;
+
+  /**
+   * @brief pop the delayed inputs and push the current inputs
+   */
+  void updateInputQueue();
+
+  /**
+   * @brief calculate derivative of states of all vehicles with the delayed inputs
+   * @param [in] state current states
+   * @param [out] d_state derivative of the states
+   */
+  void calcModel(const StateArray & state, StateArray & d_state);
+
+  /**
+   * @brief stop the vehicles whose velocity is against the gear
+   * @param [in] dt delta time [s]
+   */
+  void updateStateWithGear(const double dt);
+};
+
+#endif  // SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_BATCH_DELAY_STEER_ACC_HPP_
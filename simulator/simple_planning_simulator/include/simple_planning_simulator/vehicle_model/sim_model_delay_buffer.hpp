@@ -0,0 +1,65 @@
+// Copyright 2023 The Autoware Foundation.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_DELAY_BUFFER_HPP_
+#define SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_DELAY_BUFFER_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class DelayBuffer
+ * @brief ring buffer to delay the input command by a fixed number of steps
+ */
+class DelayBuffer
+{
+public:
+  /**
+   * @brief constructor without delay
+   */
+  DelayBuffer() = default;
+
+  /**
+   * @brief constructor
+   * @param [in] delay time delay [s]
+   * @param [in] dt delta time of a step [s]
+   */
+  DelayBuffer(const double delay, const double dt)
+  : buffer_(static_cast<size_t>(std::round(delay / dt)), 0.0)
+  {
+  }
+
+  /**
+   * @brief push the input and pop the input pushed the delay steps before
+   * @param [in] input current input
+   * @return delayed input, which is zero until the buffer is filled
+   */
+  double push(const double input)
+  {
+    if (buffer_.empty()) {
+      return input;
+    }
+    const double delayed_input = buffer_[head_];
+    buffer_[head_] = input;
+    head_ = head_ + 1 == buffer_.size() ? 0 : head_ + 1;
+    return delayed_input;
+  }
+
+private:
+  std::vector<double> buffer_;  //!< @brief inputs of the last delay steps
+  size_t head_{0};              //!< @brief index of the oldest input
+};
+
+#endif  // SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_DELAY_BUFFER_HPP_
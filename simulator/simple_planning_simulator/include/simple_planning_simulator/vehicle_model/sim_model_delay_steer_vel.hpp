@@ -15,12 +15,12 @@
 #ifndef SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_DELAY_STEER_VEL_HPP_
 #define SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_DELAY_STEER_VEL_HPP_
 
+#include "simple_planning_simulator/vehicle_model/sim_model_delay_buffer.hpp"
 #include "simple_planning_simulator/vehicle_model/sim_model_interface.hpp"
 
 #include <Eigen/Core>
 #include <Eigen/LU>
 
-#include <deque>
 #include <iostream>
 #include <queue>
 /**
@@ -76,9 +76,9 @@ private:
   double prev_vx_ = 0.0;
   double current_ax_ = 0.0;
 
-  std::deque<double> vx_input_queue_;     //!< @brief buffer for velocity command
-  std::deque<double> steer_input_queue_;  //!< @brief buffer for angular velocity command
-  const double vx_delay_;                 //!< @brief time delay for velocity command [s]
+  DelayBuffer vx_input_queue_;     //!< @brief buffer for velocity command
+  DelayBuffer steer_input_queue_;  //!< @brief buffer for angular velocity command
+  const double vx_delay_;          //!< @brief time delay for velocity command [s]
   const double vx_time_constant_;
   //!< @brief time constant for 1D model of velocity dynamics
   const double steer_delay_;  //!< @brief time delay for angular-velocity command [s]
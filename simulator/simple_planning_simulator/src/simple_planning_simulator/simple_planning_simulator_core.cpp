@@ -117,18 +117,28 @@ SimplePlanningSimulator::SimplePlanningSimulator(const rclcpp::NodeOptions & opt
     "input/initialtwist", QoS{1}, std::bind(&SimplePlanningSimulator::on_initialtwist, this, _1));
   sub_ackermann_cmd_ = create_subscription<AckermannControlCommand>(
     "input/ackermann_control_command", QoS{1},
-    [this](const AckermannControlCommand::ConstSharedPtr msg) { current_ackermann_cmd_ = *msg; });
+    [this](const AckermannControlCommand::ConstSharedPtr msg) {
+      current_ackermann_cmd_ = *msg;
+      on_lockstep_input("ackermann_control_command");
+    });
   sub_manual_ackermann_cmd_ = create_subscription<AckermannControlCommand>(
     "input/manual_ackermann_control_command", QoS{1},
     [this](const AckermannControlCommand::ConstSharedPtr msg) {
       current_manual_ackermann_cmd_ = *msg;
+      on_lockstep_input("manual_ackermann_control_command");
     });
   sub_gear_cmd_ = create_subscription<GearCommand>(
     "input/gear_command", QoS{1},
-    [this](const GearCommand::ConstSharedPtr msg) { current_gear_cmd_ = *msg; });
+    [this](const GearCommand::ConstSharedPtr msg) {
+      current_gear_cmd_ = *msg;
+      on_lockstep_input("gear_command");
+    });
   sub_manual_gear_cmd_ = create_subscription<GearCommand>(
     "input/manual_gear_command", QoS{1},
-    [this](const GearCommand::ConstSharedPtr msg) { current_manual_gear_cmd_ = *msg; });
+    [this](const GearCommand::ConstSharedPtr msg) {
+      current_manual_gear_cmd_ = *msg;
+      on_lockstep_input("manual_gear_command");
+    });
   sub_turn_indicators_cmd_ = create_subscription<TurnIndicatorsCommand>(
     "input/turn_indicators_command", QoS{1},
     std::bind(&SimplePlanningSimulator::on_turn_indicators_cmd, this, _1));
@@ -166,9 +176,35 @@ SimplePlanningSimulator::SimplePlanningSimulator(const rclcpp::NodeOptions & opt
     std::bind(&SimplePlanningSimulator::on_parameter, this, _1));
 
   timer_sampling_time_ms_ = static_cast<uint32_t>(declare_parameter("timer_sampling_time_ms", 25));
-  on_timer_ = rclcpp::create_timer(
-    this, get_clock(), std::chrono::milliseconds(timer_sampling_time_ms_),
-    std::bind(&SimplePlanningSimulator::on_timer, this));
+
+  // In lockstep mode, this node is the clock source and steps the simulation time once all awaited
+  // inputs of the step arrive. The wall timer steps it until the initialization and at timeout.
+  enable_lockstep_ = declare_parameter("enable_lockstep", false);
+  lockstep_timeout_ = declare_parameter("lockstep_timeout", 1.0);
+  const auto lockstep_inputs = declare_parameter<std::vector<std::string>>(
+    "lockstep_inputs", std::vector<std::string>{"ackermann_control_command"});
+  if (enable_lockstep_) {
+    const std::vector<std::string> valid_inputs{
+      "ackermann_control_command", "manual_ackermann_control_command", "gear_command",
+      "manual_gear_command",       "turn_indicators_command",          "hazard_lights_command",
+      "trajectory"};
+    for (const auto & input : lockstep_inputs) {
+      if (std::find(valid_inputs.begin(), valid_inputs.end(), input) == valid_inputs.end()) {
+        throw std::invalid_argument("Invalid lockstep_inputs: " + input);
+      }
+      lockstep_received_[input] = false;
+    }
+    sim_time_ = rclcpp::Time(0, 0, get_clock()->get_clock_type());
+    lockstep_step_time_ = std::chrono::steady_clock::now();
+    pub_clock_ = create_publisher<rosgraph_msgs::msg::Clock>("/clock", rclcpp::ClockQoS());
+    on_timer_ = create_wall_timer(
+      std::chrono::milliseconds(timer_sampling_time_ms_),
+      std::bind(&SimplePlanningSimulator::on_lockstep_timer, this));
+  } else {
+    on_timer_ = rclcpp::create_timer(
+      this, get_clock(), std::chrono::milliseconds(timer_sampling_time_ms_),
+      std::bind(&SimplePlanningSimulator::on_timer, this));
+  }
 
   tier4_api_utils::ServiceProxyNodeInterface proxy(this);
   group_api_service_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
@@ -331,7 +367,7 @@ void SimplePlanningSimulator::on_timer()
 
   // update vehicle dynamics
   {
-    const double dt = delta_time_.get_dt(get_clock()->now());
+    const double dt = delta_time_.get_dt(get_current_time());
 
     if (current_control_mode_.mode == ControlModeReport::AUTONOMOUS) {
       vehicle_model_ptr_->setGear(current_gear_cmd_.command);
@@ -379,6 +415,70 @@ void SimplePlanningSimulator::on_timer()
   publish_tf(current_odometry_);
 }
 
+rclcpp::Time SimplePlanningSimulator::get_current_time()
+{
+  return enable_lockstep_ ? sim_time_ : get_clock()->now();
+}
+
+void SimplePlanningSimulator::on_lockstep_input(const std::string & name)
+{
+  if (!enable_lockstep_) {
+    return;
+  }
+  const auto itr = lockstep_received_.find(name);
+  if (itr == lockstep_received_.end()) {
+    return;
+  }
+  itr->second = true;
+
+  const bool all_received = std::all_of(
+    lockstep_received_.begin(), lockstep_received_.end(),
+    [](const auto & input) { return input.second; });
+  if (is_initialized_ && all_received) {
+    step_lockstep();
+  }
+}
+
+void SimplePlanningSimulator::on_lockstep_timer()
+{
+  // Advance the simulation time at the wall-clock rate until the initialization, since the stack
+  // may need the clock to publish the initial pose.
+  if (is_initialized_) {
+    const double waited_time =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - lockstep_step_time_)
+        .count();
+    if (waited_time < lockstep_timeout_) {
+      return;
+    }
+    std::string pending_inputs;
+    for (const auto & [name, received] : lockstep_received_) {
+      if (!received) {
+        pending_inputs += " " + name;
+      }
+    }
+    RCLCPP_WARN_THROTTLE(
+      get_logger(), *get_clock(), 5000, "lockstep timeout. waiting inputs:%s",
+      pending_inputs.c_str());
+  }
+  step_lockstep();
+}
+
+void SimplePlanningSimulator::step_lockstep()
+{
+  sim_time_ += rclcpp::Duration(std::chrono::milliseconds(timer_sampling_time_ms_));
+  rosgraph_msgs::msg::Clock clock;
+  clock.clock = sim_time_;
+  pub_clock_->publish(clock);
+
+  // Reset the arrivals before publishing the outputs, to which the awaited inputs respond.
+  for (auto & input : lockstep_received_) {
+    input.second = false;
+  }
+  lockstep_step_time_ = std::chrono::steady_clock::now();
+
+  on_timer();
+}
+
 void SimplePlanningSimulator::on_map(const HADMapBin::ConstSharedPtr msg)
 {
   auto lanelet_map_ptr = std::make_shared<lanelet::LaneletMap>();
@@ -468,16 +568,19 @@ void SimplePlanningSimulator::on_turn_indicators_cmd(
   const TurnIndicatorsCommand::ConstSharedPtr msg)
 {
   current_turn_indicators_cmd_ptr_ = msg;
+  on_lockstep_input("turn_indicators_command");
 }
 
 void SimplePlanningSimulator::on_hazard_lights_cmd(const HazardLightsCommand::ConstSharedPtr msg)
 {
   current_hazard_lights_cmd_ptr_ = msg;
+  on_lockstep_input("hazard_lights_command");
 }
 
 void SimplePlanningSimulator::on_trajectory(const Trajectory::ConstSharedPtr msg)
 {
   current_trajectory_ptr_ = msg;
+  on_lockstep_input("trajectory");
 }
 
 void SimplePlanningSimulator::on_engage(const Engage::ConstSharedPtr msg)
@@ -611,7 +714,7 @@ TransformStamped SimplePlanningSimulator::get_transform_msg(
 void SimplePlanningSimulator::publish_velocity(const VelocityReport & velocity)
 {
   VelocityReport msg = velocity;
-  msg.header.stamp = get_clock()->now();
+  msg.header.stamp = get_current_time();
   msg.header.frame_id = simulated_frame_id_;
   pub_velocity_->publish(msg);
 }
@@ -620,7 +723,7 @@ void SimplePlanningSimulator::publish_odometry(const Odometry & odometry)
 {
   Odometry msg = odometry;
   msg.header.frame_id = origin_frame_id_;
-  msg.header.stamp = get_clock()->now();
+  msg.header.stamp = get_current_time();
   msg.child_frame_id = simulated_frame_id_;
   pub_odom_->publish(msg);
 }
@@ -628,7 +731,7 @@ void SimplePlanningSimulator::publish_odometry(const Odometry & odometry)
 void SimplePlanningSimulator::publish_steering(const SteeringReport & steer)
 {
   SteeringReport msg = steer;
-  msg.stamp = get_clock()->now();
+  msg.stamp = get_current_time();
   pub_steer_->publish(msg);
 }
 
@@ -636,7 +739,7 @@ void SimplePlanningSimulator::publish_acceleration()
 {
   AccelWithCovarianceStamped msg;
   msg.header.frame_id = "/base_link";
-  msg.header.stamp = get_clock()->now();
+  msg.header.stamp = get_current_time();
   msg.accel.accel.linear.x = vehicle_model_ptr_->getAx();
   msg.accel.accel.linear.y = vehicle_model_ptr_->getWz() * vehicle_model_ptr_->getVx();
 
@@ -657,7 +760,7 @@ void SimplePlanningSimulator::publish_imu()
 
   sensor_msgs::msg::Imu imu;
   imu.header.frame_id = "base_link";
-  imu.header.stamp = now();
+  imu.header.stamp = get_current_time();
   imu.linear_acceleration.x = vehicle_model_ptr_->getAx();
   imu.linear_acceleration.y = vehicle_model_ptr_->getWz() * vehicle_model_ptr_->getVx();
   constexpr auto COV = 0.001;
@@ -677,14 +780,14 @@ void SimplePlanningSimulator::publish_imu()
 
 void SimplePlanningSimulator::publish_control_mode_report()
 {
-  current_control_mode_.stamp = get_clock()->now();
+  current_control_mode_.stamp = get_current_time();
   pub_control_mode_report_->publish(current_control_mode_);
 }
 
 void SimplePlanningSimulator::publish_gear_report()
 {
   GearReport msg;
-  msg.stamp = get_clock()->now();
+  msg.stamp = get_current_time();
   msg.report = vehicle_model_ptr_->getGear();
   pub_gear_report_->publish(msg);
 }
@@ -695,7 +798,7 @@ void SimplePlanningSimulator::publish_turn_indicators_report()
     return;
   }
   TurnIndicatorsReport msg;
-  msg.stamp = get_clock()->now();
+  msg.stamp = get_current_time();
   msg.report = current_turn_indicators_cmd_ptr_->command;
   pub_turn_indicators_report_->publish(msg);
 }
@@ -706,7 +809,7 @@ void SimplePlanningSimulator::publish_hazard_lights_report()
     return;
   }
   HazardLightsReport msg;
-  msg.stamp = get_clock()->now();
+  msg.stamp = get_current_time();
   msg.report = current_hazard_lights_cmd_ptr_->command;
   pub_hazard_lights_report_->publish(msg);
 }
@@ -714,7 +817,7 @@ void SimplePlanningSimulator::publish_hazard_lights_report()
 void SimplePlanningSimulator::publish_tf(const Odometry & odometry)
 {
   TransformStamped tf;
-  tf.header.stamp = get_clock()->now();
+  tf.header.stamp = get_current_time();
   tf.header.frame_id = origin_frame_id_;
   tf.child_frame_id = simulated_frame_id_;
   tf.transform.translation.x = odometry.pose.pose.position.x;
@@ -0,0 +1,408 @@
+// Copyright 2023 The Autoware Foundation.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "simple_planning_simulator/simple_planning_simulator_fleet.hpp"
+
+#include "rclcpp_components/register_node_macro.hpp"
+#include "simple_planning_simulator/vehicle_model/sim_model.hpp"
+#include "tier4_autoware_utils/geometry/geometry.hpp"
+#include "vehicle_info_util/vehicle_info_util.hpp"
+
+#include <tf2/utils.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+// set the acceleration input in the same way as SimplePlanningSimulator without the road slope
+double get_acc_input(
+  const autoware_auto_control_msgs::msg::AckermannControlCommand & cmd, const uint8_t gear)
+{
+  using autoware_auto_vehicle_msgs::msg::GearCommand;
+  float acc = cmd.longitudinal.acceleration;
+  if (gear == GearCommand::NONE) {
+    acc = 0.0;
+  } else if (gear == GearCommand::REVERSE || gear == GearCommand::REVERSE_2) {
+    acc = -cmd.longitudinal.acceleration;
+  }
+  return acc;
+}
+}  // namespace
+
+namespace simulation
+{
+namespace simple_planning_simulator
+{
+
+SimplePlanningSimulatorFleet::SimplePlanningSimulatorFleet(const rclcpp::NodeOptions & options)
+: Node("simple_planning_simulator_fleet", options)
+{
+  simulated_frame_id_ = declare_parameter("simulated_frame_id", "base_link");
+  origin_frame_id_ = declare_parameter("origin_frame_id", "odom");
+  const bool initial_engage_state = declare_parameter<bool>("initial_engage_state");
+  timer_sampling_time_ms_ = static_cast<uint32_t>(declare_parameter("timer_sampling_time_ms", 25));
+  num_threads_ = static_cast<size_t>(std::max(declare_parameter<int>("num_threads", 1), 1));
+  const auto vehicle_names = declare_parameter<std::vector<std::string>>("vehicle_names");
+
+  // vehicle model parameters shared by all vehicles
+  const auto vehicle_model_type_str = declare_parameter("vehicle_model_type", "IDEAL_STEER_VEL");
+  RCLCPP_INFO(this->get_logger(), "vehicle_model_type = %s", vehicle_model_type_str.c_str());
+
+  const double vel_lim = declare_parameter("vel_lim", 50.0);
+  const double vel_rate_lim = declare_parameter("vel_rate_lim", 7.0);
+  const double steer_lim = declare_parameter("steer_lim", 1.0);
+  const double steer_rate_lim = declare_parameter("steer_rate_lim", 5.0);
+  const double acc_time_delay = declare_parameter("acc_time_delay", 0.1);
+  const double acc_time_constant = declare_parameter("acc_time_constant", 0.1);
+  const double vel_time_delay = declare_parameter("vel_time_delay", 0.25);
+  const double vel_time_constant = declare_parameter("vel_time_constant", 0.5);
+  const double steer_time_delay = declare_parameter("steer_time_delay", 0.24);
+  const double steer_time_constant = declare_parameter("steer_time_constant", 0.27);
+  const auto vehicle_info = vehicle_info_util::VehicleInfoUtil(*this).getVehicleInfo();
+  const double wheelbase = vehicle_info.wheel_base_m;
+  const double dt = timer_sampling_time_ms_ / 1000.0;
+
+  const auto create_vehicle_model = [&]() -> std::shared_ptr<SimModelInterface> {
+    if (vehicle_model_type_str == "IDEAL_STEER_VEL") {
+      return std::make_shared<SimModelIdealSteerVel>(wheelbase);
+    } else if (vehicle_model_type_str == "IDEAL_STEER_ACC") {
+      return std::make_shared<SimModelIdealSteerAcc>(wheelbase);
+    } else if (vehicle_model_type_str == "IDEAL_STEER_ACC_GEARED") {
+      return std::make_shared<SimModelIdealSteerAccGeared>(wheelbase);
+    } else if (vehicle_model_type_str == "DELAY_STEER_VEL") {
+      return std::make_shared<SimModelDelaySteerVel>(
+        vel_lim, steer_lim, vel_rate_lim, steer_rate_lim, wheelbase, dt, vel_time_delay,
+        vel_time_constant, steer_time_delay, steer_time_constant);
+    } else if (vehicle_model_type_str == "DELAY_STEER_ACC") {
+      return std::make_shared<SimModelDelaySteerAcc>(
+        vel_lim, steer_lim, vel_rate_lim, steer_rate_lim, wheelbase, dt, acc_time_delay,
+        acc_time_constant, steer_time_delay, steer_time_constant);
+    } else if (vehicle_model_type_str == "DELAY_STEER_ACC_GEARED") {
+      return std::make_shared<SimModelDelaySteerAccGeared>(
+        vel_lim, steer_lim, vel_rate_lim, steer_rate_lim, wheelbase, dt, acc_time_delay,
+        acc_time_constant, steer_time_delay, steer_time_constant);
+    }
+    throw std::invalid_argument("Invalid vehicle_model_type: " + vehicle_model_type_str);
+  };
+  use_velocity_input_ =
+    vehicle_model_type_str == "IDEAL_STEER_VEL" || vehicle_model_type_str == "DELAY_STEER_VEL";
+
+  // The batch model steps all vehicles at once instead of the model of each vehicle and the
+  // worker threads.
+  const bool use_batch_model = declare_parameter("use_batch_model", true);
+  if (
+    use_batch_model && (vehicle_model_type_str == "DELAY_STEER_ACC" ||
+                        vehicle_model_type_str == "DELAY_STEER_ACC_GEARED")) {
+    batch_model_ = std::make_unique<SimModelBatchDelaySteerAcc>(
+      vehicle_names.size(), vel_lim, steer_lim, vel_rate_lim, steer_rate_lim, wheelbase, dt,
+      acc_time_delay, acc_time_constant, steer_time_delay, steer_time_constant,
+      vehicle_model_type_str == "DELAY_STEER_ACC_GEARED");
+    num_threads_ = 1;
+  }
+
+  // The vehicles are created before the interfaces, which refer to the elements of the vector.
+  vehicles_.resize(vehicle_names.size());
+  for (size_t i = 0; i < vehicle_names.size(); ++i) {
+    auto & vehicle = vehicles_.at(i);
+    vehicle.name = vehicle_names.at(i);
+    vehicle.index = i;
+    if (!batch_model_) {
+      vehicle.vehicle_model_ptr = create_vehicle_model();
+    }
+    vehicle.simulate_motion = initial_engage_state;
+    vehicle.is_initialized = false;
+    vehicle.current_gear_cmd.command = GearCommand::DRIVE;
+  }
+  for (auto & vehicle : vehicles_) {
+    create_vehicle_interfaces(vehicle);
+
+    // x, y, yaw and optionally the velocity. The vehicle waits the initial pose topic if empty.
+    const auto initial_pose =
+      declare_parameter(vehicle.name + ".initial_pose", std::vector<double>{});
+    if (initial_pose.size() == 3 || initial_pose.size() == 4) {
+      const double vx = initial_pose.size() == 4 ? initial_pose.at(3) : 0.0;
+      set_initial_state(vehicle, initial_pose.at(0), initial_pose.at(1), initial_pose.at(2), vx);
+    } else if (!initial_pose.empty()) {
+      throw std::invalid_argument("Invalid initial_pose of " + vehicle.name);
+    }
+  }
+
+  pub_tf_ = create_publisher<tf2_msgs::msg::TFMessage>("/tf", rclcpp::QoS{1});
+
+  // The timer thread steps the vehicles as well as the workers.
+  for (size_t i = 1; i < num_threads_; ++i) {
+    workers_.emplace_back([this, i]() { worker_loop(i); });
+  }
+
+  on_timer_ = rclcpp::create_timer(
+    this, get_clock(), std::chrono::milliseconds(timer_sampling_time_ms_),
+    std::bind(&SimplePlanningSimulatorFleet::on_timer, this));
+}
+
+SimplePlanningSimulatorFleet::~SimplePlanningSimulatorFleet()
+{
+  {
+    std::lock_guard<std::mutex> lock(worker_mutex_);
+    stop_workers_ = true;
+  }
+  worker_start_cv_.notify_all();
+  for (auto & worker : workers_) {
+    worker.join();
+  }
+}
+
+void SimplePlanningSimulatorFleet::create_vehicle_interfaces(FleetVehicle & vehicle)
+{
+  using rclcpp::QoS;
+  FleetVehicle * v = &vehicle;
+  const auto ns = vehicle.name + "/";
+
+  vehicle.sub_ackermann_cmd = create_subscription<AckermannControlCommand>(
+    ns + "input/ackermann_control_command", QoS{1},
+    [v](const AckermannControlCommand::ConstSharedPtr msg) { v->current_ackermann_cmd = *msg; });
+  vehicle.sub_gear_cmd = create_subscription<GearCommand>(
+    ns + "input/gear_command", QoS{1},
+    [v](const GearCommand::ConstSharedPtr msg) { v->current_gear_cmd = *msg; });
+  vehicle.sub_engage = create_subscription<Engage>(
+    ns + "input/engage", QoS{1},
+    [v](const Engage::ConstSharedPtr msg) { v->simulate_motion = msg->engage; });
+
+  // NOTE: the initial pose is assumed to be in the origin frame.
+  vehicle.sub_init_pose = create_subscription<PoseWithCovarianceStamped>(
+    ns + "input/initialpose", QoS{1},
+    [this, v](const PoseWithCovarianceStamped::ConstSharedPtr msg) {
+      const auto & pose = msg->pose.pose;
+      set_initial_state(*v, pose.position.x, pose.position.y, tf2::getYaw(pose.orientation), 0.0);
+    });
+
+  vehicle.pub_velocity = create_publisher<VelocityReport>(ns + "output/twist", QoS{1});
+  vehicle.pub_odom = create_publisher<Odometry>(ns + "output/odometry", QoS{1});
+  vehicle.pub_steer = create_publisher<SteeringReport>(ns + "output/steering", QoS{1});
+  vehicle.pub_acc =
+    create_publisher<AccelWithCovarianceStamped>(ns + "output/acceleration", QoS{1});
+  vehicle.pub_gear_report = create_publisher<GearReport>(ns + "output/gear_report", QoS{1});
+}
+
+void SimplePlanningSimulatorFleet::set_initial_state(
+  FleetVehicle & vehicle, const double x, const double y, const double yaw, const double vx)
+{
+  // The state of each model starts with x, y, yaw, and continues with vx, steer and accx.
+  if (batch_model_) {
+    SimModelBatchDelaySteerAcc::State state = SimModelBatchDelaySteerAcc::State::Zero();
+    state(SimModelBatchDelaySteerAcc::IDX::X) = x;
+    state(SimModelBatchDelaySteerAcc::IDX::Y) = y;
+    state(SimModelBatchDelaySteerAcc::IDX::YAW) = yaw;
+    state(SimModelBatchDelaySteerAcc::IDX::VX) = vx;
+    batch_model_->setState(vehicle.index, state);
+    vehicle.is_initialized = true;
+    return;
+  }
+
+  auto & model = *vehicle.vehicle_model_ptr;
+  Eigen::VectorXd state = Eigen::VectorXd::Zero(model.getDimX());
+  state(0) = x;
+  state(1) = y;
+  state(2) = yaw;
+  if (model.getDimX() > 3) {
+    state(3) = vx;
+  }
+  model.setState(state);
+
+  vehicle.is_initialized = true;
+}
+
+void SimplePlanningSimulatorFleet::on_timer()
+{
+  const auto stamp = get_clock()->now();
+  const double dt = delta_time_.get_dt(stamp);
+
+  // update vehicle dynamics
+  if (batch_model_) {
+    step_batch(dt);
+  } else if (workers_.empty()) {
+    step_vehicles(0, dt);
+  } else {
+    {
+      std::lock_guard<std::mutex> lock(worker_mutex_);
+      worker_dt_ = dt;
+      running_workers_ = workers_.size();
+      ++worker_generation_;
+    }
+    worker_start_cv_.notify_all();
+    step_vehicles(0, dt);
+
+    std::unique_lock<std::mutex> lock(worker_mutex_);
+    worker_done_cv_.wait(lock, [this]() { return running_workers_ == 0; });
+  }
+
+  // publish vehicle states
+  tf2_msgs::msg::TFMessage tf_msg;
+  for (const auto & vehicle : vehicles_) {
+    if (!vehicle.is_initialized) {
+      continue;
+    }
+    publish_vehicle(vehicle, stamp);
+
+    TransformStamped tf;
+    tf.header.stamp = stamp;
+    tf.header.frame_id = origin_frame_id_;
+    tf.child_frame_id = vehicle.name + "/" + simulated_frame_id_;
+    tf.transform.translation.x = vehicle.current_odometry.pose.pose.position.x;
+    tf.transform.translation.y = vehicle.current_odometry.pose.pose.position.y;
+    tf.transform.translation.z = vehicle.current_odometry.pose.pose.position.z;
+    tf.transform.rotation = vehicle.current_odometry.pose.pose.orientation;
+    tf_msg.transforms.push_back(std::move(tf));
+  }
+  if (!tf_msg.transforms.empty()) {
+    pub_tf_->publish(tf_msg);
+  }
+}
+
+void SimplePlanningSimulatorFleet::step_vehicles(const size_t thread_index, const double dt)
+{
+  for (size_t i = thread_index; i < vehicles_.size(); i += num_threads_) {
+    step_vehicle(vehicles_.at(i), dt);
+  }
+}
+
+void SimplePlanningSimulatorFleet::step_vehicle(FleetVehicle & vehicle, const double dt)
+{
+  if (!vehicle.is_initialized) {
+    return;
+  }
+  auto & model = *vehicle.vehicle_model_ptr;
+
+  model.setGear(vehicle.current_gear_cmd.command);
+  const auto & cmd = vehicle.current_ackermann_cmd;
+  const double acc = get_acc_input(cmd, model.getGear());
+  Eigen::VectorXd input(model.getDimU());
+  input << (use_velocity_input_ ? cmd.longitudinal.speed : acc), cmd.lateral.steering_tire_angle;
+  model.setInput(input);
+
+  if (vehicle.simulate_motion) {
+    model.update(dt);
+  }
+
+  set_current_state(
+    vehicle, model.getX(), model.getY(), model.getYaw(), model.getVx(), model.getWz(),
+    model.getSteer(), model.getAx(), model.getGear());
+}
+
+void SimplePlanningSimulatorFleet::step_batch(const double dt)
+{
+  auto & model = *batch_model_;
+  for (const auto & vehicle : vehicles_) {
+    const auto i = vehicle.index;
+    model.setActive(i, vehicle.is_initialized && vehicle.simulate_motion);
+    model.setGear(i, vehicle.current_gear_cmd.command);
+    const auto & cmd = vehicle.current_ackermann_cmd;
+    model.setInput(i, get_acc_input(cmd, model.getGear(i)), cmd.lateral.steering_tire_angle);
+  }
+
+  model.update(dt);
+
+  for (auto & vehicle : vehicles_) {
+    if (!vehicle.is_initialized) {
+      continue;
+    }
+    const auto i = vehicle.index;
+    set_current_state(
+      vehicle, model.getX(i), model.getY(i), model.getYaw(i), model.getVx(i), model.getWz(i),
+      model.getSteer(i), model.getAx(i), model.getGear(i));
+  }
+}
+
+void SimplePlanningSimulatorFleet::set_current_state(
+  FleetVehicle & vehicle, const double x, const double y, const double yaw, const double vx,
+  const double wz, const double steer, const double ax, const uint8_t gear)
+{
+  auto & odometry = vehicle.current_odometry;
+  odometry.pose.pose.position.x = x;
+  odometry.pose.pose.position.y = y;
+  odometry.pose.pose.orientation = tier4_autoware_utils::createQuaternionFromYaw(yaw);
+  odometry.twist.twist.linear.x = vx;
+  odometry.twist.twist.angular.z = wz;
+
+  vehicle.current_velocity.longitudinal_velocity = vx;
+  vehicle.current_velocity.lateral_velocity = 0.0F;
+  vehicle.current_velocity.heading_rate = wz;
+
+  vehicle.current_steer.steering_tire_angle = steer;
+
+  vehicle.current_acc.accel.accel.linear.x = ax;
+  vehicle.current_acc.accel.accel.linear.y = wz * vx;
+
+  vehicle.current_gear.report = gear;
+}
+
+void SimplePlanningSimulatorFleet::worker_loop(const size_t thread_index)
+{
+  uint64_t generation = 0;
+  std::unique_lock<std::mutex> lock(worker_mutex_);
+  while (true) {
+    worker_start_cv_.wait(
+      lock, [this, &generation]() { return stop_workers_ || worker_generation_ != generation; });
+    if (stop_workers_) {
+      return;
+    }
+    generation = worker_generation_;
+    const double dt = worker_dt_;
+    lock.unlock();
+    step_vehicles(thread_index, dt);
+    lock.lock();
+    if (--running_workers_ == 0) {
+      worker_done_cv_.notify_one();
+    }
+  }
+}
+
+void SimplePlanningSimulatorFleet::publish_vehicle(
+  const FleetVehicle & vehicle, const rclcpp::Time & stamp)
+{
+  const auto frame_id = vehicle.name + "/" + simulated_frame_id_;
+
+  Odometry odometry = vehicle.current_odometry;
+  odometry.header.frame_id = origin_frame_id_;
+  odometry.header.stamp = stamp;
+  odometry.child_frame_id = frame_id;
+  vehicle.pub_odom->publish(odometry);
+
+  VelocityReport velocity = vehicle.current_velocity;
+  velocity.header.stamp = stamp;
+  velocity.header.frame_id = frame_id;
+  vehicle.pub_velocity->publish(velocity);
+
+  SteeringReport steer = vehicle.current_steer;
+  steer.stamp = stamp;
+  vehicle.pub_steer->publish(steer);
+
+  AccelWithCovarianceStamped acc = vehicle.current_acc;
+  acc.header.frame_id = frame_id;
+  acc.header.stamp = stamp;
+  vehicle.pub_acc->publish(acc);
+
+  GearReport gear = vehicle.current_gear;
+  gear.stamp = stamp;
+  vehicle.pub_gear_report->publish(gear);
+}
+}  // namespace simple_planning_simulator
+}  // namespace simulation
+
+RCLCPP_COMPONENTS_REGISTER_NODE(simulation::simple_planning_simulator::SimplePlanningSimulatorFleet)
@@ -0,0 +1,185 @@
+// Copyright 2023 The Autoware Foundation.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "simple_planning_simulator/vehicle_model/sim_model_batch_delay_steer_acc.hpp"
+
+#include "autoware_auto_vehicle_msgs/msg/gear_command.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+SimModelBatchDelaySteerAcc::SimModelBatchDelaySteerAcc(
+  size_t num_vehicles, double vx_lim, double steer_lim, double vx_rate_lim, double steer_rate_lim,
+  double wheelbase, double dt, double acc_delay, double acc_time_constant, double steer_delay,
+  double steer_time_constant, bool geared)
+: MIN_TIME_CONSTANT(0.03),
+  num_vehicles_(num_vehicles),
+  vx_lim_(vx_lim),
+  vx_rate_lim_(vx_rate_lim),
+  steer_lim_(steer_lim),
+  steer_rate_lim_(steer_rate_lim),
+  wheelbase_(wheelbase),
+  acc_time_constant_(std::max(acc_time_constant, MIN_TIME_CONSTANT)),
+  steer_time_constant_(std::max(steer_time_constant, MIN_TIME_CONSTANT)),
+  geared_(geared)
+{
+  using autoware_auto_vehicle_msgs::msg::GearCommand;
+  const auto n = static_cast<Eigen::Index>(num_vehicles_);
+  gears_.assign(num_vehicles_, GearCommand::DRIVE);
+  gear_directions_ = Eigen::ArrayXd::Ones(n);
+  active_ = Eigen::Array<bool, Eigen::Dynamic, 1>::Constant(n, true);
+
+  state_ = StateArray::Zero(n, DIM_X);
+  acc_input_ = Eigen::ArrayXd::Zero(n);
+  steer_input_ = Eigen::ArrayXd::Zero(n);
+  acc_input_queue_ =
+    InputBuffer::Zero(static_cast<Eigen::Index>(std::round(acc_delay / dt)), n);
+  steer_input_queue_ =
+    InputBuffer::Zero(static_cast<Eigen::Index>(std::round(steer_delay / dt)), n);
+
+  acc_des_.resize(n);
+  steer_des_.resize(n);
+  vel_.resize(n);
+  acc_.resize(n);
+  prev_state_.resize(n, DIM_X);
+  tmp_state_.resize(n, DIM_X);
+  k1_.resize(n, DIM_X);
+  k2_.resize(n, DIM_X);
+  k3_.resize(n, DIM_X);
+  k4_.resize(n, DIM_X);
+}
+
+SimModelBatchDelaySteerAcc::State SimModelBatchDelaySteerAcc::getState(const size_t i) const
+{
+  return state_.row(static_cast<Eigen::Index>(i)).transpose().matrix();
+}
+
+void SimModelBatchDelaySteerAcc::setState(const size_t i, const State & state)
+{
+  state_.row(static_cast<Eigen::Index>(i)) = state.transpose().array();
+}
+
+void SimModelBatchDelaySteerAcc::setInput(
+  const size_t i, const double acc_des, const double steer_des)
+{
+  acc_input_(static_cast<Eigen::Index>(i)) = acc_des;
+  steer_input_(static_cast<Eigen::Index>(i)) = steer_des;
+}
+
+void SimModelBatchDelaySteerAcc::setGear(const size_t i, const uint8_t gear)
+{
+  using autoware_auto_vehicle_msgs::msg::GearCommand;
+  gears_.at(i) = gear;
+
+  // same classification as SimModelDelaySteerAccGeared::updateStateWithGear
+  double direction = 0.0;
+  if (
+    gear == GearCommand::DRIVE || gear == GearCommand::DRIVE_2 || gear == GearCommand::DRIVE_3 ||
+    gear == GearCommand::DRIVE_4 || gear == GearCommand::DRIVE_5 || gear == GearCommand::DRIVE_6 ||
+    gear == GearCommand::DRIVE_7 || gear == GearCommand::DRIVE_8 || gear == GearCommand::DRIVE_9 ||
+    gear == GearCommand::DRIVE_10 || gear == GearCommand::DRIVE_11 ||
+    gear == GearCommand::DRIVE_12 || gear == GearCommand::DRIVE_13 ||
+    gear == GearCommand::DRIVE_14 || gear == GearCommand::DRIVE_15 ||
+    gear == GearCommand::DRIVE_16 || gear == GearCommand::DRIVE_17 ||
+    gear == GearCommand::DRIVE_18 || gear == GearCommand::LOW || gear == GearCommand::LOW_2) {
+    direction = 1.0;
+  } else if (gear == GearCommand::REVERSE || gear == GearCommand::REVERSE_2) {
+    direction = -1.0;
+  }
+  gear_directions_(static_cast<Eigen::Index>(i)) = direction;
+}
+
+void SimModelBatchDelaySteerAcc::setActive(const size_t i, const bool active)
+{
+  active_(static_cast<Eigen::Index>(i)) = active;
+}
+
+void SimModelBatchDelaySteerAcc::update(const double dt)
+{
+  updateInputQueue();
+
+  // Runge-Kutta integration of all vehicles
+  prev_state_ = state_;
+  calcModel(state_, k1_);
+  tmp_state_ = state_ + k1_ * 0.5 * dt;
+  calcModel(tmp_state_, k2_);
+  tmp_state_ = state_ + k2_ * 0.5 * dt;
+  calcModel(tmp_state_, k3_);
+  tmp_state_ = state_ + k3_ * dt;
+  calcModel(tmp_state_, k4_);
+  state_ += 1.0 / 6.0 * (k1_ + 2.0 * k2_ + 2.0 * k3_ + k4_) * dt;
+
+  // take velocity limit explicitly
+  state_.col(IDX::VX) = state_.col(IDX::VX).min(vx_lim_).max(-vx_lim_);
+
+  if (geared_) {
+    updateStateWithGear(dt);
+  }
+
+  // keep the states of the inactive vehicles
+  for (int j = 0; j < DIM_X; ++j) {
+    state_.col(j) = active_.select(state_.col(j), prev_state_.col(j));
+  }
+}
+
+void SimModelBatchDelaySteerAcc::updateInputQueue()
+{
+  // Same as a queue which pushes the current input and pops the oldest one. The popped inputs are
+  // saturated in advance since they are constant during the integration.
+  if (acc_input_queue_.rows() == 0) {
+    acc_des_ = acc_input_;
+  } else {
+    acc_des_ = acc_input_queue_.row(acc_queue_head_).transpose();
+    acc_input_queue_.row(acc_queue_head_) = acc_input_.transpose();
+    acc_queue_head_ = (acc_queue_head_ + 1) % acc_input_queue_.rows();
+  }
+  if (steer_input_queue_.rows() == 0) {
+    steer_des_ = steer_input_;
+  } else {
+    steer_des_ = steer_input_queue_.row(steer_queue_head_).transpose();
+    steer_input_queue_.row(steer_queue_head_) = steer_input_.transpose();
+    steer_queue_head_ = (steer_queue_head_ + 1) % steer_input_queue_.rows();
+  }
+  acc_des_ = acc_des_.min(vx_rate_lim_).max(-vx_rate_lim_);
+  steer_des_ = steer_des_.min(steer_lim_).max(-steer_lim_);
+}
+
+void SimModelBatchDelaySteerAcc::calcModel(const StateArray & state, StateArray & d_state)
+{
+  vel_ = state.col(IDX::VX).min(vx_lim_).max(-vx_lim_);
+  acc_ = state.col(IDX::ACCX).min(vx_rate_lim_).max(-vx_rate_lim_);
+
+  d_state.col(IDX::X) = vel_ * state.col(IDX::YAW).cos();
+  d_state.col(IDX::Y) = vel_ * state.col(IDX::YAW).sin();
+  d_state.col(IDX::YAW) = vel_ * state.col(IDX::STEER).tan() / wheelbase_;
+  d_state.col(IDX::VX) = acc_;
+  d_state.col(IDX::STEER) = (-(state.col(IDX::STEER) - steer_des_) / steer_time_constant_)
+                              .min(steer_rate_lim_)
+                              .max(-steer_rate_lim_);
+  d_state.col(IDX::ACCX) = -(acc_ - acc_des_) / acc_time_constant_;
+}
+
+void SimModelBatchDelaySteerAcc::updateStateWithGear(const double dt)
+{
+  // update position and velocity first, and then acceleration is calculated naturally
+  const auto vx = state_.col(IDX::VX);
+  const Eigen::Array<bool, Eigen::Dynamic, 1> stop =
+    (gear_directions_ == 0.0) || (gear_directions_ * vx < 0.0);
+  for (const auto j : {IDX::X, IDX::Y, IDX::YAW}) {
+    state_.col(j) = stop.select(prev_state_.col(j), state_.col(j));
+  }
+  state_.col(IDX::ACCX) =
+    stop.select(-prev_state_.col(IDX::VX) / std::max(dt, 1.0e-5), state_.col(IDX::ACCX));
+  state_.col(IDX::VX) = stop.select(0.0, state_.col(IDX::VX));
+}
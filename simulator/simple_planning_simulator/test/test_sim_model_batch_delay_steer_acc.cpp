@@ -0,0 +1,122 @@
+// Copyright 2023 The Autoware Foundation.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "simple_planning_simulator/vehicle_model/sim_model.hpp"
+#include "simple_planning_simulator/vehicle_model/sim_model_batch_delay_steer_acc.hpp"
+
+#include <memory>
+#include <vector>
+
+using autoware_auto_vehicle_msgs::msg::GearCommand;
+
+namespace
+{
+constexpr double vx_lim = 30.0;
+constexpr double steer_lim = 0.6;
+constexpr double vx_rate_lim = 5.0;
+constexpr double steer_rate_lim = 6.28;
+constexpr double wheelbase = 2.7;
+constexpr double dt = 0.025;
+constexpr double acc_delay = 0.1;
+constexpr double acc_time_constant = 0.1;
+constexpr double steer_delay = 0.24;
+constexpr double steer_time_constant = 0.27;
+
+// Compare the batch model with the models of each vehicle for the given gears.
+void expectSameAsSingleModels(const bool geared, const std::vector<uint8_t> & gears)
+{
+  const size_t num_vehicles = gears.size();
+  SimModelBatchDelaySteerAcc batch(
+    num_vehicles, vx_lim, steer_lim, vx_rate_lim, steer_rate_lim, wheelbase, dt, acc_delay,
+    acc_time_constant, steer_delay, steer_time_constant, geared);
+
+  std::vector<std::shared_ptr<SimModelInterface>> models;
+  for (size_t i = 0; i < num_vehicles; ++i) {
+    if (geared) {
+      models.push_back(std::make_shared<SimModelDelaySteerAccGeared>(
+        vx_lim, steer_lim, vx_rate_lim, steer_rate_lim, wheelbase, dt, acc_delay,
+        acc_time_constant, steer_delay, steer_time_constant));
+    } else {
+      models.push_back(std::make_shared<SimModelDelaySteerAcc>(
+        vx_lim, steer_lim, vx_rate_lim, steer_rate_lim, wheelbase, dt, acc_delay,
+        acc_time_constant, steer_delay, steer_time_constant));
+    }
+
+    Eigen::VectorXd state(6);
+    state << 1.0 * i, -2.0 * i, 0.1 * i, 2.0, 0.0, 0.0;
+    models.at(i)->setState(state);
+    batch.setState(i, state);
+    models.at(i)->setGear(gears.at(i));
+    batch.setGear(i, gears.at(i));
+  }
+
+  for (int step = 0; step < 200; ++step) {
+    for (size_t i = 0; i < num_vehicles; ++i) {
+      // accelerate and then decelerate to pass the zero velocity
+      const double acc = (step < 50 ? 1.0 : -3.0) * (1.0 + 0.1 * i);
+      const double steer = 0.8 * std::sin(0.05 * step + i);
+      Eigen::VectorXd input(2);
+      input << acc, steer;
+      models.at(i)->setInput(input);
+      batch.setInput(i, acc, steer);
+      models.at(i)->update(dt);
+    }
+    batch.update(dt);
+
+    for (size_t i = 0; i < num_vehicles; ++i) {
+      const auto & model = models.at(i);
+      EXPECT_NEAR(batch.getX(i), model->getX(), 1e-9);
+      EXPECT_NEAR(batch.getY(i), model->getY(), 1e-9);
+      EXPECT_NEAR(batch.getYaw(i), model->getYaw(), 1e-9);
+      EXPECT_NEAR(batch.getVx(i), model->getVx(), 1e-9);
+      EXPECT_NEAR(batch.getAx(i), model->getAx(), 1e-9);
+      EXPECT_NEAR(batch.getSteer(i), model->getSteer(), 1e-9);
+      EXPECT_NEAR(batch.getWz(i), model->getWz(), 1e-9);
+    }
+  }
+}
+}  // namespace
+
+TEST(TestSimModelBatchDelaySteerAcc, SameAsDelaySteerAcc)
+{
+  expectSameAsSingleModels(false, {GearCommand::DRIVE, GearCommand::DRIVE, GearCommand::REVERSE});
+}
+
+TEST(TestSimModelBatchDelaySteerAcc, SameAsDelaySteerAccGeared)
+{
+  expectSameAsSingleModels(
+    true, {GearCommand::DRIVE, GearCommand::LOW, GearCommand::REVERSE, GearCommand::PARK,
+           GearCommand::NONE});
+}
+
+TEST(TestSimModelBatchDelaySteerAcc, InactiveVehicleKeepsState)
+{
+  SimModelBatchDelaySteerAcc batch(
+    2, vx_lim, steer_lim, vx_rate_lim, steer_rate_lim, wheelbase, dt, acc_delay, acc_time_constant,
+    steer_delay, steer_time_constant, true);
+  SimModelBatchDelaySteerAcc::State state;
+  state << 1.0, 2.0, 0.3, 4.0, 0.1, 0.0;
+  batch.setState(0, state);
+  batch.setState(1, state);
+  batch.setActive(1, false);
+
+  for (int step = 0; step < 10; ++step) {
+    batch.setInput(0, 1.0, 0.2);
+    batch.setInput(1, 1.0, 0.2);
+    batch.update(dt);
+  }
+  EXPECT_GT((batch.getState(0) - state).norm(), 0.1);
+  EXPECT_DOUBLE_EQ((batch.getState(1) - state).norm(), 0.0);
+}
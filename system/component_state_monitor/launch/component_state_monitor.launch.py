@@ -46,12 +46,35 @@ def create_topic_monitor_node(row):
     return IncludeLaunchDescription(include, launch_arguments=arguments)
 
 
+def create_multi_topic_monitor_node(rows):
+    names = [row["args"]["node_name_suffix"] for row in rows]
+    param = {"monitored_topics": names}
+    for row in rows:
+        # The diag names are published as they are, so use the names of the topic monitor nodes.
+        args = {k: v for k, v in row["args"].items() if k != "node_name_suffix"}
+        args["diag_name"] = create_topic_monitor_name(row)
+        name = row["args"]["node_name_suffix"]
+        param.update({f"{name}.{k}": v for k, v in args.items()})
+    return ComposableNode(
+        namespace="component_state_monitor",
+        name="topic_state_monitor",
+        package="topic_state_monitor",
+        plugin="topic_state_monitor::MultiTopicStateMonitorNode",
+        parameters=[param],
+    )
+
+
 def launch_setup(context, *args, **kwargs):
     # create topic monitors
     mode = LaunchConfiguration("mode").perform(context)
     rows = yaml.safe_load(Path(LaunchConfiguration("file").perform(context)).read_text())
     rows = [row for row in rows if mode in row["mode"]]
-    topic_monitor_nodes = [create_topic_monitor_node(row) for row in rows]
+    use_multi_topic_monitor = LaunchConfiguration("use_multi_topic_monitor").perform(context)
+    use_multi_topic_monitor = use_multi_topic_monitor.lower() == "true"
+    if use_multi_topic_monitor:
+        topic_monitor_nodes = []
+    else:
+        topic_monitor_nodes = [create_topic_monitor_node(row) for row in rows]
     topic_monitor_names = [create_topic_monitor_name(row) for row in rows]
     topic_monitor_param = defaultdict(lambda: defaultdict(list))
     for row in rows:
@@ -59,6 +82,7 @@ def launch_setup(context, *args, **kwargs):
     topic_monitor_param = {name: dict(module) for name, module in topic_monitor_param.items()}
 
     # create component
+    components = [create_multi_topic_monitor_node(rows)] if use_multi_topic_monitor else []
     component = ComposableNode(
         namespace="component_state_monitor",
         name="component",
@@ -71,7 +95,7 @@ def launch_setup(context, *args, **kwargs):
         name="container",
         package="rclcpp_components",
         executable="component_container",
-        composable_node_descriptions=[component],
+        composable_node_descriptions=[component, *components],
     )
     return [container, *topic_monitor_nodes]
 
@@ -81,6 +105,7 @@ def generate_launch_description():
         [
             DeclareLaunchArgument("file"),
             DeclareLaunchArgument("mode"),
+            DeclareLaunchArgument("use_multi_topic_monitor", default_value="false"),
             OpaqueFunction(function=launch_setup),
         ]
     )
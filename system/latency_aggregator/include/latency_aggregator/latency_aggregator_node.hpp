@@ -0,0 +1,55 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LATENCY_AGGREGATOR__LATENCY_AGGREGATOR_NODE_HPP_
+#define LATENCY_AGGREGATOR__LATENCY_AGGREGATOR_NODE_HPP_
+
+#include "latency_aggregator/latency_graph.hpp"
+
+#include <diagnostic_updater/diagnostic_updater.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <latency_aggregator/msg/latency_hop.hpp>
+#include <latency_aggregator/msg/latency_path.hpp>
+
+#include <string>
+
+namespace latency_aggregator
+{
+using latency_aggregator::msg::LatencyHop;
+using latency_aggregator::msg::LatencyPath;
+
+class LatencyAggregatorNode : public rclcpp::Node
+{
+public:
+  explicit LatencyAggregatorNode(const rclcpp::NodeOptions & node_options);
+
+private:
+  void onHop(const LatencyHop::ConstSharedPtr msg);
+  void produceDiagnostics(diagnostic_updater::DiagnosticStatusWrapper & stat);
+
+  // parameter
+  std::string output_topic_;
+  double latency_threshold_ms_;
+
+  LatencyGraph graph_;
+  LatencyStatistics statistics_;
+
+  rclcpp::Subscription<LatencyHop>::SharedPtr sub_hop_;
+  rclcpp::Publisher<LatencyPath>::SharedPtr pub_critical_path_;
+  diagnostic_updater::Updater updater_{this};
+};
+}  // namespace latency_aggregator
+
+#endif  // LATENCY_AGGREGATOR__LATENCY_AGGREGATOR_NODE_HPP_
@@ -0,0 +1,129 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LATENCY_AGGREGATOR__LATENCY_GRAPH_HPP_
+#define LATENCY_AGGREGATOR__LATENCY_GRAPH_HPP_
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace latency_aggregator
+{
+// NOTE: all the stamps and times are in nanoseconds
+
+struct HopInput
+{
+  std::string topic;
+  int64_t stamp{0};
+  int64_t received_time{0};
+};
+
+struct Hop
+{
+  std::string node_name;
+  std::string output_topic;
+  int64_t output_stamp{0};
+  int64_t published_time{0};
+  std::vector<HopInput> inputs;
+};
+
+struct PathSegment
+{
+  std::string node_name;
+  std::string input_topic;
+  // published time of the input, or the sensor stamp for the first segment
+  int64_t input_published_time{0};
+  int64_t received_time{0};
+  int64_t published_time{0};
+};
+
+struct CriticalPath
+{
+  std::string origin_topic;
+  int64_t origin_stamp{0};
+  // from the first node with the sensor input to the node of the output
+  std::vector<PathSegment> segments;
+
+  int64_t latency() const { return segments.back().published_time - origin_stamp; }
+};
+
+/**
+ * @brief graph of the hops connected by the topics and the header stamps of the messages
+ * @details The input of a hop is connected to the hop whose output has the same topic and stamp.
+ * An input without such a hop is regarded as a sensor input, whose stamp is the origin of the
+ * latency. The critical path of an output is the path to the oldest origin.
+ */
+class LatencyGraph
+{
+public:
+  /**
+   * @param buffer_duration hops published before this duration from the latest hop are removed
+   */
+  explicit LatencyGraph(const int64_t buffer_duration) : buffer_duration_(buffer_duration) {}
+
+  void addHop(const Hop & hop);
+
+  /**
+   * @brief find the critical path to the output of the topic and the stamp
+   * @return std::nullopt if no hop with the output is added
+   */
+  std::optional<CriticalPath> findCriticalPath(
+    const std::string & output_topic, const int64_t output_stamp) const;
+
+  size_t size() const { return hops_.size(); }
+
+private:
+  using Key = std::pair<std::string, int64_t>;
+
+  // critical path to the hop without the segment of the hop itself
+  void findCriticalPath(const Hop & hop, const size_t depth, CriticalPath & path) const;
+
+  int64_t buffer_duration_;
+  std::map<Key, Hop> hops_;
+  std::deque<std::pair<int64_t, Key>> published_keys_;
+};
+
+/**
+ * @brief latencies of the latest outputs for their percentiles
+ */
+class LatencyStatistics
+{
+public:
+  explicit LatencyStatistics(const size_t window_size) : window_size_(window_size) {}
+
+  void add(const double latency);
+
+  size_t size() const { return latencies_.size(); }
+  bool empty() const { return latencies_.empty(); }
+
+  /**
+   * @brief nearest rank percentile of the latencies in the window
+   * @param percentile in [0, 100]
+   */
+  double calcPercentile(const double percentile) const;
+  double calcMean() const;
+  double calcMax() const;
+
+private:
+  size_t window_size_;
+  std::deque<double> latencies_;
+};
+}  // namespace latency_aggregator
+
+#endif  // LATENCY_AGGREGATOR__LATENCY_GRAPH_HPP_
@@ -0,0 +1,101 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LATENCY_AGGREGATOR__LATENCY_HOP_PUBLISHER_HPP_
+#define LATENCY_AGGREGATOR__LATENCY_HOP_PUBLISHER_HPP_
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <builtin_interfaces/msg/time.hpp>
+#include <latency_aggregator/msg/latency_hop.hpp>
+#include <latency_aggregator/msg/latency_hop_input.hpp>
+
+#include <string>
+#include <vector>
+
+namespace latency_aggregator
+{
+using latency_aggregator::msg::LatencyHop;
+using latency_aggregator::msg::LatencyHopInput;
+
+/**
+ * @brief publisher of the hops of a node for the end-to-end latency
+ * @details A hop is the pair of the header stamps of an output message and of the input messages
+ * used for it, which is published on the topic shared by all the nodes. The hops are connected by
+ * the latency_aggregator node from the sensor stamps to the monitored output. Nothing is published
+ * while the aggregator is not running.
+ */
+class LatencyHopPublisher
+{
+public:
+  /**
+   * @param output_topic topic of the output message, e.g. publisher->get_topic_name()
+   */
+  LatencyHopPublisher(rclcpp::Node * node, const std::string & output_topic)
+  : clock_(node->get_clock()),
+    node_name_(node->get_fully_qualified_name()),
+    output_topic_(output_topic),
+    pub_(node->create_publisher<LatencyHop>("/system/latency_hop", rclcpp::QoS{100}))
+  {
+  }
+
+  /**
+   * @brief input message whose processing starts now
+   * @param topic topic of the input message, e.g. subscription->get_topic_name()
+   */
+  LatencyHopInput createInput(
+    const std::string & topic, const builtin_interfaces::msg::Time & stamp) const
+  {
+    LatencyHopInput input;
+    input.topic = topic;
+    input.stamp = stamp;
+    input.received_time = clock_->now();
+    return input;
+  }
+
+  /**
+   * @brief publish the hop of the output message just published
+   */
+  void publish(
+    const std::vector<LatencyHopInput> & inputs,
+    const builtin_interfaces::msg::Time & output_stamp) const
+  {
+    if (pub_->get_subscription_count() + pub_->get_intra_process_subscription_count() < 1) {
+      return;
+    }
+
+    LatencyHop hop;
+    hop.node_name = node_name_;
+    hop.output_topic = output_topic_;
+    hop.output_stamp = output_stamp;
+    hop.published_time = clock_->now();
+    hop.inputs = inputs;
+    pub_->publish(hop);
+  }
+
+  void publish(
+    const LatencyHopInput & input, const builtin_interfaces::msg::Time & output_stamp) const
+  {
+    publish(std::vector<LatencyHopInput>{input}, output_stamp);
+  }
+
+private:
+  rclcpp::Clock::SharedPtr clock_;
+  std::string node_name_;
+  std::string output_topic_;
+  rclcpp::Publisher<LatencyHop>::SharedPtr pub_;
+};
+}  // namespace latency_aggregator
+
+#endif  // LATENCY_AGGREGATOR__LATENCY_HOP_PUBLISHER_HPP_
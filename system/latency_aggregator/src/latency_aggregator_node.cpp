@@ -0,0 +1,134 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "latency_aggregator/latency_aggregator_node.hpp"
+
+#include <diagnostic_updater/diagnostic_updater.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <latency_aggregator/msg/latency_path_segment.hpp>
+
+#include <string>
+
+namespace latency_aggregator
+{
+namespace
+{
+int64_t toNanoseconds(const builtin_interfaces::msg::Time & stamp)
+{
+  return rclcpp::Time(stamp).nanoseconds();
+}
+
+double toMilliseconds(const int64_t duration)
+{
+  return static_cast<double>(duration) * 1e-6;
+}
+
+Hop convertToHop(const LatencyHop & msg)
+{
+  Hop hop;
+  hop.node_name = msg.node_name;
+  hop.output_topic = msg.output_topic;
+  hop.output_stamp = toNanoseconds(msg.output_stamp);
+  hop.published_time = toNanoseconds(msg.published_time);
+  for (const auto & input : msg.inputs) {
+    hop.inputs.push_back(
+      HopInput{input.topic, toNanoseconds(input.stamp), toNanoseconds(input.received_time)});
+  }
+  return hop;
+}
+
+LatencyPath convertToLatencyPath(const CriticalPath & path)
+{
+  LatencyPath msg;
+  msg.stamp = rclcpp::Time(path.segments.back().published_time);
+  msg.origin_topic = path.origin_topic;
+  msg.origin_stamp = rclcpp::Time(path.origin_stamp);
+  msg.latency_ms = toMilliseconds(path.latency());
+  for (const auto & segment : path.segments) {
+    latency_aggregator::msg::LatencyPathSegment segment_msg;
+    segment_msg.node_name = segment.node_name;
+    segment_msg.input_topic = segment.input_topic;
+    segment_msg.wait_time_ms = toMilliseconds(segment.received_time - segment.input_published_time);
+    segment_msg.processing_time_ms =
+      toMilliseconds(segment.published_time - segment.received_time);
+    msg.segments.push_back(segment_msg);
+  }
+  return msg;
+}
+}  // namespace
+
+LatencyAggregatorNode::LatencyAggregatorNode(const rclcpp::NodeOptions & node_options)
+: Node("latency_aggregator", node_options),
+  output_topic_(declare_parameter<std::string>("output_topic")),
+  latency_threshold_ms_(declare_parameter<double>("latency_threshold_ms")),
+  graph_(
+    rclcpp::Duration::from_seconds(declare_parameter<double>("buffer_duration")).nanoseconds()),
+  statistics_(declare_parameter<int>("statistics_window_size"))
+{
+  using std::placeholders::_1;
+
+  sub_hop_ = create_subscription<LatencyHop>(
+    "/system/latency_hop", rclcpp::QoS{100}, std::bind(&LatencyAggregatorNode::onHop, this, _1));
+  pub_critical_path_ = create_publisher<LatencyPath>("~/output/critical_path", 1);
+
+  updater_.setHardwareID("latency_aggregator");
+  updater_.add("end_to_end_latency", this, &LatencyAggregatorNode::produceDiagnostics);
+}
+
+void LatencyAggregatorNode::onHop(const LatencyHop::ConstSharedPtr msg)
+{
+  const auto hop = convertToHop(*msg);
+  graph_.addHop(hop);
+  if (hop.output_topic != output_topic_) {
+    return;
+  }
+
+  const auto path = graph_.findCriticalPath(hop.output_topic, hop.output_stamp);
+  if (!path) {
+    return;
+  }
+  const auto path_msg = convertToLatencyPath(*path);
+  statistics_.add(path_msg.latency_ms);
+  pub_critical_path_->publish(path_msg);
+}
+
+void LatencyAggregatorNode::produceDiagnostics(diagnostic_updater::DiagnosticStatusWrapper & stat)
+{
+  using diagnostic_msgs::msg::DiagnosticStatus;
+
+  if (statistics_.empty()) {
+    stat.summary(DiagnosticStatus::WARN, "no hop of " + output_topic_ + " is received");
+    return;
+  }
+
+  const double p99_latency_ms = statistics_.calcPercentile(99.0);
+  stat.add("output_topic", output_topic_);
+  stat.add("count", statistics_.size());
+  stat.add("mean [ms]", statistics_.calcMean());
+  stat.add("p50 [ms]", statistics_.calcPercentile(50.0));
+  stat.add("p90 [ms]", statistics_.calcPercentile(90.0));
+  stat.add("p99 [ms]", p99_latency_ms);
+  stat.add("max [ms]", statistics_.calcMax());
+
+  if (latency_threshold_ms_ < p99_latency_ms) {
+    stat.summary(DiagnosticStatus::WARN, "p99 latency exceeds the threshold");
+  } else {
+    stat.summary(DiagnosticStatus::OK, "OK");
+  }
+}
+}  // namespace latency_aggregator
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(latency_aggregator::LatencyAggregatorNode)
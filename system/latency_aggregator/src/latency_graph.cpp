@@ -0,0 +1,130 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "latency_aggregator/latency_graph.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace latency_aggregator
+{
+namespace
+{
+// the hops deeper than this are regarded as a loop of the topics
+constexpr size_t max_depth = 64;
+}  // namespace
+
+void LatencyGraph::addHop(const Hop & hop)
+{
+  if (hop.inputs.empty()) {
+    return;
+  }
+
+  Key key{hop.output_topic, hop.output_stamp};
+  hops_[key] = hop;
+  published_keys_.emplace_back(hop.published_time, std::move(key));
+
+  // remove the old hops
+  while (!published_keys_.empty() &&
+         published_keys_.front().first < hop.published_time - buffer_duration_) {
+    const auto itr = hops_.find(published_keys_.front().second);
+    // NOTE: the hop may be overwritten by a later one with the same output
+    if (itr != hops_.end() && itr->second.published_time == published_keys_.front().first) {
+      hops_.erase(itr);
+    }
+    published_keys_.pop_front();
+  }
+}
+
+std::optional<CriticalPath> LatencyGraph::findCriticalPath(
+  const std::string & output_topic, const int64_t output_stamp) const
+{
+  const auto itr = hops_.find(Key{output_topic, output_stamp});
+  if (itr == hops_.end()) {
+    return std::nullopt;
+  }
+
+  CriticalPath path;
+  findCriticalPath(itr->second, 0, path);
+  return path;
+}
+
+void LatencyGraph::findCriticalPath(const Hop & hop, const size_t depth, CriticalPath & path) const
+{
+  std::optional<CriticalPath> critical_path;
+  for (const auto & input : hop.inputs) {
+    CriticalPath input_path;
+    int64_t input_published_time = input.stamp;
+
+    const auto upstream_itr = hops_.find(Key{input.topic, input.stamp});
+    if (upstream_itr != hops_.end() && depth < max_depth) {
+      findCriticalPath(upstream_itr->second, depth + 1, input_path);
+      input_published_time = upstream_itr->second.published_time;
+    } else {
+      // sensor input
+      input_path.origin_topic = input.topic;
+      input_path.origin_stamp = input.stamp;
+    }
+    input_path.segments.push_back(PathSegment{
+      hop.node_name, input.topic, input_published_time, input.received_time, hop.published_time});
+
+    if (!critical_path || input_path.origin_stamp < critical_path->origin_stamp) {
+      critical_path = std::move(input_path);
+    }
+  }
+  path = std::move(*critical_path);
+}
+
+void LatencyStatistics::add(const double latency)
+{
+  latencies_.push_back(latency);
+  while (latencies_.size() > window_size_) {
+    latencies_.pop_front();
+  }
+}
+
+double LatencyStatistics::calcPercentile(const double percentile) const
+{
+  if (latencies_.empty()) {
+    return 0.0;
+  }
+
+  std::vector<double> latencies(latencies_.begin(), latencies_.end());
+  const size_t rank = static_cast<size_t>(
+    std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * latencies.size()));
+  const size_t idx = std::max(rank, static_cast<size_t>(1)) - 1;
+  std::nth_element(latencies.begin(), latencies.begin() + idx, latencies.end());
+  return latencies.at(idx);
+}
+
+double LatencyStatistics::calcMean() const
+{
+  if (latencies_.empty()) {
+    return 0.0;
+  }
+  return std::accumulate(latencies_.begin(), latencies_.end(), 0.0) / latencies_.size();
+}
+
+double LatencyStatistics::calcMax() const
+{
+  if (latencies_.empty()) {
+    return 0.0;
+  }
+  return *std::max_element(latencies_.begin(), latencies_.end());
+}
+}  // namespace latency_aggregator
@@ -0,0 +1,111 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "latency_aggregator/latency_graph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using latency_aggregator::Hop;
+using latency_aggregator::HopInput;
+using latency_aggregator::LatencyGraph;
+using latency_aggregator::LatencyStatistics;
+
+namespace
+{
+Hop createHop(
+  const std::string & node_name, const std::vector<HopInput> & inputs,
+  const std::string & output_topic, const int64_t output_stamp, const int64_t published_time)
+{
+  return Hop{node_name, output_topic, output_stamp, published_time, inputs};
+}
+}  // namespace
+
+TEST(LatencyGraph, findCriticalPath)
+{
+  LatencyGraph graph(1000);
+
+  // pointcloud (stamp 100) -> filter -> tracker -> planner <- trajectory (stamp 150)
+  graph.addHop(createHop("filter", {{"/points_raw", 100, 110}}, "/points", 100, 120));
+  graph.addHop(createHop("tracker", {{"/points", 100, 125}}, "/objects", 100, 140));
+  graph.addHop(createHop(
+    "planner", {{"/trajectory_in", 150, 160}, {"/objects", 100, 160}}, "/trajectory", 160, 170));
+  graph.addHop(createHop("controller", {{"/trajectory", 160, 175}}, "/control_cmd", 180, 180));
+
+  EXPECT_FALSE(graph.findCriticalPath("/control_cmd", 190));
+
+  const auto path = graph.findCriticalPath("/control_cmd", 180);
+  ASSERT_TRUE(path);
+  EXPECT_EQ(path->origin_topic, "/points_raw");
+  EXPECT_EQ(path->origin_stamp, 100);
+  EXPECT_EQ(path->latency(), 80);
+
+  const std::vector<std::string> node_names{"filter", "tracker", "planner", "controller"};
+  ASSERT_EQ(path->segments.size(), node_names.size());
+  for (size_t i = 0; i < node_names.size(); ++i) {
+    EXPECT_EQ(path->segments.at(i).node_name, node_names.at(i));
+  }
+
+  // the input of the planner through the objects
+  const auto & planner_segment = path->segments.at(2);
+  EXPECT_EQ(planner_segment.input_topic, "/objects");
+  EXPECT_EQ(planner_segment.input_published_time, 140);
+  EXPECT_EQ(planner_segment.received_time, 160);
+  EXPECT_EQ(planner_segment.published_time, 170);
+
+  // the first segment starts at the sensor stamp
+  EXPECT_EQ(path->segments.front().input_published_time, 100);
+}
+
+TEST(LatencyGraph, removeOldHops)
+{
+  LatencyGraph graph(100);
+
+  graph.addHop(createHop("filter", {{"/points_raw", 0, 10}}, "/points", 0, 20));
+  graph.addHop(createHop("tracker", {{"/points", 0, 30}}, "/objects", 0, 40));
+  EXPECT_EQ(graph.size(), 2U);
+
+  // the hop of the filter is removed, so that the tracker has the sensor input
+  graph.addHop(createHop("filter", {{"/points_raw", 100, 110}}, "/points", 100, 130));
+  EXPECT_EQ(graph.size(), 2U);
+  const auto path = graph.findCriticalPath("/objects", 0);
+  ASSERT_TRUE(path);
+  EXPECT_EQ(path->origin_topic, "/points");
+  ASSERT_EQ(path->segments.size(), 1U);
+
+  // hops without inputs are ignored
+  graph.addHop(createHop("filter", {}, "/points", 200, 200));
+  EXPECT_FALSE(graph.findCriticalPath("/points", 200));
+}
+
+TEST(LatencyStatistics, calcPercentile)
+{
+  LatencyStatistics statistics(100);
+  EXPECT_TRUE(statistics.empty());
+  EXPECT_DOUBLE_EQ(statistics.calcPercentile(99.0), 0.0);
+
+  // only the latest 100 latencies are kept
+  for (int i = 0; i < 200; ++i) {
+    statistics.add(static_cast<double>(i));
+  }
+  EXPECT_EQ(statistics.size(), 100U);
+  EXPECT_DOUBLE_EQ(statistics.calcPercentile(0.0), 100.0);
+  EXPECT_DOUBLE_EQ(statistics.calcPercentile(50.0), 149.0);
+  EXPECT_DOUBLE_EQ(statistics.calcPercentile(99.0), 198.0);
+  EXPECT_DOUBLE_EQ(statistics.calcPercentile(100.0), 199.0);
+  EXPECT_DOUBLE_EQ(statistics.calcMax(), 199.0);
+  EXPECT_DOUBLE_EQ(statistics.calcMean(), 149.5);
+}
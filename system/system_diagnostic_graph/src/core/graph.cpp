@@ -156,8 +156,34 @@ void Graph::init(const std::string & file, const std::string & mode)
     nodes[i]->set_index(i);
   }
 
+  // Create the reverse links to notify the level changes to the dependent nodes.
+  std::vector<std::vector<size_t>> parents(nodes.size());
+  for (const auto & node : nodes) {
+    for (const auto & link : node->links()) {
+      parents[link->index()].push_back(node->index());
+    }
+  }
+
+  // Evaluate all nodes at the first update.
+  std::vector<DiagnosticNode> reports;
+  reports.reserve(nodes.size());
+  for (const auto & node : nodes) {
+    reports.push_back(node->report());
+    pending_.insert(node->index());
+  }
+
   nodes_ = std::move(nodes);
   diags_ = diags;
+  parents_ = std::move(parents);
+  reports_ = std::move(reports);
+}
+
+void Graph::notify(const BaseNode * node, DiagnosticLevel level)
+{
+  changes_.insert(node->index());
+  if (node->level() != level) {
+    pending_.insert(parents_[node->index()].begin(), parents_[node->index()].end());
+  }
 }
 
 void Graph::callback(const DiagnosticArray & array, const rclcpp::Time & stamp)
@@ -165,18 +191,42 @@ void Graph::callback(const DiagnosticArray & array, const rclcpp::Time & stamp)
   for (const auto & status : array.status) {
     const auto iter = diags_.find(status.name);
     if (iter != diags_.end()) {
+      const auto level = iter->second->level();
       iter->second->callback(status, stamp);
+      notify(iter->second, level);
     } else {
+      const auto level = unknown_->level();
       unknown_->callback(status, stamp);
+      notify(unknown_, level);
     }
   }
 }
 
 void Graph::update(const rclcpp::Time & stamp)
 {
-  for (const auto & node : nodes_) {
-    node->update(stamp);
+  for (const auto & [name, diag] : diags_) {
+    const auto level = diag->level();
+    if (diag->update(stamp)) {
+      notify(diag, level);
+    }
+  }
+
+  // The dependent nodes always have the larger index than the nodes they depend on, so popping
+  // the smallest index evaluates the nodes in topological order even if more nodes are notified.
+  while (!pending_.empty()) {
+    const auto index = *pending_.begin();
+    pending_.erase(pending_.begin());
+    const auto & node = nodes_[index];
+    const auto level = node->level();
+    if (node->update(stamp)) {
+      notify(node.get(), level);
+    }
+  }
+
+  for (const auto index : changes_) {
+    reports_[index] = nodes_[index]->report();
   }
+  changes_.clear();
   stamp_ = stamp;
 }
 
@@ -184,10 +234,7 @@ DiagnosticGraph Graph::message() const
 {
   DiagnosticGraph result;
   result.stamp = stamp_;
-  result.nodes.reserve(nodes_.size());
-  for (const auto & node : nodes_) {
-    result.nodes.push_back(node->report());
-  }
+  result.nodes = reports_;
   return result;
 }
 
@@ -20,6 +20,7 @@
 #include <rclcpp/rclcpp.hpp>
 
 #include <memory>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -43,10 +44,18 @@ public:
   void debug();
 
 private:
+  void notify(const BaseNode * node, DiagnosticLevel level);
+
   std::vector<std::unique_ptr<BaseNode>> nodes_;
   std::unordered_map<std::string, DiagNode *> diags_;
   UnknownNode * unknown_;
   rclcpp::Time stamp_;
+
+  // The nodes are evaluated only when the levels of the dependencies are changed.
+  std::vector<std::vector<size_t>> parents_;
+  std::vector<DiagnosticNode> reports_;
+  std::set<size_t> pending_;
+  std::set<size_t> changes_;
 };
 
 }  // namespace system_diagnostic_graph
@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <utility>
+#include <vector>
 
 namespace system_diagnostic_graph
 {
@@ -44,17 +45,21 @@ void UnitNode::create(ConfigObject & config, ExprInit & exprs)
   expr_ = exprs.create(parse_expr_config(config));
 }
 
-void UnitNode::update(const rclcpp::Time &)
+bool UnitNode::update(const rclcpp::Time &)
 {
   const auto result = expr_->eval();
-  level_ = result.level;
-  links_.clear();
+  std::vector<DiagnosticLink> links;
   for (const auto & [node, used] : result.links) {
     DiagnosticLink link;
     link.index = node->index();
     link.used = used;
-    links_.push_back(link);
+    links.push_back(link);
   }
+
+  const bool changed = level_ != result.level || links_ != links;
+  level_ = result.level;
+  links_ = std::move(links);
+  return changed;
 }
 
 DiagnosticNode UnitNode::report() const
@@ -88,7 +93,7 @@ void DiagNode::create(ConfigObject &, ExprInit &)
 {
 }
 
-void DiagNode::update(const rclcpp::Time & stamp)
+bool DiagNode::update(const rclcpp::Time & stamp)
 {
   if (time_) {
     const auto elapsed = (stamp - time_.value()).seconds();
@@ -96,8 +101,10 @@ void DiagNode::update(const rclcpp::Time & stamp)
       status_ = DiagnosticStatus();
       status_.level = DiagnosticStatus::STALE;
       time_ = std::nullopt;
+      return true;
     }
   }
+  return false;
 }
 
 DiagnosticNode DiagNode::report() const
@@ -127,9 +134,10 @@ void UnknownNode::create(ConfigObject &, ExprInit &)
 {
 }
 
-void UnknownNode::update(const rclcpp::Time & stamp)
+bool UnknownNode::update(const rclcpp::Time & stamp)
 {
   (void)stamp;
+  return false;
 }
 
 DiagnosticNode UnknownNode::report() const
@@ -37,7 +37,7 @@ public:
   explicit BaseNode(const std::string & path);
   virtual ~BaseNode() = default;
   virtual void create(ConfigObject & config, ExprInit & exprs) = 0;
-  virtual void update(const rclcpp::Time & stamp) = 0;
+  virtual bool update(const rclcpp::Time & stamp) = 0;  // Returns true if the report is changed.
   virtual DiagnosticNode report() const = 0;
   virtual DiagnosticLevel level() const = 0;
   virtual DiagDebugData debug() const = 0;
@@ -59,7 +59,7 @@ public:
   explicit UnitNode(const std::string & path);
   ~UnitNode() override;
   void create(ConfigObject & config, ExprInit & exprs) override;
-  void update(const rclcpp::Time & stamp) override;
+  bool update(const rclcpp::Time & stamp) override;
   DiagnosticNode report() const override;
   DiagnosticLevel level() const override;
   DiagDebugData debug() const override;
@@ -76,7 +76,7 @@ class DiagNode : public BaseNode
 public:
   DiagNode(const std::string & path, ConfigObject & config);
   void create(ConfigObject & config, ExprInit & exprs) override;
-  void update(const rclcpp::Time & stamp) override;
+  bool update(const rclcpp::Time & stamp) override;
   DiagnosticNode report() const override;
   DiagnosticLevel level() const override;
   DiagDebugData debug() const override;
@@ -97,7 +97,7 @@ class UnknownNode : public BaseNode
 public:
   explicit UnknownNode(const std::string & path);
   void create(ConfigObject & config, ExprInit & exprs) override;
-  void update(const rclcpp::Time & stamp) override;
+  bool update(const rclcpp::Time & stamp) override;
   DiagnosticNode report() const override;
   DiagnosticLevel level() const override;
   DiagDebugData debug() const override;
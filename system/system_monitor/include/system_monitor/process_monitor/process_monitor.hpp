@@ -21,6 +21,7 @@
 #define SYSTEM_MONITOR__PROCESS_MONITOR__PROCESS_MONITOR_HPP_
 
 #include "system_monitor/process_monitor/diag_task.hpp"
+#include "system_monitor/process_monitor/procfs_collector.hpp"
 
 #include <diagnostic_updater/diagnostic_updater.hpp>
 
@@ -54,6 +55,23 @@ protected:
   void monitorProcesses(
     diagnostic_updater::DiagnosticStatusWrapper & stat);  // NOLINT(runtime/references)
 
+  /**
+   * @brief monitor processes with the result of procfs collector
+   * @param [out] stat diagnostic message passed directly to diagnostic publish calls
+   * @note NOLINT syntax is needed since diagnostic_updater asks for a non-const reference
+   * to pass diagnostic message updated in this function to diagnostic publish calls.
+   */
+  void monitorProcessesWithProcfs(
+    diagnostic_updater::DiagnosticStatusWrapper & stat);  // NOLINT(runtime/references)
+
+  /**
+   * @brief set top-rated processes
+   * @param [in] tasks list of diagnostics tasks for high load procs
+   * @param [in] procs list of top-rated process information
+   */
+  void setTopratedProcesses(
+    std::vector<std::shared_ptr<DiagTask>> * tasks, const std::vector<ProcessInfo> & procs);
+
   /**
    * @brief get task summary
    * @param [out] stat diagnostic message passed directly to diagnostic publish calls
@@ -119,11 +137,17 @@ protected:
    */
   void onTimer();
 
+  /**
+   * @brief timer callback to read procfs
+   */
+  void onTimerWithProcfs();
+
   diagnostic_updater::Updater updater_;  //!< @brief Updater class which advertises to /diagnostics
 
   char hostname_[HOST_NAME_MAX + 1];  //!< @brief host name
 
   int num_of_procs_;  //!< @brief number of processes to show
+  bool use_procfs_;   //!< @brief flag to read procfs instead of executing top command
   std::vector<std::shared_ptr<DiagTask>>
     load_tasks_;  //!< @brief list of diagnostics tasks for high load procs
   std::vector<std::shared_ptr<DiagTask>>
@@ -135,6 +159,12 @@ protected:
   double elapsed_ms_;                   //!< @brief Execution time of top command
   std::mutex mutex_;                    //!< @brief mutex for output from top command
   rclcpp::CallbackGroup::SharedPtr timer_callback_group_;  //!< @brief Callback Group
+
+  std::unique_ptr<ProcfsCollector> procfs_collector_;  //!< @brief collector reading procfs
+  ProcessSnapshot procfs_snapshot_;  //!< @brief latest result of procfs collector
+  bool has_procfs_snapshot_;         //!< @brief flag if procfs collector is done once
+  bool is_procfs_error_;             //!< @brief flag if an procfs error occurs
+  std::string procfs_error_;         //!< @brief error message of procfs collector
 };
 
 #endif  // SYSTEM_MONITOR__PROCESS_MONITOR__PROCESS_MONITOR_HPP_
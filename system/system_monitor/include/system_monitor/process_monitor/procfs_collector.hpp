@@ -0,0 +1,123 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file procfs_collector.h
+ * @brief process information collector reading procfs
+ */
+
+#ifndef SYSTEM_MONITOR__PROCESS_MONITOR__PROCFS_COLLECTOR_HPP_
+#define SYSTEM_MONITOR__PROCESS_MONITOR__PROCFS_COLLECTOR_HPP_
+
+#include "system_monitor/process_monitor/diag_task.hpp"
+
+#include <sys/types.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Struct for storing the result of a collection
+ */
+struct ProcessSnapshot
+{
+  int total{0};                              //!< @brief number of processes
+  int running{0};                            //!< @brief number of running processes
+  int sleeping{0};                           //!< @brief number of sleeping processes
+  int stopped{0};                            //!< @brief number of stopped processes
+  int zombie{0};                             //!< @brief number of zombie processes
+  std::vector<ProcessInfo> high_load_procs;  //!< @brief processes sorted by CPU usage
+  std::vector<ProcessInfo> high_mem_procs;   //!< @brief processes sorted by memory usage
+};
+
+class ProcfsCollector
+{
+public:
+  /**
+   * @brief constructor
+   * @param [in] num_of_procs number of processes to collect for each ranking
+   */
+  explicit ProcfsCollector(int num_of_procs);
+
+  /**
+   * @brief read /proc and rank the processes
+   * @param [out] snapshot result of the collection
+   * @param [out] error error message
+   * @return true if success to read /proc
+   * @note CPU usage is computed from the CPU time since the previous collection,
+   * or since the start of the process if it is new.
+   */
+  bool collect(ProcessSnapshot * snapshot, std::string * error);
+
+protected:
+  /**
+   * @brief Struct for storing the fields of /proc/[pid]/stat
+   */
+  struct ProcessStat
+  {
+    pid_t pid;
+    std::string comm;
+    char state;
+    int64_t priority;
+    int64_t nice;
+    uint64_t cpu_ticks;  // utime + stime
+    uint64_t start_ticks;
+    uint64_t rss_pages;
+    double cpu_usage;
+  };
+
+  /**
+   * @brief Struct for storing the CPU time at the previous collection
+   */
+  struct CpuSample
+  {
+    uint64_t start_ticks;
+    uint64_t cpu_ticks;
+    uint64_t uptime_ticks;
+  };
+
+  /**
+   * @brief read /proc/[pid]/stat
+   * @param [in] pid process id
+   * @param [out] stat fields of the file
+   * @return true if success to read the file
+   */
+  bool readStat(pid_t pid, ProcessStat * stat) const;
+
+  /**
+   * @brief create process information with /proc/[pid]/statm and cmdline
+   * @param [in] stat fields of /proc/[pid]/stat
+   * @return process information
+   */
+  ProcessInfo createProcessInfo(const ProcessStat & stat);
+
+  /**
+   * @brief get user name of the process owner
+   * @param [in] pid process id
+   * @return user name, or uid if the name is not found
+   */
+  std::string getUserName(pid_t pid);
+
+  int num_of_procs_;       //!< @brief number of processes to collect for each ranking
+  int64_t ticks_per_sec_;  //!< @brief clock ticks per second
+  int64_t page_size_kb_;   //!< @brief page size in KiB
+  int64_t total_pages_;    //!< @brief number of physical pages
+
+  std::unordered_map<pid_t, CpuSample> samples_;  //!< @brief CPU time at previous collection
+  std::unordered_map<uid_t, std::string> user_names_;  //!< @brief cache of user names
+};
+
+#endif  // SYSTEM_MONITOR__PROCESS_MONITOR__PROCFS_COLLECTOR_HPP_
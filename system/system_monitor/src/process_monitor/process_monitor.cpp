@@ -28,14 +28,18 @@
 #include <memory>
 #include <regex>
 #include <string>
+#include <utility>
 #include <vector>
 
 ProcessMonitor::ProcessMonitor(const rclcpp::NodeOptions & options)
 : Node("process_monitor", options),
   updater_(this),
   num_of_procs_(declare_parameter<int>("num_of_procs", 5)),
+  use_procfs_(declare_parameter<bool>("use_procfs", true)),
   is_top_error_(false),
-  is_pipe2_error_(false)
+  is_pipe2_error_(false),
+  has_procfs_snapshot_(false),
+  is_procfs_error_(false)
 {
   using namespace std::literals::chrono_literals;
 
@@ -57,6 +61,10 @@ ProcessMonitor::ProcessMonitor(const rclcpp::NodeOptions & options)
     updater_.add(*task);
   }
 
+  if (use_procfs_) {
+    procfs_collector_ = std::make_unique<ProcfsCollector>(num_of_procs_);
+  }
+
   // Start timer to execute top command
   timer_callback_group_ = this->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
   timer_ = rclcpp::create_timer(
@@ -65,6 +73,11 @@ ProcessMonitor::ProcessMonitor(const rclcpp::NodeOptions & options)
 
 void ProcessMonitor::monitorProcesses(diagnostic_updater::DiagnosticStatusWrapper & stat)
 {
+  if (use_procfs_) {
+    monitorProcessesWithProcfs(stat);
+    return;
+  }
+
   // thread-safe read
   std::string str;
   bool is_top_error;
@@ -114,6 +127,65 @@ void ProcessMonitor::monitorProcesses(diagnostic_updater::DiagnosticStatusWrappe
   stat.addf("execution time", "%f ms", elapsed_ms);
 }
 
+void ProcessMonitor::monitorProcessesWithProcfs(
+  diagnostic_updater::DiagnosticStatusWrapper & stat)
+{
+  // thread-safe read
+  ProcessSnapshot snapshot;
+  bool has_snapshot;
+  bool is_procfs_error;
+  std::string error;
+  double elapsed_ms;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    snapshot = procfs_snapshot_;
+    has_snapshot = has_procfs_snapshot_;
+    is_procfs_error = is_procfs_error_;
+    error = procfs_error_;
+    elapsed_ms = elapsed_ms_;
+  }
+
+  if (is_procfs_error) {
+    stat.summary(DiagStatus::ERROR, "procfs error");
+    stat.add("procfs", error);
+    setErrorContent(&load_tasks_, "procfs error", "procfs", error);
+    setErrorContent(&memory_tasks_, "procfs error", "procfs", error);
+    return;
+  }
+
+  // If procfs collector still not running
+  if (!has_snapshot) {
+    // Send OK tentatively
+    stat.summary(DiagStatus::OK, "starting up");
+    return;
+  }
+
+  stat.add("total", snapshot.total);
+  stat.add("running", snapshot.running);
+  stat.add("sleeping", snapshot.sleeping);
+  stat.add("stopped", snapshot.stopped);
+  stat.add("zombie", snapshot.zombie);
+  stat.summary(DiagStatus::OK, "OK");
+
+  setTopratedProcesses(&load_tasks_, snapshot.high_load_procs);
+  setTopratedProcesses(&memory_tasks_, snapshot.high_mem_procs);
+
+  stat.addf("execution time", "%f ms", elapsed_ms);
+}
+
+void ProcessMonitor::setTopratedProcesses(
+  std::vector<std::shared_ptr<DiagTask>> * tasks, const std::vector<ProcessInfo> & procs)
+{
+  if (tasks == nullptr) {
+    return;
+  }
+
+  for (size_t index = 0; index < procs.size() && index < tasks->size(); ++index) {
+    tasks->at(index)->setDiagnosticsStatus(DiagStatus::OK, "OK");
+    tasks->at(index)->setProcessInformation(procs.at(index));
+  }
+}
+
 void ProcessMonitor::getTasksSummary(
   diagnostic_updater::DiagnosticStatusWrapper & stat, const std::string & output)
 {
@@ -506,6 +578,11 @@ void ProcessMonitor::setErrorContent(
 
 void ProcessMonitor::onTimer()
 {
+  if (use_procfs_) {
+    onTimerWithProcfs();
+    return;
+  }
+
   bool is_top_error = false;
 
   // Start to measure elapsed time
@@ -557,5 +634,28 @@ void ProcessMonitor::onTimer()
   }
 }
 
+void ProcessMonitor::onTimerWithProcfs()
+{
+  // Start to measure elapsed time
+  tier4_autoware_utils::StopWatch<std::chrono::milliseconds> stop_watch;
+  stop_watch.tic("execution_time");
+
+  ProcessSnapshot snapshot;
+  std::string error;
+  const bool is_procfs_error = !procfs_collector_->collect(&snapshot, &error);
+
+  const double elapsed_ms = stop_watch.toc("execution_time");
+
+  // thread-safe copy
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    procfs_snapshot_ = std::move(snapshot);
+    has_procfs_snapshot_ = true;
+    is_procfs_error_ = is_procfs_error;
+    procfs_error_ = error;
+    elapsed_ms_ = elapsed_ms;
+  }
+}
+
 #include <rclcpp_components/register_node_macro.hpp>
 RCLCPP_COMPONENTS_REGISTER_NODE(ProcessMonitor)
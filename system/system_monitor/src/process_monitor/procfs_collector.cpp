@@ -0,0 +1,245 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file procfs_collector.cpp
+ * @brief process information collector reading procfs
+ */
+
+#include "system_monitor/process_monitor/procfs_collector.hpp"
+
+#include <fmt/format.h>
+
+#include <dirent.h>
+#include <pwd.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+ProcfsCollector::ProcfsCollector(int num_of_procs)
+: num_of_procs_(num_of_procs),
+  ticks_per_sec_(sysconf(_SC_CLK_TCK)),
+  page_size_kb_(sysconf(_SC_PAGESIZE) / 1024),
+  total_pages_(sysconf(_SC_PHYS_PAGES))
+{
+}
+
+bool ProcfsCollector::collect(ProcessSnapshot * snapshot, std::string * error)
+{
+  if (snapshot == nullptr || error == nullptr) {
+    return false;
+  }
+
+  double uptime_sec;
+  {
+    std::ifstream ifs("/proc/uptime");
+    if (!(ifs >> uptime_sec)) {
+      *error = "Failed to read /proc/uptime";
+      return false;
+    }
+  }
+  const auto uptime_ticks = static_cast<uint64_t>(uptime_sec * ticks_per_sec_);
+
+  DIR * dir = opendir("/proc");
+  if (dir == nullptr) {
+    *error = strerror(errno);
+    return false;
+  }
+
+  std::vector<ProcessStat> stats;
+  std::unordered_map<pid_t, CpuSample> samples;
+  *snapshot = ProcessSnapshot();
+
+  while (const dirent * entry = readdir(dir)) {
+    if (!std::isdigit(static_cast<unsigned char>(entry->d_name[0]))) {
+      continue;
+    }
+    ProcessStat stat;
+    // The process may exit while reading /proc.
+    if (!readStat(static_cast<pid_t>(std::stol(entry->d_name)), &stat)) {
+      continue;
+    }
+
+    // Use the start time as the previous sample for a new process. The start time is also
+    // compared to detect the reuse of the process id.
+    CpuSample previous{stat.start_ticks, 0, stat.start_ticks};
+    const auto itr = samples_.find(stat.pid);
+    if (itr != samples_.end() && itr->second.start_ticks == stat.start_ticks) {
+      previous = itr->second;
+    }
+    const auto elapsed_ticks = uptime_ticks - std::min(previous.uptime_ticks, uptime_ticks);
+    const auto used_ticks = stat.cpu_ticks - std::min(previous.cpu_ticks, stat.cpu_ticks);
+    stat.cpu_usage = elapsed_ticks == 0 ? 0.0 : 100.0 * used_ticks / elapsed_ticks;
+    samples.emplace(stat.pid, CpuSample{stat.start_ticks, stat.cpu_ticks, uptime_ticks});
+
+    ++snapshot->total;
+    switch (stat.state) {
+      case 'R':
+        ++snapshot->running;
+        break;
+      case 'S':
+      case 'D':
+      case 'I':
+        ++snapshot->sleeping;
+        break;
+      case 'T':
+      case 't':
+        ++snapshot->stopped;
+        break;
+      case 'Z':
+        ++snapshot->zombie;
+        break;
+      default:
+        break;
+    }
+    stats.push_back(std::move(stat));
+  }
+  closedir(dir);
+
+  // Keep only the samples of the running processes.
+  samples_ = std::move(samples);
+
+  // Sort only the top-rated processes.
+  const auto num = std::min(stats.size(), static_cast<size_t>(std::max(num_of_procs_, 0)));
+  std::partial_sort(
+    stats.begin(), stats.begin() + num, stats.end(),
+    [](const ProcessStat & a, const ProcessStat & b) { return a.cpu_usage > b.cpu_usage; });
+  for (size_t i = 0; i < num; ++i) {
+    snapshot->high_load_procs.push_back(createProcessInfo(stats[i]));
+  }
+  std::partial_sort(
+    stats.begin(), stats.begin() + num, stats.end(),
+    [](const ProcessStat & a, const ProcessStat & b) { return a.rss_pages > b.rss_pages; });
+  for (size_t i = 0; i < num; ++i) {
+    snapshot->high_mem_procs.push_back(createProcessInfo(stats[i]));
+  }
+
+  return true;
+}
+
+bool ProcfsCollector::readStat(pid_t pid, ProcessStat * stat) const
+{
+  std::ifstream ifs(fmt::format("/proc/{}/stat", pid));
+  std::string line;
+  if (!std::getline(ifs, line)) {
+    return false;
+  }
+
+  // The command name is enclosed in parentheses and may contain spaces and parentheses.
+  const auto begin = line.find('(');
+  const auto end = line.rfind(')');
+  if (begin == std::string::npos || end == std::string::npos || end < begin) {
+    return false;
+  }
+
+  stat->pid = pid;
+  stat->comm = line.substr(begin + 1, end - begin - 1);
+
+  // Fields from (3) state. See proc(5) for the details.
+  std::istringstream stream(line.substr(end + 1));
+  std::string skip;
+  uint64_t utime;
+  uint64_t stime;
+  int64_t vsize;
+  stream >> stat->state;
+  for (int field = 4; field <= 13; ++field) {
+    stream >> skip;
+  }
+  stream >> utime >> stime;
+  stream >> skip >> skip;
+  stream >> stat->priority >> stat->nice;
+  stream >> skip >> skip;
+  stream >> stat->start_ticks >> vsize >> stat->rss_pages;
+  if (!stream) {
+    return false;
+  }
+
+  stat->cpu_ticks = utime + stime;
+  stat->cpu_usage = 0.0;
+  return true;
+}
+
+ProcessInfo ProcfsCollector::createProcessInfo(const ProcessStat & stat)
+{
+  ProcessInfo info;
+  info.processId = std::to_string(stat.pid);
+  info.userName = getUserName(stat.pid);
+  info.priority = stat.priority <= -100 ? "rt" : std::to_string(stat.priority);
+  info.niceValue = std::to_string(stat.nice);
+  info.processStatus = std::string(1, stat.state);
+  info.cpuUsage = fmt::format("{:.1f}", stat.cpu_usage);
+  info.memoryUsage = fmt::format(
+    "{:.1f}", total_pages_ > 0 ? 100.0 * stat.rss_pages / total_pages_ : 0.0);
+
+  // Same format as TIME+ of top command
+  const uint64_t centiseconds = stat.cpu_ticks * 100 / ticks_per_sec_;
+  info.cpuTime = fmt::format(
+    "{}:{:02}.{:02}", centiseconds / 6000, (centiseconds / 100) % 60, centiseconds % 100);
+
+  // Memory sizes in KiB
+  {
+    std::ifstream ifs(fmt::format("/proc/{}/statm", stat.pid));
+    int64_t size = 0;
+    int64_t resident = 0;
+    int64_t shared = 0;
+    ifs >> size >> resident >> shared;
+    info.virtualImage = std::to_string(size * page_size_kb_);
+    info.residentSize = std::to_string(resident * page_size_kb_);
+    info.sharedMemSize = std::to_string(shared * page_size_kb_);
+  }
+
+  {
+    std::ifstream ifs(fmt::format("/proc/{}/cmdline", stat.pid));
+    std::getline(ifs, info.commandName);
+  }
+  if (info.commandName.empty()) {
+    info.commandName = stat.comm;  // if command line is not found, use program name instead
+  }
+
+  return info;
+}
+
+std::string ProcfsCollector::getUserName(pid_t pid)
+{
+  struct stat buffer;
+  if (stat(fmt::format("/proc/{}", pid).c_str(), &buffer) != 0) {
+    return "";
+  }
+
+  const auto itr = user_names_.find(buffer.st_uid);
+  if (itr != user_names_.end()) {
+    return itr->second;
+  }
+
+  std::string name = std::to_string(buffer.st_uid);
+  struct passwd pwd;
+  struct passwd * result = nullptr;
+  std::vector<char> pwd_buffer(16384);
+  if (
+    getpwuid_r(buffer.st_uid, &pwd, pwd_buffer.data(), pwd_buffer.size(), &result) == 0 &&
+    result != nullptr) {
+    name = pwd.pw_name;
+  }
+  user_names_.emplace(buffer.st_uid, name);
+  return name;
+}
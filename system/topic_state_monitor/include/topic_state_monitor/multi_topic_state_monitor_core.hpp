@@ -0,0 +1,72 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOPIC_STATE_MONITOR__MULTI_TOPIC_STATE_MONITOR_CORE_HPP_
+#define TOPIC_STATE_MONITOR__MULTI_TOPIC_STATE_MONITOR_CORE_HPP_
+
+#include "topic_state_monitor/topic_state_monitor.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
+#include <tf2_msgs/msg/tf_message.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace topic_state_monitor
+{
+struct MonitoredTopic
+{
+  std::string topic;
+  std::string topic_name;  // topic name with the frames for diagnostics
+  std::string topic_type;
+  std::string diag_name;
+  std::string frame_id;
+  std::string child_frame_id;
+  bool transient_local;
+  bool best_effort;
+  bool is_transform;
+  Param param;
+  std::unique_ptr<TopicStateMonitor> monitor;
+};
+
+/**
+ * Monitor multiple topics in one node. The statuses of all topics are evaluated in one timer and
+ * published as one diagnostic array, whose status names are the given diag names as they are.
+ */
+class MultiTopicStateMonitorNode : public rclcpp::Node
+{
+public:
+  explicit MultiTopicStateMonitorNode(const rclcpp::NodeOptions & node_options);
+
+private:
+  // Core
+  std::vector<MonitoredTopic> topics_;
+
+  // Subscriber
+  std::vector<rclcpp::GenericSubscription::SharedPtr> sub_topics_;
+  std::vector<rclcpp::Subscription<tf2_msgs::msg::TFMessage>::SharedPtr> sub_transforms_;
+
+  // Publisher
+  rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr pub_diagnostics_;
+
+  // Timer
+  void onTimer();
+  rclcpp::TimerBase::SharedPtr timer_;
+};
+}  // namespace topic_state_monitor
+
+#endif  // TOPIC_STATE_MONITOR__MULTI_TOPIC_STATE_MONITOR_CORE_HPP_
@@ -17,8 +17,8 @@
 
 #include <rclcpp/rclcpp.hpp>
 
-#include <deque>
 #include <string>
+#include <vector>
 
 namespace topic_state_monitor
 {
@@ -43,10 +43,10 @@ class TopicStateMonitor
 public:
   explicit TopicStateMonitor(rclcpp::Node & node);
 
-  void setParam(const Param & param) { param_ = param; }
+  void setParam(const Param & param);
 
   rclcpp::Time getLastMessageTime() const { return last_message_time_; }
-  double getTopicRate() const { return topic_rate_; }
+  double getTopicRate() const { return calcTopicRate(); }
 
   void update();
   TopicStatus getTopicStatus() const;
@@ -56,9 +56,11 @@ private:
 
   static constexpr double max_rate = 100000.0;
 
-  std::deque<rclcpp::Time> time_buffer_;
+  // Ring buffer of the message times, whose capacity is the window size.
+  std::vector<rclcpp::Time> time_buffer_;
+  size_t buffer_next_ = 0;
+  size_t buffer_count_ = 0;
   rclcpp::Time last_message_time_ = rclcpp::Time(0);
-  double topic_rate_ = TopicStateMonitor::max_rate;
 
   rclcpp::Clock::SharedPtr clock_;
 
@@ -43,6 +43,10 @@ struct NodeParam
   bool is_transform;
 };
 
+void setTopicStatus(
+  diagnostic_updater::DiagnosticStatusWrapper & stat, const std::string & topic_name,
+  const Param & param, const TopicStateMonitor & monitor, const rclcpp::Time & now);
+
 class TopicStateMonitorNode : public rclcpp::Node
 {
 public:
@@ -0,0 +1,140 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "topic_state_monitor/multi_topic_state_monitor_core.hpp"
+
+#include "topic_state_monitor/topic_state_monitor_core.hpp"
+
+#include <diagnostic_updater/diagnostic_status_wrapper.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace topic_state_monitor
+{
+MultiTopicStateMonitorNode::MultiTopicStateMonitorNode(const rclcpp::NodeOptions & node_options)
+: Node("multi_topic_state_monitor", node_options)
+{
+  // Parameter
+  const auto update_rate = declare_parameter("update_rate", 10.0);
+  const auto names = declare_parameter<std::vector<std::string>>("monitored_topics");
+
+  for (const auto & name : names) {
+    const auto ns = name + ".";
+    MonitoredTopic topic;
+    topic.topic = declare_parameter<std::string>(ns + "topic");
+    topic.transient_local = declare_parameter(ns + "transient_local", false);
+    topic.best_effort = declare_parameter(ns + "best_effort", false);
+    topic.diag_name = declare_parameter<std::string>(ns + "diag_name");
+    topic.is_transform = (topic.topic == "/tf" || topic.topic == "/tf_static");
+
+    if (topic.is_transform) {
+      topic.frame_id = declare_parameter<std::string>(ns + "frame_id");
+      topic.child_frame_id = declare_parameter<std::string>(ns + "child_frame_id");
+      topic.topic_name =
+        topic.topic + " (" + topic.frame_id + " to " + topic.child_frame_id + ")";
+    } else {
+      topic.topic_type = declare_parameter<std::string>(ns + "topic_type");
+      topic.topic_name = topic.topic;
+    }
+
+    topic.param.warn_rate = declare_parameter(ns + "warn_rate", 0.5);
+    topic.param.error_rate = declare_parameter(ns + "error_rate", 0.1);
+    topic.param.timeout = declare_parameter(ns + "timeout", 1.0);
+    topic.param.window_size = declare_parameter(ns + "window_size", 10);
+
+    // Core
+    topic.monitor = std::make_unique<TopicStateMonitor>(*this);
+    topic.monitor->setParam(topic.param);
+    topics_.push_back(std::move(topic));
+  }
+
+  // Subscriber
+  const auto create_qos = [](const MonitoredTopic & topic) {
+    rclcpp::QoS qos = rclcpp::QoS{1};
+    if (topic.transient_local) {
+      qos.transient_local();
+    }
+    if (topic.best_effort) {
+      qos.best_effort();
+    }
+    return qos;
+  };
+
+  // The messages are not deserialized except for the transforms, which are needed to check the
+  // frames. Each transform topic is subscribed once and shared by the monitors of the frames.
+  std::map<std::string, std::vector<const MonitoredTopic *>> transform_topics;
+  for (const auto & topic : topics_) {
+    if (topic.is_transform) {
+      transform_topics[topic.topic].push_back(&topic);
+      continue;
+    }
+    TopicStateMonitor * monitor = topic.monitor.get();
+    sub_topics_.push_back(this->create_generic_subscription(
+      topic.topic, topic.topic_type, create_qos(topic),
+      [monitor]([[maybe_unused]] std::shared_ptr<rclcpp::SerializedMessage> msg) {
+        monitor->update();
+      }));
+  }
+  for (const auto & [name, topics] : transform_topics) {
+    sub_transforms_.push_back(this->create_subscription<tf2_msgs::msg::TFMessage>(
+      name, create_qos(*topics.front()),
+      [topics = topics](tf2_msgs::msg::TFMessage::ConstSharedPtr msg) {
+        for (const auto & transform : msg->transforms) {
+          for (const auto & topic : topics) {
+            if (
+              transform.header.frame_id == topic->frame_id &&
+              transform.child_frame_id == topic->child_frame_id) {
+              topic->monitor->update();
+            }
+          }
+        }
+      }));
+  }
+
+  // Publisher
+  pub_diagnostics_ =
+    this->create_publisher<diagnostic_msgs::msg::DiagnosticArray>("/diagnostics", rclcpp::QoS{1});
+
+  // Timer
+  const auto period_ns = rclcpp::Rate(update_rate).period();
+  timer_ = rclcpp::create_timer(
+    this, get_clock(), period_ns, std::bind(&MultiTopicStateMonitorNode::onTimer, this));
+}
+
+void MultiTopicStateMonitorNode::onTimer()
+{
+  const auto stamp = now();
+
+  diagnostic_msgs::msg::DiagnosticArray array;
+  array.header.stamp = stamp;
+  array.status.reserve(topics_.size());
+  for (const auto & topic : topics_) {
+    diagnostic_updater::DiagnosticStatusWrapper stat;
+    setTopicStatus(stat, topic.topic_name, topic.param, *topic.monitor, stamp);
+    stat.name = topic.diag_name;
+    stat.hardware_id = "topic_state_monitor";
+    array.status.push_back(stat);
+  }
+
+  // Publish diagnostics
+  pub_diagnostics_->publish(array);
+}
+}  // namespace topic_state_monitor
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(topic_state_monitor::MultiTopicStateMonitorNode)
@@ -14,25 +14,52 @@
 
 #include "topic_state_monitor/topic_state_monitor.hpp"
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 namespace topic_state_monitor
 {
 TopicStateMonitor::TopicStateMonitor(rclcpp::Node & node) : clock_(node.get_clock())
 {
 }
 
+void TopicStateMonitor::setParam(const Param & param)
+{
+  const auto capacity = static_cast<size_t>(std::max(param.window_size, 0));
+  param_ = param;
+
+  if (capacity == time_buffer_.size()) {
+    return;
+  }
+
+  // Keep the latest data in the order of arrival.
+  std::vector<rclcpp::Time> buffer;
+  buffer.reserve(capacity);
+  const auto count = std::min(buffer_count_, capacity);
+  for (size_t i = buffer_count_ - count; i < buffer_count_; ++i) {
+    const auto index = buffer_next_ + time_buffer_.size() - buffer_count_ + i;
+    buffer.push_back(time_buffer_.at(index % time_buffer_.size()));
+  }
+  buffer.resize(capacity, rclcpp::Time(0));
+
+  time_buffer_ = std::move(buffer);
+  buffer_count_ = count;
+  buffer_next_ = capacity == 0 ? 0 : count % capacity;
+}
+
 void TopicStateMonitor::update()
 {
   // Add data
   last_message_time_ = clock_->now();
-  time_buffer_.push_back(last_message_time_);
-
-  // Remove old data
-  while (static_cast<int>(time_buffer_.size()) > param_.window_size) {
-    time_buffer_.pop_front();
+  if (time_buffer_.empty()) {
+    return;
   }
 
-  // Calc topic rate
-  topic_rate_ = calcTopicRate();
+  // Overwrite the oldest data
+  time_buffer_.at(buffer_next_) = last_message_time_;
+  buffer_next_ = (buffer_next_ + 1) % time_buffer_.size();
+  buffer_count_ = std::min(buffer_count_ + 1, time_buffer_.size());
 }
 
 TopicStatus TopicStateMonitor::getTopicStatus() const
@@ -56,19 +83,20 @@ double TopicStateMonitor::calcTopicRate() const
 {
   // Output max_rate when topic rate can't be calculated.
   // In this case, it's assumed timeout is used instead.
-  if (time_buffer_.size() < 2) {
+  if (buffer_count_ < 2) {
     return TopicStateMonitor::max_rate;
   }
 
-  const auto time_diff = (time_buffer_.back() - time_buffer_.front()).seconds();
-  const auto num_intervals = time_buffer_.size() - 1;
+  const auto oldest = (buffer_next_ + time_buffer_.size() - buffer_count_) % time_buffer_.size();
+  const auto time_diff = (last_message_time_ - time_buffer_.at(oldest)).seconds();
+  const auto num_intervals = buffer_count_ - 1;
 
   return static_cast<double>(num_intervals) / time_diff;
 }
 
 bool TopicStateMonitor::isNotReceived() const
 {
-  return time_buffer_.empty();
+  return buffer_count_ == 0;
 }
 
 bool TopicStateMonitor::isWarnRate() const
@@ -95,7 +123,7 @@ bool TopicStateMonitor::isTimeout() const
     return false;
   }
 
-  const auto time_diff = (clock_->now() - time_buffer_.back()).seconds();
+  const auto time_diff = (clock_->now() - last_message_time_).seconds();
 
   return time_diff > param_.timeout;
 }
@@ -134,22 +134,19 @@ void TopicStateMonitorNode::onTimer()
   updater_.force_update();
 }
 
-void TopicStateMonitorNode::checkTopicStatus(diagnostic_updater::DiagnosticStatusWrapper & stat)
+void setTopicStatus(
+  diagnostic_updater::DiagnosticStatusWrapper & stat, const std::string & topic_name,
+  const Param & param, const TopicStateMonitor & monitor, const rclcpp::Time & now)
 {
   using diagnostic_msgs::msg::DiagnosticStatus;
 
   // Get information
-  const auto topic_status = topic_state_monitor_->getTopicStatus();
-  const auto last_message_time = topic_state_monitor_->getLastMessageTime();
-  const auto topic_rate = topic_state_monitor_->getTopicRate();
+  const auto topic_status = monitor.getTopicStatus();
+  const auto last_message_time = monitor.getLastMessageTime();
+  const auto topic_rate = monitor.getTopicRate();
 
   // Add topic name
-  if (node_param_.is_transform) {
-    const auto frame = "(" + node_param_.frame_id + " to " + node_param_.child_frame_id + ")";
-    stat.addf("topic", "%s %s", node_param_.topic.c_str(), frame.c_str());
-  } else {
-    stat.addf("topic", "%s", node_param_.topic.c_str());
-  }
+  stat.addf("topic", "%s", topic_name.c_str());
 
   // Judge level
   int8_t level = DiagnosticStatus::OK;
@@ -171,11 +168,11 @@ void TopicStateMonitorNode::checkTopicStatus(diagnostic_updater::DiagnosticStatu
   }
 
   // Add key-value
-  stat.addf("warn_rate", "%.2f [Hz]", param_.warn_rate);
-  stat.addf("error_rate", "%.2f [Hz]", param_.error_rate);
-  stat.addf("timeout", "%.2f [s]", param_.timeout);
+  stat.addf("warn_rate", "%.2f [Hz]", param.warn_rate);
+  stat.addf("error_rate", "%.2f [Hz]", param.error_rate);
+  stat.addf("timeout", "%.2f [s]", param.timeout);
   stat.addf("measured_rate", "%.2f [Hz]", topic_rate);
-  stat.addf("now", "%.2f [s]", this->now().seconds());
+  stat.addf("now", "%.2f [s]", now.seconds());
   stat.addf("last_message_time", "%.2f [s]", last_message_time.seconds());
 
   // Create message
@@ -192,6 +189,16 @@ void TopicStateMonitorNode::checkTopicStatus(diagnostic_updater::DiagnosticStatu
   stat.summary(level, msg);
 }
 
+void TopicStateMonitorNode::checkTopicStatus(diagnostic_updater::DiagnosticStatusWrapper & stat)
+{
+  if (node_param_.is_transform) {
+    const auto frame = "(" + node_param_.frame_id + " to " + node_param_.child_frame_id + ")";
+    setTopicStatus(stat, node_param_.topic + " " + frame, param_, *topic_state_monitor_, now());
+  } else {
+    setTopicStatus(stat, node_param_.topic, param_, *topic_state_monitor_, now());
+  }
+}
+
 }  // namespace topic_state_monitor
 
 #include <rclcpp_components/register_node_macro.hpp>
@@ -17,6 +17,7 @@
 #ifndef ACCEL_BRAKE_MAP_CALIBRATOR__ACCEL_BRAKE_MAP_CALIBRATOR_NODE_HPP_
 #define ACCEL_BRAKE_MAP_CALIBRATOR__ACCEL_BRAKE_MAP_CALIBRATOR_NODE_HPP_
 
+#include "accel_brake_map_calibrator/statistics.hpp"
 #include "diagnostic_updater/diagnostic_updater.hpp"
 #include "raw_vehicle_cmd_converter/accel_map.hpp"
 #include "raw_vehicle_cmd_converter/brake_map.hpp"
@@ -117,8 +118,10 @@ private:
 
   rclcpp::TimerBase::SharedPtr timer_;
   rclcpp::TimerBase::SharedPtr timer_output_csv_;
+  rclcpp::TimerBase::SharedPtr timer_debug_;
   void initTimer(double period_s);
   void initOutputCSVTimer(double period_s);
+  void initDebugTimer(double period_s);
 
   TwistStamped::ConstSharedPtr twist_ptr_;
   std::vector<std::shared_ptr<TwistStamped>> twist_vec_;
@@ -146,6 +149,7 @@ private:
   double brake_pedal_speed_ = 0.0;
   double pitch_ = 0.0;
   double update_hz_;
+  double debug_map_publish_hz_;
   double velocity_min_threshold_;
   double velocity_diff_threshold_;
   double pedal_diff_threshold_;
@@ -181,14 +185,13 @@ private:
   // for evaluation
   AccelMap new_accel_map_;
   BrakeMap new_brake_map_;
-  std::vector<double> part_original_accel_mse_que_;
-  std::vector<double> full_original_accel_mse_que_;
-  // std::vector<double> full_original_accel_esm_que_;
-  std::vector<double> full_original_accel_l1_que_;
-  std::vector<double> full_original_accel_sq_l1_que_;
-  std::vector<double> new_accel_mse_que_;
   std::size_t full_mse_que_size_ = 100000;
   std::size_t part_mse_que_size_ = 3000;
+  MovingAverage part_original_accel_mse_que_{part_mse_que_size_};
+  MovingAverage full_original_accel_mse_que_{full_mse_que_size_};
+  MovingAverage full_original_accel_l1_que_{full_mse_que_size_};
+  MovingAverage full_original_accel_sq_l1_que_{full_mse_que_size_};
+  MovingAverage new_accel_mse_que_{part_mse_que_size_};
   double full_original_accel_rmse_ = 0.0;
   double full_original_accel_error_l1norm_ = 0.0;
   double part_original_accel_rmse_ = 0.0;
@@ -202,13 +205,15 @@ private:
   Map update_brake_map_value_;
   Map accel_offset_covariance_value_;
   Map brake_offset_covariance_value_;
-  std::vector<Map> map_value_data_;
+  // statistics of the measured acceleration on each cell of the unified index
+  std::vector<std::vector<RunningStatistics>> map_value_data_;
   std::vector<double> accel_vel_index_;
   std::vector<double> brake_vel_index_;
   std::vector<double> accel_pedal_index_;
   std::vector<double> brake_pedal_index_;
   bool update_success_;
   int update_success_count_ = 0;
+  int output_csv_update_success_count_ = 0;
   int update_count_ = 0;
   int lack_of_data_count_ = 0;
   int failed_to_get_pitch_count_ = 0;
@@ -233,6 +238,7 @@ private:
   bool getCurrentPitchFromTF(double * pitch);
   void timerCallback();
   void timerCallbackOutputCSV();
+  void timerCallbackPublishDebug();
   void executeUpdate(
     const bool accel_mode, const int accel_pedal_index, const int accel_vel_index,
     const int brake_pedal_index, const int brake_vel_index);
@@ -284,7 +290,7 @@ private:
   double calculateAccelErrorL1Norm(
     const double throttle, const double brake, const double vel, AccelMap & accel_map,
     BrakeMap & brake_map);
-  std::vector<double> getMapColumnFromUnifiedIndex(
+  const std::vector<double> & getMapColumnFromUnifiedIndex(
     const Map & accel_map_value, const Map & brake_map_value, const std::size_t index);
   double getPedalValueFromUnifiedIndex(const std::size_t index);
   int getUnifiedIndexFromAccelBrakeIndex(const bool accel_map, const std::size_t index);
@@ -298,8 +304,6 @@ private:
     const T base_data, const double back_time, const std::vector<T> & vec);
   DataStampedPtr getNearestTimeDataFromVec(
     DataStampedPtr base_data, const double back_time, const std::vector<DataStampedPtr> & vec);
-  double getAverage(const std::vector<double> & vec);
-  double getStandardDeviation(const std::vector<double> & vec);
   bool isTimeout(const builtin_interfaces::msg::Time & stamp, const double timeout_sec);
   bool isTimeout(const DataStampedPtr & data_stamped, const double timeout_sec);
 
@@ -323,8 +327,10 @@ private:
 
   /* Debug */
   void publishMap(
-    const Map accel_map_value, const Map brake_map_value, const std::string publish_type);
-  void publishOffsetCovMap(const Map accel_map_value, const Map brake_map_value);
+    const Map & accel_map_value, const Map & brake_map_value, const std::string publish_type);
+  void publishRawMap(
+    const Map & accel_map_value, const Map & brake_map_value, const std::string publish_type);
+  void publishOffsetCovMap(const Map & accel_map_value, const Map & brake_map_value);
   void publishCountMap();
   void publishIndex();
   bool writeMapToCSV(
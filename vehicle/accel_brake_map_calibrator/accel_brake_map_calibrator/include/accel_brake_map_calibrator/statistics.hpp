@@ -0,0 +1,98 @@
+//
+// Copyright 2023 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef ACCEL_BRAKE_MAP_CALIBRATOR__STATISTICS_HPP_
+#define ACCEL_BRAKE_MAP_CALIBRATOR__STATISTICS_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace accel_brake_map_calibrator
+{
+
+/**
+ * @brief count, mean, and standard deviation of all the added values in constant time and memory
+ */
+class RunningStatistics
+{
+public:
+  void add(const double value)
+  {
+    // Welford's algorithm
+    ++count_;
+    const double delta = value - mean_;
+    mean_ += delta / static_cast<double>(count_);
+    m2_ += delta * (value - mean_);
+  }
+
+  std::size_t count() const { return count_; }
+  double mean() const { return mean_; }
+  double standardDeviation() const
+  {
+    return count_ == 0 ? 0.0 : std::sqrt(m2_ / static_cast<double>(count_));
+  }
+
+private:
+  std::size_t count_{0};
+  double mean_{0.0};
+  double m2_{0.0};
+};
+
+/**
+ * @brief average of the last added values in a window of maximum size in constant time
+ */
+class MovingAverage
+{
+public:
+  explicit MovingAverage(const std::size_t max_size) : max_size_(max_size) {}
+
+  void add(const double value)
+  {
+    if (max_size_ == 0) {
+      return;
+    }
+    if (values_.size() < max_size_) {
+      values_.push_back(value);
+      sum_ += value;
+      return;
+    }
+    sum_ += value - values_[oldest_];
+    values_[oldest_] = value;
+    oldest_ = oldest_ + 1 == max_size_ ? 0 : oldest_ + 1;
+    // recalculate the sum once per window to cancel the accumulated rounding errors
+    if (oldest_ == 0) {
+      sum_ = std::accumulate(values_.begin(), values_.end(), 0.0);
+    }
+  }
+
+  std::size_t size() const { return values_.size(); }
+  double average() const
+  {
+    return values_.empty() ? 0.0 : sum_ / static_cast<double>(values_.size());
+  }
+
+private:
+  std::size_t max_size_;
+  std::size_t oldest_{0};
+  double sum_{0.0};
+  std::vector<double> values_;
+};
+
+}  // namespace accel_brake_map_calibrator
+
+#endif  // ACCEL_BRAKE_MAP_CALIBRATOR__STATISTICS_HPP_
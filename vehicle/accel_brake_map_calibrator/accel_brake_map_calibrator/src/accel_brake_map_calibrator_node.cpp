@@ -17,6 +17,7 @@
 #include "accel_brake_map_calibrator/accel_brake_map_calibrator_node.hpp"
 
 #include "rclcpp/logging.hpp"
+#include "tier4_autoware_utils/ros/debug_publisher.hpp"
 
 #include <algorithm>
 #include <limits>
@@ -35,6 +36,7 @@ AccelBrakeMapCalibrator::AccelBrakeMapCalibrator(const rclcpp::NodeOptions & nod
   transform_listener_ = std::make_shared<tier4_autoware_utils::TransformListener>(this);
   // get parameter
   update_hz_ = declare_parameter<double>("update_hz", 10.0);
+  debug_map_publish_hz_ = declare_parameter<double>("debug_map_publish_hz", 1.0);
   covariance_ = declare_parameter<double>("initial_covariance", 0.05);
   velocity_min_threshold_ = declare_parameter<double>("velocity_min_threshold", 0.1);
   velocity_diff_threshold_ = declare_parameter<double>("velocity_diff_threshold", 0.556);
@@ -159,10 +161,9 @@ AccelBrakeMapCalibrator::AccelBrakeMapCalibrator(const rclcpp::NodeOptions & nod
   for (auto & m : brake_offset_covariance_value_) {
     m.resize(brake_map_value_.at(0).size(), covariance_);
   }
-  map_value_data_.resize(accel_map_value_.size() + brake_map_value_.size() - 1);
-  for (auto & m : map_value_data_) {
-    m.resize(accel_map_value_.at(0).size());
-  }
+  map_value_data_.assign(
+    accel_map_value_.size() + brake_map_value_.size() - 1,
+    std::vector<RunningStatistics>(accel_map_value_.at(0).size()));
 
   std::copy(accel_map_value_.begin(), accel_map_value_.end(), update_accel_map_value_.begin());
   std::copy(brake_map_value_.begin(), brake_map_value_.end(), update_brake_map_value_.begin());
@@ -232,6 +233,7 @@ AccelBrakeMapCalibrator::AccelBrakeMapCalibrator(const rclcpp::NodeOptions & nod
   // timer
   initTimer(1.0 / update_hz_);
   initOutputCSVTimer(30.0);
+  initDebugTimer(1.0 / debug_map_publish_hz_);
 
   logger_configure_ = std::make_unique<tier4_autoware_utils::LoggerLevelConfigure>(this);
 }
@@ -245,6 +247,15 @@ void AccelBrakeMapCalibrator::initOutputCSVTimer(double period_s)
     std::bind(&AccelBrakeMapCalibrator::timerCallbackOutputCSV, this));
 }
 
+void AccelBrakeMapCalibrator::initDebugTimer(double period_s)
+{
+  const auto period_ns =
+    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(period_s));
+  timer_debug_ = rclcpp::create_timer(
+    this, get_clock(), period_ns,
+    std::bind(&AccelBrakeMapCalibrator::timerCallbackPublishDebug, this));
+}
+
 void AccelBrakeMapCalibrator::initTimer(double period_s)
 {
   const auto period_ns =
@@ -339,11 +350,8 @@ void AccelBrakeMapCalibrator::timerCallback()
   }
 
   /* publish map  & debug_values*/
-  publishMap(accel_map_value_, brake_map_value_, "original");
-  publishMap(update_accel_map_value_, update_brake_map_value_, "update");
-  publishOffsetCovMap(accel_offset_covariance_value_, brake_offset_covariance_value_);
-  publishCountMap();
-  publishIndex();
+  // the debug maps are published by timerCallbackPublishDebug at debug_map_publish_hz
+  publishRawMap(update_accel_map_value_, update_brake_map_value_, "update");
   publishUpdateSuggestFlag();
   debug_pub_->publish(debug_values_);
   publishFloat32("current_map_error", part_original_accel_rmse_);
@@ -420,8 +428,30 @@ void AccelBrakeMapCalibrator::timerCallback()
   }
 }
 
+void AccelBrakeMapCalibrator::timerCallbackPublishDebug()
+{
+  // the count map with the self pose needs the current velocity and pedal
+  if (!twist_ptr_ || !delayed_accel_pedal_ptr_ || !delayed_brake_pedal_ptr_) {
+    return;
+  }
+
+  // each debug map is built only if it has a subscription
+  publishMap(accel_map_value_, brake_map_value_, "original");
+  publishRawMap(accel_map_value_, brake_map_value_, "original");
+  publishMap(update_accel_map_value_, update_brake_map_value_, "update");
+  publishOffsetCovMap(accel_offset_covariance_value_, brake_offset_covariance_value_);
+  publishCountMap();
+  publishIndex();
+}
+
 void AccelBrakeMapCalibrator::timerCallbackOutputCSV()
 {
+  // the maps are not written again until they are updated
+  if (update_success_count_ == output_csv_update_success_count_) {
+    return;
+  }
+  output_csv_update_success_count_ = update_success_count_;
+
   // write accel/ brake map to file
   const auto ros_time = std::to_string(this->now().seconds());
   writeMapToCSV(accel_vel_index_, accel_pedal_index_, update_accel_map_value_, output_accel_file_);
@@ -844,10 +874,10 @@ void AccelBrakeMapCalibrator::executeUpdate(
   // add accel data to map
   accel_mode ? map_value_data_.at(getUnifiedIndexFromAccelBrakeIndex(true, accel_pedal_index))
                  .at(accel_vel_index)
-                 .emplace_back(measured_acc)
+                 .add(measured_acc)
              : map_value_data_.at(getUnifiedIndexFromAccelBrakeIndex(false, brake_pedal_index))
                  .at(brake_vel_index)
-                 .emplace_back(measured_acc);
+                 .add(measured_acc);
 }
 
 bool AccelBrakeMapCalibrator::updateFourCellAroundOffset(
@@ -1078,7 +1108,7 @@ void AccelBrakeMapCalibrator::updateTotalMapOffset(const double measured_acc, co
   }
 }
 
-std::vector<double> AccelBrakeMapCalibrator::getMapColumnFromUnifiedIndex(
+const std::vector<double> & AccelBrakeMapCalibrator::getMapColumnFromUnifiedIndex(
   const Map & accel_map_value, const Map & brake_map_value, const std::size_t index)
 {
   if (index < brake_map_value.size()) {
@@ -1126,20 +1156,20 @@ void AccelBrakeMapCalibrator::executeEvaluation()
   const double full_orig_accel_sq_error = calculateAccelSquaredError(
     delayed_accel_pedal_ptr_->data, delayed_brake_pedal_ptr_->data, twist_ptr_->twist.linear.x,
     accel_map_, brake_map_);
-  pushDataToVec(full_orig_accel_sq_error, full_mse_que_size_, &full_original_accel_mse_que_);
-  full_original_accel_rmse_ = getAverage(full_original_accel_mse_que_);
+  full_original_accel_mse_que_.add(full_orig_accel_sq_error);
+  full_original_accel_rmse_ = full_original_accel_mse_que_.average();
   // std::cerr << "rmse : " << sqrt(full_original_accel_rmse_) << std::endl;
 
   const double full_orig_accel_l1_error = calculateAccelErrorL1Norm(
     delayed_accel_pedal_ptr_->data, delayed_brake_pedal_ptr_->data, twist_ptr_->twist.linear.x,
     accel_map_, brake_map_);
   const double full_orig_accel_sq_l1_error = full_orig_accel_l1_error * full_orig_accel_l1_error;
-  pushDataToVec(full_orig_accel_l1_error, full_mse_que_size_, &full_original_accel_l1_que_);
-  pushDataToVec(full_orig_accel_sq_l1_error, full_mse_que_size_, &full_original_accel_sq_l1_que_);
-  full_original_accel_error_l1norm_ = getAverage(full_original_accel_l1_que_);
+  full_original_accel_l1_que_.add(full_orig_accel_l1_error);
+  full_original_accel_sq_l1_que_.add(full_orig_accel_sq_l1_error);
+  full_original_accel_error_l1norm_ = full_original_accel_l1_que_.average();
 
   /*calculate l1norm_covariance*/
-  // const double full_original_accel_error_sql1_ = getAverage(full_original_accel_sq_l1_que_);
+  // const double full_original_accel_error_sql1_ = full_original_accel_sq_l1_que_.average();
   // std::cerr << "error_l1norm : " << full_original_accel_error_l1norm_ << std::endl;
   // std::cerr << "error_l1_cov : " <<
   // full_original_accel_error_sql1_-full_original_accel_error_l1norm_*full_original_accel_error_l1norm_
@@ -1148,14 +1178,14 @@ void AccelBrakeMapCalibrator::executeEvaluation()
   const double part_orig_accel_sq_error = calculateAccelSquaredError(
     delayed_accel_pedal_ptr_->data, delayed_brake_pedal_ptr_->data, twist_ptr_->twist.linear.x,
     accel_map_, brake_map_);
-  pushDataToVec(part_orig_accel_sq_error, part_mse_que_size_, &part_original_accel_mse_que_);
-  part_original_accel_rmse_ = getAverage(part_original_accel_mse_que_);
+  part_original_accel_mse_que_.add(part_orig_accel_sq_error);
+  part_original_accel_rmse_ = part_original_accel_mse_que_.average();
 
   const double new_accel_sq_error = calculateAccelSquaredError(
     delayed_accel_pedal_ptr_->data, delayed_brake_pedal_ptr_->data, twist_ptr_->twist.linear.x,
     new_accel_map_, new_brake_map_);
-  pushDataToVec(new_accel_sq_error, part_mse_que_size_, &new_accel_mse_que_);
-  new_accel_rmse_ = getAverage(new_accel_mse_que_);
+  new_accel_mse_que_.add(new_accel_sq_error);
+  new_accel_rmse_ = new_accel_mse_que_.average();
 }
 
 double AccelBrakeMapCalibrator::calculateEstimatedAcc(
@@ -1249,34 +1279,6 @@ DataStampedPtr AccelBrakeMapCalibrator::getNearestTimeDataFromVec(
   return nearest_time_data;
 }
 
-double AccelBrakeMapCalibrator::getAverage(const std::vector<double> & vec)
-{
-  if (vec.empty()) {
-    return 0.0;
-  }
-
-  double sum = 0.0;
-  for (const auto num : vec) {
-    sum += num;
-  }
-  return sum / vec.size();
-}
-
-double AccelBrakeMapCalibrator::getStandardDeviation(const std::vector<double> & vec)
-{
-  if (vec.empty()) {
-    return 0.0;
-  }
-
-  const double ave = getAverage(vec);
-
-  double sum = 0.0;
-  for (const auto num : vec) {
-    sum += std::pow(num - ave, 2);
-  }
-  return std::sqrt(sum / vec.size());
-}
-
 bool AccelBrakeMapCalibrator::isTimeout(
   const builtin_interfaces::msg::Time & stamp, const double timeout_sec)
 {
@@ -1356,8 +1358,12 @@ void AccelBrakeMapCalibrator::checkUpdateSuggest(diagnostic_updater::DiagnosticS
 // function for debug
 
 void AccelBrakeMapCalibrator::publishMap(
-  const Map accel_map_value, const Map brake_map_value, const std::string publish_type)
+  const Map & accel_map_value, const Map & brake_map_value, const std::string publish_type)
 {
+  const auto & occ_pub = publish_type == "original" ? original_map_occ_pub_ : update_map_occ_pub_;
+  if (!tier4_autoware_utils::hasSubscription(*occ_pub)) {
+    return;
+  }
   if (accel_map_value.at(0).size() != brake_map_value.at(0).size()) {
     RCLCPP_ERROR_STREAM(
       get_logger(),
@@ -1374,8 +1380,7 @@ void AccelBrakeMapCalibrator::publishMap(
   int_map_value.resize(h * w);
   for (int i = 0; i < h; i++) {
     for (int j = 0; j < w; j++) {
-      const double value =
-        getMapColumnFromUnifiedIndex(accel_map_value_, brake_map_value_, i).at(j);
+      const double value = getMapColumnFromUnifiedIndex(accel_map_value, brake_map_value, i).at(j);
       // convert acc to 0~100 int value
       int8_t int_value =
         static_cast<uint8_t>(MAX_OCC_VALUE * ((value - min_accel_) / (max_accel_ - min_accel_)));
@@ -1383,11 +1388,25 @@ void AccelBrakeMapCalibrator::publishMap(
     }
   }
 
-  if (publish_type == "original") {
-    original_map_occ_pub_->publish(getOccMsg("base_link", h, w, map_resolution_, int_map_value));
-  } else {
-    update_map_occ_pub_->publish(getOccMsg("base_link", h, w, map_resolution_, int_map_value));
+  occ_pub->publish(getOccMsg("base_link", h, w, map_resolution_, int_map_value));
+}
+
+void AccelBrakeMapCalibrator::publishRawMap(
+  const Map & accel_map_value, const Map & brake_map_value, const std::string publish_type)
+{
+  const auto & raw_pub = publish_type == "original" ? original_map_raw_pub_ : update_map_raw_pub_;
+  if (!tier4_autoware_utils::hasSubscription(*raw_pub)) {
+    return;
+  }
+  if (accel_map_value.at(0).size() != brake_map_value.at(0).size()) {
+    RCLCPP_ERROR_STREAM(
+      get_logger(),
+      "Invalid map. The number of velocity index of accel map and brake map is different.");
+    return;
   }
+  const double h = accel_map_value.size() + brake_map_value.size() -
+                   1;  // pedal (accel_map_value(0) and brake_map_value(0) is same.)
+  const double w = accel_map_value.at(0).size();  // velocity
 
   // publish raw map
   Float32MultiArray float_map;
@@ -1404,21 +1423,20 @@ void AccelBrakeMapCalibrator::publishMap(
   std::vector<float> vec(h * w, 0);
   for (int i = 0; i < h; i++) {
     for (int j = 0; j < w; j++) {
-      vec[i * w + j] = static_cast<float>(
-        getMapColumnFromUnifiedIndex(accel_map_value_, brake_map_value_, i).at(j));
+      vec[i * w + j] =
+        static_cast<float>(getMapColumnFromUnifiedIndex(accel_map_value, brake_map_value, i).at(j));
     }
   }
   float_map.data = vec;
-  if (publish_type == "original") {
-    original_map_raw_pub_->publish(float_map);
-  } else {
-    update_map_raw_pub_->publish(float_map);
-  }
+  raw_pub->publish(float_map);
 }
 
 void AccelBrakeMapCalibrator::publishOffsetCovMap(
-  const Map accel_map_value, const Map brake_map_value)
+  const Map & accel_map_value, const Map & brake_map_value)
 {
+  if (!tier4_autoware_utils::hasSubscription(*offset_covariance_pub_)) {
+    return;
+  }
   if (accel_map_value.at(0).size() != brake_map_value.at(0).size()) {
     RCLCPP_ERROR_STREAM(
       get_logger(),
@@ -1468,6 +1486,12 @@ void AccelBrakeMapCalibrator::publishFloat32(const std::string publish_type, con
 
 void AccelBrakeMapCalibrator::publishCountMap()
 {
+  using tier4_autoware_utils::hasSubscription;
+  if (
+    !hasSubscription(*data_ave_pub_) && !hasSubscription(*data_std_pub_) &&
+    !hasSubscription(*data_count_pub_) && !hasSubscription(*data_count_with_self_pose_pub_)) {
+    return;
+  }
   if (accel_map_value_.at(0).size() != brake_map_value_.at(0).size()) {
     RCLCPP_ERROR_STREAM(
       get_logger(),
@@ -1486,26 +1510,26 @@ void AccelBrakeMapCalibrator::publishCountMap()
 
   for (int i = 0; i < h; i++) {
     for (int j = 0; j < w; j++) {
-      const auto data_vec = map_value_data_.at(i).at(j);
-      if (data_vec.empty()) {
+      const auto & data = map_value_data_.at(i).at(j);
+      if (data.count() == 0) {
         // input *UNKNOWN* value
         count_map.at(i * w + j) = -1;
         ave_map.at(i * w + j) = -1;
       } else {
         const auto count_rate =
-          MAX_OCC_VALUE * (static_cast<double>(data_vec.size()) / max_data_count_);
+          MAX_OCC_VALUE * (static_cast<double>(data.count()) / max_data_count_);
         count_map.at(i * w + j) = static_cast<int8_t>(
           std::max(std::min(static_cast<int>(MAX_OCC_VALUE), static_cast<int>(count_rate)), 0));
         // calculate average
         {
-          const double average = getAverage(data_vec);
+          const double average = data.mean();
           int8_t int_average = static_cast<uint8_t>(
             MAX_OCC_VALUE * ((average - min_accel_) / (max_accel_ - min_accel_)));
           ave_map.at(i * w + j) = std::max(std::min(MAX_OCC_VALUE, int_average), (int8_t)0);
         }
         // calculate standard deviation
         {
-          const double std_dev = getStandardDeviation(data_vec);
+          const double std_dev = data.standardDeviation();
           const double max_std_dev = 0.2;
           const double min_std_dev = 0.0;
           int8_t int_std_dev = static_cast<uint8_t>(
@@ -1534,6 +1558,9 @@ void AccelBrakeMapCalibrator::publishCountMap()
 
 void AccelBrakeMapCalibrator::publishIndex()
 {
+  if (!tier4_autoware_utils::hasSubscription(*index_pub_)) {
+    return;
+  }
   MarkerArray markers;
   const double h = accel_map_value_.size() + brake_map_value_.size() -
                    1;  // pedal (accel_map_value(0) and brake_map_value(0) is same.)
@@ -16,6 +16,7 @@
 #define RAW_VEHICLE_CMD_CONVERTER__ACCEL_MAP_HPP_
 
 #include "raw_vehicle_cmd_converter/csv_loader.hpp"
+#include "raw_vehicle_cmd_converter/map_lookup.hpp"
 
 #include <rclcpp/rclcpp.hpp>
 
@@ -32,6 +33,11 @@ public:
   bool readAccelMapFromCSV(const std::string & csv_path, const bool validation = false);
   bool getThrottle(const double acc, const double vel, double & throttle) const;
   bool getAcceleration(const double throttle, const double vel, double & acc) const;
+  /**
+   * @brief build the uniform grid of the inverse map to get the throttle in constant time
+   * @param [in] size number of the grid points along the velocity and the acceleration axes
+   */
+  void buildLookupGrid(const size_t size);
   std::vector<double> getVelIdx() const { return vel_index_; }
   std::vector<double> getThrottleIdx() const { return throttle_index_; }
   std::vector<std::vector<double>> getAccelMap() const { return accel_map_; }
@@ -43,6 +49,7 @@ private:
   std::vector<double> vel_index_;
   std::vector<double> throttle_index_;
   std::vector<std::vector<double>> accel_map_;
+  InverseMapGrid throttle_grid_;
 };
 }  // namespace raw_vehicle_cmd_converter
 
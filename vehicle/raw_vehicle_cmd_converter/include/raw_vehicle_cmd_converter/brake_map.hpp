@@ -16,6 +16,7 @@
 #define RAW_VEHICLE_CMD_CONVERTER__BRAKE_MAP_HPP_
 
 #include "raw_vehicle_cmd_converter/csv_loader.hpp"
+#include "raw_vehicle_cmd_converter/map_lookup.hpp"
 
 #include <rclcpp/rclcpp.hpp>
 
@@ -32,6 +33,11 @@ public:
   bool readBrakeMapFromCSV(const std::string & csv_path, const bool validation = false);
   bool getBrake(const double acc, const double vel, double & brake);
   bool getAcceleration(const double brake, const double vel, double & acc) const;
+  /**
+   * @brief build the uniform grid of the inverse map to get the brake in constant time
+   * @param [in] size number of the grid points along the velocity and the acceleration axes
+   */
+  void buildLookupGrid(const size_t size);
   std::vector<double> getVelIdx() const { return vel_index_; }
   std::vector<double> getBrakeIdx() const { return brake_index_; }
   std::vector<std::vector<double>> getBrakeMap() const { return brake_map_; }
@@ -42,8 +48,8 @@ private:
   std::string vehicle_name_;
   std::vector<double> vel_index_;
   std::vector<double> brake_index_;
-  std::vector<double> brake_index_rev_;
   std::vector<std::vector<double>> brake_map_;
+  InverseMapGrid brake_grid_;
 };
 }  // namespace raw_vehicle_cmd_converter
 
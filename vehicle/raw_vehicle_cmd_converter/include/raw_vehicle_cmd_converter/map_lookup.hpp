@@ -0,0 +1,106 @@
+//  Copyright 2023 Tier IV, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#ifndef RAW_VEHICLE_CMD_CONVERTER__MAP_LOOKUP_HPP_
+#define RAW_VEHICLE_CMD_CONVERTER__MAP_LOOKUP_HPP_
+
+#include "raw_vehicle_cmd_converter/csv_loader.hpp"
+
+#include <vector>
+
+namespace raw_vehicle_cmd_converter
+{
+/**
+ * @brief segment of an index containing a value, and the ratio of the value in the segment
+ */
+struct MapSegment
+{
+  size_t index;
+  double ratio;
+};
+
+/**
+ * @brief find the segment of the sorted index containing the value without allocation
+ * @details The segment is the same as the one used by interpolation::lerp.
+ */
+MapSegment findMapSegment(const std::vector<double> & index, const double value);
+
+/**
+ * @brief interpolate the row of a map at the segment of the column index
+ */
+double interpolateMapRow(const std::vector<double> & row, const MapSegment & col);
+
+/**
+ * @brief interpolate the map at the segments of the row index and the column index
+ */
+double interpolateMap(const Map & map, const MapSegment & row, const MapSegment & col);
+
+/**
+ * @brief calculate the row index value giving the map value at the segment of the column index
+ * @details The map values are assumed to be monotonic along the rows. The map value has to be
+ * clamped by the caller into the range of the map values at the column.
+ * @param [in] row_index index of the rows of the map
+ * @param [in] map map whose rows are in the order of row_index
+ * @param [in] col segment of the column index
+ * @param [in] value map value to invert
+ * @return interpolated row index value
+ */
+double invertMap(
+  const std::vector<double> & row_index, const Map & map, const MapSegment & col,
+  const double value);
+
+/**
+ * @brief uniform grid of the inverse of a map for the lookup in constant time
+ * @details The map gives a value for each (row index value, column index value), e.g. the
+ * acceleration for each (throttle, velocity). The grid is densely resampled from the map once,
+ * and gives the row index value for each (column index value, map value) by bilinear
+ * interpolation, e.g. the throttle for each (velocity, acceleration). The result has an
+ * interpolation error from the exact inverse, which decreases with the size of the grid.
+ */
+class InverseMapGrid
+{
+public:
+  /**
+   * @brief resample the inverse of the map
+   * @param [in] row_index index of the rows of the map
+   * @param [in] col_index index of the columns of the map
+   * @param [in] map map whose values are monotonic along the rows
+   * @param [in] size number of the grid points along each axis (at least 2)
+   */
+  void build(
+    const std::vector<double> & row_index, const std::vector<double> & col_index, const Map & map,
+    const size_t size);
+
+  /**
+   * @brief check if the grid is built
+   */
+  bool empty() const { return table_.empty(); }
+
+  /**
+   * @brief get the row index value giving the map value at the column index value
+   * @details The values out of the grid are clamped into the grid.
+   */
+  double lookup(const double col_value, const double map_value) const;
+
+private:
+  size_t size_{0};
+  double col_min_{0.0};
+  double col_step_inv_{0.0};
+  double value_min_{0.0};
+  double value_step_inv_{0.0};
+  std::vector<double> table_;  // row index values in the order of the columns then the values
+};
+}  // namespace raw_vehicle_cmd_converter
+
+#endif  // RAW_VEHICLE_CMD_CONVERTER__MAP_LOOKUP_HPP_
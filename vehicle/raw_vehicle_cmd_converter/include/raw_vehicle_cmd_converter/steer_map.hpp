@@ -16,6 +16,7 @@
 #define RAW_VEHICLE_CMD_CONVERTER__STEER_MAP_HPP_
 
 #include "raw_vehicle_cmd_converter/csv_loader.hpp"
+#include "raw_vehicle_cmd_converter/map_lookup.hpp"
 #include "raw_vehicle_cmd_converter/pid.hpp"
 
 #include <rclcpp/rclcpp.hpp>
@@ -30,12 +31,18 @@ class SteerMap
 public:
   bool readSteerMapFromCSV(const std::string & csv_path, const bool validation = false);
   void getSteer(const double steer_rate, const double steer, double & output) const;
+  /**
+   * @brief build the uniform grid of the inverse map to get the output in constant time
+   * @param [in] size number of the grid points along the steer and the steer rate axes
+   */
+  void buildLookupGrid(const size_t size);
 
 private:
   std::string vehicle_name_;
   std::vector<double> steer_index_;
   std::vector<double> output_index_;
   std::vector<std::vector<double>> steer_map_;
+  InverseMapGrid output_grid_;
   rclcpp::Logger logger_{rclcpp::get_logger("raw_vehicle_cmd_converter").get_child("steer_map")};
 };
 }  // namespace raw_vehicle_cmd_converter
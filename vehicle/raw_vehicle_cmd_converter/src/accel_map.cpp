@@ -14,8 +14,6 @@
 
 #include "raw_vehicle_cmd_converter/accel_map.hpp"
 
-#include "interpolation/linear_interpolation.hpp"
-
 #include <algorithm>
 #include <chrono>
 #include <string>
@@ -38,6 +36,7 @@ bool AccelMap::readAccelMapFromCSV(const std::string & csv_path, const bool vali
   vel_index_ = CSVLoader::getRowIndex(table);
   throttle_index_ = CSVLoader::getColumnIndex(table);
   accel_map_ = CSVLoader::getMap(table);
+  throttle_grid_ = InverseMapGrid();
   if (validation && !CSVLoader::validateMap(accel_map_, true)) {
     return false;
   }
@@ -46,41 +45,42 @@ bool AccelMap::readAccelMapFromCSV(const std::string & csv_path, const bool vali
 
 bool AccelMap::getThrottle(const double acc, double vel, double & throttle) const
 {
-  std::vector<double> interpolated_acc_vec;
   const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "throttle: vel");
   // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  for (std::vector<double> accelerations : accel_map_) {
-    interpolated_acc_vec.push_back(interpolation::lerp(vel_index_, accelerations, clamped_vel));
-  }
+  const auto vel_segment = findMapSegment(vel_index_, clamped_vel);
+  const double min_acc = interpolateMapRow(accel_map_.front(), vel_segment);
+  const double max_acc = interpolateMapRow(accel_map_.back(), vel_segment);
   // calculate throttle
   // When the desired acceleration is smaller than the throttle area, return false => brake sequence
   // When the desired acceleration is greater than the throttle area, return max throttle
-  if (acc < interpolated_acc_vec.front()) {
+  if (acc < min_acc) {
     return false;
-  } else if (interpolated_acc_vec.back() < acc) {
+  } else if (max_acc < acc) {
     throttle = throttle_index_.back();
     return true;
   }
-  throttle = interpolation::lerp(interpolated_acc_vec, throttle_index_, acc);
+  throttle = throttle_grid_.empty() ? invertMap(throttle_index_, accel_map_, vel_segment, acc)
+                                    : throttle_grid_.lookup(clamped_vel, acc);
   return true;
 }
 
 bool AccelMap::getAcceleration(const double throttle, const double vel, double & acc) const
 {
-  std::vector<double> interpolated_acc_vec;
   const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "throttle: vel");
 
-  // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  for (const auto & acc_vec : accel_map_) {
-    interpolated_acc_vec.push_back(interpolation::lerp(vel_index_, acc_vec, clamped_vel));
-  }
-
   // calculate throttle
   // When the desired acceleration is smaller than the throttle area, return min acc
   // When the desired acceleration is greater than the throttle area, return max acc
   const double clamped_throttle = CSVLoader::clampValue(throttle, throttle_index_, "throttle: acc");
-  acc = interpolation::lerp(throttle_index_, interpolated_acc_vec, clamped_throttle);
+  acc = interpolateMap(
+    accel_map_, findMapSegment(throttle_index_, clamped_throttle),
+    findMapSegment(vel_index_, clamped_vel));
 
   return true;
 }
+
+void AccelMap::buildLookupGrid(const size_t size)
+{
+  throttle_grid_.build(throttle_index_, vel_index_, accel_map_, size);
+}
 }  // namespace raw_vehicle_cmd_converter
@@ -14,8 +14,6 @@
 
 #include "raw_vehicle_cmd_converter/brake_map.hpp"
 
-#include "interpolation/linear_interpolation.hpp"
-
 #include <algorithm>
 #include <string>
 #include <vector>
@@ -35,63 +33,62 @@ bool BrakeMap::readBrakeMapFromCSV(const std::string & csv_path, const bool vali
   vel_index_ = CSVLoader::getRowIndex(table);
   brake_index_ = CSVLoader::getColumnIndex(table);
   brake_map_ = CSVLoader::getMap(table);
-  brake_index_rev_ = brake_index_;
+  brake_grid_ = InverseMapGrid();
   if (validation && !CSVLoader::validateMap(brake_map_, false)) {
     return false;
   }
-  std::reverse(std::begin(brake_index_rev_), std::end(brake_index_rev_));
 
   return true;
 }
 
 bool BrakeMap::getBrake(const double acc, const double vel, double & brake)
 {
-  std::vector<double> interpolated_acc_vec;
   const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "brake: vel");
 
   // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  for (std::vector<double> accelerations : brake_map_) {
-    interpolated_acc_vec.push_back(interpolation::lerp(vel_index_, accelerations, clamped_vel));
-  }
+  const auto vel_segment = findMapSegment(vel_index_, clamped_vel);
+  const double max_acc = interpolateMapRow(brake_map_.front(), vel_segment);
+  const double min_acc = interpolateMapRow(brake_map_.back(), vel_segment);
 
   // calculate brake
   // When the desired acceleration is smaller than the brake area, return max brake on the map
   // When the desired acceleration is greater than the brake area, return min brake on the map
-  if (acc < interpolated_acc_vec.back()) {
+  if (acc < min_acc) {
     RCLCPP_WARN_SKIPFIRST_THROTTLE(
       logger_, clock_, 1000,
       "Exceeding the acc range. Desired acc: %f < min acc on map: %f. return max "
       "value.",
-      acc, interpolated_acc_vec.back());
+      acc, min_acc);
     brake = brake_index_.back();
     return true;
-  } else if (interpolated_acc_vec.front() < acc) {
+  } else if (max_acc < acc) {
     brake = brake_index_.front();
     return true;
   }
 
-  std::reverse(std::begin(interpolated_acc_vec), std::end(interpolated_acc_vec));
-  brake = interpolation::lerp(interpolated_acc_vec, brake_index_rev_, acc);
+  brake = brake_grid_.empty() ? invertMap(brake_index_, brake_map_, vel_segment, acc)
+                              : brake_grid_.lookup(clamped_vel, acc);
 
   return true;
 }
 
 bool BrakeMap::getAcceleration(const double brake, const double vel, double & acc) const
 {
-  std::vector<double> interpolated_acc_vec;
   const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "brake: vel");
 
-  // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  for (const auto & acc_vec : brake_map_) {
-    interpolated_acc_vec.push_back(interpolation::lerp(vel_index_, acc_vec, clamped_vel));
-  }
-
   // calculate brake
   // When the desired acceleration is smaller than the brake area, return min acc
   // When the desired acceleration is greater than the brake area, return min acc
   const double clamped_brake = CSVLoader::clampValue(brake, brake_index_, "brake: acc");
-  acc = interpolation::lerp(brake_index_, interpolated_acc_vec, clamped_brake);
+  acc = interpolateMap(
+    brake_map_, findMapSegment(brake_index_, clamped_brake),
+    findMapSegment(vel_index_, clamped_vel));
 
   return true;
 }
+
+void BrakeMap::buildLookupGrid(const size_t size)
+{
+  brake_grid_.build(brake_index_, vel_index_, brake_map_, size);
+}
 }  // namespace raw_vehicle_cmd_converter
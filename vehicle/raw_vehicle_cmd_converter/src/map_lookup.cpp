@@ -0,0 +1,143 @@
+//  Copyright 2023 Tier IV, Inc. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include "raw_vehicle_cmd_converter/map_lookup.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace raw_vehicle_cmd_converter
+{
+namespace
+{
+double lerp(const double src_val, const double dst_val, const double ratio)
+{
+  return src_val + (dst_val - src_val) * ratio;
+}
+
+// position of the value in the uniform grid, clamped into the grid
+MapSegment findGridSegment(
+  const double value, const double min, const double step_inv, const size_t size)
+{
+  const double position = std::clamp((value - min) * step_inv, 0.0, static_cast<double>(size - 1));
+  const auto index = std::min(static_cast<size_t>(position), size - 2);
+  return {index, position - static_cast<double>(index)};
+}
+}  // namespace
+
+MapSegment findMapSegment(const std::vector<double> & index, const double value)
+{
+  if (index.size() < 2) {
+    return {0, 0.0};
+  }
+  // first segment whose end is not less than the value
+  const auto itr = std::lower_bound(index.begin() + 1, index.end() - 1, value);
+  const auto i = static_cast<size_t>(std::distance(index.begin(), itr)) - 1;
+  return {i, (value - index[i]) / (index[i + 1] - index[i])};
+}
+
+double interpolateMapRow(const std::vector<double> & row, const MapSegment & col)
+{
+  if (col.index + 1 >= row.size()) {
+    return row[col.index];
+  }
+  return lerp(row[col.index], row[col.index + 1], col.ratio);
+}
+
+double interpolateMap(const Map & map, const MapSegment & row, const MapSegment & col)
+{
+  const double src_val = interpolateMapRow(map[row.index], col);
+  if (row.index + 1 >= map.size()) {
+    return src_val;
+  }
+  return lerp(src_val, interpolateMapRow(map[row.index + 1], col), row.ratio);
+}
+
+double invertMap(
+  const std::vector<double> & row_index, const Map & map, const MapSegment & col,
+  const double value)
+{
+  if (map.size() < 2) {
+    return row_index.front();
+  }
+  const bool is_increasing = interpolateMapRow(map.back(), col) > interpolateMapRow(map[0], col);
+
+  // first segment whose end reaches the value
+  size_t i = 0;
+  double src_val = interpolateMapRow(map[0], col);
+  double dst_val = interpolateMapRow(map[1], col);
+  while (i + 2 < map.size() && (is_increasing ? dst_val < value : value < dst_val)) {
+    ++i;
+    src_val = dst_val;
+    dst_val = interpolateMapRow(map[i + 1], col);
+  }
+  if (dst_val == src_val) {
+    return row_index[i];
+  }
+  return lerp(row_index[i], row_index[i + 1], (value - src_val) / (dst_val - src_val));
+}
+
+void InverseMapGrid::build(
+  const std::vector<double> & row_index, const std::vector<double> & col_index, const Map & map,
+  const size_t size)
+{
+  table_.clear();
+  if (size < 2 || col_index.size() < 2 || !(col_index.front() < col_index.back()) || map.empty()) {
+    return;
+  }
+
+  double value_max = map[0][0];
+  value_min_ = map[0][0];
+  for (const auto & row : map) {
+    value_min_ = std::min(value_min_, *std::min_element(row.begin(), row.end()));
+    value_max = std::max(value_max, *std::max_element(row.begin(), row.end()));
+  }
+  if (!(value_min_ < value_max)) {
+    return;
+  }
+
+  size_ = size;
+  col_min_ = col_index.front();
+  const double col_step = (col_index.back() - col_min_) / static_cast<double>(size - 1);
+  const double value_step = (value_max - value_min_) / static_cast<double>(size - 1);
+  col_step_inv_ = 1.0 / col_step;
+  value_step_inv_ = 1.0 / value_step;
+
+  table_.reserve(size * size);
+  for (size_t i = 0; i < size; ++i) {
+    const double col_value = i + 1 == size ? col_index.back() : col_min_ + col_step * i;
+    const auto col = findMapSegment(col_index, col_value);
+    const double front = interpolateMapRow(map.front(), col);
+    const double back = interpolateMapRow(map.back(), col);
+    for (size_t j = 0; j < size; ++j) {
+      // the values out of the map at the column give the row index value of the nearest end
+      const double value = std::clamp(
+        value_min_ + value_step * j, std::min(front, back), std::max(front, back));
+      table_.push_back(invertMap(row_index, map, col, value));
+    }
+  }
+}
+
+double InverseMapGrid::lookup(const double col_value, const double map_value) const
+{
+  const auto col = findGridSegment(col_value, col_min_, col_step_inv_, size_);
+  const auto value = findGridSegment(map_value, value_min_, value_step_inv_, size_);
+  const double * src_row = &table_[col.index * size_];
+  const double * dst_row = src_row + size_;
+  return lerp(
+    lerp(src_row[value.index], src_row[value.index + 1], value.ratio),
+    lerp(dst_row[value.index], dst_row[value.index + 1], value.ratio), col.ratio);
+}
+}  // namespace raw_vehicle_cmd_converter
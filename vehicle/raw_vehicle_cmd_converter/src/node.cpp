@@ -41,20 +41,35 @@ RawVehicleCommandConverterNode::RawVehicleCommandConverterNode(
   // for steering steer controller
   use_steer_ff_ = declare_parameter("use_steer_ff", true);
   use_steer_fb_ = declare_parameter("use_steer_fb", true);
+  // for the precomputed inverse maps
+  const auto use_lookup_grid = declare_parameter("use_lookup_grid", false);
+  const auto lookup_grid_size = declare_parameter("lookup_grid_size", 256);
+  if (use_lookup_grid && lookup_grid_size < 2) {
+    throw std::invalid_argument("lookup_grid_size must be at least 2.");
+  }
   if (convert_accel_cmd_) {
     if (!accel_map_.readAccelMapFromCSV(csv_path_accel_map, true)) {
       throw std::invalid_argument("Accel map is invalid.");
     }
+    if (use_lookup_grid) {
+      accel_map_.buildLookupGrid(static_cast<size_t>(lookup_grid_size));
+    }
   }
   if (convert_brake_cmd_) {
     if (!brake_map_.readBrakeMapFromCSV(csv_path_brake_map, true)) {
       throw std::invalid_argument("Brake map is invalid.");
     }
+    if (use_lookup_grid) {
+      brake_map_.buildLookupGrid(static_cast<size_t>(lookup_grid_size));
+    }
   }
   if (convert_steer_cmd_) {
     if (!steer_map_.readSteerMapFromCSV(csv_path_steer_map, true)) {
       throw std::invalid_argument("Steer map is invalid.");
     }
+    if (use_lookup_grid) {
+      steer_map_.buildLookupGrid(static_cast<size_t>(lookup_grid_size));
+    }
     const auto kp_steer{declare_parameter("steer_pid.kp", 150.0)};
     const auto ki_steer{declare_parameter("steer_pid.ki", 15.0)};
     const auto kd_steer{declare_parameter("steer_pid.kd", 0.0)};
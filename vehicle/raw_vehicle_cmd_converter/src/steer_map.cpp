@@ -14,8 +14,7 @@
 
 #include "raw_vehicle_cmd_converter/steer_map.hpp"
 
-#include "interpolation/linear_interpolation.hpp"
-
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -35,6 +34,7 @@ bool SteerMap::readSteerMapFromCSV(const std::string & csv_path, const bool vali
   steer_index_ = CSVLoader::getRowIndex(table);
   output_index_ = CSVLoader::getColumnIndex(table);
   steer_map_ = CSVLoader::getMap(table);
+  output_grid_ = InverseMapGrid();
   if (validation && !CSVLoader::validateMap(steer_map_, true)) {
     return false;
   }
@@ -44,13 +44,20 @@ bool SteerMap::readSteerMapFromCSV(const std::string & csv_path, const bool vali
 void SteerMap::getSteer(const double steer_rate, const double steer, double & output) const
 {
   const double clamped_steer = CSVLoader::clampValue(steer, steer_index_, "steer: steer");
-  std::vector<double> steer_rate_interp = {};
-  for (const auto & steer_rate_vec : steer_map_) {
-    steer_rate_interp.push_back(interpolation::lerp(steer_index_, steer_rate_vec, clamped_steer));
-  }
+  const auto steer_segment = findMapSegment(steer_index_, clamped_steer);
+  const double front_steer_rate = interpolateMapRow(steer_map_.front(), steer_segment);
+  const double back_steer_rate = interpolateMapRow(steer_map_.back(), steer_segment);
+
+  const double clamped_steer_rate = CSVLoader::clampValue(
+    steer_rate, std::min(front_steer_rate, back_steer_rate),
+    std::max(front_steer_rate, back_steer_rate), "steer: steer_rate");
+  output = output_grid_.empty()
+             ? invertMap(output_index_, steer_map_, steer_segment, clamped_steer_rate)
+             : output_grid_.lookup(clamped_steer, clamped_steer_rate);
+}
 
-  const double clamped_steer_rate =
-    CSVLoader::clampValue(steer_rate, steer_rate_interp, "steer: steer_rate");
-  output = interpolation::lerp(steer_rate_interp, output_index_, clamped_steer_rate);
+void SteerMap::buildLookupGrid(const size_t size)
+{
+  output_grid_.build(output_index_, steer_index_, steer_map_, size);
 }
 }  // namespace raw_vehicle_cmd_converter
@@ -230,6 +230,52 @@ TEST(ConverterTests, SteerMapCalculation)
   EXPECT_DOUBLE_EQ(calcSteer(5.0, 5.0), 5.0);
 }
 
+TEST(ConverterTests, LookupGridCalculation)
+{
+  AccelMap accel_map;
+  AccelMap accel_map_grid;
+  loadAccelMapData(accel_map);
+  loadAccelMapData(accel_map_grid);
+  accel_map_grid.buildLookupGrid(101);
+  BrakeMap brake_map;
+  BrakeMap brake_map_grid;
+  loadBrakeMapData(brake_map);
+  loadBrakeMapData(brake_map_grid);
+  brake_map_grid.buildLookupGrid(101);
+  SteerMap steer_map;
+  SteerMap steer_map_grid;
+  loadSteerMapData(steer_map);
+  loadSteerMapData(steer_map_grid);
+  steer_map_grid.buildLookupGrid(101);
+
+  // the grid is close to the exact inverse, and the limits of the map are the same
+  for (double vel = 0.0; vel <= 10.0; vel += 0.7) {
+    for (double acc = -3.5; acc <= 3.5; acc += 0.05) {
+      double throttle = 0.0;
+      double throttle_grid = 0.0;
+      EXPECT_EQ(
+        accel_map.getThrottle(acc, vel, throttle),
+        accel_map_grid.getThrottle(acc, vel, throttle_grid));
+      EXPECT_NEAR(throttle, throttle_grid, 0.01);
+
+      double brake = 0.0;
+      double brake_grid = 0.0;
+      brake_map.getBrake(acc, vel, brake);
+      brake_map_grid.getBrake(acc, vel, brake_grid);
+      EXPECT_NEAR(brake, brake_grid, 0.01);
+    }
+  }
+  for (double steer = -10.0; steer <= 10.0; steer += 0.7) {
+    for (double steer_rate = -10.0; steer_rate <= 10.0; steer_rate += 0.3) {
+      double output = 0.0;
+      double output_grid = 0.0;
+      steer_map.getSteer(steer_rate, steer, output);
+      steer_map_grid.getSteer(steer_rate, steer, output_grid);
+      EXPECT_NEAR(output, output_grid, 0.01);
+    }
+  }
+}
+
 TEST(PIDTests, calculateFB)
 {
   PIDController steer_pid;